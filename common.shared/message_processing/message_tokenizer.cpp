@@ -31,6 +31,20 @@ common::tools::message_tokenizer::message_tokenizer(
     const std::string& _files_url,
     std::vector<url_parser::compare_item>&& _items)
 {
+    const auto fixed_urls_need_parser = std::any_of(_items.begin(), _items.end(), [](const auto& _item)
+    {
+        return !_item.str.empty() && !url_parser::has_url_candidates(_item.str);
+    });
+
+    if (!fixed_urls_need_parser && !url_parser::has_url_candidates(_message))
+    {
+        if (!_message.empty())
+            tokens_.push(message_token(std::string(_message)));
+
+        tokens_.push(message_token()); // terminator
+        return;
+    }
+
     size_t prev = 0;
     size_t i = 0;
 
@@ -92,6 +106,36 @@ common::tools::message_tokenizer::message_tokenizer(
     tokens_.push(message_token()); // terminator
 }
 
+common::tools::message_tokenizer::message_tokenizer(const std::string& _message, const message_spans& _spans)
+{
+    assert(_spans.text_size_ == _message.size());
+
+    size_t prev = 0;
+
+    for (const auto& span : _spans.spans_)
+    {
+        if (span.offset_ < prev || size_t(span.offset_) + span.length_ > _message.size())
+        {
+            assert(!"invalid token span");
+            break;
+        }
+
+        if (span.offset_ > prev)
+            tokens_.push(message_token(_message.substr(prev, span.offset_ - prev)));
+
+        auto original = _message.substr(span.offset_, span.length_);
+        auto url_text = span.url_.empty() ? original : span.url_;
+        tokens_.push(message_token(url(std::move(original), std::move(url_text), span.type_, span.protocol_, span.extension_)));
+
+        prev = span.offset_ + span.length_;
+    }
+
+    if (prev < _message.size())
+        tokens_.push(message_token(_message.substr(prev)));
+
+    tokens_.push(message_token()); // terminator
+}
+
 bool common::tools::message_tokenizer::has_token() const
 {
     return tokens_.size() > 1;
@@ -108,6 +152,107 @@ void common::tools::message_tokenizer::next()
         tokens_.pop();
 }
 
+std::vector<common::tools::url_parser::compare_item> common::tools::make_profile_urls(std::string_view _profile_domain, std::string_view _profile_domain_agent)
+{
+    std::vector<url_parser::compare_item> items;
+    items.reserve(2);
+
+    for (auto domain : { _profile_domain, _profile_domain_agent })
+    {
+        url_parser::compare_item item;
+        item.str.reserve(domain.size() + 1);
+        item.str += domain;
+        item.str += '/';
+        item.ok_state = url_parser::states::profile_id;
+        item.safe_pos = int(item.str.length()) - 1;
+
+        items.push_back(std::move(item));
+    }
+
+    return items;
+}
+
+uint32_t common::tools::spans_key(const std::string& _files_url, const std::vector<url_parser::compare_item>& _items)
+{
+    // bump when the tokenizer starts to split texts differently
+    constexpr uint32_t tokenizer_version = 1;
+
+    uint32_t hash = 2166136261u ^ tokenizer_version;
+
+    const auto add = [&hash](uint32_t _value)
+    {
+        hash ^= _value;
+        hash *= 16777619u;
+    };
+
+    const auto add_string = [&add](std::string_view _str)
+    {
+        for (const auto c : _str)
+            add(uint8_t(c));
+
+        add(0xffffffff);
+    };
+
+    add_string(_files_url);
+
+    for (const auto& item : _items)
+    {
+        add_string(item.str);
+        add(uint32_t(item.ok_state));
+        add(uint32_t(item.safe_pos));
+    }
+
+    return hash != 0 ? hash : 1;
+}
+
+common::tools::message_spans common::tools::make_spans(const std::string& _message, const std::string& _files_url, std::vector<url_parser::compare_item> _items)
+{
+    if (_message.size() > std::numeric_limits<uint32_t>::max())
+        return message_spans();
+
+    message_spans result;
+    result.key_ = spans_key(_files_url, _items);
+    result.text_size_ = uint32_t(_message.size());
+
+    size_t offset = 0;
+
+    for (message_tokenizer tokenizer(_message, _files_url, std::move(_items)); tokenizer.has_token(); tokenizer.next())
+    {
+        const auto& token = tokenizer.current();
+
+        if (token.type_ == message_token::type::text)
+        {
+            offset += boost::get<std::string>(token.data_).size();
+            continue;
+        }
+
+        const auto& u = boost::get<url>(token.data_);
+
+        // the parser steps over mentions, an url next to one may not be a plain slice of the text
+        if (offset > _message.size() || _message.compare(offset, u.original_.size(), u.original_) != 0)
+            return message_spans();
+
+        token_span span;
+        span.offset_ = uint32_t(offset);
+        span.length_ = uint32_t(u.original_.size());
+        span.type_ = u.type_;
+        span.protocol_ = u.protocol_;
+        span.extension_ = u.extension_;
+
+        if (u.url_ != u.original_)
+            span.url_ = u.url_;
+
+        result.spans_.push_back(std::move(span));
+
+        offset += u.original_.size();
+    }
+
+    if (offset != _message.size())
+        return message_spans();
+
+    return result;
+}
+
 std::ostream& operator<<(std::ostream& _out, common::tools::message_token::type _type)
 {
     switch (_type)
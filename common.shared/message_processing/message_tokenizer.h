@@ -29,12 +29,48 @@ namespace common
             data_t data_;
         };
 
+        // position of an url token in the message text, in bytes.
+        // mentions have no spans, the gui matches them against the mentions map of the message when it lays out the words
+        struct token_span final
+        {
+            uint32_t offset_ = 0;
+            uint32_t length_ = 0;
+
+            url::type type_ = url::type::undefined;
+            url::protocol protocol_ = url::protocol::undefined;
+            url::extension extension_ = url::extension::undefined;
+
+            // empty if the url is the spanned text itself
+            std::string url_;
+        };
+
+        // url tokens of a message text, the core computes them once when it stores the message
+        struct message_spans final
+        {
+            // parser settings the spans were computed with, see spans_key(); 0 if there are no spans
+            uint32_t key_ = 0;
+            uint32_t text_size_ = 0;
+
+            std::vector<token_span> spans_;
+
+            bool is_valid() const noexcept { return key_ != 0; }
+            bool is_valid_for(std::string_view _text, uint32_t _key) const noexcept { return is_valid() && key_ == _key && text_size_ == _text.size(); }
+        };
+
+        std::vector<url_parser::compare_item> make_profile_urls(std::string_view _profile_domain, std::string_view _profile_domain_agent);
+
+        uint32_t spans_key(const std::string& _files_url, const std::vector<url_parser::compare_item>& _items);
+        message_spans make_spans(const std::string& _message, const std::string& _files_url, std::vector<url_parser::compare_item> _items);
+
         class message_tokenizer final
         {
         public:
             explicit message_tokenizer(const std::string& _message, const std::string& _files_url);
             message_tokenizer(const std::string& _message, const std::string& _files_url, std::vector<url_parser::compare_item> &&_items);
 
+            // replays spans made by make_spans() for the same text instead of parsing it
+            message_tokenizer(const std::string& _message, const message_spans& _spans);
+
             bool has_token() const;
             const message_token& current() const;
 
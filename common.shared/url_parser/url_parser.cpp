@@ -10,6 +10,11 @@
 
 #include <cctype>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define URL_PARSER_SSE2
+    #include <emmintrin.h>
+#endif
+
 namespace
 {
     #include "domain_parser.in"
@@ -277,6 +282,70 @@ common::tools::url_vector_t common::tools::url_parser::parse_urls(const std::str
     return urls;
 }
 
+namespace
+{
+    template <typename T>
+    bool is_url_candidate(T _c) noexcept
+    {
+        return _c == T('.') || _c == T(':') || _c == T('@');
+    }
+}
+
+bool common::tools::url_parser::has_url_candidates(std::string_view _text) noexcept
+{
+    size_t i = 0;
+    const auto size = _text.size();
+
+#ifdef URL_PARSER_SSE2
+    const auto dot = _mm_set1_epi8('.');
+    const auto colon = _mm_set1_epi8(':');
+    const auto at = _mm_set1_epi8('@');
+
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_text.data() + i));
+        const auto found = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, dot), _mm_cmpeq_epi8(chars, colon)), _mm_cmpeq_epi8(chars, at));
+        if (_mm_movemask_epi8(found))
+            return true;
+    }
+#endif
+
+    for (; i < size; ++i)
+    {
+        if (is_url_candidate(_text[i]))
+            return true;
+    }
+
+    return false;
+}
+
+bool common::tools::url_parser::has_url_candidates(const char16_t* _text, size_t _size) noexcept
+{
+    size_t i = 0;
+
+#ifdef URL_PARSER_SSE2
+    const auto dot = _mm_set1_epi16('.');
+    const auto colon = _mm_set1_epi16(':');
+    const auto at = _mm_set1_epi16('@');
+
+    for (; i + 8 <= _size; i += 8)
+    {
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_text + i));
+        const auto found = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(chars, dot), _mm_cmpeq_epi16(chars, colon)), _mm_cmpeq_epi16(chars, at));
+        if (_mm_movemask_epi8(found))
+            return true;
+    }
+#endif
+
+    for (; i < _size; ++i)
+    {
+        if (is_url_candidate(_text[i]))
+            return true;
+    }
+
+    return false;
+}
+
 void common::tools::url_parser::add_fixed_urls(std::vector<compare_item> &&_items)
 {
     for (auto&& item : _items)
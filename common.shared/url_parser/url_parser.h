@@ -189,6 +189,11 @@ namespace common
 
             static url_vector_t parse_urls(const std::string& _source, const std::string& _files_url);
 
+            // false if the text has none of the characters every url needs ('.', ':' or '@'),
+            // so a caller may skip feeding it to the parser
+            static bool has_url_candidates(std::string_view _text) noexcept;
+            static bool has_url_candidates(const char16_t* _text, size_t _size) noexcept;
+
             void add_fixed_urls(std::vector<compare_item>&& _items);
 
         private:
@@ -18,7 +18,7 @@ contact_archive::contact_archive(const std::wstring& _archive_path, const std::s
     , data_(std::make_unique<messages_data>(_archive_path + L'/' + db_filename()))
     , state_(std::make_unique<archive_state>(_archive_path + L'/' + dlg_state_filename(), _contact_id))
     , mentions_(std::make_unique<mentions_me>(_archive_path + L'/' + mentions_filename()))
-    , gallery_(std::make_unique<gallery_storage>(_archive_path + L'/' + gallery_cache_filename(), _archive_path + L'/' + gallery_state_filename()))
+    , gallery_(std::make_unique<gallery_storage>(_archive_path + L'/' + gallery_cache_filename(), _archive_path + L'/' + gallery_state_filename(), _archive_path + L'/' + gallery_index_filename()))
     , local_loaded_(false)
 {
 }
@@ -220,6 +220,8 @@ void contact_archive::insert_history_block(
     bool _has_older_message_id
 )
 {
+    store_text_spans();
+
     Out _updated_state = state_->get_state();
 
     archive::history_block insert_data;
@@ -338,6 +340,8 @@ void contact_archive::insert_history_block(
 
 void contact_archive::update_message_data(const history_message& _message)
 {
+    store_text_spans();
+
     message_header existing_header;
 
     if (!index_->get_header(_message.get_msgid(), Out existing_header))
@@ -372,11 +376,50 @@ void contact_archive::update_message_data(const history_message& _message)
 
 }
 
+void contact_archive::store_text_spans()
+{
+    auto updates = data_->take_text_spans_updates();
+    if (updates.empty())
+        return;
+
+    history_block block;
+    block.reserve(updates.size());
+
+    std::set<int64_t> ids;
+    for (auto& [header, message] : updates)
+    {
+        // the index header is rebuilt from the message, so it's written only if the message is still the same
+        message_header existing_header;
+        if (!index_->get_header(header.get_id(), Out existing_header))
+            continue;
+
+        const auto is_same =
+            existing_header.get_data_offset() == header.get_data_offset() &&
+            existing_header.get_flags().value_ == message->get_flags().value_ &&
+            existing_header.get_prev_msgid() == message->get_prev_msgid() &&
+            existing_header.get_update_patch_version() == message->get_update_patch_version() &&
+            existing_header.has_shared_contact_with_sn() == message->has_shared_contact_with_sn();
+
+        if (is_same && ids.insert(header.get_id()).second)
+            block.push_back(std::move(message));
+    }
+
+    if (block.empty())
+        return;
+
+    if (!data_->update(block))
+        return;
+
+    headers_list headers;
+    index_->update(block, headers);
+}
+
 void contact_archive::drop_history()
 {
     index_->free();
     index_->save_all();
     data_->drop();
+    data_->take_text_spans_updates();
 }
 
 int32_t contact_archive::load_from_local(/*out*/ bool& _first_load)
@@ -459,6 +502,7 @@ void contact_archive::free()
 {
     index_->free();
     gallery_->free();
+    data_->take_text_spans_updates();
 
     local_loaded_ = false;
 }
@@ -532,3 +576,8 @@ std::wstring archive::gallery_state_filename()
     return L"_gs3";
 }
 
+std::wstring archive::gallery_index_filename()
+{
+    return L"_gi3";
+}
+
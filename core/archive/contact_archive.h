@@ -83,6 +83,9 @@ namespace core
 
             void update_message_data(const history_message& _message);
 
+            // writes the text spans computed for the messages of the older archives
+            void store_text_spans();
+
             void drop_history();
 
             int32_t load_from_local(/*out*/ bool& _first_load);
@@ -120,5 +123,6 @@ namespace core
         std::wstring mentions_filename();
         std::wstring gallery_cache_filename();
         std::wstring gallery_state_filename();
+        std::wstring gallery_index_filename();
     }
 }
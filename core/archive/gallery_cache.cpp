@@ -43,6 +43,9 @@ namespace
     const int32_t max_block_size = 1000;
     const int32_t max_items_size = 20000;
 
+    const uint32_t index_version = 1;
+    const size_t max_loaded_pages = 4;
+
     const auto consistency_valid_value = 0.95;
     const auto consistency_check_period = std::chrono::hours(24);
 }
@@ -136,44 +139,47 @@ void gallery_item::serialize(core::icollection* _collection) const
 
 bool gallery_item::unserialize(core::tools::binary_stream& _data)
 {
-    core::tools::tlvpack pack;
+    return unserialize(core::tools::tlvpack_view(_data));
+}
 
-    if (!pack.unserialize(_data))
+bool gallery_item::unserialize(const core::tools::tlvpack_view& _pack)
+{
+    if (!_pack.is_valid())
         return false;
 
-    for (auto tlv_field = pack.get_first(); tlv_field; tlv_field = pack.get_next())
+    for (const auto& tlv_field : _pack)
     {
-        switch (static_cast<tlv_fields_cache>(tlv_field->get_type()))
+        switch (static_cast<tlv_fields_cache>(tlv_field.get_type()))
         {
         case tlv_fields_cache::tlv_msg_id:
-            id_.msg_id_ = tlv_field->get_value<int64_t>();
+            id_.msg_id_ = tlv_field.get_value<int64_t>();
             break;
         case tlv_fields_cache::tlv_seq:
-            id_.seq_ = tlv_field->get_value<int64_t>();
+            id_.seq_ = tlv_field.get_value<int64_t>();
             break;
         case tlv_fields_cache::tlv_next_msg_id:
-            next_.msg_id_ = tlv_field->get_value<int64_t>();
+            next_.msg_id_ = tlv_field.get_value<int64_t>();
             break;
         case tlv_fields_cache::tlv_next_seq:
-            next_.seq_ = tlv_field->get_value<int64_t>();
+            next_.seq_ = tlv_field.get_value<int64_t>();
             break;
         case tlv_fields_cache::tlv_url:
-            url_ = tlv_field->get_value<std::string>();
+            url_ = tlv_field.get_value<std::string>();
             break;
         case tlv_fields_cache::tlv_type:
-            type_ = tlv_field->get_value<std::string>();
+            type_ = tlv_field.get_value<std::string>();
             break;
         case tlv_fields_cache::tlv_sender:
-            sender_ = tlv_field->get_value<std::string>();
+            sender_ = tlv_field.get_value<std::string>();
             break;
         case tlv_fields_cache::tlv_outgoing:
-            outgoing_ = tlv_field->get_value<bool>();
+            outgoing_ = tlv_field.get_value<bool>();
             break;
         case tlv_fields_cache::tlv_time:
-            time_ = tlv_field->get_value<int32_t>();
+            time_ = tlv_field.get_value<int32_t>();
             break;
         case tlv_fields_cache::tlv_caption:
-            caption_ = tlv_field->get_value<std::string>();
+            caption_ = tlv_field.get_value<std::string>();
             break;
 
         default:
@@ -220,12 +226,14 @@ bool gallery_state::operator!=(const gallery_state& _other) const
     return !(*this == _other);
 }
 
-gallery_storage::gallery_storage(const std::wstring& _cache_file_name, const std::wstring& _state_file_name)
-    : first_entry_reached_(false)
+gallery_storage::gallery_storage(const std::wstring& _cache_file_name, const std::wstring& _state_file_name, const std::wstring& _index_file_name)
+    : items_loaded_(true)
+    , first_entry_reached_(false)
     , loaded_from_local_(false)
     , delUpTo_(-1)
     , cache_storage_(std::make_unique<storage>(_cache_file_name))
     , state_storage_(std::make_unique<storage>(_state_file_name))
+    , index_storage_(std::make_unique<storage>(_index_file_name))
     , hole_requested_(false)
     , first_load_(false)
 {
@@ -234,6 +242,7 @@ gallery_storage::gallery_storage(const std::wstring& _cache_file_name, const std
 
 gallery_storage::gallery_storage(const std::string& _aimid)
     : aimid_(_aimid)
+    , items_loaded_(true)
     , first_entry_reached_(false)
     , loaded_from_local_(false)
     , delUpTo_(-1)
@@ -253,6 +262,7 @@ gallery_storage::gallery_storage(const gallery_storage& _other)
     : aimid_(_other.aimid_)
     , state_(_other.state_)
     , items_(_other.items_)
+    , items_loaded_(true)
     , patches_(_other.patches_)
     , older_entry_id_(_other.older_entry_id_)
     , first_entry_reached_(_other.first_entry_reached_)
@@ -262,7 +272,8 @@ gallery_storage::gallery_storage(const gallery_storage& _other)
     , first_load_(_other.first_load_)
     , last_consistency_check_time_(_other.last_consistency_check_time_)
 {
-
+    assert(_other.items_loaded_);
+    rebuild_index();
 }
 
 gallery_storage::~gallery_storage()
@@ -276,7 +287,20 @@ void gallery_storage::load_from_local()
         return;
 
     load_state_from_local();
-    load_cache_from_local();
+
+    if (load_index_from_local())
+    {
+        items_.clear();
+        items_loaded_ = false;
+    }
+    else
+    {
+        // no index yet or the cache was being saved, read the whole cache and write the index
+        items_.clear();
+        items_loaded_ = true;
+        load_cache_from_local();
+        save_cache();
+    }
 
     first_load_ = true;
     loaded_from_local_ = true;
@@ -287,6 +311,12 @@ void gallery_storage::free()
     aimid_ = std::string();
     state_ = gallery_state();
     items_.clear();
+    items_loaded_ = true;
+    index_.clear();
+    types_.clear();
+    type_positions_.clear();
+    page_offsets_.clear();
+    loaded_pages_.clear();
     patches_.clear();
     older_entry_id_ = gallery_entry_id();
     first_entry_reached_ = false;
@@ -321,6 +351,8 @@ gallery_state gallery_storage::get_gallery_state() const
 
 void gallery_storage::merge_from_server(const gallery_storage& _other, const gallery_entry_id& _from, const gallery_entry_id& _till, std::vector<gallery_item>& _changes)
 {
+    load_all_items();
+
     if (_other.delUpTo_ != -1)
     {
         auto iter = items_.begin();
@@ -340,9 +372,16 @@ void gallery_storage::merge_from_server(const gallery_storage& _other, const gal
         save_state();
     }
 
-    auto contains = [this](const auto& _item_id)
+    // items_ are sorted by id
+    auto lower_bound = [this](const auto& _item_id)
     {
-        return std::any_of(items_.begin(), items_.end(), [_item_id](const auto& iter) { return iter.id_ == _item_id; });
+        return std::lower_bound(items_.begin(), items_.end(), _item_id, [](const auto& _item, const auto& _id) { return _item.id_ < _id; });
+    };
+
+    auto contains = [this, &lower_bound](const auto& _item_id)
+    {
+        const auto iter = lower_bound(_item_id);
+        return iter != items_.end() && iter->id_ == _item_id;
     };
 
     auto hole = false;
@@ -361,7 +400,8 @@ void gallery_storage::merge_from_server(const gallery_storage& _other, const gal
     auto max_count_reached = false;
     for (const auto& i : _other.items_)
     {
-        if (std::find(items_.begin(), items_.end(), i) != items_.end())
+        auto iter = lower_bound(i.id_);
+        if (iter != items_.end() && *iter == i)
             continue;
 
         auto ch = i;
@@ -374,30 +414,17 @@ void gallery_storage::merge_from_server(const gallery_storage& _other, const gal
             continue;
         }
 
-        auto first = items_.front();
-        if (i < first)
+        if (iter == items_.begin())
         {
+            const auto first_id = items_.front().id_;
             items_.push_front(i);
-            items_.front().next_ = first.id_;
+            items_.front().next_ = first_id;
             continue;
         }
 
-        auto prev = items_.end();
-        auto iter = items_.begin();
-        for (;iter != items_.end(); ++iter)
-        {
-            if (*(iter) < i)
-            {
-                prev = iter;
-                continue;
-            }
-
-            break;
-        }
-
         auto next = iter == items_.end() ? gallery_entry_id() : iter->id_;
-        if (prev != items_.end() && !hole)
-            prev->next_ = i.id_;
+        if (!hole)
+            std::prev(iter)->next_ = i.id_;
 
         auto inserted = items_.insert(iter, i);
         inserted->next_ = next;
@@ -736,115 +763,118 @@ gallery_items_block gallery_storage::get_items() const
 std::vector<gallery_item> gallery_storage::get_items(const gallery_entry_id& _from, const std::vector<std::string>& _types, int _page_size, bool& _exhausted)
 {
     std::vector<archive::gallery_item> result;
-    if (items_.empty())
+    if (index_.empty())
     {
         _exhausted = true;
         return result;
     }
 
-    auto count = -1;
-    if (_from.empty())
+    // older items for a positive page size, newer for a negative one
+    const auto older = _from.empty() || _page_size > 0;
+    auto from_pos = index_.size();
+    if (!_from.empty())
     {
-        auto iter = items_.crbegin();
-        for (; iter != items_.crend(); ++iter)
+        const auto it = std::lower_bound(index_.begin(), index_.end(), _from, [](const auto& _entry, const auto& _id) { return _entry.id_ < _id; });
+        if (it == index_.end() || it->id_ != _from)
         {
-            if (count == _page_size)
-            {
-                break;
-            }
-
-            if (_from.empty() || iter->id_ < _from)
-            {
-                if (std::find(_types.begin(), _types.end(), iter->type_) != _types.end())
-                {
-                    result.push_back(*iter);
-                    ++count;
-                }
-            }
+            _exhausted = true;
+            return result;
         }
 
-        if (iter == items_.crend())
-            _exhausted = !state_.first_entry_.empty();
+        from_pos = it - index_.begin();
     }
-    else
+
+    // one item more than requested tells whether the page is the last one
+    const auto count = static_cast<size_t>(std::abs(_page_size)) + 1;
+
+    std::vector<uint32_t> positions;
+    std::vector<int32_t> types;
+    for (const auto& type : _types)
     {
-        auto iter = std::find_if(items_.begin(), items_.end(), [_from](const auto& i) { return i.id_ == _from; });
-        if (iter == items_.end())
-        {
-            _exhausted = true;
-            return result;
-        }
+        const auto type_index = get_type_index(type);
+        if (type_index == -1 || std::find(types.begin(), types.end(), type_index) != types.end())
+            continue;
+
+        types.push_back(type_index);
 
-        if (_page_size > 0 && iter == items_.begin())
+        const auto& type_positions = type_positions_[type_index];
+        if (older)
         {
-            _exhausted = !state_.first_entry_.empty();
-            return result;
+            const auto end = std::lower_bound(type_positions.begin(), type_positions.end(), from_pos);
+            const auto begin = end - std::min(count, static_cast<size_t>(end - type_positions.begin()));
+            positions.insert(positions.end(), begin, end);
         }
-
-        if (_page_size > 0)
-            --iter;
         else
-            ++iter;
-
-        while (iter != items_.end())
         {
-            if (count == abs(_page_size))
-                break;
-
-            if (std::find(_types.begin(), _types.end(), iter->type_) != _types.end())
-            {
-                result.push_back(*iter);
-                ++count;
-            }
+            const auto begin = std::upper_bound(type_positions.begin(), type_positions.end(), from_pos);
+            const auto end = begin + std::min(count, static_cast<size_t>(type_positions.end() - begin));
+            positions.insert(positions.end(), begin, end);
+        }
+    }
 
-            if (_page_size > 0)
-            {
-                if (iter == items_.begin())
-                    break;
+    if (older)
+        std::sort(positions.begin(), positions.end(), std::greater<uint32_t>());
+    else
+        std::sort(positions.begin(), positions.end());
 
-                --iter;
-            }
-            else
-            {
-                ++iter;
-            }
-        }
+    if (positions.size() < count)
+        _exhausted = !state_.first_entry_.empty();
+    else
+        positions.resize(count - 1);
 
-        if (iter == items_.end())
-            _exhausted = !state_.first_entry_.empty();
+    bool reloaded = false;
+    auto items = get_items_at(positions, reloaded);
+    if (reloaded)
+    {
+        // the positions are looked up again in the rebuilt index, the items are paged out after that
+        items = get_items(_from, _types, _page_size, _exhausted);
+        save_cache();
     }
 
-    if (count == abs(_page_size))
-        result.pop_back();
-
-    return result;
+    return items;
 }
 
 std::vector<gallery_item> gallery_storage::get_items(int64_t _msg_id, const std::vector<std::string>& _types, int& _index, int& _total)
 {
     std::vector<archive::gallery_item> result;
-    if (items_.empty())
+    if (index_.empty())
         return result;
 
     _index = 0;
     _total = 0;
-    for (auto iter = items_.begin(); iter != items_.end(); ++iter)
+
+    std::vector<uint32_t> positions;
+    std::vector<int32_t> types;
+    for (const auto& type : _types)
     {
-        if (std::find(_types.begin(), _types.end(), iter->type_) == _types.end())
+        const auto type_index = get_type_index(type);
+        if (type_index == -1 || std::find(types.begin(), types.end(), type_index) != types.end())
             continue;
 
-        if (iter->id_.msg_id_ ==_msg_id)
-        {
-            result.push_back(*iter);
-        }
-        else if (iter->id_.msg_id_ < _msg_id)
-        {
-            ++_index;
-        }
-        ++_total;
+        types.push_back(type_index);
+
+        const auto& type_positions = type_positions_[type_index];
+        auto iter = std::partition_point(type_positions.begin(), type_positions.end(), [this, _msg_id](auto _pos) { return index_[_pos].id_.msg_id_ < _msg_id; });
+
+        _index += static_cast<int>(iter - type_positions.begin());
+        _total += static_cast<int>(type_positions.size());
+
+        for (; iter != type_positions.end() && index_[*iter].id_.msg_id_ == _msg_id; ++iter)
+            positions.push_back(*iter);
     }
 
-    return result;
+    std::sort(positions.begin(), positions.end());
+
+    bool reloaded = false;
+    auto items = get_items_at(positions, reloaded);
+    if (reloaded)
+    {
+        // the positions are looked up again in the rebuilt index, the items are paged out after that
+        items = get_items(_msg_id, _types, _index, _total);
+        save_cache();
+    }
+
+    return items;
 }
 
 bool gallery_storage::get_next_hole(gallery_entry_id& _from, gallery_entry_id& _till)
@@ -864,7 +894,7 @@ bool gallery_storage::get_next_hole(gallery_entry_id& _from, gallery_entry_id& _
         return true;
     }
 
-    if (items_.empty())
+    if (index_.empty())
     {
         if (!state_.first_entry_.valid())
         {
@@ -881,14 +911,14 @@ bool gallery_storage::get_next_hole(gallery_entry_id& _from, gallery_entry_id& _
         return false;
     }
 
-    if (state_.first_entry_.empty() || state_.first_entry_ != items_.front().id_)
+    if (state_.first_entry_.empty() || state_.first_entry_ != index_.front().id_)
     {
-        _from = items_.front().id_;
+        _from = index_.front().id_;
         hole_requested_ = true;
         return true;
     }
 
-    auto lastId = items_.back().id_;
+    auto lastId = index_.back().id_;
     if (lastId != state_.last_entry_ && lastId < state_.last_entry_)
     {
         _from = state_.last_entry_;
@@ -897,11 +927,11 @@ bool gallery_storage::get_next_hole(gallery_entry_id& _from, gallery_entry_id& _
         return true;
     }
 
-    auto iter = items_.begin();
+    auto iter = index_.begin();
     auto prevId = iter->id_;
     auto prevNext = iter->next_;
     ++iter;
-    while (iter != items_.end())
+    while (iter != index_.end())
     {
         if (prevNext != iter->id_)
         {
@@ -939,6 +969,8 @@ void gallery_storage::clear_hole_request()
 
 void gallery_storage::make_hole(int64_t _from, int64_t _till)
 {
+    load_all_items();
+
     if (_from == -1)
     {
         items_.clear();
@@ -973,11 +1005,17 @@ void gallery_storage::make_hole(int64_t _from, int64_t _till)
 
 int64_t gallery_storage::get_memory_usage() const
 {
-    int64_t memory_usage = 0;
+    int64_t memory_usage = index_.size() * sizeof(gallery_index_entry);
 
     for (const auto& _item : items_)
         memory_usage += _item.get_memory_usage();
 
+    for (const auto& [_, page] : loaded_pages_)
+    {
+        for (const auto& _item : page)
+            memory_usage += _item.get_memory_usage();
+    }
+
     return memory_usage;
 }
 
@@ -1114,52 +1152,349 @@ bool gallery_storage::load_state_from_local()
 
 bool gallery_storage::save_cache()
 {
+    // an empty index file makes the next load read the whole cache if the cache isn't written completely
+    {
+        archive::storage_mode mode;
+        mode.flags_.write_ = true;
+        mode.flags_.truncate_ = true;
+
+        if (!index_storage_ || !index_storage_->open(mode))
+            return false;
+
+        index_storage_->close();
+    }
+
+    std::vector<int64_t> page_offsets;
+
+    auto saved = [this, &page_offsets]()
+    {
+        archive::storage_mode mode;
+        mode.flags_.write_ = true;
+        mode.flags_.truncate_ = true;
+
+        if (!cache_storage_->open(mode))
+            return false;
+
+        core::tools::auto_scope lb([this] { cache_storage_->close(); });
+
+        auto serialize = [this, &page_offsets](gallery_items_block::const_iterator _begin, gallery_items_block::const_iterator _end)
+        {
+            core::tools::tlvpack block;
+
+            for (auto iter = _begin; iter != _end; ++iter)
+            {
+                core::tools::binary_stream data;
+                iter->serialize(data);
+                block.push_child(core::tools::tlv(tlv_fields_cache::tlv_item_pack, data));
+            }
+
+            core::tools::binary_stream stream;
+            block.serialize(stream);
+
+            int64_t offset = 0;
+            if (!cache_storage_->write_data_block(stream, offset))
+                return false;
+
+            page_offsets.push_back(offset);
+            return true;
+        };
+
+        for (size_t i = 0; i < items_.size(); i += max_block_size)
+        {
+            const auto begin = items_.cbegin() + i;
+            const auto end = items_.cbegin() + std::min(items_.size(), i + max_block_size);
+            if (!serialize(begin, end))
+                return false;
+        }
+
+        return true;
+    }();
+
+    rebuild_index();
+
+    if (!saved || !save_index(page_offsets))
+        return false;
+
+    // the items are paged in from now on, the newest pages are kept as they are requested first
+    page_offsets_ = std::move(page_offsets);
+    loaded_pages_.clear();
+
+    const auto pages_count = page_offsets_.size();
+    for (auto page = pages_count - std::min(pages_count, max_loaded_pages); page < pages_count; ++page)
+    {
+        const auto begin = items_.begin() + page * max_block_size;
+        const auto end = items_.begin() + std::min(items_.size(), (page + 1) * max_block_size);
+        loaded_pages_.emplace_back(page, std::vector<gallery_item>(std::make_move_iterator(begin), std::make_move_iterator(end)));
+    }
+
+    items_.clear();
+    items_loaded_ = false;
+
+    return true;
+}
+
+bool gallery_storage::save_index(const std::vector<int64_t>& _page_offsets)
+{
+    if (!index_storage_)
+        return false;
+
     archive::storage_mode mode;
     mode.flags_.write_ = true;
     mode.flags_.truncate_ = true;
 
-    if (!cache_storage_->open(mode))
+    if (!index_storage_->open(mode))
         return false;
 
-    core::tools::auto_scope lb([this] { cache_storage_->close(); });
+    core::tools::auto_scope lb([this] { index_storage_->close(); });
 
-    auto serialize = [this](const std::vector<gallery_item>& _items)
+    core::tools::binary_stream stream;
+    stream.write<uint32_t>(index_version);
+    stream.write<uint32_t>(max_block_size);
+    stream.write<uint32_t>(static_cast<uint32_t>(_page_offsets.size()));
+    for (auto offset : _page_offsets)
+        stream.write<int64_t>(offset);
+
+    stream.write<uint32_t>(static_cast<uint32_t>(types_.size()));
+    for (const auto& type : types_)
     {
-        core::tools::tlvpack block;
+        stream.write<uint32_t>(static_cast<uint32_t>(type.size()));
+        stream.write(type);
+    }
 
-        for (const auto& i : _items)
-        {
-            core::tools::binary_stream data;
-            i.serialize(data);
-            block.push_child(core::tools::tlv(tlv_fields_cache::tlv_item_pack, data));
-        }
+    stream.write<uint32_t>(static_cast<uint32_t>(index_.size()));
+    for (const auto& entry : index_)
+    {
+        stream.write<int64_t>(entry.id_.msg_id_);
+        stream.write<int64_t>(entry.id_.seq_);
+        stream.write<int64_t>(entry.next_.msg_id_);
+        stream.write<int64_t>(entry.next_.seq_);
+        stream.write<uint8_t>(entry.type_);
+    }
+
+    int64_t offset = 0;
+    return index_storage_->write_data_block(stream, offset);
+}
+
+bool gallery_storage::load_index_from_local()
+{
+    if (!index_storage_)
+        return false;
+
+    archive::storage_mode mode;
+    mode.flags_.read_ = true;
+
+    if (!index_storage_->open(mode))
+        return false;
+
+    core::tools::auto_scope lb([this] { index_storage_->close(); });
 
-        core::tools::binary_stream stream;
-        block.serialize(stream);
+    core::tools::binary_stream stream;
+    if (!index_storage_->read_data_block(-1, stream))
+        return false;
+
+    auto read_size = [&stream](uint32_t& _value)
+    {
+        if (stream.available() < sizeof(_value))
+            return false;
 
-        int64_t offset = 0;
-        return cache_storage_->write_data_block(stream, offset);
+        _value = stream.read<uint32_t>();
+        return true;
     };
 
-    std::vector<gallery_item> items;
+    uint32_t version = 0, page_size = 0, pages_count = 0;
+    if (!read_size(version) || version != index_version || !read_size(page_size) || page_size != max_block_size || !read_size(pages_count))
+        return false;
+
+    std::vector<int64_t> page_offsets(pages_count);
+    for (auto& offset : page_offsets)
+    {
+        if (stream.available() < sizeof(offset))
+            return false;
+
+        offset = stream.read<int64_t>();
+    }
+
+    uint32_t types_count = 0;
+    if (!read_size(types_count) || types_count > std::numeric_limits<uint8_t>::max())
+        return false;
+
+    std::vector<std::string> types(types_count);
+    for (auto& type : types)
+    {
+        uint32_t size = 0;
+        if (!read_size(size) || stream.available() < size)
+            return false;
+
+        if (size)
+            type.assign(stream.read(size), size);
+    }
+
+    constexpr auto entry_size = sizeof(int64_t) * 4 + sizeof(uint8_t);
+
+    uint32_t count = 0;
+    if (!read_size(count) || stream.available() != count * entry_size || pages_count != (count + max_block_size - 1) / max_block_size)
+        return false;
+
+    std::vector<gallery_index_entry> index(count);
+    for (auto& entry : index)
+    {
+        entry.id_.msg_id_ = stream.read<int64_t>();
+        entry.id_.seq_ = stream.read<int64_t>();
+        entry.next_.msg_id_ = stream.read<int64_t>();
+        entry.next_.seq_ = stream.read<int64_t>();
+        entry.type_ = stream.read<uint8_t>();
+
+        if (entry.type_ >= types_count)
+            return false;
+    }
+
+    index_ = std::move(index);
+    types_ = std::move(types);
+    page_offsets_ = std::move(page_offsets);
+    loaded_pages_.clear();
+
+    type_positions_.assign(types_.size(), {});
+    for (size_t i = 0; i < index_.size(); ++i)
+        type_positions_[index_[i].type_].push_back(static_cast<uint32_t>(i));
+
+    return true;
+}
+
+void gallery_storage::load_all_items()
+{
+    if (items_loaded_)
+        return;
+
+    items_.clear();
+    loaded_pages_.clear();
+    items_loaded_ = true;
+
+    if (!load_cache_from_local() || items_.size() != index_.size())
+        rebuild_index();
+}
+
+void gallery_storage::rebuild_index()
+{
+    assert(items_loaded_);
+
+    index_.clear();
+    index_.reserve(items_.size());
+    types_.clear();
+    type_positions_.clear();
+
     for (const auto& item : items_)
     {
-        items.push_back(item);
-        if (items.size() >= max_block_size)
+        auto type_index = get_type_index(item.type_);
+        if (type_index == -1)
         {
-            if (!serialize(items))
-                return false;
+            assert(types_.size() <= std::numeric_limits<uint8_t>::max());
+            type_index = static_cast<int32_t>(types_.size());
+            types_.push_back(item.type_);
+            type_positions_.emplace_back();
+        }
+
+        type_positions_[type_index].push_back(static_cast<uint32_t>(index_.size()));
+        index_.push_back({ item.id_, item.next_, static_cast<uint8_t>(type_index) });
+    }
+}
+
+int32_t gallery_storage::get_type_index(std::string_view _type) const
+{
+    const auto it = std::find(types_.begin(), types_.end(), _type);
+    return it == types_.end() ? -1 : static_cast<int32_t>(it - types_.begin());
+}
+
+std::vector<gallery_item> gallery_storage::get_items_at(const std::vector<uint32_t>& _positions, bool& _reloaded)
+{
+    std::vector<gallery_item> result;
+    result.reserve(_positions.size());
+
+    if (items_loaded_)
+    {
+        for (auto pos : _positions)
+            result.push_back(items_[pos]);
+
+        return result;
+    }
 
-            items.clear();
+    bool opened = false;
+    core::tools::auto_scope lb([this, &opened] { if (opened) cache_storage_->close(); });
+
+    for (auto pos : _positions)
+    {
+        const auto page = get_page(pos / max_block_size, opened);
+        if (!page)
+        {
+            // the cache doesn't match the index, read it all over and let the caller look the positions up again
+            assert(!"gallery page");
+            if (opened)
+            {
+                cache_storage_->close();
+                opened = false;
+            }
+
+            load_all_items();
+            _reloaded = true;
+            return {};
         }
+
+        result.push_back((*page)[pos % max_block_size]);
     }
 
-    if (!items.empty())
+    return result;
+}
+
+const std::vector<gallery_item>* gallery_storage::get_page(size_t _page, bool& _opened)
+{
+    const auto loaded = std::find_if(loaded_pages_.begin(), loaded_pages_.end(), [_page](const auto& _loaded) { return _loaded.first == _page; });
+    if (loaded != loaded_pages_.end())
     {
-        return serialize(items);
+        std::rotate(loaded, std::next(loaded), loaded_pages_.end());
+        return &loaded_pages_.back().second;
     }
 
-    return true;
+    if (_page >= page_offsets_.size())
+        return nullptr;
+
+    if (!_opened)
+    {
+        archive::storage_mode mode;
+        mode.flags_.read_ = true;
+
+        if (!cache_storage_->open(mode))
+            return nullptr;
+
+        _opened = true;
+    }
+
+    core::tools::binary_stream stream;
+    if (!cache_storage_->read_data_block(page_offsets_[_page], stream))
+        return nullptr;
+
+    const core::tools::tlvpack_view block(stream);
+    if (!block.is_valid())
+        return nullptr;
+
+    std::vector<gallery_item> items;
+    items.reserve(max_block_size);
+    for (const auto& tlv_item : block)
+    {
+        gallery_item item;
+        if (!item.unserialize(tlv_item.get_value<core::tools::tlvpack_view>()))
+            return nullptr;
+
+        items.push_back(std::move(item));
+    }
+
+    const auto expected = std::min<size_t>(max_block_size, index_.size() - _page * max_block_size);
+    if (items.size() != expected || items.front().id_ != index_[_page * max_block_size].id_)
+        return nullptr;
+
+    if (loaded_pages_.size() >= max_loaded_pages)
+        loaded_pages_.erase(loaded_pages_.begin());
+
+    loaded_pages_.emplace_back(_page, std::move(items));
+    return &loaded_pages_.back().second;
 }
 
 bool gallery_storage::save_state()
@@ -1202,10 +1537,10 @@ bool gallery_storage::check_consistency()
 
     auto count_from_state = state_.audio_count_ + state_.files_count_ + state_.images_count_ + state_.links_count_ + state_.videos_count_ + state_.ptt_count_;
     auto consistency_value = 0.0;
-    if (items_.size() <= (size_t)count_from_state)
-        consistency_value = (double)items_.size() / count_from_state;
+    if (index_.size() <= (size_t)count_from_state)
+        consistency_value = (double)index_.size() / count_from_state;
     else
-        consistency_value = (double)count_from_state / items_.size();
+        consistency_value = (double)count_from_state / index_.size();
 
     last_consistency_check_time_ = std::chrono::system_clock::now();
 
@@ -1214,7 +1549,7 @@ bool gallery_storage::check_consistency()
         tools::binary_stream bs;
         bs.write<std::string_view>("gallery inconsistency has been detected\r\n");
         std::stringstream s;
-        s << "items in cache: " << items_.size() << "; items in state: " << count_from_state << "\r\n";
+        s << "items in cache: " << index_.size() << "; items in state: " << count_from_state << "\r\n";
         bs.write(s.str());
         if (consistency_value < consistency_value)
             bs.write<std::string_view>("gallery is going to be requested again\r\n");
@@ -1228,6 +1563,8 @@ bool gallery_storage::check_consistency()
 void gallery_storage::clear_gallery()
 {
     items_.clear();
+    items_loaded_ = true;
+    loaded_pages_.clear();
     state_ = gallery_state();
 
     save_cache();
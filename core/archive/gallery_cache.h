@@ -37,6 +37,7 @@ namespace core
             void serialize(core::tools::binary_stream& _data) const;
             void serialize(icollection* _collection) const;
             bool unserialize(core::tools::binary_stream& _data);
+            bool unserialize(const core::tools::tlvpack_view& _pack);
 
             gallery_entry_id id_;
             gallery_entry_id next_;
@@ -75,12 +76,20 @@ namespace core
             std::string type_;
         };
 
+        // an item without the heavy fields, kept in memory for all the items of the gallery
+        struct gallery_index_entry
+        {
+            gallery_entry_id id_;
+            gallery_entry_id next_;
+            uint8_t type_ = 0;
+        };
+
         typedef std::deque<gallery_item> gallery_items_block;
 
         class gallery_storage
         {
         public:
-            gallery_storage(const std::wstring& _cache_file_name, const std::wstring& _state_file_name);
+            gallery_storage(const std::wstring& _cache_file_name, const std::wstring& _state_file_name, const std::wstring& _index_file_name);
             gallery_storage(const std::string& _aimid);
             gallery_storage();
 
@@ -120,9 +129,20 @@ namespace core
 
         private:
             bool load_cache_from_local();
+            bool load_index_from_local();
             bool save_cache();
+            bool save_index(const std::vector<int64_t>& _page_offsets);
             bool save_state();
 
+            // makes items_ hold all the items, called before the gallery is modified
+            void load_all_items();
+            void rebuild_index();
+            int32_t get_type_index(std::string_view _type) const;
+            // _reloaded is set if the cache didn't match the index, the items are in memory then and the positions are stale
+            std::vector<gallery_item> get_items_at(const std::vector<uint32_t>& _positions, bool& _reloaded);
+            // opens cache_storage_ if the page isn't loaded yet, the caller closes it
+            const std::vector<gallery_item>* get_page(size_t _page, bool& _opened);
+
             bool check_consistency();
             void clear_gallery();
 
@@ -130,7 +150,20 @@ namespace core
             std::string aimid_;
             std::string my_aimid_;
             gallery_state state_;
+
+            // all the items while items_loaded_ is set, otherwise the items are paged in from cache_storage_ by index_
             gallery_items_block items_;
+            bool items_loaded_;
+
+            // all the items sorted by id
+            std::vector<gallery_index_entry> index_;
+            std::vector<std::string> types_;
+            // ascending positions in index_ per type from types_
+            std::vector<std::vector<uint32_t>> type_positions_;
+            std::vector<int64_t> page_offsets_;
+            // the most recently used page is at the back
+            std::vector<std::pair<size_t, std::vector<gallery_item>>> loaded_pages_;
+
             std::vector<gallery_patch> patches_;
             gallery_entry_id older_entry_id_;
             bool first_entry_reached_;
@@ -139,6 +172,7 @@ namespace core
 
             std::unique_ptr<storage> cache_storage_;
             std::unique_ptr<storage> state_storage_;
+            std::unique_ptr<storage> index_storage_;
 
             bool hole_requested_;
             bool first_load_;
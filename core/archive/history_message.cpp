@@ -10,6 +10,8 @@
 #include "../tools/file_sharing.h"
 #include "../tools/system.h"
 #include "../tools/json_helper.h"
+#include "../configuration/app_config.h"
+#include "../../libomicron/include/omicron/omicron.h"
 
 #include "history_patch.h"
 
@@ -481,8 +483,135 @@ enum message_fields : uint32_t
     mf_shared_contact_sn = 73,
     mf_file_sharing_base_content_type = 74,
     mf_file_sharing_duration = 75,
+    mf_text_spans = 76,
+    mf_text_spans_key = 77,
+    mf_text_spans_size = 78,
+    mf_text_span = 79,
+    mf_text_span_offset = 80,
+    mf_text_span_length = 81,
+    mf_text_span_type = 82,
+    mf_text_span_protocol = 83,
+    mf_text_span_extension = 84,
+    mf_text_span_url = 85,
 };
 
+namespace
+{
+    // must match Features::getProfileDomain and Features::getProfileDomainAgent in gui
+    std::vector<common::tools::url_parser::compare_item> get_profile_urls()
+    {
+        auto domain_agent = build::is_biz()
+            ? omicronlib::_o("profile_domain_myteam", feature::default_profile_myteam_domain())
+            : omicronlib::_o("profile_domain_agent", core::configuration::get_app_config().get_url_profile_agent());
+
+        return common::tools::make_profile_urls(omicronlib::_o("profile_domain", feature::default_profile_domain()), domain_agent);
+    }
+
+    struct text_spans_settings
+    {
+        std::string files_url_;
+        std::vector<common::tools::url_parser::compare_item> profile_urls_;
+        uint32_t key_ = 0;
+    };
+
+    // messages are unserialized on several threads, the pointer is accessed only with std::atomic_load/std::atomic_store
+    std::shared_ptr<const text_spans_settings> text_spans_settings_cache;
+
+    std::shared_ptr<const text_spans_settings> get_text_spans_settings()
+    {
+        if (auto settings = std::atomic_load(&text_spans_settings_cache))
+            return settings;
+
+        auto settings = std::make_shared<text_spans_settings>();
+        settings->files_url_ = core::configuration::get_app_config().get_url_files_get();
+        settings->profile_urls_ = get_profile_urls();
+        settings->key_ = common::tools::spans_key(settings->files_url_, settings->profile_urls_);
+
+        std::shared_ptr<const text_spans_settings> result = std::move(settings);
+        std::atomic_store(&text_spans_settings_cache, result);
+
+        return result;
+    }
+
+    // the gui shows the text trimmed, so the spans are counted from its first non-space byte
+    std::string_view trim_text(std::string_view _text)
+    {
+        constexpr std::string_view spaces = " \t\n\v\f\r";
+
+        const auto begin = _text.find_first_not_of(spaces);
+        if (begin == _text.npos)
+            return std::string_view();
+
+        return _text.substr(begin, _text.find_last_not_of(spaces) - begin + 1);
+    }
+
+    void serialize_text_spans(const common::tools::message_spans& _spans, core::tools::tlvpack& _pack)
+    {
+        core::tools::tlvpack spans_pack;
+        spans_pack.push_child(core::tools::tlv(mf_text_spans_key, _spans.key_));
+        spans_pack.push_child(core::tools::tlv(mf_text_spans_size, _spans.text_size_));
+
+        for (const auto& span : _spans.spans_)
+        {
+            core::tools::tlvpack span_pack;
+            span_pack.push_child(core::tools::tlv(mf_text_span_offset, span.offset_));
+            span_pack.push_child(core::tools::tlv(mf_text_span_length, span.length_));
+            span_pack.push_child(core::tools::tlv(mf_text_span_type, int32_t(span.type_)));
+            span_pack.push_child(core::tools::tlv(mf_text_span_protocol, int32_t(span.protocol_)));
+            span_pack.push_child(core::tools::tlv(mf_text_span_extension, int32_t(span.extension_)));
+            if (!span.url_.empty())
+                span_pack.push_child(core::tools::tlv(mf_text_span_url, span.url_));
+
+            spans_pack.push_child(core::tools::tlv(mf_text_span, span_pack));
+        }
+
+        _pack.push_child(core::tools::tlv(mf_text_spans, spans_pack));
+    }
+
+    common::tools::message_spans unserialize_text_spans(const core::tools::tlvpack_view& _pack)
+    {
+        common::tools::message_spans spans;
+
+        for (const auto& tlv_field : _pack)
+        {
+            switch ((message_fields) tlv_field.get_type())
+            {
+            case mf_text_spans_key:
+                spans.key_ = tlv_field.get_value<uint32_t>(0);
+                break;
+            case mf_text_spans_size:
+                spans.text_size_ = tlv_field.get_value<uint32_t>(0);
+                break;
+            case mf_text_span:
+                {
+                    const auto span_pack = tlv_field.get_value<core::tools::tlvpack_view>();
+
+                    common::tools::token_span span;
+                    if (const auto item = span_pack.get_item(mf_text_span_offset))
+                        span.offset_ = item->get_value<uint32_t>(0);
+                    if (const auto item = span_pack.get_item(mf_text_span_length))
+                        span.length_ = item->get_value<uint32_t>(0);
+                    if (const auto item = span_pack.get_item(mf_text_span_type))
+                        span.type_ = common::tools::url::type(item->get_value<int32_t>(0));
+                    if (const auto item = span_pack.get_item(mf_text_span_protocol))
+                        span.protocol_ = common::tools::url::protocol(item->get_value<int32_t>(0));
+                    if (const auto item = span_pack.get_item(mf_text_span_extension))
+                        span.extension_ = common::tools::url::extension(item->get_value<int32_t>(0));
+                    if (const auto item = span_pack.get_item(mf_text_span_url))
+                        span.url_ = item->get_value<std::string>(std::string());
+
+                    spans.spans_.push_back(std::move(span));
+                }
+                break;
+            default:
+                break;
+            }
+        }
+
+        return spans;
+    }
+}
+
 void shared_contact_data::serialize(icollection *_collection) const
 {
     coll_helper coll(_collection, false);
@@ -529,7 +658,7 @@ bool shared_contact_data::unserialize(const rapidjson::Value &_node)
     return result;
 }
 
-bool shared_contact_data::unserialize(const core::tools::tlvpack &_pack)
+bool shared_contact_data::unserialize(const core::tools::tlvpack_view& _pack)
 {
     if (const auto phone_item = _pack.get_item(message_fields::mf_shared_contact_phone))
     {
@@ -561,7 +690,7 @@ void core::archive::sticker_data::serialize(core::tools::tlvpack& _pack)
     _pack.push_child(core::tools::tlv(message_fields::mf_sticker_id, id_));
 }
 
-int32_t core::archive::sticker_data::unserialize(core::tools::tlvpack& _pack)
+int32_t core::archive::sticker_data::unserialize(const core::tools::tlvpack_view& _pack)
 {
     assert(id_.empty());
 
@@ -1019,7 +1148,7 @@ file_sharing_data::file_sharing_data(icollection* _collection)
         base_content_type_ = file_sharing_base_content_type(coll.get_value_as_int("base_content_type"));
 }
 
-file_sharing_data::file_sharing_data(const core::tools::tlvpack &_pack)
+file_sharing_data::file_sharing_data(const core::tools::tlvpack_view& _pack)
 {
     if (const auto uri_item = _pack.get_item(message_fields::mf_file_sharing_uri); uri_item)
     {
@@ -1960,6 +2089,7 @@ void history_message::copy(const history_message& _message)
     snippets_ = _message.snippets_;
     url_ = _message.url_;
     description_ = _message.description_;
+    text_spans_ = _message.text_spans_;
 
     sticker_.reset();
     mult_.reset();
@@ -2015,6 +2145,7 @@ void history_message::merge(const history_message& _message)
     update_patch_version_ = _message.update_patch_version_;
     url_ = _message.url_;
     description_ = _message.description_;
+    text_spans_ = _message.text_spans_;
 
     sticker_.reset();
     mult_.reset();
@@ -2214,6 +2345,35 @@ void history_message::serialize(icollection* _collection, const time_t _offset,
         coll.set_value_as_array("snippets", snip_array.get());
     }
 
+    if (_serialize_message && text_spans_.is_valid())
+    {
+        coll_helper coll_spans(coll->create_collection(), true);
+        coll_spans.set_value_as_uint("key", text_spans_.key_);
+        coll_spans.set_value_as_uint("size", text_spans_.text_size_);
+
+        ifptr<iarray> spans_array(coll->create_array());
+        spans_array->reserve(text_spans_.spans_.size());
+
+        for (const auto& span : text_spans_.spans_)
+        {
+            coll_helper coll_span(coll->create_collection(), true);
+            coll_span.set_value_as_uint("offset", span.offset_);
+            coll_span.set_value_as_uint("length", span.length_);
+            coll_span.set_value_as_int("type", int32_t(span.type_));
+            coll_span.set_value_as_int("protocol", int32_t(span.protocol_));
+            coll_span.set_value_as_int("extension", int32_t(span.extension_));
+            if (!span.url_.empty())
+                coll_span.set_value_as_string("url", span.url_);
+
+            ifptr<ivalue> span_value(coll->create_value());
+            span_value->set_as_collection(coll_span.get());
+            spans_array->push_back(span_value.get());
+        }
+
+        coll_spans.set_value_as_array("spans", spans_array.get());
+        coll.set_value_as_collection("text_spans", coll_spans.get());
+    }
+
     if (shared_contact_)
         shared_contact_->serialize(coll.get());
 }
@@ -2302,75 +2462,77 @@ void history_message::serialize(core::tools::binary_stream& _data) const
     if (shared_contact_)
         shared_contact_->serialize(msg_pack);
 
+    if (text_spans_.is_valid())
+        serialize_text_spans(text_spans_, msg_pack);
+
     msg_pack.serialize(_data);
 }
 
 int32_t history_message::unserialize(core::tools::binary_stream& _data)
 {
-    core::tools::tlvpack msg_pack;
-
-    if (!msg_pack.unserialize(_data))
+    const core::tools::tlvpack_view msg_pack(_data);
+    if (!msg_pack.is_valid())
         return -1;
 
-    for (auto tlv_field = msg_pack.get_first(); tlv_field; tlv_field = msg_pack.get_next())
+    for (const auto& tlv_field : msg_pack)
     {
-        switch ((message_fields) tlv_field->get_type())
+        switch ((message_fields) tlv_field.get_type())
         {
         case message_fields::mf_msg_id:
-            msgid_ = tlv_field->get_value<int64_t>(msgid_);
+            msgid_ = tlv_field.get_value<int64_t>(msgid_);
             break;
         case message_fields::mf_prev_msg_id:
-            prev_msg_id_ = tlv_field->get_value<int64_t>(prev_msg_id_);
+            prev_msg_id_ = tlv_field.get_value<int64_t>(prev_msg_id_);
             break;
         case message_fields::mf_flags:
-            flags_.value_ = tlv_field->get_value<uint32_t>(0);
+            flags_.value_ = tlv_field.get_value<uint32_t>(0);
             break;
         case message_fields::mf_time:
-            time_ = tlv_field->get_value<uint64_t>(0);
+            time_ = tlv_field.get_value<uint64_t>(0);
             break;
         case message_fields::mf_wimid:
-            wimid_ = tlv_field->get_value<std::string>(std::string());
+            wimid_ = tlv_field.get_value<std::string>(std::string());
             break;
         case message_fields::mf_internal_id:
-            internal_id_ = tlv_field->get_value<std::string>(std::string());
+            internal_id_ = tlv_field.get_value<std::string>(std::string());
             break;
         case message_fields::mf_sender_friendly:
-            sender_friendly_ = tlv_field->get_value<std::string>(std::string());
+            sender_friendly_ = tlv_field.get_value<std::string>(std::string());
             break;
         case message_fields::mf_text:
-            text_ = tlv_field->get_value<std::string>(std::string());
+            text_ = tlv_field.get_value<std::string>(std::string());
             break;
         case message_fields::mf_update_patch_version:
-            update_patch_version_.set_version(tlv_field->get_value<std::string>(std::string()));
+            update_patch_version_.set_version(tlv_field.get_value<std::string>(std::string()));
             break;
         case message_fields::mf_offline_version:
-            update_patch_version_.set_offline_version(tlv_field->get_value<int32_t>());
+            update_patch_version_.set_offline_version(tlv_field.get_value<int32_t>());
             break;
         case message_fields::mf_chat:
             {
                 chat_ = std::make_unique<core::archive::chat_data>();
-                core::tools::tlvpack pack = tlv_field->get_value<core::tools::tlvpack>();
+                core::tools::tlvpack pack = tlv_field.get_value<core::tools::tlvpack>();
                 chat_->unserialize(pack);
             }
             break;
         case message_fields::mf_sticker:
             {
                 sticker_ = std::make_unique<core::archive::sticker_data>();
-                core::tools::tlvpack pack = tlv_field->get_value<core::tools::tlvpack>();
+                const auto pack = tlv_field.get_value<core::tools::tlvpack_view>();
                 sticker_->unserialize(pack);
             }
             break;
         case message_fields::mf_mult:
             {
                 mult_ = std::make_unique<core::archive::mult_data>();
-                core::tools::tlvpack pack = tlv_field->get_value<core::tools::tlvpack>();
+                core::tools::tlvpack pack = tlv_field.get_value<core::tools::tlvpack>();
                 mult_->unserialize(pack);
             }
             break;
         case message_fields::mf_voip:
             {
                 voip_ = std::make_unique<core::archive::voip_data>();
-                const auto pack = tlv_field->get_value<core::tools::tlvpack>();
+                const auto pack = tlv_field.get_value<core::tools::tlvpack>();
                 if (!voip_->unserialize(pack))
                 {
                     assert(!"voip unserialization failed");
@@ -2380,27 +2542,27 @@ int32_t history_message::unserialize(core::tools::binary_stream& _data)
             break;
         case message_fields::mf_file_sharing:
             {
-                const auto pack = tlv_field->get_value<core::tools::tlvpack>();
+                const auto pack = tlv_field.get_value<core::tools::tlvpack_view>();
                 file_sharing_ = std::make_unique<core::archive::file_sharing_data>(pack);
             }
             break;
         case message_fields::mf_chat_event:
             {
-                const auto pack = tlv_field->get_value<core::tools::tlvpack>();
+                const auto pack = tlv_field.get_value<core::tools::tlvpack>();
                 chat_event_ = chat_event_data::make_from_tlv(pack);
             }
             break;
         case message_fields::mf_quote:
             {
                 quote q;
-                const auto pack = tlv_field->get_value<core::tools::tlvpack>();
+                const auto pack = tlv_field.get_value<core::tools::tlvpack_view>();
                 q.unserialize(pack);
                 quotes_.push_back(std::move(q));
             }
             break;
         case message_fields::mf_mention:
             {
-                const auto pack = tlv_field->get_value<core::tools::tlvpack>();
+                const auto pack = tlv_field.get_value<core::tools::tlvpack_view>();
                 const auto sn = pack.get_item(mf_mention_sn);
                 const auto fr = pack.get_item(mf_mention_friendly);
                 if (sn && fr)
@@ -2415,34 +2577,45 @@ int32_t history_message::unserialize(core::tools::binary_stream& _data)
         case message_fields::mf_snippet:
             {
                 url_snippet s;
-                const auto pack = tlv_field->get_value<core::tools::tlvpack>();
+                const auto pack = tlv_field.get_value<core::tools::tlvpack_view>();
                 s.unserialize(pack);
                 snippets_.push_back(std::move(s));
             }
             break;
 
         case message_fields::mf_description:
-            description_ = tlv_field->get_value<std::string>(std::string());
+            description_ = tlv_field.get_value<std::string>(std::string());
             break;
 
         case message_fields::mf_url:
-            url_ = tlv_field->get_value<std::string>(std::string());
+            url_ = tlv_field.get_value<std::string>(std::string());
             break;
 
         case message_fields::mf_shared_contact:
             {
-                const auto pack = tlv_field->get_value<core::tools::tlvpack>();
+                const auto pack = tlv_field.get_value<core::tools::tlvpack_view>();
                 shared_contact_data contact;
                 if (contact.unserialize(pack))
                     shared_contact_ = std::move(contact);
             }
             break;
 
+        case message_fields::mf_text_spans:
+            text_spans_ = unserialize_text_spans(tlv_field.get_value<core::tools::tlvpack_view>());
+            break;
+
         default:
             break;
         }
     }
 
+    // archives written before the spans were stored
+    if (!text_spans_.is_valid())
+    {
+        update_text_spans();
+        text_spans_to_store_ = text_spans_.is_valid();
+    }
+
     return 0;
 }
 
@@ -2674,6 +2847,8 @@ int32_t history_message::unserialize(const rapidjson::Value& _node, const std::s
     if (shared_contact_) // if message contains shared contact, we do not process its text
         text_.clear();
 
+    update_text_spans();
+
     return 0;
 }
 
@@ -2990,9 +3165,31 @@ const std::string& history_message::get_text() const noexcept
     return text_;
 }
 
-void history_message::set_text(std::string _text) noexcept
+void history_message::set_text(std::string _text)
 {
     text_ = std::move(_text);
+    update_text_spans();
+}
+
+void history_message::update_text_spans()
+{
+    const auto text = trim_text(text_);
+    if (text.empty() || sticker_)
+    {
+        text_spans_ = common::tools::message_spans();
+        return;
+    }
+
+    const auto settings = get_text_spans_settings();
+    if (text_spans_.is_valid_for(text, settings->key_))
+        return;
+
+    text_spans_ = common::tools::make_spans(std::string(text), settings->files_url_, settings->profile_urls_);
+}
+
+void core::archive::reset_text_spans_settings()
+{
+    std::atomic_store(&text_spans_settings_cache, std::shared_ptr<const text_spans_settings>());
 }
 
 bool history_message::has_text() const noexcept
@@ -3179,7 +3376,7 @@ void quote::unserialize(const rapidjson::Value& _node, bool _is_forward)
         text_.clear();
 }
 
-void quote::unserialize(const core::tools::tlvpack &_pack)
+void quote::unserialize(const core::tools::tlvpack_view& _pack)
 {
     auto get_value = [&_pack](auto _field, auto _def_value, Out auto _out_ptr)
     {
@@ -3204,7 +3401,7 @@ void quote::unserialize(const core::tools::tlvpack &_pack)
     auto contact_item = _pack.get_item(message_fields::mf_shared_contact);
     if (contact_item)
     {
-        const auto pack = contact_item->get_value<core::tools::tlvpack>();
+        const auto pack = contact_item->get_value<core::tools::tlvpack_view>();
         shared_contact_data contact;
         if (contact.unserialize(pack))
             shared_contact_ = std::move(contact);
@@ -3279,7 +3476,7 @@ void url_snippet::unserialize(const rapidjson::Value& _node)
         preview_height_ = std::stoi(tmp);
 }
 
-void url_snippet::unserialize(const core::tools::tlvpack& _pack)
+void url_snippet::unserialize(const core::tools::tlvpack_view& _pack)
 {
     auto get_value = [&_pack](auto _field, auto _def_value, Out auto _out_ptr)
     {
@@ -4,6 +4,7 @@
 
 #include "../../corelib/iserializable.h"
 #include "../../common.shared/patch_version.h"
+#include "../../common.shared/message_processing/message_tokenizer.h"
 
 #include "../connections/wim/persons.h"
 
@@ -43,7 +44,7 @@ namespace core
             void serialize(core::tools::tlvpack& _pack) const;
             bool unserialize(icollection* _coll);
             bool unserialize(const rapidjson::Value& _node);
-            bool unserialize(const core::tools::tlvpack& _pack);
+            bool unserialize(const core::tools::tlvpack_view& _pack);
         };
         using shared_contact = std::optional<shared_contact_data>;
 
@@ -168,7 +169,7 @@ namespace core
             void serialize(icollection* _collection);
             void serialize(core::tools::tlvpack& _pack);
             int32_t unserialize(const rapidjson::Value& _node);
-            int32_t unserialize(core::tools::tlvpack& _pack);
+            int32_t unserialize(const core::tools::tlvpack_view& _pack);
         };
 
         class mult_data
@@ -248,7 +249,7 @@ namespace core
 
             file_sharing_data(icollection* _collection);
 
-            file_sharing_data(const core::tools::tlvpack &_pack);
+            file_sharing_data(const core::tools::tlvpack_view& _pack);
 
             file_sharing_data();
             ~file_sharing_data();
@@ -393,9 +394,15 @@ namespace core
             std::string description_;
             std::string url_;
             shared_contact shared_contact_;
+            common::tools::message_spans text_spans_;
+
+            // the spans are computed on load, the archive stores them with the next update
+            bool text_spans_to_store_ = false;
 
             void copy(const history_message& _message);
 
+            void update_text_spans();
+
             void init_default();
 
             void reset_extended_data();
@@ -459,9 +466,13 @@ namespace core
             void increment_offline_version();
 
             const std::string& get_text() const noexcept;
-            void set_text(std::string _text) noexcept;
+            void set_text(std::string _text);
             bool has_text() const noexcept;
 
+            // url tokens of the trimmed text, so the gui doesn't have to parse it again
+            const common::tools::message_spans& get_text_spans() const noexcept { return text_spans_; }
+            bool need_store_text_spans() const noexcept { return text_spans_to_store_; }
+
             void set_wimid(const std::string& _wimid) { wimid_ = _wimid; }
             const std::string& get_wimid() const noexcept { return wimid_; }
 
@@ -561,7 +572,7 @@ namespace core
             void serialize(core::tools::tlvpack& _pack) const;
             void unserialize(icollection* _coll);
             void unserialize(const rapidjson::Value& _node, bool _is_forward);
-            void unserialize(const core::tools::tlvpack &_pack);
+            void unserialize(const core::tools::tlvpack_view& _pack);
 
             const std::string& get_text() const { return text_; }
             const std::string& get_sender() const { return sender_; }
@@ -589,7 +600,7 @@ namespace core
             void serialize(icollection* _collection) const;
             void serialize(core::tools::tlvpack& _pack) const;
             void unserialize(const rapidjson::Value& _node);
-            void unserialize(const core::tools::tlvpack& _pack);
+            void unserialize(const core::tools::tlvpack_view& _pack);
 
             const std::string& get_url() const { return url_; }
 
@@ -604,5 +615,8 @@ namespace core
             std::string title_;
             std::string description_;
         };
+
+        // the url parser settings are read once for all the messages, this makes them read again
+        void reset_text_spans_settings();
     }
 }
@@ -625,139 +625,74 @@ std::shared_ptr<update_history_handler> face::update_history(const std::string&
 
     __LOG(core::log::info("archive", boost::format("update_history, contact=%1%") % _contact);)
 
-    auto handler = std::make_shared<update_history_handler>();
+    return thread_->run_async_result<std::shared_ptr<headers_list>, dlg_state, dlg_state_changes, storage::result_type>(
+        [history_cache = history_cache_, _data, _contact, _from, _has_older_msgid](update_history_handler& _result)
+        {
+            auto ids = std::make_shared<headers_list>();
+            dlg_state state;
+            dlg_state_changes state_changes;
+            core::archive::storage::result_type result;
 
-    auto ids = std::make_shared<headers_list>();
-    auto state = std::make_shared<dlg_state>();
-    auto state_changes = std::make_shared<dlg_state_changes>();
-    auto result = std::make_shared<core::archive::storage::result_type>();
+            history_cache->update_history(_contact, _data, Out *ids, Out state, Out state_changes, Out result, _from, _has_older_msgid);
 
-    thread_->run_async_function(
-        [history_cache = history_cache_, _data, _contact, ids, state, state_changes, _from, _has_older_msgid, result]
-        {
-            history_cache->update_history(_contact, _data, Out *ids, Out *state, Out *state_changes, Out *result, _from, _has_older_msgid);
-            return 0;
+            _result.set(std::move(ids), std::move(state), std::move(state_changes), result);
         }
-    )->on_result_ =
-        [handler, ids, state, state_changes, result](int32_t _error)
-        {
-            if (handler->on_result)
-            {
-                handler->on_result(
-                    ids,
-                    *state,
-                    *state_changes,
-                    *result
-                );
-            }
-        };
-
-    return handler;
+    );
 }
 
-std::shared_ptr<async_task_handlers> face::update_message_data(const std::string& _contact, const history_message& _message)
+std::shared_ptr<task_handler> face::update_message_data(const std::string& _contact, const history_message& _message)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    auto wr_this = weak_from_this();
-
-    thread_->run_async_function([history_cache = history_cache_, _contact, _message]() -> int32_t
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _contact, _message](task_handler& _result)
     {
         history_cache->update_message_data(_contact, _message);
 
-        return 0;
-
-    })->on_result_ = [wr_this, handler](int32_t _error)
-    {
-        auto ptr_this = wr_this.lock();
-        if (!ptr_this)
-            return;
-
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::drop_history(const std::string& _contact)
+std::shared_ptr<task_handler> face::drop_history(const std::string& _contact)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    auto wr_this = weak_from_this();
-
-    thread_->run_async_function([history_cache = history_cache_, _contact]() -> int32_t
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _contact](task_handler& _result)
     {
         history_cache->drop_history(_contact);
 
-        return 0;
-
-    })->on_result_ = [wr_this, handler](int32_t _error)
-    {
-        auto ptr_this = wr_this.lock();
-        if (!ptr_this)
-            return;
-
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
 std::shared_ptr<request_buddies_handler> face::get_messages_buddies(const std::string& _contact, std::shared_ptr<archive::msgids_list> _ids)
 {
-    auto handler = std::make_shared<request_buddies_handler>();
-    auto out_messages = std::make_shared<history_block>();
-    auto first_load = std::make_shared<bool>(false);
-    auto errors = std::make_shared<error_vector>();
-
-    thread_->run_async_function([history_cache = history_cache_, _contact, _ids, out_messages, first_load, errors]()->int32_t
+    return thread_->run_async_result<history_block_sptr, first_load, std::shared_ptr<error_vector>>(
+        [history_cache = history_cache_, _contact, _ids](request_buddies_handler& _result)
     {
-        history_cache->get_messages_buddies(_contact, _ids, out_messages, *first_load, errors);
-        return 0;
+        auto out_messages = std::make_shared<history_block>();
+        auto errors = std::make_shared<error_vector>();
+        bool first_load = false;
 
-    })->on_result_ = [handler, out_messages, first_load, errors](int32_t _error)
-    {
-        if (handler->on_result)
-            handler->on_result(out_messages, *first_load ? archive::first_load::yes : archive::first_load::no, errors);
-    };
+        history_cache->get_messages_buddies(_contact, _ids, out_messages, first_load, errors);
 
-    return handler;
+        _result.set(std::move(out_messages), first_load ? archive::first_load::yes : archive::first_load::no, std::move(errors));
+    });
 }
 
 std::shared_ptr<request_buddies_handler> face::get_messages(const std::string& _contact, int64_t _from, int64_t _count_early, int64_t _count_later)
 {
     assert(!_contact.empty());
 
-    auto history_cache = history_cache_;
-    auto handler = std::make_shared<request_buddies_handler>();
-    auto out_messages = std::make_shared<history_block>();
-    auto first_load = std::make_shared<bool>(false);
-    auto errors = std::make_shared<error_vector>();
-    auto wr_this = weak_from_this();
-
-    thread_->run_async_function([_contact, out_messages, _from, _count_early, _count_later, history_cache, first_load, errors]()->int32_t
-    {
-        return (history_cache->get_messages(_contact, _from, _count_early, _count_later, out_messages, *first_load, errors) ? 0 : -1);
-
-    })->on_result_ = [wr_this, handler, out_messages, _contact, history_cache, first_load, errors](int32_t _error)
+    return thread_->run_async_result<history_block_sptr, first_load, std::shared_ptr<error_vector>>(
+        [history_cache = history_cache_, _contact, _from, _count_early, _count_later](request_buddies_handler& _result)
     {
-        auto ptr_this = wr_this.lock();
-        if (!ptr_this)
-            return;
+        auto out_messages = std::make_shared<history_block>();
+        auto errors = std::make_shared<error_vector>();
+        bool first_load = false;
 
-        ptr_this->thread_->run_async_function([history_cache, _contact]()->int32_t
-        {
-            history_cache->optimize_contact_archive(_contact);
-            return 0;
-        });
+        history_cache->get_messages(_contact, _from, _count_early, _count_later, out_messages, first_load, errors);
 
-        if (handler->on_result)
-            handler->on_result(out_messages, *first_load ? archive::first_load::yes : archive::first_load::no, errors);
-    };
+        _result.set(std::move(out_messages), first_load ? archive::first_load::yes : archive::first_load::no, std::move(errors));
 
-    return handler;
+        // the caller gets the messages before the archive is optimized
+        history_cache->optimize_contact_archive(_contact);
+    });
 }
 
 std::shared_ptr<request_history_file_handler> face::get_history_block(std::shared_ptr<contact_and_offsets_v> _contacts
@@ -765,19 +700,14 @@ std::shared_ptr<request_history_file_handler> face::get_history_block(std::share
 {
     assert(!_contacts->empty());
 
-    auto history_cache = history_cache_;
-    auto handler = std::make_shared<request_history_file_handler>();
-    auto wr_this = weak_from_this();
-
-    auto remaining = std::make_shared<contact_and_offsets_v>();
-
-    thread_->run_async_function([_contacts, _archive, history_cache, remaining, _data]()->int32_t
+    return thread_->run_async_result<std::shared_ptr<contact_and_msgs>, std::shared_ptr<contact_and_offsets_v>, std::shared_ptr<tools::binary_stream>>(
+        [_contacts, _archive, history_cache = history_cache_, _data](request_history_file_handler& _result)
     {
+        auto remaining = std::make_shared<contact_and_offsets_v>();
         auto remain_size = std::make_shared<int64_t>(1024 * 1024 * 10);
         auto index = 0u;
 
         _archive->clear();
-        auto has_result = false;
         int64_t cur_index = 0;
 
         while (*remain_size > 0 && index < _contacts->size())
@@ -787,7 +717,6 @@ std::shared_ptr<request_history_file_handler> face::get_history_block(std::share
 
             auto prev_cur_index = cur_index;
             auto cur_result = history_cache->get_history_file(contact, *_data, offset, remain_size, cur_index, regim);
-            has_result |= cur_result;
 
             if (!cur_result)
             {
@@ -810,239 +739,104 @@ std::shared_ptr<request_history_file_handler> face::get_history_block(std::share
         }
         _contacts->resize(last_index);
 
-        return (has_result ? 0 : -1);
-
-    })->on_result_ = [wr_this, handler, _archive, history_cache, remaining, _data](int32_t _error)
-    {
-        // we calc count of finished threads
-        // if (_error == -1)
-        //    return;
-
-        auto ptr_this = wr_this.lock();
-        if (!ptr_this)
-            return;
-
-        if (handler->on_result)
-            handler->on_result(_archive, remaining, _data);
-    };
-
-    return handler;
+        _result.set(_archive, std::move(remaining), _data);
+    });
 }
 
 std::shared_ptr<request_dlg_state_handler> face::get_dlg_state(std::string_view _contact)
 {
-    auto handler = std::make_shared<request_dlg_state_handler>();
-    auto dialog = std::make_shared<dlg_state>();
-
-    thread_->run_async_function([history_cache = history_cache_, dialog, _contact = std::string(_contact)]()->int32_t
-    {
-        *dialog = history_cache->get_dlg_state(_contact);
-
-        return 0;
-
-    })->on_result_ = [handler, dialog](int32_t _error)
+    return thread_->run_async_result<dlg_state>([history_cache = history_cache_, _contact = std::string(_contact)](request_dlg_state_handler& _result)
     {
-        if (handler->on_result)
-            handler->on_result(*dialog);
-    };
-
-    return handler;
+        _result.set(history_cache->get_dlg_state(_contact));
+    });
 }
 
 std::shared_ptr<request_dlg_states_handler> face::get_dlg_states(const std::vector<std::string>& _contacts)
 {
-    auto handler = std::make_shared<request_dlg_states_handler>();
-    auto dialogs = std::make_shared<std::vector<dlg_state>>();
-
-    thread_->run_async_function([history_cache = history_cache_, _contacts, dialogs]()->int32_t
+    return thread_->run_async_result<std::vector<dlg_state>>([history_cache = history_cache_, _contacts](request_dlg_states_handler& _result)
     {
-        *dialogs = history_cache->get_dlg_states(_contacts);
-
-        return 0;
-
-    })->on_result_ = [handler, dialogs](int32_t _error)
-    {
-        if (handler->on_result)
-            handler->on_result(*dialogs);
-    };
-
-    return handler;
+        _result.set(history_cache->get_dlg_states(_contacts));
+    });
 }
 
 std::shared_ptr<set_dlg_state_handler> face::set_dlg_state(const std::string& _contact, const dlg_state& _state)
 {
-    auto handler = std::make_shared<set_dlg_state_handler>();
-    auto result_state = std::make_shared<dlg_state>();
-    auto state_changes = std::make_shared<dlg_state_changes>();
     const auto correct_time = std::chrono::system_clock::now();
 
-    thread_->run_async_function(
-        [history_cache = history_cache_, _state, _contact, result_state, state_changes, correct_time]
+    return thread_->run_async_result<dlg_state, dlg_state_changes>(
+        [history_cache = history_cache_, _state, _contact, correct_time](set_dlg_state_handler& _result)
         {
-            history_cache->set_dlg_state(_contact, _state, correct_time, Out *result_state, Out *state_changes);
+            dlg_state result_state;
+            dlg_state_changes state_changes;
 
-            return 0;
-        })
-    ->on_result_ =
-        [handler, result_state, state_changes]
-        (int32_t _error)
-        {
-            if (handler->on_result)
-                handler->on_result(*result_state, *state_changes);
-        };
+            history_cache->set_dlg_state(_contact, _state, correct_time, Out result_state, Out state_changes);
 
-    return handler;
+            _result.set(std::move(result_state), std::move(state_changes));
+        });
 }
 
 
-std::shared_ptr<async_task_handlers> face::clear_dlg_state(const std::string& _contact)
+std::shared_ptr<task_handler> face::clear_dlg_state(const std::string& _contact)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([history_cache = history_cache_, _contact]()->int32_t
-    {
-        return (history_cache->clear_dlg_state(_contact) ? 0 : -1);
-
-    })->on_result_ = [handler](int32_t _error)
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _contact](task_handler& _result)
     {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(history_cache->clear_dlg_state(_contact) ? 0 : -1);
+    });
 }
 
 std::shared_ptr<request_msg_ids_handler> face::get_messages_for_update(const std::string& _contact)
 {
-    auto handler = std::make_shared<request_msg_ids_handler>();
-    auto ids = std::make_shared<std::vector<int64_t>>();
-
-    thread_->run_async_function([history_cache = history_cache_, _contact, ids]() -> int32_t
+    return thread_->run_async_result<std::shared_ptr<std::vector<int64_t>>>([history_cache = history_cache_, _contact](request_msg_ids_handler& _result)
     {
-        *ids = history_cache->get_messages_for_update(_contact);
-
-        return 0;
-
-    })->on_result_ = [handler, ids](int32_t _error)
-    {
-        if (handler->on_result)
-            handler->on_result(ids);
-    };
-
-    return handler;
+        _result.set(std::make_shared<std::vector<int64_t>>(history_cache->get_messages_for_update(_contact)));
+    });
 }
 
 std::shared_ptr<get_mentions_handler> face::get_mentions(std::string_view _contact)
 {
-    auto handler = std::make_shared<get_mentions_handler>();
-    auto mentions = std::make_shared<history_block>();
-    auto first_load = std::make_shared<bool>(false);
-
-    thread_->run_async_function([history_cache = history_cache_, _contact = std::string(_contact), mentions, first_load]() -> int32_t
-    {
-        *mentions = history_cache->get_mentions(_contact, *first_load);
-
-        return 0;
-
-    })->on_result_ = [handler, mentions, first_load](int32_t _error)
+    return thread_->run_async_result<history_block_sptr, first_load>([history_cache = history_cache_, _contact = std::string(_contact)](get_mentions_handler& _result)
     {
-        if (handler->on_result)
-            handler->on_result(mentions, *first_load ? archive::first_load::yes : archive::first_load::no);
-    };
+        bool first_load = false;
+        auto mentions = std::make_shared<history_block>(history_cache->get_mentions(_contact, first_load));
 
-    return handler;
+        _result.set(std::move(mentions), first_load ? archive::first_load::yes : archive::first_load::no);
+    });
 }
 
 std::shared_ptr<filter_deleted_handler> face::filter_deleted_messages(const std::string & _contact, std::vector<int64_t>&& _ids)
 {
-    auto handler = std::make_shared<filter_deleted_handler>();
-    auto first_load = std::make_shared<bool>(false);
-    auto result = std::make_shared<std::vector<int64_t>>(std::move(_ids));
-
-    thread_->run_async_function([history_cache = history_cache_, _contact = std::string(_contact), result, first_load]()->int32_t
-    {
-        history_cache->filter_deleted(_contact, *result, *first_load);
-
-        return 0;
-
-    })->on_result_ = [handler, result, first_load](int32_t _error)
+    return thread_->run_async_result<std::vector<int64_t>, first_load>(
+        [history_cache = history_cache_, _contact = std::string(_contact), ids = std::make_shared<std::vector<int64_t>>(std::move(_ids))](filter_deleted_handler& _result)
     {
-        if (handler->on_result)
-            handler->on_result(*result, *first_load ? archive::first_load::yes : archive::first_load::no);
-    };
+        bool first_load = false;
+        history_cache->filter_deleted(_contact, *ids, first_load);
 
-    return handler;
+        _result.set(std::move(*ids), first_load ? archive::first_load::yes : archive::first_load::no);
+    });
 }
 
 std::shared_ptr<request_next_hole_handler> face::get_next_hole(const std::string& _contact, int64_t _from, int64_t _depth)
 {
-    auto handler = std::make_shared<request_next_hole_handler>();
-    auto hole = std::make_shared<archive_hole>();
-
-    thread_->run_async_function([history_cache = history_cache_, hole, _contact, _from, _depth]()->int32_t
+    return thread_->run_async_result<std::shared_ptr<archive_hole>>([history_cache = history_cache_, _contact, _from, _depth](request_next_hole_handler& _result)
     {
-        auto new_hole = history_cache->get_next_hole(_contact, _from, _depth);
-
-        if (new_hole)
-        {
-            *hole = *new_hole;
-            return 0;
-        }
-
-        return -1;
-
-    })->on_result_ = [handler, hole](int32_t _error)
-    {
-        if (handler->on_result)
-            handler->on_result( (_error == 0) ? hole : nullptr);
-    };
-
-    return handler;
+        _result.set(history_cache->get_next_hole(_contact, _from, _depth));
+    });
 }
 
 std::shared_ptr<validate_hole_request_handler> face::validate_hole_request(const std::string& _contact, const archive_hole& _hole_request, const int32_t _count)
 {
-    auto handler = std::make_shared<validate_hole_request_handler>();
-    auto from_result = std::make_shared<int64_t>();
-
-    thread_->run_async_function([history_cache = history_cache_, _contact, _hole_request, from_result, _count]()->int32_t
-    {
-        *from_result = history_cache->validate_hole_request(_contact, _hole_request, _count);
-
-        return 0;
-
-    })->on_result_ = [handler, from_result](int32_t _error)
+    return thread_->run_async_result<int64_t>([history_cache = history_cache_, _contact, _hole_request, _count](validate_hole_request_handler& _result)
     {
-        if (handler->on_result)
-            handler->on_result(*from_result);
-    };
-
-    return handler;
+        _result.set(history_cache->validate_hole_request(_contact, _hole_request, _count));
+    });
 }
 
 std::shared_ptr<not_sent_messages_handler> face::get_pending_message()
 {
-    auto handler = std::make_shared<not_sent_messages_handler>();
-    auto message = std::make_shared<not_sent_message_sptr>();
-
-    auto task = thread_->run_async_function(
-        [history_cache = history_cache_, message]
+    return thread_->run_async_result<not_sent_message_sptr>([history_cache = history_cache_](not_sent_messages_handler& _result)
     {
-        *message = history_cache->get_first_message_to_send();
-        return (*message) ? 0 : -1;
-    }
-    );
-
-    task->on_result_ = [handler, message](int32_t _error)
-    {
-        if (handler->on_result)
-        {
-            const auto succeed = (_error == 0);
-            handler->on_result(succeed ? *message : nullptr);
-        }
-    };
-
-    return handler;
+        _result.set(history_cache->get_first_message_to_send());
+    });
 }
 
 void face::get_pending_delete_message(std::function<void(const bool _empty, const std::string& _contact, const delete_message& _message)> _callback)
@@ -1076,136 +870,75 @@ void face::remove_pending_delete_message(const std::string& _contact, const dele
     });
 }
 
-std::shared_ptr<async_task_handlers> face::delete_messages_up_to(const std::string& _contact, const int64_t _id)
+std::shared_ptr<task_handler> face::delete_messages_up_to(const std::string& _contact, const int64_t _id)
 {
     assert(!_contact.empty());
     assert(_id > -1);
 
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function(
-        [history_cache = history_cache_, _contact, _id]
+    return thread_->run_async_result<int32_t>(
+        [history_cache = history_cache_, _contact, _id](task_handler& _result)
         {
             history_cache->delete_messages_up_to(_contact, _id);
-            return 0;
+            _result.set(0);
         }
-    )->on_result_ =
-        [handler](int32_t _error)
-        {
-            if (handler->on_result_)
-                handler->on_result_(_error);
-        };
-
-    return handler;
+    );
 }
 
 std::shared_ptr<not_sent_messages_handler> face::get_not_sent_message_by_iid(const std::string& _iid)
 {
     assert(!_iid.empty());
 
-    auto handler = std::make_shared<not_sent_messages_handler>();
-    auto message = std::make_shared<not_sent_message_sptr>();
-
-    auto task = thread_->run_async_function(
-        [history_cache = history_cache_, message, _iid]
-    {
-        *message = history_cache->get_not_sent_message_by_iid(_iid);
-        return (*message) ? 0 : -1;
-    }
-    );
-
-    task->on_result_ =
-        [handler, message](int32_t _error)
+    return thread_->run_async_result<not_sent_message_sptr>([history_cache = history_cache_, _iid](not_sent_messages_handler& _result)
     {
-        if (handler->on_result)
-        {
-            const auto succeed = (_error == 0);
-            handler->on_result(succeed ? *message : nullptr);
-        }
-    };
-
-    return handler;
+        _result.set(history_cache->get_not_sent_message_by_iid(_iid));
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::insert_not_sent_message(const std::string& _contact, const not_sent_message_sptr& _msg)
+std::shared_ptr<task_handler> face::insert_not_sent_message(const std::string& _contact, const not_sent_message_sptr& _msg)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([_contact, _msg, history_cache = history_cache_]()->int32_t
+    return thread_->run_async_result<int32_t>([_contact, _msg, history_cache = history_cache_](task_handler& _result)
     {
-        return history_cache->insert_not_sent_message(_contact, _msg);
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(history_cache->insert_not_sent_message(_contact, _msg));
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::update_if_exist_not_sent_message(const std::string& _contact, const not_sent_message_sptr& _msg)
+std::shared_ptr<task_handler> face::update_if_exist_not_sent_message(const std::string& _contact, const not_sent_message_sptr& _msg)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([_contact, _msg, history_cache = history_cache_]()->int32_t
+    return thread_->run_async_result<int32_t>([_contact, _msg, history_cache = history_cache_](task_handler& _result)
     {
-        return history_cache->update_if_exist_not_sent_message(_contact, _msg);
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(history_cache->update_if_exist_not_sent_message(_contact, _msg));
+    });
 }
 
 
-std::shared_ptr<async_task_handlers> face::remove_messages_from_not_sent(
+std::shared_ptr<task_handler> face::remove_messages_from_not_sent(
     const std::string& _contact,
     const bool _remove_if_modified,
     const archive::history_block_sptr& _data)
 {
-    auto handler = std::make_shared<async_task_handlers>();
     const auto correct_time = std::chrono::system_clock::now();
 
-    thread_->run_async_function([_contact, _data, history_cache = history_cache_, correct_time, _remove_if_modified]()->int32_t
+    return thread_->run_async_result<int32_t>([_contact, _data, history_cache = history_cache_, correct_time, _remove_if_modified](task_handler& _result)
     {
-        return history_cache->remove_messages_from_not_sent(_contact, _remove_if_modified, _data, correct_time);
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(history_cache->remove_messages_from_not_sent(_contact, _remove_if_modified, _data, correct_time));
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::remove_messages_from_not_sent(
+std::shared_ptr<task_handler> face::remove_messages_from_not_sent(
     const std::string& _contact,
     const bool _remove_if_modified,
     const archive::history_block_sptr& _data1,
     const archive::history_block_sptr& _data2)
 {
-    auto handler = std::make_shared<async_task_handlers>();
     const auto correct_time = std::chrono::system_clock::now();
 
-    thread_->run_async_function([_contact, _data1, _data2, history_cache = history_cache_, correct_time, _remove_if_modified]()->int32_t
+    return thread_->run_async_result<int32_t>([_contact, _data1, _data2, history_cache = history_cache_, correct_time, _remove_if_modified](task_handler& _result)
     {
-        return history_cache->remove_messages_from_not_sent(_contact, _remove_if_modified, _data1, _data2, correct_time);
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(history_cache->remove_messages_from_not_sent(_contact, _remove_if_modified, _data1, _data2, correct_time));
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::remove_message_from_not_sent(
+std::shared_ptr<task_handler> face::remove_message_from_not_sent(
     const std::string& _contact,
     const bool _remove_if_modified,
     const history_message_sptr _data)
@@ -1216,23 +949,14 @@ std::shared_ptr<async_task_handlers> face::remove_message_from_not_sent(
     return remove_messages_from_not_sent(_contact, _remove_if_modified, block);
 }
 
-std::shared_ptr<async_task_handlers> face::mark_message_duplicated(const std::string& _message_internal_id)
+std::shared_ptr<task_handler> face::mark_message_duplicated(const std::string& _message_internal_id)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([history_cache = history_cache_, _message_internal_id]()->int32_t
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _message_internal_id](task_handler& _result)
     {
         history_cache->mark_message_duplicated(_message_internal_id);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
 void face::serialize(std::shared_ptr<headers_list> _headers, coll_helper& _coll)
@@ -1247,62 +971,33 @@ void face::serialize_headers(archive::history_block_sptr _data, coll_helper& _co
 
 std::shared_ptr<has_not_sent_handler> face::has_not_sent_messages(const std::string& _contact)
 {
-    auto handler = std::make_shared<has_not_sent_handler>();
-    auto res = std::make_shared<bool>(false);
-
-    thread_->run_async_function([_contact, history_cache = history_cache_, res]()->int32_t
-    {
-        *res = history_cache->has_not_sent_messages(_contact);
-
-        return 0;
-
-    })->on_result_ = [handler, res](int32_t _error)
+    return thread_->run_async_result<bool>([_contact, history_cache = history_cache_](has_not_sent_handler& _result)
     {
-        if (handler->on_result)
-            handler->on_result(*res);
-    };
-
-    return handler;
+        _result.set(history_cache->has_not_sent_messages(_contact));
+    });
 }
 
 std::shared_ptr<request_buddies_handler> face::get_not_sent_messages(const std::string& _contact)
 {
-    auto handler = std::make_shared<request_buddies_handler>();
-    auto out_messages = std::make_shared<history_block>();
-
-    thread_->run_async_function([_contact, out_messages, history_cache = history_cache_]()->int32_t
+    return thread_->run_async_result<history_block_sptr, first_load, std::shared_ptr<error_vector>>([_contact, history_cache = history_cache_](request_buddies_handler& _result)
     {
+        auto out_messages = std::make_shared<history_block>();
         history_cache->get_not_sent_messages(_contact, out_messages);
 
-        return 0;
-
-    })->on_result_ = [handler, out_messages](int32_t _error)
-    {
-        if (handler->on_result)
-            handler->on_result(out_messages, archive::first_load::no, std::make_shared<error_vector>()); // now there is no need to check first load for pendings
-    };
-
-    return handler;
+        _result.set(std::move(out_messages), archive::first_load::no, std::make_shared<error_vector>()); // now there is no need to check first load for pendings
+    });
 }
 
 
 std::shared_ptr<pending_messages_handler> face::get_pending_file_sharing()
 {
-    auto handler = std::make_shared<pending_messages_handler>();
-    auto messages_list = std::make_shared<std::list<not_sent_message_sptr>>();
-
-    thread_->run_async_function([messages_list, history_cache = history_cache_]()->int32_t
-    {
-        history_cache->get_pending_file_sharing(*messages_list);
-
-        return 0;
-
-    })->on_result_ = [handler, messages_list](int32_t _error)
+    return thread_->run_async_result<std::list<not_sent_message_sptr>>([history_cache = history_cache_](pending_messages_handler& _result)
     {
-        handler->on_result(*messages_list);
-    };
+        std::list<not_sent_message_sptr> messages_list;
+        history_cache->get_pending_file_sharing(messages_list);
 
-    return handler;
+        _result.set(std::move(messages_list));
+    });
 }
 
 
@@ -1311,341 +1006,184 @@ std::shared_ptr<not_sent_messages_handler> face::update_pending_messages_by_imst
                                                                                     const int64_t& _before_hist_msg_id,
                                                                                     const bool _is_delivered)
 {
-    auto handler = std::make_shared<not_sent_messages_handler>();
-    auto message = std::make_shared<not_sent_message_sptr>();
-
     const auto correct_time = std::chrono::system_clock::now();
 
-    auto task = thread_->run_async_function([history_cache = history_cache_, message, _message_internal_id, _hist_msg_id, _before_hist_msg_id, _is_delivered, correct_time]
+    return thread_->run_async_result<not_sent_message_sptr>(
+        [history_cache = history_cache_, _message_internal_id, _hist_msg_id, _before_hist_msg_id, _is_delivered, correct_time](not_sent_messages_handler& _result)
     {
-        *message = history_cache->update_pending_with_imstate(_message_internal_id, _hist_msg_id, _before_hist_msg_id, _is_delivered, correct_time);
-
-        return (*message) ? 0 : -1;
+        _result.set(history_cache->update_pending_with_imstate(_message_internal_id, _hist_msg_id, _before_hist_msg_id, _is_delivered, correct_time));
     });
-
-    task->on_result_ = [handler, message](int32_t _error)
-    {
-        const auto succeed = (_error == 0);
-
-        handler->on_result(succeed ? *message : nullptr);
-    };
-
-    return handler;
 }
 
-std::shared_ptr<async_task_handlers> face::update_message_post_time(
+std::shared_ptr<task_handler> face::update_message_post_time(
     const std::string& _message_internal_id,
     const std::chrono::system_clock::time_point& _time_point)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    auto task = thread_->run_async_function([history_cache = history_cache_, _message_internal_id, _time_point]
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _message_internal_id, _time_point](task_handler& _result)
     {
         history_cache->update_message_post_time(_message_internal_id, _time_point);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(0);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
 
-std::shared_ptr<async_task_handlers> face::failed_pending_message(const std::string& _message_internal_id)
+std::shared_ptr<task_handler> face::failed_pending_message(const std::string& _message_internal_id)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    auto task = thread_->run_async_function([history_cache = history_cache_, _message_internal_id]
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _message_internal_id](task_handler& _result)
     {
         history_cache->failed_pending_message(_message_internal_id);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(0);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
 
-std::shared_ptr<async_task_handlers> face::sync_with_history()
+std::shared_ptr<task_handler> face::sync_with_history()
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([]()->int32_t
-    {
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
+    return thread_->run_async_result<int32_t>([](task_handler& _result)
     {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::add_mention(const std::string& _contact, const std::shared_ptr<archive::history_message>& _message)
+std::shared_ptr<task_handler> face::add_mention(const std::string& _contact, const std::shared_ptr<archive::history_message>& _message)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([_contact, _message, history_cache = history_cache_]()->int32_t
+    return thread_->run_async_result<int32_t>([_contact, _message, history_cache = history_cache_](task_handler& _result)
     {
         history_cache->add_mention(_contact, _message);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::update_attention_attribute(const std::string& _aimid, const bool _value)
+std::shared_ptr<task_handler> face::update_attention_attribute(const std::string& _aimid, const bool _value)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([history_cache = history_cache_, _aimid, _value]()->int32_t
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _aimid, _value](task_handler& _result)
     {
         history_cache->update_attention_attribute(_aimid, _value);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
 std::shared_ptr<request_merge_gallery_from_server> face::merge_gallery_from_server(const std::string& _aimid, const archive::gallery_storage& _gallery, const archive::gallery_entry_id& _from, const archive::gallery_entry_id& _till)
 {
-    auto handler = std::make_shared<request_merge_gallery_from_server>();
-    auto changes = std::make_shared<std::vector<archive::gallery_item>>();
-
-    thread_->run_async_function([history_cache = history_cache_, _aimid, _gallery, _from, _till, changes]()->int32_t
+    return thread_->run_async_result<std::vector<gallery_item>>([history_cache = history_cache_, _aimid, _gallery, _from, _till](request_merge_gallery_from_server& _result)
     {
-        history_cache->merge_server_gallery(_aimid, _gallery, _from, _till, *changes);
-
-        return 0;
-
-    })->on_result_ = [handler, changes](int32_t _error)
-    {
-        if (handler->on_result)
-            handler->on_result(*changes);
-    };
+        std::vector<archive::gallery_item> changes;
+        history_cache->merge_server_gallery(_aimid, _gallery, _from, _till, changes);
 
-    return handler;
+        _result.set(std::move(changes));
+    });
 }
 
 std::shared_ptr<request_gallery_state_handler> face::get_gallery_state(const std::string& _aimid)
 {
-    auto handler = std::make_shared<request_gallery_state_handler>();
-    auto _state = std::make_shared<archive::gallery_state>();
-
-    thread_->run_async_function([history_cache = history_cache_, _state, _aimid]()->int32_t
-    {
-        history_cache->get_gallery_state(_aimid, *_state);
-
-        return 0;
-
-    })->on_result_ = [handler, _state](int32_t _error)
+    return thread_->run_async_result<gallery_state>([history_cache = history_cache_, _aimid](request_gallery_state_handler& _result)
     {
-        if (handler->on_result)
-            handler->on_result(*_state);
-    };
+        archive::gallery_state state;
+        history_cache->get_gallery_state(_aimid, state);
 
-    return handler;
+        _result.set(std::move(state));
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::set_gallery_state(const std::string& _aimid, const archive::gallery_state& _state, bool _store_patch_version)
+std::shared_ptr<task_handler> face::set_gallery_state(const std::string& _aimid, const archive::gallery_state& _state, bool _store_patch_version)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([history_cache = history_cache_, _state, _aimid, _store_patch_version]()->int32_t
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _state, _aimid, _store_patch_version](task_handler& _result)
     {
         history_cache->set_gallery_state(_aimid, _state, _store_patch_version);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
 std::shared_ptr<request_gallery_holes> face::get_gallery_holes(const std::string& _aimid)
 {
-    auto handler = std::make_shared<request_gallery_holes>();
-    auto result = std::make_shared<bool>();
-    auto from = std::make_shared<archive::gallery_entry_id>();
-    auto till = std::make_shared<archive::gallery_entry_id>();
-
-    thread_->run_async_function([history_cache = history_cache_, result, from, till, _aimid]()->int32_t
+    return thread_->run_async_result<bool, gallery_entry_id, gallery_entry_id>([history_cache = history_cache_, _aimid](request_gallery_holes& _result)
     {
-        history_cache->get_gallery_holes(_aimid, *result, *from, *till);
-
-        return 0;
+        bool result = false;
+        archive::gallery_entry_id from;
+        archive::gallery_entry_id till;
+        history_cache->get_gallery_holes(_aimid, result, from, till);
 
-    })->on_result_ = [handler, result, from, till](int32_t _error)
-    {
-        if (handler->on_result)
-            handler->on_result(*result, *from, *till);
-    };
-
-    return handler;
+        _result.set(result, from, till);
+    });
 }
 
 std::shared_ptr<request_gallery_entries_page> face::get_gallery_entries(const std::string& _aimid, const archive::gallery_entry_id& _from, const std::vector<std::string> _types, int _page_size)
 {
-    auto handler = std::make_shared<request_gallery_entries_page>();
-    auto entries = std::make_shared<std::vector<archive::gallery_item>>();
-    auto exhausted = std::make_shared<bool>();
-
-    thread_->run_async_function([history_cache = history_cache_, entries, exhausted, _aimid, _from, _types, _page_size]()->int32_t
-    {
-        *exhausted = history_cache->get_gallery_entries(_aimid, _from, _types, _page_size, *entries);
-
-        return 0;
-
-    })->on_result_ = [handler, entries, exhausted](int32_t _error)
+    return thread_->run_async_result<std::vector<gallery_item>, bool>([history_cache = history_cache_, _aimid, _from, _types, _page_size](request_gallery_entries_page& _result)
     {
-        if (handler->on_result)
-            handler->on_result(*entries, *exhausted);
-    };
+        std::vector<archive::gallery_item> entries;
+        const auto exhausted = history_cache->get_gallery_entries(_aimid, _from, _types, _page_size, entries);
 
-    return handler;
+        _result.set(std::move(entries), exhausted);
+    });
 }
 
 std::shared_ptr<request_gallery_entries> face::get_gallery_entries_by_msg(const std::string& _aimid, const std::vector<std::string> _types, int64_t _msg_id)
 {
-    auto handler = std::make_shared<request_gallery_entries>();
-    auto entries = std::make_shared<std::vector<archive::gallery_item>>();
-    auto index = std::make_shared<int>();
-    auto total = std::make_shared<int>();
-
-    thread_->run_async_function([history_cache = history_cache_, entries, _aimid, _types, _msg_id, index, total]()->int32_t
+    return thread_->run_async_result<std::vector<gallery_item>, int, int>([history_cache = history_cache_, _aimid, _types, _msg_id](request_gallery_entries& _result)
     {
-        history_cache->get_gallery_entries_by_msg(_aimid, _types, _msg_id, *entries, *index, *total);
-        return 0;
+        std::vector<archive::gallery_item> entries;
+        int index = 0;
+        int total = 0;
+        history_cache->get_gallery_entries_by_msg(_aimid, _types, _msg_id, entries, index, total);
 
-    })->on_result_ = [handler, entries, index, total](int32_t _error)
-    {
-        if (handler->on_result)
-            handler->on_result(*entries, *index, *total);
-    };
-
-    return handler;
+        _result.set(std::move(entries), index, total);
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::clear_hole_request(const std::string& _aimid)
+std::shared_ptr<task_handler> face::clear_hole_request(const std::string& _aimid)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([history_cache = history_cache_, _aimid]()->int32_t
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _aimid](task_handler& _result)
     {
         history_cache->clear_hole_request(_aimid);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::make_gallery_hole(const std::string& _aimId, int64_t _from, int64_t _till)
+std::shared_ptr<task_handler> face::make_gallery_hole(const std::string& _aimId, int64_t _from, int64_t _till)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([history_cache = history_cache_, _aimId, _from, _till]()->int32_t
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _aimId, _from, _till](task_handler& _result)
     {
         history_cache->make_gallery_hole(_aimId, _from, _till);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::make_holes(const std::string& _aimid)
+std::shared_ptr<task_handler> face::make_holes(const std::string& _aimid)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([history_cache = history_cache_, _aimid]()->int32_t
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _aimid](task_handler& _result)
     {
         history_cache->make_holes(_aimid);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::invalidate_message_data(const std::string& _aimid, std::vector<int64_t> _ids)
+std::shared_ptr<task_handler> face::invalidate_message_data(const std::string& _aimid, std::vector<int64_t> _ids)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([history_cache = history_cache_, _aimid, ids = std::move(_ids)]()->int32_t
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _aimid, ids = std::move(_ids)](task_handler& _result)
     {
         history_cache->invalidate_message_data(_aimid, ids);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
-std::shared_ptr<async_task_handlers> face::invalidate_message_data(const std::string& _aimid, int64_t _from, int64_t _before_count, int64_t _after_count)
+std::shared_ptr<task_handler> face::invalidate_message_data(const std::string& _aimid, int64_t _from, int64_t _before_count, int64_t _after_count)
 {
-    auto handler = std::make_shared<async_task_handlers>();
-
-    thread_->run_async_function([history_cache = history_cache_, _aimid, _from, _before_count, _after_count]()->int32_t
+    return thread_->run_async_result<int32_t>([history_cache = history_cache_, _aimid, _from, _before_count, _after_count](task_handler& _result)
     {
         history_cache->invalidate_message_data(_aimid, _from, _before_count, _after_count);
 
-        return 0;
-
-    })->on_result_ = [handler](int32_t _error)
-    {
-        if (handler->on_result_)
-            handler->on_result_(_error);
-    };
-
-    return handler;
+        _result.set(0);
+    });
 }
 
 void face::free_dialog(const std::string& _contact)
@@ -1661,21 +1199,12 @@ void face::free_dialog(const std::string& _contact)
 
 std::shared_ptr<memory_usage> face::get_memory_usage()
 {
-    auto handler = std::make_shared<memory_usage>();
-
-    auto index_size = std::make_shared<int64_t>(0);
-    auto gallery_size = std::make_shared<int64_t>(0);
-
-    thread_->run_async_function([history_cache = history_cache_, index_size, gallery_size]()->int32_t
+    return thread_->run_async_result<int64_t, int64_t>([history_cache = history_cache_](memory_usage& _result)
     {
-        history_cache->get_memory_usage(*index_size, *gallery_size);
-
-        return 0;
+        int64_t index_size = 0;
+        int64_t gallery_size = 0;
+        history_cache->get_memory_usage(index_size, gallery_size);
 
-    })->on_result_ = [handler, index_size, gallery_size](int32_t _error)
-    {
-        handler->on_result(*index_size, *gallery_size);
-    };
-
-    return handler;
+        _result.set(index_size, gallery_size);
+    });
 }
@@ -77,172 +77,12 @@ namespace core
             }
         };
 
-        struct request_buddies_handler
-        {
-            using on_result_type = std::function<void(std::shared_ptr<history_block>, first_load, std::shared_ptr<error_vector>)>;
-            on_result_type on_result;
-
-            request_buddies_handler()
-            {
-                on_result = [](std::shared_ptr<history_block>, first_load, std::shared_ptr<error_vector>){};
-            }
-        };
-
-        struct filter_deleted_handler
-        {
-            using on_result_type = std::function<void(const std::vector<int64_t>&, first_load)>;
-            on_result_type on_result;
-
-            filter_deleted_handler()
-            {
-                on_result = [](const std::vector<int64_t>&, first_load) {};
-            }
-        };
-
-        struct request_dlg_state_handler
-        {
-            using on_result_type = std::function<void(const dlg_state& _state)>;
-            on_result_type on_result;
-
-            request_dlg_state_handler()
-            {
-                on_result = [](const dlg_state& _state){};
-            }
-        };
-
-        struct request_dlg_states_handler
-        {
-            using on_result_type = std::function<void(const std::vector<dlg_state>& _states)>;
-            on_result_type on_result;
-
-            request_dlg_states_handler()
-            {
-                on_result = [](const std::vector<dlg_state>& _states){};
-            }
-        };
-
-        struct set_dlg_state_handler
-        {
-            using on_result_type = std::function<void(const dlg_state& _state, const dlg_state_changes& _changes)>;
-            on_result_type on_result;
-
-            set_dlg_state_handler()
-            {
-                on_result = [](const dlg_state&, const dlg_state_changes&){};
-            }
-        };
-
-        struct request_next_hole_handler
-        {
-            using on_result_type = std::function<void(std::shared_ptr<archive_hole> _hole)>;
-            on_result_type on_result;
-
-            request_next_hole_handler()
-            {
-                on_result = [](std::shared_ptr<archive_hole> _hole){};
-            }
-        };
-
-        struct validate_hole_request_handler
-        {
-            using on_result_type = std::function<void(int64_t _from)>;
-            on_result_type on_result;
-
-            validate_hole_request_handler()
-            {
-                on_result = [](int64_t _from){};
-            }
-        };
-
-        struct update_history_handler
-        {
-            using on_result_type = std::function<void(std::shared_ptr<headers_list> _new_ids, const dlg_state &_state, const archive::dlg_state_changes&, core::archive::storage::result_type)>;
-            on_result_type on_result;
-        };
-
-        struct not_sent_messages_handler
-        {
-            using on_result_type = std::function<void(not_sent_message_sptr _message)>;
-            on_result_type on_result;
-
-            not_sent_messages_handler()
-            {
-                on_result = [](not_sent_message_sptr _message){};
-            }
-        };
-
-        struct pending_messages_handler
-        {
-            using on_result_type = std::function<void(const std::list<not_sent_message_sptr>& _messages)>;
-            on_result_type on_result;
-
-            pending_messages_handler()
-            {
-                on_result = [](const std::list<not_sent_message_sptr>&){};
-            }
-        };
-
-        struct has_not_sent_handler
-        {
-            using on_result_type = std::function<void(bool _has)>;
-            on_result_type on_result;
-
-            has_not_sent_handler()
-            {
-                on_result = [](bool){};
-            }
-        };
-
-        struct request_history_file_handler
-        {
-            using on_result_type = std::function<void(std::shared_ptr<contact_and_msgs>, std::shared_ptr<contact_and_offsets_v>, std::shared_ptr<tools::binary_stream> _data)>;
-            on_result_type on_result;
-
-            request_history_file_handler()
-            {
-                on_result = [](std::shared_ptr<contact_and_msgs>, std::shared_ptr<contact_and_offsets_v>, std::shared_ptr<tools::binary_stream>){};
-            }
-        };
-
-        struct request_msg_ids_handler
-        {
-            using on_result_type = std::function<void(std::shared_ptr<std::vector<int64_t>>)>;
-            on_result_type on_result;
-
-            request_msg_ids_handler()
-            {
-                on_result = [](std::shared_ptr<std::vector<int64_t>>){};
-            }
-        };
-
-        struct get_mentions_handler
-        {
-            using on_result_type = std::function<void(history_block_sptr, first_load)>;
-            on_result_type on_result;
-
-            get_mentions_handler()
-            {
-                on_result = [](history_block_sptr, first_load) {};
-            }
-        };
-
         struct find_previewable_links_handler
         {
             using on_result_type = std::function<void(const common::tools::url_vector_t &_uris)>;
             on_result_type on_result_;
         };
 
-        struct request_gallery_state_handler
-        {
-            using on_result_type = std::function<void(const archive::gallery_state& _state)>;
-            on_result_type on_result;
-
-            request_gallery_state_handler()
-            {
-                on_result = [](const archive::gallery_state& _state) {};
-            }
-        };
-
         struct request_gallery_set_state_handler
         {
             using on_result_type = std::function<void()>;
@@ -254,56 +94,28 @@ namespace core
             }
         };
 
-        struct request_merge_gallery_from_server
-        {
-            using on_result_type = std::function<void(const std::vector<archive::gallery_item>& _changes)>;
-            on_result_type on_result;
-
-            request_merge_gallery_from_server()
-            {
-                on_result = [](const std::vector<archive::gallery_item>& _changes) {};
-            }
-        };
-
-        struct request_gallery_holes
-        {
-            using on_result_type = std::function<void(bool _result, const archive::gallery_entry_id& _from, const archive::gallery_entry_id& _till)>;
-            on_result_type on_result;
-
-            request_gallery_holes()
-            {
-                on_result = [](bool _result, const archive::gallery_entry_id& _from, const archive::gallery_entry_id& _till) {};
-            }
-        };
-
-        struct request_gallery_entries
-        {
-            using on_result_type = std::function<void(const std::vector<archive::gallery_item>& _entries, int _index, int _total)>;
-            on_result_type on_result;
-
-            request_gallery_entries()
-            {
-                on_result = [](const std::vector<archive::gallery_item>& _entries, int _index, int _total) {};
-            }
-        };
-
-        struct request_gallery_entries_page
-        {
-            using on_result_type = std::function<void(const std::vector<archive::gallery_item>& _entries, bool _exhausted)>;
-            on_result_type on_result;
-
-            request_gallery_entries_page()
-            {
-                on_result = [](const std::vector<archive::gallery_item>& _entries, bool _exhausted) {};
-            }
-        };
-
-        struct memory_usage
-        {
-            std::function<void(
-                const int64_t _memory_usage_index,
-                const int64_t _memory_usage_gallery)> on_result = [](const int64_t, const int64_t){};
-        };
+        // results of the face requests, see async_result
+        using task_handler = async_result<int32_t>;
+        using request_buddies_handler = async_result<history_block_sptr, first_load, std::shared_ptr<error_vector>>;
+        using filter_deleted_handler = async_result<std::vector<int64_t>, first_load>;
+        using request_dlg_state_handler = async_result<dlg_state>;
+        using request_dlg_states_handler = async_result<std::vector<dlg_state>>;
+        using set_dlg_state_handler = async_result<dlg_state, dlg_state_changes>;
+        using request_next_hole_handler = async_result<std::shared_ptr<archive_hole>>;
+        using validate_hole_request_handler = async_result<int64_t>;
+        using update_history_handler = async_result<std::shared_ptr<headers_list>, dlg_state, dlg_state_changes, storage::result_type>;
+        using not_sent_messages_handler = async_result<not_sent_message_sptr>;
+        using pending_messages_handler = async_result<std::list<not_sent_message_sptr>>;
+        using has_not_sent_handler = async_result<bool>;
+        using request_history_file_handler = async_result<std::shared_ptr<contact_and_msgs>, std::shared_ptr<contact_and_offsets_v>, std::shared_ptr<tools::binary_stream>>;
+        using request_msg_ids_handler = async_result<std::shared_ptr<std::vector<int64_t>>>;
+        using get_mentions_handler = async_result<history_block_sptr, first_load>;
+        using request_gallery_state_handler = async_result<gallery_state>;
+        using request_merge_gallery_from_server = async_result<std::vector<gallery_item>>;
+        using request_gallery_holes = async_result<bool, gallery_entry_id, gallery_entry_id>;
+        using request_gallery_entries = async_result<std::vector<gallery_item>, int, int>;
+        using request_gallery_entries_page = async_result<std::vector<gallery_item>, bool>;
+        using memory_usage = async_result<int64_t, int64_t>;
 
         class local_history : public std::enable_shared_from_this<local_history>
         {
@@ -449,8 +261,8 @@ namespace core
             void free_dialog(const std::string& _contact);
 
             std::shared_ptr<update_history_handler> update_history(const std::string& _contact, const std::shared_ptr<archive::history_block>& _data, int64_t _from = -1, local_history::has_older_message_id _has_older_msgid = local_history::has_older_message_id::yes);
-            std::shared_ptr<async_task_handlers> update_message_data(const std::string& _contact, const history_message& _message);
-            std::shared_ptr<async_task_handlers> drop_history(const std::string& _contact);
+            std::shared_ptr<task_handler> update_message_data(const std::string& _contact, const history_message& _message);
+            std::shared_ptr<task_handler> drop_history(const std::string& _contact);
             std::shared_ptr<request_buddies_handler> get_messages_buddies(const std::string& _contact, std::shared_ptr<archive::msgids_list> _ids);
             std::shared_ptr<request_buddies_handler> get_messages(const std::string& _contact, int64_t _from, int64_t _count_early, int64_t _count_later);
             std::shared_ptr<request_msg_ids_handler> get_messages_for_update(const std::string& _contact);
@@ -465,40 +277,40 @@ namespace core
             std::shared_ptr<request_dlg_states_handler> get_dlg_states(const std::vector<std::string>& _contacts);
 
             std::shared_ptr<set_dlg_state_handler> set_dlg_state(const std::string& _contact, const dlg_state& _state);
-            std::shared_ptr<async_task_handlers> clear_dlg_state(const std::string& _contact);
+            std::shared_ptr<task_handler> clear_dlg_state(const std::string& _contact);
             std::shared_ptr<request_next_hole_handler> get_next_hole(const std::string& _contact, int64_t _from, int64_t _depth = -1);
             std::shared_ptr<validate_hole_request_handler> validate_hole_request(const std::string& _contact, const archive_hole& _hole_request, const int32_t _count);
 
-            std::shared_ptr<async_task_handlers> sync_with_history();
+            std::shared_ptr<task_handler> sync_with_history();
 
             std::shared_ptr<not_sent_messages_handler> get_pending_message();
             std::shared_ptr<not_sent_messages_handler> get_not_sent_message_by_iid(const std::string& _iid);
-            std::shared_ptr<async_task_handlers> insert_not_sent_message(const std::string& _contact, const not_sent_message_sptr& _msg);
-            std::shared_ptr<async_task_handlers> update_if_exist_not_sent_message(const std::string& _contact, const not_sent_message_sptr& _msg);
+            std::shared_ptr<task_handler> insert_not_sent_message(const std::string& _contact, const not_sent_message_sptr& _msg);
+            std::shared_ptr<task_handler> update_if_exist_not_sent_message(const std::string& _contact, const not_sent_message_sptr& _msg);
 
             void get_pending_delete_message(std::function<void(const bool _empty, const std::string& _contact, const delete_message& _message)> _callback);
             void insert_pending_delete_message(const std::string& _contact, delete_message _message);
             void remove_pending_delete_message(const std::string& _contact, const delete_message& _message);
 
-            std::shared_ptr<async_task_handlers> remove_messages_from_not_sent(
+            std::shared_ptr<task_handler> remove_messages_from_not_sent(
                 const std::string& _contact,
                 const bool _remove_if_modified,
                 const std::shared_ptr<archive::history_block>& _data);
 
-            std::shared_ptr<async_task_handlers> remove_messages_from_not_sent(
+            std::shared_ptr<task_handler> remove_messages_from_not_sent(
                 const std::string& _contact,
                 const bool _remove_if_modified,
                 const std::shared_ptr<archive::history_block>& _data1,
                 const std::shared_ptr<archive::history_block>& _data2);
 
-            std::shared_ptr<async_task_handlers> remove_message_from_not_sent(
+            std::shared_ptr<task_handler> remove_message_from_not_sent(
                 const std::string& _contact,
                 const bool _remove_if_modified,
                 const history_message_sptr _data);
 
-            std::shared_ptr<async_task_handlers> mark_message_duplicated(const std::string& _message_internal_id);
+            std::shared_ptr<task_handler> mark_message_duplicated(const std::string& _message_internal_id);
 
-            std::shared_ptr<async_task_handlers> update_message_post_time(
+            std::shared_ptr<task_handler> update_message_post_time(
                 const std::string& _message_internal_id,
                 const std::chrono::system_clock::time_point& _time_point);
 
@@ -508,26 +320,26 @@ namespace core
                 const int64_t& _before_hist_msg_id,
                 const bool _is_delivered);
 
-            std::shared_ptr<async_task_handlers> failed_pending_message(const std::string& _message_internal_id);
+            std::shared_ptr<task_handler> failed_pending_message(const std::string& _message_internal_id);
 
             std::shared_ptr<has_not_sent_handler> has_not_sent_messages(const std::string& _contact);
             std::shared_ptr<request_buddies_handler> get_not_sent_messages(const std::string& _contact);
             std::shared_ptr<pending_messages_handler> get_pending_file_sharing();
 
-            std::shared_ptr<async_task_handlers> delete_messages_up_to(const std::string& _contact, const int64_t _id);
+            std::shared_ptr<task_handler> delete_messages_up_to(const std::string& _contact, const int64_t _id);
 
-            std::shared_ptr<async_task_handlers> add_mention(const std::string& _contact, const std::shared_ptr<archive::history_message>& _message);
+            std::shared_ptr<task_handler> add_mention(const std::string& _contact, const std::shared_ptr<archive::history_message>& _message);
 
             static void serialize(std::shared_ptr<headers_list> _headers, coll_helper& _coll);
             static void serialize_headers(std::shared_ptr<archive::history_block> _data, coll_helper& _coll);
 
-            std::shared_ptr<async_task_handlers> update_attention_attribute(const std::string& _aimid, const bool _value);
+            std::shared_ptr<task_handler> update_attention_attribute(const std::string& _aimid, const bool _value);
 
             std::shared_ptr<request_merge_gallery_from_server> merge_gallery_from_server(const std::string& _aimid, const archive::gallery_storage& _gallery, const archive::gallery_entry_id& _from, const archive::gallery_entry_id& _till);
 
             std::shared_ptr<request_gallery_state_handler> get_gallery_state(const std::string& _aimid);
 
-            std::shared_ptr<async_task_handlers> set_gallery_state(const std::string& _aimid, const archive::gallery_state& _state, bool _store_patch_version);
+            std::shared_ptr<task_handler> set_gallery_state(const std::string& _aimid, const archive::gallery_state& _state, bool _store_patch_version);
 
             std::shared_ptr<request_gallery_holes> get_gallery_holes(const std::string& _aimid);
 
@@ -535,13 +347,13 @@ namespace core
 
             std::shared_ptr<request_gallery_entries> get_gallery_entries_by_msg(const std::string& _aimid, const std::vector<std::string> _types, int64_t _msg_id);
 
-            std::shared_ptr<async_task_handlers> clear_hole_request(const std::string& _aimId);
+            std::shared_ptr<task_handler> clear_hole_request(const std::string& _aimId);
 
-            std::shared_ptr<async_task_handlers> make_gallery_hole(const std::string& _aimId, int64_t _from, int64_t _till);
+            std::shared_ptr<task_handler> make_gallery_hole(const std::string& _aimId, int64_t _from, int64_t _till);
 
-            std::shared_ptr<async_task_handlers> make_holes(const std::string& _aimid);
-            std::shared_ptr<async_task_handlers> invalidate_message_data(const std::string& _aimid, std::vector<int64_t> _ids);
-            std::shared_ptr<async_task_handlers> invalidate_message_data(const std::string& _aimid, int64_t _from, int64_t _before_count, int64_t _after_count);
+            std::shared_ptr<task_handler> make_holes(const std::string& _aimid);
+            std::shared_ptr<task_handler> invalidate_message_data(const std::string& _aimid, std::vector<int64_t> _ids);
+            std::shared_ptr<task_handler> invalidate_message_data(const std::string& _aimid, int64_t _from, int64_t _before_count, int64_t _after_count);
 
             std::shared_ptr<memory_usage> get_memory_usage();
         };
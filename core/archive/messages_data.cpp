@@ -9,6 +9,12 @@
 using namespace core;
 using namespace archive;
 
+namespace
+{
+    // the rest of the old messages get their spans stored when they are read again
+    constexpr size_t max_text_spans_updates = 1000;
+}
+
 messages_data::messages_data(std::wstring _file_name)
     : storage_(std::make_unique<storage>(std::move(_file_name)))
 {
@@ -81,6 +87,10 @@ messages_data::error_vector messages_data::get_messages(const headers_list& _hea
 
         msg->apply_header_flags(header);
 
+        // a modified message is stored with its modifications applied, so it isn't rewritten
+        if (msg->need_store_text_spans() && !header.is_modified() && text_spans_updates_.size() < max_text_spans_updates)
+            text_spans_updates_.emplace_back(header, std::make_shared<history_message>(*msg));
+
         const auto modifications = get_message_modifications(header);
         msg->apply_modifications(modifications);
 
@@ -93,6 +103,11 @@ messages_data::error_vector messages_data::get_messages(const headers_list& _hea
     return res;
 }
 
+messages_data::text_spans_updates messages_data::take_text_spans_updates()
+{
+    return std::exchange(text_spans_updates_, text_spans_updates());
+}
+
 void messages_data::drop()
 {
     archive::storage_mode mode;
@@ -186,7 +201,8 @@ void messages_data::search_in_archive(std::shared_ptr<contact_and_offsets_v> _co
                 , std::shared_ptr<archive::contact_and_msgs> _archive
                 , std::shared_ptr<tools::binary_stream> _data
                 , search::found_messages& found_messages
-                , int64_t _min_id)
+                , int64_t _min_id
+                , const std::atomic<bool>& _cancelled)
 {
     std::set<int64_t, std::greater<int64_t>> top_ids;
 
@@ -224,6 +240,9 @@ void messages_data::search_in_archive(std::shared_ptr<contact_and_offsets_v> _co
 
         while (storage::fast_read_data_block((*_data), current_pos, begin_of_block, end_pos))
         {
+            if (_cancelled.load(std::memory_order_relaxed))
+                return;
+
             _data->set_output(begin_of_block);
             auto mess_id = history_message::get_id_field(*_data);
 
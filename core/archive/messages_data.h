@@ -44,6 +44,15 @@ namespace core
 
             history_block get_message_modifications(const message_header& _header) const;
 
+        public:
+
+            using text_spans_updates = std::vector<std::pair<message_header, std::shared_ptr<history_message>>>;
+
+        private:
+
+            // the messages read without the stored text spans, with the headers they were read by
+            mutable text_spans_updates text_spans_updates_;
+
         public:
 
             messages_data(std::wstring _file_name);
@@ -57,11 +66,14 @@ namespace core
 
             void drop();
 
+            text_spans_updates take_text_spans_updates();
+
             static void search_in_archive(std::shared_ptr<contact_and_offsets_v> _contacts, std::shared_ptr<coded_term> _cterm
                 , std::shared_ptr<archive::contact_and_msgs> _archive
                 , std::shared_ptr<tools::binary_stream> _data
                 , search::found_messages& found_messages
-                , int64_t _min_id);
+                , int64_t _min_id
+                , const std::atomic<bool>& _cancelled);
 
             static bool get_history_archive(const std::wstring& _file_name, core::tools::binary_stream& _buffer
                 , std::shared_ptr<int64_t> _offset, std::shared_ptr<int64_t> _remaining_size, int64_t& _cur_index, std::shared_ptr<int64_t> _mode);
@@ -36,6 +36,30 @@ namespace
 
         max
     };
+
+    enum journal_record_fields
+    {
+        record_type = 1,
+        record_aimid = 2,
+        record_entry = 3,
+        record_generation = 4
+    };
+
+    // the tlv type of the generation in the root pack of a pending file, the entries have type 0
+    constexpr uint32_t pending_file_generation = 1;
+
+    // a longer journal is folded into the pending file
+    constexpr size_t journal_compaction_records = 256;
+
+    bool is_same_entry(const not_sent_message& _l, const not_sent_message& _r)
+    {
+        return _l.get_internal_id() == _r.get_internal_id();
+    }
+
+    bool is_same_entry(const delete_message& _l, const delete_message& _r)
+    {
+        return _l == _r;
+    }
 }
 
 not_sent_message_sptr not_sent_message::make(const core::tools::tlvpack& _pack)
@@ -538,11 +562,18 @@ pending_operations::pending_operations(
     const std::wstring& _file_pending_delete)
     : pending_sent_storage_(std::make_unique<storage>(_file_pending_sent))
     , pending_delete_storage_(std::make_unique<storage>(_file_pending_delete))
+    , pending_sent_journal_(_file_pending_sent + L".journal")
+    , pending_delete_journal_(_file_pending_delete + L".journal")
     , is_loaded_(false)
 {
     load_if_need();
 }
 
+pending_operations::journal::journal(std::wstring _file_name)
+    : storage_(std::make_unique<storage>(std::move(_file_name)))
+{
+}
+
 pending_operations::~pending_operations()
 {
 }
@@ -579,7 +610,7 @@ void pending_operations::insert_message(const std::string& _aimid, const not_sen
         g_core->write_string_to_network_log(log.str());
     }
 
-    save_pending_sent_messages();
+    journal_sent(journal_record::upsert, _aimid, _message.get());
 }
 
 bool pending_operations::update_message_if_exist(const std::string &_aimid, const not_sent_message_sptr &_message)
@@ -604,7 +635,7 @@ bool pending_operations::update_message_if_exist(const std::string &_aimid, cons
             if (!fs.is_empty())
                 message->get_message()->init_file_sharing(std::move(fs));
 
-            save_pending_sent_messages();
+            journal_sent(journal_record::upsert, _aimid, message.get());
 
             return true;
         }
@@ -647,8 +678,10 @@ message_stat_time pending_operations::remove(const std::string& _internal_id)
                 st.contact_ = not_sent_message.get_aimid();
                 st.msg_id_ = message.get_msgid();
 
+                // the journal may write the whole file instead, so the message is removed first
+                const auto removed = *iter;
                 iter = _messages_pair.second.erase(iter);
-                save_pending_sent_messages();
+                journal_sent(journal_record::remove, _messages_pair.first, removed.get());
 
                 std::stringstream log;
                 log << "CORE: remove pending\r\n";
@@ -670,7 +703,7 @@ void pending_operations::drop(const std::string& _aimid)
     if (auto it = pending_messages_.find(_aimid); it != pending_messages_.end())
     {
         pending_messages_.erase(it);
-        save_pending_sent_messages();
+        journal_sent(journal_record::drop, _aimid);
 
         std::stringstream log;
         log << "CORE: drop pendings\r\n";
@@ -680,7 +713,7 @@ void pending_operations::drop(const std::string& _aimid)
     if (auto it = pending_delete_messages_.find(_aimid); it != pending_delete_messages_.end())
     {
         pending_delete_messages_.erase(it);
-        save_pending_delete_messages();
+        journal_delete(journal_record::drop, _aimid);
     }
 }
 
@@ -695,14 +728,6 @@ message_stat_time_v pending_operations::remove(const std::string &_aimid, const
     if (messages.empty())
         return stats;
 
-    bool save_on_exit = false;
-
-    tools::auto_scope as([&save_on_exit, this]
-    {
-        if (save_on_exit)
-            save_pending_sent_messages();
-    });
-
     stats.reserve((*_data).size());
     for (const auto &block : *_data)
     {
@@ -732,13 +757,13 @@ message_stat_time_v pending_operations::remove(const std::string &_aimid, const
                 st.msg_id_ = block_msgid;
                 stats.emplace_back(std::move(st));
 
-                save_on_exit = true;
-
                 if (not_sent_message.is_deleted())
                 {
                     insert_deleted_message(_aimid, delete_message(_aimid, block_msgid, message.get_internal_id(), not_sent_message.get_delete_operation()));
 
+                    const auto removed = *iter;
                     iter = messages.erase(iter);
+                    journal_sent(journal_record::remove, _aimid, removed.get());
                     continue;
                 }
                 else if (not_sent_message.is_modified() && !_remove_if_modified)
@@ -746,10 +771,14 @@ message_stat_time_v pending_operations::remove(const std::string &_aimid, const
                     (*iter)->set_updated_id(block_msgid);
                     (*iter)->set_modified(false);
                     (*iter)->set_network_request_id(core::tools::system::generate_internal_id());
+
+                    journal_sent(journal_record::upsert, _aimid, iter->get());
                 }
                 else
                 {
+                    const auto removed = *iter;
                     iter = messages.erase(iter);
+                    journal_sent(journal_record::remove, _aimid, removed.get());
                     continue;
                 }
             }
@@ -772,7 +801,7 @@ void pending_operations::mark_duplicated(const std::string& _message_internal_id
     {
         msg->mark_duplicated();
 
-        save_pending_sent_messages();
+        journal_sent(journal_record::upsert, msg->get_aimid(), msg.get());
     }
 }
 
@@ -813,15 +842,13 @@ not_sent_message_sptr pending_operations::update_with_imstate(
         }
         else if (msg->is_modified())
         {
-
+            journal_sent(journal_record::upsert, msg->get_aimid(), msg.get());
         }
         else
         {
             remove(_message_internal_id);
         }
 
-        save_pending_sent_messages();
-
         return msg;
     }
 
@@ -839,7 +866,7 @@ void pending_operations::failed_pending_message(const std::string& _message_inte
 
     msg->set_failed();
 
-    save_pending_sent_messages();
+    journal_sent(journal_record::upsert, msg->get_aimid(), msg.get());
 }
 
 bool pending_operations::exist_message(const std::string& _aimid) const
@@ -945,8 +972,6 @@ not_sent_message_sptr pending_operations::get_message_by_internal_id(const std::
 
 int32_t pending_operations::insert_deleted_message(const std::string& _contact, delete_message _message)
 {
-    bool pending_changed = false;
-
     auto iter_contact = pending_messages_.find(_contact);
 
     if (iter_contact != pending_messages_.end())
@@ -962,23 +987,19 @@ int32_t pending_operations::insert_deleted_message(const std::string& _contact,
                 (*iter_message)->set_deleted(true);
                 (*iter_message)->set_delete_operation(_message.get_operation());
 
-                pending_changed = true;
+                journal_sent(journal_record::upsert, _contact, iter_message->get());
             }
 
             ++iter_message;
         }
     }
 
-    if (pending_changed)
-    {
-        save_pending_sent_messages();
-    }
-
     if (_message.get_message_id() > 0)
     {
-        pending_delete_messages_[_contact].emplace_back(std::make_unique<delete_message>(std::move(_message)));
+        auto& contact_messages = pending_delete_messages_[_contact];
+        contact_messages.emplace_back(std::make_unique<delete_message>(std::move(_message)));
 
-        save_pending_delete_messages();
+        journal_delete(journal_record::upsert, _contact, contact_messages.back().get());
     }
 
     return 0;
@@ -1009,7 +1030,8 @@ int32_t pending_operations::remove_deleted_message(const std::string& _contact,
             pending_delete_messages_.erase(iter_contact);
     }
 
-    save_pending_delete_messages();
+    if (res == 0)
+        journal_delete(journal_record::remove, _contact, &_message);
 
     return res;
 }
@@ -1034,7 +1056,7 @@ bool pending_operations::get_first_pending_delete_message(std::string& _contact,
 
 
 template <class container_type_>
-bool pending_operations::save(storage& _storage, const container_type_& _pendings) const
+bool pending_operations::save(storage& _storage, const container_type_& _pendings, uint64_t _generation) const
 {
     archive::storage_mode mode;
     mode.flags_.write_ = true;
@@ -1049,6 +1071,7 @@ bool pending_operations::save(storage& _storage, const container_type_& _pending
     core::tools::binary_stream block_data;
 
     core::tools::tlvpack pack_root;
+    pack_root.push_child(core::tools::tlv(pending_file_generation, _generation));
 
     for (const auto &pair : _pendings)
     {
@@ -1073,7 +1096,7 @@ bool pending_operations::save(storage& _storage, const container_type_& _pending
 }
 
 template <class container_type_, class entry_type_>
-bool pending_operations::load(storage& _storage, container_type_& _pendings)
+bool pending_operations::load(storage& _storage, container_type_& _pendings, uint64_t& _generation)
 {
     archive::storage_mode mode;
     mode.flags_.read_ = true;
@@ -1100,6 +1123,14 @@ bool pending_operations::load(storage& _storage, container_type_& _pendings)
     auto tlv_msg = pack_root.get_first();
     while (tlv_msg)
     {
+        if (tlv_msg->get_type() == pending_file_generation)
+        {
+            _generation = tlv_msg->get_value<uint64_t>();
+
+            tlv_msg = pack_root.get_next();
+            continue;
+        }
+
         auto bs_message = tlv_msg->get_value<core::tools::binary_stream>();
 
         core::tools::tlvpack pack_message;
@@ -1119,23 +1150,335 @@ bool pending_operations::load(storage& _storage, container_type_& _pendings)
     return true;
 }
 
+template <class entry_type_>
+bool pending_operations::append_journal(journal& _journal, journal_record _type, const std::string& _aimid, const entry_type_* _entry)
+{
+    core::tools::tlvpack pack_record;
+    pack_record.push_child(core::tools::tlv(journal_record_fields::record_type, static_cast<uint32_t>(_type)));
+    pack_record.push_child(core::tools::tlv(journal_record_fields::record_aimid, _aimid));
+
+    if (_entry)
+    {
+        core::tools::tlvpack pack_entry;
+        _entry->serialize(pack_entry);
+
+        pack_record.push_child(core::tools::tlv(journal_record_fields::record_entry, pack_entry));
+    }
+
+    core::tools::binary_stream block_data;
+    pack_record.serialize(block_data);
+
+    archive::storage_mode mode;
+    mode.flags_.write_ = true;
+    mode.flags_.append_ = true;
+    if (!_journal.storage_->open(mode))
+    {
+        return false;
+    }
+
+    core::tools::auto_scope lb([&_journal] { _journal.storage_->close(); });
+
+    int64_t offset = 0;
+    if (!_journal.storage_->write_data_block(block_data, offset))
+    {
+        // the tail can be torn, the next record can't go after it
+        _journal.valid_ = false;
+        return false;
+    }
+
+    ++_journal.records_;
+
+    return true;
+}
+
+template <class container_type_, class entry_type_>
+bool pending_operations::replay_journal(journal& _journal, container_type_& _pendings)
+{
+    archive::storage_mode mode;
+    mode.flags_.read_ = true;
+
+    if (!_journal.storage_->open(mode))
+    {
+        return false;
+    }
+
+    core::tools::auto_scope lbs([&_journal] { _journal.storage_->close(); });
+
+    auto read_record = [&_journal](core::tools::tlvpack& _pack)
+    {
+        core::tools::binary_stream bs_data;
+        return _journal.storage_->read_data_block(-1, bs_data) && _pack.unserialize(bs_data);
+    };
+
+    // the journal of an older pending file is already in the file
+    core::tools::tlvpack pack_start;
+    if (!read_record(pack_start))
+    {
+        return false;
+    }
+
+    const auto tlv_start_type = pack_start.get_item(journal_record_fields::record_type);
+    const auto tlv_generation = pack_start.get_item(journal_record_fields::record_generation);
+    if (!tlv_start_type || static_cast<journal_record>(tlv_start_type->get_value<uint32_t>()) != journal_record::start ||
+        !tlv_generation || tlv_generation->get_value<uint64_t>() != _journal.generation_)
+    {
+        return false;
+    }
+
+    for (;;)
+    {
+        core::tools::tlvpack pack_record;
+        if (!read_record(pack_record))
+        {
+            break;
+        }
+
+        const auto tlv_type = pack_record.get_item(journal_record_fields::record_type);
+        const auto tlv_aimid = pack_record.get_item(journal_record_fields::record_aimid);
+        if (!tlv_type || !tlv_aimid)
+        {
+            break;
+        }
+
+        const auto type = static_cast<journal_record>(tlv_type->get_value<uint32_t>());
+        const auto aimid = tlv_aimid->get_value<std::string>();
+
+        ++_journal.records_;
+
+        if (type == journal_record::drop)
+        {
+            _pendings.erase(aimid);
+            continue;
+        }
+
+        const auto tlv_entry = pack_record.get_item(journal_record_fields::record_entry);
+        if (!tlv_entry)
+        {
+            continue;
+        }
+
+        auto entry = entry_type_::make(tlv_entry->get_value<core::tools::tlvpack>());
+        if (!entry)
+        {
+            continue;
+        }
+
+        auto& entries = _pendings[aimid];
+
+        if (type == journal_record::upsert)
+        {
+            const auto it = std::find_if(entries.begin(), entries.end(), [&entry](const auto& _existing)
+            {
+                return is_same_entry(*_existing, *entry);
+            });
+
+            if (it != entries.end())
+                *it = std::move(entry);
+            else
+                entries.emplace_back(std::move(entry));
+        }
+        else if (type == journal_record::remove)
+        {
+            entries.remove_if([&entry](const auto& _existing)
+            {
+                return is_same_entry(*_existing, *entry);
+            });
+        }
+
+        if (entries.empty())
+            _pendings.erase(aimid);
+    }
+
+    // a torn tail is dropped, the file has to be rewritten before the next record
+    return _journal.storage_->get_last_error() == archive::error::end_of_file;
+}
+
+bool pending_operations::reset_journal(journal& _journal)
+{
+    _journal.records_ = 0;
+    _journal.valid_ = false;
+
+    archive::storage_mode mode;
+    mode.flags_.write_ = true;
+    mode.flags_.truncate_ = true;
+    if (!_journal.storage_->open(mode))
+    {
+        return false;
+    }
+
+    core::tools::auto_scope lb([&_journal] { _journal.storage_->close(); });
+
+    core::tools::tlvpack pack_start;
+    pack_start.push_child(core::tools::tlv(journal_record_fields::record_type, static_cast<uint32_t>(journal_record::start)));
+    pack_start.push_child(core::tools::tlv(journal_record_fields::record_generation, _journal.generation_));
+
+    core::tools::binary_stream block_data;
+    pack_start.serialize(block_data);
+
+    int64_t offset = 0;
+    _journal.valid_ = _journal.storage_->write_data_block(block_data, offset);
+
+    return _journal.valid_;
+}
+
+void pending_operations::journal_sent(journal_record _type, const std::string& _aimid, const not_sent_message* _message)
+{
+    // the whole file is written instead if the journal is too long or can't be appended
+    if (!pending_sent_journal_.valid_ ||
+        pending_sent_journal_.records_ >= journal_compaction_records ||
+        !append_journal(pending_sent_journal_, _type, _aimid, _message))
+    {
+        save_pending_sent_messages();
+    }
+}
+
+void pending_operations::journal_delete(journal_record _type, const std::string& _aimid, const delete_message* _message)
+{
+    if (!pending_delete_journal_.valid_ ||
+        pending_delete_journal_.records_ >= journal_compaction_records ||
+        !append_journal(pending_delete_journal_, _type, _aimid, _message))
+    {
+        save_pending_delete_messages();
+    }
+}
+
 bool pending_operations::save_pending_sent_messages()
 {
-    return save(*pending_sent_storage_, pending_messages_);
+    const auto generation = pending_sent_journal_.generation_ + 1;
+    if (!save(*pending_sent_storage_, pending_messages_, generation))
+    {
+        pending_sent_journal_.valid_ = false;
+        return false;
+    }
+
+    pending_sent_journal_.generation_ = generation;
+
+    return reset_journal(pending_sent_journal_);
 }
 
 bool pending_operations::load_pending_sent_messages()
 {
-    return load<std::map<std::string, not_sent_messages_list>, not_sent_message>(*pending_sent_storage_, pending_messages_);
+    const auto res = load<std::map<std::string, not_sent_messages_list>, not_sent_message>(*pending_sent_storage_, pending_messages_, pending_sent_journal_.generation_);
+
+    // the replayed records are folded into the file right away
+    if (!replay_journal<std::map<std::string, not_sent_messages_list>, not_sent_message>(pending_sent_journal_, pending_messages_) || pending_sent_journal_.records_ > 0)
+        save_pending_sent_messages();
+    else
+        pending_sent_journal_.valid_ = true;
+
+    return res;
 }
 
 bool pending_operations::save_pending_delete_messages()
 {
-    return save(*pending_delete_storage_, pending_delete_messages_);
+    const auto generation = pending_delete_journal_.generation_ + 1;
+    if (!save(*pending_delete_storage_, pending_delete_messages_, generation))
+    {
+        pending_delete_journal_.valid_ = false;
+        return false;
+    }
+
+    pending_delete_journal_.generation_ = generation;
+
+    return reset_journal(pending_delete_journal_);
 }
 
 bool pending_operations::load_pending_delete_messages()
 {
-    return load<std::map<std::string, delete_messages_list>, delete_message>(*pending_delete_storage_, pending_delete_messages_);
+    const auto res = load<std::map<std::string, delete_messages_list>, delete_message>(*pending_delete_storage_, pending_delete_messages_, pending_delete_journal_.generation_);
+
+    if (!replay_journal<std::map<std::string, delete_messages_list>, delete_message>(pending_delete_journal_, pending_delete_messages_) || pending_delete_journal_.records_ > 0)
+        save_pending_delete_messages();
+    else
+        pending_delete_journal_.valid_ = true;
+
+    return res;
 }
 
+
+#ifdef CORE_TESTS
+bool core::archive::check_pending_journal(std::string& _error)
+{
+    const auto base_path = core::tools::system::create_temp_file_path();
+    if (base_path.empty())
+    {
+        _error = "no temp directory";
+        return false;
+    }
+
+    const auto file_sent = base_path + L".sent";
+    const auto file_delete = base_path + L".delete";
+
+    core::tools::auto_scope remove_files([&file_sent, &file_delete]
+    {
+        for (const auto& file : { file_sent, file_delete, file_sent + L".journal", file_delete + L".journal" })
+        {
+            boost::system::error_code e;
+            boost::filesystem::remove(file, e);
+        }
+    });
+
+    const std::string aimid = "journal@check";
+    const auto count = journal_compaction_records * 2 + 10;
+
+    const auto internal_id = [](size_t _index)
+    {
+        return "journal-check-" + std::to_string(_index);
+    };
+
+    {
+        pending_operations ops(file_sent, file_delete);
+
+        for (size_t i = 0; i < count; ++i)
+            ops.insert_message(aimid, not_sent_message::make(aimid, "check", message_type::base, 1, internal_id(i)));
+
+        // every other message is removed, some of the removals fold the journal into the file
+        for (size_t i = 0; i < count; i += 2)
+            ops.remove(internal_id(i));
+
+        for (size_t i = 0; i < count; ++i)
+            ops.insert_deleted_message(aimid, delete_message(aimid, int64_t(i + 1), std::string(), delete_operation::del_for_me));
+    }
+
+    {
+        pending_operations ops(file_sent, file_delete);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (bool(ops.get_message_by_internal_id(internal_id(i))) != (i % 2 != 0))
+            {
+                _error = "pending message " + internal_id(i) + (i % 2 ? " is lost" : " is restored after removal");
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::string contact;
+            delete_message message;
+            if (!ops.get_first_pending_delete_message(contact, message))
+            {
+                _error = "pending delete " + std::to_string(i + 1) + " is lost";
+                return false;
+            }
+
+            ops.remove_deleted_message(contact, message);
+        }
+
+        for (size_t i = 1; i < count; i += 2)
+            ops.remove(internal_id(i));
+    }
+
+    pending_operations ops(file_sent, file_delete);
+
+    std::string contact;
+    delete_message message;
+    if (ops.exist_message(aimid) || ops.get_first_pending_delete_message(contact, message))
+    {
+        _error = "removed pendings are restored";
+        return false;
+    }
+
+    return true;
+}
+#endif
@@ -264,8 +264,43 @@ namespace core
 
             std::unique_ptr<storage> pending_delete_storage_;
 
+            // the changes made since the pending file was saved, appended record by record.
+            // a journal starts with the generation of the file it continues,
+            // so the records already in a newer file aren't replayed after a crash
+            struct journal
+            {
+                std::unique_ptr<storage> storage_;
+                uint64_t generation_ = 0;
+                size_t records_ = 0;
+                bool valid_ = false;
+
+                journal(std::wstring _file_name);
+            };
+
+            journal pending_sent_journal_;
+            journal pending_delete_journal_;
+
             bool is_loaded_;
 
+            enum class journal_record
+            {
+                start = 0,
+                upsert = 1,
+                remove = 2,
+                drop = 3
+            };
+
+            template <class entry_type_>
+            bool append_journal(journal& _journal, journal_record _type, const std::string& _aimid, const entry_type_* _entry);
+
+            template <class container_type_, class entry_type_>
+            bool replay_journal(journal& _journal, container_type_& _pendings);
+
+            bool reset_journal(journal& _journal);
+
+            void journal_sent(journal_record _type, const std::string& _aimid, const not_sent_message* _message = nullptr);
+            void journal_delete(journal_record _type, const std::string& _aimid, const delete_message* _message = nullptr);
+
         public:
             pending_operations(
                 const std::wstring& _file_pending_sent,
@@ -305,10 +340,10 @@ namespace core
             bool get_first_pending_delete_message(std::string& _contact, delete_message& _message) const;
 
             template <class container_type_>
-            bool save(storage& _storage, const container_type_& _pendings) const;
+            bool save(storage& _storage, const container_type_& _pendings, uint64_t _generation) const;
 
             template <class container_type_, class entry_type_>
-            bool load(storage& _storage, container_type_& _pendings);
+            bool load(storage& _storage, container_type_& _pendings, uint64_t& _generation);
 
             bool save_pending_sent_messages();
             bool load_pending_sent_messages();
@@ -316,5 +351,11 @@ namespace core
             bool load_pending_delete_messages();
         };
 
+#ifdef CORE_TESTS
+        // a self-check of the journal on the files in the temp directory, built for coretest only.
+        // the changes cross the compaction threshold and are compared after a reload
+        bool check_pending_journal(std::string& _error);
+#endif
+
     }
 }
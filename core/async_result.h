@@ -0,0 +1,147 @@
+#pragma once
+
+#include "tools/small_function.h"
+#include "core.h"
+
+namespace core
+{
+    // a result of a task running on a background thread, shared between the task and the caller.
+    // the task calls set() once, the caller subscribes with then(); whichever comes second schedules the callback,
+    // so it doesn't matter if the task is done before the caller gets the result.
+    // the callback runs on the core thread or on the given executer and is dropped if the result is cancelled
+    template<typename... Args>
+    class async_result : public std::enable_shared_from_this<async_result<Args...>>
+    {
+    public:
+
+        using callback_type = tools::small_function<void(const Args&...)>;
+
+        async_result() = default;
+
+        async_result(const async_result&) = delete;
+        async_result& operator=(const async_result&) = delete;
+
+        // runs _callback on the core thread
+        void then(callback_type _callback)
+        {
+            subscribe(std::move(_callback), std::weak_ptr<void>(), nullptr);
+        }
+
+        // runs _callback on _executer, it's dropped if _executer is gone by then.
+        // _executer is anything with push_back(std::function<void()>), i.e. async_executer or a threadpool
+        template<typename Executer>
+        void then(const std::shared_ptr<Executer>& _executer, callback_type _callback)
+        {
+            assert(_executer);
+
+            subscribe(std::move(_callback), _executer, [](const std::shared_ptr<void>& _ex, std::function<void()> _task)
+            {
+                static_cast<Executer*>(_ex.get())->push_back(std::move(_task));
+            });
+        }
+
+        template<typename... Values>
+        void set(Values&&... _values)
+        {
+            std::unique_lock lock(mutex_);
+
+            assert(!values_);
+            if (cancelled_ || values_)
+                return;
+
+            values_.emplace(std::forward<Values>(_values)...);
+
+            if (callback_)
+            {
+                lock.unlock();
+                schedule();
+            }
+        }
+
+        // the callback won't be called, the task may stop early if it checks is_cancelled()
+        void cancel()
+        {
+            callback_type callback;
+
+            {
+                std::scoped_lock lock(mutex_);
+                cancelled_ = true;
+                callback = std::move(callback_);
+            }
+        }
+
+        bool is_cancelled() const
+        {
+            std::scoped_lock lock(mutex_);
+            return cancelled_;
+        }
+
+    private:
+
+        using post_function = void (*)(const std::shared_ptr<void>& _executer, std::function<void()> _task);
+
+        void subscribe(callback_type _callback, std::weak_ptr<void> _executer, post_function _post)
+        {
+            std::unique_lock lock(mutex_);
+
+            assert(!callback_);
+            if (cancelled_)
+                return;
+
+            callback_ = std::move(_callback);
+            executer_ = std::move(_executer);
+            post_ = _post;
+
+            if (values_)
+            {
+                lock.unlock();
+                schedule();
+            }
+        }
+
+        void schedule()
+        {
+            auto task = [self = this->shared_from_this()]
+            {
+                self->invoke();
+            };
+
+            if (!post_)
+            {
+                g_core->execute_core_context(std::move(task));
+                return;
+            }
+
+            if (auto executer = executer_.lock())
+                post_(executer, std::move(task));
+        }
+
+        void invoke()
+        {
+            callback_type callback;
+
+            {
+                std::scoped_lock lock(mutex_);
+                if (cancelled_)
+                    return;
+
+                callback = std::move(callback_);
+            }
+
+            // values_ isn't changed after set()
+            std::apply(callback, *values_);
+        }
+
+        mutable std::mutex mutex_;
+
+        std::optional<std::tuple<Args...>> values_;
+        callback_type callback_;
+        bool cancelled_ = false;
+
+        std::weak_ptr<void> executer_;
+        post_function post_ = nullptr;
+    };
+
+    template<typename... Args>
+    using async_result_sptr = std::shared_ptr<async_result<Args...>>;
+}
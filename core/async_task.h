@@ -5,6 +5,7 @@
 
 #include "tools/threadpool.h"
 #include "core.h"
+#include "async_result.h"
 
 namespace core
 {
@@ -70,6 +71,8 @@ namespace core
         explicit async_executer(const std::string_view _name, size_t _count = 1);
         virtual ~async_executer();
 
+        using core::tools::threadpool::push_back;
+
         virtual std::shared_ptr<async_task_handlers> run_async_task(std::shared_ptr<async_task> task);
 
         virtual std::shared_ptr<async_task_handlers> run_async_function(std::function<int32_t()> func);
@@ -92,6 +95,21 @@ namespace core
 
             return handler;
         }
+
+        // _func gets the result to set, it isn't called if the result is cancelled before the task starts
+        template<typename... Args, typename F>
+        std::shared_ptr<async_result<Args...>> run_async_result(F&& _func)
+        {
+            auto result = std::make_shared<async_result<Args...>>();
+
+            push_back([f = std::forward<F>(_func), result]
+            {
+                if (!result->is_cancelled())
+                    f(*result);
+            });
+
+            return result;
+        }
     };
 
     using async_executer_uptr = std::unique_ptr<async_executer>;
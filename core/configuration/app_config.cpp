@@ -205,6 +205,9 @@ pt::ptree app_config::as_ptree() const
         case app_config::AppConfigOption::curl_log:
             result.add(option_name(key), is_curl_log_enabled());
             break;
+        case app_config::AppConfigOption::net_log_compression:
+            result.add(option_name(key), is_net_log_compression_enabled());
+            break;
         case app_config::AppConfigOption::url_base:
             result.add(option_name(key), get_url_base());
             break;
@@ -272,6 +275,13 @@ bool app_config::is_curl_log_enabled() const
         : boost::any_cast<bool>(it->second);
 }
 
+bool app_config::is_net_log_compression_enabled() const
+{
+    auto it = app_config_options_.find(app_config::AppConfigOption::net_log_compression);
+    return it == app_config_options_.end() ? false
+        : boost::any_cast<bool>(it->second);
+}
+
 bool app_config::is_show_msg_ids_enabled() const
 {
     auto it = app_config_options_.find(app_config::AppConfigOption::show_msg_ids);
@@ -469,6 +479,7 @@ void app_config::serialize(Out core::coll_helper &_collection) const
     _collection.set<std::string>(option_name(app_config::AppConfigOption::dev_id), device_id());
     _collection.set<uint32_t>(option_name(app_config::AppConfigOption::update_interval), update_interval());
     _collection.set<bool>(option_name(app_config::AppConfigOption::curl_log), is_curl_log_enabled());
+    _collection.set<bool>(option_name(app_config::AppConfigOption::net_log_compression), is_net_log_compression_enabled());
 
     // urls
     _collection.set<std::string>(option_name(app_config::AppConfigOption::url_base), get_url_base());
@@ -636,6 +647,10 @@ namespace
                 app_config::AppConfigOption::curl_log,
                 property_tree_.get<bool>(option_name(app_config::AppConfigOption::curl_log), false)
             },
+            {
+                app_config::AppConfigOption::net_log_compression,
+                property_tree_.get<bool>(option_name(app_config::AppConfigOption::net_log_compression), false)
+            },
             {
                 app_config::AppConfigOption::url_base,
                 property_tree_.get<std::string>(option_name(app_config::AppConfigOption::url_base), std::string(get_default_app_url(app_url_type::base)))
@@ -717,6 +732,8 @@ namespace
             return "update_interval";
         case app_config::AppConfigOption::curl_log:
             return "curl_log";
+        case app_config::AppConfigOption::net_log_compression:
+            return "dev.compress_net_log";
         case app_config::AppConfigOption::url_base:
             return "urls.url_base";
         case app_config::AppConfigOption::url_files:
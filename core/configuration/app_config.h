@@ -28,6 +28,7 @@ public:
         dev_id = 14,
         update_interval = 15,
         curl_log = 16,
+        net_log_compression = 17,
         // urls
         url_base = 100,
         url_files = 101,
@@ -60,6 +61,7 @@ public:
     bool is_testing_enabled() const;
     bool is_full_log_enabled() const;
     bool is_curl_log_enabled() const;
+    bool is_net_log_compression_enabled() const;
     bool is_show_msg_ids_enabled() const;
     bool is_server_history_enabled() const;
     bool is_server_search_enabled() const;
@@ -405,6 +405,7 @@ namespace core
 
         virtual void set_played(const std::string& url, bool played) = 0;
         virtual void speech_to_text(int64_t _seq, const std::string& _url, const std::string& _locale) = 0;
+        virtual void set_file_sharing_waveform(const std::string& _url, const std::string& _waveform) = 0;
 
         // search for contacts
         virtual void search_contacts_server(int64_t _seq, const std::string_view _keyword, const std::string_view _phone) = 0;
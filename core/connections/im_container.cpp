@@ -17,6 +17,7 @@
 #include "../utils.h"
 #include "../archive/contact_archive.h"
 #include "../archive/history_message.h"
+#include "../archive/not_sent_messages.h"
 #include "../statistics.h"
 #include "../proxy_settings.h"
 
@@ -70,6 +71,9 @@ im_container::im_container(const std::shared_ptr<voip_manager::VoipManager>& voi
     REGISTER_IM_MESSAGE("archive/log/model", on_archive_log_model);
     REGISTER_IM_MESSAGE("messages/context/get", on_get_message_context);
     REGISTER_IM_MESSAGE("archive/make/holes", on_make_archive_holes);
+#ifdef CORE_TESTS
+    REGISTER_IM_MESSAGE("archive/check/pending_journal", on_check_pending_journal);
+#endif
     REGISTER_IM_MESSAGE("archive/invalidate/message_data", on_invalidate_archive_data);
 
     REGISTER_IM_MESSAGE("dialogs/search/local", on_dialogs_search_local);
@@ -145,6 +149,7 @@ im_container::im_container(const std::shared_ptr<voip_manager::VoipManager>& voi
 
     REGISTER_IM_MESSAGE("files/set_url_played", on_url_played);
     REGISTER_IM_MESSAGE("files/speech_to_text", on_speech_to_text);
+    REGISTER_IM_MESSAGE("files/set_waveform", on_set_file_sharing_waveform);
     REGISTER_IM_MESSAGE("favorite", on_favorite);
     REGISTER_IM_MESSAGE("unfavorite", on_unfavorite);
     REGISTER_IM_MESSAGE("update_profile", on_update_profile);
@@ -1223,6 +1228,15 @@ void core::im_container::on_speech_to_text(int64_t _seq, coll_helper& _params)
     im->speech_to_text(_seq, _params.get_value_as_string("url"), _params.get_value_as_string("locale"));
 }
 
+void core::im_container::on_set_file_sharing_waveform(int64_t _seq, coll_helper& _params)
+{
+    auto im = get_im(_params);
+    if (!im)
+        return;
+
+    im->set_file_sharing_waveform(_params.get_value_as_string("url"), _params.get_value_as_string("waveform"));
+}
+
 std::shared_ptr<base_im> core::im_container::get_im(coll_helper& _params) const
 {
     // temporary, for many im
@@ -2594,6 +2608,20 @@ void im_container::on_make_archive_holes(const int64_t _seq, coll_helper& _param
     im->make_archive_holes(_seq, _params.get_value_as_string("archive"));
 }
 
+#ifdef CORE_TESTS
+void im_container::on_check_pending_journal(const int64_t _seq, coll_helper& _params)
+{
+    std::string error;
+    const auto passed = archive::check_pending_journal(error);
+
+    coll_helper cl_coll(g_core->create_collection(), true);
+    cl_coll.set_value_as_bool("passed", passed);
+    cl_coll.set_value_as_string("error", error);
+
+    g_core->post_message_to_gui("archive/check/pending_journal/result", _seq, cl_coll.get());
+}
+#endif
+
 void im_container::on_invalidate_archive_data(const int64_t _seq, coll_helper& _params)
 {
     if (auto im = get_im(_params); im)
@@ -135,6 +135,7 @@ namespace core
         void on_report_contact(int64_t _seq, coll_helper& _params);
         void on_url_played(int64_t _seq, coll_helper& _params);
         void on_speech_to_text(int64_t _seq, coll_helper& _params);
+        void on_set_file_sharing_waveform(int64_t _seq, coll_helper& _params);
         void on_ignore_contact(int64_t _seq, coll_helper& _params);
         void on_get_ignore_contacts(int64_t _seq, coll_helper& _params);
         void on_favorite(int64_t _seq, coll_helper& _params);
@@ -225,6 +226,9 @@ namespace core
         void on_get_ram_usage(const int64_t _seq, coll_helper& _params);
 
         void on_make_archive_holes(const int64_t _seq, coll_helper& _params);
+#ifdef CORE_TESTS
+        void on_check_pending_journal(const int64_t _seq, coll_helper& _params);
+#endif
         void on_invalidate_archive_data(const int64_t _seq, coll_helper& _params);
 
         void on_ui_activity(const int64_t _seq, coll_helper& _params);
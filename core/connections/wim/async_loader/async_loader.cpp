@@ -698,6 +698,34 @@ std::wstring core::wim::async_loader::get_meta_path(const std::string& _url, con
 }
 
 void core::wim::async_loader::save_filesharing_local_path(const std::wstring& _meta_path, const std::string& _url, const std::wstring& _path)
+{
+    update_filesharing_meta(_meta_path, _url, [&_path](file_sharing_meta& _meta)
+    {
+        if (!_path.empty())
+        {
+            const boost::filesystem::wpath path(_path);
+            boost::system::error_code e;
+            auto last_modified = boost::filesystem::last_write_time(path, e);
+            _meta.local_path_ = tools::from_utf16(_path);
+            _meta.last_modified_ = last_modified;
+        }
+        else
+        {
+            _meta.local_path_.clear();
+            _meta.last_modified_ = 0;
+        }
+    });
+}
+
+void core::wim::async_loader::save_filesharing_waveform(const std::wstring& _meta_path, const std::string& _url, const std::string& _waveform)
+{
+    update_filesharing_meta(_meta_path, _url, [&_waveform](file_sharing_meta& _meta)
+    {
+        _meta.waveform_ = _waveform;
+    });
+}
+
+void core::wim::async_loader::update_filesharing_meta(const std::wstring& _meta_path, const std::string& _url, const std::function<void(file_sharing_meta&)>& _update)
 {
     core::tools::binary_stream json_file;
 
@@ -718,19 +746,7 @@ void core::wim::async_loader::save_filesharing_local_path(const std::wstring& _m
             auto meta_info = file_sharing_meta::parse_json(json.data(), _url);
             if (meta_info)
             {
-                if (!_path.empty())
-                {
-                    const boost::filesystem::wpath path(_path);
-                    boost::system::error_code e;
-                    auto last_modified = boost::filesystem::last_write_time(path, e);
-                    meta_info->local_path_ = tools::from_utf16(_path);
-                    meta_info->last_modified_ = last_modified;
-                }
-                else
-                {
-                    meta_info->local_path_.clear();
-                    meta_info->last_modified_ = 0;
-                }
+                _update(*meta_info);
 
                 rapidjson::Document doc(rapidjson::Type::kObjectType);
                 meta_info->serialize(doc, doc.GetAllocator());
@@ -77,7 +77,12 @@ namespace core
 
             void save_filesharing_local_path(const std::string& _url, const std::wstring& _path);
 
+            static void save_filesharing_waveform(const std::wstring& _meta_path, const std::string& _url, const std::string& _waveform);
+
         private:
+            // rewrites the cached metainfo of _url, does nothing if there is none
+            static void update_filesharing_meta(const std::wstring& _meta_path, const std::string& _url, const std::function<void(file_sharing_meta&)>& _update);
+
             void download_file_sharing_impl(std::string _url, wim_packet_params _wim_params, downloadable_file_chunks_ptr _file_chunks, std::string_view _normalized_url = {});
 
             static void update_file_chunks(downloadable_file_chunks& _file_chunks, priority_t _new_priority, file_info_handler_t _additional_handlers);
@@ -37,6 +37,8 @@ void core::wim::file_sharing_meta::serialize(rapidjson::Value& _node, rapidjson_
     node_file.AddMember("duration", duration_, _a);
     node_file.AddMember("language", language_, _a);
     node_file.AddMember("got_audio", got_audio_, _a);
+    if (!waveform_.empty())
+        node_file.AddMember("waveform", waveform_, _a);
 
     node_flist.PushBack(std::move(node_file), _a);
     _node.AddMember("file_list", std::move(node_flist), _a);
@@ -91,6 +93,7 @@ core::wim::file_sharing_meta_uptr core::wim::file_sharing_meta::parse_json(InOut
         meta->duration_ = 0;
 
     tools::unserialize_value(*iter_flist0, "got_audio", meta->got_audio_);
+    tools::unserialize_value(*iter_flist0, "waveform", meta->waveform_);
 
     if (!tools::unserialize_value(*iter_flist0, "static800", meta->file_full_preview_url_))
         if (!tools::unserialize_value(*iter_flist0, "static600", meta->file_full_preview_url_))
@@ -28,6 +28,7 @@ namespace core
             uint64_t        last_modified_;
             std::string     local_path_;
             std::string     language_;
+            std::string     waveform_; // ptt only, base64 of the peaks computed by gui, not sent by the server
 
             void serialize(rapidjson::Value& _node, rapidjson_allocator& _a) const;
 
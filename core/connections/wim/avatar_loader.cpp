@@ -15,6 +15,22 @@
 using namespace core;
 using namespace wim;
 
+namespace
+{
+    // the server has no batch request for avatars, a few of them are loaded at once instead
+    constexpr size_t max_parallel_requests = 4;
+
+    // the avatars not shown for so many requests are off the screen already
+    constexpr size_t max_queued_tasks = 200;
+
+    constexpr std::chrono::minutes missing_avatar_timeout(10);
+
+    bool need_full_load(const avatar_context& _context)
+    {
+        return _context.force_ || !_context.avatar_exist_;
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // avatar_task
 //////////////////////////////////////////////////////////////////////////
@@ -22,20 +38,32 @@ avatar_task::avatar_task(
     int64_t _task_id,
     const std::shared_ptr<avatar_context>& _context,
     const std::shared_ptr<avatar_load_handlers>& _handlers)
-    : context_(_context),
-    handlers_(_handlers),
-    task_id_(_task_id)
+    : requests_({ { _context, _handlers } }),
+    task_id_(_task_id),
+    priority_(0),
+    full_load_(need_full_load(*_context)),
+    in_progress_(false)
 {
 }
 
 std::shared_ptr<avatar_context> avatar_task::get_context() const
 {
-    return context_;
+    return requests_.front().context_;
 }
 
-std::shared_ptr<avatar_load_handlers> avatar_task::get_handlers() const
+const std::vector<avatar_request>& avatar_task::get_requests() const
 {
-    return handlers_;
+    return requests_;
+}
+
+void avatar_task::add_request(const std::shared_ptr<avatar_context>& _context, const std::shared_ptr<avatar_load_handlers>& _handlers)
+{
+    assert(!in_progress_ || full_load_ || !need_full_load(*_context));
+
+    requests_.push_back({ _context, _handlers });
+
+    if (need_full_load(*_context))
+        full_load_ = true;
 }
 
 int64_t avatar_task::get_id() const
@@ -43,16 +71,42 @@ int64_t avatar_task::get_id() const
     return task_id_;
 }
 
+uint64_t avatar_task::get_priority() const
+{
+    return priority_;
+}
+
+void avatar_task::set_priority(uint64_t _priority)
+{
+    priority_ = _priority;
+}
+
+bool avatar_task::is_full_load() const
+{
+    return full_load_;
+}
+
+bool avatar_task::is_in_progress() const
+{
+    return in_progress_;
+}
+
+void avatar_task::set_in_progress(bool _in_progress)
+{
+    in_progress_ = _in_progress;
+}
+
 
 
 
 //////////////////////////////////////////////////////////////////////////
 avatar_loader::avatar_loader()
     : task_id_(0)
-    , working_(false)
+    , priority_(0)
+    , tasks_in_progress_(0)
     , network_error_(false)
     , local_thread_(std::make_shared<async_executer>("avl_local"))
-    , server_thread_(std::make_shared<async_executer>("avl_server"))
+    , server_thread_(std::make_shared<async_executer>("avl_server", max_parallel_requests))
 {
 }
 
@@ -120,9 +174,19 @@ bool load_avatar_from_file(std::shared_ptr<avatar_context> _context)
 }
 
 
+std::string avatar_loader::get_task_key(std::string_view _contact, std::string_view _avatar_type)
+{
+    std::string key;
+    key.reserve(_contact.size() + _avatar_type.size() + 1);
+    key += _contact;
+    key += '/';
+    key += _avatar_type;
+    return key;
+}
+
 void avatar_loader::execute_task(std::shared_ptr<avatar_task> _task, std::function<void(int32_t)> _on_complete)
 {
-    time_t write_time = _task->get_context()->avatar_exist_ ? _task->get_context()->write_time_ : 0;
+    time_t write_time = _task->is_full_load() ? 0 : _task->get_context()->write_time_;
 
     if (!wim_params_)
     {
@@ -157,10 +221,8 @@ void avatar_loader::execute_task(std::shared_ptr<avatar_task> _task, std::functi
                 if (size == 0)
                     return wpie_error_empty_avatar_data;
 
-                _task->get_context()->avatar_data_.write(avatar_data->read(size), size);
-                avatar_data->reset_out();
-
                 avatar_data->save_2_file(_task->get_context()->avatar_file_path_);
+                avatar_data->reset_out();
                 return 0;
 
             })->on_result_ = [avatar_data, wr_this, _on_complete, _task](int32_t _error)
@@ -169,16 +231,26 @@ void avatar_loader::execute_task(std::shared_ptr<avatar_task> _task, std::functi
                 if (!ptr_this)
                     return;
 
-                if (_error == 0)
+                const auto size = avatar_data->available();
+                const char* data = size ? avatar_data->read(size) : nullptr;
+
+                for (const auto& request : _task->get_requests())
                 {
-                    if (_task->get_context()->avatar_exist_)
-                        _task->get_handlers()->updated_(_task->get_context());
+                    if (_error == 0)
+                    {
+                        // every request gets its own copy, the handlers consume the data
+                        request.context_->avatar_data_.reset();
+                        request.context_->avatar_data_.write(data, size);
+
+                        if (request.context_->avatar_exist_)
+                            request.handlers_->updated_(request.context_);
+                        else
+                            request.handlers_->completed_(request.context_);
+                    }
                     else
-                        _task->get_handlers()->completed_(_task->get_context());
-                }
-                else
-                {
-                    _task->get_handlers()->failed_(_task->get_context(), _error);
+                    {
+                        request.handlers_->failed_(request.context_, _error);
+                    }
                 }
 
                 _on_complete(_error);
@@ -186,14 +258,11 @@ void avatar_loader::execute_task(std::shared_ptr<avatar_task> _task, std::functi
         }
         else
         {
-            if (_task->get_context()->avatar_exist_)
+            // the requests with a local avatar keep it, the server answers 304 if it is up to date
+            for (const auto& request : _task->get_requests())
             {
-                long http_error = packet->get_http_code();
-                if (http_error == 304) {}
-            }
-            else
-            {
-                _task->get_handlers()->failed_(_task->get_context(), _error);
+                if (!request.context_->avatar_exist_)
+                    request.handlers_->failed_(request.context_, _error);
             }
 
             _on_complete(_error);
@@ -205,51 +274,110 @@ void avatar_loader::execute_task(std::shared_ptr<avatar_task> _task, std::functi
 
 void avatar_loader::run_tasks_loop()
 {
-    working_ = true;
-
-    assert(!network_error_);
+    auto wr_this = weak_from_this();
 
-    auto task = get_next_task();
-    if (!task)
+    while (!network_error_ && tasks_in_progress_ < int32_t(max_parallel_requests))
     {
-        working_ =  false;
-        return;
+        auto task = get_next_task();
+        if (!task)
+            return;
+
+        task->set_in_progress(true);
+        ++tasks_in_progress_;
+
+        execute_task(task, [wr_this, task](int32_t _error)
+        {
+            auto ptr_this = wr_this.lock();
+            if (!ptr_this)
+                return;
+
+            ptr_this->on_task_completed(task, _error);
+        });
     }
+}
 
-    auto wr_this = weak_from_this();
+void avatar_loader::on_task_completed(const std::shared_ptr<avatar_task>& _task, int32_t _error)
+{
+    --tasks_in_progress_;
+    assert(tasks_in_progress_ >= 0);
 
+    _task->set_in_progress(false);
 
-    execute_task(task, [wr_this, task](int32_t _error)
+    if (_error == wim_protocol_internal_error::wpie_network_error)
     {
-        auto ptr_this = wr_this.lock();
-        if (!ptr_this)
-            return;
+        // retried on resume
+        network_error_ = true;
+        add_task(_task);
 
-        if (_error == wim_protocol_internal_error::wpie_network_error)
-        {
-            ptr_this->network_error_ = true;
-            ptr_this->working_ = false;
+        return;
+    }
 
-            return;
-        }
+    const auto key = get_task_key(_task->get_context()->contact_, _task->get_context()->avatar_type_);
 
-        ptr_this->remove_task(task);
-        ptr_this->run_tasks_loop();
-    });
+    if (_error == wim_protocol_internal_error::wpie_client_http_error)
+        missing_avatars_[key] = std::chrono::steady_clock::now();
+    else if (_error == 0)
+        missing_avatars_.erase(key);
+
+    remove_task(_task);
+    run_tasks_loop();
 }
 
+void avatar_loader::remove_task(const std::shared_ptr<avatar_task>& _task)
+{
+    if (_task->get_priority())
+        requests_queue_.erase(_task->get_priority());
+
+    // a newer task could take the key while this one was running
+    const auto ctx = _task->get_context();
+    if (const auto it = tasks_.find(get_task_key(ctx->contact_, ctx->avatar_type_)); it != tasks_.end() && it->second == _task)
+        tasks_.erase(it);
+}
 
-void avatar_loader::remove_task(std::shared_ptr<avatar_task> _task)
+void avatar_loader::add_task(const std::shared_ptr<avatar_task>& _task)
 {
-    requests_queue_.remove_if([_task](const std::shared_ptr<avatar_task>& _current_task)->bool
-    {
-        return (_current_task->get_id() == _task->get_id());
-    });
+    _task->set_priority(++priority_);
+    requests_queue_.emplace(_task->get_priority(), _task);
+
+    cancel_stale_tasks();
 }
 
-void avatar_loader::add_task(std::shared_ptr<avatar_task> _task)
+void avatar_loader::raise_task(const std::shared_ptr<avatar_task>& _task)
 {
-    requests_queue_.push_front(_task);
+    if (_task->is_in_progress())
+        return;
+
+    requests_queue_.erase(_task->get_priority());
+    _task->set_priority(++priority_);
+    requests_queue_.emplace(_task->get_priority(), _task);
+}
+
+void avatar_loader::cancel_stale_tasks()
+{
+    auto iter = requests_queue_.begin();
+    while (requests_queue_.size() > max_queued_tasks && iter != requests_queue_.end())
+    {
+        auto task = iter->second;
+
+        // the forced requests come from a user action and are never stale
+        const auto& requests = task->get_requests();
+        if (std::any_of(requests.begin(), requests.end(), [](const avatar_request& _r) { return _r.context_->force_; }))
+        {
+            ++iter;
+            continue;
+        }
+
+        iter = requests_queue_.erase(iter);
+        task->set_priority(0);
+        remove_task(task);
+
+        // the requests with a local avatar have got it already
+        for (const auto& request : requests)
+        {
+            if (!request.context_->avatar_exist_)
+                request.handlers_->failed_(request.context_, wim_protocol_internal_error::wpie_error_request_canceled);
+        }
+    }
 }
 
 std::shared_ptr<avatar_task> avatar_loader::get_next_task()
@@ -259,21 +387,56 @@ std::shared_ptr<avatar_task> avatar_loader::get_next_task()
         return std::shared_ptr<avatar_task>();
     }
 
-    return requests_queue_.front();
+    const auto last = std::prev(requests_queue_.end());
+    auto task = std::move(last->second);
+
+    requests_queue_.erase(last);
+    task->set_priority(0);
+
+    return task;
+}
+
+bool avatar_loader::is_avatar_missing(const std::string& _key)
+{
+    const auto it = missing_avatars_.find(_key);
+    if (it == missing_avatars_.end())
+        return false;
+
+    if (std::chrono::steady_clock::now() - it->second < missing_avatar_timeout)
+        return true;
+
+    missing_avatars_.erase(it);
+    return false;
 }
 
 void avatar_loader::load_avatar_from_server(
     const std::shared_ptr<avatar_context>& _context,
     const std::shared_ptr<avatar_load_handlers>& _handlers)
 {
-    add_task(std::make_shared<avatar_task>(++task_id_, _context, _handlers));
+    auto key = get_task_key(_context->contact_, _context->avatar_type_);
+
+    if (!_context->force_ && is_avatar_missing(key))
+    {
+        if (!_context->avatar_exist_)
+            _handlers->failed_(_context, wim_protocol_internal_error::wpie_client_http_error);
+
+        return;
+    }
 
-    if (!working_ && !network_error_)
+    // a running task can't take a request that needs the full avatar if it asked for the modified one only
+    if (const auto it = tasks_.find(key); it != tasks_.end() && (!it->second->is_in_progress() || it->second->is_full_load() || !need_full_load(*_context)))
+    {
+        it->second->add_request(_context, _handlers);
+        raise_task(it->second);
+    }
+    else
     {
-        run_tasks_loop();
+        auto task = std::make_shared<avatar_task>(++task_id_, _context, _handlers);
+        tasks_[std::move(key)] = task;
+        add_task(task);
     }
 
-    return;
+    run_tasks_loop();
 }
 
 std::shared_ptr<avatar_load_handlers> avatar_loader::get_contact_avatar_async(const wim_packet_params& _params, std::shared_ptr<avatar_context> _context)
@@ -346,26 +509,11 @@ void avatar_loader::resume(const wim_packet_params& _params)
 
     network_error_ = false;
 
-    assert(!working_);
-    if (!working_)
-    {
-        run_tasks_loop();
-    }
+    run_tasks_loop();
 }
 
 void avatar_loader::show_contact_avatar(const std::string& _contact, const int32_t _avatar_size)
 {
-    for (auto iter = requests_queue_.begin(); iter != requests_queue_.end(); ++iter)
-    {
-        if (const auto ctx = (*iter)->get_context(); ctx->avatar_size_ == _avatar_size && ctx->contact_ == _contact)
-        {
-            auto task = *iter;
-
-            requests_queue_.erase(iter);
-
-            requests_queue_.push_back(std::move(task));
-
-            break;
-        }
-    }
+    if (const auto it = tasks_.find(get_task_key(_contact, get_avatar_type_by_size(_avatar_size))); it != tasks_.end())
+        raise_task(it->second);
 }
@@ -46,20 +46,43 @@ namespace core
             std::function<void(std::shared_ptr<avatar_context>, int32_t)> failed_;
         };
 
-        class avatar_task
+        struct avatar_request
         {
             std::shared_ptr<avatar_context> context_;
             std::shared_ptr<avatar_load_handlers> handlers_;
+        };
+
+        // one server request for a contact and avatar type, serves all the gui requests for them
+        class avatar_task
+        {
+            std::vector<avatar_request> requests_;
 
             int64_t task_id_;
 
+            // the position in the queue, the most recently shown avatars have the greatest
+            uint64_t priority_;
+
+            // the avatar is loaded even if the local file is up to date
+            bool full_load_;
+            bool in_progress_;
+
         public:
 
+            // the context of the first request, it sets the contact, the type and the file
             std::shared_ptr<avatar_context> get_context() const;
-            std::shared_ptr<avatar_load_handlers> get_handlers() const;
+            const std::vector<avatar_request>& get_requests() const;
+            void add_request(const std::shared_ptr<avatar_context>& _context, const std::shared_ptr<avatar_load_handlers>& _handlers);
 
             int64_t get_id() const;
 
+            uint64_t get_priority() const;
+            void set_priority(uint64_t _priority);
+
+            bool is_full_load() const;
+
+            bool is_in_progress() const;
+            void set_in_progress(bool _in_progress);
+
             avatar_task(
                 int64_t task_id_,
                 const std::shared_ptr<avatar_context>& _context,
@@ -69,8 +92,9 @@ namespace core
         class avatar_loader : public std::enable_shared_from_this<avatar_loader>
         {
             int64_t task_id_;
+            uint64_t priority_;
 
-            bool working_;
+            int32_t tasks_in_progress_;
             bool network_error_;
 
             std::shared_ptr<wim_packet_params> wim_params_;
@@ -78,16 +102,27 @@ namespace core
             std::shared_ptr<async_executer> local_thread_;
             std::shared_ptr<async_executer> server_thread_;
 
-            std::list<std::shared_ptr<avatar_task>> failed_tasks_;
+            // the waiting tasks by priority, the next one is the last
+            std::map<uint64_t, std::shared_ptr<avatar_task>> requests_queue_;
+
+            // the waiting and running tasks by contact and avatar type
+            std::unordered_map<std::string, std::shared_ptr<avatar_task>> tasks_;
 
-            std::list<std::shared_ptr<avatar_task>> requests_queue_;
+            // the contacts the server has no avatar for, by contact and avatar type, with the time of the answer
+            std::unordered_map<std::string, std::chrono::steady_clock::time_point> missing_avatars_;
 
-            void remove_task(std::shared_ptr<avatar_task> _task);
-            void add_task(std::shared_ptr<avatar_task> _task);
+            void remove_task(const std::shared_ptr<avatar_task>& _task);
+            void add_task(const std::shared_ptr<avatar_task>& _task);
+            void raise_task(const std::shared_ptr<avatar_task>& _task);
+            void cancel_stale_tasks();
             std::shared_ptr<avatar_task> get_next_task();
             void execute_task(std::shared_ptr<avatar_task> _task, std::function<void(int32_t)> _on_complete);
+            void on_task_completed(const std::shared_ptr<avatar_task>& _task, int32_t _error);
             void run_tasks_loop();
 
+            bool is_avatar_missing(const std::string& _key);
+            static std::string get_task_key(std::string_view _contact, std::string_view _avatar_type);
+
             std::wstring get_avatar_path(const std::wstring& _avatars_data_path, std::string_view _contact, std::string_view _avatar_type = {}) const;
             std::string get_avatar_type_by_size(int32_t _size) const;
 
@@ -59,23 +59,11 @@ int32_t send_feedback::init_request(std::shared_ptr<core::http_request_simple> _
                 }
             }
 
-            // capture log file data
-            boost::system::error_code e;
-            auto logTmp = logPath.parent_path().append(L"feedbacklog.processing.tmp");
-            boost::filesystem::copy_file(logPath, logTmp, boost::filesystem::copy_option::overwrite_if_exists, e);
-            const long sizeTmp = boost::filesystem::file_size(logTmp, e);
-            std::ifstream ifs(logTmp.string(), std::ios::binary);
-            const long amountToRead = ((sizeTmp - sizeLeft) < 0 ? sizeTmp : sizeLeft);
+            // capture log file data, a compressed one is unpacked
+            auto data = read_network_log_tail(logPath, sizeLeft);
+            const long amountToRead = (long)data.size();
             if (amountToRead > 0)
-            {
-                std::vector<char> data;
-                data.resize(amountToRead);
-                ifs.seekg(-((std::fstream::off_type)amountToRead), std::ios::end);
-                ifs.read(&data[0], amountToRead);
-                logChunks.push(data);
-            }
-            ifs.close();
-            boost::filesystem::remove(logTmp, e);
+                logChunks.push(std::move(data));
 
             // recalc max possible size of data to send
             sizeLeft -= amountToRead;
@@ -188,6 +188,9 @@ namespace
     constexpr auto robusto_rate_limit_timeout = std::chrono::seconds(10);
     constexpr auto dlg_state_agregate_start_timeout = std::chrono::minutes(3);
     constexpr auto dlg_state_agregate_period = std::chrono::minutes(1);
+    constexpr auto dlg_state_agregate_timer_period = std::chrono::milliseconds(100);
+    // the dlg states posted within a frame go to gui in one message
+    constexpr auto dlg_state_coalesce_period = std::chrono::milliseconds(16);
     constexpr int32_t max_fetch_events_count = 20;
     constexpr int32_t msg_context_size = 200;
     constexpr auto send_stat_interval = std::chrono::hours(24);
@@ -439,13 +442,13 @@ void core::wim::wim_send_thread::clear()
 // end send_thread class
 //////////////////////////////////////////////////////////////////////////
 
-std::shared_ptr<async_task_handlers> remove_messages_from_not_sent(
+std::shared_ptr<archive::task_handler> remove_messages_from_not_sent(
     const std::shared_ptr<archive::face>& _archive,
     const std::string& _contact,
     const bool _remove_if_modified,
     const std::shared_ptr<archive::history_block>& _messages);
 
-std::shared_ptr<async_task_handlers> remove_messages_from_not_sent(
+std::shared_ptr<archive::task_handler> remove_messages_from_not_sent(
     const std::shared_ptr<archive::face>& _archive,
     const std::string& _contact,
     const bool _remove_if_modified,
@@ -455,6 +458,11 @@ std::shared_ptr<async_task_handlers> remove_messages_from_not_sent(
 constexpr size_t search_threads_count = 3;
 constexpr auto sending_search_results_interval = std::chrono::milliseconds(500);
 
+static bool is_history_search_done(const search::search_data& _data) noexcept
+{
+    return _data.free_threads_count_ == search_threads_count && _data.pending_batches_ == 0;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // im class
 //////////////////////////////////////////////////////////////////////////
@@ -1449,7 +1457,7 @@ void post_sticker_fail_2_gui(int64_t _seq, int32_t _set_id, int32_t _sticker_id,
 }
 
 
-void post_sticker_2_gui(int64_t _seq, int32_t _set_id, int32_t _sticker_id, std::string_view _fs_id, core::sticker_size _size, tools::binary_stream& _data)
+void post_sticker_2_gui(int64_t _seq, int32_t _set_id, int32_t _sticker_id, std::string_view _fs_id, core::sticker_size _size, const std::wstring& _path)
 {
     assert(_size > sticker_size::min);
     assert(_size < sticker_size::max);
@@ -1462,40 +1470,37 @@ void post_sticker_2_gui(int64_t _seq, int32_t _set_id, int32_t _sticker_id, std:
     coll.set_value_as_string("fs_id", _fs_id);
     coll.set_value_as_int("error", 0);
 
-    const auto write_data =
-        [&coll](tools::binary_stream &_data, std::string_view id)
+    // gui maps the stored file and decodes it on demand
+    const auto write_path =
+        [&coll](const std::wstring& _path, std::string_view id)
     {
-        if (_data.available() == 0)
+        if (_path.empty())
         {
             return;
         }
 
-        ifptr<istream> sticker_data(coll->create_stream(), true);
-        const auto data_size = _data.available();
-        sticker_data->write((const uint8_t*)_data.read(data_size), data_size);
-
-        coll.set_value_as_stream(id, sticker_data.get());
+        coll.set_value_as_string(id, tools::from_utf16(_path));
     };
 
     if (_size == sticker_size::small)
     {
-        write_data(_data, "data/small");
+        write_path(_path, "path/small");
     }
     else if (_size == sticker_size::medium)
     {
-        write_data(_data, "data/medium");
+        write_path(_path, "path/medium");
     }
     else if (_size == sticker_size::large)
     {
-        write_data(_data, "data/large");
+        write_path(_path, "path/large");
     }
     else if (_size == sticker_size::xlarge)
     {
-        write_data(_data, "data/xlarge");
+        write_path(_path, "path/xlarge");
     }
     else if (_size == sticker_size::xxlarge)
     {
-        write_data(_data, "data/xxlarge");
+        write_path(_path, "path/xxlarge");
     }
 
     g_core->post_message_to_gui("stickers/sticker/get/result", _seq, coll.get());
@@ -1664,14 +1669,14 @@ void im::load_cached_objects()
                                     ptr_this->post_dlg_state_to_gui(dlg_aimid, false, true, false, true);
                                 }
 
-                                ptr_this->get_archive()->get_gallery_state(dlg_aimid)->on_result = [wr_this, dlg_aimid](const archive::gallery_state& _state)
+                                ptr_this->get_archive()->get_gallery_state(dlg_aimid)->then([wr_this, dlg_aimid](const archive::gallery_state& _state)
                                 {
                                     auto ptr_this = wr_this.lock();
                                     if (!ptr_this)
                                         return;
 
                                     ptr_this->post_gallery_state_to_gui(dlg_aimid, _state);
-                                };
+                                });
                             });
 
                             ptr_this->post_ignorelist_to_gui(0);
@@ -2147,10 +2152,10 @@ void im::download_stickers(const bool _recursive)
                                 set_id,
                                 sticker_id,
                                 fs_id,
-                                sz)->on_result_ = [_requests, set_id, sticker_id, fs_id, sz](tools::binary_stream& _data)
+                                sz)->on_result_ = [_requests, set_id, sticker_id, fs_id, sz](const std::wstring& _path)
                             {
                                 for (auto seq : _requests)
-                                    post_sticker_2_gui(seq, set_id, sticker_id, fs_id, sz, _data);
+                                    post_sticker_2_gui(seq, set_id, sticker_id, fs_id, sz, _path);
                             };
                         }
                     }
@@ -2174,15 +2179,15 @@ void im::get_sticker(const int64_t _seq, const int32_t _set_id, const int32_t _s
     assert(_size < sticker_size::max);
 
     get_stickers()->get_sticker(_seq, _set_id, _sticker_id, std::string(_fs_id), _size)->on_result_ =
-        [_seq, _set_id, _sticker_id, fs_id = std::string(_fs_id), _size, wr_this = weak_from_this()](tools::binary_stream& _sticker_data)
+        [_seq, _set_id, _sticker_id, fs_id = std::string(_fs_id), _size, wr_this = weak_from_this()](const std::wstring& _sticker_path)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
             return;
 
-        if (_sticker_data.available())
+        if (!_sticker_path.empty())
         {
-            post_sticker_2_gui(_seq, _set_id, _sticker_id, fs_id, _size, _sticker_data);
+            post_sticker_2_gui(_seq, _set_id, _sticker_id, fs_id, _size, _sticker_path);
 
             return;
         }
@@ -2953,7 +2958,7 @@ void im::post_pending_messages(const bool _recurcive)
     }
 
     // get first pending message from queue
-    get_archive()->get_pending_message()->on_result = [wr_this](archive::not_sent_message_sptr _message)
+    get_archive()->get_pending_message()->then([wr_this](archive::not_sent_message_sptr _message)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -2988,7 +2993,7 @@ void im::post_pending_messages(const bool _recurcive)
             return;
         }
 
-        ptr_this->get_archive()->update_message_post_time(_message->get_internal_id(), current_time)->on_result_ = [wr_this, _message](int32_t _error)
+        ptr_this->get_archive()->update_message_post_time(_message->get_internal_id(), current_time)->then([wr_this, _message](int32_t _error)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -3009,8 +3014,8 @@ void im::post_pending_messages(const bool _recurcive)
                     ptr_this->sent_pending_messages_active_ = false;
                 }
             };
-        };
-    };
+        });
+    });
 }
 
 
@@ -3292,7 +3297,7 @@ void im::send_stat_if_needed()
 
 void im::download_gallery_holes(const std::string& _aimid)
 {
-    get_archive()->get_gallery_state(_aimid)->on_result = [wr_this = weak_from_this(), _aimid](const archive::gallery_state& _local_state)
+    get_archive()->get_gallery_state(_aimid)->then([wr_this = weak_from_this(), _aimid](const archive::gallery_state& _local_state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -3311,7 +3316,7 @@ void im::download_gallery_holes(const std::string& _aimid)
                     return;
 
                 auto new_gallery = packet->get_gallery();
-                ptr_this->get_archive()->merge_gallery_from_server(_aimid, new_gallery, archive::gallery_entry_id(), archive::gallery_entry_id())->on_result = [wr_this, _aimid, new_gallery](const std::vector<archive::gallery_item>& _changes)
+                ptr_this->get_archive()->merge_gallery_from_server(_aimid, new_gallery, archive::gallery_entry_id(), archive::gallery_entry_id())->then([wr_this, _aimid, new_gallery](const std::vector<archive::gallery_item>& _changes)
                 {
                     auto ptr_this = wr_this.lock();
                     if (!ptr_this)
@@ -3344,7 +3349,7 @@ void im::download_gallery_holes(const std::string& _aimid)
                     }
 
                     auto state = new_gallery.get_gallery_state();
-                    ptr_this->get_archive()->set_gallery_state(_aimid, state, true)->on_result_ = [wr_this, _aimid, state](int32_t _error)
+                    ptr_this->get_archive()->set_gallery_state(_aimid, state, true)->then([wr_this, _aimid, state](int32_t _error)
                     {
                         auto ptr_this = wr_this.lock();
                         if (!ptr_this)
@@ -3352,13 +3357,13 @@ void im::download_gallery_holes(const std::string& _aimid)
 
                         ptr_this->post_gallery_state_to_gui(_aimid, state);
                         ptr_this->download_gallery_holes(_aimid);
-                    };
-                };
+                    });
+                });
             };
             return;
         }
 
-        ptr_this->get_archive()->get_gallery_holes(_aimid)->on_result = [_aimid, _local_state, wr_this](bool _result, const archive::gallery_entry_id& _from, const archive::gallery_entry_id& _till)
+        ptr_this->get_archive()->get_gallery_holes(_aimid)->then([_aimid, _local_state, wr_this](bool _result, const archive::gallery_entry_id& _from, const archive::gallery_entry_id& _till)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -3382,7 +3387,7 @@ void im::download_gallery_holes(const std::string& _aimid)
                 if (_error == 0)
                 {
                     auto gallery = packet->get_gallery();
-                    ptr_this->get_archive()->merge_gallery_from_server(_aimid, gallery, _from, _till)->on_result = [wr_this, _aimid, _local_state, _till, gallery](const std::vector<archive::gallery_item>& _changes)
+                    ptr_this->get_archive()->merge_gallery_from_server(_aimid, gallery, _from, _till)->then([wr_this, _aimid, _local_state, _till, gallery](const std::vector<archive::gallery_item>& _changes)
                     {
                         auto ptr_this = wr_this.lock();
                         if (!ptr_this)
@@ -3416,7 +3421,7 @@ void im::download_gallery_holes(const std::string& _aimid)
                         if (!_local_state.first_entry_.valid())
                         {
                             auto new_state = gallery.get_gallery_state();
-                            ptr_this->get_archive()->set_gallery_state(_aimid, new_state, true)->on_result_ = [wr_this, _aimid, new_state](int32_t _error)
+                            ptr_this->get_archive()->set_gallery_state(_aimid, new_state, true)->then([wr_this, _aimid, new_state](int32_t _error)
                             {
                                 auto ptr_this = wr_this.lock();
                                 if (!ptr_this)
@@ -3427,26 +3432,26 @@ void im::download_gallery_holes(const std::string& _aimid)
                                 coll_helper coll(g_core->create_collection(), true);
                                 coll.set_value_as_string("aimid", _aimid);
                                 g_core->post_message_to_gui("dialog/gallery/init", 0, coll.get());
-                            };
+                            });
                         }
 
-                        ptr_this->get_archive()->clear_hole_request(_aimid)->on_result_ = [_aimid, wr_this](int32_t _error)
+                        ptr_this->get_archive()->clear_hole_request(_aimid)->then([_aimid, wr_this](int32_t _error)
                         {
                             auto ptr_this = wr_this.lock();
                             if (!ptr_this)
                                 return;
 
                             ptr_this->download_gallery_holes(_aimid);
-                        };
-                    };
+                        });
+                    });
                 }
                 else
                 {
                     ptr_this->get_archive()->clear_hole_request(_aimid);
                 }
             };
-        };
-    };
+        });
+    });
 }
 
 void im::dispatch_events(std::shared_ptr<fetch> _fetch_packet, std::function<void(int32_t)> _on_complete)
@@ -3895,7 +3900,7 @@ void im::on_event_buddies_list(fetch_event_buddy_list* _event, std::shared_ptr<a
     {
         insert_friendly(contact_list->get_persons(), friendly_source::remote);
 
-        get_archive()->sync_with_history()->on_result_ = [contact_list, wr_this = weak_from_this(), _on_complete](int32_t _error)
+        get_archive()->sync_with_history()->then([contact_list, wr_this = weak_from_this(), _on_complete](int32_t _error)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -3931,7 +3936,7 @@ void im::on_event_buddies_list(fetch_event_buddy_list* _event, std::shared_ptr<a
                 ptr_this->load_contact_list()->on_result_ = update_cl;
             else
                 update_cl(0);
-        };
+        });
     }
 }
 
@@ -3941,7 +3946,7 @@ void im::on_event_diff(fetch_event_diff* _event, std::shared_ptr<auto_callback>
 
     insert_friendly(_event->get_persons(), core::friendly_source::remote);
 
-    get_archive()->sync_with_history()->on_result_ = [diff = std::move(diff), wr_this = weak_from_this(), _on_complete](int32_t _error)
+    get_archive()->sync_with_history()->then([diff = std::move(diff), wr_this = weak_from_this(), _on_complete](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -3960,12 +3965,12 @@ void im::on_event_diff(fetch_event_diff* _event, std::shared_ptr<auto_callback>
                 ptr_this->active_dialogs_->remove(contact);
                 ptr_this->unfavorite(contact);
 
-                ptr_this->get_archive()->clear_dlg_state(contact)->on_result_ = [contact](int32_t _err)
+                ptr_this->get_archive()->clear_dlg_state(contact)->then([contact](int32_t _err)
                 {
                     coll_helper cl_coll(g_core->create_collection(), true);
                     cl_coll.set_value_as_string("contact", contact);
                     g_core->post_message_to_gui("active_dialogs_hide", 0, cl_coll.get());
-                };
+                });
             }
 
             ifptr<icollection> cl_coll(g_core->create_collection(), true);
@@ -3976,7 +3981,7 @@ void im::on_event_diff(fetch_event_diff* _event, std::shared_ptr<auto_callback>
         on_created_groupchat(diff);
 
         _on_complete->callback(_error);
-    };
+    });
 }
 
 void im::on_created_groupchat(std::shared_ptr<diffs_map> _diff)
@@ -4307,7 +4312,7 @@ void im::get_archive_messages(int64_t _seq, const std::string& _contact, int64_t
             if (skip_hist_request())
                 return;
 
-            ptr_this->get_archive()->get_dlg_state(_contact)->on_result = [wr_this, _contact](const archive::dlg_state& _state)
+            ptr_this->get_archive()->get_dlg_state(_contact)->then([wr_this, _contact](const archive::dlg_state& _state)
             {
                 auto ptr_this = wr_this.lock();
                 if (!ptr_this)
@@ -4322,7 +4327,7 @@ void im::get_archive_messages(int64_t _seq, const std::string& _contact, int64_t
 
                     ptr_this->download_holes(_contact);
                 };
-            };
+            });
         };
 }
 
@@ -4385,8 +4390,7 @@ std::shared_ptr<async_task_handlers> im::get_archive_messages_get_messages(
 
     /// const auto count_with_prefetch = _count_early + (_need_prefetch ? PREFETCH_COUNT : 0);
 
-    get_archive()->get_messages(_contact, _from, _count_early, _count_later)->on_result =
-        [_seq, wr_this = weak_from_this(), _contact, _count_early, _count_later, _first_request, auto_handler, _from, _after_search]
+    get_archive()->get_messages(_contact, _from, _count_early, _count_later)->then([_seq, wr_this = weak_from_this(), _contact, _count_early, _count_later, _first_request, auto_handler, _from, _after_search]
         (std::shared_ptr<archive::history_block> _messages, archive::first_load _first_load, std::shared_ptr<archive::error_vector> _errors)
         {
             auto ptr_this = wr_this.lock();
@@ -4401,8 +4405,7 @@ std::shared_ptr<async_task_handlers> im::get_archive_messages_get_messages(
             else
                 ptr_this->process_postponed_for_update_dialog(_contact);
 
-            ptr_this->get_archive()->get_dlg_state(_contact)->on_result =
-                [_seq, wr_this, _contact, _first_request, _messages, _from, _count_later, _count_early, _after_search, auto_handler]
+            ptr_this->get_archive()->get_dlg_state(_contact)->then([_seq, wr_this, _contact, _first_request, _messages, _from, _count_later, _count_early, _after_search, auto_handler]
             (const archive::dlg_state& _state)
             {
                 auto ptr_this = wr_this.lock();
@@ -4459,8 +4462,7 @@ std::shared_ptr<async_task_handlers> im::get_archive_messages_get_messages(
 
                     if (_first_request || _from == -1)
                     {
-                        ptr_this->get_archive()->get_not_sent_messages(_contact)->on_result =
-                            [wr_this, _contact, as, coll, auto_handler]
+                        ptr_this->get_archive()->get_not_sent_messages(_contact)->then([wr_this, _contact, as, coll, auto_handler]
                         (std::shared_ptr<archive::history_block> _pending_messages, archive::first_load, std::shared_ptr<archive::error_vector>)
                         {
                             auto ptr_this = wr_this.lock();
@@ -4475,7 +4477,7 @@ std::shared_ptr<async_task_handlers> im::get_archive_messages_get_messages(
                                     coll.get(),
                                     ptr_this->auth_params_->time_offset_);
                             }
-                        }; // get_not_sent_messages
+                        }); // get_not_sent_messages
                     }
                 }
                 else
@@ -4502,8 +4504,8 @@ std::shared_ptr<async_task_handlers> im::get_archive_messages_get_messages(
                         }
                     };
                 }
-            }; // get_dlg_state
-        }; // get_messages
+            }); // get_dlg_state
+        }); // get_messages
 
     return out_handler;
 }
@@ -4514,7 +4516,7 @@ void im::get_archive_messages_buddies(int64_t _seq, const std::string& _contact,
 
     auto wr_this = weak_from_this();
 
-    get_archive()->get_messages_buddies(_contact, _ids)->on_result = [_seq, wr_this, _contact, _ids, _is_updated_messages](std::shared_ptr<archive::history_block> _messages, archive::first_load _first_load, std::shared_ptr<archive::error_vector> _errors)
+    get_archive()->get_messages_buddies(_contact, _ids)->then([_seq, wr_this, _contact, _ids, _is_updated_messages](std::shared_ptr<archive::history_block> _messages, archive::first_load _first_load, std::shared_ptr<archive::error_vector> _errors)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -4532,7 +4534,7 @@ void im::get_archive_messages_buddies(int64_t _seq, const std::string& _contact,
         if (!local_persons.empty())
             ptr_this->insert_friendly(local_persons, core::friendly_source::local, friendly_add_mode::insert);
 
-        ptr_this->get_archive()->get_dlg_state(_contact)->on_result = [_seq, wr_this, _contact, _ids, _messages, _is_updated_messages](const archive::dlg_state& _state)
+        ptr_this->get_archive()->get_dlg_state(_contact)->then([_seq, wr_this, _contact, _ids, _messages, _is_updated_messages](const archive::dlg_state& _state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -4548,13 +4550,13 @@ void im::get_archive_messages_buddies(int64_t _seq, const std::string& _contact,
             coll.set<std::string>("my_aimid", ptr_this->auth_params_->aimid_);
             coll.set_value_as_bool("updated", is_updated_messages::yes == _is_updated_messages);
             g_core->post_message_to_gui("archive/buddies/get/result", _seq, coll.get());
-        };
-    };
+        });
+    });
 }
 
 void im::get_messages_for_update(const std::string& _contact)
 {
-    get_archive()->get_messages_for_update(_contact)->on_result = [wr_this = weak_from_this(), _contact](std::shared_ptr<std::vector<int64_t>> _ids)
+    get_archive()->get_messages_for_update(_contact)->then([wr_this = weak_from_this(), _contact](std::shared_ptr<std::vector<int64_t>> _ids)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -4562,7 +4564,7 @@ void im::get_messages_for_update(const std::string& _contact)
 
         if (!(_ids->empty()))
         {
-            ptr_this->get_archive()->get_dlg_state(_contact)->on_result = [wr_this, _ids, _contact](const archive::dlg_state& _state)
+            ptr_this->get_archive()->get_dlg_state(_contact)->then([wr_this, _ids, _contact](const archive::dlg_state& _state)
             {
                 auto ptr_this = wr_this.lock();
                 if (!ptr_this)
@@ -4577,14 +4579,14 @@ void im::get_messages_for_update(const std::string& _contact)
                         ptr_this->failed_update_messages_.insert(_contact);
                     }
                 };
-            };
+            });
         }
-    };
+    });
 }
 
 void im::get_mentions(int64_t _seq, std::string_view _contact)
 {
-    get_archive()->get_mentions(_contact)->on_result = [_seq, wr_this = weak_from_this(), _contact = std::string(_contact)](std::shared_ptr<archive::history_block> _messages, archive::first_load _first_load)
+    get_archive()->get_mentions(_contact)->then([_seq, wr_this = weak_from_this(), _contact = std::string(_contact)](std::shared_ptr<archive::history_block> _messages, archive::first_load _first_load)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -4593,7 +4595,7 @@ void im::get_mentions(int64_t _seq, std::string_view _contact)
         if (_first_load == archive::first_load::yes)
             ptr_this->add_postponed_for_update_dialog(_contact);
 
-        ptr_this->get_archive()->get_dlg_state(_contact)->on_result = [_seq, wr_this, _contact, _messages](const archive::dlg_state& _state)
+        ptr_this->get_archive()->get_dlg_state(_contact)->then([_seq, wr_this, _contact, _messages](const archive::dlg_state& _state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -4615,8 +4617,8 @@ void im::get_mentions(int64_t _seq, std::string_view _contact)
             coll.set_value_as_int64("last_msg_in_index", _state.get_last_msgid());
             serialize_messages_4_gui("messages", _messages, coll.get(), ptr_this->auth_params_->time_offset_);
             g_core->post_message_to_gui("archive/mentions/get/result", _seq, coll.get());
-        };
-    };
+        });
+    });
 }
 
 std::shared_ptr<async_task_handlers> im::get_history_from_server(const get_history_params& _params)
@@ -4670,8 +4672,7 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server(const get_histo
             contact % new_dlg_state->get_history_patch_version().as_string() % messages->size());
 
 
-        ptr_this->get_archive()->get_dlg_state(contact)->on_result =
-            [wr_this, contact, messages, init, from_deleted, from_editing, from_search, new_dlg_state, on_result, unpin, from_msgid, has_older_msgid, seq](const archive::dlg_state& _local_state)
+        ptr_this->get_archive()->get_dlg_state(contact)->then([wr_this, contact, messages, init, from_deleted, from_editing, from_search, new_dlg_state, on_result, unpin, from_msgid, has_older_msgid, seq](const archive::dlg_state& _local_state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -4706,8 +4707,7 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server(const get_histo
                  new_dlg_state->get_pinned_message().get_msgid() != _local_state.get_pinned_message().get_msgid() ||
                  new_dlg_state->get_pinned_message().get_update_patch_version() > _local_state.get_pinned_message().get_update_patch_version();
 
-            ptr_this->get_archive()->set_dlg_state(contact, *new_dlg_state)->on_result =
-                [wr_this, contact, messages, init, from_deleted, from_editing, from_search, is_tail, on_result, pin_changed, from_msgid, has_older_msgid, seq]
+            ptr_this->get_archive()->set_dlg_state(contact, *new_dlg_state)->then([wr_this, contact, messages, init, from_deleted, from_editing, from_search, is_tail, on_result, pin_changed, from_msgid, has_older_msgid, seq]
                 (const archive::dlg_state& _state, const archive::dlg_state_changes& _changes)
             {
                 auto ptr_this = wr_this.lock();
@@ -4716,7 +4716,7 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server(const get_histo
 
                 if (std::any_of(messages->cbegin(), messages->cend(), [](const auto& x) { return x->is_patch() && x->is_clear(); }))
                 {
-                    ptr_this->get_archive()->drop_history(contact)->on_result_ = [wr_this, contact](int32_t _error)
+                    ptr_this->get_archive()->drop_history(contact)->then([wr_this, contact](int32_t _error)
                     {
                         auto ptr_this = wr_this.lock();
                         if (!ptr_this)
@@ -4729,20 +4729,18 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server(const get_histo
 
                         if (ptr_this->has_opened_dialogs(contact))
                             ptr_this->download_holes(contact);
-                    };
+                    });
                     return;
                 }
 
-                remove_messages_from_not_sent(ptr_this->get_archive(), contact, false, messages)->on_result_ =
-                    [wr_this, contact, messages, init, from_deleted, from_editing, from_search, is_tail, on_result, seq, _state, _changes, pin_changed, from_msgid, has_older_msgid]
+                remove_messages_from_not_sent(ptr_this->get_archive(), contact, false, messages)->then([wr_this, contact, messages, init, from_deleted, from_editing, from_search, is_tail, on_result, seq, _state, _changes, pin_changed, from_msgid, has_older_msgid]
                     (int32_t _error)
                 {
                     auto ptr_this = wr_this.lock();
                     if (!ptr_this)
                         return;
 
-                    ptr_this->get_archive()->update_history(contact, messages, from_editing ? -1 : from_msgid, has_older_msgid ? archive::local_history::has_older_message_id::yes : archive::local_history::has_older_message_id::no)->on_result =
-                        [wr_this, contact, on_result, _changes, messages, pin_changed, _state, from_deleted, from_editing, from_search, init, is_tail, seq]
+                    ptr_this->get_archive()->update_history(contact, messages, from_editing ? -1 : from_msgid, has_older_msgid ? archive::local_history::has_older_message_id::yes : archive::local_history::has_older_message_id::no)->then([wr_this, contact, on_result, _changes, messages, pin_changed, _state, from_deleted, from_editing, from_search, init, is_tail, seq]
                         (std::shared_ptr<archive::headers_list> _inserted_messages, const archive::dlg_state&, const archive::dlg_state_changes& _changes_on_update, core::archive::storage::result_type _result)
                     {
                         auto ptr_this = wr_this.lock();
@@ -4834,10 +4832,10 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server(const get_histo
                                 }
                             };
                         }
-                    };
-                }; // remove_messages_from_not_sent
-            }; // set_dlg_state
-        }; //get_dlg_state
+                    });
+                }); // remove_messages_from_not_sent
+            }); // set_dlg_state
+        }); //get_dlg_state
     }; // post_robusto_packet
 
     return out_handler;
@@ -4893,8 +4891,7 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server_batch(get_histo
 
         ptr_this->insert_friendly(packet->get_persons(), friendly_source::remote);
 
-        ptr_this->get_archive()->get_dlg_state(contact)->on_result =
-            [wr_this, contact, messages, new_dlg_state, on_result, unpin, is_context_req, seq, msg_id](const archive::dlg_state& _local_state)
+        ptr_this->get_archive()->get_dlg_state(contact)->then([wr_this, contact, messages, new_dlg_state, on_result, unpin, is_context_req, seq, msg_id](const archive::dlg_state& _local_state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -4913,8 +4910,7 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server_batch(get_histo
                  new_dlg_state->get_pinned_message().get_msgid() != _local_state.get_pinned_message().get_msgid() ||
                  new_dlg_state->get_pinned_message().get_update_patch_version() > _local_state.get_pinned_message().get_update_patch_version();
 
-            ptr_this->get_archive()->set_dlg_state(contact, *new_dlg_state)->on_result =
-                [wr_this, contact, messages, on_result, pin_changed, is_context_req, seq, msg_id]
+            ptr_this->get_archive()->set_dlg_state(contact, *new_dlg_state)->then([wr_this, contact, messages, on_result, pin_changed, is_context_req, seq, msg_id]
             (const archive::dlg_state& _state, const archive::dlg_state_changes& _changes)
             {
                 auto ptr_this = wr_this.lock();
@@ -4923,7 +4919,7 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server_batch(get_histo
 
                 if (std::any_of(messages->cbegin(), messages->cend(), [](const auto& x) { return x->is_patch() && x->is_clear(); }))
                 {
-                    ptr_this->get_archive()->drop_history(contact)->on_result_ = [wr_this, contact](int32_t _error)
+                    ptr_this->get_archive()->drop_history(contact)->then([wr_this, contact](int32_t _error)
                     {
                         auto ptr_this = wr_this.lock();
                         if (!ptr_this)
@@ -4936,20 +4932,18 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server_batch(get_histo
 
                         if (ptr_this->has_opened_dialogs(contact))
                             ptr_this->download_holes(contact);
-                    };
+                    });
                     return;
                 }
 
-                remove_messages_from_not_sent(ptr_this->get_archive(), contact, false, messages)->on_result_ =
-                    [wr_this, contact, messages, on_result, _state, _changes, pin_changed, is_context_req, seq, msg_id]
+                remove_messages_from_not_sent(ptr_this->get_archive(), contact, false, messages)->then([wr_this, contact, messages, on_result, _state, _changes, pin_changed, is_context_req, seq, msg_id]
                 (int32_t _error)
                 {
                     auto ptr_this = wr_this.lock();
                     if (!ptr_this)
                         return;
 
-                    ptr_this->get_archive()->update_history(contact, messages)->on_result =
-                        [wr_this, contact, on_result, _changes, messages, pin_changed, _state, is_context_req, seq, msg_id]
+                    ptr_this->get_archive()->update_history(contact, messages)->then([wr_this, contact, on_result, _changes, messages, pin_changed, _state, is_context_req, seq, msg_id]
                     (std::shared_ptr<archive::headers_list> _inserted_messages, const archive::dlg_state&, const archive::dlg_state_changes& _changes_on_update, core::archive::storage::result_type _result)
                     {
                         auto ptr_this = wr_this.lock();
@@ -4960,8 +4954,7 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server_batch(get_histo
                         {
                             if (is_context_req)
                             {
-                                ptr_this->get_archive()->get_messages(contact, msg_id, msg_context_size / 2, msg_context_size / 2 + 1)->on_result =
-                                    [wr_this, contact, _state, seq](std::shared_ptr<archive::history_block> _hist_block, archive::first_load _first_load, std::shared_ptr<archive::error_vector> _errors)
+                                ptr_this->get_archive()->get_messages(contact, msg_id, msg_context_size / 2, msg_context_size / 2 + 1)->then([wr_this, contact, _state, seq](std::shared_ptr<archive::history_block> _hist_block, archive::first_load _first_load, std::shared_ptr<archive::error_vector> _errors)
                                 {
                                     auto ptr_this = wr_this.lock();
                                     if (!ptr_this)
@@ -4976,7 +4969,7 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server_batch(get_histo
                                     serialize_messages_4_gui("messages", _hist_block, coll.get(), ptr_this->auth_params_->time_offset_);
 
                                     g_core->post_message_to_gui("messages/received/context", seq, coll.get());
-                                };
+                                });
                             }
                             else
                             {
@@ -5056,10 +5049,10 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server_batch(get_histo
                                 }
                             };
                         }
-                    };
-                }; // remove_messages_from_not_sent
-            }; // set_dlg_state
-        }; //get_dlg_state
+                    });
+                }); // remove_messages_from_not_sent
+            }); // set_dlg_state
+        }); //get_dlg_state
     }; // post_robusto_packet
 
     return out_handler;
@@ -5076,15 +5069,14 @@ void im::get_message_context(const int64_t _seq, const std::string& _contact, co
 
     auto wr_this = weak_from_this();
 
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this, _contact, _msgid, _seq]
+    get_archive()->get_dlg_state(_contact)->then([wr_this, _contact, _msgid, _seq]
     (const archive::dlg_state& _state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
             return;
 
-        ptr_this->get_archive()->get_messages(_contact, _msgid, msg_context_size / 2, msg_context_size / 2 + 1)->on_result =
-            [wr_this, _msgid, _contact, _state, _seq](std::shared_ptr<archive::history_block> _hist_block, archive::first_load _first_load, std::shared_ptr<archive::error_vector> _errors)
+        ptr_this->get_archive()->get_messages(_contact, _msgid, msg_context_size / 2, msg_context_size / 2 + 1)->then([wr_this, _msgid, _contact, _state, _seq](std::shared_ptr<archive::history_block> _hist_block, archive::first_load _first_load, std::shared_ptr<archive::error_vector> _errors)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -5180,8 +5172,8 @@ void im::get_message_context(const int64_t _seq, const std::string& _contact, co
             coll.set<std::string>("my_aimid", ptr_this->auth_params_->aimid_);
             serialize_messages_4_gui("messages", it_start, it_end, coll.get(), ptr_this->auth_params_->time_offset_);
             g_core->post_message_to_gui("archive/messages/get/result", _seq, coll.get());
-        };
-    };
+        });
+    });
 }
 
 std::shared_ptr<async_task_handlers> im::set_dlg_state(set_dlg_state_params _params)
@@ -5239,8 +5231,7 @@ void im::download_holes(const std::string& _contact, int64_t _depth)
 
     auto wr_this = weak_from_this();
 
-    get_archive()->get_dlg_state(_contact)->on_result =
-        [wr_this, _contact, _depth](const archive::dlg_state& _state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this, _contact, _depth](const archive::dlg_state& _state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -5249,7 +5240,7 @@ void im::download_holes(const std::string& _contact, int64_t _depth)
             const auto id = _state.has_last_msgid() ? _state.get_last_msgid() : -1;
 
             ptr_this->download_holes(_contact, id, _depth, 0);
-        };
+        });
 }
 
 
@@ -5261,8 +5252,7 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
 
     holes::request hole_request(_contact, _from, _depth, _recursion);
 
-    get_archive()->get_next_hole(_contact, _from, _depth)->on_result =
-        [wr_this, _contact, _depth, _recursion, hole_request](std::shared_ptr<archive::archive_hole> _hole)
+    get_archive()->get_next_hole(_contact, _from, _depth)->then([wr_this, _contact, _depth, _recursion, hole_request](std::shared_ptr<archive::archive_hole> _hole)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -5291,7 +5281,7 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
             return;
         }
 
-        ptr_this->get_archive()->get_dlg_state(_contact)->on_result = [wr_this, _hole, _contact, _depth, _recursion, hole_request](const archive::dlg_state& _state)
+        ptr_this->get_archive()->get_dlg_state(_contact)->then([wr_this, _hole, _contact, _depth, _recursion, hole_request](const archive::dlg_state& _state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -5356,7 +5346,7 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
 
                 if (_error == 0)
                 {
-                    ptr_this->get_archive()->validate_hole_request(_contact, *_hole, count)->on_result = [wr_this, _contact, depth_tail, _recursion](int64_t _from)
+                    ptr_this->get_archive()->validate_hole_request(_contact, *_hole, count)->then([wr_this, _contact, depth_tail, _recursion](int64_t _from)
                     {
                         auto ptr_this = wr_this.lock();
                         if (!ptr_this)
@@ -5366,7 +5356,7 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
 
                         return;
 
-                    }; // validate_hole_request
+                    }); // validate_hole_request
                 }
 
                 if (wim_packet::needs_to_repeat_failed(_error))
@@ -5376,9 +5366,9 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
 
             }; // get_history_from_server
 
-        }; // get_dlg_state
+        }); // get_dlg_state
 
-    }; // get_next_hole
+    }); // get_next_hole
 }
 
 void im::update_active_dialogs(const std::string& _aimid, archive::dlg_state& _state)
@@ -5395,8 +5385,7 @@ std::shared_ptr<async_task_handlers> im::post_dlg_state_to_gui(
 {
     auto handler = std::make_shared<async_task_handlers>();
 
-    get_archive()->get_dlg_state(_contact)->on_result =
-        [wr_this = weak_from_this(), handler, _contact, _add_to_active_dialogs, _serialize_message, _force, _load_from_local]
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), handler, _contact, _add_to_active_dialogs, _serialize_message, _force, _load_from_local]
         (const archive::dlg_state& _state)
         {
             auto ptr_this = wr_this.lock();
@@ -5451,7 +5440,7 @@ std::shared_ptr<async_task_handlers> im::post_dlg_state_to_gui(
 
             if (handler->on_result_)
                 handler->on_result_(0);
-        };
+        });
 
     return handler;
 }
@@ -5461,9 +5450,11 @@ void im::sync_message_with_dlg_state_queue(std::string_view _message, const int6
 {
     check_need_agregate_dlg_state();
 
-    if (dlg_state_agregate_mode_)
+    // the message mustn't outrun the dlg states waiting for the timer
+    if (dlg_state_agregate_mode_ || !cached_dlg_states_.empty())
     {
         gui_messages_queue_.emplace_back(std::string(_message), _seq, _data);
+        start_dlg_state_timer();
     }
     else
     {
@@ -5481,44 +5472,51 @@ void im::check_need_agregate_dlg_state()
 
         agregate_start_time_ = current_time;
     }
+    else if (dlg_state_agregate_mode_ && (current_time - agregate_start_time_) > dlg_state_agregate_period)
+    {
+        dlg_state_agregate_mode_ = false;
+    }
 }
 
 void im::post_dlg_state_to_gui(const std::string& _aimid, core::icollection* _dlg_state)
 {
-    cached_dlg_states_.emplace_back(_aimid, _dlg_state);
+    // only the latest state of a dialog is sent
+    if (const auto it = cached_dlg_states_index_.find(_aimid); it != cached_dlg_states_index_.end())
+    {
+        auto& item = *(it->second);
+        _dlg_state->addref();
+        item.dlg_state_coll_->release();
+        item.dlg_state_coll_ = _dlg_state;
+    }
+    else
+    {
+        cached_dlg_states_.emplace_back(_aimid, _dlg_state);
+        cached_dlg_states_index_.emplace(_aimid, std::prev(cached_dlg_states_.end()));
+    }
 
     check_need_agregate_dlg_state();
 
-    if (dlg_state_agregate_mode_)
-    {
-        if (dlg_state_timer_ == 0)
-        {
-            auto wr_this = weak_from_this();
-
-            dlg_state_timer_ = g_core->add_timer([wr_this]
-            {
-                auto ptr_this = wr_this.lock();
-                if (!ptr_this)
-                    return;
+    start_dlg_state_timer();
+}
 
-                ptr_this->post_queued_objects_to_gui();
+void im::start_dlg_state_timer()
+{
+    if (dlg_state_timer_ != 0)
+        return;
 
-                const auto current_time = std::chrono::system_clock::now();
+    auto wr_this = weak_from_this();
 
-                if (current_time - ptr_this->agregate_start_time_ > dlg_state_agregate_period)
-                {
-                    ptr_this->dlg_state_agregate_mode_ = false;
+    // a one shot, started again by the next dlg state
+    dlg_state_timer_ = g_core->add_timer([wr_this]
+    {
+        auto ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
 
-                    ptr_this->stop_dlg_state_timer();
-                }
+        ptr_this->stop_dlg_state_timer();
+        ptr_this->post_queued_objects_to_gui();
 
-            }, std::chrono::milliseconds(100));
-        }
-    }
-    else
-    {
-        post_queued_objects_to_gui();
-    }
+    }, dlg_state_agregate_mode_ ? dlg_state_agregate_timer_period : dlg_state_coalesce_period);
 }
 
 void im::post_gallery_state_to_gui(const std::string& _aimid, const archive::gallery_state& _gallery_state)
@@ -5577,6 +5575,7 @@ void im::post_cached_dlg_states_to_gui()
     }
 
     cached_dlg_states_.clear();
+    cached_dlg_states_index_.clear();
 
     coll_dlgs.set_value_as_array("dlg_states", dlg_states_array.get());
 
@@ -5585,9 +5584,13 @@ void im::post_cached_dlg_states_to_gui()
 
 void im::remove_from_cached_dlg_states(const std::string& _aimid)
 {
-    cached_dlg_states_.remove_if(
-        [&_aimid](const auto& item) { return item.aimid_ == _aimid; }
-    );
+    const auto it = cached_dlg_states_index_.find(_aimid);
+    if (it == cached_dlg_states_index_.end())
+        return;
+
+    it->second->dlg_state_coll_->release();
+    cached_dlg_states_.erase(it->second);
+    cached_dlg_states_index_.erase(it);
 }
 
 void im::stop_dlg_state_timer()
@@ -5644,6 +5647,11 @@ void im::post_history_search_result_msg_to_gui(const std::string_view _contact,
 
 void im::post_history_search_result_empty()
 {
+    if (search_data_.finished_)
+        return;
+
+    search_data_.finished_ = true;
+
     if (g_core)
     {
         g_core->post_message_to_gui("dialogs/search/local/empty", search_data_.req_id_, nullptr);
@@ -5653,7 +5661,29 @@ void im::post_history_search_result_empty()
     search_data_.reset_post_timer();
 }
 
-std::shared_ptr<async_task_handlers> remove_messages_from_not_sent(
+void im::post_history_search_result_finished()
+{
+    if (!g_core || search_data_.req_id_ < 0 || search_data_.finished_)
+        return;
+
+    search_data_.finished_ = true;
+
+    // the results still waiting for the timer go before the end of the search
+    if (search_data_.search_results_ && !search_data_.search_results_->messages_.empty())
+    {
+        coll_helper coll(g_core->create_collection(), true);
+        search_data_.search_results_->serialize(coll, auth_params_->time_offset_);
+        g_core->post_message_to_gui("dialogs/search/local/result", search_data_.req_id_, coll.get());
+
+        search_data_.search_results_->messages_.clear();
+    }
+
+    g_core->post_message_to_gui("dialogs/search/local/finished", search_data_.req_id_, nullptr);
+
+    search_data_.reset_post_timer();
+}
+
+std::shared_ptr<archive::task_handler> remove_messages_from_not_sent(
     const std::shared_ptr<archive::face>& _archive,
     const std::string& _contact,
     const bool _remove_if_modified,
@@ -5662,7 +5692,7 @@ std::shared_ptr<async_task_handlers> remove_messages_from_not_sent(
     return _archive->remove_messages_from_not_sent(_contact, _remove_if_modified, _messages);
 }
 
-std::shared_ptr<async_task_handlers> remove_messages_from_not_sent(
+std::shared_ptr<archive::task_handler> remove_messages_from_not_sent(
     const std::shared_ptr<archive::face>& _archive,
     const std::string& _contact,
     const bool _remove_if_modified,
@@ -5683,8 +5713,7 @@ void im::on_event_dlg_state(fetch_event_dlg_state* _event, auto_callback_sptr _o
 
     auto wr_this = weak_from_this();
 
-    get_archive()->get_dlg_state(aimid)->on_result =
-        [wr_this, aimid, _on_complete, server_dlg_state, tail_messages, intro_messages]
+    get_archive()->get_dlg_state(aimid)->then([wr_this, aimid, _on_complete, server_dlg_state, tail_messages, intro_messages]
         (const archive::dlg_state& _local_dlg_state)
         {
             auto ptr_this = wr_this.lock();
@@ -5701,7 +5730,7 @@ void im::on_event_dlg_state(fetch_event_dlg_state* _event, auto_callback_sptr _o
                 tail_messages,
                 intro_messages
             );
-        };
+        });
 
     dlg_states_count_++;
 }
@@ -5769,8 +5798,7 @@ void im::on_event_dlg_state_local_state_loaded(
         };
     }
 
-    get_archive()->set_dlg_state(_aimid, _server_dlg_state)->on_result =
-        [wr_this = weak_from_this(), _on_complete, _aimid, _tail_messages, _intro_messages, patch_version_changed, del_up_to_changed, last_msg_id_changed]
+    get_archive()->set_dlg_state(_aimid, _server_dlg_state)->then([wr_this = weak_from_this(), _on_complete, _aimid, _tail_messages, _intro_messages, patch_version_changed, del_up_to_changed, last_msg_id_changed]
         (const archive::dlg_state &_local_dlg_state, const archive::dlg_state_changes&)
         {
             auto ptr_this = wr_this.lock();
@@ -5787,7 +5815,7 @@ void im::on_event_dlg_state_local_state_loaded(
                 del_up_to_changed,
                 last_msg_id_changed
             );
-        };
+        });
 }
 
 void im::on_event_dlg_state_process_messages(
@@ -5895,8 +5923,7 @@ void im::on_event_dlg_state_local_state_updated(
         return;
     }
 
-    remove_messages_from_not_sent(get_archive(), _aimid, false, _tail_messages, _intro_messages)->on_result_ =
-        [wr_this = weak_from_this(), _on_complete, _aimid, _tail_messages, _intro_messages, _local_dlg_state, _patch_version_changed, _del_up_to_changed, _last_msg_id_changed]
+    remove_messages_from_not_sent(get_archive(), _aimid, false, _tail_messages, _intro_messages)->then([wr_this = weak_from_this(), _on_complete, _aimid, _tail_messages, _intro_messages, _local_dlg_state, _patch_version_changed, _del_up_to_changed, _last_msg_id_changed]
         (int32_t _error)
         {
             auto ptr_this = wr_this.lock();
@@ -5923,8 +5950,7 @@ void im::on_event_dlg_state_local_state_updated(
 
             const int64_t last_message_id = _tail_messages->empty() ? _local_dlg_state.get_last_msgid() : _tail_messages->back()->get_msgid();
 
-            ptr_this->get_archive()->update_history(_aimid, _tail_messages)->on_result =
-                [wr_this, _aimid, _local_dlg_state, _on_complete, _patch_version_changed, _del_up_to_changed, _last_msg_id_changed, last_message_id, _tail_messages, _intro_messages]
+            ptr_this->get_archive()->update_history(_aimid, _tail_messages)->then([wr_this, _aimid, _local_dlg_state, _on_complete, _patch_version_changed, _del_up_to_changed, _last_msg_id_changed, last_message_id, _tail_messages, _intro_messages]
                 (archive::headers_list_sptr, const archive::dlg_state&, const archive::dlg_state_changes&, core::archive::storage::result_type _result)
                 {
                     auto ptr_this = wr_this.lock();
@@ -5934,8 +5960,7 @@ void im::on_event_dlg_state_local_state_updated(
                     if (!_result)
                         write_files_error_in_log("update_history", _result.error_code_);
 
-                    ptr_this->get_archive()->update_history(_aimid, _intro_messages)->on_result =
-                    [wr_this, _aimid, _local_dlg_state, _on_complete, _patch_version_changed, _del_up_to_changed, _last_msg_id_changed, last_message_id, _tail_messages, _intro_messages]
+                    ptr_this->get_archive()->update_history(_aimid, _intro_messages)->then([wr_this, _aimid, _local_dlg_state, _on_complete, _patch_version_changed, _del_up_to_changed, _last_msg_id_changed, last_message_id, _tail_messages, _intro_messages]
                             (archive::headers_list_sptr, const archive::dlg_state&, const archive::dlg_state_changes&, core::archive::storage::result_type _result)
                     {
                         auto ptr_this = wr_this.lock();
@@ -5967,9 +5992,9 @@ void im::on_event_dlg_state_local_state_updated(
                             _del_up_to_changed,
                             _last_msg_id_changed
                         );
-                    };
-                };
-        };
+                    });
+                });
+        });
 }
 
 void im::on_event_dlg_state_history_updated(
@@ -5982,8 +6007,7 @@ void im::on_event_dlg_state_history_updated(
     const bool _del_up_to_changed,
     const bool _last_msg_id_changed)
 {
-    get_archive()->has_not_sent_messages(_aimid)->on_result =
-        [wr_this = weak_from_this(), _aimid, _del_up_to_changed, _local_dlg_state, _on_complete, _last_message_id, _count, _patch_version_changed, _last_msg_id_changed]
+    get_archive()->has_not_sent_messages(_aimid)->then([wr_this = weak_from_this(), _aimid, _del_up_to_changed, _local_dlg_state, _on_complete, _last_message_id, _count, _patch_version_changed, _last_msg_id_changed]
         (bool _has_not_sent_messages)
         {
             auto ptr_this = wr_this.lock();
@@ -6019,7 +6043,7 @@ void im::on_event_dlg_state_history_updated(
 
             ptr_this->post_outgoing_count_to_gui(_aimid);
             _on_complete->callback(0);
-        };
+        });
 }
 
 void im::on_event_hidden_chat(fetch_event_hidden_chat* _event, std::shared_ptr<auto_callback> _on_complete)
@@ -6035,8 +6059,7 @@ void im::on_event_hidden_chat(fetch_event_hidden_chat* _event, std::shared_ptr<a
     int64_t last_msg_id = _event->get_last_msg_id();
     std::string aimid = _event->get_aimid();
 
-    get_archive()->get_dlg_state(aimid)->on_result =
-        [wr_this,
+    get_archive()->get_dlg_state(aimid)->then([wr_this,
         aimid,
         last_msg_id,
         _on_complete](const archive::dlg_state& _local_dlg_state)
@@ -6050,8 +6073,7 @@ void im::on_event_hidden_chat(fetch_event_hidden_chat* _event, std::shared_ptr<a
                 archive::dlg_state updated_state = _local_dlg_state;
                 updated_state.set_hidden_msg_id(last_msg_id);
 
-                ptr_this->get_archive()->set_dlg_state(aimid, updated_state)->on_result =
-                    [wr_this, aimid]
+                ptr_this->get_archive()->set_dlg_state(aimid, updated_state)->then([wr_this, aimid]
                 (const archive::dlg_state&, const archive::dlg_state_changes&)
                 {
                     auto ptr_this = wr_this.lock();
@@ -6064,12 +6086,12 @@ void im::on_event_hidden_chat(fetch_event_hidden_chat* _event, std::shared_ptr<a
                     coll_helper cl_coll(g_core->create_collection(), true);
                     cl_coll.set_value_as_string("contact", aimid);
                     g_core->post_message_to_gui("active_dialogs_hide", 0, cl_coll.get());
-                };
+                });
 
             }
 
             _on_complete->callback(0);
-        };
+        });
 }
 
 std::wstring im::get_im_path() const
@@ -6154,8 +6176,7 @@ void im::history_search_one_batch(std::shared_ptr<archive::coded_term> _cterm, s
         contact_and_offsets->push_back(item);
     }
 
-    get_archive()->get_history_block(contact_and_offsets, _thread_archive, data)->on_result =
-        [_cterm, contact_and_offsets, wr_this = weak_from_this(), _seq, _min_id]
+    get_archive()->get_history_block(contact_and_offsets, _thread_archive, data)->then([_cterm, contact_and_offsets, wr_this = weak_from_this(), _seq, _min_id]
             (std::shared_ptr<archive::contact_and_msgs> _archive, std::shared_ptr<archive::contact_and_offsets_v> _remaining, std::shared_ptr<tools::binary_stream> _data)
             {
                 auto ptr_this = wr_this.lock();
@@ -6175,12 +6196,13 @@ void im::history_search_one_batch(std::shared_ptr<archive::coded_term> _cterm, s
                     ptr_this->history_searcher_ = std::make_unique<async_executer>("histSearch", search_threads_count);
 
                 ptr_this->history_searcher_->run_t_async_function<search::found_messages>(
-                    [_cterm, _archive, contact_and_offsets, _min_id, _data]() -> search::found_messages
+                    [_cterm, _archive, contact_and_offsets, _min_id, _data, cancelled = ptr_this->search_data_.cancelled_]() -> search::found_messages
                         {
                             search::found_messages found_messages;
 
-                            if (_archive->size() > 1)
-                                archive::messages_data::search_in_archive(contact_and_offsets, _cterm, _archive, _data, found_messages, _min_id);
+                            // a stale batch queued behind the current search is skipped
+                            if (_archive->size() > 1 && !*cancelled)
+                                archive::messages_data::search_in_archive(contact_and_offsets, _cterm, _archive, _data, found_messages, _min_id, *cancelled);
 
                             return found_messages;
 
@@ -6218,6 +6240,8 @@ void im::history_search_one_batch(std::shared_ptr<archive::coded_term> _cterm, s
                                 ++ptr_this->search_data_.free_threads_count_;
                             }
 
+                            ++ptr_this->search_data_.pending_batches_;
+
                             auto call_on_exit = std::make_shared<tools::auto_scope>([wr_this, _seq, _cterm]()
                             {
                                 g_core->execute_core_context([wr_this, _seq, _cterm]()
@@ -6226,7 +6250,11 @@ void im::history_search_one_batch(std::shared_ptr<archive::coded_term> _cterm, s
                                     if (!ptr_this)
                                         return;
 
-                                    if (ptr_this->search_data_.free_threads_count_ == search_threads_count
+                                    // the counter of a replaced search is already reset
+                                    if (ptr_this->search_data_.check_req(_seq))
+                                        --ptr_this->search_data_.pending_batches_;
+
+                                    if (is_history_search_done(ptr_this->search_data_)
                                             || (std::chrono::system_clock::now() > ptr_this->search_data_.last_send_time_ + sending_search_results_interval))
                                     {
                                         ptr_this->search_data_.not_sent_msgs_count_ = ptr_this->search_data_.top_messages_.size();
@@ -6247,7 +6275,7 @@ void im::history_search_one_batch(std::shared_ptr<archive::coded_term> _cterm, s
                                             {
                                                 ptr_this->search_data_.top_messages_ids_.erase(item->get_msgid());
 
-                                                if (ptr_this->search_data_.free_threads_count_ == search_threads_count
+                                                if (is_history_search_done(ptr_this->search_data_)
                                                         && ptr_this->search_data_.not_sent_msgs_count_ == 0
                                                         && ptr_this->search_data_.sent_msgs_count_ == 0)
                                                 {
@@ -6267,8 +6295,13 @@ void im::history_search_one_batch(std::shared_ptr<archive::coded_term> _cterm, s
                                         ptr_this->search_data_.last_send_time_ = std::chrono::system_clock::now();
                                     }
 
-                                    if (ptr_this->search_data_.free_threads_count_ == search_threads_count && ptr_this->search_data_.top_messages_ids_.empty())
-                                        ptr_this->post_history_search_result_empty();
+                                    if (ptr_this->search_data_.check_req(_seq) && is_history_search_done(ptr_this->search_data_))
+                                    {
+                                        if (ptr_this->search_data_.top_messages_ids_.empty())
+                                            ptr_this->post_history_search_result_empty();
+                                        else
+                                            ptr_this->post_history_search_result_finished();
+                                    }
                                 });
                             });
 
@@ -6280,7 +6313,7 @@ void im::history_search_one_batch(std::shared_ptr<archive::coded_term> _cterm, s
                                 ids.reserve(messages.size());
                                 for (const auto& x : messages)
                                     ids.push_back(x->get_msgid());
-                                ptr_this->get_archive()->filter_deleted_messages(contact, std::move(ids))->on_result = [call_on_exit, messages = std::move(messages), contact = contact, wr_this, _seq](const std::vector<int64_t>& _ids, archive::first_load _first_load) mutable
+                                ptr_this->get_archive()->filter_deleted_messages(contact, std::move(ids))->then([call_on_exit, messages = std::move(messages), contact = contact, wr_this, _seq](const std::vector<int64_t>& _ids, archive::first_load _first_load) mutable
                                 {
                                     auto ptr_this = wr_this.lock();
                                     if (!ptr_this)
@@ -6333,10 +6366,10 @@ void im::history_search_one_batch(std::shared_ptr<archive::coded_term> _cterm, s
                                             }
                                         }
                                     }
-                                };
+                                });
                             }
                         };
-            };
+            });
 }
 
 void im::setup_search_dialogs_params(int64_t _req_id)
@@ -6350,6 +6383,12 @@ void im::setup_search_dialogs_params(int64_t _req_id)
     search_data_.top_messages_ids_.clear();
     search_data_.contact_and_offsets_.clear();
     search_data_.free_threads_count_ = search_threads_count;
+    search_data_.pending_batches_ = 0;
+    search_data_.finished_ = false;
+
+    if (search_data_.cancelled_)
+        *search_data_.cancelled_ = true;
+    search_data_.cancelled_ = std::make_shared<std::atomic<bool>>(false);
 
     if (_req_id != -1)
         search_data_.search_results_ = std::make_shared<search::search_dialog_results>();
@@ -6768,7 +6807,7 @@ void im::resume_failed_dlg_states()
 
     for (const auto& _aimid : failed_dlg_states_)
     {
-        get_archive()->get_dlg_state(_aimid)->on_result = [wr_this, _aimid](const archive::dlg_state& _dlg_state)
+        get_archive()->get_dlg_state(_aimid)->then([wr_this, _aimid](const archive::dlg_state& _dlg_state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -6803,7 +6842,7 @@ void im::resume_failed_dlg_states()
                     ptr_this->set_dlg_state(std::move(params));
                 }
             }
-        };
+        });
     }
 
     failed_dlg_states_.clear();
@@ -6817,14 +6856,14 @@ void im::resume_failed_set_attention()
 
     for (const auto& _aimid : failed_set_attention_)
     {
-        get_archive()->get_dlg_state(_aimid)->on_result = [wr_this = weak_from_this(), _aimid](const archive::dlg_state& _dlg_state)
+        get_archive()->get_dlg_state(_aimid)->then([wr_this = weak_from_this(), _aimid](const archive::dlg_state& _dlg_state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
                 return;
 
             ptr_this->set_attention_attribute(0, _aimid, _dlg_state.get_attention(), true);
-        };
+        });
     }
 
 
@@ -6885,6 +6924,8 @@ void im::get_contact_avatar(int64_t _seq, const std::string& _contact, int32_t _
         avatar_error av_err = avatar_error::ae_unknown_error;
         if (_error == wim_protocol_internal_error::wpie_network_error)
             av_err = avatar_error::ae_network_error;
+        else if (_error == wim_protocol_internal_error::wpie_error_request_canceled)
+            av_err = avatar_error::ae_cancelled;
 
         coll.set_value_as_int("error", av_err);
         coll.set_value_as_bool("avatar_need_to_convert", false);
@@ -7019,7 +7060,7 @@ void im::send_message_to_contact(
 
     post_pending_messages();
 
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this = weak_from_this(), _contact, msg_not_sent] (const archive::dlg_state& _local_dlg_state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), _contact, msg_not_sent] (const archive::dlg_state& _local_dlg_state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -7037,8 +7078,7 @@ void im::send_message_to_contact(
         new_dlg_state.set_visible(true);
         new_dlg_state.set_fake(true);
 
-        ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->on_result =
-            [wr_this, _contact]
+        ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->then([wr_this, _contact]
             (const archive::dlg_state&, const archive::dlg_state_changes&)
             {
                 auto ptr_this = wr_this.lock();
@@ -7046,8 +7086,8 @@ void im::send_message_to_contact(
                     return;
 
                 ptr_this->post_dlg_state_to_gui(_contact);
-            };
-    };
+            });
+    });
 }
 
 void im::send_message_to_contacts(
@@ -7109,7 +7149,7 @@ void im::update_message_to_contact(
         post_pending_messages();
     }
 
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this = weak_from_this(), _contact, msg_not_sent](const archive::dlg_state& _local_dlg_state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), _contact, msg_not_sent](const archive::dlg_state& _local_dlg_state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -7124,8 +7164,7 @@ void im::update_message_to_contact(
             new_dlg_state.set_visible(true);
             new_dlg_state.set_fake(true);
 
-            ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->on_result =
-                [wr_this, _contact]
+            ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->then([wr_this, _contact]
             (const archive::dlg_state&, const archive::dlg_state_changes&)
             {
                 auto ptr_this = wr_this.lock();
@@ -7133,9 +7172,9 @@ void im::update_message_to_contact(
                     return;
 
                 ptr_this->post_dlg_state_to_gui(_contact);
-            };
+            });
         }
-    };
+    });
 }
 
 void im::send_message_typing(int64_t _seq, const std::string& _contact, const core::typing_status& _status, const std::string& _id)
@@ -7320,8 +7359,7 @@ void im::on_del_up_to_changed(const std::string& _aimid, const int64_t _del_up_t
         _aimid % _del_up_to
     );
 
-    get_archive()->delete_messages_up_to(_aimid, _del_up_to)->on_result_ =
-        [_on_complete, _aimid, _del_up_to](int32_t error)
+    get_archive()->delete_messages_up_to(_aimid, _del_up_to)->then([_on_complete, _aimid, _del_up_to](int32_t error)
         {
             coll_helper cl_coll(g_core->create_collection(), true);
             cl_coll.set<std::string>("contact", _aimid);
@@ -7330,7 +7368,7 @@ void im::on_del_up_to_changed(const std::string& _aimid, const int64_t _del_up_t
             g_core->post_message_to_gui("messages/del_up_to", 0, cl_coll.get());
 
             _on_complete->callback(error);
-        };
+        });
 }
 
 void im::modify_chat(int64_t _seq, const std::string& _aimid, const std::string& _m_chat_name)
@@ -7405,7 +7443,7 @@ std::shared_ptr<async_task_handlers> im::send_pending_message_async(int64_t _seq
 
                 messages_block->push_back(msg);
 
-                ptr_this->get_archive()->update_history(_message->get_aimid(), messages_block)->on_result = [wr_this, _message, messages_block, auto_handler](
+                ptr_this->get_archive()->update_history(_message->get_aimid(), messages_block)->then([wr_this, _message, messages_block, auto_handler](
                     std::shared_ptr<archive::headers_list> _inserted_messages,
                     const archive::dlg_state&,
                     const archive::dlg_state_changes& _changes_on_update,
@@ -7427,14 +7465,14 @@ std::shared_ptr<async_task_handlers> im::send_pending_message_async(int64_t _seq
                     if (!_result)
                         write_files_error_in_log("update_history", _result.error_code_);
 
-                    ptr_this->get_archive()->remove_message_from_not_sent(_message->get_aimid(), false, messages_block->front())->on_result_ = [wr_this, _message, auto_handler](int32_t result)
+                    ptr_this->get_archive()->remove_message_from_not_sent(_message->get_aimid(), false, messages_block->front())->then([wr_this, _message, auto_handler](int32_t result)
                     {
                         auto ptr_this = wr_this.lock();
                         if (!ptr_this)
                             return;
                         ptr_this->post_outgoing_count_to_gui(_message->get_aimid());
-                    };
-                };
+                    });
+                });
             }
             else
             {
@@ -7514,7 +7552,7 @@ bool im::has_opened_dialogs(const std::string& _contact) const
 
 void im::set_last_read(const std::string& _contact, int64_t _message, message_read_mode _mode)
 {
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this = weak_from_this(), _contact, _message, _mode](const archive::dlg_state& _local_dlg_state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), _contact, _message, _mode](const archive::dlg_state& _local_dlg_state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -7534,8 +7572,7 @@ void im::set_last_read(const std::string& _contact, int64_t _message, message_re
             if (read_all)
                 new_dlg_state.set_last_read_mention(_message);
 
-            ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->on_result =
-                [wr_this, _contact, read_all]
+            ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->then([wr_this, _contact, read_all]
             (const archive::dlg_state &_local_dlg_state, const archive::dlg_state_changes&)
             {
                 auto ptr_this = wr_this.lock();
@@ -7555,14 +7592,14 @@ void im::set_last_read(const std::string& _contact, int64_t _message, message_re
 
                     ptr_this->post_dlg_state_to_gui(_contact);
                 };
-            };
+            });
         }
-    };
+    });
 }
 
 void im::set_last_read_mention(const std::string& _contact, int64_t _message)
 {
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this = weak_from_this(), _contact, _message](const archive::dlg_state& _local_dlg_state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), _contact, _message](const archive::dlg_state& _local_dlg_state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -7578,8 +7615,7 @@ void im::set_last_read_mention(const std::string& _contact, int64_t _message)
             new_dlg_state.set_unread_mentions_count(std::nullopt);
             new_dlg_state.set_unread_count(std::nullopt);
 
-            ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->on_result =
-                [wr_this, _contact]
+            ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->then([wr_this, _contact]
             (const archive::dlg_state &_local_dlg_state, const archive::dlg_state_changes&)
             {
                 auto ptr_this = wr_this.lock();
@@ -7598,14 +7634,14 @@ void im::set_last_read_mention(const std::string& _contact, int64_t _message)
 
                     ptr_this->post_dlg_state_to_gui(_contact);
                 };
-            };
+            });
         }
-    };
+    });
 }
 
 void im::set_last_read_partial(const std::string& _contact, int64_t _message)
 {
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this = weak_from_this(), _contact, _message](const archive::dlg_state& _local_dlg_state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), _contact, _message](const archive::dlg_state& _local_dlg_state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -7624,8 +7660,7 @@ void im::set_last_read_partial(const std::string& _contact, int64_t _message)
             new_dlg_state.set_unread_count(std::nullopt);
             new_dlg_state.set_unread_mentions_count(std::nullopt);
 
-            ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->on_result =
-                [wr_this, _contact]
+            ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->then([wr_this, _contact]
             (const archive::dlg_state &_local_dlg_state, const archive::dlg_state_changes&)
             {
                 auto ptr_this = wr_this.lock();
@@ -7643,14 +7678,14 @@ void im::set_last_read_partial(const std::string& _contact, int64_t _message)
 
                     ptr_this->post_dlg_state_to_gui(_contact);
                 };
-            };
+            });
         }
-    };
+    });
 }
 
 void im::hide_dlg_state(const std::string& _contact)
 {
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this = weak_from_this(), _contact](const archive::dlg_state& _local_dlg_state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), _contact](const archive::dlg_state& _local_dlg_state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -7662,12 +7697,12 @@ void im::hide_dlg_state(const std::string& _contact)
         new_dlg_state.set_unread_count(std::nullopt);
 
         ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state);
-    };
+    });
 }
 
 void im::clear_last_message_in_dlg_state(const std::string& _contact)
 {
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this = weak_from_this(), _contact](const archive::dlg_state& _local_dlg_state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), _contact](const archive::dlg_state& _local_dlg_state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -7682,8 +7717,7 @@ void im::clear_last_message_in_dlg_state(const std::string& _contact)
         new_dlg_state.set_visible(true);
         new_dlg_state.set_fake(true);
 
-        ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->on_result =
-            [wr_this, _contact]
+        ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->then([wr_this, _contact]
         (const archive::dlg_state&, const archive::dlg_state_changes&)
         {
             auto ptr_this = wr_this.lock();
@@ -7691,8 +7725,8 @@ void im::clear_last_message_in_dlg_state(const std::string& _contact)
                 return;
 
             ptr_this->post_dlg_state_to_gui(_contact, false, true, true, true);
-        };
-    };
+        });
+    });
 }
 
 void im::delete_archive_message_local(const int64_t _seq, const std::string &_contact_aimid, const int64_t _message_id, const std::string& _internal_id, const bool _for_all)
@@ -7722,10 +7756,10 @@ void im::delete_archive_message_local(const int64_t _seq, const std::string &_co
 
     if (_message_id > 0)
     {
-        get_archive()->update_history(_contact_aimid, messages, false, archive::local_history::has_older_message_id::yes)->on_result = []
+        get_archive()->update_history(_contact_aimid, messages, false, archive::local_history::has_older_message_id::yes)->then([]
         (std::shared_ptr<archive::headers_list> _inserted_messages, const archive::dlg_state&, const archive::dlg_state_changes& _changes_on_update, core::archive::storage::result_type _result)
         {
-        };
+        });
     }
 }
 
@@ -7734,7 +7768,7 @@ void im::delete_archive_message(const int64_t _seq, const std::string &_contact_
     assert(_seq > 0);
     assert(!_contact_aimid.empty());
 
-    get_archive()->get_not_sent_message_by_iid(_internal_id)->on_result = [wr_this = weak_from_this(), _seq, _contact_aimid, _message_id, _internal_id, _for_all](archive::not_sent_message_sptr _message)
+    get_archive()->get_not_sent_message_by_iid(_internal_id)->then([wr_this = weak_from_this(), _seq, _contact_aimid, _message_id, _internal_id, _for_all](archive::not_sent_message_sptr _message)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -7770,7 +7804,7 @@ void im::delete_archive_message(const int64_t _seq, const std::string &_contact_
                 _for_all ? archive::delete_operation::del_for_all : archive::delete_operation::del_for_me));
 
         ptr_this->post_pending_delete_messages();
-    };
+    });
 }
 
 void im::delete_archive_messages_from(const int64_t _seq, const std::string &_contact_aimid, const int64_t _from_id)
@@ -7799,7 +7833,7 @@ void im::delete_archive_messages_from(const int64_t _seq, const std::string &_co
 
 void im::delete_archive_all_messages(const int64_t _seq, std::string_view _contact)
 {
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this = weak_from_this(), _contact = std::string(_contact), _seq](const archive::dlg_state& _state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), _contact = std::string(_contact), _seq](const archive::dlg_state& _state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -7807,7 +7841,7 @@ void im::delete_archive_all_messages(const int64_t _seq, std::string_view _conta
         ptr_this->delete_archive_messages_from(_seq, _contact, _state.get_last_msgid());
 
         ptr_this->clear_last_message_in_dlg_state(_contact);
-    };
+    });
 }
 
 std::string im::_get_protocol_uid() {
@@ -7889,14 +7923,14 @@ void im::hide_chat_async(const std::string& _contact,  const int64_t _last_msg_i
 
 void im::hide_chat(const std::string& _contact)
 {
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this = weak_from_this(), _contact](const archive::dlg_state& _state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), _contact](const archive::dlg_state& _state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
             return;
 
         ptr_this->hide_chat_async(_contact, _state.get_last_msgid());
-    };
+    });
 }
 
 void im::mute_chats(std::shared_ptr<std::list<std::string>> _chats)
@@ -7995,7 +8029,7 @@ void im::upload_file_sharing_internal(const archive::not_sent_message_sptr& _not
             return;
         }
 
-        ptr_this->get_archive()->get_not_sent_message_by_iid(uploading_id)->on_result = [wr_this, _error, uploading_id, _info, _not_sent](archive::not_sent_message_sptr _message)
+        ptr_this->get_archive()->get_not_sent_message_by_iid(uploading_id)->then([wr_this, _error, uploading_id, _info, _not_sent](archive::not_sent_message_sptr _message)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -8049,7 +8083,7 @@ void im::upload_file_sharing_internal(const archive::not_sent_message_sptr& _not
 
                 }), 0);
             }
-        };
+        });
 
         coll_helper cl_coll(g_core->create_collection(), true);
         _info.serialize(cl_coll.get());
@@ -8085,8 +8119,7 @@ void im::upload_file_sharing_internal(const archive::not_sent_message_sptr& _not
 
 void im::resume_all_file_sharing_uploading()
 {
-    get_archive()->get_pending_file_sharing()->on_result =
-        [wr_this = weak_from_this()](const std::list<archive::not_sent_message_sptr>& _messages)
+    get_archive()->get_pending_file_sharing()->then([wr_this = weak_from_this()](const std::list<archive::not_sent_message_sptr>& _messages)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -8096,7 +8129,7 @@ void im::resume_all_file_sharing_uploading()
             {
                 ptr_this->resume_file_sharing_uploading(_message);
             }
-        };
+        });
 
     get_loader().resume_file_sharing_tasks();
 }
@@ -8189,8 +8222,7 @@ void im::upload_file_sharing(
         return;
     }
 
-    auto handler = get_archive()->insert_not_sent_message(_contact, not_sent);
-    handler->on_result_ =
+    get_archive()->insert_not_sent_message(_contact, not_sent)->then(
         [wr_this = weak_from_this(), not_sent, _seq, file_name, _contact](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
@@ -8202,7 +8234,7 @@ void im::upload_file_sharing(
         ptr_this->post_not_sent_message_to_gui(_seq, not_sent);
 
         ptr_this->upload_file_sharing_internal(not_sent);
-    };
+    });
 }
 
 void im::get_file_sharing_preview_size(const int64_t _seq, const std::string& _file_url, const int32_t _original_size)
@@ -8271,6 +8303,7 @@ void im::download_file_sharing_metainfo(const int64_t _seq, const std::string& _
             cl_coll.set_value_as_bool("recognize", meta->recognize_);
             cl_coll.set_value_as_int("duration", meta->duration_);
             cl_coll.set_value_as_bool("got_audio", meta->got_audio_);
+            cl_coll.set_value_as_string("waveform", meta->waveform_);
 
 
             auto local_path = std::make_shared<std::wstring>(tools::from_utf8(meta->local_path_));
@@ -8602,15 +8635,14 @@ void im::abort_file_sharing_upload(
     auto history_message = std::make_shared<archive::history_message>();
     history_message->set_internal_id(_process_seq);
 
-    get_archive()->remove_message_from_not_sent(_contact, true, history_message)->on_result_ =
-        [wr_this, _process_seq](int32_t _error)
+    get_archive()->remove_message_from_not_sent(_contact, true, history_message)->then([wr_this, _process_seq](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
             return;
 
         ptr_this->get_loader().abort_file_sharing_process(_process_seq);
-    };
+    });
 }
 
 void im::download_link_preview_image(
@@ -8722,6 +8754,18 @@ void im::speech_to_text(int64_t _seq, const std::string& _url, const std::string
     };
 }
 
+void im::set_file_sharing_waveform(const std::string& _url, const std::string& _waveform)
+{
+    // the same queue as the local path updates, so the rewrites of the meta file don't race
+    const auto meta_path = get_async_loader().get_meta_path(_url, std::wstring());
+    async_tasks_->run_async_function([meta_path, _url, _waveform]
+    {
+        core::wim::async_loader::save_filesharing_waveform(meta_path, _url, _waveform);
+
+        return 0;
+    });
+}
+
 wim::loader& im::get_loader()
 {
     if (!files_loader_)
@@ -8900,7 +8944,7 @@ void im::add_contact(int64_t _seq, const std::string& _aimid, const std::string&
 
     auto wr_this = weak_from_this();
 
-    get_archive()->set_dlg_state(_aimid, state)->on_result = [wr_this, _aimid, _group, _auth_message, _seq](const archive::dlg_state&, const archive::dlg_state_changes&)
+    get_archive()->set_dlg_state(_aimid, state)->then([wr_this, _aimid, _group, _auth_message, _seq](const archive::dlg_state&, const archive::dlg_state_changes&)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -8918,14 +8962,14 @@ void im::add_contact(int64_t _seq, const std::string& _aimid, const std::string&
 
             g_core->post_message_to_gui("contacts/add/result", _seq, coll.get());
         };
-    };
+    });
 }
 
 void im::remove_contact(int64_t _seq, const std::string& _aimid)
 {
     auto wr_this = weak_from_this();
 
-    get_archive()->get_dlg_state(_aimid)->on_result = [wr_this, _aimid, _seq](const archive::dlg_state& _state)
+    get_archive()->get_dlg_state(_aimid)->then([wr_this, _aimid, _seq](const archive::dlg_state& _state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -8940,7 +8984,7 @@ void im::remove_contact(int64_t _seq, const std::string& _aimid)
         cl_coll.set_value_as_string("contact", _aimid);
         g_core->post_message_to_gui("active_dialogs_hide", 0, cl_coll.get());
 
-        ptr_this->get_archive()->clear_dlg_state(_aimid)->on_result_ = [wr_this, _seq, _aimid, last_msg_id](int32_t _err)
+        ptr_this->get_archive()->clear_dlg_state(_aimid)->then([wr_this, _seq, _aimid, last_msg_id](int32_t _err)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -8977,8 +9021,8 @@ void im::remove_contact(int64_t _seq, const std::string& _aimid)
                     on_result(0);
                 }
             });
-        };
-    };
+        });
+    });
 }
 
 
@@ -9134,7 +9178,7 @@ void im::on_event_imstate(fetch_event_imstate* _event, std::shared_ptr<auto_call
                 _state.get_request_id(),
                 _state.get_hist_msg_id(),
                 _state.get_before_hist_msg_id(),
-                _state.get_state() == imstate_sent_state::delivered)->on_result = [wr_this, _state](archive::not_sent_message_sptr _message)
+                _state.get_state() == imstate_sent_state::delivered)->then([wr_this, _state](archive::not_sent_message_sptr _message)
             {
 
                 auto ptr_this = wr_this.lock();
@@ -9156,7 +9200,7 @@ void im::on_event_imstate(fetch_event_imstate* _event, std::shared_ptr<auto_call
                     g_core->post_message_to_gui("messages/received/message_status", 0, coll.get());
 
                     ptr_this->get_archive()->update_history(_message->get_aimid(), messages_block)
-                        ->on_result = [wr_this, _message](std::shared_ptr<archive::headers_list>, const archive::dlg_state&, const archive::dlg_state_changes&, core::archive::storage::result_type _result)
+                        ->then([wr_this, _message](std::shared_ptr<archive::headers_list>, const archive::dlg_state&, const archive::dlg_state_changes&, core::archive::storage::result_type _result)
                         {
                             auto ptr_this = wr_this.lock();
                             if (!ptr_this)
@@ -9166,16 +9210,16 @@ void im::on_event_imstate(fetch_event_imstate* _event, std::shared_ptr<auto_call
                                 write_files_error_in_log("update_history", _result.error_code_);
 
                             ptr_this->post_outgoing_count_to_gui(_message->get_aimid());
-                        };
+                        });
                 }
-            };
+            });
         }
     }
 
-    get_archive()->sync_with_history()->on_result_ = [_on_complete](int32_t _error)
+    get_archive()->sync_with_history()->then([_on_complete](int32_t _error)
     {
         _on_complete->callback(0);
-    };
+    });
 }
 
 void im::on_event_notification(fetch_event_notification* _event, std::shared_ptr<auto_callback> _on_complete)
@@ -9236,7 +9280,7 @@ void im::on_event_mention_me(fetch_event_mention_me* _event, std::shared_ptr<aut
 
     auto wr_this = weak_from_this();
 
-    get_archive()->add_mention(contact, message)->on_result_ = [_on_complete, contact, message, time_offset, my_aimid, wr_this](int32_t _error)
+    get_archive()->add_mention(contact, message)->then([_on_complete, contact, message, time_offset, my_aimid, wr_this](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -9256,7 +9300,7 @@ void im::on_event_mention_me(fetch_event_mention_me* _event, std::shared_ptr<aut
         ptr_this->sync_message_with_dlg_state_queue("mentions/me/received", 0, coll);
 
         _on_complete->callback(0);
-    };
+    });
 }
 
 void im::on_event_chat_heads(fetch_event_chat_heads* _event, std::shared_ptr<auto_callback> _on_complete)
@@ -9312,7 +9356,7 @@ void im::on_event_gallery_notify(fetch_event_gallery_notify* _event, std::shared
     if (!has_opened_dialogs(aimid))
     {
         auto state = gallery.get_gallery_state();
-        get_archive()->set_gallery_state(aimid, state, false)->on_result_ = [wr_this, aimid, _on_complete, state](int32_t _error)
+        get_archive()->set_gallery_state(aimid, state, false)->then([wr_this, aimid, _on_complete, state](int32_t _error)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -9320,12 +9364,12 @@ void im::on_event_gallery_notify(fetch_event_gallery_notify* _event, std::shared
 
             ptr_this->post_gallery_state_to_gui(aimid, state);
             _on_complete->callback(0);
-        };
+        });
         return;
     }
 
 
-    get_archive()->merge_gallery_from_server(aimid, gallery, archive::gallery_entry_id(), archive::gallery_entry_id())->on_result = [wr_this, aimid, gallery, _on_complete](const std::vector<archive::gallery_item> _changes)
+    get_archive()->merge_gallery_from_server(aimid, gallery, archive::gallery_entry_id(), archive::gallery_entry_id())->then([wr_this, aimid, gallery, _on_complete](const std::vector<archive::gallery_item> _changes)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -9350,7 +9394,7 @@ void im::on_event_gallery_notify(fetch_event_gallery_notify* _event, std::shared
             g_core->post_message_to_gui("dialog/gallery/update", 0, coll.get());
         }
 
-        ptr_this->get_archive()->get_gallery_state(aimid)->on_result = [wr_this, aimid, gallery, _on_complete](const archive::gallery_state& _local_state)
+        ptr_this->get_archive()->get_gallery_state(aimid)->then([wr_this, aimid, gallery, _on_complete](const archive::gallery_state& _local_state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -9362,7 +9406,7 @@ void im::on_event_gallery_notify(fetch_event_gallery_notify* _event, std::shared
                 if (!ptr_this)
                     return;
 
-                ptr_this->get_archive()->set_gallery_state(aimid, _state, true)->on_result_ = [wr_this, aimid, _on_complete, _state](int32_t _error)
+                ptr_this->get_archive()->set_gallery_state(aimid, _state, true)->then([wr_this, aimid, _on_complete, _state](int32_t _error)
                 {
                     auto ptr_this = wr_this.lock();
                     if (!ptr_this)
@@ -9371,7 +9415,7 @@ void im::on_event_gallery_notify(fetch_event_gallery_notify* _event, std::shared
                     ptr_this->post_gallery_state_to_gui(aimid, _state);
                     _on_complete->callback(0);
                     ptr_this->download_gallery_holes(aimid);
-                };
+                });
             };
 
             auto new_state = gallery.get_gallery_state();
@@ -9385,7 +9429,7 @@ void im::on_event_gallery_notify(fetch_event_gallery_notify* _event, std::shared
                         return;
 
                     auto new_gallery = packet->get_gallery();
-                    ptr_this->get_archive()->merge_gallery_from_server(aimid, new_gallery, archive::gallery_entry_id(), archive::gallery_entry_id())->on_result = [wr_this, aimid, finish, new_gallery](const std::vector<archive::gallery_item>& _changes)
+                    ptr_this->get_archive()->merge_gallery_from_server(aimid, new_gallery, archive::gallery_entry_id(), archive::gallery_entry_id())->then([wr_this, aimid, finish, new_gallery](const std::vector<archive::gallery_item>& _changes)
                     {
                         auto ptr_this = wr_this.lock();
                         if (!ptr_this)
@@ -9418,7 +9462,7 @@ void im::on_event_gallery_notify(fetch_event_gallery_notify* _event, std::shared
                         }
 
                         finish(new_gallery.get_gallery_state());
-                    };
+                    });
                 };
                 return;
             }
@@ -9426,8 +9470,8 @@ void im::on_event_gallery_notify(fetch_event_gallery_notify* _event, std::shared
             {
                 finish(new_state);
             }
-        };
-    };
+        });
+    });
 }
 
 void core::wim::im::on_event_mchat(fetch_event_mchat * _event, std::shared_ptr<auto_callback> _on_complete)
@@ -10060,7 +10104,7 @@ void im::report_memory_usage(const int64_t _seq,
 
 void im::get_ram_usage(const int64_t _seq)
 {
-    get_archive()->get_memory_usage()->on_result = [_seq](const int64_t _index_memory_usage, const int64_t _gallery_memory_usage)
+    get_archive()->get_memory_usage()->then([_seq](const int64_t _index_memory_usage, const int64_t _gallery_memory_usage)
     {
         coll_helper cl_coll(g_core->create_collection(), true);
 
@@ -10071,7 +10115,7 @@ void im::get_ram_usage(const int64_t _seq)
         cl_coll.set_value_as_int64("voip_initialization", g_core->get_voip_init_memory_usage());
 
         g_core->post_message_to_gui("ram_usage_response", _seq, cl_coll.get());
-    };
+    });
 }
 
 void im::make_archive_holes(const int64_t _seq, const std::string& _archive)
@@ -10136,7 +10180,7 @@ void im::get_dialog_gallery(const int64_t _seq,
                             const archive::gallery_entry_id _after,
                             const int _page_size)
 {
-    get_archive()->get_gallery_entries(_aimid, _after, _type, _page_size)->on_result = [wr_this = weak_from_this(), _seq, _aimid, _type](const std::vector<archive::gallery_item>& _entries, bool _exhausted)
+    get_archive()->get_gallery_entries(_aimid, _after, _type, _page_size)->then([wr_this = weak_from_this(), _seq, _aimid, _type](const std::vector<archive::gallery_item>& _entries, bool _exhausted)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -10163,12 +10207,12 @@ void im::get_dialog_gallery(const int64_t _seq,
         g_core->post_message_to_gui("dialog/gallery/get/result", _seq, coll.get());
 
         ptr_this->download_gallery_holes(_aimid);
-    };
+    });
 }
 
 void im::get_dialog_gallery_by_msg(const int64_t _seq, const std::string& _aimid, const std::vector<std::string>& _type, int64_t _msg_id)
 {
-    get_archive()->get_gallery_entries_by_msg(_aimid, _type, _msg_id)->on_result = [wr_this = weak_from_this(), _seq, _aimid, _type](const std::vector<archive::gallery_item>& _entries, int _index, int _total)
+    get_archive()->get_gallery_entries_by_msg(_aimid, _type, _msg_id)->then([wr_this = weak_from_this(), _seq, _aimid, _type](const std::vector<archive::gallery_item>& _entries, int _index, int _total)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -10196,12 +10240,12 @@ void im::get_dialog_gallery_by_msg(const int64_t _seq, const std::string& _aimid
         g_core->post_message_to_gui("dialog/gallery/get_by_msg/result", _seq, coll.get());
 
         ptr_this->download_gallery_holes(_aimid);
-    };
+    });
 }
 
 void im::request_gallery_state(const std::string& _aimId)
 {
-    get_archive()->get_gallery_state(_aimId)->on_result = [wr_this = weak_from_this(), _aimId](const archive::gallery_state& _state)
+    get_archive()->get_gallery_state(_aimId)->then([wr_this = weak_from_this(), _aimId](const archive::gallery_state& _state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -10209,12 +10253,12 @@ void im::request_gallery_state(const std::string& _aimId)
 
         ptr_this->post_gallery_state_to_gui(_aimId, _state);
         ptr_this->download_gallery_holes(_aimId);
-    };
+    });
 }
 
 void im::get_gallery_index(const std::string& _aimId, const std::vector<std::string>& _type, int64_t _msg, int64_t _seq)
 {
-    get_archive()->get_gallery_entries_by_msg(_aimId, _type, _msg)->on_result = [wr_this = weak_from_this(), _aimId, _msg, _seq](const std::vector<archive::gallery_item>& _entries, int _index, int _total)
+    get_archive()->get_gallery_entries_by_msg(_aimId, _type, _msg)->then([wr_this = weak_from_this(), _aimId, _msg, _seq](const std::vector<archive::gallery_item>& _entries, int _index, int _total)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -10235,12 +10279,12 @@ void im::get_gallery_index(const std::string& _aimId, const std::vector<std::str
         coll.set_value_as_int64("msg", _msg);
         coll.set_value_as_int64("seq", _seq);
         g_core->post_message_to_gui("dialog/gallery/index", 0, coll.get());
-    };
+    });
 }
 
 void im::make_gallery_hole(const std::string& _aimid, int64_t _from, int64_t _till)
 {
-    get_archive()->make_gallery_hole(_aimid, _from, _till)->on_result_ = [](int32_t) {};
+    get_archive()->make_gallery_hole(_aimid, _from, _till)->then([](int32_t) {});
 }
 
 void im::stop_ui_activity_timer()
@@ -10297,7 +10341,7 @@ void im::on_ui_activity(const int64_t _time)
 
 void im::close_stranger(const std::string& _contact)
 {
-    get_archive()->get_dlg_state(_contact)->on_result = [wr_this = weak_from_this(), _contact](const archive::dlg_state& _local_dlg_state)
+    get_archive()->get_dlg_state(_contact)->then([wr_this = weak_from_this(), _contact](const archive::dlg_state& _local_dlg_state)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -10309,8 +10353,7 @@ void im::close_stranger(const std::string& _contact)
         archive::dlg_state new_dlg_state = _local_dlg_state;
         new_dlg_state.set_stranger(false);
 
-        ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->on_result =
-            [wr_this, _contact]
+        ptr_this->get_archive()->set_dlg_state(_contact, new_dlg_state)->then([wr_this, _contact]
         (const archive::dlg_state &_local_dlg_state, const archive::dlg_state_changes&)
         {
             auto ptr_this = wr_this.lock();
@@ -10329,8 +10372,8 @@ void im::close_stranger(const std::string& _contact)
 
                 ptr_this->post_dlg_state_to_gui(_contact);
             };
-        };
-    };
+        });
+    });
 }
 
 void im::on_local_pin_set(const std::string& _password)
@@ -95,6 +95,10 @@ namespace core
             std::chrono::time_point<std::chrono::system_clock> last_send_time_;
             int64_t req_id_ = -1;
             int32_t free_threads_count_ = 0;
+            // the batches whose found messages are still filtered, finished goes after the last one
+            int32_t pending_batches_ = 0;
+            // finished or empty is posted once per request
+            bool finished_ = false;
             int32_t sent_msgs_count_ = 0;
             int32_t not_sent_msgs_count_ = 0;
             messages top_messages_;
@@ -103,6 +107,9 @@ namespace core
             std::shared_ptr<search_dialog_results> search_results_;
             int32_t post_results_timer_;
 
+            // set when the search is replaced or ended, the running scans stop at the next message
+            std::shared_ptr<std::atomic<bool>> cancelled_;
+
             bool check_req(const int64_t _seq) const noexcept
             {
                 return req_id_ != -1 && req_id_ == _seq;
@@ -422,6 +429,7 @@ namespace core
             std::chrono::system_clock::time_point agregate_start_time_;
             std::chrono::system_clock::time_point last_network_activity_time_;
             std::list<dlg_state_cache_item> cached_dlg_states_;
+            std::unordered_map<std::string, std::list<dlg_state_cache_item>::iterator> cached_dlg_states_index_;
             // syncronized with dlg_state messages
             gui_messages_list gui_messages_queue_;
 
@@ -755,11 +763,13 @@ namespace core
 
             void post_cached_dlg_states_to_gui();
             void remove_from_cached_dlg_states(const std::string& _aimid);
+            void start_dlg_state_timer();
             void stop_dlg_state_timer();
             void check_need_agregate_dlg_state();
 
             void post_history_search_result_msg_to_gui(const std::string_view _contact, const archive::history_message_sptr _msg, const std::string_view _term);
             void post_history_search_result_empty();
+            void post_history_search_result_finished();
 
             // ------------------------------------------------------------------------------
             // files functions
@@ -836,6 +846,7 @@ namespace core
 
             void set_played(const std::string& url, bool played) override;
             void speech_to_text(int64_t _seq, const std::string& _url, const std::string& _locale) override;
+            void set_file_sharing_waveform(const std::string& _url, const std::string& _waveform) override;
 
             void upload_file_sharing_internal(const archive::not_sent_message_sptr& _not_sent);
 
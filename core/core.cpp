@@ -23,6 +23,7 @@
 #include "http_request.h"
 #include "scheduler.h"
 #include "archive/local_history.h"
+#include "archive/history_message.h"
 #include "log/log.h"
 #include "profiling/profiler.h"
 #include "updater/updater.h"
@@ -173,10 +174,10 @@ void core::core_dispatcher::execute_core_context(std::function<void()> _func)
     core_thread_->execute_core_context(std::move(_func));
 }
 
-void core::core_dispatcher::write_data_to_network_log(tools::binary_stream _data)
+void core::core_dispatcher::write_data_to_network_log(tools::binary_stream _data, replace_log_function _replace_function)
 {
     if (is_network_log_valid())
-        get_network_log().write_data(std::move(_data));
+        get_network_log().write_data(std::move(_data), std::move(_replace_function));
 }
 
 void core::core_dispatcher::write_string_to_network_log(const std::string& _text)
@@ -341,10 +342,11 @@ void core::core_dispatcher::unlink_gui()
 
         gui_settings_.reset();
         scheduler_.reset();
+        // the stats are taken by insert_event on any thread
         if (is_stats_enabled())
-            statistics_.reset();
+            std::atomic_store(&statistics_, std::shared_ptr<core::stats::statistics>());
         if (is_im_stats_enabled())
-            im_stats_.reset();
+            std::atomic_store(&im_stats_, std::shared_ptr<core::stats::im_stats>());
         async_executer_.reset();
         updater_.reset();
         report_sender_.reset();
@@ -599,17 +601,18 @@ void core_dispatcher::load_statistics()
     if (!is_stats_enabled())
         return;
 
-    statistics_ = std::make_shared<core::stats::statistics>(utils::get_product_data_path() + L"/stats/stats.stg");
+    auto statistics = std::make_shared<core::stats::statistics>(utils::get_product_data_path() + L"/stats/stats.stg");
+    std::atomic_store(&statistics_, statistics);
 
-    execute_core_context([this]
+    execute_core_context([this, statistics = std::move(statistics)]
     {
-        statistics_->init();
+        statistics->init();
         start_session_stats(false /* delayed */);
 
         constexpr auto timeout = (build::is_debug() ? std::chrono::seconds(10) : std::chrono::minutes(5));
         delayed_stat_timer_id_ = add_timer([this]
         {
-            if (statistics_)
+            if (std::atomic_load(&statistics_))
             {
                 start_session_stats(true /* delayed */);
             }
@@ -629,8 +632,9 @@ void core_dispatcher::load_im_stats()
     if (!is_im_stats_enabled())
         return;
 
-    im_stats_ = std::make_shared<core::stats::im_stats>(utils::get_product_data_path() + L"/stats/im_stats.stg");
-    im_stats_->init();
+    auto im_stats = std::make_shared<core::stats::im_stats>(utils::get_product_data_path() + L"/stats/im_stats.stg");
+    im_stats->init();
+    std::atomic_store(&im_stats_, std::move(im_stats));
 }
 
 void core_dispatcher::start_session_stats(bool _delayed)
@@ -671,16 +675,9 @@ void core_dispatcher::insert_event(core::stats::stats_event_names _event, const
     if (!is_stats_enabled())
         return;
 
-    auto wr_stats = std::weak_ptr<core::stats::statistics>(statistics_);
-
-    g_core->execute_core_context([wr_stats, _event, _props]
-    {
-        auto ptr_stats = wr_stats.lock();
-        if (!ptr_stats)
-            return;
-
+    // statistics queue the event without locks, it doesn't need the core thread
+    if (auto ptr_stats = std::atomic_load(&statistics_))
         ptr_stats->insert_event(_event, _props);
-    });
 }
 
 void core_dispatcher::insert_im_stats_event(core::stats::im_stat_event_names _event)
@@ -693,16 +690,8 @@ void core_dispatcher::insert_im_stats_event(core::stats::im_stat_event_names _ev
     if (!is_im_stats_enabled())
         return;
 
-    auto wr_stats = std::weak_ptr<core::stats::im_stats>(im_stats_);
-
-    g_core->execute_core_context([wr_stats, _event, _props = std::move(_props)]() mutable
-    {
-        auto ptr_stats = wr_stats.lock();
-        if (!ptr_stats)
-            return;
-
+    if (auto ptr_stats = std::atomic_load(&im_stats_))
         ptr_stats->insert_event(_event, std::move(_props));
-    });
 }
 
 void core_dispatcher::load_theme_settings()
@@ -1206,7 +1195,7 @@ network_log& core::core_dispatcher::get_network_log()
 
 std::shared_ptr<core::stats::statistics> core::core_dispatcher::get_statistics()
 {
-    return statistics_;
+    return std::atomic_load(&statistics_);
 }
 
 proxy_settings core_dispatcher::get_proxy_settings() const
@@ -1315,6 +1304,9 @@ static void omicron_log_helper(const std::string& _text)
 
 static void omicron_update_helper(const std::string& _data)
 {
+    // the profile domains of the url spans come from omicron
+    archive::reset_text_spans_settings();
+
     if (g_core)
     {
         coll_helper cl_coll(g_core->create_collection(), true);
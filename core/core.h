@@ -34,6 +34,7 @@ namespace core
     class im_login_id;
     class ithread_callback;
     class network_log;
+    typedef std::function<void(tools::binary_stream&)> replace_log_function;
     struct proxy_settings;
     class proxy_settings_manager;
     class hosts_config;
@@ -82,6 +83,7 @@ namespace core
         std::shared_ptr<core::core_settings> settings_;
         std::shared_ptr<core::gui_settings> gui_settings_;
         std::shared_ptr<core::theme_settings> theme_settings_;
+        // read from the other threads, accessed only with std::atomic_load/std::atomic_store
         std::shared_ptr<core::stats::statistics> statistics_;
         std::shared_ptr<core::stats::im_stats> im_stats_;
         std::shared_ptr<core::proxy_settings_manager> proxy_settings_manager_;
@@ -148,7 +150,7 @@ namespace core
         std::string get_uniq_device_id() const;
         void execute_core_context(std::function<void()> _func);
 
-        void write_data_to_network_log(tools::binary_stream _data);
+        void write_data_to_network_log(tools::binary_stream _data, replace_log_function _replace_function = nullptr);
         void write_string_to_network_log(const std::string& _text);
         std::stack<std::wstring> network_log_file_names_history_copy();
 
@@ -171,8 +171,6 @@ bool core::curl_context::init_handler(CURL* _curl)
     if (!_curl)
         return false;
 
-    curl_easy_setopt(_curl, CURLOPT_SSL_VERIFYPEER, 1L);
-
     const bool is_http2_used = is_multi_task();
 
     curl_easy_setopt(_curl, CURLOPT_HTTP_VERSION, (is_http2_used ? CURL_HTTP_VERSION_2TLS : CURL_HTTP_VERSION_1_1));
@@ -180,34 +178,13 @@ bool core::curl_context::init_handler(CURL* _curl)
     if (is_http2_used)
         curl_easy_setopt(_curl, CURLOPT_PIPEWAIT, long(1));
 
-    curl_easy_setopt(_curl, CURLOPT_SSL_CTX_FUNCTION, ssl_ctx_callback);
-
-    curl_easy_setopt(_curl, CURLOPT_SSL_VERIFYHOST, 2L);
-
-    curl_easy_setopt(_curl, CURLOPT_NOSIGNAL, 1L);
-
     curl_easy_setopt(_curl, CURLOPT_WRITEDATA, (void *)this);
-    curl_easy_setopt(_curl, CURLOPT_WRITEFUNCTION, write_memory_callback);
     curl_easy_setopt(_curl, CURLOPT_HEADERDATA, (void *)this);
-    curl_easy_setopt(_curl, CURLOPT_HEADERFUNCTION, write_header_function);
     curl_easy_setopt(_curl, CURLOPT_PROGRESSDATA, (void *)this);
-    curl_easy_setopt(_curl, CURLOPT_NOPROGRESS, false);
-    curl_easy_setopt(_curl, CURLOPT_PROGRESSFUNCTION, progress_callback);
-
-    curl_easy_setopt(_curl, CURLOPT_TCP_KEEPALIVE, 1L);
-    curl_easy_setopt(_curl, CURLOPT_TCP_KEEPIDLE, 5L);
-    curl_easy_setopt(_curl, CURLOPT_TCP_KEEPINTVL, 5L);
-    curl_easy_setopt(_curl, CURLOPT_NOSIGNAL, 1L);
-
-    curl_easy_setopt(_curl, CURLOPT_ACCEPT_ENCODING, "gzip");
 
     curl_easy_setopt(_curl, CURLOPT_USERAGENT, user_agent_.c_str());
 
     curl_easy_setopt(_curl, CURLOPT_DEBUGDATA, (void*)this);
-    curl_easy_setopt(_curl, CURLOPT_DEBUGFUNCTION, trace_function);
-    curl_easy_setopt(_curl, CURLOPT_VERBOSE, 1L);
-
-    curl_easy_setopt(_curl, CURLOPT_TIMEOUT_MS, 0);
 
     if (connect_timeout_.count() > 0)
         curl_easy_setopt(_curl, CURLOPT_CONNECTTIMEOUT_MS, connect_timeout_.count());
@@ -238,9 +215,6 @@ bool core::curl_context::init_handler(CURL* _curl)
 
     curl_easy_setopt(_curl, CURLOPT_URL, original_url_.c_str());
 
-    curl_easy_setopt(_curl, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(_curl, CURLOPT_MAXREDIRS, 10L);
-
     if (!keep_alive_)
     {
         curl_easy_setopt(_curl, CURLOPT_COOKIEFILE, "");
@@ -315,6 +289,34 @@ bool core::curl_context::init_handler(CURL* _curl)
     return true;
 }
 
+void core::curl_context::init_common_options(CURL* _curl)
+{
+    curl_easy_setopt(_curl, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(_curl, CURLOPT_SSL_CTX_FUNCTION, ssl_ctx_callback);
+    curl_easy_setopt(_curl, CURLOPT_SSL_VERIFYHOST, 2L);
+
+    curl_easy_setopt(_curl, CURLOPT_NOSIGNAL, 1L);
+
+    curl_easy_setopt(_curl, CURLOPT_WRITEFUNCTION, write_memory_callback);
+    curl_easy_setopt(_curl, CURLOPT_HEADERFUNCTION, write_header_function);
+    curl_easy_setopt(_curl, CURLOPT_NOPROGRESS, false);
+    curl_easy_setopt(_curl, CURLOPT_PROGRESSFUNCTION, progress_callback);
+
+    curl_easy_setopt(_curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(_curl, CURLOPT_TCP_KEEPIDLE, 5L);
+    curl_easy_setopt(_curl, CURLOPT_TCP_KEEPINTVL, 5L);
+
+    curl_easy_setopt(_curl, CURLOPT_ACCEPT_ENCODING, "gzip");
+
+    curl_easy_setopt(_curl, CURLOPT_DEBUGFUNCTION, trace_function);
+    curl_easy_setopt(_curl, CURLOPT_VERBOSE, 1L);
+
+    curl_easy_setopt(_curl, CURLOPT_TIMEOUT_MS, 0);
+
+    curl_easy_setopt(_curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(_curl, CURLOPT_MAXREDIRS, 10L);
+}
+
 void core::curl_context::set_replace_log_function(replace_log_function _func)
 {
     replace_log_function_ = std::move(_func);
@@ -591,10 +593,9 @@ void core::curl_context::write_log_message(std::string_view _result, std::chrono
     message << std::endl;
     write_log_string(message.str());
 
-    if (replace_log_function_)
-        replace_log_function_(*log_data_);
-
-    g_core->write_data_to_network_log(*log_data_);
+    // the private data is hidden by the log thread, once for the whole request
+    g_core->write_data_to_network_log(std::exchange(*log_data_, core::tools::binary_stream()), replace_log_function_);
+    max_log_data_size_reached_ = false;
 }
 
 void core::curl_context::set_custom_header_params(const std::vector<std::string>& _params)
@@ -798,9 +799,6 @@ static int32_t trace_function(CURL* /*_handle*/, curl_infotype _type, unsigned c
         core::tools::decompress(compressed, data);
 
         ctx->write_log_data(data.get_data(), data.all_size());
-        if (ctx->replace_log_function_)
-            ctx->replace_log_function_(*ctx->log_data_);
-
         ctx->write_log_string("\n");
         return 0;
     }
@@ -836,7 +834,5 @@ static int32_t trace_function(CURL* /*_handle*/, curl_infotype _type, unsigned c
     }
 
     ctx->write_log_data((const char*) _data, (uint32_t) _size);
-    if (ctx->replace_log_function_)
-        ctx->replace_log_function_(*ctx->log_data_);
     return 0;
 }
@@ -17,6 +17,9 @@ namespace core
         bool init(std::chrono::milliseconds _connect_timeout, std::chrono::milliseconds _timeout, core::proxy_settings _proxy_settings, const std::string &_user_agent);
         bool init_handler(CURL* _curl);
 
+        // the options which don't depend on the request, they are set once for a new or a reset handle
+        static void init_common_options(CURL* _curl);
+
         bool is_need_log() const;
         void set_need_log(bool _need);
         void set_need_log_original_url(bool _value);
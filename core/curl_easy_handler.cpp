@@ -14,23 +14,22 @@ namespace
     constexpr int MEDIUM_PRIORITY_THREADS_COUNT = 2;
     constexpr int LOW_PRIORITY_THREADS_COUNT = 1;
 
-    std::map<std::thread::id, CURL*> curl_handlers;
-    std::mutex curl_handlers_mutex_;
+    // every curl thread runs its requests on its own handle, it's reset between them
+    // and keeps the connections alive. the handle is freed when the thread exits
+    thread_local CURL* thread_handle = nullptr;
 
     CURL* get_for_this_thread()
     {
-        auto thread_id = std::this_thread::get_id();
+        if (!thread_handle)
+            thread_handle = core::create_curl_handle();
 
-        std::lock_guard<std::mutex> lock(curl_handlers_mutex_);
-
-        if (const auto iter_handle = curl_handlers.find(thread_id); iter_handle != curl_handlers.end())
-            return iter_handle->second;
-
-        CURL* curl_handle = curl_easy_init();
-
-        curl_handlers[thread_id] = curl_handle;
+        return thread_handle;
+    }
 
-        return curl_handle;
+    void free_for_this_thread()
+    {
+        if (thread_handle)
+            curl_easy_cleanup(std::exchange(thread_handle, nullptr));
     }
 }
 
@@ -72,11 +71,7 @@ namespace core
 
     void core::curl_easy_handler::init()
     {
-#ifdef _WIN32
-        curl_global_init(CURL_GLOBAL_ALL);
-#else
-        curl_global_init(CURL_GLOBAL_SSL);
-#endif
+        // curl is initialized globally by curl_handler
     }
 
     void core::curl_easy_handler::cleanup()
@@ -100,16 +95,6 @@ namespace core
 
         fetch_thread_.join();
         protocol_thread_.join();
-
-        {
-            std::lock_guard<std::mutex> lock(curl_handlers_mutex_);
-            for (const auto& h : curl_handlers)
-            {
-                curl_easy_cleanup(h.second);
-            }
-        }
-
-        curl_global_cleanup();
     }
 
     bool core::curl_easy_handler::is_stopped() const
@@ -183,9 +168,9 @@ namespace core
     curl_easy_handler::curl_easy_handler()
         : stop_(false)
     {
-        top_priority_tasks_ = std::make_unique<tools::threadpool>("curl top prio", TOP_PRIORITY_THREADS_COUNT);
-        medium_priority_tasks_ = std::make_unique<tools::threadpool>("curl med prio", MEDIUM_PRIORITY_THREADS_COUNT);
-        low_priority_tasks_ = std::make_unique<tools::threadpool>("curl low prio", LOW_PRIORITY_THREADS_COUNT);
+        top_priority_tasks_ = std::make_unique<tools::threadpool>("curl top prio", TOP_PRIORITY_THREADS_COUNT, free_for_this_thread);
+        medium_priority_tasks_ = std::make_unique<tools::threadpool>("curl med prio", MEDIUM_PRIORITY_THREADS_COUNT, free_for_this_thread);
+        low_priority_tasks_ = std::make_unique<tools::threadpool>("curl low prio", LOW_PRIORITY_THREADS_COUNT, free_for_this_thread);
 
         fetch_thread_ = std::thread([this]()
         {
@@ -207,6 +192,8 @@ namespace core
                 if (nextTask)
                     run_task(nextTask);
             }
+
+            free_for_this_thread();
         });
 
         protocol_thread_ = std::thread([this]()
@@ -229,6 +216,8 @@ namespace core
                 if (nextTask)
                     run_task(nextTask);
             }
+
+            free_for_this_thread();
         });
     }
 }
@@ -4,8 +4,50 @@
 #include "curl_easy_handler.h"
 #include "curl_multi_handler.h"
 
+namespace
+{
+    // the dns cache and the tls sessions are shared by all the handles, the easy and the multi ones,
+    // so a reconnect to a known host skips the resolving and the full handshake.
+    // the connections aren't shared, curl doesn't support using them from concurrent threads
+    CURLSH* share = nullptr;
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> share_locks;
+
+    void lock_share(CURL*, curl_lock_data _data, curl_lock_access, void*)
+    {
+        share_locks[_data].lock();
+    }
+
+    void unlock_share(CURL*, curl_lock_data _data, void*)
+    {
+        share_locks[_data].unlock();
+    }
+
+    void init_curl_handle(CURL* _curl)
+    {
+        core::curl_context::init_common_options(_curl);
+
+        if (share)
+            curl_easy_setopt(_curl, CURLOPT_SHARE, share);
+    }
+}
+
 namespace core
 {
+    CURL* create_curl_handle()
+    {
+        auto curl = curl_easy_init();
+        if (curl)
+            init_curl_handle(curl);
+
+        return curl;
+    }
+
+    void reset_curl_handle(CURL* _curl)
+    {
+        curl_easy_reset(_curl);
+        init_curl_handle(_curl);
+    }
+
     curl_task::curl_task(std::weak_ptr<curl_context> _context, curl_easy::completion_function _completion_func)
         : context_(_context)
         , completion_func_(_completion_func)
@@ -41,12 +83,12 @@ namespace core
         if (!ctx->init_handler(_curl))
         {
             result(CURLE_FAILED_INIT);
-            curl_easy_reset(_curl);
+            reset_curl_handle(_curl);
             return;
         }
 
         result(ctx->execute_handler(_curl));
-        curl_easy_reset(_curl);
+        reset_curl_handle(_curl);
     }
 
     CURL* curl_task::init_handler()
@@ -72,7 +114,7 @@ namespace core
             return nullptr;
         }
 
-        auto curl_handler = curl_easy_init();
+        auto curl_handler = create_curl_handle();
         if (!ctx->init_handler(curl_handler))
         {
             result(CURLE_FAILED_INIT);
@@ -231,6 +273,15 @@ namespace core
         curl_global_init(CURL_GLOBAL_SSL);
 #endif
 
+        share = curl_share_init();
+        if (share)
+        {
+            curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lock_share);
+            curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlock_share);
+            curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+            curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        }
+
         easy_handler_->init();
         multi_handler_->init();
     }
@@ -240,6 +291,13 @@ namespace core
         easy_handler_->cleanup();
         multi_handler_->cleanup();
 
+        // all the handles are freed by now, the share goes before the global cleanup tears down the ssl backend
+        if (share)
+        {
+            curl_share_cleanup(share);
+            share = nullptr;
+        }
+
         curl_global_cleanup();
     }
 
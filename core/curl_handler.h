@@ -49,6 +49,12 @@ namespace core
         bool async_;
     };
 
+    // a new easy handle with the common options, it shares the dns cache and the tls sessions with the other handles
+    CURL* create_curl_handle();
+
+    // drops the options of the previous request, the handle keeps its connections
+    void reset_curl_handle(CURL* _curl);
+
     class curl_base_handler
     {
     public:
@@ -11,9 +11,163 @@ namespace core
     constexpr int64_t max_logs_size = max_file_size * 5;
     constexpr int64_t max_logs_size_full = max_file_size * 50;
 
+    // the records not written yet are dropped above this
+    constexpr size_t max_queue_size = 1024 * 1024 * 16;
+
+    // a gzip member is finished after this many bytes, until then the written data is sync flushed
+    constexpr int64_t max_member_size = 1024 * 256;
+
+    constexpr auto log_file_regex = "(?P<index>\\d+)\\.net\\.(txt|gz)";
+
+    log_file_context::log_file_context(const boost::filesystem::wpath& _logs_directory, bool _compressed)
+        :   logs_directory_(_logs_directory),
+            compressed_(_compressed),
+            file_index_(-1),
+            uncompressed_size_(0),
+            member_size_(0)
+    {
+    }
+
+    log_file_context::~log_file_context()
+    {
+        close();
+    }
+
+    bool log_file_context::open(const boost::filesystem::wpath& _file_path)
+    {
+        std::ios_base::openmode open_mode = std::fstream::binary | std::fstream::out | std::fstream::app;
+
+        file_stream_ = std::make_unique<boost::filesystem::ofstream>(_file_path, open_mode);
+        if (!file_stream_->good())
+        {
+            file_stream_.reset();
+            return false;
+        }
+
+        if (!compressed_)
+            return true;
+
+        auto index_path = _file_path;
+        index_path.replace_extension(L".idx");
+
+        index_stream_ = std::make_unique<boost::filesystem::ofstream>(index_path, open_mode);
+
+        zstream_ = std::make_unique<z_stream>();
+        zstream_->zalloc = Z_NULL;
+        zstream_->zfree = Z_NULL;
+        zstream_->opaque = Z_NULL;
+
+        // 16 + window bits for the gzip header, the members can be unpacked by any gzip tool
+        if (!index_stream_->good() || deflateInit2(zstream_.get(), Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            zstream_.reset();
+            index_stream_.reset();
+            file_stream_.reset();
+            return false;
+        }
+
+        uncompressed_size_ = 0;
+        member_size_ = 0;
+
+        return true;
+    }
+
+    bool log_file_context::deflate_to_file(int _flush)
+    {
+        char buffer[16 * 1024];
+
+        do
+        {
+            zstream_->next_out = (Bytef*) buffer;
+            zstream_->avail_out = sizeof(buffer);
+
+            if (deflate(zstream_.get(), _flush) == Z_STREAM_ERROR)
+                return false;
+
+            file_stream_->write(buffer, sizeof(buffer) - zstream_->avail_out);
+        }
+        while (zstream_->avail_out == 0);
+
+        return true;
+    }
+
+    void log_file_context::write(const char* _data, size_t _size)
+    {
+        if (!zstream_)
+        {
+            file_stream_->write(_data, _size);
+            return;
+        }
+
+        if (member_size_ == 0)
+        {
+            const auto now = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now());
+            *index_stream_ << uncompressed_size_ << ' ' << file_stream_->tellp() << ' ' << now.time_since_epoch().count() << '\n';
+        }
+
+        zstream_->next_in = (Bytef*) _data;
+        zstream_->avail_in = (uInt) _size;
+        deflate_to_file(Z_NO_FLUSH);
+
+        member_size_ += _size;
+        uncompressed_size_ += _size;
+    }
+
+    void log_file_context::flush()
+    {
+        if (zstream_ && member_size_ > 0)
+        {
+            if (member_size_ >= max_member_size)
+            {
+                deflate_to_file(Z_FINISH);
+                deflateReset(zstream_.get());
+                member_size_ = 0;
+            }
+            else
+            {
+                deflate_to_file(Z_SYNC_FLUSH);
+            }
+        }
+
+        file_stream_->flush();
+
+        if (index_stream_)
+            index_stream_->flush();
+    }
+
+    void log_file_context::close()
+    {
+        if (zstream_)
+        {
+            if (member_size_ > 0)
+                deflate_to_file(Z_FINISH);
+
+            deflateEnd(zstream_.get());
+            zstream_.reset();
+            member_size_ = 0;
+        }
+
+        if (index_stream_)
+        {
+            index_stream_->close();
+            index_stream_.reset();
+        }
+
+        if (file_stream_)
+        {
+            file_stream_->close();
+            file_stream_.reset();
+        }
+    }
+
     network_log::network_log(const boost::filesystem::wpath& _logs_directory)
         :   write_thread_(std::make_unique<async_executer>("log")),
-            file_context_(std::make_shared<log_file_context>(_logs_directory))
+            file_context_(std::make_shared<log_file_context>(_logs_directory, core::configuration::get_app_config().is_net_log_compression_enabled())),
+            queue_size_(0),
+            write_scheduled_(false),
+            dropped_records_(0),
+            dropped_bytes_(0),
+            total_dropped_records_(0)
     {
         max_size_ = core::configuration::get_app_config().is_full_log_enabled() ? max_logs_size_full : max_logs_size;
     }
@@ -39,7 +193,7 @@ namespace core
     {
         using namespace boost::xpressive;
 
-        static auto re = sregex::compile("(?P<index>\\d+)\\.net\\.txt");
+        static auto re = sregex::compile(log_file_regex);
 
         int64_t max_index = -1;
 
@@ -77,10 +231,10 @@ namespace core
         return (max_index + 1);
     }
 
-    boost::filesystem::wpath get_file_path(int64_t _index, const boost::filesystem::wpath& _logs_directory)
+    boost::filesystem::wpath get_file_path(int64_t _index, const boost::filesystem::wpath& _logs_directory, bool _compressed)
     {
         boost::wformat area_filename(L"%016lld.%s.%s");
-        area_filename % _index % L"net" % L"txt";
+        area_filename % _index % L"net" % (_compressed ? L"gz" : L"txt");
 
         boost::filesystem::wpath path = _logs_directory;
         path.append(area_filename.str());
@@ -92,7 +246,7 @@ namespace core
     {
         using namespace boost::xpressive;
 
-        static auto re = sregex::compile("(?P<index>\\d+)\\.net\\.txt");
+        static auto re = sregex::compile(log_file_regex);
 
         std::map<int64_t, std::string> files;
 
@@ -133,6 +287,7 @@ namespace core
                     if (size > max_size)
                     {
                         boost::filesystem::remove(file_path, e);
+                        boost::filesystem::remove(file_path.replace_extension(L".idx"), e);
                     }
                     else
                     {
@@ -147,7 +302,7 @@ namespace core
         }
     }
 
-    void network_log::write_data(tools::binary_stream _data)
+    void network_log::write_data(tools::binary_stream _data, replace_log_function _replace_function)
     {
         if (!_data.available())
         {
@@ -155,84 +310,244 @@ namespace core
             return;
         }
 
-        const auto current_time = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now());
-        const auto current_thread_id = std::this_thread::get_id();
+        const auto data_size = _data.available();
 
-        auto file_context = file_context_;
-        auto file_names_history = &file_names_history_;
+        log_record record =
+        {
+            std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now()),
+            std::this_thread::get_id(),
+            std::move(_data),
+            std::move(_replace_function)
+        };
 
-        auto max_size = max_size_;
-        write_thread_->run_async_function([current_time, current_thread_id, bs_data = std::make_shared<tools::binary_stream>(std::move(_data)), file_context, file_names_history, max_size]()->int32_t
         {
-            if (!file_context->file_stream_)
+            std::scoped_lock lock(queue_mutex_);
+
+            if (queue_size_ + data_size > max_queue_size)
             {
-                if (file_context->file_index_ < 0)
-                {
-                    if (!create_logs_directory(file_context->logs_directory_))
-                        return -1;
+                ++dropped_records_;
+                dropped_bytes_ += data_size;
+                ++total_dropped_records_;
+                return;
+            }
 
-                    file_context->file_index_ = get_log_index(file_context->logs_directory_);
-                }
-                else
-                {
-                    ++file_context->file_index_;
-                }
+            queue_size_ += data_size;
+            queue_.push_back(std::move(record));
 
-                std::ios_base::openmode open_mode = std::fstream::binary | std::fstream::out | std::fstream::app;
+            if (write_scheduled_)
+                return;
 
-                const auto file_path = get_file_path(file_context->file_index_, file_context->logs_directory_);
+            write_scheduled_ = true;
+        }
 
-                file_context->file_stream_ = std::make_unique<boost::filesystem::ofstream>(file_path, open_mode);
-                if (!file_context->file_stream_->good())
-                {
-                    file_context->file_stream_.reset();
-                    return -1;
-                }
-                else
-                {
-                    file_names_history->push(file_path.wstring());
-                }
-            }
+        write_thread_->push_back([this]
+        {
+            write_queue();
+        });
+    }
+
+    void network_log::write_string(const std::string& _text)
+    {
+        tools::binary_stream stream;
+        stream.write(_text);
+        write_data(std::move(stream));
+    }
+
+    bool network_log::open_next_file()
+    {
+        if (file_context_->file_index_ < 0)
+        {
+            if (!create_logs_directory(file_context_->logs_directory_))
+                return false;
+
+            file_context_->file_index_ = get_log_index(file_context_->logs_directory_);
+        }
+        else
+        {
+            ++file_context_->file_index_;
+        }
+
+        const auto file_path = get_file_path(file_context_->file_index_, file_context_->logs_directory_, file_context_->compressed_);
+        if (!file_context_->open(file_path))
+            return false;
+
+        file_names_history_.push(file_path.wstring());
 
-            std::stringstream ss_header;
-            const auto now_c = std::chrono::system_clock::to_time_t(current_time);
+        return true;
+    }
+
+    void network_log::write_queue()
+    {
+        std::deque<log_record> records;
+        uint64_t dropped_records = 0;
+        uint64_t dropped_bytes = 0;
+
+        {
+            std::scoped_lock lock(queue_mutex_);
+
+            records.swap(queue_);
+            std::swap(dropped_records, dropped_records_);
+            std::swap(dropped_bytes, dropped_bytes_);
+            write_scheduled_ = false;
+        }
+
+        if (dropped_records > 0)
+        {
+            std::stringstream ss_dropped;
+            ss_dropped << "*** network log is behind, " << dropped_records << " records (" << dropped_bytes << " bytes) dropped ***";
+
+            log_record record =
+            {
+                std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now()),
+                std::this_thread::get_id(),
+                tools::binary_stream(),
+                nullptr
+            };
+            record.data_.write(ss_dropped.str());
+
+            write_record(record);
+        }
+
+        size_t records_size = 0;
+        for (const auto& record : records)
+            records_size += record.data_.available();
+
+        for (auto& record : records)
+        {
+            if (!write_record(record))
+                break;
+        }
+
+        if (file_context_->file_stream_)
+            file_context_->flush();
+
+        std::scoped_lock lock(queue_mutex_);
+        queue_size_ -= records_size;
+    }
 
-            tm now_tm = { 0 };
+    bool network_log::write_record(log_record& _record)
+    {
+        if (!file_context_->file_stream_ && !open_next_file())
+            return false;
+
+        std::stringstream ss_header;
+        const auto now_c = std::chrono::system_clock::to_time_t(_record.time_);
+
+        tm now_tm = { 0 };
 #ifdef _WIN32
-            localtime_s(&now_tm, &now_c);
+        localtime_s(&now_tm, &now_c);
 #else
-            localtime_r(&now_c, &now_tm);
+        localtime_r(&now_c, &now_tm);
 #endif
 
-            const auto fraction = (current_time.time_since_epoch().count() % 1000);
-            ss_header << '[' << std::put_time<char>(&now_tm, "%c") << '.' << fraction << "].[" << current_thread_id << "] \n";
+        const auto fraction = (_record.time_.time_since_epoch().count() % 1000);
+        ss_header << '[' << std::put_time<char>(&now_tm, "%c") << '.' << fraction << "].[" << _record.thread_id_ << "] \n";
 
-            uint32_t data_size = bs_data->available();
+        // the private data is hidden once, right before it goes to the file
+        if (_record.replace_function_)
+            _record.replace_function_(_record.data_);
 
-            const auto header_string = ss_header.str();
-            file_context->file_stream_->write(header_string.c_str(), header_string.length());
-            file_context->file_stream_->write((const char*) bs_data->read(data_size), data_size);
-            file_context->file_stream_->write((const char*) "\n", sizeof(char));
+        uint32_t data_size = _record.data_.available();
 
-            file_context->file_stream_->flush();
+        const auto header_string = ss_header.str();
+        file_context_->write(header_string.c_str(), header_string.length());
+        file_context_->write((const char*) _record.data_.read(data_size), data_size);
+        file_context_->write((const char*) "\n", sizeof(char));
 
-            auto file_size = file_context->file_stream_->tellp();
-            if (file_size > max_file_size)
-            {
-                file_context->file_stream_->close();
-                file_context->file_stream_.reset();
+        if (file_context_->file_stream_->tellp() > max_file_size)
+        {
+            file_context_->close();
 
-                clean_logs(file_context->logs_directory_, max_size);
-            }
+            clean_logs(file_context_->logs_directory_, max_size_);
+        }
 
-            return 0;
-        });
+        return true;
     }
 
-    void network_log::write_string(const std::string& _text)
+    std::vector<char> read_network_log_tail(const boost::filesystem::wpath& _file_path, size_t _max_size)
     {
-        tools::binary_stream stream;
-        stream.write(_text);
-        write_data(std::move(stream));
+        std::vector<char> result;
+
+        boost::filesystem::ifstream file(_file_path, std::ios::binary);
+        if (!file.good() || _max_size == 0)
+            return result;
+
+        file.seekg(0, std::ios::end);
+        const int64_t file_size = file.tellg();
+
+        if (_file_path.extension() != L".gz")
+        {
+            const auto tail_size = std::min<int64_t>(file_size, _max_size);
+            result.resize(tail_size);
+            file.seekg(-tail_size, std::ios::end);
+            file.read(result.data(), tail_size);
+            result.resize(file.gcount());
+            return result;
+        }
+
+        // the latest member start that still leaves _max_size bytes before the last indexed member
+        auto index_path = _file_path;
+        index_path.replace_extension(L".idx");
+
+        std::vector<std::pair<int64_t, int64_t>> members;
+
+        boost::filesystem::ifstream index(index_path);
+        int64_t uncompressed_offset = 0, compressed_offset = 0, time = 0;
+        while (index >> uncompressed_offset >> compressed_offset >> time)
+            members.emplace_back(uncompressed_offset, compressed_offset);
+
+        int64_t start = 0;
+        if (!members.empty())
+        {
+            const auto last_offset = members.back().first;
+            for (auto iter = members.rbegin(); iter != members.rend(); ++iter)
+            {
+                start = iter->second;
+                if (last_offset - iter->first >= int64_t(_max_size))
+                    break;
+            }
+        }
+
+        file.seekg(start, std::ios::beg);
+        std::vector<char> compressed(file_size - start);
+        file.read(compressed.data(), compressed.size());
+        compressed.resize(file.gcount());
+
+        z_stream zstream = {};
+        if (inflateInit2(&zstream, 16 + MAX_WBITS) != Z_OK)
+            return result;
+
+        core::tools::auto_scope as([&zstream]
+        {
+            inflateEnd(&zstream);
+        });
+
+        zstream.next_in = (Bytef*) compressed.data();
+        zstream.avail_in = (uInt) compressed.size();
+
+        std::deque<char> tail;
+        char buffer[16 * 1024];
+
+        // a full buffer means inflate may still hold output even when all input is consumed
+        while (zstream.avail_in > 0 || zstream.avail_out == 0)
+        {
+            zstream.next_out = (Bytef*) buffer;
+            zstream.avail_out = sizeof(buffer);
+
+            const auto res = inflate(&zstream, Z_NO_FLUSH);
+
+            tail.insert(tail.end(), buffer, buffer + (sizeof(buffer) - zstream.avail_out));
+            if (tail.size() > _max_size)
+                tail.erase(tail.begin(), tail.begin() + (tail.size() - _max_size));
+
+            // the next member goes on, the last one may be unfinished if the file is still written
+            if (res == Z_STREAM_END)
+                inflateReset(&zstream);
+            else if (res != Z_OK)
+                break;
+        }
+
+        result.assign(tail.begin(), tail.end());
+        return result;
     }
 }
@@ -7,48 +7,83 @@ namespace core
 {
     class async_executer;
 
+    typedef std::function<void(tools::binary_stream&)> replace_log_function;
+
     struct log_file_context
     {
         const boost::filesystem::wpath logs_directory_;
+        const bool compressed_;
         int64_t file_index_;
 
         std::unique_ptr<boost::filesystem::ofstream> file_stream_;
 
-        log_file_context(const boost::filesystem::wpath& _logs_directory)
-            :   logs_directory_(_logs_directory),
-                file_index_(-1)
-        {
-        }
+        // a compressed file is a sequence of gzip members, so it can be read from any member start.
+        // the index keeps the member starts as "uncompressed_offset compressed_offset time" lines
+        std::unique_ptr<boost::filesystem::ofstream> index_stream_;
+        std::unique_ptr<z_stream> zstream_;
+        int64_t uncompressed_size_;
+        int64_t member_size_;
 
-        virtual ~log_file_context()
-        {
-            if (file_stream_)
-                file_stream_->close();
-        }
+        log_file_context(const boost::filesystem::wpath& _logs_directory, bool _compressed);
+        virtual ~log_file_context();
+
+        bool open(const boost::filesystem::wpath& _file_path);
+        void write(const char* _data, size_t _size);
+        void flush();
+        void close();
+
+    private:
+        bool deflate_to_file(int _flush);
     };
 
     class network_log
     {
+        struct log_record
+        {
+            std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds> time_;
+            std::thread::id thread_id_;
+            tools::binary_stream data_;
+            replace_log_function replace_function_;
+        };
+
         std::unique_ptr<async_executer> write_thread_;
 
         std::shared_ptr<log_file_context> file_context_;
 
         std::stack<std::wstring> file_names_history_;
 
+        // the records waiting for the write thread, the newest ones are dropped when it falls behind
+        std::mutex queue_mutex_;
+        std::deque<log_record> queue_;
+        size_t queue_size_;
+        bool write_scheduled_;
+        uint64_t dropped_records_;
+        uint64_t dropped_bytes_;
+        std::atomic<uint64_t> total_dropped_records_;
+
     public:
 
         network_log(const boost::filesystem::wpath& _logs_directory);
         virtual ~network_log();
 
-        void write_data(tools::binary_stream _data);
+        // _replace_function hides the private data, it's called on the write thread
+        void write_data(tools::binary_stream _data, replace_log_function _replace_function = nullptr);
         void write_string(const std::string& _text);
 
         std::stack<std::wstring> file_names_history_copy() const { return file_names_history_; }
 
+        uint64_t dropped_records() const { return total_dropped_records_; }
+
     private:
+        void write_queue();
+        bool write_record(log_record& _record);
+        bool open_next_file();
+
         int max_size_;
     };
 
+    // the last _max_size bytes of a log file, the compressed one is unpacked from the nearest indexed member
+    std::vector<char> read_network_log_tail(const boost::filesystem::wpath& _file_path, size_t _max_size);
 }
 
 #endif // __NETWORKLOG_H__
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "tools/strings.h"
 #include "tools/system.h"
 #include "tools/tlv.h"
+#include "stats/stats_journal.h"
 #include "../external/curl/include/curl.h"
 #include "http_request.h"
 #include "tools/hmac_sha_base64.h"
@@ -28,6 +29,15 @@ enum statistics_info_types
     last_sent_time = 7,
     event_time = 8,
     event_id = 9,
+    journal_generation = 10,
+    journal_record_type = 11,
+    journal_record_data = 12,
+};
+
+enum journal_record_types
+{
+    journal_record_event = 1,
+    journal_record_accumulated_events = 2,
 };
 
 
@@ -63,7 +73,12 @@ std::shared_ptr<statistics::stop_objects> statistics::stop_objects_;
 
 statistics::statistics(std::wstring _file_name)
     : file_name_(std::move(_file_name))
-    , changed_(false)
+    , journal_(std::make_shared<stats_journal>(file_name_ + L".journal"))
+    , journal_generation_(0)
+    , journal_size_(0)
+    , journaled_events_(0)
+    , accumulated_changed_(false)
+    , compaction_needed_(false)
     , stats_thread_(std::make_unique<async_executer>("stats"))
     , last_sent_time_(std::chrono::system_clock::now())
 {
@@ -198,10 +213,25 @@ void statistics::start_send()
 bool statistics::load()
 {
     core::tools::binary_stream bstream;
-    if (!bstream.load_from_file(file_name_))
-        return false;
+    const auto loaded = bstream.load_from_file(file_name_) && unserialize(bstream);
+
+    // the journal continues the snapshot of journal_generation_
+    for (const auto& record : journal_->read(journal_generation_))
+    {
+        const auto record_size = stats_journal::record_size(record);
+        if (!apply_journal_record(record))
+        {
+            assert(false);
+            compaction_needed_ = true;
+            break;
+        }
+
+        journal_size_ += record_size;
+    }
 
-    return unserialize(bstream);
+    journaled_events_ = events_.size();
+
+    return loaded;
 }
 
 void statistics::serialize(tools::binary_stream& _bs) const
@@ -213,6 +243,7 @@ void statistics::serialize(tools::binary_stream& _bs) const
     {
         tools::tlvpack value_tlv;
         value_tlv.push_child(tools::tlv(statistics_info_types::last_sent_time, (int64_t)std::chrono::system_clock::to_time_t(last_sent_time_)));
+        value_tlv.push_child(tools::tlv(statistics_info_types::journal_generation, journal_generation_));
 
         tools::binary_stream bs_value;
         value_tlv.serialize(bs_value);
@@ -221,33 +252,10 @@ void statistics::serialize(tools::binary_stream& _bs) const
 
     auto serialize_events = [&pack, &counter](const decltype(events_)& events)
     {
-        for (auto stat_event = events.begin(); stat_event != events.end(); ++stat_event)
+        for (const auto& stat_event : events)
         {
-            tools::tlvpack value_tlv;
-            // TODO : push id, time, ..
-            value_tlv.push_child(tools::tlv(statistics_info_types::event_name, stat_event->get_name()));
-            value_tlv.push_child(tools::tlv(statistics_info_types::event_time, (int64_t)std::chrono::system_clock::to_time_t(stat_event->get_time())));
-            value_tlv.push_child(tools::tlv(statistics_info_types::event_id, (int64_t)stat_event->get_id()));
-
-            tools::tlvpack props_pack;
-            int32_t prop_counter = 0;
-            auto props = stat_event->get_props();
-
-            for (auto prop : props)
-            {
-                tools::tlvpack value_tlv_prop;
-                value_tlv_prop.push_child(tools::tlv(statistics_info_types::event_prop_name, prop.first));
-                value_tlv_prop.push_child(tools::tlv(statistics_info_types::event_prop_value, prop.second));
-
-                tools::binary_stream bs_value;
-                value_tlv_prop.serialize(bs_value);
-                props_pack.push_child(tools::tlv(++prop_counter, bs_value));
-            }
-
-            value_tlv.push_child(tools::tlv(statistics_info_types::event_props, props_pack));
-
             tools::binary_stream bs_value;
-            value_tlv.serialize(bs_value);
+            stat_event.serialize(bs_value);
             pack.push_child(tools::tlv(++counter, bs_value));
         }
     };
@@ -258,16 +266,14 @@ void statistics::serialize(tools::binary_stream& _bs) const
     pack.serialize(_bs);
 }
 
-bool unserialize_props(tools::tlvpack& prop_pack, event_props_type* props)
+bool unserialize_props(const tools::tlvpack_view& prop_pack, event_props_type* props)
 {
     assert(!!props);
 
-    for (auto tlv_prop_val = prop_pack.get_first(); tlv_prop_val; tlv_prop_val = prop_pack.get_next())
+    for (const auto& tlv_prop_val : prop_pack)
     {
-        tools::binary_stream val_data = tlv_prop_val->get_value<tools::binary_stream>();
-
-        tools::tlvpack pack_val;
-        if (!pack_val.unserialize(val_data))
+        const auto pack_val = tlv_prop_val.get_value<tools::tlvpack_view>();
+        if (!pack_val.is_valid())
         {
             assert(false);
             return false;
@@ -297,17 +303,15 @@ bool statistics::unserialize(tools::binary_stream& _bs)
         return false;
     }
 
-    tools::tlvpack pack;
-    if (!pack.unserialize(_bs))
+    const tools::tlvpack_view pack(_bs);
+    if (!pack.is_valid())
         return false;
 
     int32_t counter = 0;
-    for (auto tlv_val = pack.get_first(); tlv_val; tlv_val = pack.get_next())
+    for (const auto& tlv_val : pack)
     {
-        tools::binary_stream val_data = tlv_val->get_value<tools::binary_stream>();
-
-        tools::tlvpack pack_val;
-        if (!pack_val.unserialize(val_data))
+        const auto pack_val = tlv_val.get_value<tools::tlvpack_view>();
+        if (!pack_val.is_valid())
             return false;
 
         if (counter++ == 0)
@@ -322,68 +326,207 @@ bool statistics::unserialize(tools::binary_stream& _bs)
 
             time_t last_time = tlv_last_sent_time->get_value<int64_t>();
             last_sent_time_ = std::chrono::system_clock::from_time_t(last_time);
+
+            if (const auto tlv_generation = pack_val.get_item(statistics_info_types::journal_generation))
+                journal_generation_ = tlv_generation->get_value<uint32_t>(0);
         }
-        else
+        else if (!unserialize_event(pack_val))
         {
-            auto curr_event_name = pack_val.get_item(statistics_info_types::event_name);
+            return false;
+        }
+    }
 
-            if (!curr_event_name)
-            {
-                assert(false);
-                return false;
-            }
-            stats_event_names name = curr_event_name->get_value<stats_event_names>();
+    return true;
+}
 
-            auto tlv_event_time = pack_val.get_item(statistics_info_types::event_time);
-            auto tlv_event_id = pack_val.get_item(statistics_info_types::event_id);
-            if (!tlv_event_time || !tlv_event_id)
-            {
-                assert(false);
-                return false;
-            }
+bool statistics::unserialize_event(const tools::tlvpack_view& _pack)
+{
+    auto curr_event_name = _pack.get_item(statistics_info_types::event_name);
 
-            event_props_type props;
-            const auto tlv_prop_pack = pack_val.get_item(statistics_info_types::event_props);
-            assert(tlv_prop_pack);
-            if (tlv_prop_pack)
-            {
-                auto prop_pack = tlv_prop_pack->get_value<tools::tlvpack>();
-                if (!unserialize_props(prop_pack, &props))
-                {
-                    assert(false);
-                    return false;
-                }
-            }
+    if (!curr_event_name)
+    {
+        assert(false);
+        return false;
+    }
+    stats_event_names name = curr_event_name->get_value<stats_event_names>();
 
-            auto read_event_time = std::chrono::system_clock::from_time_t(tlv_event_time->get_value<int64_t>());
-            auto read_event_id = tlv_event_id->get_value<int64_t>();
-            insert_event(name, props, read_event_time, read_event_id);
+    auto tlv_event_time = _pack.get_item(statistics_info_types::event_time);
+    auto tlv_event_id = _pack.get_item(statistics_info_types::event_id);
+    if (!tlv_event_time || !tlv_event_id)
+    {
+        assert(false);
+        return false;
+    }
+
+    event_props_type props;
+    const auto tlv_prop_pack = _pack.get_item(statistics_info_types::event_props);
+    assert(tlv_prop_pack);
+    if (tlv_prop_pack)
+    {
+        if (!unserialize_props(tlv_prop_pack->get_value<tools::tlvpack_view>(), &props))
+        {
+            assert(false);
+            return false;
         }
     }
 
+    auto read_event_time = std::chrono::system_clock::from_time_t(tlv_event_time->get_value<int64_t>());
+    auto read_event_id = tlv_event_id->get_value<int64_t>();
+    insert_event(name, props, read_event_time, read_event_id);
+
     return true;
 }
 
+bool statistics::apply_journal_record(const tools::binary_stream& _record)
+{
+    const tools::tlvpack_view pack(_record);
+    if (!pack.is_valid())
+        return false;
+
+    const auto tlv_type = pack.get_item(statistics_info_types::journal_record_type);
+    const auto tlv_data = pack.get_item(statistics_info_types::journal_record_data);
+    if (!tlv_type || !tlv_data)
+        return false;
+
+    const auto data_pack = tlv_data->get_value<tools::tlvpack_view>();
+    if (!data_pack.is_valid())
+        return false;
+
+    switch (tlv_type->get_value<uint32_t>(0))
+    {
+    case journal_record_types::journal_record_event:
+        return unserialize_event(data_pack);
+
+    case journal_record_types::journal_record_accumulated_events:
+        // the record holds all the accumulated events at the moment it was made
+        accumulated_events_.clear();
+        for (const auto& tlv_val : data_pack)
+        {
+            const auto pack_val = tlv_val.get_value<tools::tlvpack_view>();
+            if (!pack_val.is_valid() || !unserialize_event(pack_val))
+                return false;
+        }
+        return true;
+
+    default:
+        return false;
+    }
+}
+
 void statistics::save_if_needed()
 {
-    if (g_core && changed_)
+    apply_pending_events();
+
+    if (!g_core)
+        return;
+
+    if (compaction_needed_ || journal_size_ > max_stats_journal_size)
+    {
+        compact();
+        return;
+    }
+
+    std::vector<tools::binary_stream> records;
+
+    const auto add_record = [&records](journal_record_types _type, const tools::binary_stream& _data)
     {
-        changed_ = false;
+        tools::tlvpack pack;
+        pack.push_child(tools::tlv(statistics_info_types::journal_record_type, uint32_t(_type)));
+        pack.push_child(tools::tlv(statistics_info_types::journal_record_data, _data));
 
-        auto bs_data = std::make_shared<tools::binary_stream>();
-        serialize(*bs_data);
-        std::wstring file_name = file_name_;
+        tools::binary_stream record;
+        pack.serialize(record);
+        records.push_back(std::move(record));
+    };
 
-        g_core->run_async([bs_data, file_name]
+    for (auto i = journaled_events_; i < events_.size(); ++i)
+    {
+        tools::binary_stream bs_value;
+        events_[i].serialize(bs_value);
+        add_record(journal_record_types::journal_record_event, bs_value);
+    }
+    journaled_events_ = events_.size();
+
+    if (accumulated_changed_)
+    {
+        accumulated_changed_ = false;
+
+        tools::tlvpack pack;
+        int32_t counter = 0;
+        for (const auto& stat_event : accumulated_events_)
         {
-            bs_data->save_2_file(file_name);
-            return 0;
-        });
+            tools::binary_stream bs_value;
+            stat_event.serialize(bs_value);
+            pack.push_child(tools::tlv(++counter, bs_value));
+        }
+
+        tools::binary_stream bs_value;
+        pack.serialize(bs_value);
+        add_record(journal_record_types::journal_record_accumulated_events, bs_value);
     }
+
+    if (records.empty())
+        return;
+
+    for (const auto& record : records)
+        journal_size_ += stats_journal::record_size(record);
+
+    stats_thread_->run_async_function([journal = journal_, records = std::move(records)]
+    {
+        return journal->append(records) ? 0 : -1;
+
+    })->on_result_ = [wr_this = weak_from_this()](int32_t _error)
+    {
+        if (_error == 0)
+            return;
+
+        if (auto ptr_this = wr_this.lock())
+            ptr_this->compaction_needed_ = true;
+    };
+}
+
+void statistics::compact()
+{
+    ++journal_generation_;
+
+    auto bs_data = std::make_shared<tools::binary_stream>();
+    serialize(*bs_data);
+
+    journal_size_ = 0;
+    journaled_events_ = events_.size();
+    accumulated_changed_ = false;
+    compaction_needed_ = false;
+
+    stats_thread_->run_async_function([bs_data, file_name = file_name_, journal = journal_, generation = journal_generation_]
+    {
+        // until the snapshot is replaced the old one and its journal stay consistent
+        if (!bs_data->save_2_file(file_name))
+            return -1;
+
+        return journal->reset(generation) ? 0 : -1;
+
+    })->on_result_ = [wr_this = weak_from_this()](int32_t _error)
+    {
+        if (_error == 0)
+            return;
+
+        if (auto ptr_this = wr_this.lock())
+            ptr_this->compaction_needed_ = true;
+    };
+}
+
+void statistics::apply_pending_events()
+{
+    pending_events_.consume([this](pending_event&& _event)
+    {
+        apply_event(_event.name_, _event.props_, _event.time_);
+    });
 }
 
 void statistics::clear()
 {
+    apply_pending_events();
+
     last_sent_time_ = std::chrono::system_clock::now();
 
     if (!events_.empty())
@@ -401,7 +544,8 @@ void statistics::clear()
         events_.push_back(last_service_event);
     }
 
-    changed_ = true;
+    // the journal still has the sent events
+    compaction_needed_ = true;
 
     // reset_session_event_id();
     // TODO : mb need save map with counts here?
@@ -409,6 +553,8 @@ void statistics::clear()
 
 void statistics::send_async()
 {
+    apply_pending_events();
+
     if (events_.empty())
         return;
 
@@ -623,22 +769,27 @@ void statistics::insert_event(stats_event_names _event_name, const event_props_t
         if (it == props.cend())
         {
             accumulated_events_.emplace_back(_event_name, _event_time, _event_id, props);
+            accumulated_changed_ = true;
             return;
         }
     }
 
     events_.emplace_back(_event_name, _event_time, _event_id, props);
-    changed_ = true;
 }
 
 void statistics::insert_event(stats_event_names _event_name, const event_props_type& _props)
+{
+    pending_events_.push({ _event_name, _props, std::chrono::system_clock::now() });
+}
+
+void statistics::apply_event(stats_event_names _event_name, const event_props_type& _props, std::chrono::system_clock::time_point _event_time)
 {
     if (_event_name == stats_event_names::start_session)
     {
         stats_event::reset_session_event_id();
-        insert_event(core::stats::stats_event_names::service_session_start, _props);
+        insert_event(core::stats::stats_event_names::service_session_start, _props, _event_time, -1);
     }
-    insert_event(_event_name, _props, std::chrono::system_clock::now(), -1);
+    insert_event(_event_name, _props, _event_time, -1);
 }
 
 void statistics::insert_event(stats_event_names _event_name)
@@ -721,6 +872,31 @@ int32_t statistics::stats_event::get_id() const
     return event_id_;
 }
 
+void statistics::stats_event::serialize(tools::binary_stream& _bs) const
+{
+    tools::tlvpack value_tlv;
+    value_tlv.push_child(tools::tlv(statistics_info_types::event_name, name_));
+    value_tlv.push_child(tools::tlv(statistics_info_types::event_time, (int64_t)std::chrono::system_clock::to_time_t(event_time_)));
+    value_tlv.push_child(tools::tlv(statistics_info_types::event_id, (int64_t)event_id_));
+
+    tools::tlvpack props_pack;
+    int32_t prop_counter = 0;
+
+    for (const auto& prop : props_)
+    {
+        tools::tlvpack value_tlv_prop;
+        value_tlv_prop.push_child(tools::tlv(statistics_info_types::event_prop_name, prop.first));
+        value_tlv_prop.push_child(tools::tlv(statistics_info_types::event_prop_value, prop.second));
+
+        tools::binary_stream bs_value;
+        value_tlv_prop.serialize(bs_value);
+        props_pack.push_child(tools::tlv(++prop_counter, bs_value));
+    }
+
+    value_tlv.push_child(tools::tlv(statistics_info_types::event_props, props_pack));
+    value_tlv.serialize(_bs);
+}
+
 bool statistics::stats_event::finished_accumulating()
 {
     if (!is_accumulated_event(name_))
@@ -789,6 +965,8 @@ void statistics::increment_event_prop(stats_event_names _event_name,
     static_assert(std::is_integral<ValueType>::value);
     assert(is_accumulated_event(_event_name));
 
+    apply_pending_events();
+
     auto cnt = 0;
 
     std::vector<int> to_remove;
@@ -816,7 +994,7 @@ void statistics::increment_event_prop(stats_event_names _event_name,
             }
 
             // set last send time for new empty event
-            insert_event(name, props);
+            apply_event(name, props, std::chrono::system_clock::now());
             to_remove.push_back(i);
         }
     }
@@ -834,10 +1012,10 @@ void statistics::increment_event_prop(stats_event_names _event_name,
             { _prop_key, std::to_string(_value) }
         };
 
-        insert_event(_event_name, props);
+        apply_event(_event_name, props, std::chrono::system_clock::now());
     }
 
-    changed_ = true;
+    accumulated_changed_ = true;
 }
 
 template void statistics::increment_event_prop<int32_t>(stats_event_names _event_name,
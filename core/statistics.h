@@ -1,6 +1,7 @@
 #pragma once
 
 #include "proxy_settings.h"
+#include "stats/pending_events.h"
 
 namespace core
 {
@@ -10,6 +11,7 @@ namespace core
     namespace tools
     {
         class binary_stream;
+        class tlvpack_view;
     }
 
     const static std::string flurry_url = "https://data.flurry.com/aah.do";
@@ -23,12 +25,14 @@ namespace core
 #endif // DEBUG
 
     const static auto save_to_file_interval = std::chrono::seconds(10);
+    const static uint32_t max_stats_journal_size = 256 * 1024;
     const static auto delay_send_on_start = std::chrono::seconds(10);
     const static auto fetch_disk_size_interval = std::chrono::hours(24);
 
     namespace stats
     {
         enum class stats_event_names;
+        class stats_journal;
 
         class statistics : public std::enable_shared_from_this<statistics>
         {
@@ -62,6 +66,8 @@ namespace core
 
                 bool finished_accumulating();
 
+                void serialize(tools::binary_stream& _bs) const;
+
             private:
                 stats_event_names name_;
                 int32_t event_id_; // natural serial number, starting from 1
@@ -79,6 +85,14 @@ namespace core
                 }
             };
 
+            // event inserted from any thread, waits in pending_events_ until the core thread applies it
+            struct pending_event
+            {
+                stats_event_names name_;
+                event_props_type props_;
+                std::chrono::system_clock::time_point time_;
+            };
+
             uint64_t last_used_ram_mb_ = 0;
 
             typedef std::vector<stats_event>::const_iterator events_ci;
@@ -89,7 +103,17 @@ namespace core
 
             disk_stats disk_stats_;
 
-            bool changed_;
+            pending_events<pending_event> pending_events_;
+
+            // the snapshot in file_name_ is followed by the journal of the records made after it,
+            // the journal is used on the stats thread only
+            std::shared_ptr<stats_journal> journal_;
+            uint32_t journal_generation_;
+            uint32_t journal_size_;
+            size_t journaled_events_;
+            bool accumulated_changed_;
+            bool compaction_needed_;
+
             uint32_t save_timer_;
             uint32_t disk_stats_timer_;
             uint32_t ram_stats_timer_;
@@ -105,7 +129,12 @@ namespace core
 
             void serialize(tools::binary_stream& _bs) const;
             bool unserialize(tools::binary_stream& _bs);
+            bool unserialize_event(const tools::tlvpack_view& _pack);
+            bool apply_journal_record(const tools::binary_stream& _record);
             void save_if_needed();
+            void compact();
+            void apply_pending_events();
+            void apply_event(stats_event_names _event_name, const event_props_type& _props, std::chrono::system_clock::time_point _event_time);
             void send_async();
             void set_disk_stats(const disk_stats &_stats);
             void query_disk_size_async();
@@ -126,6 +155,8 @@ namespace core
             virtual ~statistics();
 
             void init();
+
+            // can be called from any thread
             void insert_event(stats_event_names _event_name, const event_props_type& _props);
             void insert_event(stats_event_names _event_name);
 
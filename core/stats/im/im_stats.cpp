@@ -7,6 +7,7 @@
 #include "tools/strings.h"
 #include "tools/system.h"
 #include "tools/tlv.h"
+#include "stats/stats_journal.h"
 #include "http_request.h"
 #include "async_task.h"
 #include "utils.h"
@@ -30,6 +31,7 @@ enum im_stats_info_types
     event_prop_value = 6,
     last_sent_time = 7,
     event_time = 8,
+    journal_generation = 9,
 };
 
 std::shared_ptr<im_stats::stop_objects> im_stats::stop_objects_;
@@ -54,7 +56,6 @@ std::string get_client_stat_url()
 
 im_stats::im_stats(std::wstring _file_name)
     : file_name_(std::move(_file_name))
-    , changed_(false)
     , is_sending_(false)
     , save_timer_id_(0)
     , send_timer_id_(0)
@@ -64,6 +65,11 @@ im_stats::im_stats(std::wstring _file_name)
     , start_send_time_(std::chrono::system_clock::now())
     , events_send_interval_(omicron_get_events_send_interval())
     , events_max_store_interval_(omicron_get_events_max_store_interval())
+    , journal_(std::make_shared<stats_journal>(file_name_ + L".journal"))
+    , journal_generation_(0)
+    , journal_size_(0)
+    , journaled_events_(0)
+    , compaction_needed_(false)
 {
     stop_objects_ = std::make_shared<stop_objects>();
 }
@@ -167,10 +173,26 @@ void im_stats::start_send(bool _check_start_now)
 bool im_stats::load()
 {
     core::tools::binary_stream bstream;
-    if (!bstream.load_from_file(file_name_))
-        return false;
+    const auto loaded = bstream.load_from_file(file_name_) && unserialize(bstream);
 
-    return unserialize(bstream);
+    // the journal continues the snapshot of journal_generation_
+    for (const auto& record : journal_->read(journal_generation_))
+    {
+        const auto record_size = stats_journal::record_size(record);
+        const tools::tlvpack_view pack(record);
+        if (!pack.is_valid() || !unserialize_event(pack))
+        {
+            assert(false);
+            compaction_needed_ = true;
+            break;
+        }
+
+        journal_size_ += record_size;
+    }
+
+    journaled_events_ = events_.size();
+
+    return loaded;
 }
 
 void im_stats::serialize(tools::binary_stream& _bs) const
@@ -183,6 +205,7 @@ void im_stats::serialize(tools::binary_stream& _bs) const
         tools::tlvpack value_tlv;
         value_tlv.push_child(tools::tlv(im_stats_info_types::last_sent_time,
                                         static_cast<int64_t>(std::chrono::system_clock::to_time_t(last_sent_time_))));
+        value_tlv.push_child(tools::tlv(im_stats_info_types::journal_generation, journal_generation_));
         tools::binary_stream bs_value;
         value_tlv.serialize(bs_value);
         pack.push_child(tools::tlv(++counter, bs_value));
@@ -190,47 +213,22 @@ void im_stats::serialize(tools::binary_stream& _bs) const
 
     for (const auto& event_stat : events_)
     {
-        tools::tlvpack value_tlv;
-        value_tlv.push_child(tools::tlv(im_stats_info_types::event_name,
-                                        event_stat.get_name()));
-        value_tlv.push_child(tools::tlv(im_stats_info_types::event_time,
-                                        static_cast<int64_t>(std::chrono::system_clock::to_time_t(event_stat.get_time()))));
-
-        tools::tlvpack props_pack;
-        uint32_t prop_counter = 0;
-        auto props = event_stat.get_props();
-
-        for (auto prop : props)
-        {
-            tools::tlvpack value_tlv_prop;
-            value_tlv_prop.push_child(tools::tlv(im_stats_info_types::event_prop_name, prop.first));
-            value_tlv_prop.push_child(tools::tlv(im_stats_info_types::event_prop_value, prop.second));
-
-            tools::binary_stream bs_value;
-            value_tlv_prop.serialize(bs_value);
-            props_pack.push_child(tools::tlv(++prop_counter, bs_value));
-        }
-
-        value_tlv.push_child(tools::tlv(im_stats_info_types::event_props, props_pack));
-
         tools::binary_stream bs_value;
-        value_tlv.serialize(bs_value);
+        event_stat.serialize(bs_value);
         pack.push_child(tools::tlv(++counter, bs_value));
     }
 
     pack.serialize(_bs);
 }
 
-bool im_stats::unserialize_props(tools::tlvpack& prop_pack, event_props_type* props)
+bool im_stats::unserialize_props(const tools::tlvpack_view& prop_pack, event_props_type* props)
 {
     assert(!!props);
 
-    for (auto tlv_prop_val = prop_pack.get_first(); tlv_prop_val; tlv_prop_val = prop_pack.get_next())
+    for (const auto& tlv_prop_val : prop_pack)
     {
-        tools::binary_stream val_data = tlv_prop_val->get_value<tools::binary_stream>();
-
-        tools::tlvpack pack_val;
-        if (!pack_val.unserialize(val_data))
+        const auto pack_val = tlv_prop_val.get_value<tools::tlvpack_view>();
+        if (!pack_val.is_valid())
         {
             assert(false);
             return false;
@@ -258,17 +256,15 @@ bool im_stats::unserialize(tools::binary_stream& _bs)
         return false;
     }
 
-    tools::tlvpack pack;
-    if (!pack.unserialize(_bs))
+    const tools::tlvpack_view pack(_bs);
+    if (!pack.is_valid())
         return false;
 
     uint32_t counter = 0;
-    for (auto tlv_val = pack.get_first(); tlv_val; tlv_val = pack.get_next())
+    for (const auto& tlv_val : pack)
     {
-        tools::binary_stream val_data = tlv_val->get_value<tools::binary_stream>();
-
-        tools::tlvpack pack_val;
-        if (!pack_val.unserialize(val_data))
+        const auto pack_val = tlv_val.get_value<tools::tlvpack_view>();
+        if (!pack_val.is_valid())
             return false;
 
         if (counter++ == 0)
@@ -283,65 +279,135 @@ bool im_stats::unserialize(tools::binary_stream& _bs)
 
             time_t last_time = tlv_last_sent_time->get_value<int64_t>();
             last_sent_time_ = std::chrono::system_clock::from_time_t(last_time);
+
+            if (const auto tlv_generation = pack_val.get_item(im_stats_info_types::journal_generation))
+                journal_generation_ = tlv_generation->get_value<uint32_t>(0);
         }
-        else
+        else if (!unserialize_event(pack_val))
         {
-            auto curr_event_name = pack_val.get_item(im_stats_info_types::event_name);
-            if (!curr_event_name)
-            {
-                assert(false);
-                return false;
-            }
-            auto name = curr_event_name->get_value<im_stat_event_names>();
+            return false;
+        }
+    }
 
-            auto tlv_event_time = pack_val.get_item(im_stats_info_types::event_time);
-            if (!tlv_event_time)
-            {
-                assert(false);
-                return false;
-            }
-            auto read_event_time = std::chrono::system_clock::from_time_t(tlv_event_time->get_value<int64_t>());
+    return true;
+}
 
-            event_props_type props;
-            const auto tlv_prop_pack = pack_val.get_item(im_stats_info_types::event_props);
-            assert(tlv_prop_pack);
-            if (tlv_prop_pack)
-            {
-                auto prop_pack = tlv_prop_pack->get_value<tools::tlvpack>();
-                if (!unserialize_props(prop_pack, &props))
-                {
-                    assert(false);
-                    return false;
-                }
-            }
+bool im_stats::unserialize_event(const tools::tlvpack_view& _pack)
+{
+    auto curr_event_name = _pack.get_item(im_stats_info_types::event_name);
+    if (!curr_event_name)
+    {
+        assert(false);
+        return false;
+    }
+    auto name = curr_event_name->get_value<im_stat_event_names>();
+
+    auto tlv_event_time = _pack.get_item(im_stats_info_types::event_time);
+    if (!tlv_event_time)
+    {
+        assert(false);
+        return false;
+    }
+    auto read_event_time = std::chrono::system_clock::from_time_t(tlv_event_time->get_value<int64_t>());
 
-            insert_event(name, std::move(props), read_event_time);
+    event_props_type props;
+    const auto tlv_prop_pack = _pack.get_item(im_stats_info_types::event_props);
+    assert(tlv_prop_pack);
+    if (tlv_prop_pack)
+    {
+        if (!unserialize_props(tlv_prop_pack->get_value<tools::tlvpack_view>(), &props))
+        {
+            assert(false);
+            return false;
         }
     }
 
+    insert_event(name, std::move(props), read_event_time);
+
     return true;
 }
 
 void im_stats::save_if_needed()
 {
-    if (changed_)
+    apply_pending_events();
+
+    if (!g_core)
+        return;
+
+    if (compaction_needed_ || journal_size_ > max_im_stats_journal_size)
     {
-        changed_ = false;
+        compact();
+        return;
+    }
 
-        auto bs_data = std::make_shared<tools::binary_stream>();
-        serialize(*bs_data);
-        std::wstring file_name = file_name_;
+    if (journaled_events_ >= events_.size())
+        return;
 
-        g_core->run_async([bs_data, file_name]()
-        {
-            bs_data->save_2_file(file_name);
-            return 0;
-        });
+    std::vector<tools::binary_stream> records;
+    records.reserve(events_.size() - journaled_events_);
+    for (auto i = journaled_events_; i < events_.size(); ++i)
+    {
+        tools::binary_stream record;
+        events_[i].serialize(record);
+        journal_size_ += stats_journal::record_size(record);
+        records.push_back(std::move(record));
     }
+    journaled_events_ = events_.size();
+
+    stats_thread_->run_async_function([journal = journal_, records = std::move(records)]()
+    {
+        return journal->append(records) ? 0 : -1;
+
+    })->on_result_ = [wr_this = weak_from_this()](int32_t _error)
+    {
+        if (_error == 0)
+            return;
+
+        if (auto ptr_this = wr_this.lock())
+            ptr_this->compaction_needed_ = true;
+    };
+}
+
+void im_stats::compact()
+{
+    ++journal_generation_;
+
+    auto bs_data = std::make_shared<tools::binary_stream>();
+    serialize(*bs_data);
+
+    journal_size_ = 0;
+    journaled_events_ = events_.size();
+    compaction_needed_ = false;
+
+    stats_thread_->run_async_function([bs_data, file_name = file_name_, journal = journal_, generation = journal_generation_]()
+    {
+        if (!bs_data->save_2_file(file_name))
+            return -1;
+
+        return journal->reset(generation) ? 0 : -1;
+
+    })->on_result_ = [wr_this = weak_from_this()](int32_t _error)
+    {
+        if (_error == 0)
+            return;
+
+        if (auto ptr_this = wr_this.lock())
+            ptr_this->compaction_needed_ = true;
+    };
+}
+
+void im_stats::apply_pending_events()
+{
+    pending_events_.consume([this](pending_event&& _event)
+    {
+        insert_event(_event.name_, std::move(_event.props_), _event.time_);
+    });
 }
 
 void im_stats::clear(int32_t _send_result)
 {
+    apply_pending_events();
+
     if (events_.empty())
         return;
 
@@ -381,12 +447,16 @@ void im_stats::clear(int32_t _send_result)
     if (it != end)
     {
         events_.erase(it, end);
-        changed_ = true;
+
+        // the journal still has the removed events
+        compaction_needed_ = true;
     }
 }
 
 void im_stats::send_async()
 {
+    apply_pending_events();
+
     if (events_.empty() || is_sending_)
         return;
 
@@ -544,16 +614,13 @@ void im_stats::insert_event(im_stat_event_names _event_name,
                             std::chrono::system_clock::time_point _event_time)
 {
     if (_event_name > im_stat_event_names::min && _event_name < im_stat_event_names::max)
-    {
         events_.emplace_back(_event_name, std::move(_props), _event_time);
-        changed_ = true;
-    }
 }
 
 void im_stats::insert_event(im_stat_event_names _event_name,
                             event_props_type&& _props)
 {
-    insert_event(_event_name, std::move(_props), std::chrono::system_clock::now());
+    pending_events_.push({ _event_name, std::move(_props), std::chrono::system_clock::now() });
 }
 
 void im_stats::mark_all_events_sent(bool _is_sent)
@@ -597,6 +664,31 @@ void im_stats::im_stats_event::serialize(rapidjson::Value& _node, rapidjson_allo
     }
 }
 
+void im_stats::im_stats_event::serialize(tools::binary_stream& _bs) const
+{
+    tools::tlvpack value_tlv;
+    value_tlv.push_child(tools::tlv(im_stats_info_types::event_name, name_));
+    value_tlv.push_child(tools::tlv(im_stats_info_types::event_time,
+                                    static_cast<int64_t>(std::chrono::system_clock::to_time_t(time_))));
+
+    tools::tlvpack props_pack;
+    uint32_t prop_counter = 0;
+
+    for (const auto& prop : props_)
+    {
+        tools::tlvpack value_tlv_prop;
+        value_tlv_prop.push_child(tools::tlv(im_stats_info_types::event_prop_name, prop.first));
+        value_tlv_prop.push_child(tools::tlv(im_stats_info_types::event_prop_value, prop.second));
+
+        tools::binary_stream bs_value;
+        value_tlv_prop.serialize(bs_value);
+        props_pack.push_child(tools::tlv(++prop_counter, bs_value));
+    }
+
+    value_tlv.push_child(tools::tlv(im_stats_info_types::event_props, props_pack));
+    value_tlv.serialize(_bs);
+}
+
 im_stat_event_names im_stats::im_stats_event::get_name() const
 {
     return name_;
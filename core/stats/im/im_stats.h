@@ -2,6 +2,7 @@
 
 #include "proxy_settings.h"
 #include "../../connections/urls_cache.h"
+#include "../pending_events.h"
 
 namespace core
 {
@@ -10,16 +11,18 @@ namespace core
     namespace tools
     {
         class binary_stream;
-        class tlvpack;
+        class tlvpack_view;
     }
 
     const static auto save_events_to_file_interval = std::chrono::seconds(10);
     const static auto delay_send_events_on_start = std::chrono::seconds(10);
+    const static uint32_t max_im_stats_journal_size = 256 * 1024;
 
 
     namespace stats
     {
         enum class im_stat_event_names;
+        class stats_journal;
 
         class im_stats : public std::enable_shared_from_this<im_stats>
         {
@@ -28,6 +31,8 @@ namespace core
             virtual ~im_stats();
 
             void init();
+
+            // can be called from any thread
             void insert_event(im_stat_event_names _event_name, event_props_type&& _props);
 
         private:
@@ -43,6 +48,7 @@ namespace core
                 im_stats_event& operator=(im_stats_event&&) noexcept = default;
 
                 void serialize(rapidjson::Value& _node, rapidjson_allocator& _a) const;
+                void serialize(tools::binary_stream& _bs) const;
 
                 im_stat_event_names get_name() const;
                 const event_props_type& get_props() const;
@@ -60,6 +66,13 @@ namespace core
                 bool event_sent_;
             };
 
+            struct pending_event
+            {
+                im_stat_event_names name_;
+                event_props_type props_;
+                std::chrono::system_clock::time_point time_;
+            };
+
             struct stop_objects
             {
                 std::atomic_bool is_stop_;
@@ -75,7 +88,6 @@ namespace core
                                 const std::wstring& _file_name);
 
             std::wstring file_name_;
-            bool changed_;
             bool is_sending_;
             uint32_t save_timer_id_;
             uint32_t send_timer_id_;
@@ -83,6 +95,15 @@ namespace core
             std::unique_ptr<async_executer> stats_thread_;
             std::vector<im_stats_event> events_;
 
+            pending_events<pending_event> pending_events_;
+
+            // records of the events inserted after the snapshot in file_name_, used on the stats thread only
+            std::shared_ptr<stats_journal> journal_;
+            uint32_t journal_generation_;
+            uint32_t journal_size_;
+            size_t journaled_events_;
+            bool compaction_needed_;
+
             std::chrono::system_clock::time_point last_sent_time_;
             std::chrono::system_clock::time_point start_send_time_;
             std::chrono::seconds events_send_interval_;
@@ -92,12 +113,15 @@ namespace core
             std::string get_post_data() const;
 
             void serialize(tools::binary_stream& _bs) const;
-            bool unserialize_props(tools::tlvpack& prop_pack, event_props_type* props);
+            bool unserialize_props(const tools::tlvpack_view& prop_pack, event_props_type* props);
             bool unserialize(tools::binary_stream& _bs);
+            bool unserialize_event(const tools::tlvpack_view& _pack);
 
             bool load();
             void clear(int32_t _send_result);
             void save_if_needed();
+            void compact();
+            void apply_pending_events();
             void send_async();
             void start_save();
             void start_send(bool _check_start_now = true);
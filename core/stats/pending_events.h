@@ -0,0 +1,64 @@
+#pragma once
+
+namespace core
+{
+    namespace stats
+    {
+        // lock-free multi-producer single-consumer list, events are pushed from any thread
+        // and taken by the thread that owns the stats
+        template <class T_>
+        class pending_events
+        {
+            struct node
+            {
+                T_ value_;
+                node* next_;
+            };
+
+            // the newest node on top
+            std::atomic<node*> top_ { nullptr };
+
+        public:
+
+            pending_events() = default;
+            pending_events(const pending_events&) = delete;
+            pending_events& operator=(const pending_events&) = delete;
+
+            ~pending_events()
+            {
+                consume([](T_&&) {});
+            }
+
+            void push(T_ _value)
+            {
+                auto item = new node{ std::move(_value), top_.load(std::memory_order_relaxed) };
+                while (!top_.compare_exchange_weak(item->next_, item, std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            // calls _func for all the pushed events in the push order
+            template <class F_>
+            void consume(F_ _func)
+            {
+                auto top = top_.exchange(nullptr, std::memory_order_acquire);
+
+                node* head = nullptr;
+                while (top)
+                {
+                    auto next = top->next_;
+                    top->next_ = head;
+                    head = top;
+                    top = next;
+                }
+
+                while (head)
+                {
+                    std::unique_ptr<node> item(head);
+                    head = head->next_;
+                    _func(std::move(item->value_));
+                }
+            }
+        };
+    }
+}
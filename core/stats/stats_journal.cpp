@@ -0,0 +1,152 @@
+#include "stdafx.h"
+#include "stats_journal.h"
+
+#include "tools/binary_stream.h"
+#include "tools/system.h"
+
+using namespace core;
+using namespace stats;
+
+namespace
+{
+    constexpr uint32_t journal_magic = 0x4c4e524a; // "JRNL"
+    constexpr uint32_t journal_version = 1;
+    constexpr uint32_t header_size = sizeof(uint32_t) * 3;
+    constexpr uint32_t record_header_size = sizeof(uint32_t) * 2;
+
+    uint32_t checksum(const char* _data, uint32_t _size) noexcept
+    {
+        uint32_t hash = 2166136261u;
+        for (uint32_t i = 0; i < _size; ++i)
+        {
+            hash ^= static_cast<uint8_t>(_data[i]);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    void write_record(const tools::binary_stream& _record, tools::binary_stream& _out)
+    {
+        const uint32_t size = _record.available();
+        const char* data = size ? _record.get_data() : nullptr;
+
+        _out.write<uint32_t>(size);
+        _out.write<uint32_t>(checksum(data, size));
+        if (size)
+            _out.write(data, size);
+    }
+
+    tools::binary_stream make_header(uint32_t _generation)
+    {
+        tools::binary_stream header;
+        header.write<uint32_t>(journal_magic);
+        header.write<uint32_t>(journal_version);
+        header.write<uint32_t>(_generation);
+        return header;
+    }
+}
+
+stats_journal::stats_journal(std::wstring _file_name)
+    : file_name_(std::move(_file_name))
+{
+}
+
+std::vector<tools::binary_stream> stats_journal::read(uint32_t _generation)
+{
+    std::vector<tools::binary_stream> records;
+
+    tools::binary_stream bs;
+    if (!bs.load_from_file(file_name_) || bs.available() < header_size)
+    {
+        reset(_generation);
+        return records;
+    }
+
+    const auto magic = bs.read<uint32_t>();
+    const auto version = bs.read<uint32_t>();
+    const auto generation = bs.read<uint32_t>();
+    if (magic != journal_magic || version != journal_version || generation != _generation)
+    {
+        reset(_generation);
+        return records;
+    }
+
+    has_header_ = true;
+
+    bool torn = false;
+    while (bs.available())
+    {
+        if (bs.available() < record_header_size)
+        {
+            torn = true;
+            break;
+        }
+
+        const auto size = bs.read<uint32_t>();
+        const auto sum = bs.read<uint32_t>();
+        if (bs.available() < size)
+        {
+            torn = true;
+            break;
+        }
+
+        const char* data = size ? bs.read(size) : nullptr;
+        if (checksum(data, size) != sum)
+        {
+            torn = true;
+            break;
+        }
+
+        tools::binary_stream record;
+        if (size)
+            record.write(data, size);
+        records.push_back(std::move(record));
+    }
+
+    // rewrite the valid part, the next append would land behind the garbage otherwise
+    if (torn && !(reset(_generation) && append(records)))
+        records.clear();
+
+    return records;
+}
+
+bool stats_journal::append(const std::vector<tools::binary_stream>& _records)
+{
+    if (_records.empty())
+        return true;
+
+    // a failed write could leave a torn tail, nothing is appended until the next reset
+    if (!has_header_)
+        return false;
+
+    tools::binary_stream out;
+    for (const auto& record : _records)
+        write_record(record, out);
+
+    auto outfile = tools::system::open_file_for_write(file_name_, std::ofstream::binary | std::ofstream::app);
+    if (!outfile.is_open())
+        return false;
+
+    const auto size = out.available();
+    outfile.write(out.read(size), size);
+    outfile.flush();
+
+    if (!outfile.good())
+    {
+        has_header_ = false;
+        return false;
+    }
+
+    return true;
+}
+
+bool stats_journal::reset(uint32_t _generation)
+{
+    has_header_ = make_header(_generation).save_2_file(file_name_);
+    return has_header_;
+}
+
+uint32_t stats_journal::record_size(const tools::binary_stream& _record)
+{
+    return record_header_size + _record.available();
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+namespace core
+{
+    namespace tools
+    {
+        class binary_stream;
+    }
+
+    namespace stats
+    {
+        // append-only log of stats records kept next to a compacted snapshot.
+        // the header holds the generation of the snapshot the records were made for,
+        // a journal left behind by a crash in the middle of a compaction doesn't match it and is dropped.
+        // every record carries its size and checksum, a torn tail is cut off on read.
+        // not thread-safe, the owner serializes the calls
+        class stats_journal
+        {
+        public:
+            explicit stats_journal(std::wstring _file_name);
+
+            // records made for _generation, empty for a missing or stale journal
+            std::vector<tools::binary_stream> read(uint32_t _generation);
+
+            // false if the records weren't written, the owner should save a snapshot and reset the journal
+            bool append(const std::vector<tools::binary_stream>& _records);
+
+            // drops all the records, called after a snapshot of _generation is saved
+            bool reset(uint32_t _generation);
+
+            static uint32_t record_size(const tools::binary_stream& _record);
+
+        private:
+            std::wstring file_name_;
+            bool has_header_ = false;
+        };
+    }
+}
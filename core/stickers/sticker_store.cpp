@@ -0,0 +1,163 @@
+#include "stdafx.h"
+
+#include "sticker_store.h"
+
+#include "../tools/binary_stream.h"
+#include "../tools/hmac_sha_base64.h"
+#include "../tools/system.h"
+
+namespace
+{
+    constexpr size_t hash_length = 64;
+
+    // the index is rewritten when the most of its lines are overridden links
+    constexpr size_t index_compaction_factor = 2;
+}
+
+namespace core
+{
+    namespace stickers
+    {
+        sticker_store::sticker_store(std::wstring _root)
+            : root_(std::move(_root))
+        {
+        }
+
+        std::wstring sticker_store::find(const std::string& _key)
+        {
+            load();
+
+            const auto it = links_.find(_key);
+            if (it == links_.end())
+                return std::wstring();
+
+            auto blob = get_blob_path(it->second);
+            if (!tools::system::is_exist(blob))
+            {
+                links_.erase(it);
+                return std::wstring();
+            }
+
+            return blob;
+        }
+
+        std::wstring sticker_store::put(const std::string& _key, const std::wstring& _file)
+        {
+            load();
+
+            tools::binary_stream data;
+            if (!data.load_from_file(_file) || !data.available())
+                return std::wstring();
+
+            char sha[hash_length + 1];
+            tools::sha256(std::string_view(data.get_data(), data.available()), sha);
+            std::string hash(sha, hash_length);
+
+            auto blob = get_blob_path(hash);
+            if (tools::system::is_exist(blob))
+            {
+                tools::system::delete_file(_file);
+            }
+            else
+            {
+                if (!tools::system::is_exist(root_) && !tools::system::create_directory(root_))
+                    return std::wstring();
+
+                if (!tools::system::move_file(_file, blob))
+                    return std::wstring();
+            }
+
+            if (auto& link = links_[_key]; link != hash)
+            {
+                link = std::move(hash);
+                if (!append_link(_key, link))
+                    save_links();
+            }
+
+            return blob;
+        }
+
+        void sticker_store::load()
+        {
+            if (loaded_)
+                return;
+
+            loaded_ = true;
+
+            auto infile = tools::system::open_file_for_read(get_index_path());
+            if (!infile.is_open())
+                return;
+
+            std::string line;
+            bool torn_tail = false;
+            while (std::getline(infile, line))
+            {
+                ++index_lines_;
+
+                // the last line has no newline, the next append would be merged into it
+                if (infile.eof())
+                    torn_tail = true;
+
+                // a torn line of a crashed append doesn't have the full hash
+                const auto separator = line.rfind(' ');
+                if (separator == std::string::npos || separator == 0 || line.size() - separator - 1 != hash_length)
+                    continue;
+
+                links_[line.substr(0, separator)] = line.substr(separator + 1);
+            }
+
+            infile.close();
+
+            // rewriting drops the torn line
+            if (torn_tail || index_lines_ > links_.size() * index_compaction_factor)
+                save_links();
+        }
+
+        bool sticker_store::append_link(const std::string& _key, const std::string& _hash)
+        {
+            if (!tools::system::is_exist(root_) && !tools::system::create_directory(root_))
+                return false;
+
+            auto outfile = tools::system::open_file_for_write(get_index_path(), std::ofstream::binary | std::ofstream::app);
+            if (!outfile.is_open())
+                return false;
+
+            outfile << _key << ' ' << _hash << '\n';
+            outfile.flush();
+
+            ++index_lines_;
+            return outfile.good();
+        }
+
+        void sticker_store::save_links()
+        {
+            tools::binary_stream bs;
+            for (const auto& [key, hash] : links_)
+            {
+                bs.write(key.data(), uint32_t(key.size()));
+                bs.write<char>(' ');
+                bs.write(hash.data(), uint32_t(hash.size()));
+                bs.write<char>('\n');
+            }
+
+            if (bs.save_2_file(get_index_path()))
+                index_lines_ = links_.size();
+        }
+
+        std::wstring sticker_store::get_blob_path(const std::string& _hash) const
+        {
+            std::wstring path;
+            path.reserve(root_.size() + _hash.size() + 5);
+            path += root_;
+            path += L'/';
+            path.append(_hash.begin(), _hash.end());
+            path += L".png";
+            return path;
+        }
+
+        std::wstring sticker_store::get_index_path() const
+        {
+            return root_ + L"/index";
+        }
+    }
+}
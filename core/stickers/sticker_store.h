@@ -0,0 +1,36 @@
+#pragma once
+
+namespace core
+{
+    namespace stickers
+    {
+        // content-addressed storage of the sticker images.
+        // an image is kept once under the hash of its content, the stickers and sizes with the same picture share the file.
+        // the links from the sticker keys to the hashes are appended to a text index, the last link of a key wins.
+        // not thread-safe, used from the stickers thread only
+        class sticker_store
+        {
+        public:
+            explicit sticker_store(std::wstring _root);
+
+            // the stored file of _key, empty if there is none
+            std::wstring find(const std::string& _key);
+
+            // moves the downloaded _file into the store, returns the stored file or empty on error
+            std::wstring put(const std::string& _key, const std::wstring& _file);
+
+        private:
+            void load();
+            bool append_link(const std::string& _key, const std::string& _hash);
+            void save_links();
+
+            std::wstring get_blob_path(const std::string& _hash) const;
+            std::wstring get_index_path() const;
+
+            std::wstring root_;
+            std::unordered_map<std::string, std::string> links_;
+            size_t index_lines_ = 0;
+            bool loaded_ = false;
+        };
+    }
+}
@@ -2,6 +2,7 @@
 
 #include "stickers.h"
 #include "suggests.h"
+#include "sticker_store.h"
 
 #include "../../../corelib/enumerations.h"
 
@@ -390,11 +391,26 @@ namespace core
 
         std::wstring g_stickers_path;
 
+        std::string get_sticker_key(int32_t _set_id, int32_t _sticker_id, std::string_view _fs_id, sticker_size _size)
+        {
+            std::stringstream ss_key;
+
+            if (_fs_id.empty())
+                ss_key << _set_id << '/' << _sticker_id;
+            else
+                ss_key << _fs_id;
+
+            ss_key << '/' << _size;
+
+            return ss_key.str();
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // class cache
         //////////////////////////////////////////////////////////////////////////
         cache::cache(const std::wstring& _stickers_path)
             : suggests_(std::make_unique<suggests>())
+            , images_(std::make_unique<sticker_store>(_stickers_path + L"/store"))
         {
             g_stickers_path = _stickers_path;
         }
@@ -801,7 +817,7 @@ namespace core
             return true;
         }
 
-        void cache::get_sticker(int64_t _seq, int32_t _set_id, int32_t _sticker_id, std::string _fs_id, const sticker_size _size, tools::binary_stream& _data)
+        void cache::get_sticker(int64_t _seq, int32_t _set_id, int32_t _sticker_id, std::string _fs_id, const sticker_size _size, std::wstring& _path)
         {
             if (_fs_id.empty())
                 gui_requests_[_set_id][_sticker_id].push_back(_seq);
@@ -820,16 +836,25 @@ namespace core
                 }
             }
 
+            const auto key = get_sticker_key(_set_id, _sticker_id, _fs_id, _size);
+            if (_path = images_->find(key); !_path.empty())
+                return;
+
             auto file_name = get_sticker_path(_set_id, _sticker_id, _fs_id, _size);
 
-            if (!_data.load_from_file(file_name))
+            // just downloaded or left by the older versions
+            if (core::tools::system::is_exist(file_name))
             {
-                auto sticker_url = make_sticker_url(_set_id, _sticker_id, _fs_id, _size);
-
-                stickers_tasks_.emplace_front(std::move(sticker_url), "stikersGetSticker", std::move(file_name), _set_id, _sticker_id, std::move(_fs_id), _size);
+                _path = images_->put(key, file_name);
+                if (_path.empty())
+                    _path = std::move(file_name);
 
                 return;
             }
+
+            auto sticker_url = make_sticker_url(_set_id, _sticker_id, _fs_id, _size);
+
+            stickers_tasks_.emplace_front(std::move(sticker_url), "stikersGetSticker", std::move(file_name), _set_id, _sticker_id, std::move(_fs_id), _size);
         }
 
         void cache::get_set_icon_big(const int64_t _seq, const int32_t _set_id, tools::binary_stream& _data)
@@ -1025,24 +1050,24 @@ namespace core
             return handler;
         }
 
-        std::shared_ptr<result_handler<tools::binary_stream&>> face::get_sticker(int64_t _seq, int32_t _set_id, int32_t _sticker_id, std::string _fs_id, const core::sticker_size _size)
+        std::shared_ptr<result_handler<const std::wstring&>> face::get_sticker(int64_t _seq, int32_t _set_id, int32_t _sticker_id, std::string _fs_id, const core::sticker_size _size)
         {
             assert(_size > core::sticker_size::min);
             assert(_size < core::sticker_size::max);
 
-            auto handler = std::make_shared<result_handler<tools::binary_stream&>>();
-            auto sticker_data = std::make_shared<tools::binary_stream>();
+            auto handler = std::make_shared<result_handler<const std::wstring&>>();
+            auto sticker_path = std::make_shared<std::wstring>();
 
-            thread_->run_async_function([stickers_cache = cache_, sticker_data, _set_id, _sticker_id, _size, _seq, _fs_id = std::move(_fs_id)]
+            thread_->run_async_function([stickers_cache = cache_, sticker_path, _set_id, _sticker_id, _size, _seq, _fs_id = std::move(_fs_id)]
             {
-                stickers_cache->get_sticker(_seq, _set_id, _sticker_id, std::move(_fs_id), _size, *sticker_data);
+                stickers_cache->get_sticker(_seq, _set_id, _sticker_id, std::move(_fs_id), _size, *sticker_path);
 
                 return 0;
 
-            })->on_result_ = [handler, sticker_data](int32_t _error)
+            })->on_result_ = [handler, sticker_path](int32_t _error)
             {
                 if (handler->on_result_)
-                    handler->on_result_(*sticker_data);
+                    handler->on_result_(*sticker_path);
             };
 
             return handler;
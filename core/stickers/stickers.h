@@ -17,6 +17,7 @@ namespace core
     namespace stickers
     {
         class suggests;
+        class sticker_store;
 
         class sticker_params
         {
@@ -266,6 +267,7 @@ namespace core
             stickers_fs_ids_list gui_fs_requests_;
 
             std::unique_ptr<suggests> suggests_;
+            std::unique_ptr<sticker_store> images_;
 
             requests_list get_sticker_gui_requests(int32_t _set_id, int32_t _sticker_id, const std::string& _fs_id) const;
             void clear_sticker_gui_requests(int32_t _set_id, int32_t _sticker_id, const std::string& _fs_id);
@@ -299,7 +301,8 @@ namespace core
 
             bool get_next_meta_task(download_task& _task);
             bool get_next_sticker_task(download_task& _task);
-            void get_sticker(int64_t _seq, int32_t _set_id, int32_t _sticker_id, std::string _fs_id, const sticker_size _size, tools::binary_stream& _data);
+            // _path is the stored image file, empty if it is being downloaded
+            void get_sticker(int64_t _seq, int32_t _set_id, int32_t _sticker_id, std::string _fs_id, const sticker_size _size, std::wstring& _path);
             void get_set_icon_big(const int64_t _seq, const int32_t _set_id, tools::binary_stream& _data);
             void clean_set_icon_big(const int32_t _set_id);
             const std::string& get_md5() const;
@@ -361,7 +364,7 @@ namespace core
             std::shared_ptr<result_handler<const std::vector<std::string>&>> make_download_tasks(const std::string& _size);
             std::shared_ptr<result_handler<coll_helper>> serialize_meta(coll_helper _coll, const std::string& _size);
             std::shared_ptr<result_handler<coll_helper>> serialize_store(coll_helper _coll);
-            std::shared_ptr<result_handler<tools::binary_stream&>> get_sticker(
+            std::shared_ptr<result_handler<const std::wstring&>> get_sticker(
                 int64_t _seq,
                 int32_t _set_id,
                 int32_t _sticker_id,
@@ -0,0 +1,162 @@
+#pragma once
+
+namespace core
+{
+    namespace tools
+    {
+        template<typename Signature, size_t Capacity = 96>
+        class small_function;
+
+        // a move-only std::function keeping the callable inside when it fits Capacity bytes.
+        // the most of the core callbacks capture a weak this, a couple of strings and shared pointers,
+        // so they are stored without a separate allocation
+        template<typename R, typename... Args, size_t Capacity>
+        class small_function<R(Args...), Capacity>
+        {
+            struct vtable
+            {
+                R (*call_)(void* _storage, Args&&... _args);
+                void (*move_)(void* _from, void* _to) noexcept;
+                void (*destroy_)(void* _storage) noexcept;
+            };
+
+            template<typename F>
+            static constexpr bool is_local_v = sizeof(F) <= Capacity
+                && alignof(F) <= alignof(std::max_align_t)
+                && std::is_nothrow_move_constructible_v<F>;
+
+            template<typename F>
+            static const vtable* local_vtable() noexcept
+            {
+                static const vtable table =
+                {
+                    [](void* _storage, Args&&... _args) -> R
+                    {
+                        if constexpr (std::is_void_v<R>)
+                            (*static_cast<F*>(_storage))(std::forward<Args>(_args)...);
+                        else
+                            return (*static_cast<F*>(_storage))(std::forward<Args>(_args)...);
+                    },
+                    [](void* _from, void* _to) noexcept
+                    {
+                        new (_to) F(std::move(*static_cast<F*>(_from)));
+                        static_cast<F*>(_from)->~F();
+                    },
+                    [](void* _storage) noexcept
+                    {
+                        static_cast<F*>(_storage)->~F();
+                    }
+                };
+
+                return &table;
+            }
+
+            template<typename F>
+            static const vtable* heap_vtable() noexcept
+            {
+                static const vtable table =
+                {
+                    [](void* _storage, Args&&... _args) -> R
+                    {
+                        if constexpr (std::is_void_v<R>)
+                            (**static_cast<F**>(_storage))(std::forward<Args>(_args)...);
+                        else
+                            return (**static_cast<F**>(_storage))(std::forward<Args>(_args)...);
+                    },
+                    [](void* _from, void* _to) noexcept
+                    {
+                        *static_cast<F**>(_to) = *static_cast<F**>(_from);
+                    },
+                    [](void* _storage) noexcept
+                    {
+                        delete *static_cast<F**>(_storage);
+                    }
+                };
+
+                return &table;
+            }
+
+            std::aligned_storage_t<Capacity, alignof(std::max_align_t)> storage_;
+
+            const vtable* vtable_ = nullptr;
+
+        public:
+
+            small_function() noexcept = default;
+
+            small_function(std::nullptr_t) noexcept
+            {
+            }
+
+            template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, small_function>>>
+            small_function(F&& _f)
+            {
+                using functor = std::decay_t<F>;
+
+                if constexpr (is_local_v<functor>)
+                {
+                    new (&storage_) functor(std::forward<F>(_f));
+                    vtable_ = local_vtable<functor>();
+                }
+                else
+                {
+                    *reinterpret_cast<functor**>(&storage_) = new functor(std::forward<F>(_f));
+                    vtable_ = heap_vtable<functor>();
+                }
+            }
+
+            small_function(small_function&& _other) noexcept
+            {
+                if (_other.vtable_)
+                {
+                    _other.vtable_->move_(&_other.storage_, &storage_);
+                    vtable_ = std::exchange(_other.vtable_, nullptr);
+                }
+            }
+
+            small_function& operator=(small_function&& _other) noexcept
+            {
+                if (this != &_other)
+                {
+                    reset();
+
+                    if (_other.vtable_)
+                    {
+                        _other.vtable_->move_(&_other.storage_, &storage_);
+                        vtable_ = std::exchange(_other.vtable_, nullptr);
+                    }
+                }
+
+                return *this;
+            }
+
+            small_function(const small_function&) = delete;
+            small_function& operator=(const small_function&) = delete;
+
+            ~small_function()
+            {
+                reset();
+            }
+
+            void reset() noexcept
+            {
+                if (vtable_)
+                {
+                    vtable_->destroy_(&storage_);
+                    vtable_ = nullptr;
+                }
+            }
+
+            explicit operator bool() const noexcept
+            {
+                return vtable_ != nullptr;
+            }
+
+            R operator()(Args... _args)
+            {
+                assert(vtable_);
+                return vtable_->call_(&storage_, std::forward<Args>(_args)...);
+            }
+        };
+    }
+}
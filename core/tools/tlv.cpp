@@ -253,3 +253,91 @@ template<> void tlv::set_value<iserializable_tlv>(const iserializable_tlv& _valu
     _value.serialize(Out pack);
     set_value<tlvpack>(pack);
 }
+
+namespace
+{
+    constexpr size_t tlv_header_size = sizeof(uint32_t) * 2;
+
+    // length of the value of the field at the start of _data, false if the field is truncated
+    bool read_tlv_header(std::string_view _data, uint32_t& _type, uint32_t& _length) noexcept
+    {
+        if (_data.size() < tlv_header_size)
+            return false;
+
+        memcpy(&_type, _data.data(), sizeof(uint32_t));
+        memcpy(&_length, _data.data() + sizeof(uint32_t), sizeof(uint32_t));
+
+        return _length <= _data.size() - tlv_header_size;
+    }
+}
+
+tlv_view::tlv_view(const uint32_t _type, std::string_view _value) noexcept
+    : type_(_type)
+    , value_(_value)
+{
+}
+
+tlvpack_view::iterator::iterator(std::string_view _data) noexcept
+    : tail_(_data)
+{
+    read_current();
+}
+
+void tlvpack_view::iterator::read_current() noexcept
+{
+    uint32_t type = 0;
+    uint32_t length = 0;
+    if (!read_tlv_header(tail_, type, length))
+    {
+        tail_ = std::string_view();
+        current_ = tlv_view();
+        return;
+    }
+
+    current_ = tlv_view(type, tail_.substr(tlv_header_size, length));
+}
+
+tlvpack_view::iterator& tlvpack_view::iterator::operator++() noexcept
+{
+    tail_.remove_prefix(tlv_header_size + current_.get_data().size());
+    read_current();
+    return *this;
+}
+
+tlvpack_view::tlvpack_view(std::string_view _data) noexcept
+    : data_(_data)
+{
+}
+
+tlvpack_view::tlvpack_view(const binary_stream& _stream)
+{
+    if (const uint32_t size = _stream.available(); size > 0)
+        data_ = std::string_view(_stream.read(size), size);
+}
+
+bool tlvpack_view::is_valid() const noexcept
+{
+    auto tail = data_;
+    while (!tail.empty())
+    {
+        uint32_t type = 0;
+        uint32_t length = 0;
+        if (!read_tlv_header(tail, type, length))
+            return false;
+
+        tail.remove_prefix(tlv_header_size + length);
+    }
+
+    return true;
+}
+
+std::optional<tlv_view> tlvpack_view::get_item(const uint32_t _type) const noexcept
+{
+    for (const auto& field : *this)
+    {
+        if (field.get_type() == _type)
+            return field;
+    }
+
+    return std::nullopt;
+}
@@ -170,5 +170,123 @@ namespace core
             value_stream_.reset_out();
             return val;
         }
+
+        class tlvpack_view;
+
+        // non-owning tlv, the value points into the buffer it was read from
+        class tlv_view
+        {
+            uint32_t type_ = 0;
+            std::string_view value_;
+
+        public:
+
+            tlv_view() = default;
+            tlv_view(const uint32_t _type, std::string_view _value) noexcept;
+
+            uint32_t get_type() const noexcept { return type_; }
+            std::string_view get_data() const noexcept { return value_; }
+
+            template <class T_>
+            T_ get_value(const T_& _default_value) const;
+
+            template <class T_>
+            T_ get_value() const;
+        };
+
+        // non-owning tlvpack over a serialized buffer, reads the fields in place without allocations.
+        // the buffer must outlive the view and the tlv_views taken from it
+        class tlvpack_view
+        {
+            std::string_view data_;
+
+        public:
+
+            class iterator
+            {
+                std::string_view tail_;
+                tlv_view current_;
+
+                void read_current() noexcept;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = tlv_view;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const tlv_view*;
+                using reference = const tlv_view&;
+
+                iterator() = default;
+                explicit iterator(std::string_view _data) noexcept;
+
+                reference operator*() const noexcept { return current_; }
+                pointer operator->() const noexcept { return &current_; }
+
+                iterator& operator++() noexcept;
+
+                bool operator==(const iterator& _other) const noexcept { return tail_.size() == _other.tail_.size(); }
+                bool operator!=(const iterator& _other) const noexcept { return !(*this == _other); }
+            };
+
+            tlvpack_view() = default;
+            explicit tlvpack_view(std::string_view _data) noexcept;
+
+            // takes all the available data of the stream, like tlvpack::unserialize
+            explicit tlvpack_view(const binary_stream& _stream);
+
+            // false if the last field is truncated, tlvpack::unserialize fails on such data
+            bool is_valid() const noexcept;
+
+            iterator begin() const noexcept { return iterator(data_); }
+            iterator end() const noexcept { return iterator(); }
+
+            std::optional<tlv_view> get_item(const uint32_t _type) const noexcept;
+
+            bool empty() const noexcept { return data_.empty(); }
+        };
+
+        template <class T_>
+        T_ tlv_view::get_value(const T_& _default_value) const
+        {
+            if constexpr (std::is_same_v<T_, std::string> || std::is_same_v<T_, std::string_view>)
+            {
+                return value_.empty() ? _default_value : T_(value_);
+            }
+            else if constexpr (std::is_same_v<T_, tlvpack_view>)
+            {
+                return tlvpack_view(value_);
+            }
+            else if constexpr (std::is_same_v<T_, tlvpack>)
+            {
+                // owning copy for the readers that still take a tlvpack
+                binary_stream stream;
+                if (!value_.empty())
+                    stream.write(value_.data(), uint32_t(value_.size()));
+
+                tlvpack pack;
+                pack.unserialize(stream);
+                return pack;
+            }
+            else
+            {
+                static_assert(std::is_scalar<T_>::value, "value should be of scalar type");
+
+                if (value_.size() < sizeof(T_))
+                {
+                    assert(!"bad tlv length");
+                    return _default_value;
+                }
+
+                typename std::remove_const<T_>::type val;
+                memcpy(&val, value_.data(), sizeof(T_));
+                return val;
+            }
+        }
+
+        template <class T_>
+        T_ tlv_view::get_value() const
+        {
+            return get_value<T_>(T_());
+        }
     }
 }
@@ -33,7 +33,8 @@ namespace core
     {
         ae_success = 0,
         ae_network_error = 1,
-        ae_unknown_error = 2
+        ae_unknown_error = 2,
+        ae_cancelled = 3
     };
 
     enum collection_value_type
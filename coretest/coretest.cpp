@@ -73,6 +73,17 @@ class gui_connector : public core::iconnector
     virtual void receive(std::string_view _message, int64_t _seq, core::icollection* _collection) override
     {
         printf("receive message = %s\r\n", std::string(_message).c_str());
+
+#ifdef CORE_TESTS
+        if (_message == std::string_view("archive/check/pending_journal/result") && _collection)
+        {
+            core::coll_helper helper(_collection, false);
+            if (helper.get_value_as_bool("passed"))
+                printf("pending journal check passed\r\n");
+            else
+                printf("pending journal check failed: %s\r\n", helper.get_value_as_string("error"));
+        }
+#endif
     }
 
 public:
@@ -203,6 +214,21 @@ public:
 };
 
 
+#ifdef CORE_TESTS
+class check_pending_journal_task final : public task
+{
+    bool execute() override
+    {
+        core::ifptr<core::icore_factory> factory(core_face->get_factory());
+        core::coll_helper helper(factory->create_collection(), true);
+        core_connector->receive("archive/check/pending_journal", 1004, helper.get());
+
+        return false;
+    }
+};
+#endif
+
+
 void gui_thread_func()
 {
     if (!get_core_instance(&core_face))
@@ -260,6 +286,13 @@ void make_gallery_hole(std::string_view _arhive_name, int64_t _from, int64_t _ti
     post_task(std::make_unique<make_gallery_hole_task>(_arhive_name, _from, _till));
 }
 
+#ifdef CORE_TESTS
+void check_pending_journal()
+{
+    post_task(std::make_unique<check_pending_journal_task>());
+}
+#endif
+
 void processCmdLine(int _argc, char *_argv[])
 {
     for (auto i = 1; i < _argc; ++i)
@@ -323,6 +356,12 @@ void processCmdLine(int _argc, char *_argv[])
                 }
             }
         }
+#ifdef CORE_TESTS
+        else if (command == std::string_view("--check_pending_journal"))
+        {
+            check_pending_journal();
+        }
+#endif
         else if (command == std::string_view("--make_gallery_hole"))
         {
             std::string_view archive;
@@ -358,6 +397,9 @@ int main(int _argc, char *_argv[])
         printf("\r\nUsage: --invalidate_msg_data <archive_name> ids id1,id2,id3\r\n");
         printf("\r\nUsage: --invalidate_msg_data <archive_name> <from> <count_before> <count_after>\r\n");
         printf("\r\nUsage: --make_gallery_hole <archive_name> <from_msg_id> <till_msg_id> (from is newer than till)\r\n");
+#ifdef CORE_TESTS
+        printf("\r\nUsage: --check_pending_journal (writes, compacts and reloads the pending messages in the temp directory)\r\n");
+#endif
 
         return 0;
     }
@@ -13,8 +13,11 @@ namespace
 {
     QString CreateKey(const QString& _aimId, const int _sizePx);
 
+    qint64 PixmapBytes(const QPixmap& _pixmap);
+
     constexpr std::chrono::milliseconds CLEANUP_TIMEOUT = std::chrono::minutes(5);
     constexpr int64_t INITIAL_REQUEST_AVATAR_SEQ = -1;
+    constexpr qint64 SECONDARY_CACHE_BUDGET = 32 * 1024 * 1024;
 }
 
 namespace Logic
@@ -27,6 +30,7 @@ namespace Logic
         Timer_->start();
 
         connect(Ui::GetDispatcher(), &Ui::core_dispatcher::avatarLoaded, this, &AvatarStorage::avatarLoaded);
+        connect(Ui::GetDispatcher(), &Ui::core_dispatcher::avatarCancelled, this, &AvatarStorage::avatarCancelled);
         connect(Ui::GetDispatcher(), &Ui::core_dispatcher::avatarUpdated, this, [this](const QString& contact) {
             updateAvatar(contact);
         });
@@ -46,10 +50,9 @@ namespace Logic
         Out _isDefault = !LoadedAvatars_.contains(_aimId);
         const auto key = CreateKey(_aimId, _sizePx);
 
-        auto iterByAimIdAndSize = AvatarsByAimIdAndSize_.find(key);
-        if (iterByAimIdAndSize != AvatarsByAimIdAndSize_.end())
+        if (const auto cached = FindCached(AvatarsByAimIdAndSize_, key))
         {
-            return iterByAimIdAndSize->second;
+            return *cached;
         }
 
         auto iterByAimId = AvatarsByAimId_.find(_aimId);
@@ -89,23 +92,16 @@ namespace Logic
         else
             scaledImage = avatarByAimId.scaledToHeight(_sizePx, Qt::SmoothTransformation);
 
-        const auto result = AvatarsByAimIdAndSize_.emplace(key, std::make_shared<QPixmap>(std::move(scaledImage)));
-        assert(result.second);
+        const auto needRequest = RequestedAvatars_.find(_aimId) == RequestedAvatars_.end() || (avatarByAimId.width() < _sizePx && avatarByAimId.height() < _sizePx);
+
+        const auto& result = InsertCached(AvatarsByAimIdAndSize_, key, std::move(scaledImage));
 
         if (_aimId == ql1s("mail"))
-            return result.first->second;
+            return result;
 
-        auto requestedAvatarsIter = RequestedAvatars_.find(_aimId);
-        if (requestedAvatarsIter == RequestedAvatars_.end() || (avatarByAimId.width() < _sizePx && avatarByAimId.height() < _sizePx))
+        if (needRequest)
         {
-            Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
-            collection.set_value_as_qstring("contact", _aimId);
-            collection.set_value_as_int("size", _sizePx); //request only needed size
-
-            auto seq = Ui::GetDispatcher()->post_message_to_core("avatars/get", collection.get());
-
-            requests_.insert(seq);
-            RequestedAvatars_.insert(_aimId);
+            RequestAvatar(_aimId, _sizePx);
         }
         else
         {
@@ -116,7 +112,27 @@ namespace Logic
             Ui::GetDispatcher()->post_message_to_core("avatars/show", collection.get());
         }
 
-        return result.first->second;
+        return result;
+    }
+
+    void AvatarStorage::RequestAvatar(const QString& _aimId, const int _sizePx)
+    {
+        RequestedAvatars_.insert(_aimId);
+
+        // the same avatar is asked for by every row showing it, one request is enough
+        auto key = CreateKey(_aimId, _sizePx);
+        if (inFlight_.count(key))
+            return;
+
+        Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
+        collection.set_value_as_qstring("contact", _aimId);
+        collection.set_value_as_int("size", _sizePx); //request only needed size
+
+        const auto seq = Ui::GetDispatcher()->post_message_to_core("avatars/get", collection.get());
+
+        requests_.insert(seq);
+        inFlight_.insert(key);
+        inFlightBySeq_.emplace(seq, std::move(key));
     }
 
     void AvatarStorage::SetAvatar(const QString& _aimId, const QPixmap& _pixmap)
@@ -142,7 +158,7 @@ namespace Logic
 
     const AvatarStorage::CacheMap &AvatarStorage::GetByAimIdAndSize() const
     {
-        return AvatarsByAimIdAndSize_;
+        return AvatarsByAimIdAndSize_.items_;
     }
 
     const AvatarStorage::CacheMap &AvatarStorage::GetByAimId() const
@@ -226,6 +242,12 @@ namespace Logic
 
         requests_.erase(_seq);
 
+        if (const auto it = inFlightBySeq_.find(_seq); it != inFlightBySeq_.end())
+        {
+            inFlight_.erase(it->second);
+            inFlightBySeq_.erase(it);
+        }
+
         if (!_result)
             return;
 
@@ -263,6 +285,21 @@ namespace Logic
         emit avatarChanged(_aimId);
     }
 
+    void AvatarStorage::avatarCancelled(int64_t _seq, const QString& _aimId)
+    {
+        if (!requests_.erase(_seq))
+            return;
+
+        if (const auto it = inFlightBySeq_.find(_seq); it != inFlightBySeq_.end())
+        {
+            inFlight_.erase(it->second);
+            inFlightBySeq_.erase(it);
+        }
+
+        // the next Get requests it again instead of showing
+        RequestedAvatars_.erase(_aimId);
+    }
+
     void AvatarStorage::UpdateDefaultAvatarIfNeed(const QString& _aimId)
     {
         assert(!_aimId.isEmpty());
@@ -308,9 +345,9 @@ namespace Logic
     // TODO : use two-step hash here
     void AvatarStorage::CleanupSecondaryCaches(const QString& _aimId, bool _isRoundedAvatarsClean)
     {
-        const auto cleanupSecondaryCache = [&_aimId](CacheMap &cache)
+        const auto cleanupSecondaryCache = [&_aimId](SecondaryCache &cache)
         {
-            for (auto i = cache.begin(); i != cache.end(); ++i)
+            for (auto i = cache.items_.begin(); i != cache.items_.end(); ++i)
             {
                 const auto &key = i->first;
                 if (!key.startsWith(_aimId))
@@ -320,9 +357,9 @@ namespace Logic
 
                 for(;;)
                 {
-                    i = cache.erase(i);
+                    i = EraseCached(cache, i);
 
-                    if (i == cache.end())
+                    if (i == cache.items_.end())
                     {
                         break;
                     }
@@ -354,18 +391,53 @@ namespace Logic
         % ql1c('/')
         % _state;
 
-        auto i = RoundedAvatarsByAimIdAndSize_.find(key);
-        if (i == RoundedAvatarsByAimIdAndSize_.end())
-        {
-            auto roundedAvatar = Utils::roundImage(_avatar, _state, _isDefault, mini_icons);
-            i = RoundedAvatarsByAimIdAndSize_
-                .emplace(
-                    key,
-                    std::make_shared<QPixmap>(std::move(roundedAvatar)))
-                .first;
-        }
+        if (const auto cached = FindCached(RoundedAvatarsByAimIdAndSize_, key))
+            return *cached;
+
+        auto roundedAvatar = Utils::roundImage(_avatar, _state, _isDefault, mini_icons);
+        return InsertCached(RoundedAvatarsByAimIdAndSize_, key, std::move(roundedAvatar));
+    }
+
+    const QPixmapSCptr* AvatarStorage::FindCached(SecondaryCache& _cache, const QString& _key)
+    {
+        const auto it = _cache.items_.find(_key);
+        if (it == _cache.items_.end())
+            return nullptr;
+
+        _cache.lru_.splice(_cache.lru_.begin(), _cache.lru_, _cache.positions_[_key]);
+
+        return &it->second;
+    }
+
+    const QPixmapSCptr& AvatarStorage::InsertCached(SecondaryCache& _cache, const QString& _key, QPixmap _pixmap)
+    {
+        _cache.bytes_ += PixmapBytes(_pixmap);
 
-        return i->second;
+        const auto result = _cache.items_.emplace(_key, std::make_shared<QPixmap>(std::move(_pixmap)));
+        assert(result.second);
+
+        _cache.lru_.push_front(_key);
+        _cache.positions_[_key] = _cache.lru_.begin();
+
+        // the new entry is the most recent one and is never dropped here
+        while (_cache.bytes_ > SECONDARY_CACHE_BUDGET && _cache.lru_.size() > 1)
+            EraseCached(_cache, _cache.items_.find(_cache.lru_.back()));
+
+        return result.first->second;
+    }
+
+    AvatarStorage::CacheMap::iterator AvatarStorage::EraseCached(SecondaryCache& _cache, CacheMap::iterator _it)
+    {
+        assert(_it != _cache.items_.end());
+
+        _cache.bytes_ -= PixmapBytes(*_it->second);
+
+        const auto position = _cache.positions_.find(_it->first);
+        assert(position != _cache.positions_.end());
+        _cache.lru_.erase(position->second);
+        _cache.positions_.erase(position);
+
+        return _cache.items_.erase(_it);
     }
 
     AvatarStorage* GetAvatarStorage()
@@ -382,4 +454,9 @@ namespace
         assert(_sizePx > 0);
         return _aimId % ql1c('/') % QString::number(_sizePx);
     }
+
+    qint64 PixmapBytes(const QPixmap& _pixmap)
+    {
+        return qint64(_pixmap.width()) * _pixmap.height() * _pixmap.depth() / 8;
+    }
 }
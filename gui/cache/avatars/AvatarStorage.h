@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../types/contact.h"
+#include "../../utils/utils.h"
 
 namespace Logic
 {
@@ -17,6 +18,7 @@ namespace Logic
 
     private Q_SLOTS:
         void avatarLoaded(int64_t _seq, const QString& _aimId, QPixmap& _avatar, int _size, bool _result);
+        void avatarCancelled(int64_t _seq, const QString& _aimId);
 
         void cleanup();
 
@@ -43,17 +45,33 @@ namespace Logic
         const CacheMap& GetRoundedByAimId() const;
 
     private:
+        // scaled and rounded avatars, the least recently used are dropped
+        // once the pixmaps take more bytes than the budget
+        struct SecondaryCache
+        {
+            CacheMap items_;
+            std::list<QString> lru_; // most recent first
+            std::unordered_map<QString, std::list<QString>::iterator, Utils::QStringHasher> positions_;
+            qint64 bytes_ = 0;
+        };
+
         AvatarStorage();
 
         void CleanupSecondaryCaches(const QString& _aimId, bool _isRoundedAvatarsClean = true);
 
         const QPixmapSCptr& GetRounded(const QPixmap& _avatar, const QString& _aimId, const QString& _state, bool mini_icons, bool _isDefault);
 
-        CacheMap AvatarsByAimIdAndSize_;
+        static const QPixmapSCptr* FindCached(SecondaryCache& _cache, const QString& _key);
+        static const QPixmapSCptr& InsertCached(SecondaryCache& _cache, const QString& _key, QPixmap _pixmap);
+        static CacheMap::iterator EraseCached(SecondaryCache& _cache, CacheMap::iterator _it);
+
+        void RequestAvatar(const QString& _aimId, const int _sizePx);
+
+        SecondaryCache AvatarsByAimIdAndSize_;
 
         CacheMap AvatarsByAimId_;
 
-        CacheMap RoundedAvatarsByAimIdAndSize_;
+        SecondaryCache RoundedAvatarsByAimIdAndSize_;
 
         std::set<QString> RequestedAvatars_;
 
@@ -66,6 +84,10 @@ namespace Logic
         QTimer* Timer_;
 
         std::set<int64_t> requests_;
+
+        // avatars/get requests without a result yet, by aimid and size
+        std::unordered_set<QString, Utils::QStringHasher> inFlight_;
+        std::unordered_map<int64_t, QString> inFlightBySeq_;
     };
 
     AvatarStorage* GetAvatarStorage();
@@ -20,6 +20,72 @@ namespace
 
     std::unordered_map<QString, QString, Utils::QStringHasher> EmojiFilePathCache_;
 
+    constexpr int atlasPageSizePx = 1024;
+
+    // pixels of all the atlas pages, the least recently used pages of any size are freed above it
+    constexpr qint64 atlasBudgetBytes = 64 * 1024 * 1024;
+
+    struct AtlasPage
+    {
+        QPixmap pixmap_;
+        std::vector<int32_t> cells_; // EmojiRecord::Index_ of the emojis drawn on the page
+        uint64_t lastUse_ = 0;
+        qint64 bytes_ = 0;
+    };
+
+    // emojis of one size in device pixels packed into pages, pages are allocated when the previous one is full
+    struct EmojiAtlas
+    {
+        struct Cell
+        {
+            std::shared_ptr<AtlasPage> page_;
+            QRect rect_;
+        };
+
+        int cellsPerRow_ = 0;
+        int usedInLastPage_ = 0;
+        std::vector<std::shared_ptr<AtlasPage>> pages_;
+        std::unordered_map<int32_t, Cell> cells_; // by EmojiRecord::Index_
+    };
+
+    std::unordered_map<int32_t, EmojiAtlas> EmojiAtlases_;
+    qint64 AtlasFootprint_ = 0;
+    uint64_t AtlasUseCounter_ = 0;
+
+    // frees the least recently used page of all the sizes, false if there are no pages
+    bool evictAtlasPage()
+    {
+        EmojiAtlas* lruAtlas = nullptr;
+        std::vector<std::shared_ptr<AtlasPage>>::iterator lruPage;
+
+        for (auto& [_, atlas] : EmojiAtlases_)
+        {
+            for (auto it = atlas.pages_.begin(); it != atlas.pages_.end(); ++it)
+            {
+                if (!lruAtlas || (*it)->lastUse_ < (*lruPage)->lastUse_)
+                {
+                    lruAtlas = &atlas;
+                    lruPage = it;
+                }
+            }
+        }
+
+        if (!lruAtlas)
+            return false;
+
+        const auto page = *lruPage;
+        for (const auto index : page->cells_)
+            lruAtlas->cells_.erase(index);
+
+        // the free cells of the last page aren't reused, the next emoji starts a new page
+        if (std::next(lruPage) == lruAtlas->pages_.end())
+            lruAtlas->usedInLastPage_ = lruAtlas->cellsPerRow_ * lruAtlas->cellsPerRow_;
+
+        lruAtlas->pages_.erase(lruPage);
+        AtlasFootprint_ -= page->bytes_;
+        return true;
+    }
+
     constexpr int64_t MakeCacheKey(int32_t _index, int32_t _sizePx) noexcept
     {
         return int64_t(_index) | (int64_t(_sizePx) << 32);
@@ -104,6 +170,8 @@ namespace Emoji
     void Cleanup()
     {
         EmojiCache_.clear();
+        EmojiAtlases_.clear();
+        AtlasFootprint_ = 0;
     }
 
     QImage GetEmoji(const EmojiCode& _code, const EmojiSizePx _size)
@@ -187,6 +255,15 @@ namespace Emoji
             return getEmoji_svg(emojiFilePath, _sizePx);
     }
 
+    static QImage renderEmoji(const EmojiCode& _code, const EmojiRecord& _info, int32_t _sizePx)
+    {
+#if defined(__APPLE__)
+        return useNativeEmoji() && mac::supportEmoji(_code) ? getEmoji_mac(_code, _sizePx) : getEmojiImage(_info.fileName(), _sizePx);
+#else
+        return getEmojiImage(_info.fileName(), _sizePx);
+#endif
+    }
+
     QImage GetEmoji(const EmojiCode& _code, int32_t _sizePx)
     {
         assert(_sizePx > 0);
@@ -197,7 +274,7 @@ namespace Emoji
             return QImage();
 
         assert(info->Index_ >= 0);
-        assert(!info->FileName_.isEmpty());
+        assert(!info->FileName_.empty());
 
         const auto key = MakeCacheKey(info->Index_, _sizePx);
         if (const auto cacheIter = std::as_const(EmojiCache_).find(key); cacheIter != std::as_const(EmojiCache_).end())
@@ -206,17 +283,116 @@ namespace Emoji
             return cacheIter->second;
         }
 
-#if defined(__APPLE__)
-        auto image = useNativeEmoji() && mac::supportEmoji(_code) ? getEmoji_mac(_code, _sizePx) : getEmojiImage(info->FileName_, _sizePx);
-#else
-        auto image = getEmojiImage(info->FileName_, _sizePx);
-#endif
+        auto image = renderEmoji(_code, *info, _sizePx);
 
         EmojiCache_.insert({ key, image });
 
         return image;
     }
 
+    static const EmojiAtlas::Cell* getAtlasCell(const EmojiCode& _code, int32_t _sizePx)
+    {
+        assert(_sizePx > 0);
+        assert(!_code.isNull());
+
+        const auto info = GetEmojiInfoByCodepoint(_code);
+        if (!info)
+            return nullptr;
+
+        auto& atlas = EmojiAtlases_[_sizePx];
+        if (const auto it = std::as_const(atlas.cells_).find(info->Index_); it != std::as_const(atlas.cells_).end())
+        {
+            it->second.page_->lastUse_ = ++AtlasUseCounter_;
+            return &it->second;
+        }
+
+        if (atlas.cellsPerRow_ == 0)
+            atlas.cellsPerRow_ = std::max(1, atlasPageSizePx / _sizePx);
+
+        if (atlas.pages_.empty() || atlas.usedInLastPage_ == atlas.cellsPerRow_ * atlas.cellsPerRow_)
+        {
+            const auto pageSize = atlas.cellsPerRow_ * _sizePx;
+            const auto bytes = qint64(pageSize) * pageSize * 4;
+
+            while (AtlasFootprint_ + bytes > atlasBudgetBytes && evictAtlasPage())
+                ;
+
+            auto page = std::make_shared<AtlasPage>();
+            page->pixmap_ = QPixmap(pageSize, pageSize);
+            page->pixmap_.fill(Qt::transparent);
+            page->bytes_ = bytes;
+            AtlasFootprint_ += bytes;
+
+            atlas.pages_.push_back(std::move(page));
+            atlas.usedInLastPage_ = 0;
+        }
+
+        const auto& page = atlas.pages_.back();
+        page->lastUse_ = ++AtlasUseCounter_;
+        page->cells_.push_back(info->Index_);
+        const auto cellIndex = atlas.usedInLastPage_++;
+        const QRect cellRect((cellIndex % atlas.cellsPerRow_) * _sizePx, (cellIndex / atlas.cellsPerRow_) * _sizePx, _sizePx, _sizePx);
+
+        const auto image = renderEmoji(_code, *info, _sizePx);
+        if (!image.isNull())
+        {
+            QPainter p(&page->pixmap_);
+            p.setCompositionMode(QPainter::CompositionMode_Source);
+            p.setRenderHint(QPainter::SmoothPixmapTransform);
+            p.drawImage(cellRect, image);
+        }
+
+        auto& cell = atlas.cells_[info->Index_];
+        cell.page_ = page;
+        cell.rect_ = cellRect;
+        return &cell;
+    }
+
+    bool EmojiBatch::add(const EmojiCode& _code, int32_t _sizePx, const QRectF& _target)
+    {
+        const auto cell = getAtlasCell(_code, _sizePx);
+        if (!cell)
+            return false;
+
+        const auto& source = cell->rect_;
+        items_.push_back({ std::shared_ptr<const QPixmap>(cell->page_, &cell->page_->pixmap_), QPainter::PixmapFragment::create(_target.center(), source, _target.width() / source.width(), _target.height() / source.height()) });
+        return true;
+    }
+
+    void EmojiBatch::draw(QPainter& _p)
+    {
+        if (items_.empty())
+            return;
+
+        std::stable_sort(items_.begin(), items_.end(), [](const auto& _l, const auto& _r) { return _l.page_ < _r.page_; });
+
+        for (auto it = items_.begin(); it != items_.end();)
+        {
+            const auto page = it->page_;
+
+            fragments_.clear();
+            for (; it != items_.end() && it->page_ == page; ++it)
+                fragments_.push_back(it->fragment_);
+
+            _p.drawPixmapFragments(fragments_.data(), int(fragments_.size()), *page);
+        }
+
+        items_.clear();
+    }
+
+    void DrawEmoji(QPainter& _p, const EmojiCode& _code, int32_t _sizePx, const QRectF& _target)
+    {
+        if (const auto cell = getAtlasCell(_code, _sizePx))
+            _p.drawPixmap(_target, cell->page_->pixmap_, cell->rect_);
+    }
+
+    QPixmap GetEmojiPixmap(const EmojiCode& _code, int32_t _sizePx)
+    {
+        if (const auto cell = getAtlasCell(_code, _sizePx))
+            return cell->page_->pixmap_.copy(cell->rect_);
+        return QPixmap();
+    }
+
     uint32_t readCodepoint(const QStringRef& text, int& pos)
     {
         if (pos >= text.length())
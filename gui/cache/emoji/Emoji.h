@@ -42,6 +42,33 @@ namespace Emoji
 
     bool isSupported(const QString& _filename);
 
+    // Collects emojis of one line and paints them from the packed per-size atlas
+    // with one drawPixmapFragments call per atlas page
+    class EmojiBatch
+    {
+    public:
+        bool add(const EmojiCode& _code, int32_t _sizePx, const QRectF& _target);
+        void draw(QPainter& _p);
+
+        bool isEmpty() const noexcept { return items_.empty(); }
+
+    private:
+        struct Item
+        {
+            std::shared_ptr<const QPixmap> page_; // keeps the page alive if it is evicted before draw
+            QPainter::PixmapFragment fragment_;
+        };
+
+        std::vector<Item> items_;
+        std::vector<QPainter::PixmapFragment> fragments_;
+    };
+
+    // paints a single emoji from the atlas, _sizePx is in device pixels
+    void DrawEmoji(QPainter& _p, const EmojiCode& _code, int32_t _sizePx, const QRectF& _target);
+
+    // copies a single emoji out of the atlas, _sizePx is in device pixels
+    QPixmap GetEmojiPixmap(const EmojiCode& _code, int32_t _sizePx);
+
     // This is meant to be used for "debug" purposes only
     const std::unordered_map<int64_t, const QImage>& GetEmojiCache();
 
@@ -2,8 +2,8 @@
 
 #include "EmojiDb.h"
 #include "EmojiIndexDataNew.h"
+#include "EmojiIndexHash.h"
 #include "Emoji.h"
-#include "EmojiCategory.h"
 
 #include <qjsondocument.h>
 #include <qjsonobject.h>
@@ -17,19 +17,12 @@ namespace
 {
     using namespace Emoji;
 
-    EmojiRecordSptrVec EmojiIndexByOrder_;
-
-    using EmojiIndex = std::unordered_map<EmojiCode, EmojiRecordSptr, EmojiCodeHasher>;
-    EmojiIndex emojiIndexByFullCodepoint_;
-    EmojiIndex emojiIndexByBaseCodepoint_;
-
-    using EmojiIndexByCategory = std::map<QString, EmojiRecordSptrVec>;
+    using EmojiIndexByCategory = std::map<QString, EmojiRecordVec>;
     EmojiIndexByCategory EmojiIndexByCategory_;
 
     QVector<QString> EmojiCategories_ ;
 
-    const QVector<QString> EmojiCategoriesOrder_ = { peopleCategory(), natureCategory(), foodCategory(), activityCategory(), travelCategory(),
-                                                     objectsCategory(), symbolsCategory(), flagsCategory(), modifierCategory(), regionalCategory()};
+    bool categoriesInitialized_ = false;
 
 #if defined(__APPLE__)
     constexpr inline bool canViewEmojiOneOnMac() noexcept { return true; }
@@ -39,196 +32,160 @@ namespace
 
 namespace Emoji
 {
-    EmojiRecord::EmojiRecord(QString _category, QString _fileName, const int _index, EmojiCode _baseCodePoints, EmojiCode _fullCodePoints)
-        : Category_(std::move(_category))
-        , FileName_(std::move(_fileName))
-        , Index_(_index)
-        , baseCodePoints_(std::move(_baseCodePoints))
-        , fullCodePoints(std::move(_fullCodePoints))
+    static EmojiRecordPtr findInIndex(const EmojiCode& _code, const uint16_t* _seeds, const uint16_t* _slots, bool _isFull) noexcept
     {
-        assert(!Category_.isEmpty());
-        assert(!FileName_.isEmpty());
-        assert(Index_ >= 0);
-        assert(!baseCodePoints_.isNull());
-        assert(!fullCodePoints.isNull());
-    }
+        using namespace HashIndex;
 
-    EmojiRecord::EmojiRecord(QString _category, QString _fileName, const int _index, EmojiCode _baseCodePoints)
-        : EmojiRecord(std::move(_category), std::move(_fileName), _index, _baseCodePoints, _baseCodePoints)
-    {
-    }
+        const auto seed = _seeds[hashCode(_code, 0) % bucketsCount];
+        const auto slot = _slots[hashCode(_code, seed) % slotsCount];
+        if (slot == 0)
+            return nullptr;
 
-    static constexpr bool skipEmoji(const EmojiCode& code) noexcept
-    {
-        if (code.size() == 1)
-        {
-            const auto main = code.codepointAt(0);
-            if (main <= '9' && main >= '0')
-                return true;
-            if (main == '#' || main == '*')
-                return true;
-        }
-        return false;
-    }
+        const auto& record = getEmojiTable()[slot - 1];
+        if ((_isFull ? record.fullCodePoints : record.baseCodePoints_) != _code)
+            return nullptr;
 
-    namespace
-    {
-        enum class CodePointType
-        {
-            Full,
-            Base
-        };
+        return &record;
     }
 
-    static EmojiIndex makeIndex(const EmojiRecordSptrVec& vector, CodePointType type)
+    static bool isAllowed(const EmojiRecord& _record)
     {
 #if defined(__APPLE__)
         static_assert ((canSendEmojiOneOnMac() && canViewEmojiOneOnMac())
                        || (!canSendEmojiOneOnMac() && canViewEmojiOneOnMac())
                        || (!canSendEmojiOneOnMac() && !canViewEmojiOneOnMac()), "invariant fail");
+
+        if constexpr (useNativeEmoji())
+        {
+            if (mac::isSkipEmojiFullCode(_record.fullCodePoints))
+                return false;
+
+            if (!mac::supportEmoji(_record.fullCodePoints) && !canViewEmojiOneOnMac())
+                return false;
+        }
 #endif
-        EmojiIndex index;
-        for (const auto& record : vector)
+        return true;
+    }
+
+    static void initCategories()
+    {
+        const auto& table = getEmojiTable();
+
+        for (const auto& range : HashIndex::categoryRanges)
         {
-            if (skipEmoji(record->baseCodePoints_))
-                continue;
+            EmojiRecordVec records;
+            records.reserve(range.end_ - range.begin_);
 
-#if defined(__APPLE__)
-            if constexpr (useNativeEmoji())
+            for (auto i = range.begin_; i < range.end_; ++i)
             {
-                if (mac::isSkipEmojiFullCode(record->fullCodePoints))
-                    continue;
+                const auto& record = table[HashIndex::pickerRecords[i]];
+                assert(!record.Category_.empty());
 
-                if (!mac::supportEmoji(record->fullCodePoints) && !canViewEmojiOneOnMac())
+#if defined(__APPLE__)
+                if constexpr (useNativeEmoji())
+                {
+                    if (mac::isSkipEmojiFullCode(record.fullCodePoints))
+                        continue;
+
+                    if (!canSendEmojiOneOnMac() && !mac::supportEmoji(record.fullCodePoints) && !isSupported(record.fileName()))
+                        continue;
+                }
+#else
+                if (!isSupported(record.fileName()))
                     continue;
-            }
 #endif
-            index.emplace(type == CodePointType::Full ? record->fullCodePoints : record->baseCodePoints_, record);
+                records.push_back(&record);
+            }
+
+            if (records.empty())
+                continue;
+
+            auto category = QString::fromLatin1(range.name_.data(), int(range.name_.size()));
+            EmojiCategories_.push_back(category);
+            EmojiIndexByCategory_.emplace(std::move(category), std::move(records));
         }
-        return index;
-    }
 
-    static bool containsSkinTone(const EmojiCode& code) noexcept // c++20: make constexpr
-    {
-        constexpr static EmojiCode::codePointType skinTones[] = { 0x1f3fc, 0x1f3fb, 0x1f3fd, 0x1f3fe, 0x1f3ff };
-        return std::any_of(std::begin(skinTones), std::end(skinTones), [&code](auto tone) { return code.contains(tone); });
+        categoriesInitialized_ = true;
     }
 
-    static bool containsWithGender(const EmojiIndex& index, const EmojiCode& code)
+#ifdef _DEBUG
+    static constexpr bool skipEmoji(const EmojiCode& code) noexcept
     {
-        if (code.size() < EmojiCode::maxSize())
+        if (code.size() == 1)
         {
-            constexpr static EmojiCode::codePointType genders[] = { 0x2640, 0x2642 };
-            return std::any_of(std::begin(genders), std::end(genders), [&index, &code](auto gender) { return index.find(EmojiCode::addCodePoint(code, gender)) != index.end(); });
+            const auto main = code.codepointAt(0);
+            if (main <= '9' && main >= '0')
+                return true;
+            if (main == '#' || main == '*')
+                return true;
         }
         return false;
     }
 
-    static bool isHairType(const EmojiCode& code) noexcept // c++20: make constexpr
+    // catches a table changed without running emoji_index_gen.py
+    static void checkIndex()
     {
-        if (code.size() > 1)
-            return false;
+        for (const auto& record : getEmojiTable())
+        {
+            if (skipEmoji(record.baseCodePoints_))
+                continue;
 
-        constexpr static EmojiCode::codePointType hairTypes[] = { 0x1f9b0, 0x1f9b1, 0x1f9b2, 0x1f9b3 };
-        return std::any_of(std::begin(hairTypes), std::end(hairTypes), [&code](auto tone) { return code.contains(tone); });
+            assert(findInIndex(record.fullCodePoints, HashIndex::fullCodeSeeds, HashIndex::fullCodeSlots, true));
+            assert(findInIndex(record.baseCodePoints_, HashIndex::baseCodeSeeds, HashIndex::baseCodeSlots, false));
+        }
     }
+#endif
 
     void InitEmojiDb()
     {
-        EmojiIndexByOrder_ = getEmojiVector();
 #if defined(__APPLE__)
-        mac::setEmojiVector(EmojiIndexByOrder_);
+        mac::setEmojiVector(getEmojiTable());
 #endif
-        assert(!EmojiIndexByOrder_.empty());
-
-        emojiIndexByFullCodepoint_ = makeIndex(EmojiIndexByOrder_, CodePointType::Full);
-
-        emojiIndexByBaseCodepoint_ = makeIndex(EmojiIndexByOrder_, CodePointType::Base);
 
-        for (const auto& record : EmojiIndexByOrder_)
-        {
-            if (skipEmoji(record->baseCodePoints_))
-                continue;
-
-            if (containsSkinTone(record->baseCodePoints_)) // don't add skin tones to picker
-                continue;
-
-            if (containsWithGender(emojiIndexByBaseCodepoint_, record->baseCodePoints_))
-                continue;
-
-            if (isHairType(record->baseCodePoints_))
-                continue;
-
-            if (record->Category_.isEmpty())
-                continue;
-
-#if defined(__APPLE__)
-            if constexpr (useNativeEmoji())
-            {
-                if (mac::isSkipEmojiFullCode(record->fullCodePoints))
-                    continue;
-
-                if (!canSendEmojiOneOnMac() && !mac::supportEmoji(record->fullCodePoints) && !isSupported(record->FileName_))
-                    continue;
-            }
-#else
-            if (!isSupported(record->FileName_))
-                continue;
+#ifdef _DEBUG
+        checkIndex();
 #endif
-
-            const auto& category = record->Category_;
-            assert(!category.isEmpty());
-
-            auto& records = EmojiIndexByCategory_[category];
-            records.push_back(record);
-        }
-
-        for (auto& category : EmojiCategoriesOrder_)
-        {
-            auto& records = EmojiIndexByCategory_[category];
-            if (records.size() > 0)
-                EmojiCategories_.push_back(category);
-        }
     }
 
     bool isEmoji(const EmojiCode& _code)
     {
-        assert(!_code.isNull());
-        assert(!emojiIndexByFullCodepoint_.empty() && !emojiIndexByBaseCodepoint_.empty());
-        return std::as_const(emojiIndexByFullCodepoint_).find(_code) != std::as_const(emojiIndexByFullCodepoint_).end()
-            || std::as_const(emojiIndexByBaseCodepoint_).find(_code) != std::as_const(emojiIndexByBaseCodepoint_).end();
+        return GetEmojiInfoByCodepoint(_code) != nullptr;
     }
 
-    const EmojiRecordSptr& GetEmojiInfoByCodepoint(const EmojiCode& _code)
+    EmojiRecordPtr GetEmojiInfoByCodepoint(const EmojiCode& _code)
     {
         assert(!_code.isNull());
-        assert(!emojiIndexByFullCodepoint_.empty() && !emojiIndexByBaseCodepoint_.empty());
 
-        if (const auto iter = std::as_const(emojiIndexByFullCodepoint_).find(_code); iter != std::as_const(emojiIndexByFullCodepoint_).end())
-            return iter->second;
+        if (const auto record = findInIndex(_code, HashIndex::fullCodeSeeds, HashIndex::fullCodeSlots, true); record && isAllowed(*record))
+            return record;
 
-        if (const auto iter = std::as_const(emojiIndexByBaseCodepoint_).find(_code); iter != std::as_const(emojiIndexByBaseCodepoint_).end())
-            return iter->second;
+        if (const auto record = findInIndex(_code, HashIndex::baseCodeSeeds, HashIndex::baseCodeSlots, false); record && isAllowed(*record))
+            return record;
 
-        static const EmojiRecordSptr EmptyEmoji;
-        return EmptyEmoji;
+        return nullptr;
     }
 
     const QVector<QString>& GetEmojiCategories()
     {
+        if (!categoriesInitialized_)
+            initCategories();
+
         assert(!EmojiCategories_.isEmpty());
 
         return EmojiCategories_;
     }
 
-    const EmojiRecordSptrVec& GetEmojiInfoByCategory(const QString& _category)
+    const EmojiRecordVec& GetEmojiInfoByCategory(const QString& _category)
     {
         assert(!_category.isEmpty());
 
+        if (!categoriesInitialized_)
+            initCategories();
+
         if (const auto iter = std::as_const(EmojiIndexByCategory_).find(_category); iter != std::as_const(EmojiIndexByCategory_).end())
             return iter->second;
 
-        static const EmojiRecordSptrVec empty;
+        static const EmojiRecordVec empty;
         return empty;
     }
 }
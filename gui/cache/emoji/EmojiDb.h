@@ -21,11 +21,25 @@ namespace Emoji
 
     struct EmojiRecord
     {
-        EmojiRecord(QString _category, QString _fileName, const int _index, EmojiCode _baseCodePoints);
-        EmojiRecord(QString _category, QString _fileName, const int _index, EmojiCode _baseCodePoints, EmojiCode _fullCodePoints);
+        constexpr EmojiRecord(std::string_view _category, std::string_view _fileName, const int _index, const EmojiCode& _baseCodePoints) noexcept
+            : EmojiRecord(_category, _fileName, _index, _baseCodePoints, _baseCodePoints)
+        {
+        }
+
+        constexpr EmojiRecord(std::string_view _category, std::string_view _fileName, const int _index, const EmojiCode& _baseCodePoints, const EmojiCode& _fullCodePoints) noexcept
+            : Category_(_category)
+            , FileName_(_fileName)
+            , Index_(_index)
+            , baseCodePoints_(_baseCodePoints)
+            , fullCodePoints(_fullCodePoints)
+        {
+        }
+
+        QLatin1String category() const noexcept { return QLatin1String(Category_.data(), int(Category_.size())); }
+        QLatin1String fileName() const noexcept { return QLatin1String(FileName_.data(), int(FileName_.size())); }
 
-        const QString Category_;
-        const QString FileName_;
+        const std::string_view Category_;
+        const std::string_view FileName_;
 
         const int Index_;
 
@@ -33,19 +47,20 @@ namespace Emoji
         const EmojiCode fullCodePoints;
     };
 
-    using EmojiRecordSptr = std::shared_ptr<EmojiRecord>;
+    // records live in the static emoji table, pointers are valid for the whole process lifetime
+    using EmojiRecordPtr = const EmojiRecord*;
 
-    using EmojiRecordSptrVec = std::vector<EmojiRecordSptr>;
+    using EmojiRecordVec = std::vector<EmojiRecordPtr>;
 
     void InitEmojiDb();
 
     bool isEmoji(const EmojiCode& _code);
 
-    const EmojiRecordSptr& GetEmojiInfoByCodepoint(const EmojiCode& _code);
+    EmojiRecordPtr GetEmojiInfoByCodepoint(const EmojiCode& _code);
 
     const QVector<QString>& GetEmojiCategories();
 
-    const EmojiRecordSptrVec& GetEmojiInfoByCategory(const QString& _category);
+    const EmojiRecordVec& GetEmojiInfoByCategory(const QString& _category);
 }
 
 #endif // EMOJI_DB
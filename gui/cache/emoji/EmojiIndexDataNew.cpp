@@ -2,2843 +2,2849 @@
 #include "EmojiIndexDataNew.h"
 #include "EmojiCode.h"
 #include "EmojiDb.h"
-#include "EmojiCategory.h"
 
-namespace Emoji
+namespace
 {
-    std::vector<EmojiRecordSptr> getEmojiVector()
-    {
-        std::vector<EmojiRecordSptr> res;
-        res.reserve(2827);
+    using namespace Emoji;
 
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("red heart"),*/ qsl("2764"), 1, EmojiCode(0x2764), EmojiCode(0x2764, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("orange heart"),*/ qsl("1f9e1"), 2, EmojiCode(0x1f9e1)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("yellow heart"),*/ qsl("1f49b"), 3, EmojiCode(0x1f49b)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("green heart"),*/ qsl("1f49a"), 4, EmojiCode(0x1f49a)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("blue heart"),*/ qsl("1f499"), 5, EmojiCode(0x1f499)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("purple heart"),*/ qsl("1f49c"), 6, EmojiCode(0x1f49c)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("black heart"),*/ qsl("1f5a4"), 7, EmojiCode(0x1f5a4)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("broken heart"),*/ qsl("1f494"), 8, EmojiCode(0x1f494)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heavy heart exclamation"),*/ qsl("2763"), 9, EmojiCode(0x2763), EmojiCode(0x2763, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("two hearts"),*/ qsl("1f495"), 10, EmojiCode(0x1f495)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("revolving hearts"),*/ qsl("1f49e"), 11, EmojiCode(0x1f49e)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("beating heart"),*/ qsl("1f493"), 12, EmojiCode(0x1f493)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("growing heart"),*/ qsl("1f497"), 13, EmojiCode(0x1f497)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("sparkling heart"),*/ qsl("1f496"), 14, EmojiCode(0x1f496)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heart with arrow"),*/ qsl("1f498"), 15, EmojiCode(0x1f498)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heart with ribbon"),*/ qsl("1f49d"), 16, EmojiCode(0x1f49d)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heart decoration"),*/ qsl("1f49f"), 17, EmojiCode(0x1f49f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("peace symbol"),*/ qsl("262e"), 18, EmojiCode(0x262e), EmojiCode(0x262e, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("latin cross"),*/ qsl("271d"), 19, EmojiCode(0x271d), EmojiCode(0x271d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("star and crescent"),*/ qsl("262a"), 20, EmojiCode(0x262a), EmojiCode(0x262a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("om"),*/ qsl("1f549"), 21, EmojiCode(0x1f549), EmojiCode(0x1f549, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("wheel of dharma"),*/ qsl("2638"), 22, EmojiCode(0x2638), EmojiCode(0x2638, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("star of David"),*/ qsl("2721"), 23, EmojiCode(0x2721), EmojiCode(0x2721, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("dotted six-pointed star"),*/ qsl("1f52f"), 24, EmojiCode(0x1f52f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("menorah"),*/ qsl("1f54e"), 25, EmojiCode(0x1f54e)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("yin yang"),*/ qsl("262f"), 26, EmojiCode(0x262f), EmojiCode(0x262f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("orthodox cross"),*/ qsl("2626"), 27, EmojiCode(0x2626), EmojiCode(0x2626, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("place of worship"),*/ qsl("1f6d0"), 28, EmojiCode(0x1f6d0)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Ophiuchus"),*/ qsl("26ce"), 29, EmojiCode(0x26ce)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Aries"),*/ qsl("2648"), 30, EmojiCode(0x2648), EmojiCode(0x2648, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Taurus"),*/ qsl("2649"), 31, EmojiCode(0x2649), EmojiCode(0x2649, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Gemini"),*/ qsl("264a"), 32, EmojiCode(0x264a), EmojiCode(0x264a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Cancer"),*/ qsl("264b"), 33, EmojiCode(0x264b), EmojiCode(0x264b, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Leo"),*/ qsl("264c"), 34, EmojiCode(0x264c), EmojiCode(0x264c, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Virgo"),*/ qsl("264d"), 35, EmojiCode(0x264d), EmojiCode(0x264d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Libra"),*/ qsl("264e"), 36, EmojiCode(0x264e), EmojiCode(0x264e, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Scorpio"),*/ qsl("264f"), 37, EmojiCode(0x264f), EmojiCode(0x264f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Sagittarius"),*/ qsl("2650"), 38, EmojiCode(0x2650), EmojiCode(0x2650, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Capricorn"),*/ qsl("2651"), 39, EmojiCode(0x2651), EmojiCode(0x2651, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Aquarius"),*/ qsl("2652"), 40, EmojiCode(0x2652), EmojiCode(0x2652, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Pisces"),*/ qsl("2653"), 41, EmojiCode(0x2653), EmojiCode(0x2653, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("ID button"),*/ qsl("1f194"), 42, EmojiCode(0x1f194)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("atom symbol"),*/ qsl("269b"), 43, EmojiCode(0x269b), EmojiCode(0x269b, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("infinity"),*/ qsl("267e"), 44, EmojiCode(0x267e), EmojiCode(0x267e, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “acceptable” button"),*/ qsl("1f251"), 45, EmojiCode(0x1f251)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("radioactive"),*/ qsl("2622"), 46, EmojiCode(0x2622), EmojiCode(0x2622, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("biohazard"),*/ qsl("2623"), 47, EmojiCode(0x2623), EmojiCode(0x2623, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("mobile phone off"),*/ qsl("1f4f4"), 48, EmojiCode(0x1f4f4)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("vibration mode"),*/ qsl("1f4f3"), 49, EmojiCode(0x1f4f3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “not free of charge” button"),*/ qsl("1f236"), 50, EmojiCode(0x1f236)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “free of charge” button"),*/ qsl("1f21a"), 51, EmojiCode(0x1f21a), EmojiCode(0x1f21a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “application” button"),*/ qsl("1f238"), 52, EmojiCode(0x1f238)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “open for business” button"),*/ qsl("1f23a"), 53, EmojiCode(0x1f23a)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “monthly amount” button"),*/ qsl("1f237"), 54, EmojiCode(0x1f237), EmojiCode(0x1f237, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("eight-pointed star"),*/ qsl("2734"), 55, EmojiCode(0x2734), EmojiCode(0x2734, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("VS button"),*/ qsl("1f19a"), 56, EmojiCode(0x1f19a)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("white flower"),*/ qsl("1f4ae"), 57, EmojiCode(0x1f4ae)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “bargain” button"),*/ qsl("1f250"), 58, EmojiCode(0x1f250)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “secret” button"),*/ qsl("3299"), 59, EmojiCode(0x3299), EmojiCode(0x3299, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “congratulations” button"),*/ qsl("3297"), 60, EmojiCode(0x3297), EmojiCode(0x3297, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “passing grade” button"),*/ qsl("1f234"), 61, EmojiCode(0x1f234)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “no vacancy” button"),*/ qsl("1f235"), 62, EmojiCode(0x1f235)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “discount” button"),*/ qsl("1f239"), 63, EmojiCode(0x1f239)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “prohibited” button"),*/ qsl("1f232"), 64, EmojiCode(0x1f232)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("A button (blood type)"),*/ qsl("1f170"), 65, EmojiCode(0x1f170), EmojiCode(0x1f170, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("B button (blood type)"),*/ qsl("1f171"), 66, EmojiCode(0x1f171), EmojiCode(0x1f171, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("AB button (blood type)"),*/ qsl("1f18e"), 67, EmojiCode(0x1f18e)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("CL button"),*/ qsl("1f191"), 68, EmojiCode(0x1f191)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("O button (blood type)"),*/ qsl("1f17e"), 69, EmojiCode(0x1f17e), EmojiCode(0x1f17e, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("SOS button"),*/ qsl("1f198"), 70, EmojiCode(0x1f198)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("cross mark"),*/ qsl("274c"), 71, EmojiCode(0x274c)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heavy large circle"),*/ qsl("2b55"), 72, EmojiCode(0x2b55), EmojiCode(0x2b55, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("stop sign"),*/ qsl("1f6d1"), 73, EmojiCode(0x1f6d1)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("no entry"),*/ qsl("26d4"), 74, EmojiCode(0x26d4), EmojiCode(0x26d4, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("name badge"),*/ qsl("1f4db"), 75, EmojiCode(0x1f4db)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("prohibited"),*/ qsl("1f6ab"), 76, EmojiCode(0x1f6ab)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("hundred points"),*/ qsl("1f4af"), 77, EmojiCode(0x1f4af)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("anger symbol"),*/ qsl("1f4a2"), 78, EmojiCode(0x1f4a2)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("hot springs"),*/ qsl("2668"), 79, EmojiCode(0x2668), EmojiCode(0x2668, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("no pedestrians"),*/ qsl("1f6b7"), 80, EmojiCode(0x1f6b7)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("no littering"),*/ qsl("1f6af"), 81, EmojiCode(0x1f6af)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("no bicycles"),*/ qsl("1f6b3"), 82, EmojiCode(0x1f6b3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("non-potable water"),*/ qsl("1f6b1"), 83, EmojiCode(0x1f6b1)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("no one under eighteen"),*/ qsl("1f51e"), 84, EmojiCode(0x1f51e)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("no mobile phones"),*/ qsl("1f4f5"), 85, EmojiCode(0x1f4f5)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("no smoking"),*/ qsl("1f6ad"), 86, EmojiCode(0x1f6ad), EmojiCode(0x1f6ad, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("exclamation mark"),*/ qsl("2757"), 87, EmojiCode(0x2757), EmojiCode(0x2757, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("white exclamation mark"),*/ qsl("2755"), 88, EmojiCode(0x2755)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("question mark"),*/ qsl("2753"), 89, EmojiCode(0x2753), EmojiCode(0x2753, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("white question mark"),*/ qsl("2754"), 90, EmojiCode(0x2754)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("double exclamation mark"),*/ qsl("203c"), 91, EmojiCode(0x203c), EmojiCode(0x203c, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("exclamation question mark"),*/ qsl("2049"), 92, EmojiCode(0x2049), EmojiCode(0x2049, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("dim button"),*/ qsl("1f505"), 93, EmojiCode(0x1f505)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("bright button"),*/ qsl("1f506"), 94, EmojiCode(0x1f506)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("part alternation mark"),*/ qsl("303d"), 95, EmojiCode(0x303d), EmojiCode(0x303d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("warning"),*/ qsl("26a0"), 96, EmojiCode(0x26a0), EmojiCode(0x26a0, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("children crossing"),*/ qsl("1f6b8"), 97, EmojiCode(0x1f6b8)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("trident emblem"),*/ qsl("1f531"), 98, EmojiCode(0x1f531)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("fleur-de-lis"),*/ qsl("269c"), 99, EmojiCode(0x269c), EmojiCode(0x269c, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese symbol for beginner"),*/ qsl("1f530"), 100, EmojiCode(0x1f530)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("recycling symbol"),*/ qsl("267b"), 101, EmojiCode(0x267b), EmojiCode(0x267b, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("white heavy check mark"),*/ qsl("2705"), 102, EmojiCode(0x2705)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “reserved” button"),*/ qsl("1f22f"), 103, EmojiCode(0x1f22f), EmojiCode(0x1f22f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("chart increasing with yen"),*/ qsl("1f4b9"), 104, EmojiCode(0x1f4b9)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("sparkle"),*/ qsl("2747"), 105, EmojiCode(0x2747), EmojiCode(0x2747, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("eight-spoked asterisk"),*/ qsl("2733"), 106, EmojiCode(0x2733), EmojiCode(0x2733, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("cross mark button"),*/ qsl("274e"), 107, EmojiCode(0x274e)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("globe with meridians"),*/ qsl("1f310"), 108, EmojiCode(0x1f310)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("diamond with a dot"),*/ qsl("1f4a0"), 109, EmojiCode(0x1f4a0)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("circled M"),*/ qsl("24c2"), 110, EmojiCode(0x24c2), EmojiCode(0x24c2, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("cyclone"),*/ qsl("1f300"), 111, EmojiCode(0x1f300)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("zzz"),*/ qsl("1f4a4"), 112, EmojiCode(0x1f4a4)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("ATM sign"),*/ qsl("1f3e7"), 113, EmojiCode(0x1f3e7)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("water closet"),*/ qsl("1f6be"), 114, EmojiCode(0x1f6be)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("wheelchair symbol"),*/ qsl("267f"), 115, EmojiCode(0x267f), EmojiCode(0x267f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("P button"),*/ qsl("1f17f"), 116, EmojiCode(0x1f17f), EmojiCode(0x1f17f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “vacancy” button"),*/ qsl("1f233"), 117, EmojiCode(0x1f233)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “service charge” button"),*/ qsl("1f202"), 118, EmojiCode(0x1f202), EmojiCode(0x1f202, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("passport control"),*/ qsl("1f6c2"), 119, EmojiCode(0x1f6c2)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("customs"),*/ qsl("1f6c3"), 120, EmojiCode(0x1f6c3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("baggage claim"),*/ qsl("1f6c4"), 121, EmojiCode(0x1f6c4)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("left luggage"),*/ qsl("1f6c5"), 122, EmojiCode(0x1f6c5)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("men’s room"),*/ qsl("1f6b9"), 123, EmojiCode(0x1f6b9), EmojiCode(0x1f6b9, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("women’s room"),*/ qsl("1f6ba"), 124, EmojiCode(0x1f6ba), EmojiCode(0x1f6ba, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("baby symbol"),*/ qsl("1f6bc"), 125, EmojiCode(0x1f6bc), EmojiCode(0x1f6bc, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("restroom"),*/ qsl("1f6bb"), 126, EmojiCode(0x1f6bb)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("litter in bin sign"),*/ qsl("1f6ae"), 127, EmojiCode(0x1f6ae)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("cinema"),*/ qsl("1f3a6"), 128, EmojiCode(0x1f3a6)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("antenna bars"),*/ qsl("1f4f6"), 129, EmojiCode(0x1f4f6)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("Japanese “here” button"),*/ qsl("1f201"), 130, EmojiCode(0x1f201)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("input symbols"),*/ qsl("1f523"), 131, EmojiCode(0x1f523)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("information"),*/ qsl("2139"), 132, EmojiCode(0x2139), EmojiCode(0x2139, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("input latin letters"),*/ qsl("1f524"), 133, EmojiCode(0x1f524)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("input latin lowercase"),*/ qsl("1f521"), 134, EmojiCode(0x1f521)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("input latin uppercase"),*/ qsl("1f520"), 135, EmojiCode(0x1f520)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("NG button"),*/ qsl("1f196"), 136, EmojiCode(0x1f196)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("OK button"),*/ qsl("1f197"), 137, EmojiCode(0x1f197)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("UP! button"),*/ qsl("1f199"), 138, EmojiCode(0x1f199)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("COOL button"),*/ qsl("1f192"), 139, EmojiCode(0x1f192)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("NEW button"),*/ qsl("1f195"), 140, EmojiCode(0x1f195)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("FREE button"),*/ qsl("1f193"), 141, EmojiCode(0x1f193)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 0"),*/ qsl("0030-20e3"), 142, EmojiCode(0x0030, 0x20e3), EmojiCode(0x0030, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 1"),*/ qsl("0031-20e3"), 143, EmojiCode(0x0031, 0x20e3), EmojiCode(0x0031, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 2"),*/ qsl("0032-20e3"), 144, EmojiCode(0x0032, 0x20e3), EmojiCode(0x0032, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 3"),*/ qsl("0033-20e3"), 145, EmojiCode(0x0033, 0x20e3), EmojiCode(0x0033, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 4"),*/ qsl("0034-20e3"), 146, EmojiCode(0x0034, 0x20e3), EmojiCode(0x0034, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 5"),*/ qsl("0035-20e3"), 147, EmojiCode(0x0035, 0x20e3), EmojiCode(0x0035, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 6"),*/ qsl("0036-20e3"), 148, EmojiCode(0x0036, 0x20e3), EmojiCode(0x0036, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 7"),*/ qsl("0037-20e3"), 149, EmojiCode(0x0037, 0x20e3), EmojiCode(0x0037, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 8"),*/ qsl("0038-20e3"), 150, EmojiCode(0x0038, 0x20e3), EmojiCode(0x0038, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 9"),*/ qsl("0039-20e3"), 151, EmojiCode(0x0039, 0x20e3), EmojiCode(0x0039, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: 10"),*/ qsl("1f51f"), 152, EmojiCode(0x1f51f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("input numbers"),*/ qsl("1f522"), 153, EmojiCode(0x1f522)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: #"),*/ qsl("0023-20e3"), 154, EmojiCode(0x0023, 0x20e3), EmojiCode(0x0023, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("keycap: *"),*/ qsl("002a-20e3"), 155, EmojiCode(0x002a, 0x20e3), EmojiCode(0x002a, 0xfe0f, 0x20e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("eject button"),*/ qsl("23cf"), 156, EmojiCode(0x23cf), EmojiCode(0x23cf, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("play button"),*/ qsl("25b6"), 157, EmojiCode(0x25b6), EmojiCode(0x25b6, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("pause button"),*/ qsl("23f8"), 158, EmojiCode(0x23f8), EmojiCode(0x23f8, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("play or pause button"),*/ qsl("23ef"), 159, EmojiCode(0x23ef), EmojiCode(0x23ef, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("stop button"),*/ qsl("23f9"), 160, EmojiCode(0x23f9), EmojiCode(0x23f9, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("record button"),*/ qsl("23fa"), 161, EmojiCode(0x23fa), EmojiCode(0x23fa, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("next track button"),*/ qsl("23ed"), 162, EmojiCode(0x23ed), EmojiCode(0x23ed, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("last track button"),*/ qsl("23ee"), 163, EmojiCode(0x23ee), EmojiCode(0x23ee, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("fast-forward button"),*/ qsl("23e9"), 164, EmojiCode(0x23e9), EmojiCode(0x23e9, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("fast reverse button"),*/ qsl("23ea"), 165, EmojiCode(0x23ea), EmojiCode(0x23ea, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("fast up button"),*/ qsl("23eb"), 166, EmojiCode(0x23eb)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("fast down button"),*/ qsl("23ec"), 167, EmojiCode(0x23ec)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("reverse button"),*/ qsl("25c0"), 168, EmojiCode(0x25c0), EmojiCode(0x25c0, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("upwards button"),*/ qsl("1f53c"), 169, EmojiCode(0x1f53c)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("downwards button"),*/ qsl("1f53d"), 170, EmojiCode(0x1f53d)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("right arrow"),*/ qsl("27a1"), 171, EmojiCode(0x27a1), EmojiCode(0x27a1, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("left arrow"),*/ qsl("2b05"), 172, EmojiCode(0x2b05), EmojiCode(0x2b05, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("up arrow"),*/ qsl("2b06"), 173, EmojiCode(0x2b06), EmojiCode(0x2b06, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("down arrow"),*/ qsl("2b07"), 174, EmojiCode(0x2b07), EmojiCode(0x2b07, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("up-right arrow"),*/ qsl("2197"), 175, EmojiCode(0x2197), EmojiCode(0x2197, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("down-right arrow"),*/ qsl("2198"), 176, EmojiCode(0x2198), EmojiCode(0x2198, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("down-left arrow"),*/ qsl("2199"), 177, EmojiCode(0x2199), EmojiCode(0x2199, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("up-left arrow"),*/ qsl("2196"), 178, EmojiCode(0x2196), EmojiCode(0x2196, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("up-down arrow"),*/ qsl("2195"), 179, EmojiCode(0x2195), EmojiCode(0x2195, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("left-right arrow"),*/ qsl("2194"), 180, EmojiCode(0x2194), EmojiCode(0x2194, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("left arrow curving right"),*/ qsl("21aa"), 181, EmojiCode(0x21aa), EmojiCode(0x21aa, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("right arrow curving left"),*/ qsl("21a9"), 182, EmojiCode(0x21a9), EmojiCode(0x21a9, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("right arrow curving up"),*/ qsl("2934"), 183, EmojiCode(0x2934), EmojiCode(0x2934, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("right arrow curving down"),*/ qsl("2935"), 184, EmojiCode(0x2935), EmojiCode(0x2935, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("shuffle tracks button"),*/ qsl("1f500"), 185, EmojiCode(0x1f500)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("repeat button"),*/ qsl("1f501"), 186, EmojiCode(0x1f501)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("repeat single button"),*/ qsl("1f502"), 187, EmojiCode(0x1f502)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("counterclockwise arrows button"),*/ qsl("1f504"), 188, EmojiCode(0x1f504)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("clockwise vertical arrows"),*/ qsl("1f503"), 189, EmojiCode(0x1f503)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("musical note"),*/ qsl("1f3b5"), 190, EmojiCode(0x1f3b5)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("musical notes"),*/ qsl("1f3b6"), 191, EmojiCode(0x1f3b6)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heavy plus sign"),*/ qsl("2795"), 192, EmojiCode(0x2795)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heavy minus sign"),*/ qsl("2796"), 193, EmojiCode(0x2796)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heavy division sign"),*/ qsl("2797"), 194, EmojiCode(0x2797)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heavy multiplication x"),*/ qsl("2716"), 195, EmojiCode(0x2716), EmojiCode(0x2716, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heavy dollar sign"),*/ qsl("1f4b2"), 196, EmojiCode(0x1f4b2)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("currency exchange"),*/ qsl("1f4b1"), 197, EmojiCode(0x1f4b1)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("trade mark"),*/ qsl("2122"), 198, EmojiCode(0x2122), EmojiCode(0x2122, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("copyright"),*/ qsl("00a9"), 199, EmojiCode(0x00a9), EmojiCode(0x00a9, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("registered"),*/ qsl("00ae"), 200, EmojiCode(0x00ae), EmojiCode(0x00ae, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("wavy dash"),*/ qsl("3030"), 201, EmojiCode(0x3030), EmojiCode(0x3030, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("curly loop"),*/ qsl("27b0"), 202, EmojiCode(0x27b0)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("double curly loop"),*/ qsl("27bf"), 203, EmojiCode(0x27bf)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("END arrow"),*/ qsl("1f51a"), 204, EmojiCode(0x1f51a)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("BACK arrow"),*/ qsl("1f519"), 205, EmojiCode(0x1f519)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("ON! arrow"),*/ qsl("1f51b"), 206, EmojiCode(0x1f51b)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("TOP arrow"),*/ qsl("1f51d"), 207, EmojiCode(0x1f51d)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("SOON arrow"),*/ qsl("1f51c"), 208, EmojiCode(0x1f51c)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heavy check mark"),*/ qsl("2714"), 209, EmojiCode(0x2714), EmojiCode(0x2714, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("ballot box with check"),*/ qsl("2611"), 210, EmojiCode(0x2611), EmojiCode(0x2611, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("radio button"),*/ qsl("1f518"), 211, EmojiCode(0x1f518)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("white circle"),*/ qsl("26aa"), 212, EmojiCode(0x26aa), EmojiCode(0x26aa, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("black circle"),*/ qsl("26ab"), 213, EmojiCode(0x26ab), EmojiCode(0x26ab, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("red circle"),*/ qsl("1f534"), 214, EmojiCode(0x1f534)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("blue circle"),*/ qsl("1f535"), 215, EmojiCode(0x1f535)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("red triangle pointed up"),*/ qsl("1f53a"), 216, EmojiCode(0x1f53a)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("red triangle pointed down"),*/ qsl("1f53b"), 217, EmojiCode(0x1f53b)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("small orange diamond"),*/ qsl("1f538"), 218, EmojiCode(0x1f538)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("small blue diamond"),*/ qsl("1f539"), 219, EmojiCode(0x1f539)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("large orange diamond"),*/ qsl("1f536"), 220, EmojiCode(0x1f536)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("large blue diamond"),*/ qsl("1f537"), 221, EmojiCode(0x1f537)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("white square button"),*/ qsl("1f533"), 222, EmojiCode(0x1f533)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("black square button"),*/ qsl("1f532"), 223, EmojiCode(0x1f532)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("black small square"),*/ qsl("25aa"), 224, EmojiCode(0x25aa), EmojiCode(0x25aa, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("white small square"),*/ qsl("25ab"), 225, EmojiCode(0x25ab), EmojiCode(0x25ab, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("black medium-small square"),*/ qsl("25fe"), 226, EmojiCode(0x25fe), EmojiCode(0x25fe, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("white medium-small square"),*/ qsl("25fd"), 227, EmojiCode(0x25fd), EmojiCode(0x25fd, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("black medium square"),*/ qsl("25fc"), 228, EmojiCode(0x25fc), EmojiCode(0x25fc, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("white medium square"),*/ qsl("25fb"), 229, EmojiCode(0x25fb), EmojiCode(0x25fb, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("black large square"),*/ qsl("2b1b"), 230, EmojiCode(0x2b1b), EmojiCode(0x2b1b, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("white large square"),*/ qsl("2b1c"), 231, EmojiCode(0x2b1c), EmojiCode(0x2b1c, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("speaker low volume"),*/ qsl("1f508"), 232, EmojiCode(0x1f508), EmojiCode(0x1f508, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("muted speaker"),*/ qsl("1f507"), 233, EmojiCode(0x1f507)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("speaker medium volume"),*/ qsl("1f509"), 234, EmojiCode(0x1f509)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("speaker high volume"),*/ qsl("1f50a"), 235, EmojiCode(0x1f50a)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("bell"),*/ qsl("1f514"), 236, EmojiCode(0x1f514)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("bell with slash"),*/ qsl("1f515"), 237, EmojiCode(0x1f515)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("megaphone"),*/ qsl("1f4e3"), 238, EmojiCode(0x1f4e3)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("loudspeaker"),*/ qsl("1f4e2"), 239, EmojiCode(0x1f4e2)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("left speech bubble"),*/ qsl("1f5e8"), 240, EmojiCode(0x1f5e8), EmojiCode(0x1f5e8, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("eye in speech bubble"),*/ qsl("1f441-1f5e8"), 241, EmojiCode(0x1f441, 0x1f5e8), EmojiCode(0x1f441, 0xfe0f, 0x200d, 0x1f5e8, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("speech balloon"),*/ qsl("1f4ac"), 242, EmojiCode(0x1f4ac)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("thought balloon"),*/ qsl("1f4ad"), 243, EmojiCode(0x1f4ad)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("right anger bubble"),*/ qsl("1f5ef"), 244, EmojiCode(0x1f5ef), EmojiCode(0x1f5ef, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("spade suit"),*/ qsl("2660"), 245, EmojiCode(0x2660), EmojiCode(0x2660, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("club suit"),*/ qsl("2663"), 246, EmojiCode(0x2663), EmojiCode(0x2663, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("heart suit"),*/ qsl("2665"), 247, EmojiCode(0x2665), EmojiCode(0x2665, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("diamond suit"),*/ qsl("2666"), 248, EmojiCode(0x2666), EmojiCode(0x2666, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("joker"),*/ qsl("1f0cf"), 249, EmojiCode(0x1f0cf)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("flower playing cards"),*/ qsl("1f3b4"), 250, EmojiCode(0x1f3b4)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("mahjong red dragon"),*/ qsl("1f004"), 251, EmojiCode(0x1f004), EmojiCode(0x1f004, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("one o’clock"),*/ qsl("1f550"), 252, EmojiCode(0x1f550), EmojiCode(0x1f550, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("two o’clock"),*/ qsl("1f551"), 253, EmojiCode(0x1f551), EmojiCode(0x1f551, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("three o’clock"),*/ qsl("1f552"), 254, EmojiCode(0x1f552), EmojiCode(0x1f552, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("four o’clock"),*/ qsl("1f553"), 255, EmojiCode(0x1f553), EmojiCode(0x1f553, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("five o’clock"),*/ qsl("1f554"), 256, EmojiCode(0x1f554), EmojiCode(0x1f554, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("six o’clock"),*/ qsl("1f555"), 257, EmojiCode(0x1f555), EmojiCode(0x1f555, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("seven o’clock"),*/ qsl("1f556"), 258, EmojiCode(0x1f556), EmojiCode(0x1f556, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("eight o’clock"),*/ qsl("1f557"), 259, EmojiCode(0x1f557), EmojiCode(0x1f557, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("nine o’clock"),*/ qsl("1f558"), 260, EmojiCode(0x1f558), EmojiCode(0x1f558, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("ten o’clock"),*/ qsl("1f559"), 261, EmojiCode(0x1f559), EmojiCode(0x1f559, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("eleven o’clock"),*/ qsl("1f55a"), 262, EmojiCode(0x1f55a), EmojiCode(0x1f55a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("twelve o’clock"),*/ qsl("1f55b"), 263, EmojiCode(0x1f55b), EmojiCode(0x1f55b, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("one-thirty"),*/ qsl("1f55c"), 264, EmojiCode(0x1f55c), EmojiCode(0x1f55c, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("two-thirty"),*/ qsl("1f55d"), 265, EmojiCode(0x1f55d), EmojiCode(0x1f55d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("three-thirty"),*/ qsl("1f55e"), 266, EmojiCode(0x1f55e), EmojiCode(0x1f55e, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("four-thirty"),*/ qsl("1f55f"), 267, EmojiCode(0x1f55f), EmojiCode(0x1f55f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("five-thirty"),*/ qsl("1f560"), 268, EmojiCode(0x1f560), EmojiCode(0x1f560, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("six-thirty"),*/ qsl("1f561"), 269, EmojiCode(0x1f561), EmojiCode(0x1f561, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("seven-thirty"),*/ qsl("1f562"), 270, EmojiCode(0x1f562), EmojiCode(0x1f562, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("eight-thirty"),*/ qsl("1f563"), 271, EmojiCode(0x1f563), EmojiCode(0x1f563, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("nine-thirty"),*/ qsl("1f564"), 272, EmojiCode(0x1f564), EmojiCode(0x1f564, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("ten-thirty"),*/ qsl("1f565"), 273, EmojiCode(0x1f565), EmojiCode(0x1f565, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("eleven-thirty"),*/ qsl("1f566"), 274, EmojiCode(0x1f566), EmojiCode(0x1f566, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("twelve-thirty"),*/ qsl("1f567"), 275, EmojiCode(0x1f567), EmojiCode(0x1f567, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("digit zero"),*/ qsl("0030"), 276, EmojiCode(0x0030), EmojiCode(0x0030, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("digit one"),*/ qsl("0031"), 277, EmojiCode(0x0031), EmojiCode(0x0031, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("digit two"),*/ qsl("0032"), 278, EmojiCode(0x0032), EmojiCode(0x0032, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("digit three"),*/ qsl("0033"), 279, EmojiCode(0x0033), EmojiCode(0x0033, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("digit four"),*/ qsl("0034"), 280, EmojiCode(0x0034), EmojiCode(0x0034, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("digit five"),*/ qsl("0035"), 281, EmojiCode(0x0035), EmojiCode(0x0035, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("digit six"),*/ qsl("0036"), 282, EmojiCode(0x0036), EmojiCode(0x0036, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("digit seven"),*/ qsl("0037"), 283, EmojiCode(0x0037), EmojiCode(0x0037, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("digit eight"),*/ qsl("0038"), 284, EmojiCode(0x0038), EmojiCode(0x0038, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("digit nine"),*/ qsl("0039"), 285, EmojiCode(0x0039), EmojiCode(0x0039, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("pound symbol"),*/ qsl("0023"), 286, EmojiCode(0x0023), EmojiCode(0x0023, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("asterisk"),*/ qsl("002a"), 287, EmojiCode(0x002a), EmojiCode(0x002a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("female sign"),*/ qsl("2640"), 288, EmojiCode(0x2640), EmojiCode(0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("male sign"),*/ qsl("2642"), 289, EmojiCode(0x2642), EmojiCode(0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(symbolsCategory(), /*qsl("medical symbol"),*/ qsl("2695"), 290, EmojiCode(0x2695), EmojiCode(0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("soccer ball"),*/ qsl("26bd"), 291, EmojiCode(0x26bd), EmojiCode(0x26bd, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("basketball"),*/ qsl("1f3c0"), 292, EmojiCode(0x1f3c0)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("american football"),*/ qsl("1f3c8"), 293, EmojiCode(0x1f3c8)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("baseball"),*/ qsl("26be"), 294, EmojiCode(0x26be), EmojiCode(0x26be, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("softball"),*/ qsl("1f94e"), 295, EmojiCode(0x1f94e)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("tennis"),*/ qsl("1f3be"), 296, EmojiCode(0x1f3be)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("volleyball"),*/ qsl("1f3d0"), 297, EmojiCode(0x1f3d0)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("rugby football"),*/ qsl("1f3c9"), 298, EmojiCode(0x1f3c9)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("pool 8 ball"),*/ qsl("1f3b1"), 299, EmojiCode(0x1f3b1)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("ping pong"),*/ qsl("1f3d3"), 300, EmojiCode(0x1f3d3)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("badminton"),*/ qsl("1f3f8"), 301, EmojiCode(0x1f3f8)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("goal net"),*/ qsl("1f945"), 302, EmojiCode(0x1f945)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("ice hockey"),*/ qsl("1f3d2"), 303, EmojiCode(0x1f3d2)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("field hockey"),*/ qsl("1f3d1"), 304, EmojiCode(0x1f3d1)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("cricket game"),*/ qsl("1f3cf"), 305, EmojiCode(0x1f3cf)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("lacrosse"),*/ qsl("1f94d"), 306, EmojiCode(0x1f94d)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("flag in hole"),*/ qsl("26f3"), 307, EmojiCode(0x26f3), EmojiCode(0x26f3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("flying disc"),*/ qsl("1f94f"), 308, EmojiCode(0x1f94f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("bow and arrow"),*/ qsl("1f3f9"), 309, EmojiCode(0x1f3f9)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("fishing pole"),*/ qsl("1f3a3"), 310, EmojiCode(0x1f3a3)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("boxing glove"),*/ qsl("1f94a"), 311, EmojiCode(0x1f94a)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("martial arts uniform"),*/ qsl("1f94b"), 312, EmojiCode(0x1f94b)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("running shirt"),*/ qsl("1f3bd"), 313, EmojiCode(0x1f3bd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("skateboard"),*/ qsl("1f6f9"), 314, EmojiCode(0x1f6f9)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("ice skate"),*/ qsl("26f8"), 315, EmojiCode(0x26f8), EmojiCode(0x26f8, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("curling stone"),*/ qsl("1f94c"), 316, EmojiCode(0x1f94c)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("sled"),*/ qsl("1f6f7"), 317, EmojiCode(0x1f6f7)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("skis"),*/ qsl("1f3bf"), 318, EmojiCode(0x1f3bf)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("skier"),*/ qsl("26f7"), 319, EmojiCode(0x26f7), EmojiCode(0x26f7, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("snowboarder"),*/ qsl("1f3c2"), 320, EmojiCode(0x1f3c2), EmojiCode(0x1f3c2, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("snowboarder: light skin tone"),*/ qsl("1f3c2-1f3fb"), 321, EmojiCode(0x1f3c2, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("snowboarder: medium-light skin tone"),*/ qsl("1f3c2-1f3fc"), 322, EmojiCode(0x1f3c2, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("snowboarder: medium skin tone"),*/ qsl("1f3c2-1f3fd"), 323, EmojiCode(0x1f3c2, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("snowboarder: medium-dark skin tone"),*/ qsl("1f3c2-1f3fe"), 324, EmojiCode(0x1f3c2, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("snowboarder: dark skin tone"),*/ qsl("1f3c2-1f3ff"), 325, EmojiCode(0x1f3c2, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person lifting weights"),*/ qsl("1f3cb"), 326, EmojiCode(0x1f3cb), EmojiCode(0x1f3cb, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person lifting weights: light skin tone"),*/ qsl("1f3cb-1f3fb"), 327, EmojiCode(0x1f3cb, 0x1f3fb), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person lifting weights: medium-light skin tone"),*/ qsl("1f3cb-1f3fc"), 328, EmojiCode(0x1f3cb, 0x1f3fc), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person lifting weights: medium skin tone"),*/ qsl("1f3cb-1f3fd"), 329, EmojiCode(0x1f3cb, 0x1f3fd), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person lifting weights: medium-dark skin tone"),*/ qsl("1f3cb-1f3fe"), 330, EmojiCode(0x1f3cb, 0x1f3fe), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person lifting weights: dark skin tone"),*/ qsl("1f3cb-1f3ff"), 331, EmojiCode(0x1f3cb, 0x1f3ff), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman lifting weights"),*/ qsl("1f3cb-2640"), 332, EmojiCode(0x1f3cb, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman lifting weights: light skin tone"),*/ qsl("1f3cb-1f3fb-2640"), 333, EmojiCode(0x1f3cb, 0x1f3fb, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman lifting weights: medium-light skin tone"),*/ qsl("1f3cb-1f3fc-2640"), 334, EmojiCode(0x1f3cb, 0x1f3fc, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman lifting weights: medium skin tone"),*/ qsl("1f3cb-1f3fd-2640"), 335, EmojiCode(0x1f3cb, 0x1f3fd, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman lifting weights: medium-dark skin tone"),*/ qsl("1f3cb-1f3fe-2640"), 336, EmojiCode(0x1f3cb, 0x1f3fe, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman lifting weights: dark skin tone"),*/ qsl("1f3cb-1f3ff-2640"), 337, EmojiCode(0x1f3cb, 0x1f3ff, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man lifting weights"),*/ qsl("1f3cb-2642"), 338, EmojiCode(0x1f3cb, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man lifting weights: light skin tone"),*/ qsl("1f3cb-1f3fb-2642"), 339, EmojiCode(0x1f3cb, 0x1f3fb, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man lifting weights: medium-light skin tone"),*/ qsl("1f3cb-1f3fc-2642"), 340, EmojiCode(0x1f3cb, 0x1f3fc, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man lifting weights: medium skin tone"),*/ qsl("1f3cb-1f3fd-2642"), 341, EmojiCode(0x1f3cb, 0x1f3fd, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man lifting weights: medium-dark skin tone"),*/ qsl("1f3cb-1f3fe-2642"), 342, EmojiCode(0x1f3cb, 0x1f3fe, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man lifting weights: dark skin tone"),*/ qsl("1f3cb-1f3ff-2642"), 343, EmojiCode(0x1f3cb, 0x1f3ff, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("people wrestling"),*/ qsl("1f93c"), 344, EmojiCode(0x1f93c)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("women wrestling"),*/ qsl("1f93c-2640"), 345, EmojiCode(0x1f93c, 0x2640), EmojiCode(0x1f93c, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("men wrestling"),*/ qsl("1f93c-2642"), 346, EmojiCode(0x1f93c, 0x2642), EmojiCode(0x1f93c, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person cartwheeling"),*/ qsl("1f938"), 347, EmojiCode(0x1f938)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person cartwheeling: light skin tone"),*/ qsl("1f938-1f3fb"), 348, EmojiCode(0x1f938, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person cartwheeling: medium-light skin tone"),*/ qsl("1f938-1f3fc"), 349, EmojiCode(0x1f938, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person cartwheeling: medium skin tone"),*/ qsl("1f938-1f3fd"), 350, EmojiCode(0x1f938, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person cartwheeling: medium-dark skin tone"),*/ qsl("1f938-1f3fe"), 351, EmojiCode(0x1f938, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person cartwheeling: dark skin tone"),*/ qsl("1f938-1f3ff"), 352, EmojiCode(0x1f938, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman cartwheeling"),*/ qsl("1f938-2640"), 353, EmojiCode(0x1f938, 0x2640), EmojiCode(0x1f938, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman cartwheeling: light skin tone"),*/ qsl("1f938-1f3fb-2640"), 354, EmojiCode(0x1f938, 0x1f3fb, 0x2640), EmojiCode(0x1f938, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman cartwheeling: medium-light skin tone"),*/ qsl("1f938-1f3fc-2640"), 355, EmojiCode(0x1f938, 0x1f3fc, 0x2640), EmojiCode(0x1f938, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman cartwheeling: medium skin tone"),*/ qsl("1f938-1f3fd-2640"), 356, EmojiCode(0x1f938, 0x1f3fd, 0x2640), EmojiCode(0x1f938, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman cartwheeling: medium-dark skin tone"),*/ qsl("1f938-1f3fe-2640"), 357, EmojiCode(0x1f938, 0x1f3fe, 0x2640), EmojiCode(0x1f938, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman cartwheeling: dark skin tone"),*/ qsl("1f938-1f3ff-2640"), 358, EmojiCode(0x1f938, 0x1f3ff, 0x2640), EmojiCode(0x1f938, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man cartwheeling"),*/ qsl("1f938-2642"), 359, EmojiCode(0x1f938, 0x2642), EmojiCode(0x1f938, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man cartwheeling: light skin tone"),*/ qsl("1f938-1f3fb-2642"), 360, EmojiCode(0x1f938, 0x1f3fb, 0x2642), EmojiCode(0x1f938, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man cartwheeling: medium-light skin tone"),*/ qsl("1f938-1f3fc-2642"), 361, EmojiCode(0x1f938, 0x1f3fc, 0x2642), EmojiCode(0x1f938, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man cartwheeling: medium skin tone"),*/ qsl("1f938-1f3fd-2642"), 362, EmojiCode(0x1f938, 0x1f3fd, 0x2642), EmojiCode(0x1f938, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man cartwheeling: medium-dark skin tone"),*/ qsl("1f938-1f3fe-2642"), 363, EmojiCode(0x1f938, 0x1f3fe, 0x2642), EmojiCode(0x1f938, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man cartwheeling: dark skin tone"),*/ qsl("1f938-1f3ff-2642"), 364, EmojiCode(0x1f938, 0x1f3ff, 0x2642), EmojiCode(0x1f938, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person bouncing ball"),*/ qsl("26f9"), 365, EmojiCode(0x26f9), EmojiCode(0x26f9, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person bouncing ball: light skin tone"),*/ qsl("26f9-1f3fb"), 366, EmojiCode(0x26f9, 0x1f3fb), EmojiCode(0x26f9, 0xfe0f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person bouncing ball: medium-light skin tone"),*/ qsl("26f9-1f3fc"), 367, EmojiCode(0x26f9, 0x1f3fc), EmojiCode(0x26f9, 0xfe0f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person bouncing ball: medium skin tone"),*/ qsl("26f9-1f3fd"), 368, EmojiCode(0x26f9, 0x1f3fd), EmojiCode(0x26f9, 0xfe0f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person bouncing ball: medium-dark skin tone"),*/ qsl("26f9-1f3fe"), 369, EmojiCode(0x26f9, 0x1f3fe), EmojiCode(0x26f9, 0xfe0f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person bouncing ball: dark skin tone"),*/ qsl("26f9-1f3ff"), 370, EmojiCode(0x26f9, 0x1f3ff), EmojiCode(0x26f9, 0xfe0f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman bouncing ball"),*/ qsl("26f9-2640"), 371, EmojiCode(0x26f9, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman bouncing ball: light skin tone"),*/ qsl("26f9-1f3fb-2640"), 372, EmojiCode(0x26f9, 0x1f3fb, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman bouncing ball: medium-light skin tone"),*/ qsl("26f9-1f3fc-2640"), 373, EmojiCode(0x26f9, 0x1f3fc, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman bouncing ball: medium skin tone"),*/ qsl("26f9-1f3fd-2640"), 374, EmojiCode(0x26f9, 0x1f3fd, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman bouncing ball: medium-dark skin tone"),*/ qsl("26f9-1f3fe-2640"), 375, EmojiCode(0x26f9, 0x1f3fe, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman bouncing ball: dark skin tone"),*/ qsl("26f9-1f3ff-2640"), 376, EmojiCode(0x26f9, 0x1f3ff, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man bouncing ball"),*/ qsl("26f9-2642"), 377, EmojiCode(0x26f9, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man bouncing ball: light skin tone"),*/ qsl("26f9-1f3fb-2642"), 378, EmojiCode(0x26f9, 0x1f3fb, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man bouncing ball: medium-light skin tone"),*/ qsl("26f9-1f3fc-2642"), 379, EmojiCode(0x26f9, 0x1f3fc, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man bouncing ball: medium skin tone"),*/ qsl("26f9-1f3fd-2642"), 380, EmojiCode(0x26f9, 0x1f3fd, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man bouncing ball: medium-dark skin tone"),*/ qsl("26f9-1f3fe-2642"), 381, EmojiCode(0x26f9, 0x1f3fe, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man bouncing ball: dark skin tone"),*/ qsl("26f9-1f3ff-2642"), 382, EmojiCode(0x26f9, 0x1f3ff, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person fencing"),*/ qsl("1f93a"), 383, EmojiCode(0x1f93a)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing handball"),*/ qsl("1f93e"), 384, EmojiCode(0x1f93e)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing handball: light skin tone"),*/ qsl("1f93e-1f3fb"), 385, EmojiCode(0x1f93e, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing handball: medium-light skin tone"),*/ qsl("1f93e-1f3fc"), 386, EmojiCode(0x1f93e, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing handball: medium skin tone"),*/ qsl("1f93e-1f3fd"), 387, EmojiCode(0x1f93e, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing handball: medium-dark skin tone"),*/ qsl("1f93e-1f3fe"), 388, EmojiCode(0x1f93e, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing handball: dark skin tone"),*/ qsl("1f93e-1f3ff"), 389, EmojiCode(0x1f93e, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing handball"),*/ qsl("1f93e-2640"), 390, EmojiCode(0x1f93e, 0x2640), EmojiCode(0x1f93e, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing handball: light skin tone"),*/ qsl("1f93e-1f3fb-2640"), 391, EmojiCode(0x1f93e, 0x1f3fb, 0x2640), EmojiCode(0x1f93e, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing handball: medium-light skin tone"),*/ qsl("1f93e-1f3fc-2640"), 392, EmojiCode(0x1f93e, 0x1f3fc, 0x2640), EmojiCode(0x1f93e, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing handball: medium skin tone"),*/ qsl("1f93e-1f3fd-2640"), 393, EmojiCode(0x1f93e, 0x1f3fd, 0x2640), EmojiCode(0x1f93e, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing handball: medium-dark skin tone"),*/ qsl("1f93e-1f3fe-2640"), 394, EmojiCode(0x1f93e, 0x1f3fe, 0x2640), EmojiCode(0x1f93e, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing handball: dark skin tone"),*/ qsl("1f93e-1f3ff-2640"), 395, EmojiCode(0x1f93e, 0x1f3ff, 0x2640), EmojiCode(0x1f93e, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing handball"),*/ qsl("1f93e-2642"), 396, EmojiCode(0x1f93e, 0x2642), EmojiCode(0x1f93e, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing handball: light skin tone"),*/ qsl("1f93e-1f3fb-2642"), 397, EmojiCode(0x1f93e, 0x1f3fb, 0x2642), EmojiCode(0x1f93e, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing handball: medium-light skin tone"),*/ qsl("1f93e-1f3fc-2642"), 398, EmojiCode(0x1f93e, 0x1f3fc, 0x2642), EmojiCode(0x1f93e, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing handball: medium skin tone"),*/ qsl("1f93e-1f3fd-2642"), 399, EmojiCode(0x1f93e, 0x1f3fd, 0x2642), EmojiCode(0x1f93e, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing handball: medium-dark skin tone"),*/ qsl("1f93e-1f3fe-2642"), 400, EmojiCode(0x1f93e, 0x1f3fe, 0x2642), EmojiCode(0x1f93e, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing handball: dark skin tone"),*/ qsl("1f93e-1f3ff-2642"), 401, EmojiCode(0x1f93e, 0x1f3ff, 0x2642), EmojiCode(0x1f93e, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person golfing"),*/ qsl("1f3cc"), 402, EmojiCode(0x1f3cc), EmojiCode(0x1f3cc, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person golfing: light skin tone"),*/ qsl("1f3cc-1f3fb"), 403, EmojiCode(0x1f3cc, 0x1f3fb), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person golfing: medium-light skin tone"),*/ qsl("1f3cc-1f3fc"), 404, EmojiCode(0x1f3cc, 0x1f3fc), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person golfing: medium skin tone"),*/ qsl("1f3cc-1f3fd"), 405, EmojiCode(0x1f3cc, 0x1f3fd), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person golfing: medium-dark skin tone"),*/ qsl("1f3cc-1f3fe"), 406, EmojiCode(0x1f3cc, 0x1f3fe), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person golfing: dark skin tone"),*/ qsl("1f3cc-1f3ff"), 407, EmojiCode(0x1f3cc, 0x1f3ff), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman golfing"),*/ qsl("1f3cc-2640"), 408, EmojiCode(0x1f3cc, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman golfing: light skin tone"),*/ qsl("1f3cc-1f3fb-2640"), 409, EmojiCode(0x1f3cc, 0x1f3fb, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman golfing: medium-light skin tone"),*/ qsl("1f3cc-1f3fc-2640"), 410, EmojiCode(0x1f3cc, 0x1f3fc, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman golfing: medium skin tone"),*/ qsl("1f3cc-1f3fd-2640"), 411, EmojiCode(0x1f3cc, 0x1f3fd, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman golfing: medium-dark skin tone"),*/ qsl("1f3cc-1f3fe-2640"), 412, EmojiCode(0x1f3cc, 0x1f3fe, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman golfing: dark skin tone"),*/ qsl("1f3cc-1f3ff-2640"), 413, EmojiCode(0x1f3cc, 0x1f3ff, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man golfing"),*/ qsl("1f3cc-2642"), 414, EmojiCode(0x1f3cc, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man golfing: light skin tone"),*/ qsl("1f3cc-1f3fb-2642"), 415, EmojiCode(0x1f3cc, 0x1f3fb, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man golfing: medium-light skin tone"),*/ qsl("1f3cc-1f3fc-2642"), 416, EmojiCode(0x1f3cc, 0x1f3fc, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man golfing: medium skin tone"),*/ qsl("1f3cc-1f3fd-2642"), 417, EmojiCode(0x1f3cc, 0x1f3fd, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man golfing: medium-dark skin tone"),*/ qsl("1f3cc-1f3fe-2642"), 418, EmojiCode(0x1f3cc, 0x1f3fe, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man golfing: dark skin tone"),*/ qsl("1f3cc-1f3ff-2642"), 419, EmojiCode(0x1f3cc, 0x1f3ff, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("horse racing"),*/ qsl("1f3c7"), 420, EmojiCode(0x1f3c7)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("horse racing: light skin tone"),*/ qsl("1f3c7-1f3fb"), 421, EmojiCode(0x1f3c7, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("horse racing: medium-light skin tone"),*/ qsl("1f3c7-1f3fc"), 422, EmojiCode(0x1f3c7, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("horse racing: medium skin tone"),*/ qsl("1f3c7-1f3fd"), 423, EmojiCode(0x1f3c7, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("horse racing: medium-dark skin tone"),*/ qsl("1f3c7-1f3fe"), 424, EmojiCode(0x1f3c7, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("horse racing: dark skin tone"),*/ qsl("1f3c7-1f3ff"), 425, EmojiCode(0x1f3c7, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person in lotus position"),*/ qsl("1f9d8"), 426, EmojiCode(0x1f9d8)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person in lotus position: light skin tone"),*/ qsl("1f9d8-1f3fb"), 427, EmojiCode(0x1f9d8, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person in lotus position: medium-light skin tone"),*/ qsl("1f9d8-1f3fc"), 428, EmojiCode(0x1f9d8, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person in lotus position: medium skin tone"),*/ qsl("1f9d8-1f3fd"), 429, EmojiCode(0x1f9d8, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person in lotus position: medium-dark skin tone"),*/ qsl("1f9d8-1f3fe"), 430, EmojiCode(0x1f9d8, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person in lotus position: dark skin tone"),*/ qsl("1f9d8-1f3ff"), 431, EmojiCode(0x1f9d8, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman in lotus position"),*/ qsl("1f9d8-2640"), 432, EmojiCode(0x1f9d8, 0x2640), EmojiCode(0x1f9d8, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman in lotus position: light skin tone"),*/ qsl("1f9d8-1f3fb-2640"), 433, EmojiCode(0x1f9d8, 0x1f3fb, 0x2640), EmojiCode(0x1f9d8, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman in lotus position: medium-light skin tone"),*/ qsl("1f9d8-1f3fc-2640"), 434, EmojiCode(0x1f9d8, 0x1f3fc, 0x2640), EmojiCode(0x1f9d8, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman in lotus position: medium skin tone"),*/ qsl("1f9d8-1f3fd-2640"), 435, EmojiCode(0x1f9d8, 0x1f3fd, 0x2640), EmojiCode(0x1f9d8, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman in lotus position: medium-dark skin tone"),*/ qsl("1f9d8-1f3fe-2640"), 436, EmojiCode(0x1f9d8, 0x1f3fe, 0x2640), EmojiCode(0x1f9d8, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman in lotus position: dark skin tone"),*/ qsl("1f9d8-1f3ff-2640"), 437, EmojiCode(0x1f9d8, 0x1f3ff, 0x2640), EmojiCode(0x1f9d8, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man in lotus position"),*/ qsl("1f9d8-2642"), 438, EmojiCode(0x1f9d8, 0x2642), EmojiCode(0x1f9d8, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man in lotus position: light skin tone"),*/ qsl("1f9d8-1f3fb-2642"), 439, EmojiCode(0x1f9d8, 0x1f3fb, 0x2642), EmojiCode(0x1f9d8, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man in lotus position: medium-light skin tone"),*/ qsl("1f9d8-1f3fc-2642"), 440, EmojiCode(0x1f9d8, 0x1f3fc, 0x2642), EmojiCode(0x1f9d8, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man in lotus position: medium skin tone"),*/ qsl("1f9d8-1f3fd-2642"), 441, EmojiCode(0x1f9d8, 0x1f3fd, 0x2642), EmojiCode(0x1f9d8, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man in lotus position: medium-dark skin tone"),*/ qsl("1f9d8-1f3fe-2642"), 442, EmojiCode(0x1f9d8, 0x1f3fe, 0x2642), EmojiCode(0x1f9d8, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man in lotus position: dark skin tone"),*/ qsl("1f9d8-1f3ff-2642"), 443, EmojiCode(0x1f9d8, 0x1f3ff, 0x2642), EmojiCode(0x1f9d8, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person surfing"),*/ qsl("1f3c4"), 444, EmojiCode(0x1f3c4), EmojiCode(0x1f3c4, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person surfing: light skin tone"),*/ qsl("1f3c4-1f3fb"), 445, EmojiCode(0x1f3c4, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person surfing: medium-light skin tone"),*/ qsl("1f3c4-1f3fc"), 446, EmojiCode(0x1f3c4, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person surfing: medium skin tone"),*/ qsl("1f3c4-1f3fd"), 447, EmojiCode(0x1f3c4, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person surfing: medium-dark skin tone"),*/ qsl("1f3c4-1f3fe"), 448, EmojiCode(0x1f3c4, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person surfing: dark skin tone"),*/ qsl("1f3c4-1f3ff"), 449, EmojiCode(0x1f3c4, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman surfing"),*/ qsl("1f3c4-2640"), 450, EmojiCode(0x1f3c4, 0x2640), EmojiCode(0x1f3c4, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman surfing: light skin tone"),*/ qsl("1f3c4-1f3fb-2640"), 451, EmojiCode(0x1f3c4, 0x1f3fb, 0x2640), EmojiCode(0x1f3c4, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman surfing: medium-light skin tone"),*/ qsl("1f3c4-1f3fc-2640"), 452, EmojiCode(0x1f3c4, 0x1f3fc, 0x2640), EmojiCode(0x1f3c4, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman surfing: medium skin tone"),*/ qsl("1f3c4-1f3fd-2640"), 453, EmojiCode(0x1f3c4, 0x1f3fd, 0x2640), EmojiCode(0x1f3c4, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman surfing: medium-dark skin tone"),*/ qsl("1f3c4-1f3fe-2640"), 454, EmojiCode(0x1f3c4, 0x1f3fe, 0x2640), EmojiCode(0x1f3c4, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman surfing: dark skin tone"),*/ qsl("1f3c4-1f3ff-2640"), 455, EmojiCode(0x1f3c4, 0x1f3ff, 0x2640), EmojiCode(0x1f3c4, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man surfing"),*/ qsl("1f3c4-2642"), 456, EmojiCode(0x1f3c4, 0x2642), EmojiCode(0x1f3c4, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man surfing: light skin tone"),*/ qsl("1f3c4-1f3fb-2642"), 457, EmojiCode(0x1f3c4, 0x1f3fb, 0x2642), EmojiCode(0x1f3c4, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man surfing: medium-light skin tone"),*/ qsl("1f3c4-1f3fc-2642"), 458, EmojiCode(0x1f3c4, 0x1f3fc, 0x2642), EmojiCode(0x1f3c4, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man surfing: medium skin tone"),*/ qsl("1f3c4-1f3fd-2642"), 459, EmojiCode(0x1f3c4, 0x1f3fd, 0x2642), EmojiCode(0x1f3c4, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man surfing: medium-dark skin tone"),*/ qsl("1f3c4-1f3fe-2642"), 460, EmojiCode(0x1f3c4, 0x1f3fe, 0x2642), EmojiCode(0x1f3c4, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man surfing: dark skin tone"),*/ qsl("1f3c4-1f3ff-2642"), 461, EmojiCode(0x1f3c4, 0x1f3ff, 0x2642), EmojiCode(0x1f3c4, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person swimming"),*/ qsl("1f3ca"), 462, EmojiCode(0x1f3ca), EmojiCode(0x1f3ca, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person swimming: light skin tone"),*/ qsl("1f3ca-1f3fb"), 463, EmojiCode(0x1f3ca, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person swimming: medium-light skin tone"),*/ qsl("1f3ca-1f3fc"), 464, EmojiCode(0x1f3ca, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person swimming: medium skin tone"),*/ qsl("1f3ca-1f3fd"), 465, EmojiCode(0x1f3ca, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person swimming: medium-dark skin tone"),*/ qsl("1f3ca-1f3fe"), 466, EmojiCode(0x1f3ca, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person swimming: dark skin tone"),*/ qsl("1f3ca-1f3ff"), 467, EmojiCode(0x1f3ca, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman swimming"),*/ qsl("1f3ca-2640"), 468, EmojiCode(0x1f3ca, 0x2640), EmojiCode(0x1f3ca, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman swimming: light skin tone"),*/ qsl("1f3ca-1f3fb-2640"), 469, EmojiCode(0x1f3ca, 0x1f3fb, 0x2640), EmojiCode(0x1f3ca, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman swimming: medium-light skin tone"),*/ qsl("1f3ca-1f3fc-2640"), 470, EmojiCode(0x1f3ca, 0x1f3fc, 0x2640), EmojiCode(0x1f3ca, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman swimming: medium skin tone"),*/ qsl("1f3ca-1f3fd-2640"), 471, EmojiCode(0x1f3ca, 0x1f3fd, 0x2640), EmojiCode(0x1f3ca, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman swimming: medium-dark skin tone"),*/ qsl("1f3ca-1f3fe-2640"), 472, EmojiCode(0x1f3ca, 0x1f3fe, 0x2640), EmojiCode(0x1f3ca, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman swimming: dark skin tone"),*/ qsl("1f3ca-1f3ff-2640"), 473, EmojiCode(0x1f3ca, 0x1f3ff, 0x2640), EmojiCode(0x1f3ca, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man swimming"),*/ qsl("1f3ca-2642"), 474, EmojiCode(0x1f3ca, 0x2642), EmojiCode(0x1f3ca, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man swimming: light skin tone"),*/ qsl("1f3ca-1f3fb-2642"), 475, EmojiCode(0x1f3ca, 0x1f3fb, 0x2642), EmojiCode(0x1f3ca, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man swimming: medium-light skin tone"),*/ qsl("1f3ca-1f3fc-2642"), 476, EmojiCode(0x1f3ca, 0x1f3fc, 0x2642), EmojiCode(0x1f3ca, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man swimming: medium skin tone"),*/ qsl("1f3ca-1f3fd-2642"), 477, EmojiCode(0x1f3ca, 0x1f3fd, 0x2642), EmojiCode(0x1f3ca, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man swimming: medium-dark skin tone"),*/ qsl("1f3ca-1f3fe-2642"), 478, EmojiCode(0x1f3ca, 0x1f3fe, 0x2642), EmojiCode(0x1f3ca, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man swimming: dark skin tone"),*/ qsl("1f3ca-1f3ff-2642"), 479, EmojiCode(0x1f3ca, 0x1f3ff, 0x2642), EmojiCode(0x1f3ca, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing water polo"),*/ qsl("1f93d"), 480, EmojiCode(0x1f93d)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing water polo: light skin tone"),*/ qsl("1f93d-1f3fb"), 481, EmojiCode(0x1f93d, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing water polo: medium-light skin tone"),*/ qsl("1f93d-1f3fc"), 482, EmojiCode(0x1f93d, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing water polo: medium skin tone"),*/ qsl("1f93d-1f3fd"), 483, EmojiCode(0x1f93d, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing water polo: medium-dark skin tone"),*/ qsl("1f93d-1f3fe"), 484, EmojiCode(0x1f93d, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person playing water polo: dark skin tone"),*/ qsl("1f93d-1f3ff"), 485, EmojiCode(0x1f93d, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing water polo"),*/ qsl("1f93d-2640"), 486, EmojiCode(0x1f93d, 0x2640), EmojiCode(0x1f93d, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing water polo: light skin tone"),*/ qsl("1f93d-1f3fb-2640"), 487, EmojiCode(0x1f93d, 0x1f3fb, 0x2640), EmojiCode(0x1f93d, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing water polo: medium-light skin tone"),*/ qsl("1f93d-1f3fc-2640"), 488, EmojiCode(0x1f93d, 0x1f3fc, 0x2640), EmojiCode(0x1f93d, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing water polo: medium skin tone"),*/ qsl("1f93d-1f3fd-2640"), 489, EmojiCode(0x1f93d, 0x1f3fd, 0x2640), EmojiCode(0x1f93d, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing water polo: medium-dark skin tone"),*/ qsl("1f93d-1f3fe-2640"), 490, EmojiCode(0x1f93d, 0x1f3fe, 0x2640), EmojiCode(0x1f93d, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman playing water polo: dark skin tone"),*/ qsl("1f93d-1f3ff-2640"), 491, EmojiCode(0x1f93d, 0x1f3ff, 0x2640), EmojiCode(0x1f93d, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing water polo"),*/ qsl("1f93d-2642"), 492, EmojiCode(0x1f93d, 0x2642), EmojiCode(0x1f93d, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing water polo: light skin tone"),*/ qsl("1f93d-1f3fb-2642"), 493, EmojiCode(0x1f93d, 0x1f3fb, 0x2642), EmojiCode(0x1f93d, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing water polo: medium-light skin tone"),*/ qsl("1f93d-1f3fc-2642"), 494, EmojiCode(0x1f93d, 0x1f3fc, 0x2642), EmojiCode(0x1f93d, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing water polo: medium skin tone"),*/ qsl("1f93d-1f3fd-2642"), 495, EmojiCode(0x1f93d, 0x1f3fd, 0x2642), EmojiCode(0x1f93d, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing water polo: medium-dark skin tone"),*/ qsl("1f93d-1f3fe-2642"), 496, EmojiCode(0x1f93d, 0x1f3fe, 0x2642), EmojiCode(0x1f93d, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man playing water polo: dark skin tone"),*/ qsl("1f93d-1f3ff-2642"), 497, EmojiCode(0x1f93d, 0x1f3ff, 0x2642), EmojiCode(0x1f93d, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person rowing boat"),*/ qsl("1f6a3"), 498, EmojiCode(0x1f6a3)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person rowing boat: light skin tone"),*/ qsl("1f6a3-1f3fb"), 499, EmojiCode(0x1f6a3, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person rowing boat: medium-light skin tone"),*/ qsl("1f6a3-1f3fc"), 500, EmojiCode(0x1f6a3, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person rowing boat: medium skin tone"),*/ qsl("1f6a3-1f3fd"), 501, EmojiCode(0x1f6a3, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person rowing boat: medium-dark skin tone"),*/ qsl("1f6a3-1f3fe"), 502, EmojiCode(0x1f6a3, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person rowing boat: dark skin tone"),*/ qsl("1f6a3-1f3ff"), 503, EmojiCode(0x1f6a3, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman rowing boat"),*/ qsl("1f6a3-2640"), 504, EmojiCode(0x1f6a3, 0x2640), EmojiCode(0x1f6a3, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman rowing boat: light skin tone"),*/ qsl("1f6a3-1f3fb-2640"), 505, EmojiCode(0x1f6a3, 0x1f3fb, 0x2640), EmojiCode(0x1f6a3, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman rowing boat: medium-light skin tone"),*/ qsl("1f6a3-1f3fc-2640"), 506, EmojiCode(0x1f6a3, 0x1f3fc, 0x2640), EmojiCode(0x1f6a3, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman rowing boat: medium skin tone"),*/ qsl("1f6a3-1f3fd-2640"), 507, EmojiCode(0x1f6a3, 0x1f3fd, 0x2640), EmojiCode(0x1f6a3, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman rowing boat: medium-dark skin tone"),*/ qsl("1f6a3-1f3fe-2640"), 508, EmojiCode(0x1f6a3, 0x1f3fe, 0x2640), EmojiCode(0x1f6a3, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman rowing boat: dark skin tone"),*/ qsl("1f6a3-1f3ff-2640"), 509, EmojiCode(0x1f6a3, 0x1f3ff, 0x2640), EmojiCode(0x1f6a3, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man rowing boat"),*/ qsl("1f6a3-2642"), 510, EmojiCode(0x1f6a3, 0x2642), EmojiCode(0x1f6a3, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man rowing boat: light skin tone"),*/ qsl("1f6a3-1f3fb-2642"), 511, EmojiCode(0x1f6a3, 0x1f3fb, 0x2642), EmojiCode(0x1f6a3, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man rowing boat: medium-light skin tone"),*/ qsl("1f6a3-1f3fc-2642"), 512, EmojiCode(0x1f6a3, 0x1f3fc, 0x2642), EmojiCode(0x1f6a3, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man rowing boat: medium skin tone"),*/ qsl("1f6a3-1f3fd-2642"), 513, EmojiCode(0x1f6a3, 0x1f3fd, 0x2642), EmojiCode(0x1f6a3, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man rowing boat: medium-dark skin tone"),*/ qsl("1f6a3-1f3fe-2642"), 514, EmojiCode(0x1f6a3, 0x1f3fe, 0x2642), EmojiCode(0x1f6a3, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man rowing boat: dark skin tone"),*/ qsl("1f6a3-1f3ff-2642"), 515, EmojiCode(0x1f6a3, 0x1f3ff, 0x2642), EmojiCode(0x1f6a3, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person climbing"),*/ qsl("1f9d7"), 516, EmojiCode(0x1f9d7)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person climbing: light skin tone"),*/ qsl("1f9d7-1f3fb"), 517, EmojiCode(0x1f9d7, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person climbing: medium-light skin tone"),*/ qsl("1f9d7-1f3fc"), 518, EmojiCode(0x1f9d7, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person climbing: medium skin tone"),*/ qsl("1f9d7-1f3fd"), 519, EmojiCode(0x1f9d7, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person climbing: medium-dark skin tone"),*/ qsl("1f9d7-1f3fe"), 520, EmojiCode(0x1f9d7, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person climbing: dark skin tone"),*/ qsl("1f9d7-1f3ff"), 521, EmojiCode(0x1f9d7, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman climbing"),*/ qsl("1f9d7-2640"), 522, EmojiCode(0x1f9d7, 0x2640), EmojiCode(0x1f9d7, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman climbing: light skin tone"),*/ qsl("1f9d7-1f3fb-2640"), 523, EmojiCode(0x1f9d7, 0x1f3fb, 0x2640), EmojiCode(0x1f9d7, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman climbing: medium-light skin tone"),*/ qsl("1f9d7-1f3fc-2640"), 524, EmojiCode(0x1f9d7, 0x1f3fc, 0x2640), EmojiCode(0x1f9d7, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman climbing: medium skin tone"),*/ qsl("1f9d7-1f3fd-2640"), 525, EmojiCode(0x1f9d7, 0x1f3fd, 0x2640), EmojiCode(0x1f9d7, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman climbing: medium-dark skin tone"),*/ qsl("1f9d7-1f3fe-2640"), 526, EmojiCode(0x1f9d7, 0x1f3fe, 0x2640), EmojiCode(0x1f9d7, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman climbing: dark skin tone"),*/ qsl("1f9d7-1f3ff-2640"), 527, EmojiCode(0x1f9d7, 0x1f3ff, 0x2640), EmojiCode(0x1f9d7, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man climbing"),*/ qsl("1f9d7-2642"), 528, EmojiCode(0x1f9d7, 0x2642), EmojiCode(0x1f9d7, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man climbing: light skin tone"),*/ qsl("1f9d7-1f3fb-2642"), 529, EmojiCode(0x1f9d7, 0x1f3fb, 0x2642), EmojiCode(0x1f9d7, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man climbing: medium-light skin tone"),*/ qsl("1f9d7-1f3fc-2642"), 530, EmojiCode(0x1f9d7, 0x1f3fc, 0x2642), EmojiCode(0x1f9d7, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man climbing: medium skin tone"),*/ qsl("1f9d7-1f3fd-2642"), 531, EmojiCode(0x1f9d7, 0x1f3fd, 0x2642), EmojiCode(0x1f9d7, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man climbing: medium-dark skin tone"),*/ qsl("1f9d7-1f3fe-2642"), 532, EmojiCode(0x1f9d7, 0x1f3fe, 0x2642), EmojiCode(0x1f9d7, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man climbing: dark skin tone"),*/ qsl("1f9d7-1f3ff-2642"), 533, EmojiCode(0x1f9d7, 0x1f3ff, 0x2642), EmojiCode(0x1f9d7, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person mountain biking"),*/ qsl("1f6b5"), 534, EmojiCode(0x1f6b5)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person mountain biking: light skin tone"),*/ qsl("1f6b5-1f3fb"), 535, EmojiCode(0x1f6b5, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person mountain biking: medium-light skin tone"),*/ qsl("1f6b5-1f3fc"), 536, EmojiCode(0x1f6b5, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person mountain biking: medium skin tone"),*/ qsl("1f6b5-1f3fd"), 537, EmojiCode(0x1f6b5, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person mountain biking: medium-dark skin tone"),*/ qsl("1f6b5-1f3fe"), 538, EmojiCode(0x1f6b5, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person mountain biking: dark skin tone"),*/ qsl("1f6b5-1f3ff"), 539, EmojiCode(0x1f6b5, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman mountain biking"),*/ qsl("1f6b5-2640"), 540, EmojiCode(0x1f6b5, 0x2640), EmojiCode(0x1f6b5, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman mountain biking: light skin tone"),*/ qsl("1f6b5-1f3fb-2640"), 541, EmojiCode(0x1f6b5, 0x1f3fb, 0x2640), EmojiCode(0x1f6b5, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman mountain biking: medium-light skin tone"),*/ qsl("1f6b5-1f3fc-2640"), 542, EmojiCode(0x1f6b5, 0x1f3fc, 0x2640), EmojiCode(0x1f6b5, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman mountain biking: medium skin tone"),*/ qsl("1f6b5-1f3fd-2640"), 543, EmojiCode(0x1f6b5, 0x1f3fd, 0x2640), EmojiCode(0x1f6b5, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman mountain biking: medium-dark skin tone"),*/ qsl("1f6b5-1f3fe-2640"), 544, EmojiCode(0x1f6b5, 0x1f3fe, 0x2640), EmojiCode(0x1f6b5, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman mountain biking: dark skin tone"),*/ qsl("1f6b5-1f3ff-2640"), 545, EmojiCode(0x1f6b5, 0x1f3ff, 0x2640), EmojiCode(0x1f6b5, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man mountain biking"),*/ qsl("1f6b5-2642"), 546, EmojiCode(0x1f6b5, 0x2642), EmojiCode(0x1f6b5, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man mountain biking: light skin tone"),*/ qsl("1f6b5-1f3fb-2642"), 547, EmojiCode(0x1f6b5, 0x1f3fb, 0x2642), EmojiCode(0x1f6b5, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man mountain biking: medium-light skin tone"),*/ qsl("1f6b5-1f3fc-2642"), 548, EmojiCode(0x1f6b5, 0x1f3fc, 0x2642), EmojiCode(0x1f6b5, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man mountain biking: medium skin tone"),*/ qsl("1f6b5-1f3fd-2642"), 549, EmojiCode(0x1f6b5, 0x1f3fd, 0x2642), EmojiCode(0x1f6b5, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man mountain biking: medium-dark skin tone"),*/ qsl("1f6b5-1f3fe-2642"), 550, EmojiCode(0x1f6b5, 0x1f3fe, 0x2642), EmojiCode(0x1f6b5, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man mountain biking: dark skin tone"),*/ qsl("1f6b5-1f3ff-2642"), 551, EmojiCode(0x1f6b5, 0x1f3ff, 0x2642), EmojiCode(0x1f6b5, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person biking"),*/ qsl("1f6b4"), 552, EmojiCode(0x1f6b4)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person biking: light skin tone"),*/ qsl("1f6b4-1f3fb"), 553, EmojiCode(0x1f6b4, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person biking: medium-light skin tone"),*/ qsl("1f6b4-1f3fc"), 554, EmojiCode(0x1f6b4, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person biking: medium skin tone"),*/ qsl("1f6b4-1f3fd"), 555, EmojiCode(0x1f6b4, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person biking: medium-dark skin tone"),*/ qsl("1f6b4-1f3fe"), 556, EmojiCode(0x1f6b4, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person biking: dark skin tone"),*/ qsl("1f6b4-1f3ff"), 557, EmojiCode(0x1f6b4, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman biking"),*/ qsl("1f6b4-2640"), 558, EmojiCode(0x1f6b4, 0x2640), EmojiCode(0x1f6b4, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman biking: light skin tone"),*/ qsl("1f6b4-1f3fb-2640"), 559, EmojiCode(0x1f6b4, 0x1f3fb, 0x2640), EmojiCode(0x1f6b4, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman biking: medium-light skin tone"),*/ qsl("1f6b4-1f3fc-2640"), 560, EmojiCode(0x1f6b4, 0x1f3fc, 0x2640), EmojiCode(0x1f6b4, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman biking: medium skin tone"),*/ qsl("1f6b4-1f3fd-2640"), 561, EmojiCode(0x1f6b4, 0x1f3fd, 0x2640), EmojiCode(0x1f6b4, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman biking: medium-dark skin tone"),*/ qsl("1f6b4-1f3fe-2640"), 562, EmojiCode(0x1f6b4, 0x1f3fe, 0x2640), EmojiCode(0x1f6b4, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman biking: dark skin tone"),*/ qsl("1f6b4-1f3ff-2640"), 563, EmojiCode(0x1f6b4, 0x1f3ff, 0x2640), EmojiCode(0x1f6b4, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man biking"),*/ qsl("1f6b4-2642"), 564, EmojiCode(0x1f6b4, 0x2642), EmojiCode(0x1f6b4, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man biking: light skin tone"),*/ qsl("1f6b4-1f3fb-2642"), 565, EmojiCode(0x1f6b4, 0x1f3fb, 0x2642), EmojiCode(0x1f6b4, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man biking: medium-light skin tone"),*/ qsl("1f6b4-1f3fc-2642"), 566, EmojiCode(0x1f6b4, 0x1f3fc, 0x2642), EmojiCode(0x1f6b4, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man biking: medium skin tone"),*/ qsl("1f6b4-1f3fd-2642"), 567, EmojiCode(0x1f6b4, 0x1f3fd, 0x2642), EmojiCode(0x1f6b4, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man biking: medium-dark skin tone"),*/ qsl("1f6b4-1f3fe-2642"), 568, EmojiCode(0x1f6b4, 0x1f3fe, 0x2642), EmojiCode(0x1f6b4, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man biking: dark skin tone"),*/ qsl("1f6b4-1f3ff-2642"), 569, EmojiCode(0x1f6b4, 0x1f3ff, 0x2642), EmojiCode(0x1f6b4, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("trophy"),*/ qsl("1f3c6"), 570, EmojiCode(0x1f3c6), EmojiCode(0x1f3c6, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("1st place medal"),*/ qsl("1f947"), 571, EmojiCode(0x1f947)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("2nd place medal"),*/ qsl("1f948"), 572, EmojiCode(0x1f948)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("3rd place medal"),*/ qsl("1f949"), 573, EmojiCode(0x1f949)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("sports medal"),*/ qsl("1f3c5"), 574, EmojiCode(0x1f3c5)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("military medal"),*/ qsl("1f396"), 575, EmojiCode(0x1f396), EmojiCode(0x1f396, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("rosette"),*/ qsl("1f3f5"), 576, EmojiCode(0x1f3f5), EmojiCode(0x1f3f5, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("reminder ribbon"),*/ qsl("1f397"), 577, EmojiCode(0x1f397), EmojiCode(0x1f397, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("ticket"),*/ qsl("1f3ab"), 578, EmojiCode(0x1f3ab)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("admission tickets"),*/ qsl("1f39f"), 579, EmojiCode(0x1f39f), EmojiCode(0x1f39f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("circus tent"),*/ qsl("1f3aa"), 580, EmojiCode(0x1f3aa)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person juggling"),*/ qsl("1f939"), 581, EmojiCode(0x1f939)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person juggling: light skin tone"),*/ qsl("1f939-1f3fb"), 582, EmojiCode(0x1f939, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person juggling: medium-light skin tone"),*/ qsl("1f939-1f3fc"), 583, EmojiCode(0x1f939, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person juggling: medium skin tone"),*/ qsl("1f939-1f3fd"), 584, EmojiCode(0x1f939, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person juggling: medium-dark skin tone"),*/ qsl("1f939-1f3fe"), 585, EmojiCode(0x1f939, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("person juggling: dark skin tone"),*/ qsl("1f939-1f3ff"), 586, EmojiCode(0x1f939, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman juggling"),*/ qsl("1f939-2640"), 587, EmojiCode(0x1f939, 0x2640), EmojiCode(0x1f939, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman juggling: light skin tone"),*/ qsl("1f939-1f3fb-2640"), 588, EmojiCode(0x1f939, 0x1f3fb, 0x2640), EmojiCode(0x1f939, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman juggling: medium-light skin tone"),*/ qsl("1f939-1f3fc-2640"), 589, EmojiCode(0x1f939, 0x1f3fc, 0x2640), EmojiCode(0x1f939, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman juggling: medium skin tone"),*/ qsl("1f939-1f3fd-2640"), 590, EmojiCode(0x1f939, 0x1f3fd, 0x2640), EmojiCode(0x1f939, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman juggling: medium-dark skin tone"),*/ qsl("1f939-1f3fe-2640"), 591, EmojiCode(0x1f939, 0x1f3fe, 0x2640), EmojiCode(0x1f939, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("woman juggling: dark skin tone"),*/ qsl("1f939-1f3ff-2640"), 592, EmojiCode(0x1f939, 0x1f3ff, 0x2640), EmojiCode(0x1f939, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man juggling"),*/ qsl("1f939-2642"), 593, EmojiCode(0x1f939, 0x2642), EmojiCode(0x1f939, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man juggling: light skin tone"),*/ qsl("1f939-1f3fb-2642"), 594, EmojiCode(0x1f939, 0x1f3fb, 0x2642), EmojiCode(0x1f939, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man juggling: medium-light skin tone"),*/ qsl("1f939-1f3fc-2642"), 595, EmojiCode(0x1f939, 0x1f3fc, 0x2642), EmojiCode(0x1f939, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man juggling: medium skin tone"),*/ qsl("1f939-1f3fd-2642"), 596, EmojiCode(0x1f939, 0x1f3fd, 0x2642), EmojiCode(0x1f939, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man juggling: medium-dark skin tone"),*/ qsl("1f939-1f3fe-2642"), 597, EmojiCode(0x1f939, 0x1f3fe, 0x2642), EmojiCode(0x1f939, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("man juggling: dark skin tone"),*/ qsl("1f939-1f3ff-2642"), 598, EmojiCode(0x1f939, 0x1f3ff, 0x2642), EmojiCode(0x1f939, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("performing arts"),*/ qsl("1f3ad"), 599, EmojiCode(0x1f3ad), EmojiCode(0x1f3ad, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("artist palette"),*/ qsl("1f3a8"), 600, EmojiCode(0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("clapper board"),*/ qsl("1f3ac"), 601, EmojiCode(0x1f3ac), EmojiCode(0x1f3ac, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("microphone"),*/ qsl("1f3a4"), 602, EmojiCode(0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("headphone"),*/ qsl("1f3a7"), 603, EmojiCode(0x1f3a7), EmojiCode(0x1f3a7, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("musical score"),*/ qsl("1f3bc"), 604, EmojiCode(0x1f3bc)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("musical keyboard"),*/ qsl("1f3b9"), 605, EmojiCode(0x1f3b9)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("drum"),*/ qsl("1f941"), 606, EmojiCode(0x1f941)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("saxophone"),*/ qsl("1f3b7"), 607, EmojiCode(0x1f3b7)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("trumpet"),*/ qsl("1f3ba"), 608, EmojiCode(0x1f3ba)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("guitar"),*/ qsl("1f3b8"), 609, EmojiCode(0x1f3b8)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("violin"),*/ qsl("1f3bb"), 610, EmojiCode(0x1f3bb)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("game die"),*/ qsl("1f3b2"), 611, EmojiCode(0x1f3b2)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("direct hit"),*/ qsl("1f3af"), 612, EmojiCode(0x1f3af)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("bowling"),*/ qsl("1f3b3"), 613, EmojiCode(0x1f3b3)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("video game"),*/ qsl("1f3ae"), 614, EmojiCode(0x1f3ae), EmojiCode(0x1f3ae, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(activityCategory(), /*qsl("slot machine"),*/ qsl("1f3b0"), 615, EmojiCode(0x1f3b0)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("watch"),*/ qsl("231a"), 616, EmojiCode(0x231a), EmojiCode(0x231a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("mobile phone"),*/ qsl("1f4f1"), 617, EmojiCode(0x1f4f1)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("mobile phone with arrow"),*/ qsl("1f4f2"), 618, EmojiCode(0x1f4f2)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("laptop computer"),*/ qsl("1f4bb"), 619, EmojiCode(0x1f4bb), EmojiCode(0x1f4bb, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("keyboard"),*/ qsl("2328"), 620, EmojiCode(0x2328), EmojiCode(0x2328, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("desktop computer"),*/ qsl("1f5a5"), 621, EmojiCode(0x1f5a5), EmojiCode(0x1f5a5, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("printer"),*/ qsl("1f5a8"), 622, EmojiCode(0x1f5a8), EmojiCode(0x1f5a8, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("computer mouse"),*/ qsl("1f5b1"), 623, EmojiCode(0x1f5b1), EmojiCode(0x1f5b1, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("trackball"),*/ qsl("1f5b2"), 624, EmojiCode(0x1f5b2), EmojiCode(0x1f5b2, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("joystick"),*/ qsl("1f579"), 625, EmojiCode(0x1f579), EmojiCode(0x1f579, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("chess pawn"),*/ qsl("265f"), 626, EmojiCode(0x265f), EmojiCode(0x265f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("jigsaw"),*/ qsl("1f9e9"), 627, EmojiCode(0x1f9e9)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("clamp"),*/ qsl("1f5dc"), 628, EmojiCode(0x1f5dc), EmojiCode(0x1f5dc, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("computer disk"),*/ qsl("1f4bd"), 629, EmojiCode(0x1f4bd)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("floppy disk"),*/ qsl("1f4be"), 630, EmojiCode(0x1f4be)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("optical disk"),*/ qsl("1f4bf"), 631, EmojiCode(0x1f4bf), EmojiCode(0x1f4bf, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("dvd"),*/ qsl("1f4c0"), 632, EmojiCode(0x1f4c0)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("videocassette"),*/ qsl("1f4fc"), 633, EmojiCode(0x1f4fc)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("camera"),*/ qsl("1f4f7"), 634, EmojiCode(0x1f4f7), EmojiCode(0x1f4f7, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("camera with flash"),*/ qsl("1f4f8"), 635, EmojiCode(0x1f4f8)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("video camera"),*/ qsl("1f4f9"), 636, EmojiCode(0x1f4f9), EmojiCode(0x1f4f9, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("movie camera"),*/ qsl("1f3a5"), 637, EmojiCode(0x1f3a5)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("film projector"),*/ qsl("1f4fd"), 638, EmojiCode(0x1f4fd), EmojiCode(0x1f4fd, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("film frames"),*/ qsl("1f39e"), 639, EmojiCode(0x1f39e), EmojiCode(0x1f39e, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("telephone receiver"),*/ qsl("1f4de"), 640, EmojiCode(0x1f4de)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("telephone"),*/ qsl("260e"), 641, EmojiCode(0x260e), EmojiCode(0x260e, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("pager"),*/ qsl("1f4df"), 642, EmojiCode(0x1f4df), EmojiCode(0x1f4df, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("fax machine"),*/ qsl("1f4e0"), 643, EmojiCode(0x1f4e0)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("television"),*/ qsl("1f4fa"), 644, EmojiCode(0x1f4fa), EmojiCode(0x1f4fa, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("radio"),*/ qsl("1f4fb"), 645, EmojiCode(0x1f4fb), EmojiCode(0x1f4fb, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("studio microphone"),*/ qsl("1f399"), 646, EmojiCode(0x1f399), EmojiCode(0x1f399, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("level slider"),*/ qsl("1f39a"), 647, EmojiCode(0x1f39a), EmojiCode(0x1f39a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("control knobs"),*/ qsl("1f39b"), 648, EmojiCode(0x1f39b), EmojiCode(0x1f39b, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("stopwatch"),*/ qsl("23f1"), 649, EmojiCode(0x23f1), EmojiCode(0x23f1, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("timer clock"),*/ qsl("23f2"), 650, EmojiCode(0x23f2), EmojiCode(0x23f2, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("alarm clock"),*/ qsl("23f0"), 651, EmojiCode(0x23f0)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("mantelpiece clock"),*/ qsl("1f570"), 652, EmojiCode(0x1f570), EmojiCode(0x1f570, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("hourglass done"),*/ qsl("231b"), 653, EmojiCode(0x231b), EmojiCode(0x231b, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("hourglass not done"),*/ qsl("23f3"), 654, EmojiCode(0x23f3), EmojiCode(0x23f3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("satellite antenna"),*/ qsl("1f4e1"), 655, EmojiCode(0x1f4e1)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("compass"),*/ qsl("1f9ed"), 656, EmojiCode(0x1f9ed)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("battery"),*/ qsl("1f50b"), 657, EmojiCode(0x1f50b)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("electric plug"),*/ qsl("1f50c"), 658, EmojiCode(0x1f50c)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("magnet"),*/ qsl("1f9f2"), 659, EmojiCode(0x1f9f2)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("light bulb"),*/ qsl("1f4a1"), 660, EmojiCode(0x1f4a1)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("flashlight"),*/ qsl("1f526"), 661, EmojiCode(0x1f526)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("candle"),*/ qsl("1f56f"), 662, EmojiCode(0x1f56f), EmojiCode(0x1f56f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("fire extinguisher"),*/ qsl("1f9ef"), 663, EmojiCode(0x1f9ef)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("wastebasket"),*/ qsl("1f5d1"), 664, EmojiCode(0x1f5d1), EmojiCode(0x1f5d1, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("oil drum"),*/ qsl("1f6e2"), 665, EmojiCode(0x1f6e2), EmojiCode(0x1f6e2, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("money with wings"),*/ qsl("1f4b8"), 666, EmojiCode(0x1f4b8)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("dollar banknote"),*/ qsl("1f4b5"), 667, EmojiCode(0x1f4b5)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("yen banknote"),*/ qsl("1f4b4"), 668, EmojiCode(0x1f4b4)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("euro banknote"),*/ qsl("1f4b6"), 669, EmojiCode(0x1f4b6)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("pound banknote"),*/ qsl("1f4b7"), 670, EmojiCode(0x1f4b7)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("money bag"),*/ qsl("1f4b0"), 671, EmojiCode(0x1f4b0), EmojiCode(0x1f4b0, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("credit card"),*/ qsl("1f4b3"), 672, EmojiCode(0x1f4b3), EmojiCode(0x1f4b3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("gem stone"),*/ qsl("1f48e"), 673, EmojiCode(0x1f48e)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("nazar amulet"),*/ qsl("1f9ff"), 674, EmojiCode(0x1f9ff)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("bricks"),*/ qsl("1f9f1"), 675, EmojiCode(0x1f9f1)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("balance scale"),*/ qsl("2696"), 676, EmojiCode(0x2696), EmojiCode(0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("toolbox"),*/ qsl("1f9f0"), 677, EmojiCode(0x1f9f0)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("wrench"),*/ qsl("1f527"), 678, EmojiCode(0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("hammer"),*/ qsl("1f528"), 679, EmojiCode(0x1f528)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("hammer and pick"),*/ qsl("2692"), 680, EmojiCode(0x2692), EmojiCode(0x2692, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("hammer and wrench"),*/ qsl("1f6e0"), 681, EmojiCode(0x1f6e0), EmojiCode(0x1f6e0, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("pick"),*/ qsl("26cf"), 682, EmojiCode(0x26cf), EmojiCode(0x26cf, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("nut and bolt"),*/ qsl("1f529"), 683, EmojiCode(0x1f529)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("gear"),*/ qsl("2699"), 684, EmojiCode(0x2699), EmojiCode(0x2699, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("chains"),*/ qsl("26d3"), 685, EmojiCode(0x26d3), EmojiCode(0x26d3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("pistol"),*/ qsl("1f52b"), 686, EmojiCode(0x1f52b)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("bomb"),*/ qsl("1f4a3"), 687, EmojiCode(0x1f4a3), EmojiCode(0x1f4a3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("kitchen knife"),*/ qsl("1f52a"), 688, EmojiCode(0x1f52a)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("dagger"),*/ qsl("1f5e1"), 689, EmojiCode(0x1f5e1), EmojiCode(0x1f5e1, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("crossed swords"),*/ qsl("2694"), 690, EmojiCode(0x2694), EmojiCode(0x2694, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("shield"),*/ qsl("1f6e1"), 691, EmojiCode(0x1f6e1), EmojiCode(0x1f6e1, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("cigarette"),*/ qsl("1f6ac"), 692, EmojiCode(0x1f6ac)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("coffin"),*/ qsl("26b0"), 693, EmojiCode(0x26b0), EmojiCode(0x26b0, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("funeral urn"),*/ qsl("26b1"), 694, EmojiCode(0x26b1), EmojiCode(0x26b1, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("amphora"),*/ qsl("1f3fa"), 695, EmojiCode(0x1f3fa)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("crystal ball"),*/ qsl("1f52e"), 696, EmojiCode(0x1f52e)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("prayer beads"),*/ qsl("1f4ff"), 697, EmojiCode(0x1f4ff)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("barber pole"),*/ qsl("1f488"), 698, EmojiCode(0x1f488)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("alembic"),*/ qsl("2697"), 699, EmojiCode(0x2697), EmojiCode(0x2697, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("test tube"),*/ qsl("1f9ea"), 700, EmojiCode(0x1f9ea)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("petri dish"),*/ qsl("1f9eb"), 701, EmojiCode(0x1f9eb)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("dna"),*/ qsl("1f9ec"), 702, EmojiCode(0x1f9ec)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("abacus"),*/ qsl("1f9ee"), 703, EmojiCode(0x1f9ee)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("telescope"),*/ qsl("1f52d"), 704, EmojiCode(0x1f52d)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("microscope"),*/ qsl("1f52c"), 705, EmojiCode(0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("hole"),*/ qsl("1f573"), 706, EmojiCode(0x1f573), EmojiCode(0x1f573, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("pill"),*/ qsl("1f48a"), 707, EmojiCode(0x1f48a)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("syringe"),*/ qsl("1f489"), 708, EmojiCode(0x1f489)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("thermometer"),*/ qsl("1f321"), 709, EmojiCode(0x1f321), EmojiCode(0x1f321, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("toilet"),*/ qsl("1f6bd"), 710, EmojiCode(0x1f6bd)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("potable water"),*/ qsl("1f6b0"), 711, EmojiCode(0x1f6b0)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("shower"),*/ qsl("1f6bf"), 712, EmojiCode(0x1f6bf)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("bathtub"),*/ qsl("1f6c1"), 713, EmojiCode(0x1f6c1)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person taking bath"),*/ qsl("1f6c0"), 714, EmojiCode(0x1f6c0)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person taking bath: light skin tone"),*/ qsl("1f6c0-1f3fb"), 715, EmojiCode(0x1f6c0, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person taking bath: medium-light skin tone"),*/ qsl("1f6c0-1f3fc"), 716, EmojiCode(0x1f6c0, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person taking bath: medium skin tone"),*/ qsl("1f6c0-1f3fd"), 717, EmojiCode(0x1f6c0, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person taking bath: medium-dark skin tone"),*/ qsl("1f6c0-1f3fe"), 718, EmojiCode(0x1f6c0, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person taking bath: dark skin tone"),*/ qsl("1f6c0-1f3ff"), 719, EmojiCode(0x1f6c0, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("broom"),*/ qsl("1f9f9"), 720, EmojiCode(0x1f9f9)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("basket"),*/ qsl("1f9fa"), 721, EmojiCode(0x1f9fa)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("roll of paper"),*/ qsl("1f9fb"), 722, EmojiCode(0x1f9fb)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("soap"),*/ qsl("1f9fc"), 723, EmojiCode(0x1f9fc)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("sponge"),*/ qsl("1f9fd"), 724, EmojiCode(0x1f9fd)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("squeeze bottle"),*/ qsl("1f9f4"), 725, EmojiCode(0x1f9f4)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("thread"),*/ qsl("1f9f5"), 726, EmojiCode(0x1f9f5)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("yarn"),*/ qsl("1f9f6"), 727, EmojiCode(0x1f9f6)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("bellhop bell"),*/ qsl("1f6ce"), 728, EmojiCode(0x1f6ce), EmojiCode(0x1f6ce, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("key"),*/ qsl("1f511"), 729, EmojiCode(0x1f511)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("old key"),*/ qsl("1f5dd"), 730, EmojiCode(0x1f5dd), EmojiCode(0x1f5dd, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("door"),*/ qsl("1f6aa"), 731, EmojiCode(0x1f6aa)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("couch and lamp"),*/ qsl("1f6cb"), 732, EmojiCode(0x1f6cb), EmojiCode(0x1f6cb, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("bed"),*/ qsl("1f6cf"), 733, EmojiCode(0x1f6cf), EmojiCode(0x1f6cf, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person in bed"),*/ qsl("1f6cc"), 734, EmojiCode(0x1f6cc)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person in bed: light skin tone"),*/ qsl("1f6cc-1f3fb"), 735, EmojiCode(0x1f6cc, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person in bed: medium-light skin tone"),*/ qsl("1f6cc-1f3fc"), 736, EmojiCode(0x1f6cc, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person in bed: medium skin tone"),*/ qsl("1f6cc-1f3fd"), 737, EmojiCode(0x1f6cc, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person in bed: medium-dark skin tone"),*/ qsl("1f6cc-1f3fe"), 738, EmojiCode(0x1f6cc, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("person in bed: dark skin tone"),*/ qsl("1f6cc-1f3ff"), 739, EmojiCode(0x1f6cc, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("teddy bear"),*/ qsl("1f9f8"), 740, EmojiCode(0x1f9f8)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("framed picture"),*/ qsl("1f5bc"), 741, EmojiCode(0x1f5bc), EmojiCode(0x1f5bc, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("shopping bags"),*/ qsl("1f6cd"), 742, EmojiCode(0x1f6cd), EmojiCode(0x1f6cd, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("shopping cart"),*/ qsl("1f6d2"), 743, EmojiCode(0x1f6d2)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("wrapped gift"),*/ qsl("1f381"), 744, EmojiCode(0x1f381)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("balloon"),*/ qsl("1f388"), 745, EmojiCode(0x1f388)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("carp streamer"),*/ qsl("1f38f"), 746, EmojiCode(0x1f38f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("ribbon"),*/ qsl("1f380"), 747, EmojiCode(0x1f380)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("confetti ball"),*/ qsl("1f38a"), 748, EmojiCode(0x1f38a)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("party popper"),*/ qsl("1f389"), 749, EmojiCode(0x1f389)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("Japanese dolls"),*/ qsl("1f38e"), 750, EmojiCode(0x1f38e)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("red paper lantern"),*/ qsl("1f3ee"), 751, EmojiCode(0x1f3ee)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("wind chime"),*/ qsl("1f390"), 752, EmojiCode(0x1f390)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("red envelope"),*/ qsl("1f9e7"), 753, EmojiCode(0x1f9e7)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("envelope"),*/ qsl("2709"), 754, EmojiCode(0x2709), EmojiCode(0x2709, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("envelope with arrow"),*/ qsl("1f4e9"), 755, EmojiCode(0x1f4e9)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("incoming envelope"),*/ qsl("1f4e8"), 756, EmojiCode(0x1f4e8)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("e-mail"),*/ qsl("1f4e7"), 757, EmojiCode(0x1f4e7)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("love letter"),*/ qsl("1f48c"), 758, EmojiCode(0x1f48c)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("inbox tray"),*/ qsl("1f4e5"), 759, EmojiCode(0x1f4e5), EmojiCode(0x1f4e5, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("outbox tray"),*/ qsl("1f4e4"), 760, EmojiCode(0x1f4e4), EmojiCode(0x1f4e4, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("package"),*/ qsl("1f4e6"), 761, EmojiCode(0x1f4e6), EmojiCode(0x1f4e6, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("label"),*/ qsl("1f3f7"), 762, EmojiCode(0x1f3f7), EmojiCode(0x1f3f7, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("closed mailbox with lowered flag"),*/ qsl("1f4ea"), 763, EmojiCode(0x1f4ea), EmojiCode(0x1f4ea, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("closed mailbox with raised flag"),*/ qsl("1f4eb"), 764, EmojiCode(0x1f4eb), EmojiCode(0x1f4eb, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("open mailbox with raised flag"),*/ qsl("1f4ec"), 765, EmojiCode(0x1f4ec), EmojiCode(0x1f4ec, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("open mailbox with lowered flag"),*/ qsl("1f4ed"), 766, EmojiCode(0x1f4ed), EmojiCode(0x1f4ed, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("postbox"),*/ qsl("1f4ee"), 767, EmojiCode(0x1f4ee)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("postal horn"),*/ qsl("1f4ef"), 768, EmojiCode(0x1f4ef)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("scroll"),*/ qsl("1f4dc"), 769, EmojiCode(0x1f4dc)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("page with curl"),*/ qsl("1f4c3"), 770, EmojiCode(0x1f4c3)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("page facing up"),*/ qsl("1f4c4"), 771, EmojiCode(0x1f4c4)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("receipt"),*/ qsl("1f9fe"), 772, EmojiCode(0x1f9fe)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("bookmark tabs"),*/ qsl("1f4d1"), 773, EmojiCode(0x1f4d1)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("bar chart"),*/ qsl("1f4ca"), 774, EmojiCode(0x1f4ca)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("chart increasing"),*/ qsl("1f4c8"), 775, EmojiCode(0x1f4c8)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("chart decreasing"),*/ qsl("1f4c9"), 776, EmojiCode(0x1f4c9)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("spiral notepad"),*/ qsl("1f5d2"), 777, EmojiCode(0x1f5d2), EmojiCode(0x1f5d2, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("spiral calendar"),*/ qsl("1f5d3"), 778, EmojiCode(0x1f5d3), EmojiCode(0x1f5d3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("tear-off calendar"),*/ qsl("1f4c6"), 779, EmojiCode(0x1f4c6)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("calendar"),*/ qsl("1f4c5"), 780, EmojiCode(0x1f4c5)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("card index"),*/ qsl("1f4c7"), 781, EmojiCode(0x1f4c7)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("card file box"),*/ qsl("1f5c3"), 782, EmojiCode(0x1f5c3), EmojiCode(0x1f5c3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("ballot box with ballot"),*/ qsl("1f5f3"), 783, EmojiCode(0x1f5f3), EmojiCode(0x1f5f3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("file cabinet"),*/ qsl("1f5c4"), 784, EmojiCode(0x1f5c4), EmojiCode(0x1f5c4, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("clipboard"),*/ qsl("1f4cb"), 785, EmojiCode(0x1f4cb), EmojiCode(0x1f4cb, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("file folder"),*/ qsl("1f4c1"), 786, EmojiCode(0x1f4c1)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("open file folder"),*/ qsl("1f4c2"), 787, EmojiCode(0x1f4c2)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("card index dividers"),*/ qsl("1f5c2"), 788, EmojiCode(0x1f5c2), EmojiCode(0x1f5c2, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("rolled-up newspaper"),*/ qsl("1f5de"), 789, EmojiCode(0x1f5de), EmojiCode(0x1f5de, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("newspaper"),*/ qsl("1f4f0"), 790, EmojiCode(0x1f4f0)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("notebook"),*/ qsl("1f4d3"), 791, EmojiCode(0x1f4d3)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("notebook with decorative cover"),*/ qsl("1f4d4"), 792, EmojiCode(0x1f4d4)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("ledger"),*/ qsl("1f4d2"), 793, EmojiCode(0x1f4d2)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("closed book"),*/ qsl("1f4d5"), 794, EmojiCode(0x1f4d5)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("green book"),*/ qsl("1f4d7"), 795, EmojiCode(0x1f4d7)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("blue book"),*/ qsl("1f4d8"), 796, EmojiCode(0x1f4d8)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("orange book"),*/ qsl("1f4d9"), 797, EmojiCode(0x1f4d9)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("books"),*/ qsl("1f4da"), 798, EmojiCode(0x1f4da), EmojiCode(0x1f4da, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("open book"),*/ qsl("1f4d6"), 799, EmojiCode(0x1f4d6)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("bookmark"),*/ qsl("1f516"), 800, EmojiCode(0x1f516)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("link"),*/ qsl("1f517"), 801, EmojiCode(0x1f517)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("paperclip"),*/ qsl("1f4ce"), 802, EmojiCode(0x1f4ce)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("linked paperclips"),*/ qsl("1f587"), 803, EmojiCode(0x1f587), EmojiCode(0x1f587, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("triangular ruler"),*/ qsl("1f4d0"), 804, EmojiCode(0x1f4d0)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("straight ruler"),*/ qsl("1f4cf"), 805, EmojiCode(0x1f4cf)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("safety pin"),*/ qsl("1f9f7"), 806, EmojiCode(0x1f9f7)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("pushpin"),*/ qsl("1f4cc"), 807, EmojiCode(0x1f4cc)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("round pushpin"),*/ qsl("1f4cd"), 808, EmojiCode(0x1f4cd)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("scissors"),*/ qsl("2702"), 809, EmojiCode(0x2702), EmojiCode(0x2702, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("pen"),*/ qsl("1f58a"), 810, EmojiCode(0x1f58a), EmojiCode(0x1f58a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("fountain pen"),*/ qsl("1f58b"), 811, EmojiCode(0x1f58b), EmojiCode(0x1f58b, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("black nib"),*/ qsl("2712"), 812, EmojiCode(0x2712), EmojiCode(0x2712, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("paintbrush"),*/ qsl("1f58c"), 813, EmojiCode(0x1f58c), EmojiCode(0x1f58c, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("crayon"),*/ qsl("1f58d"), 814, EmojiCode(0x1f58d), EmojiCode(0x1f58d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("memo"),*/ qsl("1f4dd"), 815, EmojiCode(0x1f4dd)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("pencil"),*/ qsl("270f"), 816, EmojiCode(0x270f), EmojiCode(0x270f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("magnifying glass tilted left"),*/ qsl("1f50d"), 817, EmojiCode(0x1f50d), EmojiCode(0x1f50d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("magnifying glass tilted right"),*/ qsl("1f50e"), 818, EmojiCode(0x1f50e)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("locked with pen"),*/ qsl("1f50f"), 819, EmojiCode(0x1f50f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("locked with key"),*/ qsl("1f510"), 820, EmojiCode(0x1f510)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("dog face"),*/ qsl("1f436"), 821, EmojiCode(0x1f436)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cat face"),*/ qsl("1f431"), 822, EmojiCode(0x1f431)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("mouse face"),*/ qsl("1f42d"), 823, EmojiCode(0x1f42d)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("hamster face"),*/ qsl("1f439"), 824, EmojiCode(0x1f439)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("rabbit face"),*/ qsl("1f430"), 825, EmojiCode(0x1f430)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("fox face"),*/ qsl("1f98a"), 826, EmojiCode(0x1f98a)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("raccoon"),*/ qsl("1f99d"), 827, EmojiCode(0x1f99d)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("bear face"),*/ qsl("1f43b"), 828, EmojiCode(0x1f43b)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("panda face"),*/ qsl("1f43c"), 829, EmojiCode(0x1f43c)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("kangaroo"),*/ qsl("1f998"), 830, EmojiCode(0x1f998)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("badger"),*/ qsl("1f9a1"), 831, EmojiCode(0x1f9a1)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("koala"),*/ qsl("1f428"), 832, EmojiCode(0x1f428)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("tiger face"),*/ qsl("1f42f"), 833, EmojiCode(0x1f42f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("lion face"),*/ qsl("1f981"), 834, EmojiCode(0x1f981)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cow face"),*/ qsl("1f42e"), 835, EmojiCode(0x1f42e)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("pig face"),*/ qsl("1f437"), 836, EmojiCode(0x1f437)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("pig nose"),*/ qsl("1f43d"), 837, EmojiCode(0x1f43d)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("frog face"),*/ qsl("1f438"), 838, EmojiCode(0x1f438)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("monkey face"),*/ qsl("1f435"), 839, EmojiCode(0x1f435)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("see-no-evil monkey"),*/ qsl("1f648"), 840, EmojiCode(0x1f648)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("hear-no-evil monkey"),*/ qsl("1f649"), 841, EmojiCode(0x1f649)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("speak-no-evil monkey"),*/ qsl("1f64a"), 842, EmojiCode(0x1f64a)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("monkey"),*/ qsl("1f412"), 843, EmojiCode(0x1f412)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("chicken"),*/ qsl("1f414"), 844, EmojiCode(0x1f414)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("penguin"),*/ qsl("1f427"), 845, EmojiCode(0x1f427)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("bird"),*/ qsl("1f426"), 846, EmojiCode(0x1f426), EmojiCode(0x1f426, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("baby chick"),*/ qsl("1f424"), 847, EmojiCode(0x1f424)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("hatching chick"),*/ qsl("1f423"), 848, EmojiCode(0x1f423)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("front-facing baby chick"),*/ qsl("1f425"), 849, EmojiCode(0x1f425)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("duck"),*/ qsl("1f986"), 850, EmojiCode(0x1f986)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("swan"),*/ qsl("1f9a2"), 851, EmojiCode(0x1f9a2)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("eagle"),*/ qsl("1f985"), 852, EmojiCode(0x1f985)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("owl"),*/ qsl("1f989"), 853, EmojiCode(0x1f989)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("parrot"),*/ qsl("1f99c"), 854, EmojiCode(0x1f99c)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("peacock"),*/ qsl("1f99a"), 855, EmojiCode(0x1f99a)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("bat"),*/ qsl("1f987"), 856, EmojiCode(0x1f987)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("wolf face"),*/ qsl("1f43a"), 857, EmojiCode(0x1f43a)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("boar"),*/ qsl("1f417"), 858, EmojiCode(0x1f417)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("horse face"),*/ qsl("1f434"), 859, EmojiCode(0x1f434)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("unicorn face"),*/ qsl("1f984"), 860, EmojiCode(0x1f984)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("honeybee"),*/ qsl("1f41d"), 861, EmojiCode(0x1f41d)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("bug"),*/ qsl("1f41b"), 862, EmojiCode(0x1f41b)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("butterfly"),*/ qsl("1f98b"), 863, EmojiCode(0x1f98b)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("snail"),*/ qsl("1f40c"), 864, EmojiCode(0x1f40c)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("spiral shell"),*/ qsl("1f41a"), 865, EmojiCode(0x1f41a)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("lady beetle"),*/ qsl("1f41e"), 866, EmojiCode(0x1f41e)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("ant"),*/ qsl("1f41c"), 867, EmojiCode(0x1f41c)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cricket"),*/ qsl("1f997"), 868, EmojiCode(0x1f997)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("spider"),*/ qsl("1f577"), 869, EmojiCode(0x1f577), EmojiCode(0x1f577, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("spider web"),*/ qsl("1f578"), 870, EmojiCode(0x1f578), EmojiCode(0x1f578, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("scorpion"),*/ qsl("1f982"), 871, EmojiCode(0x1f982)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("mosquito"),*/ qsl("1f99f"), 872, EmojiCode(0x1f99f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("microbe"),*/ qsl("1f9a0"), 873, EmojiCode(0x1f9a0)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("turtle"),*/ qsl("1f422"), 874, EmojiCode(0x1f422)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("snake"),*/ qsl("1f40d"), 875, EmojiCode(0x1f40d)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("lizard"),*/ qsl("1f98e"), 876, EmojiCode(0x1f98e)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("T-Rex"),*/ qsl("1f996"), 877, EmojiCode(0x1f996)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sauropod"),*/ qsl("1f995"), 878, EmojiCode(0x1f995)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("octopus"),*/ qsl("1f419"), 879, EmojiCode(0x1f419)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("squid"),*/ qsl("1f991"), 880, EmojiCode(0x1f991)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("shrimp"),*/ qsl("1f990"), 881, EmojiCode(0x1f990)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("crab"),*/ qsl("1f980"), 882, EmojiCode(0x1f980)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("lobster"),*/ qsl("1f99e"), 883, EmojiCode(0x1f99e)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("blowfish"),*/ qsl("1f421"), 884, EmojiCode(0x1f421)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("tropical fish"),*/ qsl("1f420"), 885, EmojiCode(0x1f420)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("fish"),*/ qsl("1f41f"), 886, EmojiCode(0x1f41f), EmojiCode(0x1f41f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("dolphin"),*/ qsl("1f42c"), 887, EmojiCode(0x1f42c)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("spouting whale"),*/ qsl("1f433"), 888, EmojiCode(0x1f433)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("whale"),*/ qsl("1f40b"), 889, EmojiCode(0x1f40b)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("shark"),*/ qsl("1f988"), 890, EmojiCode(0x1f988)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("crocodile"),*/ qsl("1f40a"), 891, EmojiCode(0x1f40a)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("tiger"),*/ qsl("1f405"), 892, EmojiCode(0x1f405)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("leopard"),*/ qsl("1f406"), 893, EmojiCode(0x1f406)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("zebra"),*/ qsl("1f993"), 894, EmojiCode(0x1f993)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("gorilla"),*/ qsl("1f98d"), 895, EmojiCode(0x1f98d)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("elephant"),*/ qsl("1f418"), 896, EmojiCode(0x1f418)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("rhinoceros"),*/ qsl("1f98f"), 897, EmojiCode(0x1f98f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("hippopotamus"),*/ qsl("1f99b"), 898, EmojiCode(0x1f99b)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("camel"),*/ qsl("1f42a"), 899, EmojiCode(0x1f42a)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("two-hump camel"),*/ qsl("1f42b"), 900, EmojiCode(0x1f42b)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("giraffe"),*/ qsl("1f992"), 901, EmojiCode(0x1f992)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("llama"),*/ qsl("1f999"), 902, EmojiCode(0x1f999)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("water buffalo"),*/ qsl("1f403"), 903, EmojiCode(0x1f403)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("ox"),*/ qsl("1f402"), 904, EmojiCode(0x1f402)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cow"),*/ qsl("1f404"), 905, EmojiCode(0x1f404)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("horse"),*/ qsl("1f40e"), 906, EmojiCode(0x1f40e)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("pig"),*/ qsl("1f416"), 907, EmojiCode(0x1f416)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("ram"),*/ qsl("1f40f"), 908, EmojiCode(0x1f40f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("ewe"),*/ qsl("1f411"), 909, EmojiCode(0x1f411)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("goat"),*/ qsl("1f410"), 910, EmojiCode(0x1f410)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("deer"),*/ qsl("1f98c"), 911, EmojiCode(0x1f98c)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("dog"),*/ qsl("1f415"), 912, EmojiCode(0x1f415), EmojiCode(0x1f415, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("poodle"),*/ qsl("1f429"), 913, EmojiCode(0x1f429)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cat"),*/ qsl("1f408"), 914, EmojiCode(0x1f408), EmojiCode(0x1f408, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("rooster"),*/ qsl("1f413"), 915, EmojiCode(0x1f413)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("turkey"),*/ qsl("1f983"), 916, EmojiCode(0x1f983)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("dove"),*/ qsl("1f54a"), 917, EmojiCode(0x1f54a), EmojiCode(0x1f54a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("rabbit"),*/ qsl("1f407"), 918, EmojiCode(0x1f407)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("mouse"),*/ qsl("1f401"), 919, EmojiCode(0x1f401)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("rat"),*/ qsl("1f400"), 920, EmojiCode(0x1f400)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("chipmunk"),*/ qsl("1f43f"), 921, EmojiCode(0x1f43f), EmojiCode(0x1f43f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("hedgehog"),*/ qsl("1f994"), 922, EmojiCode(0x1f994)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("paw prints"),*/ qsl("1f43e"), 923, EmojiCode(0x1f43e)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("dragon"),*/ qsl("1f409"), 924, EmojiCode(0x1f409)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("dragon face"),*/ qsl("1f432"), 925, EmojiCode(0x1f432)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cactus"),*/ qsl("1f335"), 926, EmojiCode(0x1f335)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("Christmas tree"),*/ qsl("1f384"), 927, EmojiCode(0x1f384)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("evergreen tree"),*/ qsl("1f332"), 928, EmojiCode(0x1f332)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("deciduous tree"),*/ qsl("1f333"), 929, EmojiCode(0x1f333)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("palm tree"),*/ qsl("1f334"), 930, EmojiCode(0x1f334)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("seedling"),*/ qsl("1f331"), 931, EmojiCode(0x1f331)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("herb"),*/ qsl("1f33f"), 932, EmojiCode(0x1f33f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("shamrock"),*/ qsl("2618"), 933, EmojiCode(0x2618), EmojiCode(0x2618, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("four leaf clover"),*/ qsl("1f340"), 934, EmojiCode(0x1f340)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("pine decoration"),*/ qsl("1f38d"), 935, EmojiCode(0x1f38d)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("tanabata tree"),*/ qsl("1f38b"), 936, EmojiCode(0x1f38b)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("leaf fluttering in wind"),*/ qsl("1f343"), 937, EmojiCode(0x1f343)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("fallen leaf"),*/ qsl("1f342"), 938, EmojiCode(0x1f342)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("maple leaf"),*/ qsl("1f341"), 939, EmojiCode(0x1f341)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("mushroom"),*/ qsl("1f344"), 940, EmojiCode(0x1f344)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sheaf of rice"),*/ qsl("1f33e"), 941, EmojiCode(0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("bouquet"),*/ qsl("1f490"), 942, EmojiCode(0x1f490)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("tulip"),*/ qsl("1f337"), 943, EmojiCode(0x1f337)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("rose"),*/ qsl("1f339"), 944, EmojiCode(0x1f339)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("wilted flower"),*/ qsl("1f940"), 945, EmojiCode(0x1f940)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("hibiscus"),*/ qsl("1f33a"), 946, EmojiCode(0x1f33a)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cherry blossom"),*/ qsl("1f338"), 947, EmojiCode(0x1f338)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("blossom"),*/ qsl("1f33c"), 948, EmojiCode(0x1f33c)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sunflower"),*/ qsl("1f33b"), 949, EmojiCode(0x1f33b)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sun with face"),*/ qsl("1f31e"), 950, EmojiCode(0x1f31e)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("full moon face"),*/ qsl("1f31d"), 951, EmojiCode(0x1f31d)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("first quarter moon face"),*/ qsl("1f31b"), 952, EmojiCode(0x1f31b)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("last quarter moon face"),*/ qsl("1f31c"), 953, EmojiCode(0x1f31c), EmojiCode(0x1f31c, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("new moon face"),*/ qsl("1f31a"), 954, EmojiCode(0x1f31a)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("full moon"),*/ qsl("1f315"), 955, EmojiCode(0x1f315), EmojiCode(0x1f315, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("waning gibbous moon"),*/ qsl("1f316"), 956, EmojiCode(0x1f316)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("last quarter moon"),*/ qsl("1f317"), 957, EmojiCode(0x1f317)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("waning crescent moon"),*/ qsl("1f318"), 958, EmojiCode(0x1f318)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("new moon"),*/ qsl("1f311"), 959, EmojiCode(0x1f311)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("waxing crescent moon"),*/ qsl("1f312"), 960, EmojiCode(0x1f312)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("first quarter moon"),*/ qsl("1f313"), 961, EmojiCode(0x1f313)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("waxing gibbous moon"),*/ qsl("1f314"), 962, EmojiCode(0x1f314)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("crescent moon"),*/ qsl("1f319"), 963, EmojiCode(0x1f319)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("globe showing Americas"),*/ qsl("1f30e"), 964, EmojiCode(0x1f30e), EmojiCode(0x1f30e, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("globe showing Europe-Africa"),*/ qsl("1f30d"), 965, EmojiCode(0x1f30d), EmojiCode(0x1f30d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("globe showing Asia-Australia"),*/ qsl("1f30f"), 966, EmojiCode(0x1f30f), EmojiCode(0x1f30f, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("dizzy"),*/ qsl("1f4ab"), 967, EmojiCode(0x1f4ab)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("star"),*/ qsl("2b50"), 968, EmojiCode(0x2b50), EmojiCode(0x2b50, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("glowing star"),*/ qsl("1f31f"), 969, EmojiCode(0x1f31f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sparkles"),*/ qsl("2728"), 970, EmojiCode(0x2728)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("high voltage"),*/ qsl("26a1"), 971, EmojiCode(0x26a1), EmojiCode(0x26a1, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("comet"),*/ qsl("2604"), 972, EmojiCode(0x2604), EmojiCode(0x2604, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("collision"),*/ qsl("1f4a5"), 973, EmojiCode(0x1f4a5)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("fire"),*/ qsl("1f525"), 974, EmojiCode(0x1f525)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("tornado"),*/ qsl("1f32a"), 975, EmojiCode(0x1f32a), EmojiCode(0x1f32a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("rainbow"),*/ qsl("1f308"), 976, EmojiCode(0x1f308)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sun"),*/ qsl("2600"), 977, EmojiCode(0x2600), EmojiCode(0x2600, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sun behind small cloud"),*/ qsl("1f324"), 978, EmojiCode(0x1f324), EmojiCode(0x1f324, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sun behind cloud"),*/ qsl("26c5"), 979, EmojiCode(0x26c5), EmojiCode(0x26c5, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sun behind large cloud"),*/ qsl("1f325"), 980, EmojiCode(0x1f325), EmojiCode(0x1f325, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cloud"),*/ qsl("2601"), 981, EmojiCode(0x2601), EmojiCode(0x2601, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sun behind rain cloud"),*/ qsl("1f326"), 982, EmojiCode(0x1f326), EmojiCode(0x1f326, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cloud with rain"),*/ qsl("1f327"), 983, EmojiCode(0x1f327), EmojiCode(0x1f327, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cloud with lightning and rain"),*/ qsl("26c8"), 984, EmojiCode(0x26c8), EmojiCode(0x26c8, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cloud with lightning"),*/ qsl("1f329"), 985, EmojiCode(0x1f329), EmojiCode(0x1f329, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("cloud with snow"),*/ qsl("1f328"), 986, EmojiCode(0x1f328), EmojiCode(0x1f328, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("snowflake"),*/ qsl("2744"), 987, EmojiCode(0x2744), EmojiCode(0x2744, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("snowman"),*/ qsl("2603"), 988, EmojiCode(0x2603), EmojiCode(0x2603, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("snowman without snow"),*/ qsl("26c4"), 989, EmojiCode(0x26c4), EmojiCode(0x26c4, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("wind face"),*/ qsl("1f32c"), 990, EmojiCode(0x1f32c), EmojiCode(0x1f32c, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("dashing away"),*/ qsl("1f4a8"), 991, EmojiCode(0x1f4a8)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("droplet"),*/ qsl("1f4a7"), 992, EmojiCode(0x1f4a7)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("sweat droplets"),*/ qsl("1f4a6"), 993, EmojiCode(0x1f4a6)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("umbrella with rain drops"),*/ qsl("2614"), 994, EmojiCode(0x2614), EmojiCode(0x2614, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("umbrella"),*/ qsl("2602"), 995, EmojiCode(0x2602), EmojiCode(0x2602, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("water wave"),*/ qsl("1f30a"), 996, EmojiCode(0x1f30a)));
-        res.push_back(std::make_shared<EmojiRecord>(natureCategory(), /*qsl("fog"),*/ qsl("1f32b"), 997, EmojiCode(0x1f32b), EmojiCode(0x1f32b, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("green apple"),*/ qsl("1f34f"), 998, EmojiCode(0x1f34f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("red apple"),*/ qsl("1f34e"), 999, EmojiCode(0x1f34e)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("pear"),*/ qsl("1f350"), 1000, EmojiCode(0x1f350)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("tangerine"),*/ qsl("1f34a"), 1001, EmojiCode(0x1f34a)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("lemon"),*/ qsl("1f34b"), 1002, EmojiCode(0x1f34b)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("banana"),*/ qsl("1f34c"), 1003, EmojiCode(0x1f34c)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("watermelon"),*/ qsl("1f349"), 1004, EmojiCode(0x1f349)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("grapes"),*/ qsl("1f347"), 1005, EmojiCode(0x1f347)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("strawberry"),*/ qsl("1f353"), 1006, EmojiCode(0x1f353)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("melon"),*/ qsl("1f348"), 1007, EmojiCode(0x1f348)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("cherries"),*/ qsl("1f352"), 1008, EmojiCode(0x1f352)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("peach"),*/ qsl("1f351"), 1009, EmojiCode(0x1f351)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("mango"),*/ qsl("1f96d"), 1010, EmojiCode(0x1f96d)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("pineapple"),*/ qsl("1f34d"), 1011, EmojiCode(0x1f34d)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("coconut"),*/ qsl("1f965"), 1012, EmojiCode(0x1f965)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("kiwi fruit"),*/ qsl("1f95d"), 1013, EmojiCode(0x1f95d)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("tomato"),*/ qsl("1f345"), 1014, EmojiCode(0x1f345)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("eggplant"),*/ qsl("1f346"), 1015, EmojiCode(0x1f346)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("avocado"),*/ qsl("1f951"), 1016, EmojiCode(0x1f951)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("broccoli"),*/ qsl("1f966"), 1017, EmojiCode(0x1f966)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("leafy green"),*/ qsl("1f96c"), 1018, EmojiCode(0x1f96c)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("cucumber"),*/ qsl("1f952"), 1019, EmojiCode(0x1f952)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("hot pepper"),*/ qsl("1f336"), 1020, EmojiCode(0x1f336), EmojiCode(0x1f336, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("ear of corn"),*/ qsl("1f33d"), 1021, EmojiCode(0x1f33d)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("carrot"),*/ qsl("1f955"), 1022, EmojiCode(0x1f955)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("potato"),*/ qsl("1f954"), 1023, EmojiCode(0x1f954)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("roasted sweet potato"),*/ qsl("1f360"), 1024, EmojiCode(0x1f360)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("croissant"),*/ qsl("1f950"), 1025, EmojiCode(0x1f950)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("bread"),*/ qsl("1f35e"), 1026, EmojiCode(0x1f35e)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("baguette bread"),*/ qsl("1f956"), 1027, EmojiCode(0x1f956)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("pretzel"),*/ qsl("1f968"), 1028, EmojiCode(0x1f968)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("bagel"),*/ qsl("1f96f"), 1029, EmojiCode(0x1f96f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("cheese wedge"),*/ qsl("1f9c0"), 1030, EmojiCode(0x1f9c0)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("egg"),*/ qsl("1f95a"), 1031, EmojiCode(0x1f95a)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("cooking"),*/ qsl("1f373"), 1032, EmojiCode(0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("pancakes"),*/ qsl("1f95e"), 1033, EmojiCode(0x1f95e)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("bacon"),*/ qsl("1f953"), 1034, EmojiCode(0x1f953)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("cut of meat"),*/ qsl("1f969"), 1035, EmojiCode(0x1f969)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("poultry leg"),*/ qsl("1f357"), 1036, EmojiCode(0x1f357)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("meat on bone"),*/ qsl("1f356"), 1037, EmojiCode(0x1f356)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("hot dog"),*/ qsl("1f32d"), 1038, EmojiCode(0x1f32d)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("hamburger"),*/ qsl("1f354"), 1039, EmojiCode(0x1f354)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("french fries"),*/ qsl("1f35f"), 1040, EmojiCode(0x1f35f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("pizza"),*/ qsl("1f355"), 1041, EmojiCode(0x1f355)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("sandwich"),*/ qsl("1f96a"), 1042, EmojiCode(0x1f96a)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("stuffed flatbread"),*/ qsl("1f959"), 1043, EmojiCode(0x1f959)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("taco"),*/ qsl("1f32e"), 1044, EmojiCode(0x1f32e)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("burrito"),*/ qsl("1f32f"), 1045, EmojiCode(0x1f32f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("green salad"),*/ qsl("1f957"), 1046, EmojiCode(0x1f957)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("shallow pan of food"),*/ qsl("1f958"), 1047, EmojiCode(0x1f958)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("canned food"),*/ qsl("1f96b"), 1048, EmojiCode(0x1f96b)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("spaghetti"),*/ qsl("1f35d"), 1049, EmojiCode(0x1f35d)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("steaming bowl"),*/ qsl("1f35c"), 1050, EmojiCode(0x1f35c)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("pot of food"),*/ qsl("1f372"), 1051, EmojiCode(0x1f372)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("curry rice"),*/ qsl("1f35b"), 1052, EmojiCode(0x1f35b)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("sushi"),*/ qsl("1f363"), 1053, EmojiCode(0x1f363)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("bento box"),*/ qsl("1f371"), 1054, EmojiCode(0x1f371)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("fried shrimp"),*/ qsl("1f364"), 1055, EmojiCode(0x1f364)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("rice ball"),*/ qsl("1f359"), 1056, EmojiCode(0x1f359)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("cooked rice"),*/ qsl("1f35a"), 1057, EmojiCode(0x1f35a)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("rice cracker"),*/ qsl("1f358"), 1058, EmojiCode(0x1f358)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("fish cake with swirl"),*/ qsl("1f365"), 1059, EmojiCode(0x1f365)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("fortune cookie"),*/ qsl("1f960"), 1060, EmojiCode(0x1f960)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("oden"),*/ qsl("1f362"), 1061, EmojiCode(0x1f362)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("dango"),*/ qsl("1f361"), 1062, EmojiCode(0x1f361)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("shaved ice"),*/ qsl("1f367"), 1063, EmojiCode(0x1f367)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("ice cream"),*/ qsl("1f368"), 1064, EmojiCode(0x1f368)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("soft ice cream"),*/ qsl("1f366"), 1065, EmojiCode(0x1f366)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("pie"),*/ qsl("1f967"), 1066, EmojiCode(0x1f967)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("shortcake"),*/ qsl("1f370"), 1067, EmojiCode(0x1f370)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("birthday cake"),*/ qsl("1f382"), 1068, EmojiCode(0x1f382)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("moon cake"),*/ qsl("1f96e"), 1069, EmojiCode(0x1f96e)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("cupcake"),*/ qsl("1f9c1"), 1070, EmojiCode(0x1f9c1)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("custard"),*/ qsl("1f36e"), 1071, EmojiCode(0x1f36e)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("lollipop"),*/ qsl("1f36d"), 1072, EmojiCode(0x1f36d)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("candy"),*/ qsl("1f36c"), 1073, EmojiCode(0x1f36c)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("chocolate bar"),*/ qsl("1f36b"), 1074, EmojiCode(0x1f36b)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("popcorn"),*/ qsl("1f37f"), 1075, EmojiCode(0x1f37f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("salt"),*/ qsl("1f9c2"), 1076, EmojiCode(0x1f9c2)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("doughnut"),*/ qsl("1f369"), 1077, EmojiCode(0x1f369)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("dumpling"),*/ qsl("1f95f"), 1078, EmojiCode(0x1f95f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("cookie"),*/ qsl("1f36a"), 1079, EmojiCode(0x1f36a)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("chestnut"),*/ qsl("1f330"), 1080, EmojiCode(0x1f330)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("peanuts"),*/ qsl("1f95c"), 1081, EmojiCode(0x1f95c)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("honey pot"),*/ qsl("1f36f"), 1082, EmojiCode(0x1f36f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("glass of milk"),*/ qsl("1f95b"), 1083, EmojiCode(0x1f95b)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("baby bottle"),*/ qsl("1f37c"), 1084, EmojiCode(0x1f37c)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("hot beverage"),*/ qsl("2615"), 1085, EmojiCode(0x2615), EmojiCode(0x2615, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("teacup without handle"),*/ qsl("1f375"), 1086, EmojiCode(0x1f375)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("cup with straw"),*/ qsl("1f964"), 1087, EmojiCode(0x1f964)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("sake"),*/ qsl("1f376"), 1088, EmojiCode(0x1f376)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("beer mug"),*/ qsl("1f37a"), 1089, EmojiCode(0x1f37a)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("clinking beer mugs"),*/ qsl("1f37b"), 1090, EmojiCode(0x1f37b)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("clinking glasses"),*/ qsl("1f942"), 1091, EmojiCode(0x1f942)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("wine glass"),*/ qsl("1f377"), 1092, EmojiCode(0x1f377)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("tumbler glass"),*/ qsl("1f943"), 1093, EmojiCode(0x1f943)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("cocktail glass"),*/ qsl("1f378"), 1094, EmojiCode(0x1f378), EmojiCode(0x1f378, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("tropical drink"),*/ qsl("1f379"), 1095, EmojiCode(0x1f379)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("bottle with popping cork"),*/ qsl("1f37e"), 1096, EmojiCode(0x1f37e)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("spoon"),*/ qsl("1f944"), 1097, EmojiCode(0x1f944)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("fork and knife"),*/ qsl("1f374"), 1098, EmojiCode(0x1f374)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("fork and knife with plate"),*/ qsl("1f37d"), 1099, EmojiCode(0x1f37d), EmojiCode(0x1f37d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("bowl with spoon"),*/ qsl("1f963"), 1100, EmojiCode(0x1f963)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("takeout box"),*/ qsl("1f961"), 1101, EmojiCode(0x1f961)));
-        res.push_back(std::make_shared<EmojiRecord>(foodCategory(), /*qsl("chopsticks"),*/ qsl("1f962"), 1102, EmojiCode(0x1f962)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("grinning face"),*/ qsl("1f600"), 1103, EmojiCode(0x1f600)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("grinning face with big eyes"),*/ qsl("1f603"), 1104, EmojiCode(0x1f603)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("grinning face with smiling eyes"),*/ qsl("1f604"), 1105, EmojiCode(0x1f604)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("beaming face with smiling eyes"),*/ qsl("1f601"), 1106, EmojiCode(0x1f601)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("grinning squinting face"),*/ qsl("1f606"), 1107, EmojiCode(0x1f606)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("grinning face with sweat"),*/ qsl("1f605"), 1108, EmojiCode(0x1f605)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with tears of joy"),*/ qsl("1f602"), 1109, EmojiCode(0x1f602)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("rolling on the floor laughing"),*/ qsl("1f923"), 1110, EmojiCode(0x1f923)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("smiling face"),*/ qsl("263a"), 1111, EmojiCode(0x263a), EmojiCode(0x263a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("smiling face with smiling eyes"),*/ qsl("1f60a"), 1112, EmojiCode(0x1f60a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("smiling face with halo"),*/ qsl("1f607"), 1113, EmojiCode(0x1f607)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("slightly smiling face"),*/ qsl("1f642"), 1114, EmojiCode(0x1f642)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("upside-down face"),*/ qsl("1f643"), 1115, EmojiCode(0x1f643)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("winking face"),*/ qsl("1f609"), 1116, EmojiCode(0x1f609)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("relieved face"),*/ qsl("1f60c"), 1117, EmojiCode(0x1f60c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("smiling face with heart-eyes"),*/ qsl("1f60d"), 1118, EmojiCode(0x1f60d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face blowing a kiss"),*/ qsl("1f618"), 1119, EmojiCode(0x1f618)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("smiling face with 3 hearts"),*/ qsl("1f970"), 1120, EmojiCode(0x1f970)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("kissing face"),*/ qsl("1f617"), 1121, EmojiCode(0x1f617)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("kissing face with smiling eyes"),*/ qsl("1f619"), 1122, EmojiCode(0x1f619)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("kissing face with closed eyes"),*/ qsl("1f61a"), 1123, EmojiCode(0x1f61a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face savoring food"),*/ qsl("1f60b"), 1124, EmojiCode(0x1f60b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with tongue"),*/ qsl("1f61b"), 1125, EmojiCode(0x1f61b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("squinting face with tongue"),*/ qsl("1f61d"), 1126, EmojiCode(0x1f61d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("winking face with tongue"),*/ qsl("1f61c"), 1127, EmojiCode(0x1f61c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("zany face"),*/ qsl("1f92a"), 1128, EmojiCode(0x1f92a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with raised eyebrow"),*/ qsl("1f928"), 1129, EmojiCode(0x1f928)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with monocle"),*/ qsl("1f9d0"), 1130, EmojiCode(0x1f9d0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nerd face"),*/ qsl("1f913"), 1131, EmojiCode(0x1f913)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("smiling face with sunglasses"),*/ qsl("1f60e"), 1132, EmojiCode(0x1f60e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("star-struck"),*/ qsl("1f929"), 1133, EmojiCode(0x1f929)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("partying face"),*/ qsl("1f973"), 1134, EmojiCode(0x1f973)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("smirking face"),*/ qsl("1f60f"), 1135, EmojiCode(0x1f60f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("unamused face"),*/ qsl("1f612"), 1136, EmojiCode(0x1f612)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("disappointed face"),*/ qsl("1f61e"), 1137, EmojiCode(0x1f61e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pensive face"),*/ qsl("1f614"), 1138, EmojiCode(0x1f614)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("worried face"),*/ qsl("1f61f"), 1139, EmojiCode(0x1f61f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("confused face"),*/ qsl("1f615"), 1140, EmojiCode(0x1f615)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("slightly frowning face"),*/ qsl("1f641"), 1141, EmojiCode(0x1f641)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("frowning face"),*/ qsl("2639"), 1142, EmojiCode(0x2639), EmojiCode(0x2639, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("persevering face"),*/ qsl("1f623"), 1143, EmojiCode(0x1f623)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("confounded face"),*/ qsl("1f616"), 1144, EmojiCode(0x1f616)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("tired face"),*/ qsl("1f62b"), 1145, EmojiCode(0x1f62b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("weary face"),*/ qsl("1f629"), 1146, EmojiCode(0x1f629)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("crying face"),*/ qsl("1f622"), 1147, EmojiCode(0x1f622)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("loudly crying face"),*/ qsl("1f62d"), 1148, EmojiCode(0x1f62d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with steam from nose"),*/ qsl("1f624"), 1149, EmojiCode(0x1f624)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("angry face"),*/ qsl("1f620"), 1150, EmojiCode(0x1f620)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pouting face"),*/ qsl("1f621"), 1151, EmojiCode(0x1f621)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with symbols on mouth"),*/ qsl("1f92c"), 1152, EmojiCode(0x1f92c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("exploding head"),*/ qsl("1f92f"), 1153, EmojiCode(0x1f92f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("flushed face"),*/ qsl("1f633"), 1154, EmojiCode(0x1f633)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face screaming in fear"),*/ qsl("1f631"), 1155, EmojiCode(0x1f631)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("fearful face"),*/ qsl("1f628"), 1156, EmojiCode(0x1f628)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("anxious face with sweat"),*/ qsl("1f630"), 1157, EmojiCode(0x1f630)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("hot face"),*/ qsl("1f975"), 1158, EmojiCode(0x1f975)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("cold face"),*/ qsl("1f976"), 1159, EmojiCode(0x1f976)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pleading face"),*/ qsl("1f97a"), 1160, EmojiCode(0x1f97a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sad but relieved face"),*/ qsl("1f625"), 1161, EmojiCode(0x1f625)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("downcast face with sweat"),*/ qsl("1f613"), 1162, EmojiCode(0x1f613)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("hugging face"),*/ qsl("1f917"), 1163, EmojiCode(0x1f917)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thinking face"),*/ qsl("1f914"), 1164, EmojiCode(0x1f914)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with hand over mouth"),*/ qsl("1f92d"), 1165, EmojiCode(0x1f92d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("shushing face"),*/ qsl("1f92b"), 1166, EmojiCode(0x1f92b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("lying face"),*/ qsl("1f925"), 1167, EmojiCode(0x1f925)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face without mouth"),*/ qsl("1f636"), 1168, EmojiCode(0x1f636)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("neutral face"),*/ qsl("1f610"), 1169, EmojiCode(0x1f610), EmojiCode(0x1f610, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("expressionless face"),*/ qsl("1f611"), 1170, EmojiCode(0x1f611)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("grimacing face"),*/ qsl("1f62c"), 1171, EmojiCode(0x1f62c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with rolling eyes"),*/ qsl("1f644"), 1172, EmojiCode(0x1f644)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("hushed face"),*/ qsl("1f62f"), 1173, EmojiCode(0x1f62f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("frowning face with open mouth"),*/ qsl("1f626"), 1174, EmojiCode(0x1f626)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("anguished face"),*/ qsl("1f627"), 1175, EmojiCode(0x1f627)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with open mouth"),*/ qsl("1f62e"), 1176, EmojiCode(0x1f62e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("astonished face"),*/ qsl("1f632"), 1177, EmojiCode(0x1f632)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sleeping face"),*/ qsl("1f634"), 1178, EmojiCode(0x1f634)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("drooling face"),*/ qsl("1f924"), 1179, EmojiCode(0x1f924)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sleepy face"),*/ qsl("1f62a"), 1180, EmojiCode(0x1f62a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("dizzy face"),*/ qsl("1f635"), 1181, EmojiCode(0x1f635)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("zipper-mouth face"),*/ qsl("1f910"), 1182, EmojiCode(0x1f910)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woozy face"),*/ qsl("1f974"), 1183, EmojiCode(0x1f974)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nauseated face"),*/ qsl("1f922"), 1184, EmojiCode(0x1f922)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face vomiting"),*/ qsl("1f92e"), 1185, EmojiCode(0x1f92e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sneezing face"),*/ qsl("1f927"), 1186, EmojiCode(0x1f927)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with medical mask"),*/ qsl("1f637"), 1187, EmojiCode(0x1f637)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with thermometer"),*/ qsl("1f912"), 1188, EmojiCode(0x1f912)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("face with head-bandage"),*/ qsl("1f915"), 1189, EmojiCode(0x1f915)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("money-mouth face"),*/ qsl("1f911"), 1190, EmojiCode(0x1f911)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("cowboy hat face"),*/ qsl("1f920"), 1191, EmojiCode(0x1f920)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("smiling face with horns"),*/ qsl("1f608"), 1192, EmojiCode(0x1f608)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("angry face with horns"),*/ qsl("1f47f"), 1193, EmojiCode(0x1f47f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("ogre"),*/ qsl("1f479"), 1194, EmojiCode(0x1f479)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("goblin"),*/ qsl("1f47a"), 1195, EmojiCode(0x1f47a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("clown face"),*/ qsl("1f921"), 1196, EmojiCode(0x1f921)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pile of poo"),*/ qsl("1f4a9"), 1197, EmojiCode(0x1f4a9)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("ghost"),*/ qsl("1f47b"), 1198, EmojiCode(0x1f47b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("skull"),*/ qsl("1f480"), 1199, EmojiCode(0x1f480)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("skull and crossbones"),*/ qsl("2620"), 1200, EmojiCode(0x2620), EmojiCode(0x2620, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("alien"),*/ qsl("1f47d"), 1201, EmojiCode(0x1f47d), EmojiCode(0x1f47d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("alien monster"),*/ qsl("1f47e"), 1202, EmojiCode(0x1f47e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("robot face"),*/ qsl("1f916"), 1203, EmojiCode(0x1f916)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("jack-o-lantern"),*/ qsl("1f383"), 1204, EmojiCode(0x1f383)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("grinning cat face"),*/ qsl("1f63a"), 1205, EmojiCode(0x1f63a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("grinning cat face with smiling eyes"),*/ qsl("1f638"), 1206, EmojiCode(0x1f638)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("cat face with tears of joy"),*/ qsl("1f639"), 1207, EmojiCode(0x1f639)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("smiling cat face with heart-eyes"),*/ qsl("1f63b"), 1208, EmojiCode(0x1f63b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("cat face with wry smile"),*/ qsl("1f63c"), 1209, EmojiCode(0x1f63c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("kissing cat face"),*/ qsl("1f63d"), 1210, EmojiCode(0x1f63d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("weary cat face"),*/ qsl("1f640"), 1211, EmojiCode(0x1f640)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("crying cat face"),*/ qsl("1f63f"), 1212, EmojiCode(0x1f63f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pouting cat face"),*/ qsl("1f63e"), 1213, EmojiCode(0x1f63e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("palms up together"),*/ qsl("1f932"), 1214, EmojiCode(0x1f932)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("palms up together: light skin tone"),*/ qsl("1f932-1f3fb"), 1215, EmojiCode(0x1f932, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("palms up together: medium-light skin tone"),*/ qsl("1f932-1f3fc"), 1216, EmojiCode(0x1f932, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("palms up together: medium skin tone"),*/ qsl("1f932-1f3fd"), 1217, EmojiCode(0x1f932, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("palms up together: medium-dark skin tone"),*/ qsl("1f932-1f3fe"), 1218, EmojiCode(0x1f932, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("palms up together: dark skin tone"),*/ qsl("1f932-1f3ff"), 1219, EmojiCode(0x1f932, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("open hands"),*/ qsl("1f450"), 1220, EmojiCode(0x1f450)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("open hands: light skin tone"),*/ qsl("1f450-1f3fb"), 1221, EmojiCode(0x1f450, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("open hands: medium-light skin tone"),*/ qsl("1f450-1f3fc"), 1222, EmojiCode(0x1f450, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("open hands: medium skin tone"),*/ qsl("1f450-1f3fd"), 1223, EmojiCode(0x1f450, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("open hands: medium-dark skin tone"),*/ qsl("1f450-1f3fe"), 1224, EmojiCode(0x1f450, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("open hands: dark skin tone"),*/ qsl("1f450-1f3ff"), 1225, EmojiCode(0x1f450, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raising hands"),*/ qsl("1f64c"), 1226, EmojiCode(0x1f64c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raising hands: light skin tone"),*/ qsl("1f64c-1f3fb"), 1227, EmojiCode(0x1f64c, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raising hands: medium-light skin tone"),*/ qsl("1f64c-1f3fc"), 1228, EmojiCode(0x1f64c, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raising hands: medium skin tone"),*/ qsl("1f64c-1f3fd"), 1229, EmojiCode(0x1f64c, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raising hands: medium-dark skin tone"),*/ qsl("1f64c-1f3fe"), 1230, EmojiCode(0x1f64c, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raising hands: dark skin tone"),*/ qsl("1f64c-1f3ff"), 1231, EmojiCode(0x1f64c, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("clapping hands"),*/ qsl("1f44f"), 1232, EmojiCode(0x1f44f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("clapping hands: light skin tone"),*/ qsl("1f44f-1f3fb"), 1233, EmojiCode(0x1f44f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("clapping hands: medium-light skin tone"),*/ qsl("1f44f-1f3fc"), 1234, EmojiCode(0x1f44f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("clapping hands: medium skin tone"),*/ qsl("1f44f-1f3fd"), 1235, EmojiCode(0x1f44f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("clapping hands: medium-dark skin tone"),*/ qsl("1f44f-1f3fe"), 1236, EmojiCode(0x1f44f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("clapping hands: dark skin tone"),*/ qsl("1f44f-1f3ff"), 1237, EmojiCode(0x1f44f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("handshake"),*/ qsl("1f91d"), 1238, EmojiCode(0x1f91d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs up"),*/ qsl("1f44d"), 1239, EmojiCode(0x1f44d), EmojiCode(0x1f44d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs up: light skin tone"),*/ qsl("1f44d-1f3fb"), 1240, EmojiCode(0x1f44d, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs up: medium-light skin tone"),*/ qsl("1f44d-1f3fc"), 1241, EmojiCode(0x1f44d, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs up: medium skin tone"),*/ qsl("1f44d-1f3fd"), 1242, EmojiCode(0x1f44d, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs up: medium-dark skin tone"),*/ qsl("1f44d-1f3fe"), 1243, EmojiCode(0x1f44d, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs up: dark skin tone"),*/ qsl("1f44d-1f3ff"), 1244, EmojiCode(0x1f44d, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs down"),*/ qsl("1f44e"), 1245, EmojiCode(0x1f44e), EmojiCode(0x1f44e, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs down: light skin tone"),*/ qsl("1f44e-1f3fb"), 1246, EmojiCode(0x1f44e, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs down: medium-light skin tone"),*/ qsl("1f44e-1f3fc"), 1247, EmojiCode(0x1f44e, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs down: medium skin tone"),*/ qsl("1f44e-1f3fd"), 1248, EmojiCode(0x1f44e, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs down: medium-dark skin tone"),*/ qsl("1f44e-1f3fe"), 1249, EmojiCode(0x1f44e, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("thumbs down: dark skin tone"),*/ qsl("1f44e-1f3ff"), 1250, EmojiCode(0x1f44e, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("oncoming fist"),*/ qsl("1f44a"), 1251, EmojiCode(0x1f44a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("oncoming fist: light skin tone"),*/ qsl("1f44a-1f3fb"), 1252, EmojiCode(0x1f44a, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("oncoming fist: medium-light skin tone"),*/ qsl("1f44a-1f3fc"), 1253, EmojiCode(0x1f44a, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("oncoming fist: medium skin tone"),*/ qsl("1f44a-1f3fd"), 1254, EmojiCode(0x1f44a, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("oncoming fist: medium-dark skin tone"),*/ qsl("1f44a-1f3fe"), 1255, EmojiCode(0x1f44a, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("oncoming fist: dark skin tone"),*/ qsl("1f44a-1f3ff"), 1256, EmojiCode(0x1f44a, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised fist"),*/ qsl("270a"), 1257, EmojiCode(0x270a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised fist: light skin tone"),*/ qsl("270a-1f3fb"), 1258, EmojiCode(0x270a, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised fist: medium-light skin tone"),*/ qsl("270a-1f3fc"), 1259, EmojiCode(0x270a, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised fist: medium skin tone"),*/ qsl("270a-1f3fd"), 1260, EmojiCode(0x270a, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised fist: medium-dark skin tone"),*/ qsl("270a-1f3fe"), 1261, EmojiCode(0x270a, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised fist: dark skin tone"),*/ qsl("270a-1f3ff"), 1262, EmojiCode(0x270a, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("left-facing fist"),*/ qsl("1f91b"), 1263, EmojiCode(0x1f91b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("left-facing fist: light skin tone"),*/ qsl("1f91b-1f3fb"), 1264, EmojiCode(0x1f91b, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("left-facing fist: medium-light skin tone"),*/ qsl("1f91b-1f3fc"), 1265, EmojiCode(0x1f91b, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("left-facing fist: medium skin tone"),*/ qsl("1f91b-1f3fd"), 1266, EmojiCode(0x1f91b, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("left-facing fist: medium-dark skin tone"),*/ qsl("1f91b-1f3fe"), 1267, EmojiCode(0x1f91b, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("left-facing fist: dark skin tone"),*/ qsl("1f91b-1f3ff"), 1268, EmojiCode(0x1f91b, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("right-facing fist"),*/ qsl("1f91c"), 1269, EmojiCode(0x1f91c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("right-facing fist: light skin tone"),*/ qsl("1f91c-1f3fb"), 1270, EmojiCode(0x1f91c, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("right-facing fist: medium-light skin tone"),*/ qsl("1f91c-1f3fc"), 1271, EmojiCode(0x1f91c, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("right-facing fist: medium skin tone"),*/ qsl("1f91c-1f3fd"), 1272, EmojiCode(0x1f91c, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("right-facing fist: medium-dark skin tone"),*/ qsl("1f91c-1f3fe"), 1273, EmojiCode(0x1f91c, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("right-facing fist: dark skin tone"),*/ qsl("1f91c-1f3ff"), 1274, EmojiCode(0x1f91c, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("crossed fingers"),*/ qsl("1f91e"), 1275, EmojiCode(0x1f91e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("crossed fingers: light skin tone"),*/ qsl("1f91e-1f3fb"), 1276, EmojiCode(0x1f91e, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("crossed fingers: medium-light skin tone"),*/ qsl("1f91e-1f3fc"), 1277, EmojiCode(0x1f91e, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("crossed fingers: medium skin tone"),*/ qsl("1f91e-1f3fd"), 1278, EmojiCode(0x1f91e, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("crossed fingers: medium-dark skin tone"),*/ qsl("1f91e-1f3fe"), 1279, EmojiCode(0x1f91e, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("crossed fingers: dark skin tone"),*/ qsl("1f91e-1f3ff"), 1280, EmojiCode(0x1f91e, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("victory hand"),*/ qsl("270c"), 1281, EmojiCode(0x270c), EmojiCode(0x270c, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("victory hand: light skin tone"),*/ qsl("270c-1f3fb"), 1282, EmojiCode(0x270c, 0x1f3fb), EmojiCode(0x270c, 0xfe0f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("victory hand: medium-light skin tone"),*/ qsl("270c-1f3fc"), 1283, EmojiCode(0x270c, 0x1f3fc), EmojiCode(0x270c, 0xfe0f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("victory hand: medium skin tone"),*/ qsl("270c-1f3fd"), 1284, EmojiCode(0x270c, 0x1f3fd), EmojiCode(0x270c, 0xfe0f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("victory hand: medium-dark skin tone"),*/ qsl("270c-1f3fe"), 1285, EmojiCode(0x270c, 0x1f3fe), EmojiCode(0x270c, 0xfe0f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("victory hand: dark skin tone"),*/ qsl("270c-1f3ff"), 1286, EmojiCode(0x270c, 0x1f3ff), EmojiCode(0x270c, 0xfe0f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("love-you gesture"),*/ qsl("1f91f"), 1287, EmojiCode(0x1f91f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("love-you gesture: light skin tone"),*/ qsl("1f91f-1f3fb"), 1288, EmojiCode(0x1f91f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("love-you gesture: medium-light skin tone"),*/ qsl("1f91f-1f3fc"), 1289, EmojiCode(0x1f91f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("love-you gesture: medium skin tone"),*/ qsl("1f91f-1f3fd"), 1290, EmojiCode(0x1f91f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("love-you gesture: medium-dark skin tone"),*/ qsl("1f91f-1f3fe"), 1291, EmojiCode(0x1f91f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("love-you gesture: dark skin tone"),*/ qsl("1f91f-1f3ff"), 1292, EmojiCode(0x1f91f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sign of the horns"),*/ qsl("1f918"), 1293, EmojiCode(0x1f918)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sign of the horns: light skin tone"),*/ qsl("1f918-1f3fb"), 1294, EmojiCode(0x1f918, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sign of the horns: medium-light skin tone"),*/ qsl("1f918-1f3fc"), 1295, EmojiCode(0x1f918, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sign of the horns: medium skin tone"),*/ qsl("1f918-1f3fd"), 1296, EmojiCode(0x1f918, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sign of the horns: medium-dark skin tone"),*/ qsl("1f918-1f3fe"), 1297, EmojiCode(0x1f918, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sign of the horns: dark skin tone"),*/ qsl("1f918-1f3ff"), 1298, EmojiCode(0x1f918, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("OK hand"),*/ qsl("1f44c"), 1299, EmojiCode(0x1f44c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("OK hand: light skin tone"),*/ qsl("1f44c-1f3fb"), 1300, EmojiCode(0x1f44c, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("OK hand: medium-light skin tone"),*/ qsl("1f44c-1f3fc"), 1301, EmojiCode(0x1f44c, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("OK hand: medium skin tone"),*/ qsl("1f44c-1f3fd"), 1302, EmojiCode(0x1f44c, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("OK hand: medium-dark skin tone"),*/ qsl("1f44c-1f3fe"), 1303, EmojiCode(0x1f44c, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("OK hand: dark skin tone"),*/ qsl("1f44c-1f3ff"), 1304, EmojiCode(0x1f44c, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing left"),*/ qsl("1f448"), 1305, EmojiCode(0x1f448), EmojiCode(0x1f448, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing left: light skin tone"),*/ qsl("1f448-1f3fb"), 1306, EmojiCode(0x1f448, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing left: medium-light skin tone"),*/ qsl("1f448-1f3fc"), 1307, EmojiCode(0x1f448, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing left: medium skin tone"),*/ qsl("1f448-1f3fd"), 1308, EmojiCode(0x1f448, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing left: medium-dark skin tone"),*/ qsl("1f448-1f3fe"), 1309, EmojiCode(0x1f448, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing left: dark skin tone"),*/ qsl("1f448-1f3ff"), 1310, EmojiCode(0x1f448, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing right"),*/ qsl("1f449"), 1311, EmojiCode(0x1f449), EmojiCode(0x1f449, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing right: light skin tone"),*/ qsl("1f449-1f3fb"), 1312, EmojiCode(0x1f449, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing right: medium-light skin tone"),*/ qsl("1f449-1f3fc"), 1313, EmojiCode(0x1f449, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing right: medium skin tone"),*/ qsl("1f449-1f3fd"), 1314, EmojiCode(0x1f449, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing right: medium-dark skin tone"),*/ qsl("1f449-1f3fe"), 1315, EmojiCode(0x1f449, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing right: dark skin tone"),*/ qsl("1f449-1f3ff"), 1316, EmojiCode(0x1f449, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing up"),*/ qsl("1f446"), 1317, EmojiCode(0x1f446), EmojiCode(0x1f446, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing up: light skin tone"),*/ qsl("1f446-1f3fb"), 1318, EmojiCode(0x1f446, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing up: medium-light skin tone"),*/ qsl("1f446-1f3fc"), 1319, EmojiCode(0x1f446, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing up: medium skin tone"),*/ qsl("1f446-1f3fd"), 1320, EmojiCode(0x1f446, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing up: medium-dark skin tone"),*/ qsl("1f446-1f3fe"), 1321, EmojiCode(0x1f446, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing up: dark skin tone"),*/ qsl("1f446-1f3ff"), 1322, EmojiCode(0x1f446, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing down"),*/ qsl("1f447"), 1323, EmojiCode(0x1f447), EmojiCode(0x1f447, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing down: light skin tone"),*/ qsl("1f447-1f3fb"), 1324, EmojiCode(0x1f447, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing down: medium-light skin tone"),*/ qsl("1f447-1f3fc"), 1325, EmojiCode(0x1f447, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing down: medium skin tone"),*/ qsl("1f447-1f3fd"), 1326, EmojiCode(0x1f447, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing down: medium-dark skin tone"),*/ qsl("1f447-1f3fe"), 1327, EmojiCode(0x1f447, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("backhand index pointing down: dark skin tone"),*/ qsl("1f447-1f3ff"), 1328, EmojiCode(0x1f447, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("index pointing up"),*/ qsl("261d"), 1329, EmojiCode(0x261d), EmojiCode(0x261d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("index pointing up: light skin tone"),*/ qsl("261d-1f3fb"), 1330, EmojiCode(0x261d, 0x1f3fb), EmojiCode(0x261d, 0xfe0f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("index pointing up: medium-light skin tone"),*/ qsl("261d-1f3fc"), 1331, EmojiCode(0x261d, 0x1f3fc), EmojiCode(0x261d, 0xfe0f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("index pointing up: medium skin tone"),*/ qsl("261d-1f3fd"), 1332, EmojiCode(0x261d, 0x1f3fd), EmojiCode(0x261d, 0xfe0f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("index pointing up: medium-dark skin tone"),*/ qsl("261d-1f3fe"), 1333, EmojiCode(0x261d, 0x1f3fe), EmojiCode(0x261d, 0xfe0f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("index pointing up: dark skin tone"),*/ qsl("261d-1f3ff"), 1334, EmojiCode(0x261d, 0x1f3ff), EmojiCode(0x261d, 0xfe0f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised hand"),*/ qsl("270b"), 1335, EmojiCode(0x270b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised hand: light skin tone"),*/ qsl("270b-1f3fb"), 1336, EmojiCode(0x270b, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised hand: medium-light skin tone"),*/ qsl("270b-1f3fc"), 1337, EmojiCode(0x270b, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised hand: medium skin tone"),*/ qsl("270b-1f3fd"), 1338, EmojiCode(0x270b, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised hand: medium-dark skin tone"),*/ qsl("270b-1f3fe"), 1339, EmojiCode(0x270b, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised hand: dark skin tone"),*/ qsl("270b-1f3ff"), 1340, EmojiCode(0x270b, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised back of hand"),*/ qsl("1f91a"), 1341, EmojiCode(0x1f91a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised back of hand: light skin tone"),*/ qsl("1f91a-1f3fb"), 1342, EmojiCode(0x1f91a, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised back of hand: medium-light skin tone"),*/ qsl("1f91a-1f3fc"), 1343, EmojiCode(0x1f91a, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised back of hand: medium skin tone"),*/ qsl("1f91a-1f3fd"), 1344, EmojiCode(0x1f91a, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised back of hand: medium-dark skin tone"),*/ qsl("1f91a-1f3fe"), 1345, EmojiCode(0x1f91a, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("raised back of hand: dark skin tone"),*/ qsl("1f91a-1f3ff"), 1346, EmojiCode(0x1f91a, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("hand with fingers splayed"),*/ qsl("1f590"), 1347, EmojiCode(0x1f590), EmojiCode(0x1f590, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("hand with fingers splayed: light skin tone"),*/ qsl("1f590-1f3fb"), 1348, EmojiCode(0x1f590, 0x1f3fb), EmojiCode(0x1f590, 0xfe0f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("hand with fingers splayed: medium-light skin tone"),*/ qsl("1f590-1f3fc"), 1349, EmojiCode(0x1f590, 0x1f3fc), EmojiCode(0x1f590, 0xfe0f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("hand with fingers splayed: medium skin tone"),*/ qsl("1f590-1f3fd"), 1350, EmojiCode(0x1f590, 0x1f3fd), EmojiCode(0x1f590, 0xfe0f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("hand with fingers splayed: medium-dark skin tone"),*/ qsl("1f590-1f3fe"), 1351, EmojiCode(0x1f590, 0x1f3fe), EmojiCode(0x1f590, 0xfe0f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("hand with fingers splayed: dark skin tone"),*/ qsl("1f590-1f3ff"), 1352, EmojiCode(0x1f590, 0x1f3ff), EmojiCode(0x1f590, 0xfe0f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vulcan salute"),*/ qsl("1f596"), 1353, EmojiCode(0x1f596)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vulcan salute: light skin tone"),*/ qsl("1f596-1f3fb"), 1354, EmojiCode(0x1f596, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vulcan salute: medium-light skin tone"),*/ qsl("1f596-1f3fc"), 1355, EmojiCode(0x1f596, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vulcan salute: medium skin tone"),*/ qsl("1f596-1f3fd"), 1356, EmojiCode(0x1f596, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vulcan salute: medium-dark skin tone"),*/ qsl("1f596-1f3fe"), 1357, EmojiCode(0x1f596, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vulcan salute: dark skin tone"),*/ qsl("1f596-1f3ff"), 1358, EmojiCode(0x1f596, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("waving hand"),*/ qsl("1f44b"), 1359, EmojiCode(0x1f44b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("waving hand: light skin tone"),*/ qsl("1f44b-1f3fb"), 1360, EmojiCode(0x1f44b, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("waving hand: medium-light skin tone"),*/ qsl("1f44b-1f3fc"), 1361, EmojiCode(0x1f44b, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("waving hand: medium skin tone"),*/ qsl("1f44b-1f3fd"), 1362, EmojiCode(0x1f44b, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("waving hand: medium-dark skin tone"),*/ qsl("1f44b-1f3fe"), 1363, EmojiCode(0x1f44b, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("waving hand: dark skin tone"),*/ qsl("1f44b-1f3ff"), 1364, EmojiCode(0x1f44b, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("call me hand"),*/ qsl("1f919"), 1365, EmojiCode(0x1f919)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("call me hand: light skin tone"),*/ qsl("1f919-1f3fb"), 1366, EmojiCode(0x1f919, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("call me hand: medium-light skin tone"),*/ qsl("1f919-1f3fc"), 1367, EmojiCode(0x1f919, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("call me hand: medium skin tone"),*/ qsl("1f919-1f3fd"), 1368, EmojiCode(0x1f919, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("call me hand: medium-dark skin tone"),*/ qsl("1f919-1f3fe"), 1369, EmojiCode(0x1f919, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("call me hand: dark skin tone"),*/ qsl("1f919-1f3ff"), 1370, EmojiCode(0x1f919, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("flexed biceps"),*/ qsl("1f4aa"), 1371, EmojiCode(0x1f4aa)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("flexed biceps: light skin tone"),*/ qsl("1f4aa-1f3fb"), 1372, EmojiCode(0x1f4aa, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("flexed biceps: medium-light skin tone"),*/ qsl("1f4aa-1f3fc"), 1373, EmojiCode(0x1f4aa, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("flexed biceps: medium skin tone"),*/ qsl("1f4aa-1f3fd"), 1374, EmojiCode(0x1f4aa, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("flexed biceps: medium-dark skin tone"),*/ qsl("1f4aa-1f3fe"), 1375, EmojiCode(0x1f4aa, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("flexed biceps: dark skin tone"),*/ qsl("1f4aa-1f3ff"), 1376, EmojiCode(0x1f4aa, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("leg"),*/ qsl("1f9b5"), 1377, EmojiCode(0x1f9b5)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("leg: light skin tone"),*/ qsl("1f9b5-1f3fb"), 1378, EmojiCode(0x1f9b5, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("leg: medium-light skin tone"),*/ qsl("1f9b5-1f3fc"), 1379, EmojiCode(0x1f9b5, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("leg: medium skin tone"),*/ qsl("1f9b5-1f3fd"), 1380, EmojiCode(0x1f9b5, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("leg: medium-dark skin tone"),*/ qsl("1f9b5-1f3fe"), 1381, EmojiCode(0x1f9b5, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("leg: dark skin tone"),*/ qsl("1f9b5-1f3ff"), 1382, EmojiCode(0x1f9b5, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("foot"),*/ qsl("1f9b6"), 1383, EmojiCode(0x1f9b6)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("foot: light skin tone"),*/ qsl("1f9b6-1f3fb"), 1384, EmojiCode(0x1f9b6, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("foot: medium-light skin tone"),*/ qsl("1f9b6-1f3fc"), 1385, EmojiCode(0x1f9b6, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("foot: medium skin tone"),*/ qsl("1f9b6-1f3fd"), 1386, EmojiCode(0x1f9b6, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("foot: medium-dark skin tone"),*/ qsl("1f9b6-1f3fe"), 1387, EmojiCode(0x1f9b6, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("foot: dark skin tone"),*/ qsl("1f9b6-1f3ff"), 1388, EmojiCode(0x1f9b6, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("middle finger"),*/ qsl("1f595"), 1389, EmojiCode(0x1f595)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("middle finger: light skin tone"),*/ qsl("1f595-1f3fb"), 1390, EmojiCode(0x1f595, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("middle finger: medium-light skin tone"),*/ qsl("1f595-1f3fc"), 1391, EmojiCode(0x1f595, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("middle finger: medium skin tone"),*/ qsl("1f595-1f3fd"), 1392, EmojiCode(0x1f595, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("middle finger: medium-dark skin tone"),*/ qsl("1f595-1f3fe"), 1393, EmojiCode(0x1f595, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("middle finger: dark skin tone"),*/ qsl("1f595-1f3ff"), 1394, EmojiCode(0x1f595, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("writing hand"),*/ qsl("270d"), 1395, EmojiCode(0x270d), EmojiCode(0x270d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("writing hand: light skin tone"),*/ qsl("270d-1f3fb"), 1396, EmojiCode(0x270d, 0x1f3fb), EmojiCode(0x270d, 0xfe0f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("writing hand: medium-light skin tone"),*/ qsl("270d-1f3fc"), 1397, EmojiCode(0x270d, 0x1f3fc), EmojiCode(0x270d, 0xfe0f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("writing hand: medium skin tone"),*/ qsl("270d-1f3fd"), 1398, EmojiCode(0x270d, 0x1f3fd), EmojiCode(0x270d, 0xfe0f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("writing hand: medium-dark skin tone"),*/ qsl("270d-1f3fe"), 1399, EmojiCode(0x270d, 0x1f3fe), EmojiCode(0x270d, 0xfe0f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("writing hand: dark skin tone"),*/ qsl("270d-1f3ff"), 1400, EmojiCode(0x270d, 0x1f3ff), EmojiCode(0x270d, 0xfe0f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("folded hands"),*/ qsl("1f64f"), 1401, EmojiCode(0x1f64f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("folded hands: light skin tone"),*/ qsl("1f64f-1f3fb"), 1402, EmojiCode(0x1f64f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("folded hands: medium-light skin tone"),*/ qsl("1f64f-1f3fc"), 1403, EmojiCode(0x1f64f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("folded hands: medium skin tone"),*/ qsl("1f64f-1f3fd"), 1404, EmojiCode(0x1f64f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("folded hands: medium-dark skin tone"),*/ qsl("1f64f-1f3fe"), 1405, EmojiCode(0x1f64f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("folded hands: dark skin tone"),*/ qsl("1f64f-1f3ff"), 1406, EmojiCode(0x1f64f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("ring"),*/ qsl("1f48d"), 1407, EmojiCode(0x1f48d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("lipstick"),*/ qsl("1f484"), 1408, EmojiCode(0x1f484)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("kiss mark"),*/ qsl("1f48b"), 1409, EmojiCode(0x1f48b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mouth"),*/ qsl("1f444"), 1410, EmojiCode(0x1f444)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("tongue"),*/ qsl("1f445"), 1411, EmojiCode(0x1f445)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("ear"),*/ qsl("1f442"), 1412, EmojiCode(0x1f442), EmojiCode(0x1f442, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("ear: light skin tone"),*/ qsl("1f442-1f3fb"), 1413, EmojiCode(0x1f442, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("ear: medium-light skin tone"),*/ qsl("1f442-1f3fc"), 1414, EmojiCode(0x1f442, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("ear: medium skin tone"),*/ qsl("1f442-1f3fd"), 1415, EmojiCode(0x1f442, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("ear: medium-dark skin tone"),*/ qsl("1f442-1f3fe"), 1416, EmojiCode(0x1f442, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("ear: dark skin tone"),*/ qsl("1f442-1f3ff"), 1417, EmojiCode(0x1f442, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nose"),*/ qsl("1f443"), 1418, EmojiCode(0x1f443)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nose: light skin tone"),*/ qsl("1f443-1f3fb"), 1419, EmojiCode(0x1f443, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nose: medium-light skin tone"),*/ qsl("1f443-1f3fc"), 1420, EmojiCode(0x1f443, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nose: medium skin tone"),*/ qsl("1f443-1f3fd"), 1421, EmojiCode(0x1f443, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nose: medium-dark skin tone"),*/ qsl("1f443-1f3fe"), 1422, EmojiCode(0x1f443, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nose: dark skin tone"),*/ qsl("1f443-1f3ff"), 1423, EmojiCode(0x1f443, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("footprints"),*/ qsl("1f463"), 1424, EmojiCode(0x1f463)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("eye"),*/ qsl("1f441"), 1425, EmojiCode(0x1f441), EmojiCode(0x1f441, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("eyes"),*/ qsl("1f440"), 1426, EmojiCode(0x1f440)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("brain"),*/ qsl("1f9e0"), 1427, EmojiCode(0x1f9e0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bone"),*/ qsl("1f9b4"), 1428, EmojiCode(0x1f9b4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("tooth"),*/ qsl("1f9b7"), 1429, EmojiCode(0x1f9b7)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("speaking head"),*/ qsl("1f5e3"), 1430, EmojiCode(0x1f5e3), EmojiCode(0x1f5e3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bust in silhouette"),*/ qsl("1f464"), 1431, EmojiCode(0x1f464)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("busts in silhouette"),*/ qsl("1f465"), 1432, EmojiCode(0x1f465)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby"),*/ qsl("1f476"), 1433, EmojiCode(0x1f476)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby: light skin tone"),*/ qsl("1f476-1f3fb"), 1434, EmojiCode(0x1f476, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby: medium-light skin tone"),*/ qsl("1f476-1f3fc"), 1435, EmojiCode(0x1f476, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby: medium skin tone"),*/ qsl("1f476-1f3fd"), 1436, EmojiCode(0x1f476, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby: medium-dark skin tone"),*/ qsl("1f476-1f3fe"), 1437, EmojiCode(0x1f476, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby: dark skin tone"),*/ qsl("1f476-1f3ff"), 1438, EmojiCode(0x1f476, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("girl"),*/ qsl("1f467"), 1439, EmojiCode(0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("girl: light skin tone"),*/ qsl("1f467-1f3fb"), 1440, EmojiCode(0x1f467, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("girl: medium-light skin tone"),*/ qsl("1f467-1f3fc"), 1441, EmojiCode(0x1f467, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("girl: medium skin tone"),*/ qsl("1f467-1f3fd"), 1442, EmojiCode(0x1f467, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("girl: medium-dark skin tone"),*/ qsl("1f467-1f3fe"), 1443, EmojiCode(0x1f467, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("girl: dark skin tone"),*/ qsl("1f467-1f3ff"), 1444, EmojiCode(0x1f467, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("child"),*/ qsl("1f9d2"), 1445, EmojiCode(0x1f9d2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("child: light skin tone"),*/ qsl("1f9d2-1f3fb"), 1446, EmojiCode(0x1f9d2, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("child: medium-light skin tone"),*/ qsl("1f9d2-1f3fc"), 1447, EmojiCode(0x1f9d2, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("child: medium skin tone"),*/ qsl("1f9d2-1f3fd"), 1448, EmojiCode(0x1f9d2, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("child: medium-dark skin tone"),*/ qsl("1f9d2-1f3fe"), 1449, EmojiCode(0x1f9d2, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("child: dark skin tone"),*/ qsl("1f9d2-1f3ff"), 1450, EmojiCode(0x1f9d2, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("boy"),*/ qsl("1f466"), 1451, EmojiCode(0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("boy: light skin tone"),*/ qsl("1f466-1f3fb"), 1452, EmojiCode(0x1f466, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("boy: medium-light skin tone"),*/ qsl("1f466-1f3fc"), 1453, EmojiCode(0x1f466, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("boy: medium skin tone"),*/ qsl("1f466-1f3fd"), 1454, EmojiCode(0x1f466, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("boy: medium-dark skin tone"),*/ qsl("1f466-1f3fe"), 1455, EmojiCode(0x1f466, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("boy: dark skin tone"),*/ qsl("1f466-1f3ff"), 1456, EmojiCode(0x1f466, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman"),*/ qsl("1f469"), 1457, EmojiCode(0x1f469)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman: light skin tone"),*/ qsl("1f469-1f3fb"), 1458, EmojiCode(0x1f469, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman: medium-light skin tone"),*/ qsl("1f469-1f3fc"), 1459, EmojiCode(0x1f469, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman: medium skin tone"),*/ qsl("1f469-1f3fd"), 1460, EmojiCode(0x1f469, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman: medium-dark skin tone"),*/ qsl("1f469-1f3fe"), 1461, EmojiCode(0x1f469, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman: dark skin tone"),*/ qsl("1f469-1f3ff"), 1462, EmojiCode(0x1f469, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("adult"),*/ qsl("1f9d1"), 1463, EmojiCode(0x1f9d1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("adult: light skin tone"),*/ qsl("1f9d1-1f3fb"), 1464, EmojiCode(0x1f9d1, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("adult: medium-light skin tone"),*/ qsl("1f9d1-1f3fc"), 1465, EmojiCode(0x1f9d1, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("adult: medium skin tone"),*/ qsl("1f9d1-1f3fd"), 1466, EmojiCode(0x1f9d1, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("adult: medium-dark skin tone"),*/ qsl("1f9d1-1f3fe"), 1467, EmojiCode(0x1f9d1, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("adult: dark skin tone"),*/ qsl("1f9d1-1f3ff"), 1468, EmojiCode(0x1f9d1, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man"),*/ qsl("1f468"), 1469, EmojiCode(0x1f468)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man: light skin tone"),*/ qsl("1f468-1f3fb"), 1470, EmojiCode(0x1f468, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man: medium-light skin tone"),*/ qsl("1f468-1f3fc"), 1471, EmojiCode(0x1f468, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man: medium skin tone"),*/ qsl("1f468-1f3fd"), 1472, EmojiCode(0x1f468, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man: medium-dark skin tone"),*/ qsl("1f468-1f3fe"), 1473, EmojiCode(0x1f468, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man: dark skin tone"),*/ qsl("1f468-1f3ff"), 1474, EmojiCode(0x1f468, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired person"),*/ qsl("1f471"), 1475, EmojiCode(0x1f471)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired person: light skin tone"),*/ qsl("1f471-1f3fb"), 1476, EmojiCode(0x1f471, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired person: medium-light skin tone"),*/ qsl("1f471-1f3fc"), 1477, EmojiCode(0x1f471, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired person: medium skin tone"),*/ qsl("1f471-1f3fd"), 1478, EmojiCode(0x1f471, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired person: medium-dark skin tone"),*/ qsl("1f471-1f3fe"), 1479, EmojiCode(0x1f471, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired person: dark skin tone"),*/ qsl("1f471-1f3ff"), 1480, EmojiCode(0x1f471, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired woman"),*/ qsl("1f471-2640"), 1481, EmojiCode(0x1f471, 0x2640), EmojiCode(0x1f471, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired woman: light skin tone"),*/ qsl("1f471-1f3fb-2640"), 1482, EmojiCode(0x1f471, 0x1f3fb, 0x2640), EmojiCode(0x1f471, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired woman: medium-light skin tone"),*/ qsl("1f471-1f3fc-2640"), 1483, EmojiCode(0x1f471, 0x1f3fc, 0x2640), EmojiCode(0x1f471, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired woman: medium skin tone"),*/ qsl("1f471-1f3fd-2640"), 1484, EmojiCode(0x1f471, 0x1f3fd, 0x2640), EmojiCode(0x1f471, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired woman: medium-dark skin tone"),*/ qsl("1f471-1f3fe-2640"), 1485, EmojiCode(0x1f471, 0x1f3fe, 0x2640), EmojiCode(0x1f471, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired woman: dark skin tone"),*/ qsl("1f471-1f3ff-2640"), 1486, EmojiCode(0x1f471, 0x1f3ff, 0x2640), EmojiCode(0x1f471, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired man"),*/ qsl("1f471-2642"), 1487, EmojiCode(0x1f471, 0x2642), EmojiCode(0x1f471, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired man: light skin tone"),*/ qsl("1f471-1f3fb-2642"), 1488, EmojiCode(0x1f471, 0x1f3fb, 0x2642), EmojiCode(0x1f471, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired man: medium-light skin tone"),*/ qsl("1f471-1f3fc-2642"), 1489, EmojiCode(0x1f471, 0x1f3fc, 0x2642), EmojiCode(0x1f471, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired man: medium skin tone"),*/ qsl("1f471-1f3fd-2642"), 1490, EmojiCode(0x1f471, 0x1f3fd, 0x2642), EmojiCode(0x1f471, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired man: medium-dark skin tone"),*/ qsl("1f471-1f3fe-2642"), 1491, EmojiCode(0x1f471, 0x1f3fe, 0x2642), EmojiCode(0x1f471, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("blond-haired man: dark skin tone"),*/ qsl("1f471-1f3ff-2642"), 1492, EmojiCode(0x1f471, 0x1f3ff, 0x2642), EmojiCode(0x1f471, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, red haired"),*/ qsl("1f469-1f9b0"), 1493, EmojiCode(0x1f469, 0x1f9b0), EmojiCode(0x1f469, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, red haired: light skin tone"),*/ qsl("1f469-1f3fb-1f9b0"), 1494, EmojiCode(0x1f469, 0x1f3fb, 0x1f9b0), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, red haired: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f9b0"), 1495, EmojiCode(0x1f469, 0x1f3fc, 0x1f9b0), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, red haired: medium skin tone"),*/ qsl("1f469-1f3fd-1f9b0"), 1496, EmojiCode(0x1f469, 0x1f3fd, 0x1f9b0), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, red haired: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f9b0"), 1497, EmojiCode(0x1f469, 0x1f3fe, 0x1f9b0), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, red haired: dark skin tone"),*/ qsl("1f469-1f3ff-1f9b0"), 1498, EmojiCode(0x1f469, 0x1f3ff, 0x1f9b0), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, red haired"),*/ qsl("1f468-1f9b0"), 1499, EmojiCode(0x1f468, 0x1f9b0), EmojiCode(0x1f468, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, red haired: light skin tone"),*/ qsl("1f468-1f3fb-1f9b0"), 1500, EmojiCode(0x1f468, 0x1f3fb, 0x1f9b0), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, red haired: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f9b0"), 1501, EmojiCode(0x1f468, 0x1f3fc, 0x1f9b0), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, red haired: medium skin tone"),*/ qsl("1f468-1f3fd-1f9b0"), 1502, EmojiCode(0x1f468, 0x1f3fd, 0x1f9b0), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, red haired: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f9b0"), 1503, EmojiCode(0x1f468, 0x1f3fe, 0x1f9b0), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, red haired: dark skin tone"),*/ qsl("1f468-1f3ff-1f9b0"), 1504, EmojiCode(0x1f468, 0x1f3ff, 0x1f9b0), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, curly haired"),*/ qsl("1f469-1f9b1"), 1505, EmojiCode(0x1f469, 0x1f9b1), EmojiCode(0x1f469, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, curly haired: light skin tone"),*/ qsl("1f469-1f3fb-1f9b1"), 1506, EmojiCode(0x1f469, 0x1f3fb, 0x1f9b1), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, curly haired: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f9b1"), 1507, EmojiCode(0x1f469, 0x1f3fc, 0x1f9b1), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, curly haired: medium skin tone"),*/ qsl("1f469-1f3fd-1f9b1"), 1508, EmojiCode(0x1f469, 0x1f3fd, 0x1f9b1), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, curly haired: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f9b1"), 1509, EmojiCode(0x1f469, 0x1f3fe, 0x1f9b1), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, curly haired: dark skin tone"),*/ qsl("1f469-1f3ff-1f9b1"), 1510, EmojiCode(0x1f469, 0x1f3ff, 0x1f9b1), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, curly haired"),*/ qsl("1f468-1f9b1"), 1511, EmojiCode(0x1f468, 0x1f9b1), EmojiCode(0x1f468, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, curly haired: light skin tone"),*/ qsl("1f468-1f3fb-1f9b1"), 1512, EmojiCode(0x1f468, 0x1f3fb, 0x1f9b1), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, curly haired: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f9b1"), 1513, EmojiCode(0x1f468, 0x1f3fc, 0x1f9b1), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, curly haired: medium skin tone"),*/ qsl("1f468-1f3fd-1f9b1"), 1514, EmojiCode(0x1f468, 0x1f3fd, 0x1f9b1), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, curly haired: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f9b1"), 1515, EmojiCode(0x1f468, 0x1f3fe, 0x1f9b1), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, curly haired: dark skin tone"),*/ qsl("1f468-1f3ff-1f9b1"), 1516, EmojiCode(0x1f468, 0x1f3ff, 0x1f9b1), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, white haired"),*/ qsl("1f469-1f9b3"), 1517, EmojiCode(0x1f469, 0x1f9b3), EmojiCode(0x1f469, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, white haired: light skin tone"),*/ qsl("1f469-1f3fb-1f9b3"), 1518, EmojiCode(0x1f469, 0x1f3fb, 0x1f9b3), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, white haired: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f9b3"), 1519, EmojiCode(0x1f469, 0x1f3fc, 0x1f9b3), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, white haired: medium skin tone"),*/ qsl("1f469-1f3fd-1f9b3"), 1520, EmojiCode(0x1f469, 0x1f3fd, 0x1f9b3), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, white haired: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f9b3"), 1521, EmojiCode(0x1f469, 0x1f3fe, 0x1f9b3), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, white haired: dark skin tone"),*/ qsl("1f469-1f3ff-1f9b3"), 1522, EmojiCode(0x1f469, 0x1f3ff, 0x1f9b3), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, white haired"),*/ qsl("1f468-1f9b3"), 1523, EmojiCode(0x1f468, 0x1f9b3), EmojiCode(0x1f468, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, white haired: light skin tone"),*/ qsl("1f468-1f3fb-1f9b3"), 1524, EmojiCode(0x1f468, 0x1f3fb, 0x1f9b3), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, white haired: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f9b3"), 1525, EmojiCode(0x1f468, 0x1f3fc, 0x1f9b3), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, white haired: medium skin tone"),*/ qsl("1f468-1f3fd-1f9b3"), 1526, EmojiCode(0x1f468, 0x1f3fd, 0x1f9b3), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, white haired: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f9b3"), 1527, EmojiCode(0x1f468, 0x1f3fe, 0x1f9b3), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, white haired: dark skin tone"),*/ qsl("1f468-1f3ff-1f9b3"), 1528, EmojiCode(0x1f468, 0x1f3ff, 0x1f9b3), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, bald"),*/ qsl("1f469-1f9b2"), 1529, EmojiCode(0x1f469, 0x1f9b2), EmojiCode(0x1f469, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, bald: light skin tone"),*/ qsl("1f469-1f3fb-1f9b2"), 1530, EmojiCode(0x1f469, 0x1f3fb, 0x1f9b2), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, bald: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f9b2"), 1531, EmojiCode(0x1f469, 0x1f3fc, 0x1f9b2), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, bald: medium skin tone"),*/ qsl("1f469-1f3fd-1f9b2"), 1532, EmojiCode(0x1f469, 0x1f3fd, 0x1f9b2), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, bald: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f9b2"), 1533, EmojiCode(0x1f469, 0x1f3fe, 0x1f9b2), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman, bald: dark skin tone"),*/ qsl("1f469-1f3ff-1f9b2"), 1534, EmojiCode(0x1f469, 0x1f3ff, 0x1f9b2), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, bald"),*/ qsl("1f468-1f9b2"), 1535, EmojiCode(0x1f468, 0x1f9b2), EmojiCode(0x1f468, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, bald: light skin tone"),*/ qsl("1f468-1f3fb-1f9b2"), 1536, EmojiCode(0x1f468, 0x1f3fb, 0x1f9b2), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, bald: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f9b2"), 1537, EmojiCode(0x1f468, 0x1f3fc, 0x1f9b2), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, bald: medium skin tone"),*/ qsl("1f468-1f3fd-1f9b2"), 1538, EmojiCode(0x1f468, 0x1f3fd, 0x1f9b2), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, bald: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f9b2"), 1539, EmojiCode(0x1f468, 0x1f3fe, 0x1f9b2), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man, bald: dark skin tone"),*/ qsl("1f468-1f3ff-1f9b2"), 1540, EmojiCode(0x1f468, 0x1f3ff, 0x1f9b2), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bearded person"),*/ qsl("1f9d4"), 1541, EmojiCode(0x1f9d4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bearded person: light skin tone"),*/ qsl("1f9d4-1f3fb"), 1542, EmojiCode(0x1f9d4, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bearded person: medium-light skin tone"),*/ qsl("1f9d4-1f3fc"), 1543, EmojiCode(0x1f9d4, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bearded person: medium skin tone"),*/ qsl("1f9d4-1f3fd"), 1544, EmojiCode(0x1f9d4, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bearded person: medium-dark skin tone"),*/ qsl("1f9d4-1f3fe"), 1545, EmojiCode(0x1f9d4, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bearded person: dark skin tone"),*/ qsl("1f9d4-1f3ff"), 1546, EmojiCode(0x1f9d4, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old woman"),*/ qsl("1f475"), 1547, EmojiCode(0x1f475)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old woman: light skin tone"),*/ qsl("1f475-1f3fb"), 1548, EmojiCode(0x1f475, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old woman: medium-light skin tone"),*/ qsl("1f475-1f3fc"), 1549, EmojiCode(0x1f475, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old woman: medium skin tone"),*/ qsl("1f475-1f3fd"), 1550, EmojiCode(0x1f475, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old woman: medium-dark skin tone"),*/ qsl("1f475-1f3fe"), 1551, EmojiCode(0x1f475, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old woman: dark skin tone"),*/ qsl("1f475-1f3ff"), 1552, EmojiCode(0x1f475, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("older adult"),*/ qsl("1f9d3"), 1553, EmojiCode(0x1f9d3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("older adult: light skin tone"),*/ qsl("1f9d3-1f3fb"), 1554, EmojiCode(0x1f9d3, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("older adult: medium-light skin tone"),*/ qsl("1f9d3-1f3fc"), 1555, EmojiCode(0x1f9d3, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("older adult: medium skin tone"),*/ qsl("1f9d3-1f3fd"), 1556, EmojiCode(0x1f9d3, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("older adult: medium-dark skin tone"),*/ qsl("1f9d3-1f3fe"), 1557, EmojiCode(0x1f9d3, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("older adult: dark skin tone"),*/ qsl("1f9d3-1f3ff"), 1558, EmojiCode(0x1f9d3, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old man"),*/ qsl("1f474"), 1559, EmojiCode(0x1f474)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old man: light skin tone"),*/ qsl("1f474-1f3fb"), 1560, EmojiCode(0x1f474, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old man: medium-light skin tone"),*/ qsl("1f474-1f3fc"), 1561, EmojiCode(0x1f474, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old man: medium skin tone"),*/ qsl("1f474-1f3fd"), 1562, EmojiCode(0x1f474, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old man: medium-dark skin tone"),*/ qsl("1f474-1f3fe"), 1563, EmojiCode(0x1f474, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("old man: dark skin tone"),*/ qsl("1f474-1f3ff"), 1564, EmojiCode(0x1f474, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man with Chinese cap"),*/ qsl("1f472"), 1565, EmojiCode(0x1f472)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man with Chinese cap: light skin tone"),*/ qsl("1f472-1f3fb"), 1566, EmojiCode(0x1f472, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man with Chinese cap: medium-light skin tone"),*/ qsl("1f472-1f3fc"), 1567, EmojiCode(0x1f472, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man with Chinese cap: medium skin tone"),*/ qsl("1f472-1f3fd"), 1568, EmojiCode(0x1f472, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man with Chinese cap: medium-dark skin tone"),*/ qsl("1f472-1f3fe"), 1569, EmojiCode(0x1f472, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man with Chinese cap: dark skin tone"),*/ qsl("1f472-1f3ff"), 1570, EmojiCode(0x1f472, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person wearing turban"),*/ qsl("1f473"), 1571, EmojiCode(0x1f473)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person wearing turban: light skin tone"),*/ qsl("1f473-1f3fb"), 1572, EmojiCode(0x1f473, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person wearing turban: medium-light skin tone"),*/ qsl("1f473-1f3fc"), 1573, EmojiCode(0x1f473, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person wearing turban: medium skin tone"),*/ qsl("1f473-1f3fd"), 1574, EmojiCode(0x1f473, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person wearing turban: medium-dark skin tone"),*/ qsl("1f473-1f3fe"), 1575, EmojiCode(0x1f473, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person wearing turban: dark skin tone"),*/ qsl("1f473-1f3ff"), 1576, EmojiCode(0x1f473, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman wearing turban"),*/ qsl("1f473-2640"), 1577, EmojiCode(0x1f473, 0x2640), EmojiCode(0x1f473, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman wearing turban: light skin tone"),*/ qsl("1f473-1f3fb-2640"), 1578, EmojiCode(0x1f473, 0x1f3fb, 0x2640), EmojiCode(0x1f473, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman wearing turban: medium-light skin tone"),*/ qsl("1f473-1f3fc-2640"), 1579, EmojiCode(0x1f473, 0x1f3fc, 0x2640), EmojiCode(0x1f473, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman wearing turban: medium skin tone"),*/ qsl("1f473-1f3fd-2640"), 1580, EmojiCode(0x1f473, 0x1f3fd, 0x2640), EmojiCode(0x1f473, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman wearing turban: medium-dark skin tone"),*/ qsl("1f473-1f3fe-2640"), 1581, EmojiCode(0x1f473, 0x1f3fe, 0x2640), EmojiCode(0x1f473, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman wearing turban: dark skin tone"),*/ qsl("1f473-1f3ff-2640"), 1582, EmojiCode(0x1f473, 0x1f3ff, 0x2640), EmojiCode(0x1f473, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man wearing turban"),*/ qsl("1f473-2642"), 1583, EmojiCode(0x1f473, 0x2642), EmojiCode(0x1f473, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man wearing turban: light skin tone"),*/ qsl("1f473-1f3fb-2642"), 1584, EmojiCode(0x1f473, 0x1f3fb, 0x2642), EmojiCode(0x1f473, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man wearing turban: medium-light skin tone"),*/ qsl("1f473-1f3fc-2642"), 1585, EmojiCode(0x1f473, 0x1f3fc, 0x2642), EmojiCode(0x1f473, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man wearing turban: medium skin tone"),*/ qsl("1f473-1f3fd-2642"), 1586, EmojiCode(0x1f473, 0x1f3fd, 0x2642), EmojiCode(0x1f473, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man wearing turban: medium-dark skin tone"),*/ qsl("1f473-1f3fe-2642"), 1587, EmojiCode(0x1f473, 0x1f3fe, 0x2642), EmojiCode(0x1f473, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man wearing turban: dark skin tone"),*/ qsl("1f473-1f3ff-2642"), 1588, EmojiCode(0x1f473, 0x1f3ff, 0x2642), EmojiCode(0x1f473, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman with headscarf"),*/ qsl("1f9d5"), 1589, EmojiCode(0x1f9d5)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman with headscarf: light skin tone"),*/ qsl("1f9d5-1f3fb"), 1590, EmojiCode(0x1f9d5, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman with headscarf: medium-light skin tone"),*/ qsl("1f9d5-1f3fc"), 1591, EmojiCode(0x1f9d5, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman with headscarf: medium skin tone"),*/ qsl("1f9d5-1f3fd"), 1592, EmojiCode(0x1f9d5, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman with headscarf: medium-dark skin tone"),*/ qsl("1f9d5-1f3fe"), 1593, EmojiCode(0x1f9d5, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman with headscarf: dark skin tone"),*/ qsl("1f9d5-1f3ff"), 1594, EmojiCode(0x1f9d5, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("police officer"),*/ qsl("1f46e"), 1595, EmojiCode(0x1f46e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("police officer: light skin tone"),*/ qsl("1f46e-1f3fb"), 1596, EmojiCode(0x1f46e, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("police officer: medium-light skin tone"),*/ qsl("1f46e-1f3fc"), 1597, EmojiCode(0x1f46e, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("police officer: medium skin tone"),*/ qsl("1f46e-1f3fd"), 1598, EmojiCode(0x1f46e, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("police officer: medium-dark skin tone"),*/ qsl("1f46e-1f3fe"), 1599, EmojiCode(0x1f46e, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("police officer: dark skin tone"),*/ qsl("1f46e-1f3ff"), 1600, EmojiCode(0x1f46e, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman police officer"),*/ qsl("1f46e-2640"), 1601, EmojiCode(0x1f46e, 0x2640), EmojiCode(0x1f46e, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman police officer: light skin tone"),*/ qsl("1f46e-1f3fb-2640"), 1602, EmojiCode(0x1f46e, 0x1f3fb, 0x2640), EmojiCode(0x1f46e, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman police officer: medium-light skin tone"),*/ qsl("1f46e-1f3fc-2640"), 1603, EmojiCode(0x1f46e, 0x1f3fc, 0x2640), EmojiCode(0x1f46e, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman police officer: medium skin tone"),*/ qsl("1f46e-1f3fd-2640"), 1604, EmojiCode(0x1f46e, 0x1f3fd, 0x2640), EmojiCode(0x1f46e, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman police officer: medium-dark skin tone"),*/ qsl("1f46e-1f3fe-2640"), 1605, EmojiCode(0x1f46e, 0x1f3fe, 0x2640), EmojiCode(0x1f46e, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman police officer: dark skin tone"),*/ qsl("1f46e-1f3ff-2640"), 1606, EmojiCode(0x1f46e, 0x1f3ff, 0x2640), EmojiCode(0x1f46e, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man police officer"),*/ qsl("1f46e-2642"), 1607, EmojiCode(0x1f46e, 0x2642), EmojiCode(0x1f46e, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man police officer: light skin tone"),*/ qsl("1f46e-1f3fb-2642"), 1608, EmojiCode(0x1f46e, 0x1f3fb, 0x2642), EmojiCode(0x1f46e, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man police officer: medium-light skin tone"),*/ qsl("1f46e-1f3fc-2642"), 1609, EmojiCode(0x1f46e, 0x1f3fc, 0x2642), EmojiCode(0x1f46e, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man police officer: medium skin tone"),*/ qsl("1f46e-1f3fd-2642"), 1610, EmojiCode(0x1f46e, 0x1f3fd, 0x2642), EmojiCode(0x1f46e, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man police officer: medium-dark skin tone"),*/ qsl("1f46e-1f3fe-2642"), 1611, EmojiCode(0x1f46e, 0x1f3fe, 0x2642), EmojiCode(0x1f46e, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man police officer: dark skin tone"),*/ qsl("1f46e-1f3ff-2642"), 1612, EmojiCode(0x1f46e, 0x1f3ff, 0x2642), EmojiCode(0x1f46e, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("construction worker"),*/ qsl("1f477"), 1613, EmojiCode(0x1f477)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("construction worker: light skin tone"),*/ qsl("1f477-1f3fb"), 1614, EmojiCode(0x1f477, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("construction worker: medium-light skin tone"),*/ qsl("1f477-1f3fc"), 1615, EmojiCode(0x1f477, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("construction worker: medium skin tone"),*/ qsl("1f477-1f3fd"), 1616, EmojiCode(0x1f477, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("construction worker: medium-dark skin tone"),*/ qsl("1f477-1f3fe"), 1617, EmojiCode(0x1f477, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("construction worker: dark skin tone"),*/ qsl("1f477-1f3ff"), 1618, EmojiCode(0x1f477, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman construction worker"),*/ qsl("1f477-2640"), 1619, EmojiCode(0x1f477, 0x2640), EmojiCode(0x1f477, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman construction worker: light skin tone"),*/ qsl("1f477-1f3fb-2640"), 1620, EmojiCode(0x1f477, 0x1f3fb, 0x2640), EmojiCode(0x1f477, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman construction worker: medium-light skin tone"),*/ qsl("1f477-1f3fc-2640"), 1621, EmojiCode(0x1f477, 0x1f3fc, 0x2640), EmojiCode(0x1f477, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman construction worker: medium skin tone"),*/ qsl("1f477-1f3fd-2640"), 1622, EmojiCode(0x1f477, 0x1f3fd, 0x2640), EmojiCode(0x1f477, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman construction worker: medium-dark skin tone"),*/ qsl("1f477-1f3fe-2640"), 1623, EmojiCode(0x1f477, 0x1f3fe, 0x2640), EmojiCode(0x1f477, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman construction worker: dark skin tone"),*/ qsl("1f477-1f3ff-2640"), 1624, EmojiCode(0x1f477, 0x1f3ff, 0x2640), EmojiCode(0x1f477, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man construction worker"),*/ qsl("1f477-2642"), 1625, EmojiCode(0x1f477, 0x2642), EmojiCode(0x1f477, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man construction worker: light skin tone"),*/ qsl("1f477-1f3fb-2642"), 1626, EmojiCode(0x1f477, 0x1f3fb, 0x2642), EmojiCode(0x1f477, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man construction worker: medium-light skin tone"),*/ qsl("1f477-1f3fc-2642"), 1627, EmojiCode(0x1f477, 0x1f3fc, 0x2642), EmojiCode(0x1f477, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man construction worker: medium skin tone"),*/ qsl("1f477-1f3fd-2642"), 1628, EmojiCode(0x1f477, 0x1f3fd, 0x2642), EmojiCode(0x1f477, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man construction worker: medium-dark skin tone"),*/ qsl("1f477-1f3fe-2642"), 1629, EmojiCode(0x1f477, 0x1f3fe, 0x2642), EmojiCode(0x1f477, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man construction worker: dark skin tone"),*/ qsl("1f477-1f3ff-2642"), 1630, EmojiCode(0x1f477, 0x1f3ff, 0x2642), EmojiCode(0x1f477, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("guard"),*/ qsl("1f482"), 1631, EmojiCode(0x1f482)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("guard: light skin tone"),*/ qsl("1f482-1f3fb"), 1632, EmojiCode(0x1f482, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("guard: medium-light skin tone"),*/ qsl("1f482-1f3fc"), 1633, EmojiCode(0x1f482, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("guard: medium skin tone"),*/ qsl("1f482-1f3fd"), 1634, EmojiCode(0x1f482, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("guard: medium-dark skin tone"),*/ qsl("1f482-1f3fe"), 1635, EmojiCode(0x1f482, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("guard: dark skin tone"),*/ qsl("1f482-1f3ff"), 1636, EmojiCode(0x1f482, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman guard"),*/ qsl("1f482-2640"), 1637, EmojiCode(0x1f482, 0x2640), EmojiCode(0x1f482, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman guard: light skin tone"),*/ qsl("1f482-1f3fb-2640"), 1638, EmojiCode(0x1f482, 0x1f3fb, 0x2640), EmojiCode(0x1f482, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman guard: medium-light skin tone"),*/ qsl("1f482-1f3fc-2640"), 1639, EmojiCode(0x1f482, 0x1f3fc, 0x2640), EmojiCode(0x1f482, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman guard: medium skin tone"),*/ qsl("1f482-1f3fd-2640"), 1640, EmojiCode(0x1f482, 0x1f3fd, 0x2640), EmojiCode(0x1f482, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman guard: medium-dark skin tone"),*/ qsl("1f482-1f3fe-2640"), 1641, EmojiCode(0x1f482, 0x1f3fe, 0x2640), EmojiCode(0x1f482, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman guard: dark skin tone"),*/ qsl("1f482-1f3ff-2640"), 1642, EmojiCode(0x1f482, 0x1f3ff, 0x2640), EmojiCode(0x1f482, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man guard"),*/ qsl("1f482-2642"), 1643, EmojiCode(0x1f482, 0x2642), EmojiCode(0x1f482, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man guard: light skin tone"),*/ qsl("1f482-1f3fb-2642"), 1644, EmojiCode(0x1f482, 0x1f3fb, 0x2642), EmojiCode(0x1f482, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man guard: medium-light skin tone"),*/ qsl("1f482-1f3fc-2642"), 1645, EmojiCode(0x1f482, 0x1f3fc, 0x2642), EmojiCode(0x1f482, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man guard: medium skin tone"),*/ qsl("1f482-1f3fd-2642"), 1646, EmojiCode(0x1f482, 0x1f3fd, 0x2642), EmojiCode(0x1f482, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man guard: medium-dark skin tone"),*/ qsl("1f482-1f3fe-2642"), 1647, EmojiCode(0x1f482, 0x1f3fe, 0x2642), EmojiCode(0x1f482, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man guard: dark skin tone"),*/ qsl("1f482-1f3ff-2642"), 1648, EmojiCode(0x1f482, 0x1f3ff, 0x2642), EmojiCode(0x1f482, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("detective"),*/ qsl("1f575"), 1649, EmojiCode(0x1f575), EmojiCode(0x1f575, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("detective: light skin tone"),*/ qsl("1f575-1f3fb"), 1650, EmojiCode(0x1f575, 0x1f3fb), EmojiCode(0x1f575, 0xfe0f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("detective: medium-light skin tone"),*/ qsl("1f575-1f3fc"), 1651, EmojiCode(0x1f575, 0x1f3fc), EmojiCode(0x1f575, 0xfe0f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("detective: medium skin tone"),*/ qsl("1f575-1f3fd"), 1652, EmojiCode(0x1f575, 0x1f3fd), EmojiCode(0x1f575, 0xfe0f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("detective: medium-dark skin tone"),*/ qsl("1f575-1f3fe"), 1653, EmojiCode(0x1f575, 0x1f3fe), EmojiCode(0x1f575, 0xfe0f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("detective: dark skin tone"),*/ qsl("1f575-1f3ff"), 1654, EmojiCode(0x1f575, 0x1f3ff), EmojiCode(0x1f575, 0xfe0f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman detective"),*/ qsl("1f575-2640"), 1655, EmojiCode(0x1f575, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman detective: light skin tone"),*/ qsl("1f575-1f3fb-2640"), 1656, EmojiCode(0x1f575, 0x1f3fb, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman detective: medium-light skin tone"),*/ qsl("1f575-1f3fc-2640"), 1657, EmojiCode(0x1f575, 0x1f3fc, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman detective: medium skin tone"),*/ qsl("1f575-1f3fd-2640"), 1658, EmojiCode(0x1f575, 0x1f3fd, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman detective: medium-dark skin tone"),*/ qsl("1f575-1f3fe-2640"), 1659, EmojiCode(0x1f575, 0x1f3fe, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman detective: dark skin tone"),*/ qsl("1f575-1f3ff-2640"), 1660, EmojiCode(0x1f575, 0x1f3ff, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man detective"),*/ qsl("1f575-2642"), 1661, EmojiCode(0x1f575, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man detective: light skin tone"),*/ qsl("1f575-1f3fb-2642"), 1662, EmojiCode(0x1f575, 0x1f3fb, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man detective: medium-light skin tone"),*/ qsl("1f575-1f3fc-2642"), 1663, EmojiCode(0x1f575, 0x1f3fc, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man detective: medium skin tone"),*/ qsl("1f575-1f3fd-2642"), 1664, EmojiCode(0x1f575, 0x1f3fd, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man detective: medium-dark skin tone"),*/ qsl("1f575-1f3fe-2642"), 1665, EmojiCode(0x1f575, 0x1f3fe, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man detective: dark skin tone"),*/ qsl("1f575-1f3ff-2642"), 1666, EmojiCode(0x1f575, 0x1f3ff, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman health worker"),*/ qsl("1f469-2695"), 1667, EmojiCode(0x1f469, 0x2695), EmojiCode(0x1f469, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman health worker: light skin tone"),*/ qsl("1f469-1f3fb-2695"), 1668, EmojiCode(0x1f469, 0x1f3fb, 0x2695), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman health worker: medium-light skin tone"),*/ qsl("1f469-1f3fc-2695"), 1669, EmojiCode(0x1f469, 0x1f3fc, 0x2695), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman health worker: medium skin tone"),*/ qsl("1f469-1f3fd-2695"), 1670, EmojiCode(0x1f469, 0x1f3fd, 0x2695), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman health worker: medium-dark skin tone"),*/ qsl("1f469-1f3fe-2695"), 1671, EmojiCode(0x1f469, 0x1f3fe, 0x2695), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman health worker: dark skin tone"),*/ qsl("1f469-1f3ff-2695"), 1672, EmojiCode(0x1f469, 0x1f3ff, 0x2695), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man health worker"),*/ qsl("1f468-2695"), 1673, EmojiCode(0x1f468, 0x2695), EmojiCode(0x1f468, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man health worker: light skin tone"),*/ qsl("1f468-1f3fb-2695"), 1674, EmojiCode(0x1f468, 0x1f3fb, 0x2695), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man health worker: medium-light skin tone"),*/ qsl("1f468-1f3fc-2695"), 1675, EmojiCode(0x1f468, 0x1f3fc, 0x2695), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man health worker: medium skin tone"),*/ qsl("1f468-1f3fd-2695"), 1676, EmojiCode(0x1f468, 0x1f3fd, 0x2695), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man health worker: medium-dark skin tone"),*/ qsl("1f468-1f3fe-2695"), 1677, EmojiCode(0x1f468, 0x1f3fe, 0x2695), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man health worker: dark skin tone"),*/ qsl("1f468-1f3ff-2695"), 1678, EmojiCode(0x1f468, 0x1f3ff, 0x2695), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x2695, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman farmer"),*/ qsl("1f469-1f33e"), 1679, EmojiCode(0x1f469, 0x1f33e), EmojiCode(0x1f469, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman farmer: light skin tone"),*/ qsl("1f469-1f3fb-1f33e"), 1680, EmojiCode(0x1f469, 0x1f3fb, 0x1f33e), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman farmer: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f33e"), 1681, EmojiCode(0x1f469, 0x1f3fc, 0x1f33e), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman farmer: medium skin tone"),*/ qsl("1f469-1f3fd-1f33e"), 1682, EmojiCode(0x1f469, 0x1f3fd, 0x1f33e), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman farmer: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f33e"), 1683, EmojiCode(0x1f469, 0x1f3fe, 0x1f33e), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman farmer: dark skin tone"),*/ qsl("1f469-1f3ff-1f33e"), 1684, EmojiCode(0x1f469, 0x1f3ff, 0x1f33e), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man farmer"),*/ qsl("1f468-1f33e"), 1685, EmojiCode(0x1f468, 0x1f33e), EmojiCode(0x1f468, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man farmer: light skin tone"),*/ qsl("1f468-1f3fb-1f33e"), 1686, EmojiCode(0x1f468, 0x1f3fb, 0x1f33e), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man farmer: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f33e"), 1687, EmojiCode(0x1f468, 0x1f3fc, 0x1f33e), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man farmer: medium skin tone"),*/ qsl("1f468-1f3fd-1f33e"), 1688, EmojiCode(0x1f468, 0x1f3fd, 0x1f33e), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man farmer: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f33e"), 1689, EmojiCode(0x1f468, 0x1f3fe, 0x1f33e), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man farmer: dark skin tone"),*/ qsl("1f468-1f3ff-1f33e"), 1690, EmojiCode(0x1f468, 0x1f3ff, 0x1f33e), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f33e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman cook"),*/ qsl("1f469-1f373"), 1691, EmojiCode(0x1f469, 0x1f373), EmojiCode(0x1f469, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman cook: light skin tone"),*/ qsl("1f469-1f3fb-1f373"), 1692, EmojiCode(0x1f469, 0x1f3fb, 0x1f373), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman cook: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f373"), 1693, EmojiCode(0x1f469, 0x1f3fc, 0x1f373), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman cook: medium skin tone"),*/ qsl("1f469-1f3fd-1f373"), 1694, EmojiCode(0x1f469, 0x1f3fd, 0x1f373), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman cook: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f373"), 1695, EmojiCode(0x1f469, 0x1f3fe, 0x1f373), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman cook: dark skin tone"),*/ qsl("1f469-1f3ff-1f373"), 1696, EmojiCode(0x1f469, 0x1f3ff, 0x1f373), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man cook"),*/ qsl("1f468-1f373"), 1697, EmojiCode(0x1f468, 0x1f373), EmojiCode(0x1f468, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man cook: light skin tone"),*/ qsl("1f468-1f3fb-1f373"), 1698, EmojiCode(0x1f468, 0x1f3fb, 0x1f373), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man cook: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f373"), 1699, EmojiCode(0x1f468, 0x1f3fc, 0x1f373), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man cook: medium skin tone"),*/ qsl("1f468-1f3fd-1f373"), 1700, EmojiCode(0x1f468, 0x1f3fd, 0x1f373), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man cook: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f373"), 1701, EmojiCode(0x1f468, 0x1f3fe, 0x1f373), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man cook: dark skin tone"),*/ qsl("1f468-1f3ff-1f373"), 1702, EmojiCode(0x1f468, 0x1f3ff, 0x1f373), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f373)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman student"),*/ qsl("1f469-1f393"), 1703, EmojiCode(0x1f469, 0x1f393), EmojiCode(0x1f469, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman student: light skin tone"),*/ qsl("1f469-1f3fb-1f393"), 1704, EmojiCode(0x1f469, 0x1f3fb, 0x1f393), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman student: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f393"), 1705, EmojiCode(0x1f469, 0x1f3fc, 0x1f393), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman student: medium skin tone"),*/ qsl("1f469-1f3fd-1f393"), 1706, EmojiCode(0x1f469, 0x1f3fd, 0x1f393), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman student: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f393"), 1707, EmojiCode(0x1f469, 0x1f3fe, 0x1f393), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman student: dark skin tone"),*/ qsl("1f469-1f3ff-1f393"), 1708, EmojiCode(0x1f469, 0x1f3ff, 0x1f393), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man student"),*/ qsl("1f468-1f393"), 1709, EmojiCode(0x1f468, 0x1f393), EmojiCode(0x1f468, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man student: light skin tone"),*/ qsl("1f468-1f3fb-1f393"), 1710, EmojiCode(0x1f468, 0x1f3fb, 0x1f393), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man student: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f393"), 1711, EmojiCode(0x1f468, 0x1f3fc, 0x1f393), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man student: medium skin tone"),*/ qsl("1f468-1f3fd-1f393"), 1712, EmojiCode(0x1f468, 0x1f3fd, 0x1f393), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man student: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f393"), 1713, EmojiCode(0x1f468, 0x1f3fe, 0x1f393), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man student: dark skin tone"),*/ qsl("1f468-1f3ff-1f393"), 1714, EmojiCode(0x1f468, 0x1f3ff, 0x1f393), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f393)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman singer"),*/ qsl("1f469-1f3a4"), 1715, EmojiCode(0x1f469, 0x1f3a4), EmojiCode(0x1f469, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman singer: light skin tone"),*/ qsl("1f469-1f3fb-1f3a4"), 1716, EmojiCode(0x1f469, 0x1f3fb, 0x1f3a4), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman singer: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f3a4"), 1717, EmojiCode(0x1f469, 0x1f3fc, 0x1f3a4), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman singer: medium skin tone"),*/ qsl("1f469-1f3fd-1f3a4"), 1718, EmojiCode(0x1f469, 0x1f3fd, 0x1f3a4), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman singer: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f3a4"), 1719, EmojiCode(0x1f469, 0x1f3fe, 0x1f3a4), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman singer: dark skin tone"),*/ qsl("1f469-1f3ff-1f3a4"), 1720, EmojiCode(0x1f469, 0x1f3ff, 0x1f3a4), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man singer"),*/ qsl("1f468-1f3a4"), 1721, EmojiCode(0x1f468, 0x1f3a4), EmojiCode(0x1f468, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man singer: light skin tone"),*/ qsl("1f468-1f3fb-1f3a4"), 1722, EmojiCode(0x1f468, 0x1f3fb, 0x1f3a4), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man singer: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f3a4"), 1723, EmojiCode(0x1f468, 0x1f3fc, 0x1f3a4), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man singer: medium skin tone"),*/ qsl("1f468-1f3fd-1f3a4"), 1724, EmojiCode(0x1f468, 0x1f3fd, 0x1f3a4), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man singer: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f3a4"), 1725, EmojiCode(0x1f468, 0x1f3fe, 0x1f3a4), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man singer: dark skin tone"),*/ qsl("1f468-1f3ff-1f3a4"), 1726, EmojiCode(0x1f468, 0x1f3ff, 0x1f3a4), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f3a4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman teacher"),*/ qsl("1f469-1f3eb"), 1727, EmojiCode(0x1f469, 0x1f3eb), EmojiCode(0x1f469, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman teacher: light skin tone"),*/ qsl("1f469-1f3fb-1f3eb"), 1728, EmojiCode(0x1f469, 0x1f3fb, 0x1f3eb), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman teacher: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f3eb"), 1729, EmojiCode(0x1f469, 0x1f3fc, 0x1f3eb), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman teacher: medium skin tone"),*/ qsl("1f469-1f3fd-1f3eb"), 1730, EmojiCode(0x1f469, 0x1f3fd, 0x1f3eb), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman teacher: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f3eb"), 1731, EmojiCode(0x1f469, 0x1f3fe, 0x1f3eb), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman teacher: dark skin tone"),*/ qsl("1f469-1f3ff-1f3eb"), 1732, EmojiCode(0x1f469, 0x1f3ff, 0x1f3eb), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man teacher"),*/ qsl("1f468-1f3eb"), 1733, EmojiCode(0x1f468, 0x1f3eb), EmojiCode(0x1f468, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man teacher: light skin tone"),*/ qsl("1f468-1f3fb-1f3eb"), 1734, EmojiCode(0x1f468, 0x1f3fb, 0x1f3eb), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man teacher: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f3eb"), 1735, EmojiCode(0x1f468, 0x1f3fc, 0x1f3eb), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man teacher: medium skin tone"),*/ qsl("1f468-1f3fd-1f3eb"), 1736, EmojiCode(0x1f468, 0x1f3fd, 0x1f3eb), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man teacher: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f3eb"), 1737, EmojiCode(0x1f468, 0x1f3fe, 0x1f3eb), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man teacher: dark skin tone"),*/ qsl("1f468-1f3ff-1f3eb"), 1738, EmojiCode(0x1f468, 0x1f3ff, 0x1f3eb), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman factory worker"),*/ qsl("1f469-1f3ed"), 1739, EmojiCode(0x1f469, 0x1f3ed), EmojiCode(0x1f469, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman factory worker: light skin tone"),*/ qsl("1f469-1f3fb-1f3ed"), 1740, EmojiCode(0x1f469, 0x1f3fb, 0x1f3ed), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman factory worker: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f3ed"), 1741, EmojiCode(0x1f469, 0x1f3fc, 0x1f3ed), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman factory worker: medium skin tone"),*/ qsl("1f469-1f3fd-1f3ed"), 1742, EmojiCode(0x1f469, 0x1f3fd, 0x1f3ed), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman factory worker: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f3ed"), 1743, EmojiCode(0x1f469, 0x1f3fe, 0x1f3ed), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman factory worker: dark skin tone"),*/ qsl("1f469-1f3ff-1f3ed"), 1744, EmojiCode(0x1f469, 0x1f3ff, 0x1f3ed), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man factory worker"),*/ qsl("1f468-1f3ed"), 1745, EmojiCode(0x1f468, 0x1f3ed), EmojiCode(0x1f468, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man factory worker: light skin tone"),*/ qsl("1f468-1f3fb-1f3ed"), 1746, EmojiCode(0x1f468, 0x1f3fb, 0x1f3ed), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man factory worker: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f3ed"), 1747, EmojiCode(0x1f468, 0x1f3fc, 0x1f3ed), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man factory worker: medium skin tone"),*/ qsl("1f468-1f3fd-1f3ed"), 1748, EmojiCode(0x1f468, 0x1f3fd, 0x1f3ed), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man factory worker: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f3ed"), 1749, EmojiCode(0x1f468, 0x1f3fe, 0x1f3ed), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man factory worker: dark skin tone"),*/ qsl("1f468-1f3ff-1f3ed"), 1750, EmojiCode(0x1f468, 0x1f3ff, 0x1f3ed), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f3ed)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman technologist"),*/ qsl("1f469-1f4bb"), 1751, EmojiCode(0x1f469, 0x1f4bb), EmojiCode(0x1f469, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman technologist: light skin tone"),*/ qsl("1f469-1f3fb-1f4bb"), 1752, EmojiCode(0x1f469, 0x1f3fb, 0x1f4bb), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman technologist: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f4bb"), 1753, EmojiCode(0x1f469, 0x1f3fc, 0x1f4bb), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman technologist: medium skin tone"),*/ qsl("1f469-1f3fd-1f4bb"), 1754, EmojiCode(0x1f469, 0x1f3fd, 0x1f4bb), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman technologist: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f4bb"), 1755, EmojiCode(0x1f469, 0x1f3fe, 0x1f4bb), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman technologist: dark skin tone"),*/ qsl("1f469-1f3ff-1f4bb"), 1756, EmojiCode(0x1f469, 0x1f3ff, 0x1f4bb), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man technologist"),*/ qsl("1f468-1f4bb"), 1757, EmojiCode(0x1f468, 0x1f4bb), EmojiCode(0x1f468, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man technologist: light skin tone"),*/ qsl("1f468-1f3fb-1f4bb"), 1758, EmojiCode(0x1f468, 0x1f3fb, 0x1f4bb), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man technologist: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f4bb"), 1759, EmojiCode(0x1f468, 0x1f3fc, 0x1f4bb), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man technologist: medium skin tone"),*/ qsl("1f468-1f3fd-1f4bb"), 1760, EmojiCode(0x1f468, 0x1f3fd, 0x1f4bb), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man technologist: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f4bb"), 1761, EmojiCode(0x1f468, 0x1f3fe, 0x1f4bb), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man technologist: dark skin tone"),*/ qsl("1f468-1f3ff-1f4bb"), 1762, EmojiCode(0x1f468, 0x1f3ff, 0x1f4bb), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f4bb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman office worker"),*/ qsl("1f469-1f4bc"), 1763, EmojiCode(0x1f469, 0x1f4bc), EmojiCode(0x1f469, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman office worker: light skin tone"),*/ qsl("1f469-1f3fb-1f4bc"), 1764, EmojiCode(0x1f469, 0x1f3fb, 0x1f4bc), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman office worker: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f4bc"), 1765, EmojiCode(0x1f469, 0x1f3fc, 0x1f4bc), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman office worker: medium skin tone"),*/ qsl("1f469-1f3fd-1f4bc"), 1766, EmojiCode(0x1f469, 0x1f3fd, 0x1f4bc), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman office worker: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f4bc"), 1767, EmojiCode(0x1f469, 0x1f3fe, 0x1f4bc), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman office worker: dark skin tone"),*/ qsl("1f469-1f3ff-1f4bc"), 1768, EmojiCode(0x1f469, 0x1f3ff, 0x1f4bc), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man office worker"),*/ qsl("1f468-1f4bc"), 1769, EmojiCode(0x1f468, 0x1f4bc), EmojiCode(0x1f468, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man office worker: light skin tone"),*/ qsl("1f468-1f3fb-1f4bc"), 1770, EmojiCode(0x1f468, 0x1f3fb, 0x1f4bc), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man office worker: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f4bc"), 1771, EmojiCode(0x1f468, 0x1f3fc, 0x1f4bc), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man office worker: medium skin tone"),*/ qsl("1f468-1f3fd-1f4bc"), 1772, EmojiCode(0x1f468, 0x1f3fd, 0x1f4bc), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man office worker: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f4bc"), 1773, EmojiCode(0x1f468, 0x1f3fe, 0x1f4bc), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man office worker: dark skin tone"),*/ qsl("1f468-1f3ff-1f4bc"), 1774, EmojiCode(0x1f468, 0x1f3ff, 0x1f4bc), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mechanic"),*/ qsl("1f469-1f527"), 1775, EmojiCode(0x1f469, 0x1f527), EmojiCode(0x1f469, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mechanic: light skin tone"),*/ qsl("1f469-1f3fb-1f527"), 1776, EmojiCode(0x1f469, 0x1f3fb, 0x1f527), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mechanic: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f527"), 1777, EmojiCode(0x1f469, 0x1f3fc, 0x1f527), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mechanic: medium skin tone"),*/ qsl("1f469-1f3fd-1f527"), 1778, EmojiCode(0x1f469, 0x1f3fd, 0x1f527), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mechanic: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f527"), 1779, EmojiCode(0x1f469, 0x1f3fe, 0x1f527), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mechanic: dark skin tone"),*/ qsl("1f469-1f3ff-1f527"), 1780, EmojiCode(0x1f469, 0x1f3ff, 0x1f527), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mechanic"),*/ qsl("1f468-1f527"), 1781, EmojiCode(0x1f468, 0x1f527), EmojiCode(0x1f468, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mechanic: light skin tone"),*/ qsl("1f468-1f3fb-1f527"), 1782, EmojiCode(0x1f468, 0x1f3fb, 0x1f527), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mechanic: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f527"), 1783, EmojiCode(0x1f468, 0x1f3fc, 0x1f527), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mechanic: medium skin tone"),*/ qsl("1f468-1f3fd-1f527"), 1784, EmojiCode(0x1f468, 0x1f3fd, 0x1f527), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mechanic: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f527"), 1785, EmojiCode(0x1f468, 0x1f3fe, 0x1f527), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mechanic: dark skin tone"),*/ qsl("1f468-1f3ff-1f527"), 1786, EmojiCode(0x1f468, 0x1f3ff, 0x1f527), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f527)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman scientist"),*/ qsl("1f469-1f52c"), 1787, EmojiCode(0x1f469, 0x1f52c), EmojiCode(0x1f469, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman scientist: light skin tone"),*/ qsl("1f469-1f3fb-1f52c"), 1788, EmojiCode(0x1f469, 0x1f3fb, 0x1f52c), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman scientist: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f52c"), 1789, EmojiCode(0x1f469, 0x1f3fc, 0x1f52c), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman scientist: medium skin tone"),*/ qsl("1f469-1f3fd-1f52c"), 1790, EmojiCode(0x1f469, 0x1f3fd, 0x1f52c), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman scientist: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f52c"), 1791, EmojiCode(0x1f469, 0x1f3fe, 0x1f52c), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman scientist: dark skin tone"),*/ qsl("1f469-1f3ff-1f52c"), 1792, EmojiCode(0x1f469, 0x1f3ff, 0x1f52c), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man scientist"),*/ qsl("1f468-1f52c"), 1793, EmojiCode(0x1f468, 0x1f52c), EmojiCode(0x1f468, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man scientist: light skin tone"),*/ qsl("1f468-1f3fb-1f52c"), 1794, EmojiCode(0x1f468, 0x1f3fb, 0x1f52c), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man scientist: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f52c"), 1795, EmojiCode(0x1f468, 0x1f3fc, 0x1f52c), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man scientist: medium skin tone"),*/ qsl("1f468-1f3fd-1f52c"), 1796, EmojiCode(0x1f468, 0x1f3fd, 0x1f52c), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man scientist: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f52c"), 1797, EmojiCode(0x1f468, 0x1f3fe, 0x1f52c), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man scientist: dark skin tone"),*/ qsl("1f468-1f3ff-1f52c"), 1798, EmojiCode(0x1f468, 0x1f3ff, 0x1f52c), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f52c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman artist"),*/ qsl("1f469-1f3a8"), 1799, EmojiCode(0x1f469, 0x1f3a8), EmojiCode(0x1f469, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman artist: light skin tone"),*/ qsl("1f469-1f3fb-1f3a8"), 1800, EmojiCode(0x1f469, 0x1f3fb, 0x1f3a8), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman artist: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f3a8"), 1801, EmojiCode(0x1f469, 0x1f3fc, 0x1f3a8), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman artist: medium skin tone"),*/ qsl("1f469-1f3fd-1f3a8"), 1802, EmojiCode(0x1f469, 0x1f3fd, 0x1f3a8), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman artist: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f3a8"), 1803, EmojiCode(0x1f469, 0x1f3fe, 0x1f3a8), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman artist: dark skin tone"),*/ qsl("1f469-1f3ff-1f3a8"), 1804, EmojiCode(0x1f469, 0x1f3ff, 0x1f3a8), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man artist"),*/ qsl("1f468-1f3a8"), 1805, EmojiCode(0x1f468, 0x1f3a8), EmojiCode(0x1f468, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man artist: light skin tone"),*/ qsl("1f468-1f3fb-1f3a8"), 1806, EmojiCode(0x1f468, 0x1f3fb, 0x1f3a8), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man artist: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f3a8"), 1807, EmojiCode(0x1f468, 0x1f3fc, 0x1f3a8), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man artist: medium skin tone"),*/ qsl("1f468-1f3fd-1f3a8"), 1808, EmojiCode(0x1f468, 0x1f3fd, 0x1f3a8), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man artist: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f3a8"), 1809, EmojiCode(0x1f468, 0x1f3fe, 0x1f3a8), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man artist: dark skin tone"),*/ qsl("1f468-1f3ff-1f3a8"), 1810, EmojiCode(0x1f468, 0x1f3ff, 0x1f3a8), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f3a8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman firefighter"),*/ qsl("1f469-1f692"), 1811, EmojiCode(0x1f469, 0x1f692), EmojiCode(0x1f469, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman firefighter: light skin tone"),*/ qsl("1f469-1f3fb-1f692"), 1812, EmojiCode(0x1f469, 0x1f3fb, 0x1f692), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman firefighter: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f692"), 1813, EmojiCode(0x1f469, 0x1f3fc, 0x1f692), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman firefighter: medium skin tone"),*/ qsl("1f469-1f3fd-1f692"), 1814, EmojiCode(0x1f469, 0x1f3fd, 0x1f692), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman firefighter: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f692"), 1815, EmojiCode(0x1f469, 0x1f3fe, 0x1f692), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman firefighter: dark skin tone"),*/ qsl("1f469-1f3ff-1f692"), 1816, EmojiCode(0x1f469, 0x1f3ff, 0x1f692), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man firefighter"),*/ qsl("1f468-1f692"), 1817, EmojiCode(0x1f468, 0x1f692), EmojiCode(0x1f468, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man firefighter: light skin tone"),*/ qsl("1f468-1f3fb-1f692"), 1818, EmojiCode(0x1f468, 0x1f3fb, 0x1f692), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man firefighter: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f692"), 1819, EmojiCode(0x1f468, 0x1f3fc, 0x1f692), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man firefighter: medium skin tone"),*/ qsl("1f468-1f3fd-1f692"), 1820, EmojiCode(0x1f468, 0x1f3fd, 0x1f692), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man firefighter: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f692"), 1821, EmojiCode(0x1f468, 0x1f3fe, 0x1f692), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man firefighter: dark skin tone"),*/ qsl("1f468-1f3ff-1f692"), 1822, EmojiCode(0x1f468, 0x1f3ff, 0x1f692), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pilot"),*/ qsl("1f469-2708"), 1823, EmojiCode(0x1f469, 0x2708), EmojiCode(0x1f469, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pilot: light skin tone"),*/ qsl("1f469-1f3fb-2708"), 1824, EmojiCode(0x1f469, 0x1f3fb, 0x2708), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pilot: medium-light skin tone"),*/ qsl("1f469-1f3fc-2708"), 1825, EmojiCode(0x1f469, 0x1f3fc, 0x2708), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pilot: medium skin tone"),*/ qsl("1f469-1f3fd-2708"), 1826, EmojiCode(0x1f469, 0x1f3fd, 0x2708), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pilot: medium-dark skin tone"),*/ qsl("1f469-1f3fe-2708"), 1827, EmojiCode(0x1f469, 0x1f3fe, 0x2708), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pilot: dark skin tone"),*/ qsl("1f469-1f3ff-2708"), 1828, EmojiCode(0x1f469, 0x1f3ff, 0x2708), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pilot"),*/ qsl("1f468-2708"), 1829, EmojiCode(0x1f468, 0x2708), EmojiCode(0x1f468, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pilot: light skin tone"),*/ qsl("1f468-1f3fb-2708"), 1830, EmojiCode(0x1f468, 0x1f3fb, 0x2708), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pilot: medium-light skin tone"),*/ qsl("1f468-1f3fc-2708"), 1831, EmojiCode(0x1f468, 0x1f3fc, 0x2708), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pilot: medium skin tone"),*/ qsl("1f468-1f3fd-2708"), 1832, EmojiCode(0x1f468, 0x1f3fd, 0x2708), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pilot: medium-dark skin tone"),*/ qsl("1f468-1f3fe-2708"), 1833, EmojiCode(0x1f468, 0x1f3fe, 0x2708), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pilot: dark skin tone"),*/ qsl("1f468-1f3ff-2708"), 1834, EmojiCode(0x1f468, 0x1f3ff, 0x2708), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman astronaut"),*/ qsl("1f469-1f680"), 1835, EmojiCode(0x1f469, 0x1f680), EmojiCode(0x1f469, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman astronaut: light skin tone"),*/ qsl("1f469-1f3fb-1f680"), 1836, EmojiCode(0x1f469, 0x1f3fb, 0x1f680), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman astronaut: medium-light skin tone"),*/ qsl("1f469-1f3fc-1f680"), 1837, EmojiCode(0x1f469, 0x1f3fc, 0x1f680), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman astronaut: medium skin tone"),*/ qsl("1f469-1f3fd-1f680"), 1838, EmojiCode(0x1f469, 0x1f3fd, 0x1f680), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman astronaut: medium-dark skin tone"),*/ qsl("1f469-1f3fe-1f680"), 1839, EmojiCode(0x1f469, 0x1f3fe, 0x1f680), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman astronaut: dark skin tone"),*/ qsl("1f469-1f3ff-1f680"), 1840, EmojiCode(0x1f469, 0x1f3ff, 0x1f680), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man astronaut"),*/ qsl("1f468-1f680"), 1841, EmojiCode(0x1f468, 0x1f680), EmojiCode(0x1f468, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man astronaut: light skin tone"),*/ qsl("1f468-1f3fb-1f680"), 1842, EmojiCode(0x1f468, 0x1f3fb, 0x1f680), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man astronaut: medium-light skin tone"),*/ qsl("1f468-1f3fc-1f680"), 1843, EmojiCode(0x1f468, 0x1f3fc, 0x1f680), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man astronaut: medium skin tone"),*/ qsl("1f468-1f3fd-1f680"), 1844, EmojiCode(0x1f468, 0x1f3fd, 0x1f680), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man astronaut: medium-dark skin tone"),*/ qsl("1f468-1f3fe-1f680"), 1845, EmojiCode(0x1f468, 0x1f3fe, 0x1f680), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man astronaut: dark skin tone"),*/ qsl("1f468-1f3ff-1f680"), 1846, EmojiCode(0x1f468, 0x1f3ff, 0x1f680), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman judge"),*/ qsl("1f469-2696"), 1847, EmojiCode(0x1f469, 0x2696), EmojiCode(0x1f469, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman judge: light skin tone"),*/ qsl("1f469-1f3fb-2696"), 1848, EmojiCode(0x1f469, 0x1f3fb, 0x2696), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman judge: medium-light skin tone"),*/ qsl("1f469-1f3fc-2696"), 1849, EmojiCode(0x1f469, 0x1f3fc, 0x2696), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman judge: medium skin tone"),*/ qsl("1f469-1f3fd-2696"), 1850, EmojiCode(0x1f469, 0x1f3fd, 0x2696), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman judge: medium-dark skin tone"),*/ qsl("1f469-1f3fe-2696"), 1851, EmojiCode(0x1f469, 0x1f3fe, 0x2696), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman judge: dark skin tone"),*/ qsl("1f469-1f3ff-2696"), 1852, EmojiCode(0x1f469, 0x1f3ff, 0x2696), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man judge"),*/ qsl("1f468-2696"), 1853, EmojiCode(0x1f468, 0x2696), EmojiCode(0x1f468, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man judge: light skin tone"),*/ qsl("1f468-1f3fb-2696"), 1854, EmojiCode(0x1f468, 0x1f3fb, 0x2696), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man judge: medium-light skin tone"),*/ qsl("1f468-1f3fc-2696"), 1855, EmojiCode(0x1f468, 0x1f3fc, 0x2696), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man judge: medium skin tone"),*/ qsl("1f468-1f3fd-2696"), 1856, EmojiCode(0x1f468, 0x1f3fd, 0x2696), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man judge: medium-dark skin tone"),*/ qsl("1f468-1f3fe-2696"), 1857, EmojiCode(0x1f468, 0x1f3fe, 0x2696), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man judge: dark skin tone"),*/ qsl("1f468-1f3ff-2696"), 1858, EmojiCode(0x1f468, 0x1f3ff, 0x2696), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x2696, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bride with veil"),*/ qsl("1f470"), 1859, EmojiCode(0x1f470)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bride with veil: light skin tone"),*/ qsl("1f470-1f3fb"), 1860, EmojiCode(0x1f470, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bride with veil: medium-light skin tone"),*/ qsl("1f470-1f3fc"), 1861, EmojiCode(0x1f470, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bride with veil: medium skin tone"),*/ qsl("1f470-1f3fd"), 1862, EmojiCode(0x1f470, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bride with veil: medium-dark skin tone"),*/ qsl("1f470-1f3fe"), 1863, EmojiCode(0x1f470, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bride with veil: dark skin tone"),*/ qsl("1f470-1f3ff"), 1864, EmojiCode(0x1f470, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in tuxedo"),*/ qsl("1f935"), 1865, EmojiCode(0x1f935)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in tuxedo: light skin tone"),*/ qsl("1f935-1f3fb"), 1866, EmojiCode(0x1f935, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in tuxedo: medium-light skin tone"),*/ qsl("1f935-1f3fc"), 1867, EmojiCode(0x1f935, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in tuxedo: medium skin tone"),*/ qsl("1f935-1f3fd"), 1868, EmojiCode(0x1f935, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in tuxedo: medium-dark skin tone"),*/ qsl("1f935-1f3fe"), 1869, EmojiCode(0x1f935, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in tuxedo: dark skin tone"),*/ qsl("1f935-1f3ff"), 1870, EmojiCode(0x1f935, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("princess"),*/ qsl("1f478"), 1871, EmojiCode(0x1f478)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("princess: light skin tone"),*/ qsl("1f478-1f3fb"), 1872, EmojiCode(0x1f478, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("princess: medium-light skin tone"),*/ qsl("1f478-1f3fc"), 1873, EmojiCode(0x1f478, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("princess: medium skin tone"),*/ qsl("1f478-1f3fd"), 1874, EmojiCode(0x1f478, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("princess: medium-dark skin tone"),*/ qsl("1f478-1f3fe"), 1875, EmojiCode(0x1f478, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("princess: dark skin tone"),*/ qsl("1f478-1f3ff"), 1876, EmojiCode(0x1f478, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("prince"),*/ qsl("1f934"), 1877, EmojiCode(0x1f934)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("prince: light skin tone"),*/ qsl("1f934-1f3fb"), 1878, EmojiCode(0x1f934, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("prince: medium-light skin tone"),*/ qsl("1f934-1f3fc"), 1879, EmojiCode(0x1f934, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("prince: medium skin tone"),*/ qsl("1f934-1f3fd"), 1880, EmojiCode(0x1f934, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("prince: medium-dark skin tone"),*/ qsl("1f934-1f3fe"), 1881, EmojiCode(0x1f934, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("prince: dark skin tone"),*/ qsl("1f934-1f3ff"), 1882, EmojiCode(0x1f934, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Mrs. Claus"),*/ qsl("1f936"), 1883, EmojiCode(0x1f936)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Mrs. Claus: light skin tone"),*/ qsl("1f936-1f3fb"), 1884, EmojiCode(0x1f936, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Mrs. Claus: medium skin tone"),*/ qsl("1f936-1f3fd"), 1885, EmojiCode(0x1f936, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Mrs. Claus: medium-light skin tone"),*/ qsl("1f936-1f3fc"), 1886, EmojiCode(0x1f936, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Mrs. Claus: medium-dark skin tone"),*/ qsl("1f936-1f3fe"), 1887, EmojiCode(0x1f936, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Mrs. Claus: dark skin tone"),*/ qsl("1f936-1f3ff"), 1888, EmojiCode(0x1f936, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Santa Claus"),*/ qsl("1f385"), 1889, EmojiCode(0x1f385)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Santa Claus: light skin tone"),*/ qsl("1f385-1f3fb"), 1890, EmojiCode(0x1f385, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Santa Claus: medium-light skin tone"),*/ qsl("1f385-1f3fc"), 1891, EmojiCode(0x1f385, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Santa Claus: medium skin tone"),*/ qsl("1f385-1f3fd"), 1892, EmojiCode(0x1f385, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Santa Claus: medium-dark skin tone"),*/ qsl("1f385-1f3fe"), 1893, EmojiCode(0x1f385, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("Santa Claus: dark skin tone"),*/ qsl("1f385-1f3ff"), 1894, EmojiCode(0x1f385, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("superhero"),*/ qsl("1f9b8"), 1895, EmojiCode(0x1f9b8)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("superhero: light skin tone"),*/ qsl("1f9b8-1f3fb"), 1896, EmojiCode(0x1f9b8, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("superhero: medium-light skin tone"),*/ qsl("1f9b8-1f3fc"), 1897, EmojiCode(0x1f9b8, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("superhero: medium skin tone"),*/ qsl("1f9b8-1f3fd"), 1898, EmojiCode(0x1f9b8, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("superhero: medium-dark skin tone"),*/ qsl("1f9b8-1f3fe"), 1899, EmojiCode(0x1f9b8, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("superhero: dark skin tone"),*/ qsl("1f9b8-1f3ff"), 1900, EmojiCode(0x1f9b8, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman superhero"),*/ qsl("1f9b8-2640"), 1901, EmojiCode(0x1f9b8, 0x2640), EmojiCode(0x1f9b8, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman superhero: light skin tone"),*/ qsl("1f9b8-1f3fb-2640"), 1902, EmojiCode(0x1f9b8, 0x1f3fb, 0x2640), EmojiCode(0x1f9b8, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman superhero: medium-light skin tone"),*/ qsl("1f9b8-1f3fc-2640"), 1903, EmojiCode(0x1f9b8, 0x1f3fc, 0x2640), EmojiCode(0x1f9b8, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman superhero: medium skin tone"),*/ qsl("1f9b8-1f3fd-2640"), 1904, EmojiCode(0x1f9b8, 0x1f3fd, 0x2640), EmojiCode(0x1f9b8, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman superhero: medium-dark skin tone"),*/ qsl("1f9b8-1f3fe-2640"), 1905, EmojiCode(0x1f9b8, 0x1f3fe, 0x2640), EmojiCode(0x1f9b8, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman superhero: dark skin tone"),*/ qsl("1f9b8-1f3ff-2640"), 1906, EmojiCode(0x1f9b8, 0x1f3ff, 0x2640), EmojiCode(0x1f9b8, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man superhero"),*/ qsl("1f9b8-2642"), 1907, EmojiCode(0x1f9b8, 0x2642), EmojiCode(0x1f9b8, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man superhero: light skin tone"),*/ qsl("1f9b8-1f3fb-2642"), 1908, EmojiCode(0x1f9b8, 0x1f3fb, 0x2642), EmojiCode(0x1f9b8, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man superhero: medium-light skin tone"),*/ qsl("1f9b8-1f3fc-2642"), 1909, EmojiCode(0x1f9b8, 0x1f3fc, 0x2642), EmojiCode(0x1f9b8, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man superhero: medium skin tone"),*/ qsl("1f9b8-1f3fd-2642"), 1910, EmojiCode(0x1f9b8, 0x1f3fd, 0x2642), EmojiCode(0x1f9b8, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man superhero: medium-dark skin tone"),*/ qsl("1f9b8-1f3fe-2642"), 1911, EmojiCode(0x1f9b8, 0x1f3fe, 0x2642), EmojiCode(0x1f9b8, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man superhero: dark skin tone"),*/ qsl("1f9b8-1f3ff-2642"), 1912, EmojiCode(0x1f9b8, 0x1f3ff, 0x2642), EmojiCode(0x1f9b8, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("supervillain"),*/ qsl("1f9b9"), 1913, EmojiCode(0x1f9b9)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("supervillain: light skin tone"),*/ qsl("1f9b9-1f3fb"), 1914, EmojiCode(0x1f9b9, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("supervillain: medium-light skin tone"),*/ qsl("1f9b9-1f3fc"), 1915, EmojiCode(0x1f9b9, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("supervillain: medium skin tone"),*/ qsl("1f9b9-1f3fd"), 1916, EmojiCode(0x1f9b9, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("supervillain: medium-dark skin tone"),*/ qsl("1f9b9-1f3fe"), 1917, EmojiCode(0x1f9b9, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("supervillain: dark skin tone"),*/ qsl("1f9b9-1f3ff"), 1918, EmojiCode(0x1f9b9, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman supervillain: light skin tone"),*/ qsl("1f9b9-1f3fb-2640"), 1919, EmojiCode(0x1f9b9, 0x1f3fb, 0x2640), EmojiCode(0x1f9b9, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman supervillain"),*/ qsl("1f9b9-2640"), 1920, EmojiCode(0x1f9b9, 0x2640), EmojiCode(0x1f9b9, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman supervillain: medium-light skin tone"),*/ qsl("1f9b9-1f3fc-2640"), 1921, EmojiCode(0x1f9b9, 0x1f3fc, 0x2640), EmojiCode(0x1f9b9, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman supervillain: medium skin tone"),*/ qsl("1f9b9-1f3fd-2640"), 1922, EmojiCode(0x1f9b9, 0x1f3fd, 0x2640), EmojiCode(0x1f9b9, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman supervillain: medium-dark skin tone"),*/ qsl("1f9b9-1f3fe-2640"), 1923, EmojiCode(0x1f9b9, 0x1f3fe, 0x2640), EmojiCode(0x1f9b9, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman supervillain: dark skin tone"),*/ qsl("1f9b9-1f3ff-2640"), 1924, EmojiCode(0x1f9b9, 0x1f3ff, 0x2640), EmojiCode(0x1f9b9, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man supervillain"),*/ qsl("1f9b9-2642"), 1925, EmojiCode(0x1f9b9, 0x2642), EmojiCode(0x1f9b9, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man supervillain: light skin tone"),*/ qsl("1f9b9-1f3fb-2642"), 1926, EmojiCode(0x1f9b9, 0x1f3fb, 0x2642), EmojiCode(0x1f9b9, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man supervillain: medium-light skin tone"),*/ qsl("1f9b9-1f3fc-2642"), 1927, EmojiCode(0x1f9b9, 0x1f3fc, 0x2642), EmojiCode(0x1f9b9, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man supervillain: medium skin tone"),*/ qsl("1f9b9-1f3fd-2642"), 1928, EmojiCode(0x1f9b9, 0x1f3fd, 0x2642), EmojiCode(0x1f9b9, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man supervillain: medium-dark skin tone"),*/ qsl("1f9b9-1f3fe-2642"), 1929, EmojiCode(0x1f9b9, 0x1f3fe, 0x2642), EmojiCode(0x1f9b9, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man supervillain: dark skin tone"),*/ qsl("1f9b9-1f3ff-2642"), 1930, EmojiCode(0x1f9b9, 0x1f3ff, 0x2642), EmojiCode(0x1f9b9, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mage"),*/ qsl("1f9d9"), 1931, EmojiCode(0x1f9d9)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mage: light skin tone"),*/ qsl("1f9d9-1f3fb"), 1932, EmojiCode(0x1f9d9, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mage: medium-light skin tone"),*/ qsl("1f9d9-1f3fc"), 1933, EmojiCode(0x1f9d9, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mage: medium skin tone"),*/ qsl("1f9d9-1f3fd"), 1934, EmojiCode(0x1f9d9, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mage: medium-dark skin tone"),*/ qsl("1f9d9-1f3fe"), 1935, EmojiCode(0x1f9d9, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mage: dark skin tone"),*/ qsl("1f9d9-1f3ff"), 1936, EmojiCode(0x1f9d9, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mage"),*/ qsl("1f9d9-2640"), 1937, EmojiCode(0x1f9d9, 0x2640), EmojiCode(0x1f9d9, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mage: light skin tone"),*/ qsl("1f9d9-1f3fb-2640"), 1938, EmojiCode(0x1f9d9, 0x1f3fb, 0x2640), EmojiCode(0x1f9d9, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mage: medium-light skin tone"),*/ qsl("1f9d9-1f3fc-2640"), 1939, EmojiCode(0x1f9d9, 0x1f3fc, 0x2640), EmojiCode(0x1f9d9, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mage: medium skin tone"),*/ qsl("1f9d9-1f3fd-2640"), 1940, EmojiCode(0x1f9d9, 0x1f3fd, 0x2640), EmojiCode(0x1f9d9, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mage: medium-dark skin tone"),*/ qsl("1f9d9-1f3fe-2640"), 1941, EmojiCode(0x1f9d9, 0x1f3fe, 0x2640), EmojiCode(0x1f9d9, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman mage: dark skin tone"),*/ qsl("1f9d9-1f3ff-2640"), 1942, EmojiCode(0x1f9d9, 0x1f3ff, 0x2640), EmojiCode(0x1f9d9, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mage"),*/ qsl("1f9d9-2642"), 1943, EmojiCode(0x1f9d9, 0x2642), EmojiCode(0x1f9d9, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mage: light skin tone"),*/ qsl("1f9d9-1f3fb-2642"), 1944, EmojiCode(0x1f9d9, 0x1f3fb, 0x2642), EmojiCode(0x1f9d9, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mage: medium-light skin tone"),*/ qsl("1f9d9-1f3fc-2642"), 1945, EmojiCode(0x1f9d9, 0x1f3fc, 0x2642), EmojiCode(0x1f9d9, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mage: medium skin tone"),*/ qsl("1f9d9-1f3fd-2642"), 1946, EmojiCode(0x1f9d9, 0x1f3fd, 0x2642), EmojiCode(0x1f9d9, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mage: medium-dark skin tone"),*/ qsl("1f9d9-1f3fe-2642"), 1947, EmojiCode(0x1f9d9, 0x1f3fe, 0x2642), EmojiCode(0x1f9d9, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man mage: dark skin tone"),*/ qsl("1f9d9-1f3ff-2642"), 1948, EmojiCode(0x1f9d9, 0x1f3ff, 0x2642), EmojiCode(0x1f9d9, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("elf"),*/ qsl("1f9dd"), 1949, EmojiCode(0x1f9dd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("elf: light skin tone"),*/ qsl("1f9dd-1f3fb"), 1950, EmojiCode(0x1f9dd, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("elf: medium-light skin tone"),*/ qsl("1f9dd-1f3fc"), 1951, EmojiCode(0x1f9dd, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("elf: medium skin tone"),*/ qsl("1f9dd-1f3fd"), 1952, EmojiCode(0x1f9dd, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("elf: medium-dark skin tone"),*/ qsl("1f9dd-1f3fe"), 1953, EmojiCode(0x1f9dd, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("elf: dark skin tone"),*/ qsl("1f9dd-1f3ff"), 1954, EmojiCode(0x1f9dd, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman elf"),*/ qsl("1f9dd-2640"), 1955, EmojiCode(0x1f9dd, 0x2640), EmojiCode(0x1f9dd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman elf: light skin tone"),*/ qsl("1f9dd-1f3fb-2640"), 1956, EmojiCode(0x1f9dd, 0x1f3fb, 0x2640), EmojiCode(0x1f9dd, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman elf: medium-light skin tone"),*/ qsl("1f9dd-1f3fc-2640"), 1957, EmojiCode(0x1f9dd, 0x1f3fc, 0x2640), EmojiCode(0x1f9dd, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman elf: medium skin tone"),*/ qsl("1f9dd-1f3fd-2640"), 1958, EmojiCode(0x1f9dd, 0x1f3fd, 0x2640), EmojiCode(0x1f9dd, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman elf: medium-dark skin tone"),*/ qsl("1f9dd-1f3fe-2640"), 1959, EmojiCode(0x1f9dd, 0x1f3fe, 0x2640), EmojiCode(0x1f9dd, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman elf: dark skin tone"),*/ qsl("1f9dd-1f3ff-2640"), 1960, EmojiCode(0x1f9dd, 0x1f3ff, 0x2640), EmojiCode(0x1f9dd, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man elf"),*/ qsl("1f9dd-2642"), 1961, EmojiCode(0x1f9dd, 0x2642), EmojiCode(0x1f9dd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man elf: light skin tone"),*/ qsl("1f9dd-1f3fb-2642"), 1962, EmojiCode(0x1f9dd, 0x1f3fb, 0x2642), EmojiCode(0x1f9dd, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man elf: medium-light skin tone"),*/ qsl("1f9dd-1f3fc-2642"), 1963, EmojiCode(0x1f9dd, 0x1f3fc, 0x2642), EmojiCode(0x1f9dd, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man elf: medium skin tone"),*/ qsl("1f9dd-1f3fd-2642"), 1964, EmojiCode(0x1f9dd, 0x1f3fd, 0x2642), EmojiCode(0x1f9dd, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man elf: medium-dark skin tone"),*/ qsl("1f9dd-1f3fe-2642"), 1965, EmojiCode(0x1f9dd, 0x1f3fe, 0x2642), EmojiCode(0x1f9dd, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man elf: dark skin tone"),*/ qsl("1f9dd-1f3ff-2642"), 1966, EmojiCode(0x1f9dd, 0x1f3ff, 0x2642), EmojiCode(0x1f9dd, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vampire"),*/ qsl("1f9db"), 1967, EmojiCode(0x1f9db)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vampire: light skin tone"),*/ qsl("1f9db-1f3fb"), 1968, EmojiCode(0x1f9db, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vampire: medium-light skin tone"),*/ qsl("1f9db-1f3fc"), 1969, EmojiCode(0x1f9db, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vampire: medium skin tone"),*/ qsl("1f9db-1f3fd"), 1970, EmojiCode(0x1f9db, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vampire: medium-dark skin tone"),*/ qsl("1f9db-1f3fe"), 1971, EmojiCode(0x1f9db, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("vampire: dark skin tone"),*/ qsl("1f9db-1f3ff"), 1972, EmojiCode(0x1f9db, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman vampire"),*/ qsl("1f9db-2640"), 1973, EmojiCode(0x1f9db, 0x2640), EmojiCode(0x1f9db, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman vampire: light skin tone"),*/ qsl("1f9db-1f3fb-2640"), 1974, EmojiCode(0x1f9db, 0x1f3fb, 0x2640), EmojiCode(0x1f9db, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman vampire: medium-light skin tone"),*/ qsl("1f9db-1f3fc-2640"), 1975, EmojiCode(0x1f9db, 0x1f3fc, 0x2640), EmojiCode(0x1f9db, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman vampire: medium skin tone"),*/ qsl("1f9db-1f3fd-2640"), 1976, EmojiCode(0x1f9db, 0x1f3fd, 0x2640), EmojiCode(0x1f9db, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman vampire: medium-dark skin tone"),*/ qsl("1f9db-1f3fe-2640"), 1977, EmojiCode(0x1f9db, 0x1f3fe, 0x2640), EmojiCode(0x1f9db, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman vampire: dark skin tone"),*/ qsl("1f9db-1f3ff-2640"), 1978, EmojiCode(0x1f9db, 0x1f3ff, 0x2640), EmojiCode(0x1f9db, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man vampire"),*/ qsl("1f9db-2642"), 1979, EmojiCode(0x1f9db, 0x2642), EmojiCode(0x1f9db, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man vampire: light skin tone"),*/ qsl("1f9db-1f3fb-2642"), 1980, EmojiCode(0x1f9db, 0x1f3fb, 0x2642), EmojiCode(0x1f9db, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man vampire: medium-light skin tone"),*/ qsl("1f9db-1f3fc-2642"), 1981, EmojiCode(0x1f9db, 0x1f3fc, 0x2642), EmojiCode(0x1f9db, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man vampire: medium skin tone"),*/ qsl("1f9db-1f3fd-2642"), 1982, EmojiCode(0x1f9db, 0x1f3fd, 0x2642), EmojiCode(0x1f9db, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man vampire: medium-dark skin tone"),*/ qsl("1f9db-1f3fe-2642"), 1983, EmojiCode(0x1f9db, 0x1f3fe, 0x2642), EmojiCode(0x1f9db, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man vampire: dark skin tone"),*/ qsl("1f9db-1f3ff-2642"), 1984, EmojiCode(0x1f9db, 0x1f3ff, 0x2642), EmojiCode(0x1f9db, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("zombie"),*/ qsl("1f9df"), 1985, EmojiCode(0x1f9df)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman zombie"),*/ qsl("1f9df-2640"), 1986, EmojiCode(0x1f9df, 0x2640), EmojiCode(0x1f9df, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man zombie"),*/ qsl("1f9df-2642"), 1987, EmojiCode(0x1f9df, 0x2642), EmojiCode(0x1f9df, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("genie"),*/ qsl("1f9de"), 1988, EmojiCode(0x1f9de)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman genie"),*/ qsl("1f9de-2640"), 1989, EmojiCode(0x1f9de, 0x2640), EmojiCode(0x1f9de, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man genie"),*/ qsl("1f9de-2642"), 1990, EmojiCode(0x1f9de, 0x2642), EmojiCode(0x1f9de, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merperson"),*/ qsl("1f9dc"), 1991, EmojiCode(0x1f9dc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merperson: light skin tone"),*/ qsl("1f9dc-1f3fb"), 1992, EmojiCode(0x1f9dc, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merperson: medium-light skin tone"),*/ qsl("1f9dc-1f3fc"), 1993, EmojiCode(0x1f9dc, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merperson: medium skin tone"),*/ qsl("1f9dc-1f3fd"), 1994, EmojiCode(0x1f9dc, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merperson: medium-dark skin tone"),*/ qsl("1f9dc-1f3fe"), 1995, EmojiCode(0x1f9dc, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merperson: dark skin tone"),*/ qsl("1f9dc-1f3ff"), 1996, EmojiCode(0x1f9dc, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mermaid"),*/ qsl("1f9dc-2640"), 1997, EmojiCode(0x1f9dc, 0x2640), EmojiCode(0x1f9dc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mermaid: light skin tone"),*/ qsl("1f9dc-1f3fb-2640"), 1998, EmojiCode(0x1f9dc, 0x1f3fb, 0x2640), EmojiCode(0x1f9dc, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mermaid: medium-light skin tone"),*/ qsl("1f9dc-1f3fc-2640"), 1999, EmojiCode(0x1f9dc, 0x1f3fc, 0x2640), EmojiCode(0x1f9dc, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mermaid: medium skin tone"),*/ qsl("1f9dc-1f3fd-2640"), 2000, EmojiCode(0x1f9dc, 0x1f3fd, 0x2640), EmojiCode(0x1f9dc, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mermaid: medium-dark skin tone"),*/ qsl("1f9dc-1f3fe-2640"), 2001, EmojiCode(0x1f9dc, 0x1f3fe, 0x2640), EmojiCode(0x1f9dc, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("mermaid: dark skin tone"),*/ qsl("1f9dc-1f3ff-2640"), 2002, EmojiCode(0x1f9dc, 0x1f3ff, 0x2640), EmojiCode(0x1f9dc, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merman"),*/ qsl("1f9dc-2642"), 2003, EmojiCode(0x1f9dc, 0x2642), EmojiCode(0x1f9dc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merman: light skin tone"),*/ qsl("1f9dc-1f3fb-2642"), 2004, EmojiCode(0x1f9dc, 0x1f3fb, 0x2642), EmojiCode(0x1f9dc, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merman: medium-light skin tone"),*/ qsl("1f9dc-1f3fc-2642"), 2005, EmojiCode(0x1f9dc, 0x1f3fc, 0x2642), EmojiCode(0x1f9dc, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merman: medium skin tone"),*/ qsl("1f9dc-1f3fd-2642"), 2006, EmojiCode(0x1f9dc, 0x1f3fd, 0x2642), EmojiCode(0x1f9dc, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merman: medium-dark skin tone"),*/ qsl("1f9dc-1f3fe-2642"), 2007, EmojiCode(0x1f9dc, 0x1f3fe, 0x2642), EmojiCode(0x1f9dc, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("merman: dark skin tone"),*/ qsl("1f9dc-1f3ff-2642"), 2008, EmojiCode(0x1f9dc, 0x1f3ff, 0x2642), EmojiCode(0x1f9dc, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("fairy"),*/ qsl("1f9da"), 2009, EmojiCode(0x1f9da)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("fairy: light skin tone"),*/ qsl("1f9da-1f3fb"), 2010, EmojiCode(0x1f9da, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("fairy: medium-light skin tone"),*/ qsl("1f9da-1f3fc"), 2011, EmojiCode(0x1f9da, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("fairy: medium skin tone"),*/ qsl("1f9da-1f3fd"), 2012, EmojiCode(0x1f9da, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("fairy: medium-dark skin tone"),*/ qsl("1f9da-1f3fe"), 2013, EmojiCode(0x1f9da, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("fairy: dark skin tone"),*/ qsl("1f9da-1f3ff"), 2014, EmojiCode(0x1f9da, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman fairy"),*/ qsl("1f9da-2640"), 2015, EmojiCode(0x1f9da, 0x2640), EmojiCode(0x1f9da, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman fairy: light skin tone"),*/ qsl("1f9da-1f3fb-2640"), 2016, EmojiCode(0x1f9da, 0x1f3fb, 0x2640), EmojiCode(0x1f9da, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman fairy: medium-light skin tone"),*/ qsl("1f9da-1f3fc-2640"), 2017, EmojiCode(0x1f9da, 0x1f3fc, 0x2640), EmojiCode(0x1f9da, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman fairy: medium skin tone"),*/ qsl("1f9da-1f3fd-2640"), 2018, EmojiCode(0x1f9da, 0x1f3fd, 0x2640), EmojiCode(0x1f9da, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman fairy: medium-dark skin tone"),*/ qsl("1f9da-1f3fe-2640"), 2019, EmojiCode(0x1f9da, 0x1f3fe, 0x2640), EmojiCode(0x1f9da, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman fairy: dark skin tone"),*/ qsl("1f9da-1f3ff-2640"), 2020, EmojiCode(0x1f9da, 0x1f3ff, 0x2640), EmojiCode(0x1f9da, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man fairy"),*/ qsl("1f9da-2642"), 2021, EmojiCode(0x1f9da, 0x2642), EmojiCode(0x1f9da, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man fairy: light skin tone"),*/ qsl("1f9da-1f3fb-2642"), 2022, EmojiCode(0x1f9da, 0x1f3fb, 0x2642), EmojiCode(0x1f9da, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man fairy: medium-light skin tone"),*/ qsl("1f9da-1f3fc-2642"), 2023, EmojiCode(0x1f9da, 0x1f3fc, 0x2642), EmojiCode(0x1f9da, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man fairy: medium skin tone"),*/ qsl("1f9da-1f3fd-2642"), 2024, EmojiCode(0x1f9da, 0x1f3fd, 0x2642), EmojiCode(0x1f9da, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man fairy: medium-dark skin tone"),*/ qsl("1f9da-1f3fe-2642"), 2025, EmojiCode(0x1f9da, 0x1f3fe, 0x2642), EmojiCode(0x1f9da, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man fairy: dark skin tone"),*/ qsl("1f9da-1f3ff-2642"), 2026, EmojiCode(0x1f9da, 0x1f3ff, 0x2642), EmojiCode(0x1f9da, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby angel"),*/ qsl("1f47c"), 2027, EmojiCode(0x1f47c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby angel: light skin tone"),*/ qsl("1f47c-1f3fb"), 2028, EmojiCode(0x1f47c, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby angel: medium-light skin tone"),*/ qsl("1f47c-1f3fc"), 2029, EmojiCode(0x1f47c, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby angel: medium skin tone"),*/ qsl("1f47c-1f3fd"), 2030, EmojiCode(0x1f47c, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby angel: medium-dark skin tone"),*/ qsl("1f47c-1f3fe"), 2031, EmojiCode(0x1f47c, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("baby angel: dark skin tone"),*/ qsl("1f47c-1f3ff"), 2032, EmojiCode(0x1f47c, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pregnant woman"),*/ qsl("1f930"), 2033, EmojiCode(0x1f930)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pregnant woman: light skin tone"),*/ qsl("1f930-1f3fb"), 2034, EmojiCode(0x1f930, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pregnant woman: medium-light skin tone"),*/ qsl("1f930-1f3fc"), 2035, EmojiCode(0x1f930, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pregnant woman: medium skin tone"),*/ qsl("1f930-1f3fd"), 2036, EmojiCode(0x1f930, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pregnant woman: medium-dark skin tone"),*/ qsl("1f930-1f3fe"), 2037, EmojiCode(0x1f930, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("pregnant woman: dark skin tone"),*/ qsl("1f930-1f3ff"), 2038, EmojiCode(0x1f930, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("breast-feeding"),*/ qsl("1f931"), 2039, EmojiCode(0x1f931)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("breast-feeding: light skin tone"),*/ qsl("1f931-1f3fb"), 2040, EmojiCode(0x1f931, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("breast-feeding: medium-light skin tone"),*/ qsl("1f931-1f3fc"), 2041, EmojiCode(0x1f931, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("breast-feeding: medium skin tone"),*/ qsl("1f931-1f3fd"), 2042, EmojiCode(0x1f931, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("breast-feeding: medium-dark skin tone"),*/ qsl("1f931-1f3fe"), 2043, EmojiCode(0x1f931, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("breast-feeding: dark skin tone"),*/ qsl("1f931-1f3ff"), 2044, EmojiCode(0x1f931, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person bowing"),*/ qsl("1f647"), 2045, EmojiCode(0x1f647)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person bowing: light skin tone"),*/ qsl("1f647-1f3fb"), 2046, EmojiCode(0x1f647, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person bowing: medium-light skin tone"),*/ qsl("1f647-1f3fc"), 2047, EmojiCode(0x1f647, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person bowing: medium skin tone"),*/ qsl("1f647-1f3fd"), 2048, EmojiCode(0x1f647, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person bowing: medium-dark skin tone"),*/ qsl("1f647-1f3fe"), 2049, EmojiCode(0x1f647, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person bowing: dark skin tone"),*/ qsl("1f647-1f3ff"), 2050, EmojiCode(0x1f647, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman bowing"),*/ qsl("1f647-2640"), 2051, EmojiCode(0x1f647, 0x2640), EmojiCode(0x1f647, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman bowing: light skin tone"),*/ qsl("1f647-1f3fb-2640"), 2052, EmojiCode(0x1f647, 0x1f3fb, 0x2640), EmojiCode(0x1f647, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman bowing: medium-light skin tone"),*/ qsl("1f647-1f3fc-2640"), 2053, EmojiCode(0x1f647, 0x1f3fc, 0x2640), EmojiCode(0x1f647, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman bowing: medium skin tone"),*/ qsl("1f647-1f3fd-2640"), 2054, EmojiCode(0x1f647, 0x1f3fd, 0x2640), EmojiCode(0x1f647, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman bowing: medium-dark skin tone"),*/ qsl("1f647-1f3fe-2640"), 2055, EmojiCode(0x1f647, 0x1f3fe, 0x2640), EmojiCode(0x1f647, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman bowing: dark skin tone"),*/ qsl("1f647-1f3ff-2640"), 2056, EmojiCode(0x1f647, 0x1f3ff, 0x2640), EmojiCode(0x1f647, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man bowing"),*/ qsl("1f647-2642"), 2057, EmojiCode(0x1f647, 0x2642), EmojiCode(0x1f647, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man bowing: light skin tone"),*/ qsl("1f647-1f3fb-2642"), 2058, EmojiCode(0x1f647, 0x1f3fb, 0x2642), EmojiCode(0x1f647, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man bowing: medium-light skin tone"),*/ qsl("1f647-1f3fc-2642"), 2059, EmojiCode(0x1f647, 0x1f3fc, 0x2642), EmojiCode(0x1f647, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man bowing: medium skin tone"),*/ qsl("1f647-1f3fd-2642"), 2060, EmojiCode(0x1f647, 0x1f3fd, 0x2642), EmojiCode(0x1f647, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man bowing: medium-dark skin tone"),*/ qsl("1f647-1f3fe-2642"), 2061, EmojiCode(0x1f647, 0x1f3fe, 0x2642), EmojiCode(0x1f647, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man bowing: dark skin tone"),*/ qsl("1f647-1f3ff-2642"), 2062, EmojiCode(0x1f647, 0x1f3ff, 0x2642), EmojiCode(0x1f647, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person tipping hand"),*/ qsl("1f481"), 2063, EmojiCode(0x1f481)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person tipping hand: light skin tone"),*/ qsl("1f481-1f3fb"), 2064, EmojiCode(0x1f481, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person tipping hand: medium-light skin tone"),*/ qsl("1f481-1f3fc"), 2065, EmojiCode(0x1f481, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person tipping hand: medium skin tone"),*/ qsl("1f481-1f3fd"), 2066, EmojiCode(0x1f481, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person tipping hand: medium-dark skin tone"),*/ qsl("1f481-1f3fe"), 2067, EmojiCode(0x1f481, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person tipping hand: dark skin tone"),*/ qsl("1f481-1f3ff"), 2068, EmojiCode(0x1f481, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman tipping hand"),*/ qsl("1f481-2640"), 2069, EmojiCode(0x1f481, 0x2640), EmojiCode(0x1f481, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman tipping hand: light skin tone"),*/ qsl("1f481-1f3fb-2640"), 2070, EmojiCode(0x1f481, 0x1f3fb, 0x2640), EmojiCode(0x1f481, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman tipping hand: medium-light skin tone"),*/ qsl("1f481-1f3fc-2640"), 2071, EmojiCode(0x1f481, 0x1f3fc, 0x2640), EmojiCode(0x1f481, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman tipping hand: medium skin tone"),*/ qsl("1f481-1f3fd-2640"), 2072, EmojiCode(0x1f481, 0x1f3fd, 0x2640), EmojiCode(0x1f481, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman tipping hand: medium-dark skin tone"),*/ qsl("1f481-1f3fe-2640"), 2073, EmojiCode(0x1f481, 0x1f3fe, 0x2640), EmojiCode(0x1f481, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman tipping hand: dark skin tone"),*/ qsl("1f481-1f3ff-2640"), 2074, EmojiCode(0x1f481, 0x1f3ff, 0x2640), EmojiCode(0x1f481, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man tipping hand"),*/ qsl("1f481-2642"), 2075, EmojiCode(0x1f481, 0x2642), EmojiCode(0x1f481, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man tipping hand: light skin tone"),*/ qsl("1f481-1f3fb-2642"), 2076, EmojiCode(0x1f481, 0x1f3fb, 0x2642), EmojiCode(0x1f481, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man tipping hand: medium-light skin tone"),*/ qsl("1f481-1f3fc-2642"), 2077, EmojiCode(0x1f481, 0x1f3fc, 0x2642), EmojiCode(0x1f481, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man tipping hand: medium skin tone"),*/ qsl("1f481-1f3fd-2642"), 2078, EmojiCode(0x1f481, 0x1f3fd, 0x2642), EmojiCode(0x1f481, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man tipping hand: medium-dark skin tone"),*/ qsl("1f481-1f3fe-2642"), 2079, EmojiCode(0x1f481, 0x1f3fe, 0x2642), EmojiCode(0x1f481, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man tipping hand: dark skin tone"),*/ qsl("1f481-1f3ff-2642"), 2080, EmojiCode(0x1f481, 0x1f3ff, 0x2642), EmojiCode(0x1f481, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing NO"),*/ qsl("1f645"), 2081, EmojiCode(0x1f645)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing NO: light skin tone"),*/ qsl("1f645-1f3fb"), 2082, EmojiCode(0x1f645, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing NO: medium-light skin tone"),*/ qsl("1f645-1f3fc"), 2083, EmojiCode(0x1f645, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing NO: medium skin tone"),*/ qsl("1f645-1f3fd"), 2084, EmojiCode(0x1f645, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing NO: medium-dark skin tone"),*/ qsl("1f645-1f3fe"), 2085, EmojiCode(0x1f645, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing NO: dark skin tone"),*/ qsl("1f645-1f3ff"), 2086, EmojiCode(0x1f645, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing NO"),*/ qsl("1f645-2640"), 2087, EmojiCode(0x1f645, 0x2640), EmojiCode(0x1f645, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing NO: light skin tone"),*/ qsl("1f645-1f3fb-2640"), 2088, EmojiCode(0x1f645, 0x1f3fb, 0x2640), EmojiCode(0x1f645, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing NO: medium-light skin tone"),*/ qsl("1f645-1f3fc-2640"), 2089, EmojiCode(0x1f645, 0x1f3fc, 0x2640), EmojiCode(0x1f645, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing NO: medium skin tone"),*/ qsl("1f645-1f3fd-2640"), 2090, EmojiCode(0x1f645, 0x1f3fd, 0x2640), EmojiCode(0x1f645, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing NO: medium-dark skin tone"),*/ qsl("1f645-1f3fe-2640"), 2091, EmojiCode(0x1f645, 0x1f3fe, 0x2640), EmojiCode(0x1f645, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing NO: dark skin tone"),*/ qsl("1f645-1f3ff-2640"), 2092, EmojiCode(0x1f645, 0x1f3ff, 0x2640), EmojiCode(0x1f645, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing NO"),*/ qsl("1f645-2642"), 2093, EmojiCode(0x1f645, 0x2642), EmojiCode(0x1f645, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing NO: light skin tone"),*/ qsl("1f645-1f3fb-2642"), 2094, EmojiCode(0x1f645, 0x1f3fb, 0x2642), EmojiCode(0x1f645, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing NO: medium-light skin tone"),*/ qsl("1f645-1f3fc-2642"), 2095, EmojiCode(0x1f645, 0x1f3fc, 0x2642), EmojiCode(0x1f645, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing NO: medium skin tone"),*/ qsl("1f645-1f3fd-2642"), 2096, EmojiCode(0x1f645, 0x1f3fd, 0x2642), EmojiCode(0x1f645, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing NO: medium-dark skin tone"),*/ qsl("1f645-1f3fe-2642"), 2097, EmojiCode(0x1f645, 0x1f3fe, 0x2642), EmojiCode(0x1f645, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing NO: dark skin tone"),*/ qsl("1f645-1f3ff-2642"), 2098, EmojiCode(0x1f645, 0x1f3ff, 0x2642), EmojiCode(0x1f645, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing OK"),*/ qsl("1f646"), 2099, EmojiCode(0x1f646)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing OK: light skin tone"),*/ qsl("1f646-1f3fb"), 2100, EmojiCode(0x1f646, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing OK: medium-light skin tone"),*/ qsl("1f646-1f3fc"), 2101, EmojiCode(0x1f646, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing OK: medium skin tone"),*/ qsl("1f646-1f3fd"), 2102, EmojiCode(0x1f646, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing OK: medium-dark skin tone"),*/ qsl("1f646-1f3fe"), 2103, EmojiCode(0x1f646, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person gesturing OK: dark skin tone"),*/ qsl("1f646-1f3ff"), 2104, EmojiCode(0x1f646, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing OK"),*/ qsl("1f646-2640"), 2105, EmojiCode(0x1f646, 0x2640), EmojiCode(0x1f646, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing OK: light skin tone"),*/ qsl("1f646-1f3fb-2640"), 2106, EmojiCode(0x1f646, 0x1f3fb, 0x2640), EmojiCode(0x1f646, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing OK: medium-light skin tone"),*/ qsl("1f646-1f3fc-2640"), 2107, EmojiCode(0x1f646, 0x1f3fc, 0x2640), EmojiCode(0x1f646, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing OK: medium skin tone"),*/ qsl("1f646-1f3fd-2640"), 2108, EmojiCode(0x1f646, 0x1f3fd, 0x2640), EmojiCode(0x1f646, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing OK: medium-dark skin tone"),*/ qsl("1f646-1f3fe-2640"), 2109, EmojiCode(0x1f646, 0x1f3fe, 0x2640), EmojiCode(0x1f646, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman gesturing OK: dark skin tone"),*/ qsl("1f646-1f3ff-2640"), 2110, EmojiCode(0x1f646, 0x1f3ff, 0x2640), EmojiCode(0x1f646, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing OK"),*/ qsl("1f646-2642"), 2111, EmojiCode(0x1f646, 0x2642), EmojiCode(0x1f646, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing OK: light skin tone"),*/ qsl("1f646-1f3fb-2642"), 2112, EmojiCode(0x1f646, 0x1f3fb, 0x2642), EmojiCode(0x1f646, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing OK: medium-light skin tone"),*/ qsl("1f646-1f3fc-2642"), 2113, EmojiCode(0x1f646, 0x1f3fc, 0x2642), EmojiCode(0x1f646, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing OK: medium skin tone"),*/ qsl("1f646-1f3fd-2642"), 2114, EmojiCode(0x1f646, 0x1f3fd, 0x2642), EmojiCode(0x1f646, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing OK: medium-dark skin tone"),*/ qsl("1f646-1f3fe-2642"), 2115, EmojiCode(0x1f646, 0x1f3fe, 0x2642), EmojiCode(0x1f646, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man gesturing OK: dark skin tone"),*/ qsl("1f646-1f3ff-2642"), 2116, EmojiCode(0x1f646, 0x1f3ff, 0x2642), EmojiCode(0x1f646, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person raising hand"),*/ qsl("1f64b"), 2117, EmojiCode(0x1f64b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person raising hand: light skin tone"),*/ qsl("1f64b-1f3fb"), 2118, EmojiCode(0x1f64b, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person raising hand: medium-light skin tone"),*/ qsl("1f64b-1f3fc"), 2119, EmojiCode(0x1f64b, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person raising hand: medium skin tone"),*/ qsl("1f64b-1f3fd"), 2120, EmojiCode(0x1f64b, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person raising hand: medium-dark skin tone"),*/ qsl("1f64b-1f3fe"), 2121, EmojiCode(0x1f64b, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person raising hand: dark skin tone"),*/ qsl("1f64b-1f3ff"), 2122, EmojiCode(0x1f64b, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman raising hand"),*/ qsl("1f64b-2640"), 2123, EmojiCode(0x1f64b, 0x2640), EmojiCode(0x1f64b, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman raising hand: light skin tone"),*/ qsl("1f64b-1f3fb-2640"), 2124, EmojiCode(0x1f64b, 0x1f3fb, 0x2640), EmojiCode(0x1f64b, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman raising hand: medium-light skin tone"),*/ qsl("1f64b-1f3fc-2640"), 2125, EmojiCode(0x1f64b, 0x1f3fc, 0x2640), EmojiCode(0x1f64b, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman raising hand: medium skin tone"),*/ qsl("1f64b-1f3fd-2640"), 2126, EmojiCode(0x1f64b, 0x1f3fd, 0x2640), EmojiCode(0x1f64b, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman raising hand: medium-dark skin tone"),*/ qsl("1f64b-1f3fe-2640"), 2127, EmojiCode(0x1f64b, 0x1f3fe, 0x2640), EmojiCode(0x1f64b, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman raising hand: dark skin tone"),*/ qsl("1f64b-1f3ff-2640"), 2128, EmojiCode(0x1f64b, 0x1f3ff, 0x2640), EmojiCode(0x1f64b, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man raising hand"),*/ qsl("1f64b-2642"), 2129, EmojiCode(0x1f64b, 0x2642), EmojiCode(0x1f64b, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man raising hand: light skin tone"),*/ qsl("1f64b-1f3fb-2642"), 2130, EmojiCode(0x1f64b, 0x1f3fb, 0x2642), EmojiCode(0x1f64b, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man raising hand: medium-light skin tone"),*/ qsl("1f64b-1f3fc-2642"), 2131, EmojiCode(0x1f64b, 0x1f3fc, 0x2642), EmojiCode(0x1f64b, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man raising hand: medium skin tone"),*/ qsl("1f64b-1f3fd-2642"), 2132, EmojiCode(0x1f64b, 0x1f3fd, 0x2642), EmojiCode(0x1f64b, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man raising hand: medium-dark skin tone"),*/ qsl("1f64b-1f3fe-2642"), 2133, EmojiCode(0x1f64b, 0x1f3fe, 0x2642), EmojiCode(0x1f64b, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man raising hand: dark skin tone"),*/ qsl("1f64b-1f3ff-2642"), 2134, EmojiCode(0x1f64b, 0x1f3ff, 0x2642), EmojiCode(0x1f64b, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person facepalming"),*/ qsl("1f926"), 2135, EmojiCode(0x1f926)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person facepalming: light skin tone"),*/ qsl("1f926-1f3fb"), 2136, EmojiCode(0x1f926, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person facepalming: medium-light skin tone"),*/ qsl("1f926-1f3fc"), 2137, EmojiCode(0x1f926, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person facepalming: medium skin tone"),*/ qsl("1f926-1f3fd"), 2138, EmojiCode(0x1f926, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person facepalming: medium-dark skin tone"),*/ qsl("1f926-1f3fe"), 2139, EmojiCode(0x1f926, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person facepalming: dark skin tone"),*/ qsl("1f926-1f3ff"), 2140, EmojiCode(0x1f926, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman facepalming"),*/ qsl("1f926-2640"), 2141, EmojiCode(0x1f926, 0x2640), EmojiCode(0x1f926, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman facepalming: light skin tone"),*/ qsl("1f926-1f3fb-2640"), 2142, EmojiCode(0x1f926, 0x1f3fb, 0x2640), EmojiCode(0x1f926, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman facepalming: medium-light skin tone"),*/ qsl("1f926-1f3fc-2640"), 2143, EmojiCode(0x1f926, 0x1f3fc, 0x2640), EmojiCode(0x1f926, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman facepalming: medium skin tone"),*/ qsl("1f926-1f3fd-2640"), 2144, EmojiCode(0x1f926, 0x1f3fd, 0x2640), EmojiCode(0x1f926, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman facepalming: medium-dark skin tone"),*/ qsl("1f926-1f3fe-2640"), 2145, EmojiCode(0x1f926, 0x1f3fe, 0x2640), EmojiCode(0x1f926, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman facepalming: dark skin tone"),*/ qsl("1f926-1f3ff-2640"), 2146, EmojiCode(0x1f926, 0x1f3ff, 0x2640), EmojiCode(0x1f926, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man facepalming"),*/ qsl("1f926-2642"), 2147, EmojiCode(0x1f926, 0x2642), EmojiCode(0x1f926, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man facepalming: light skin tone"),*/ qsl("1f926-1f3fb-2642"), 2148, EmojiCode(0x1f926, 0x1f3fb, 0x2642), EmojiCode(0x1f926, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man facepalming: medium-light skin tone"),*/ qsl("1f926-1f3fc-2642"), 2149, EmojiCode(0x1f926, 0x1f3fc, 0x2642), EmojiCode(0x1f926, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man facepalming: medium skin tone"),*/ qsl("1f926-1f3fd-2642"), 2150, EmojiCode(0x1f926, 0x1f3fd, 0x2642), EmojiCode(0x1f926, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man facepalming: medium-dark skin tone"),*/ qsl("1f926-1f3fe-2642"), 2151, EmojiCode(0x1f926, 0x1f3fe, 0x2642), EmojiCode(0x1f926, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man facepalming: dark skin tone"),*/ qsl("1f926-1f3ff-2642"), 2152, EmojiCode(0x1f926, 0x1f3ff, 0x2642), EmojiCode(0x1f926, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person shrugging"),*/ qsl("1f937"), 2153, EmojiCode(0x1f937)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person shrugging: light skin tone"),*/ qsl("1f937-1f3fb"), 2154, EmojiCode(0x1f937, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person shrugging: medium-light skin tone"),*/ qsl("1f937-1f3fc"), 2155, EmojiCode(0x1f937, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person shrugging: medium skin tone"),*/ qsl("1f937-1f3fd"), 2156, EmojiCode(0x1f937, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person shrugging: medium-dark skin tone"),*/ qsl("1f937-1f3fe"), 2157, EmojiCode(0x1f937, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person shrugging: dark skin tone"),*/ qsl("1f937-1f3ff"), 2158, EmojiCode(0x1f937, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman shrugging"),*/ qsl("1f937-2640"), 2159, EmojiCode(0x1f937, 0x2640), EmojiCode(0x1f937, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman shrugging: light skin tone"),*/ qsl("1f937-1f3fb-2640"), 2160, EmojiCode(0x1f937, 0x1f3fb, 0x2640), EmojiCode(0x1f937, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman shrugging: medium-light skin tone"),*/ qsl("1f937-1f3fc-2640"), 2161, EmojiCode(0x1f937, 0x1f3fc, 0x2640), EmojiCode(0x1f937, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman shrugging: medium skin tone"),*/ qsl("1f937-1f3fd-2640"), 2162, EmojiCode(0x1f937, 0x1f3fd, 0x2640), EmojiCode(0x1f937, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman shrugging: medium-dark skin tone"),*/ qsl("1f937-1f3fe-2640"), 2163, EmojiCode(0x1f937, 0x1f3fe, 0x2640), EmojiCode(0x1f937, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman shrugging: dark skin tone"),*/ qsl("1f937-1f3ff-2640"), 2164, EmojiCode(0x1f937, 0x1f3ff, 0x2640), EmojiCode(0x1f937, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man shrugging"),*/ qsl("1f937-2642"), 2165, EmojiCode(0x1f937, 0x2642), EmojiCode(0x1f937, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man shrugging: light skin tone"),*/ qsl("1f937-1f3fb-2642"), 2166, EmojiCode(0x1f937, 0x1f3fb, 0x2642), EmojiCode(0x1f937, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man shrugging: medium-light skin tone"),*/ qsl("1f937-1f3fc-2642"), 2167, EmojiCode(0x1f937, 0x1f3fc, 0x2642), EmojiCode(0x1f937, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man shrugging: medium skin tone"),*/ qsl("1f937-1f3fd-2642"), 2168, EmojiCode(0x1f937, 0x1f3fd, 0x2642), EmojiCode(0x1f937, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man shrugging: medium-dark skin tone"),*/ qsl("1f937-1f3fe-2642"), 2169, EmojiCode(0x1f937, 0x1f3fe, 0x2642), EmojiCode(0x1f937, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man shrugging: dark skin tone"),*/ qsl("1f937-1f3ff-2642"), 2170, EmojiCode(0x1f937, 0x1f3ff, 0x2642), EmojiCode(0x1f937, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person pouting"),*/ qsl("1f64e"), 2171, EmojiCode(0x1f64e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person pouting: light skin tone"),*/ qsl("1f64e-1f3fb"), 2172, EmojiCode(0x1f64e, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person pouting: medium-light skin tone"),*/ qsl("1f64e-1f3fc"), 2173, EmojiCode(0x1f64e, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person pouting: medium skin tone"),*/ qsl("1f64e-1f3fd"), 2174, EmojiCode(0x1f64e, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person pouting: medium-dark skin tone"),*/ qsl("1f64e-1f3fe"), 2175, EmojiCode(0x1f64e, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person pouting: dark skin tone"),*/ qsl("1f64e-1f3ff"), 2176, EmojiCode(0x1f64e, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pouting"),*/ qsl("1f64e-2640"), 2177, EmojiCode(0x1f64e, 0x2640), EmojiCode(0x1f64e, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pouting: light skin tone"),*/ qsl("1f64e-1f3fb-2640"), 2178, EmojiCode(0x1f64e, 0x1f3fb, 0x2640), EmojiCode(0x1f64e, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pouting: medium-light skin tone"),*/ qsl("1f64e-1f3fc-2640"), 2179, EmojiCode(0x1f64e, 0x1f3fc, 0x2640), EmojiCode(0x1f64e, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pouting: medium skin tone"),*/ qsl("1f64e-1f3fd-2640"), 2180, EmojiCode(0x1f64e, 0x1f3fd, 0x2640), EmojiCode(0x1f64e, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pouting: medium-dark skin tone"),*/ qsl("1f64e-1f3fe-2640"), 2181, EmojiCode(0x1f64e, 0x1f3fe, 0x2640), EmojiCode(0x1f64e, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman pouting: dark skin tone"),*/ qsl("1f64e-1f3ff-2640"), 2182, EmojiCode(0x1f64e, 0x1f3ff, 0x2640), EmojiCode(0x1f64e, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pouting"),*/ qsl("1f64e-2642"), 2183, EmojiCode(0x1f64e, 0x2642), EmojiCode(0x1f64e, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pouting: light skin tone"),*/ qsl("1f64e-1f3fb-2642"), 2184, EmojiCode(0x1f64e, 0x1f3fb, 0x2642), EmojiCode(0x1f64e, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pouting: medium-light skin tone"),*/ qsl("1f64e-1f3fc-2642"), 2185, EmojiCode(0x1f64e, 0x1f3fc, 0x2642), EmojiCode(0x1f64e, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pouting: medium skin tone"),*/ qsl("1f64e-1f3fd-2642"), 2186, EmojiCode(0x1f64e, 0x1f3fd, 0x2642), EmojiCode(0x1f64e, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pouting: medium-dark skin tone"),*/ qsl("1f64e-1f3fe-2642"), 2187, EmojiCode(0x1f64e, 0x1f3fe, 0x2642), EmojiCode(0x1f64e, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man pouting: dark skin tone"),*/ qsl("1f64e-1f3ff-2642"), 2188, EmojiCode(0x1f64e, 0x1f3ff, 0x2642), EmojiCode(0x1f64e, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person frowning"),*/ qsl("1f64d"), 2189, EmojiCode(0x1f64d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person frowning: light skin tone"),*/ qsl("1f64d-1f3fb"), 2190, EmojiCode(0x1f64d, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person frowning: medium-light skin tone"),*/ qsl("1f64d-1f3fc"), 2191, EmojiCode(0x1f64d, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person frowning: medium skin tone"),*/ qsl("1f64d-1f3fd"), 2192, EmojiCode(0x1f64d, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person frowning: medium-dark skin tone"),*/ qsl("1f64d-1f3fe"), 2193, EmojiCode(0x1f64d, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person frowning: dark skin tone"),*/ qsl("1f64d-1f3ff"), 2194, EmojiCode(0x1f64d, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman frowning"),*/ qsl("1f64d-2640"), 2195, EmojiCode(0x1f64d, 0x2640), EmojiCode(0x1f64d, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman frowning: light skin tone"),*/ qsl("1f64d-1f3fb-2640"), 2196, EmojiCode(0x1f64d, 0x1f3fb, 0x2640), EmojiCode(0x1f64d, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman frowning: medium-light skin tone"),*/ qsl("1f64d-1f3fc-2640"), 2197, EmojiCode(0x1f64d, 0x1f3fc, 0x2640), EmojiCode(0x1f64d, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman frowning: medium skin tone"),*/ qsl("1f64d-1f3fd-2640"), 2198, EmojiCode(0x1f64d, 0x1f3fd, 0x2640), EmojiCode(0x1f64d, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman frowning: medium-dark skin tone"),*/ qsl("1f64d-1f3fe-2640"), 2199, EmojiCode(0x1f64d, 0x1f3fe, 0x2640), EmojiCode(0x1f64d, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman frowning: dark skin tone"),*/ qsl("1f64d-1f3ff-2640"), 2200, EmojiCode(0x1f64d, 0x1f3ff, 0x2640), EmojiCode(0x1f64d, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man frowning"),*/ qsl("1f64d-2642"), 2201, EmojiCode(0x1f64d, 0x2642), EmojiCode(0x1f64d, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man frowning: light skin tone"),*/ qsl("1f64d-1f3fb-2642"), 2202, EmojiCode(0x1f64d, 0x1f3fb, 0x2642), EmojiCode(0x1f64d, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man frowning: medium-light skin tone"),*/ qsl("1f64d-1f3fc-2642"), 2203, EmojiCode(0x1f64d, 0x1f3fc, 0x2642), EmojiCode(0x1f64d, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man frowning: medium skin tone"),*/ qsl("1f64d-1f3fd-2642"), 2204, EmojiCode(0x1f64d, 0x1f3fd, 0x2642), EmojiCode(0x1f64d, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man frowning: medium-dark skin tone"),*/ qsl("1f64d-1f3fe-2642"), 2205, EmojiCode(0x1f64d, 0x1f3fe, 0x2642), EmojiCode(0x1f64d, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man frowning: dark skin tone"),*/ qsl("1f64d-1f3ff-2642"), 2206, EmojiCode(0x1f64d, 0x1f3ff, 0x2642), EmojiCode(0x1f64d, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting haircut"),*/ qsl("1f487"), 2207, EmojiCode(0x1f487)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting haircut: light skin tone"),*/ qsl("1f487-1f3fb"), 2208, EmojiCode(0x1f487, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting haircut: medium-light skin tone"),*/ qsl("1f487-1f3fc"), 2209, EmojiCode(0x1f487, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting haircut: medium skin tone"),*/ qsl("1f487-1f3fd"), 2210, EmojiCode(0x1f487, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting haircut: medium-dark skin tone"),*/ qsl("1f487-1f3fe"), 2211, EmojiCode(0x1f487, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting haircut: dark skin tone"),*/ qsl("1f487-1f3ff"), 2212, EmojiCode(0x1f487, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting haircut"),*/ qsl("1f487-2640"), 2213, EmojiCode(0x1f487, 0x2640), EmojiCode(0x1f487, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting haircut: light skin tone"),*/ qsl("1f487-1f3fb-2640"), 2214, EmojiCode(0x1f487, 0x1f3fb, 0x2640), EmojiCode(0x1f487, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting haircut: medium-light skin tone"),*/ qsl("1f487-1f3fc-2640"), 2215, EmojiCode(0x1f487, 0x1f3fc, 0x2640), EmojiCode(0x1f487, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting haircut: medium skin tone"),*/ qsl("1f487-1f3fd-2640"), 2216, EmojiCode(0x1f487, 0x1f3fd, 0x2640), EmojiCode(0x1f487, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting haircut: medium-dark skin tone"),*/ qsl("1f487-1f3fe-2640"), 2217, EmojiCode(0x1f487, 0x1f3fe, 0x2640), EmojiCode(0x1f487, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting haircut: dark skin tone"),*/ qsl("1f487-1f3ff-2640"), 2218, EmojiCode(0x1f487, 0x1f3ff, 0x2640), EmojiCode(0x1f487, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting haircut"),*/ qsl("1f487-2642"), 2219, EmojiCode(0x1f487, 0x2642), EmojiCode(0x1f487, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting haircut: light skin tone"),*/ qsl("1f487-1f3fb-2642"), 2220, EmojiCode(0x1f487, 0x1f3fb, 0x2642), EmojiCode(0x1f487, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting haircut: medium-light skin tone"),*/ qsl("1f487-1f3fc-2642"), 2221, EmojiCode(0x1f487, 0x1f3fc, 0x2642), EmojiCode(0x1f487, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting haircut: medium skin tone"),*/ qsl("1f487-1f3fd-2642"), 2222, EmojiCode(0x1f487, 0x1f3fd, 0x2642), EmojiCode(0x1f487, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting haircut: medium-dark skin tone"),*/ qsl("1f487-1f3fe-2642"), 2223, EmojiCode(0x1f487, 0x1f3fe, 0x2642), EmojiCode(0x1f487, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting haircut: dark skin tone"),*/ qsl("1f487-1f3ff-2642"), 2224, EmojiCode(0x1f487, 0x1f3ff, 0x2642), EmojiCode(0x1f487, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting massage"),*/ qsl("1f486"), 2225, EmojiCode(0x1f486)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting massage: light skin tone"),*/ qsl("1f486-1f3fb"), 2226, EmojiCode(0x1f486, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting massage: medium-light skin tone"),*/ qsl("1f486-1f3fc"), 2227, EmojiCode(0x1f486, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting massage: medium skin tone"),*/ qsl("1f486-1f3fd"), 2228, EmojiCode(0x1f486, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting massage: medium-dark skin tone"),*/ qsl("1f486-1f3fe"), 2229, EmojiCode(0x1f486, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person getting massage: dark skin tone"),*/ qsl("1f486-1f3ff"), 2230, EmojiCode(0x1f486, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting massage"),*/ qsl("1f486-2640"), 2231, EmojiCode(0x1f486, 0x2640), EmojiCode(0x1f486, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting massage: light skin tone"),*/ qsl("1f486-1f3fb-2640"), 2232, EmojiCode(0x1f486, 0x1f3fb, 0x2640), EmojiCode(0x1f486, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting massage: medium-light skin tone"),*/ qsl("1f486-1f3fc-2640"), 2233, EmojiCode(0x1f486, 0x1f3fc, 0x2640), EmojiCode(0x1f486, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting massage: medium skin tone"),*/ qsl("1f486-1f3fd-2640"), 2234, EmojiCode(0x1f486, 0x1f3fd, 0x2640), EmojiCode(0x1f486, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting massage: medium-dark skin tone"),*/ qsl("1f486-1f3fe-2640"), 2235, EmojiCode(0x1f486, 0x1f3fe, 0x2640), EmojiCode(0x1f486, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman getting massage: dark skin tone"),*/ qsl("1f486-1f3ff-2640"), 2236, EmojiCode(0x1f486, 0x1f3ff, 0x2640), EmojiCode(0x1f486, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting massage"),*/ qsl("1f486-2642"), 2237, EmojiCode(0x1f486, 0x2642), EmojiCode(0x1f486, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting massage: light skin tone"),*/ qsl("1f486-1f3fb-2642"), 2238, EmojiCode(0x1f486, 0x1f3fb, 0x2642), EmojiCode(0x1f486, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting massage: medium-light skin tone"),*/ qsl("1f486-1f3fc-2642"), 2239, EmojiCode(0x1f486, 0x1f3fc, 0x2642), EmojiCode(0x1f486, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting massage: medium skin tone"),*/ qsl("1f486-1f3fd-2642"), 2240, EmojiCode(0x1f486, 0x1f3fd, 0x2642), EmojiCode(0x1f486, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting massage: medium-dark skin tone"),*/ qsl("1f486-1f3fe-2642"), 2241, EmojiCode(0x1f486, 0x1f3fe, 0x2642), EmojiCode(0x1f486, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man getting massage: dark skin tone"),*/ qsl("1f486-1f3ff-2642"), 2242, EmojiCode(0x1f486, 0x1f3ff, 0x2642), EmojiCode(0x1f486, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person in steamy room"),*/ qsl("1f9d6"), 2243, EmojiCode(0x1f9d6)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person in steamy room: light skin tone"),*/ qsl("1f9d6-1f3fb"), 2244, EmojiCode(0x1f9d6, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person in steamy room: medium-light skin tone"),*/ qsl("1f9d6-1f3fc"), 2245, EmojiCode(0x1f9d6, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person in steamy room: medium skin tone"),*/ qsl("1f9d6-1f3fd"), 2246, EmojiCode(0x1f9d6, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person in steamy room: medium-dark skin tone"),*/ qsl("1f9d6-1f3fe"), 2247, EmojiCode(0x1f9d6, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person in steamy room: dark skin tone"),*/ qsl("1f9d6-1f3ff"), 2248, EmojiCode(0x1f9d6, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman in steamy room"),*/ qsl("1f9d6-2640"), 2249, EmojiCode(0x1f9d6, 0x2640), EmojiCode(0x1f9d6, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman in steamy room: light skin tone"),*/ qsl("1f9d6-1f3fb-2640"), 2250, EmojiCode(0x1f9d6, 0x1f3fb, 0x2640), EmojiCode(0x1f9d6, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman in steamy room: medium-light skin tone"),*/ qsl("1f9d6-1f3fc-2640"), 2251, EmojiCode(0x1f9d6, 0x1f3fc, 0x2640), EmojiCode(0x1f9d6, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman in steamy room: medium skin tone"),*/ qsl("1f9d6-1f3fd-2640"), 2252, EmojiCode(0x1f9d6, 0x1f3fd, 0x2640), EmojiCode(0x1f9d6, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman in steamy room: medium-dark skin tone"),*/ qsl("1f9d6-1f3fe-2640"), 2253, EmojiCode(0x1f9d6, 0x1f3fe, 0x2640), EmojiCode(0x1f9d6, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman in steamy room: dark skin tone"),*/ qsl("1f9d6-1f3ff-2640"), 2254, EmojiCode(0x1f9d6, 0x1f3ff, 0x2640), EmojiCode(0x1f9d6, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in steamy room"),*/ qsl("1f9d6-2642"), 2255, EmojiCode(0x1f9d6, 0x2642), EmojiCode(0x1f9d6, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in steamy room: light skin tone"),*/ qsl("1f9d6-1f3fb-2642"), 2256, EmojiCode(0x1f9d6, 0x1f3fb, 0x2642), EmojiCode(0x1f9d6, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in steamy room: medium-light skin tone"),*/ qsl("1f9d6-1f3fc-2642"), 2257, EmojiCode(0x1f9d6, 0x1f3fc, 0x2642), EmojiCode(0x1f9d6, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in steamy room: medium skin tone"),*/ qsl("1f9d6-1f3fd-2642"), 2258, EmojiCode(0x1f9d6, 0x1f3fd, 0x2642), EmojiCode(0x1f9d6, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in steamy room: medium-dark skin tone"),*/ qsl("1f9d6-1f3fe-2642"), 2259, EmojiCode(0x1f9d6, 0x1f3fe, 0x2642), EmojiCode(0x1f9d6, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in steamy room: dark skin tone"),*/ qsl("1f9d6-1f3ff-2642"), 2260, EmojiCode(0x1f9d6, 0x1f3ff, 0x2642), EmojiCode(0x1f9d6, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nail polish"),*/ qsl("1f485"), 2261, EmojiCode(0x1f485)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nail polish: light skin tone"),*/ qsl("1f485-1f3fb"), 2262, EmojiCode(0x1f485, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nail polish: medium-light skin tone"),*/ qsl("1f485-1f3fc"), 2263, EmojiCode(0x1f485, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nail polish: medium skin tone"),*/ qsl("1f485-1f3fd"), 2264, EmojiCode(0x1f485, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nail polish: medium-dark skin tone"),*/ qsl("1f485-1f3fe"), 2265, EmojiCode(0x1f485, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("nail polish: dark skin tone"),*/ qsl("1f485-1f3ff"), 2266, EmojiCode(0x1f485, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("selfie"),*/ qsl("1f933"), 2267, EmojiCode(0x1f933)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("selfie: light skin tone"),*/ qsl("1f933-1f3fb"), 2268, EmojiCode(0x1f933, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("selfie: medium-light skin tone"),*/ qsl("1f933-1f3fc"), 2269, EmojiCode(0x1f933, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("selfie: medium skin tone"),*/ qsl("1f933-1f3fd"), 2270, EmojiCode(0x1f933, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("selfie: medium-dark skin tone"),*/ qsl("1f933-1f3fe"), 2271, EmojiCode(0x1f933, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("selfie: dark skin tone"),*/ qsl("1f933-1f3ff"), 2272, EmojiCode(0x1f933, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman dancing"),*/ qsl("1f483"), 2273, EmojiCode(0x1f483)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman dancing: light skin tone"),*/ qsl("1f483-1f3fb"), 2274, EmojiCode(0x1f483, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman dancing: medium-light skin tone"),*/ qsl("1f483-1f3fc"), 2275, EmojiCode(0x1f483, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman dancing: medium skin tone"),*/ qsl("1f483-1f3fd"), 2276, EmojiCode(0x1f483, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman dancing: medium-dark skin tone"),*/ qsl("1f483-1f3fe"), 2277, EmojiCode(0x1f483, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman dancing: dark skin tone"),*/ qsl("1f483-1f3ff"), 2278, EmojiCode(0x1f483, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man dancing"),*/ qsl("1f57a"), 2279, EmojiCode(0x1f57a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man dancing: light skin tone"),*/ qsl("1f57a-1f3fb"), 2280, EmojiCode(0x1f57a, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man dancing: medium-light skin tone"),*/ qsl("1f57a-1f3fc"), 2281, EmojiCode(0x1f57a, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man dancing: medium skin tone"),*/ qsl("1f57a-1f3fd"), 2282, EmojiCode(0x1f57a, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man dancing: dark skin tone"),*/ qsl("1f57a-1f3ff"), 2283, EmojiCode(0x1f57a, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man dancing: medium-dark skin tone"),*/ qsl("1f57a-1f3fe"), 2284, EmojiCode(0x1f57a, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("people with bunny ears"),*/ qsl("1f46f"), 2285, EmojiCode(0x1f46f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("women with bunny ears"),*/ qsl("1f46f-2640"), 2286, EmojiCode(0x1f46f, 0x2640), EmojiCode(0x1f46f, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("men with bunny ears"),*/ qsl("1f46f-2642"), 2287, EmojiCode(0x1f46f, 0x2642), EmojiCode(0x1f46f, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in suit levitating"),*/ qsl("1f574"), 2288, EmojiCode(0x1f574), EmojiCode(0x1f574, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in suit levitating: light skin tone"),*/ qsl("1f574-1f3fb"), 2289, EmojiCode(0x1f574, 0x1f3fb), EmojiCode(0x1f574, 0xfe0f, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in suit levitating: medium-light skin tone"),*/ qsl("1f574-1f3fc"), 2290, EmojiCode(0x1f574, 0x1f3fc), EmojiCode(0x1f574, 0xfe0f, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in suit levitating: medium skin tone"),*/ qsl("1f574-1f3fd"), 2291, EmojiCode(0x1f574, 0x1f3fd), EmojiCode(0x1f574, 0xfe0f, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in suit levitating: medium-dark skin tone"),*/ qsl("1f574-1f3fe"), 2292, EmojiCode(0x1f574, 0x1f3fe), EmojiCode(0x1f574, 0xfe0f, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man in suit levitating: dark skin tone"),*/ qsl("1f574-1f3ff"), 2293, EmojiCode(0x1f574, 0x1f3ff), EmojiCode(0x1f574, 0xfe0f, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person walking"),*/ qsl("1f6b6"), 2294, EmojiCode(0x1f6b6)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person walking: light skin tone"),*/ qsl("1f6b6-1f3fb"), 2295, EmojiCode(0x1f6b6, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person walking: medium-light skin tone"),*/ qsl("1f6b6-1f3fc"), 2296, EmojiCode(0x1f6b6, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person walking: medium skin tone"),*/ qsl("1f6b6-1f3fd"), 2297, EmojiCode(0x1f6b6, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person walking: medium-dark skin tone"),*/ qsl("1f6b6-1f3fe"), 2298, EmojiCode(0x1f6b6, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person walking: dark skin tone"),*/ qsl("1f6b6-1f3ff"), 2299, EmojiCode(0x1f6b6, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman walking"),*/ qsl("1f6b6-2640"), 2300, EmojiCode(0x1f6b6, 0x2640), EmojiCode(0x1f6b6, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman walking: light skin tone"),*/ qsl("1f6b6-1f3fb-2640"), 2301, EmojiCode(0x1f6b6, 0x1f3fb, 0x2640), EmojiCode(0x1f6b6, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman walking: medium-light skin tone"),*/ qsl("1f6b6-1f3fc-2640"), 2302, EmojiCode(0x1f6b6, 0x1f3fc, 0x2640), EmojiCode(0x1f6b6, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman walking: medium skin tone"),*/ qsl("1f6b6-1f3fd-2640"), 2303, EmojiCode(0x1f6b6, 0x1f3fd, 0x2640), EmojiCode(0x1f6b6, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman walking: medium-dark skin tone"),*/ qsl("1f6b6-1f3fe-2640"), 2304, EmojiCode(0x1f6b6, 0x1f3fe, 0x2640), EmojiCode(0x1f6b6, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman walking: dark skin tone"),*/ qsl("1f6b6-1f3ff-2640"), 2305, EmojiCode(0x1f6b6, 0x1f3ff, 0x2640), EmojiCode(0x1f6b6, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man walking"),*/ qsl("1f6b6-2642"), 2306, EmojiCode(0x1f6b6, 0x2642), EmojiCode(0x1f6b6, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man walking: light skin tone"),*/ qsl("1f6b6-1f3fb-2642"), 2307, EmojiCode(0x1f6b6, 0x1f3fb, 0x2642), EmojiCode(0x1f6b6, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man walking: medium-light skin tone"),*/ qsl("1f6b6-1f3fc-2642"), 2308, EmojiCode(0x1f6b6, 0x1f3fc, 0x2642), EmojiCode(0x1f6b6, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man walking: medium skin tone"),*/ qsl("1f6b6-1f3fd-2642"), 2309, EmojiCode(0x1f6b6, 0x1f3fd, 0x2642), EmojiCode(0x1f6b6, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man walking: medium-dark skin tone"),*/ qsl("1f6b6-1f3fe-2642"), 2310, EmojiCode(0x1f6b6, 0x1f3fe, 0x2642), EmojiCode(0x1f6b6, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man walking: dark skin tone"),*/ qsl("1f6b6-1f3ff-2642"), 2311, EmojiCode(0x1f6b6, 0x1f3ff, 0x2642), EmojiCode(0x1f6b6, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person running"),*/ qsl("1f3c3"), 2312, EmojiCode(0x1f3c3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person running: light skin tone"),*/ qsl("1f3c3-1f3fb"), 2313, EmojiCode(0x1f3c3, 0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person running: medium-light skin tone"),*/ qsl("1f3c3-1f3fc"), 2314, EmojiCode(0x1f3c3, 0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person running: medium skin tone"),*/ qsl("1f3c3-1f3fd"), 2315, EmojiCode(0x1f3c3, 0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person running: medium-dark skin tone"),*/ qsl("1f3c3-1f3fe"), 2316, EmojiCode(0x1f3c3, 0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("person running: dark skin tone"),*/ qsl("1f3c3-1f3ff"), 2317, EmojiCode(0x1f3c3, 0x1f3ff)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman running"),*/ qsl("1f3c3-2640"), 2318, EmojiCode(0x1f3c3, 0x2640), EmojiCode(0x1f3c3, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman running: light skin tone"),*/ qsl("1f3c3-1f3fb-2640"), 2319, EmojiCode(0x1f3c3, 0x1f3fb, 0x2640), EmojiCode(0x1f3c3, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman running: medium-light skin tone"),*/ qsl("1f3c3-1f3fc-2640"), 2320, EmojiCode(0x1f3c3, 0x1f3fc, 0x2640), EmojiCode(0x1f3c3, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman running: medium skin tone"),*/ qsl("1f3c3-1f3fd-2640"), 2321, EmojiCode(0x1f3c3, 0x1f3fd, 0x2640), EmojiCode(0x1f3c3, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman running: medium-dark skin tone"),*/ qsl("1f3c3-1f3fe-2640"), 2322, EmojiCode(0x1f3c3, 0x1f3fe, 0x2640), EmojiCode(0x1f3c3, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman running: dark skin tone"),*/ qsl("1f3c3-1f3ff-2640"), 2323, EmojiCode(0x1f3c3, 0x1f3ff, 0x2640), EmojiCode(0x1f3c3, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man running"),*/ qsl("1f3c3-2642"), 2324, EmojiCode(0x1f3c3, 0x2642), EmojiCode(0x1f3c3, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man running: light skin tone"),*/ qsl("1f3c3-1f3fb-2642"), 2325, EmojiCode(0x1f3c3, 0x1f3fb, 0x2642), EmojiCode(0x1f3c3, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man running: medium-light skin tone"),*/ qsl("1f3c3-1f3fc-2642"), 2326, EmojiCode(0x1f3c3, 0x1f3fc, 0x2642), EmojiCode(0x1f3c3, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man running: medium skin tone"),*/ qsl("1f3c3-1f3fd-2642"), 2327, EmojiCode(0x1f3c3, 0x1f3fd, 0x2642), EmojiCode(0x1f3c3, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man running: medium-dark skin tone"),*/ qsl("1f3c3-1f3fe-2642"), 2328, EmojiCode(0x1f3c3, 0x1f3fe, 0x2642), EmojiCode(0x1f3c3, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man running: dark skin tone"),*/ qsl("1f3c3-1f3ff-2642"), 2329, EmojiCode(0x1f3c3, 0x1f3ff, 0x2642), EmojiCode(0x1f3c3, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man and woman holding hands"),*/ qsl("1f46b"), 2330, EmojiCode(0x1f46b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("two women holding hands"),*/ qsl("1f46d"), 2331, EmojiCode(0x1f46d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("two men holding hands"),*/ qsl("1f46c"), 2332, EmojiCode(0x1f46c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("couple with heart"),*/ qsl("1f491"), 2333, EmojiCode(0x1f491)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("couple with heart: woman, man"),*/ qsl("1f469-2764-1f468"), 2334, EmojiCode(0x1f469, 0x2764, 0x1f468), EmojiCode(0x1f469, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f468)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("couple with heart: woman, woman"),*/ qsl("1f469-2764-1f469"), 2335, EmojiCode(0x1f469, 0x2764, 0x1f469), EmojiCode(0x1f469, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f469)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("couple with heart: man, man"),*/ qsl("1f468-2764-1f468"), 2336, EmojiCode(0x1f468, 0x2764, 0x1f468), EmojiCode(0x1f468, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f468)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("kiss"),*/ qsl("1f48f"), 2337, EmojiCode(0x1f48f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("kiss: woman, man"),*/ qsl("1f469-2764-1f48b-1f468"), 2338, EmojiCode(0x1f469, 0x2764, 0x1f48b, 0x1f468), EmojiCode(0x1f469, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f48b, 0x200d, 0x1f468)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("kiss: woman, woman"),*/ qsl("1f469-2764-1f48b-1f469"), 2339, EmojiCode(0x1f469, 0x2764, 0x1f48b, 0x1f469), EmojiCode(0x1f469, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f48b, 0x200d, 0x1f469)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("kiss: man, man"),*/ qsl("1f468-2764-1f48b-1f468"), 2340, EmojiCode(0x1f468, 0x2764, 0x1f48b, 0x1f468), EmojiCode(0x1f468, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f48b, 0x200d, 0x1f468)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family"),*/ qsl("1f46a"), 2341, EmojiCode(0x1f46a), EmojiCode(0x1f46a, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, woman, boy"),*/ qsl("1f468-1f469-1f466"), 2342, EmojiCode(0x1f468, 0x1f469, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, woman, girl"),*/ qsl("1f468-1f469-1f467"), 2343, EmojiCode(0x1f468, 0x1f469, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, woman, girl, boy"),*/ qsl("1f468-1f469-1f467-1f466"), 2344, EmojiCode(0x1f468, 0x1f469, 0x1f467, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, woman, boy, boy"),*/ qsl("1f468-1f469-1f466-1f466"), 2345, EmojiCode(0x1f468, 0x1f469, 0x1f466, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f466, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, woman, girl, girl"),*/ qsl("1f468-1f469-1f467-1f467"), 2346, EmojiCode(0x1f468, 0x1f469, 0x1f467, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: woman, woman, boy"),*/ qsl("1f469-1f469-1f466"), 2347, EmojiCode(0x1f469, 0x1f469, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f469, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: woman, woman, girl"),*/ qsl("1f469-1f469-1f467"), 2348, EmojiCode(0x1f469, 0x1f469, 0x1f467), EmojiCode(0x1f469, 0x200d, 0x1f469, 0x200d, 0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: woman, woman, girl, boy"),*/ qsl("1f469-1f469-1f467-1f466"), 2349, EmojiCode(0x1f469, 0x1f469, 0x1f467, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: woman, woman, boy, boy"),*/ qsl("1f469-1f469-1f466-1f466"), 2350, EmojiCode(0x1f469, 0x1f469, 0x1f466, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f469, 0x200d, 0x1f466, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: woman, woman, girl, girl"),*/ qsl("1f469-1f469-1f467-1f467"), 2351, EmojiCode(0x1f469, 0x1f469, 0x1f467, 0x1f467), EmojiCode(0x1f469, 0x200d, 0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, man, boy"),*/ qsl("1f468-1f468-1f466"), 2352, EmojiCode(0x1f468, 0x1f468, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f468, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, man, girl"),*/ qsl("1f468-1f468-1f467"), 2353, EmojiCode(0x1f468, 0x1f468, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f468, 0x200d, 0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, man, girl, boy"),*/ qsl("1f468-1f468-1f467-1f466"), 2354, EmojiCode(0x1f468, 0x1f468, 0x1f467, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f468, 0x200d, 0x1f467, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, man, boy, boy"),*/ qsl("1f468-1f468-1f466-1f466"), 2355, EmojiCode(0x1f468, 0x1f468, 0x1f466, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f468, 0x200d, 0x1f466, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, man, girl, girl"),*/ qsl("1f468-1f468-1f467-1f467"), 2356, EmojiCode(0x1f468, 0x1f468, 0x1f467, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f468, 0x200d, 0x1f467, 0x200d, 0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: woman, boy"),*/ qsl("1f469-1f466"), 2357, EmojiCode(0x1f469, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: woman, girl"),*/ qsl("1f469-1f467"), 2358, EmojiCode(0x1f469, 0x1f467), EmojiCode(0x1f469, 0x200d, 0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: woman, girl, boy"),*/ qsl("1f469-1f467-1f466"), 2359, EmojiCode(0x1f469, 0x1f467, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: woman, boy, boy"),*/ qsl("1f469-1f466-1f466"), 2360, EmojiCode(0x1f469, 0x1f466, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f466, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: woman, girl, girl"),*/ qsl("1f469-1f467-1f467"), 2361, EmojiCode(0x1f469, 0x1f467, 0x1f467), EmojiCode(0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, boy"),*/ qsl("1f468-1f466"), 2362, EmojiCode(0x1f468, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, girl"),*/ qsl("1f468-1f467"), 2363, EmojiCode(0x1f468, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, girl, boy"),*/ qsl("1f468-1f467-1f466"), 2364, EmojiCode(0x1f468, 0x1f467, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f467, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, boy, boy"),*/ qsl("1f468-1f466-1f466"), 2365, EmojiCode(0x1f468, 0x1f466, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f466, 0x200d, 0x1f466)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("family: man, girl, girl"),*/ qsl("1f468-1f467-1f467"), 2366, EmojiCode(0x1f468, 0x1f467, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f467, 0x200d, 0x1f467)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("coat"),*/ qsl("1f9e5"), 2367, EmojiCode(0x1f9e5)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman’s clothes"),*/ qsl("1f45a"), 2368, EmojiCode(0x1f45a)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("t-shirt"),*/ qsl("1f455"), 2369, EmojiCode(0x1f455)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("jeans"),*/ qsl("1f456"), 2370, EmojiCode(0x1f456)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("necktie"),*/ qsl("1f454"), 2371, EmojiCode(0x1f454)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("dress"),*/ qsl("1f457"), 2372, EmojiCode(0x1f457)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bikini"),*/ qsl("1f459"), 2373, EmojiCode(0x1f459)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("kimono"),*/ qsl("1f458"), 2374, EmojiCode(0x1f458)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("lab coat"),*/ qsl("1f97c"), 2375, EmojiCode(0x1f97c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("high-heeled shoe"),*/ qsl("1f460"), 2376, EmojiCode(0x1f460)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman’s sandal"),*/ qsl("1f461"), 2377, EmojiCode(0x1f461)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman’s boot"),*/ qsl("1f462"), 2378, EmojiCode(0x1f462)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("man’s shoe"),*/ qsl("1f45e"), 2379, EmojiCode(0x1f45e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("running shoe"),*/ qsl("1f45f"), 2380, EmojiCode(0x1f45f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("hiking boot"),*/ qsl("1f97e"), 2381, EmojiCode(0x1f97e)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman’s flat shoe"),*/ qsl("1f97f"), 2382, EmojiCode(0x1f97f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("socks"),*/ qsl("1f9e6"), 2383, EmojiCode(0x1f9e6)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("gloves"),*/ qsl("1f9e4"), 2384, EmojiCode(0x1f9e4)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("scarf"),*/ qsl("1f9e3"), 2385, EmojiCode(0x1f9e3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("top hat"),*/ qsl("1f3a9"), 2386, EmojiCode(0x1f3a9)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("billed cap"),*/ qsl("1f9e2"), 2387, EmojiCode(0x1f9e2)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("woman’s hat"),*/ qsl("1f452"), 2388, EmojiCode(0x1f452)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("graduation cap"),*/ qsl("1f393"), 2389, EmojiCode(0x1f393), EmojiCode(0x1f393, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("rescue worker’s helmet"),*/ qsl("26d1"), 2390, EmojiCode(0x26d1), EmojiCode(0x26d1, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("crown"),*/ qsl("1f451"), 2391, EmojiCode(0x1f451)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("clutch bag"),*/ qsl("1f45d"), 2392, EmojiCode(0x1f45d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("purse"),*/ qsl("1f45b"), 2393, EmojiCode(0x1f45b)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("handbag"),*/ qsl("1f45c"), 2394, EmojiCode(0x1f45c)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("briefcase"),*/ qsl("1f4bc"), 2395, EmojiCode(0x1f4bc)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("school backpack"),*/ qsl("1f392"), 2396, EmojiCode(0x1f392)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("glasses"),*/ qsl("1f453"), 2397, EmojiCode(0x1f453), EmojiCode(0x1f453, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("sunglasses"),*/ qsl("1f576"), 2398, EmojiCode(0x1f576), EmojiCode(0x1f576, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("goggles"),*/ qsl("1f97d"), 2399, EmojiCode(0x1f97d)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("closed umbrella"),*/ qsl("1f302"), 2400, EmojiCode(0x1f302)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("red-haired"),*/ qsl("1f9b0"), 2401, EmojiCode(0x1f9b0)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("curly-haired"),*/ qsl("1f9b1"), 2402, EmojiCode(0x1f9b1)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("white-haired"),*/ qsl("1f9b3"), 2403, EmojiCode(0x1f9b3)));
-        res.push_back(std::make_shared<EmojiRecord>(peopleCategory(), /*qsl("bald"),*/ qsl("1f9b2"), 2404, EmojiCode(0x1f9b2)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter z"),*/ qsl("1f1ff"), 2405, EmojiCode(0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter y"),*/ qsl("1f1fe"), 2406, EmojiCode(0x1f1fe)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter x"),*/ qsl("1f1fd"), 2407, EmojiCode(0x1f1fd)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter w"),*/ qsl("1f1fc"), 2408, EmojiCode(0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter v"),*/ qsl("1f1fb"), 2409, EmojiCode(0x1f1fb)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter u"),*/ qsl("1f1fa"), 2410, EmojiCode(0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter t"),*/ qsl("1f1f9"), 2411, EmojiCode(0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter s"),*/ qsl("1f1f8"), 2412, EmojiCode(0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter r"),*/ qsl("1f1f7"), 2413, EmojiCode(0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter q"),*/ qsl("1f1f6"), 2414, EmojiCode(0x1f1f6)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter p"),*/ qsl("1f1f5"), 2415, EmojiCode(0x1f1f5)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter o"),*/ qsl("1f1f4"), 2416, EmojiCode(0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter n"),*/ qsl("1f1f3"), 2417, EmojiCode(0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter m"),*/ qsl("1f1f2"), 2418, EmojiCode(0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter l"),*/ qsl("1f1f1"), 2419, EmojiCode(0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter k"),*/ qsl("1f1f0"), 2420, EmojiCode(0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter j"),*/ qsl("1f1ef"), 2421, EmojiCode(0x1f1ef)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter i"),*/ qsl("1f1ee"), 2422, EmojiCode(0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter h"),*/ qsl("1f1ed"), 2423, EmojiCode(0x1f1ed)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter g"),*/ qsl("1f1ec"), 2424, EmojiCode(0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter f"),*/ qsl("1f1eb"), 2425, EmojiCode(0x1f1eb)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter e"),*/ qsl("1f1ea"), 2426, EmojiCode(0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter d"),*/ qsl("1f1e9"), 2427, EmojiCode(0x1f1e9)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter c"),*/ qsl("1f1e8"), 2428, EmojiCode(0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter b"),*/ qsl("1f1e7"), 2429, EmojiCode(0x1f1e7)));
-        res.push_back(std::make_shared<EmojiRecord>(regionalCategory(), /*qsl("regional indicator symbol letter a"),*/ qsl("1f1e6"), 2430, EmojiCode(0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("automobile"),*/ qsl("1f697"), 2431, EmojiCode(0x1f697)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("taxi"),*/ qsl("1f695"), 2432, EmojiCode(0x1f695)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("sport utility vehicle"),*/ qsl("1f699"), 2433, EmojiCode(0x1f699)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("bus"),*/ qsl("1f68c"), 2434, EmojiCode(0x1f68c)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("trolleybus"),*/ qsl("1f68e"), 2435, EmojiCode(0x1f68e)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("racing car"),*/ qsl("1f3ce"), 2436, EmojiCode(0x1f3ce), EmojiCode(0x1f3ce, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("police car"),*/ qsl("1f693"), 2437, EmojiCode(0x1f693)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("ambulance"),*/ qsl("1f691"), 2438, EmojiCode(0x1f691), EmojiCode(0x1f691, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("fire engine"),*/ qsl("1f692"), 2439, EmojiCode(0x1f692)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("minibus"),*/ qsl("1f690"), 2440, EmojiCode(0x1f690)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("delivery truck"),*/ qsl("1f69a"), 2441, EmojiCode(0x1f69a)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("articulated lorry"),*/ qsl("1f69b"), 2442, EmojiCode(0x1f69b)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("tractor"),*/ qsl("1f69c"), 2443, EmojiCode(0x1f69c)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("kick scooter"),*/ qsl("1f6f4"), 2444, EmojiCode(0x1f6f4)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("bicycle"),*/ qsl("1f6b2"), 2445, EmojiCode(0x1f6b2), EmojiCode(0x1f6b2, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("motor scooter"),*/ qsl("1f6f5"), 2446, EmojiCode(0x1f6f5)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("motorcycle"),*/ qsl("1f3cd"), 2447, EmojiCode(0x1f3cd), EmojiCode(0x1f3cd, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("police car light"),*/ qsl("1f6a8"), 2448, EmojiCode(0x1f6a8)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("oncoming police car"),*/ qsl("1f694"), 2449, EmojiCode(0x1f694), EmojiCode(0x1f694, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("oncoming bus"),*/ qsl("1f68d"), 2450, EmojiCode(0x1f68d), EmojiCode(0x1f68d, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("oncoming automobile"),*/ qsl("1f698"), 2451, EmojiCode(0x1f698), EmojiCode(0x1f698, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("oncoming taxi"),*/ qsl("1f696"), 2452, EmojiCode(0x1f696)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("aerial tramway"),*/ qsl("1f6a1"), 2453, EmojiCode(0x1f6a1)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("mountain cableway"),*/ qsl("1f6a0"), 2454, EmojiCode(0x1f6a0)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("suspension railway"),*/ qsl("1f69f"), 2455, EmojiCode(0x1f69f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("railway car"),*/ qsl("1f683"), 2456, EmojiCode(0x1f683)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("tram car"),*/ qsl("1f68b"), 2457, EmojiCode(0x1f68b)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("mountain railway"),*/ qsl("1f69e"), 2458, EmojiCode(0x1f69e)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("monorail"),*/ qsl("1f69d"), 2459, EmojiCode(0x1f69d)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("high-speed train"),*/ qsl("1f684"), 2460, EmojiCode(0x1f684)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("bullet train"),*/ qsl("1f685"), 2461, EmojiCode(0x1f685)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("light rail"),*/ qsl("1f688"), 2462, EmojiCode(0x1f688)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("locomotive"),*/ qsl("1f682"), 2463, EmojiCode(0x1f682)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("train"),*/ qsl("1f686"), 2464, EmojiCode(0x1f686)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("metro"),*/ qsl("1f687"), 2465, EmojiCode(0x1f687), EmojiCode(0x1f687, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("tram"),*/ qsl("1f68a"), 2466, EmojiCode(0x1f68a)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("station"),*/ qsl("1f689"), 2467, EmojiCode(0x1f689)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("airplane"),*/ qsl("2708"), 2468, EmojiCode(0x2708), EmojiCode(0x2708, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("airplane departure"),*/ qsl("1f6eb"), 2469, EmojiCode(0x1f6eb)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("airplane arrival"),*/ qsl("1f6ec"), 2470, EmojiCode(0x1f6ec)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("small airplane"),*/ qsl("1f6e9"), 2471, EmojiCode(0x1f6e9), EmojiCode(0x1f6e9, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("seat"),*/ qsl("1f4ba"), 2472, EmojiCode(0x1f4ba)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("luggage"),*/ qsl("1f9f3"), 2473, EmojiCode(0x1f9f3)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("satellite"),*/ qsl("1f6f0"), 2474, EmojiCode(0x1f6f0), EmojiCode(0x1f6f0, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("rocket"),*/ qsl("1f680"), 2475, EmojiCode(0x1f680)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("flying saucer"),*/ qsl("1f6f8"), 2476, EmojiCode(0x1f6f8)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("helicopter"),*/ qsl("1f681"), 2477, EmojiCode(0x1f681)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("canoe"),*/ qsl("1f6f6"), 2478, EmojiCode(0x1f6f6)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("sailboat"),*/ qsl("26f5"), 2479, EmojiCode(0x26f5), EmojiCode(0x26f5, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("speedboat"),*/ qsl("1f6a4"), 2480, EmojiCode(0x1f6a4)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("motor boat"),*/ qsl("1f6e5"), 2481, EmojiCode(0x1f6e5), EmojiCode(0x1f6e5, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("passenger ship"),*/ qsl("1f6f3"), 2482, EmojiCode(0x1f6f3), EmojiCode(0x1f6f3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("ferry"),*/ qsl("26f4"), 2483, EmojiCode(0x26f4), EmojiCode(0x26f4, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("ship"),*/ qsl("1f6a2"), 2484, EmojiCode(0x1f6a2)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("anchor"),*/ qsl("2693"), 2485, EmojiCode(0x2693), EmojiCode(0x2693, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("fuel pump"),*/ qsl("26fd"), 2486, EmojiCode(0x26fd), EmojiCode(0x26fd, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("construction"),*/ qsl("1f6a7"), 2487, EmojiCode(0x1f6a7)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("vertical traffic light"),*/ qsl("1f6a6"), 2488, EmojiCode(0x1f6a6)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("horizontal traffic light"),*/ qsl("1f6a5"), 2489, EmojiCode(0x1f6a5)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("bus stop"),*/ qsl("1f68f"), 2490, EmojiCode(0x1f68f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("world map"),*/ qsl("1f5fa"), 2491, EmojiCode(0x1f5fa), EmojiCode(0x1f5fa, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("moai"),*/ qsl("1f5ff"), 2492, EmojiCode(0x1f5ff)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("Statue of Liberty"),*/ qsl("1f5fd"), 2493, EmojiCode(0x1f5fd)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("Tokyo tower"),*/ qsl("1f5fc"), 2494, EmojiCode(0x1f5fc)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("castle"),*/ qsl("1f3f0"), 2495, EmojiCode(0x1f3f0)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("Japanese castle"),*/ qsl("1f3ef"), 2496, EmojiCode(0x1f3ef)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("stadium"),*/ qsl("1f3df"), 2497, EmojiCode(0x1f3df), EmojiCode(0x1f3df, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("ferris wheel"),*/ qsl("1f3a1"), 2498, EmojiCode(0x1f3a1)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("roller coaster"),*/ qsl("1f3a2"), 2499, EmojiCode(0x1f3a2)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("carousel horse"),*/ qsl("1f3a0"), 2500, EmojiCode(0x1f3a0)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("fountain"),*/ qsl("26f2"), 2501, EmojiCode(0x26f2), EmojiCode(0x26f2, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("umbrella on ground"),*/ qsl("26f1"), 2502, EmojiCode(0x26f1), EmojiCode(0x26f1, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("beach with umbrella"),*/ qsl("1f3d6"), 2503, EmojiCode(0x1f3d6), EmojiCode(0x1f3d6, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("desert island"),*/ qsl("1f3dd"), 2504, EmojiCode(0x1f3dd), EmojiCode(0x1f3dd, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("desert"),*/ qsl("1f3dc"), 2505, EmojiCode(0x1f3dc), EmojiCode(0x1f3dc, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("volcano"),*/ qsl("1f30b"), 2506, EmojiCode(0x1f30b)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("mountain"),*/ qsl("26f0"), 2507, EmojiCode(0x26f0), EmojiCode(0x26f0, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("snow-capped mountain"),*/ qsl("1f3d4"), 2508, EmojiCode(0x1f3d4), EmojiCode(0x1f3d4, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("mount fuji"),*/ qsl("1f5fb"), 2509, EmojiCode(0x1f5fb)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("camping"),*/ qsl("1f3d5"), 2510, EmojiCode(0x1f3d5), EmojiCode(0x1f3d5, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("tent"),*/ qsl("26fa"), 2511, EmojiCode(0x26fa), EmojiCode(0x26fa, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("house"),*/ qsl("1f3e0"), 2512, EmojiCode(0x1f3e0), EmojiCode(0x1f3e0, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("house with garden"),*/ qsl("1f3e1"), 2513, EmojiCode(0x1f3e1)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("houses"),*/ qsl("1f3d8"), 2514, EmojiCode(0x1f3d8), EmojiCode(0x1f3d8, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("derelict house"),*/ qsl("1f3da"), 2515, EmojiCode(0x1f3da), EmojiCode(0x1f3da, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("building construction"),*/ qsl("1f3d7"), 2516, EmojiCode(0x1f3d7), EmojiCode(0x1f3d7, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("factory"),*/ qsl("1f3ed"), 2517, EmojiCode(0x1f3ed), EmojiCode(0x1f3ed, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("office building"),*/ qsl("1f3e2"), 2518, EmojiCode(0x1f3e2)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("department store"),*/ qsl("1f3ec"), 2519, EmojiCode(0x1f3ec)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("Japanese post office"),*/ qsl("1f3e3"), 2520, EmojiCode(0x1f3e3)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("post office"),*/ qsl("1f3e4"), 2521, EmojiCode(0x1f3e4)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("hospital"),*/ qsl("1f3e5"), 2522, EmojiCode(0x1f3e5)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("bank"),*/ qsl("1f3e6"), 2523, EmojiCode(0x1f3e6)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("hotel"),*/ qsl("1f3e8"), 2524, EmojiCode(0x1f3e8)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("convenience store"),*/ qsl("1f3ea"), 2525, EmojiCode(0x1f3ea)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("school"),*/ qsl("1f3eb"), 2526, EmojiCode(0x1f3eb)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("love hotel"),*/ qsl("1f3e9"), 2527, EmojiCode(0x1f3e9)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("wedding"),*/ qsl("1f492"), 2528, EmojiCode(0x1f492)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("classical building"),*/ qsl("1f3db"), 2529, EmojiCode(0x1f3db), EmojiCode(0x1f3db, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("church"),*/ qsl("26ea"), 2530, EmojiCode(0x26ea), EmojiCode(0x26ea, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("mosque"),*/ qsl("1f54c"), 2531, EmojiCode(0x1f54c)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("synagogue"),*/ qsl("1f54d"), 2532, EmojiCode(0x1f54d)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("kaaba"),*/ qsl("1f54b"), 2533, EmojiCode(0x1f54b)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("shinto shrine"),*/ qsl("26e9"), 2534, EmojiCode(0x26e9), EmojiCode(0x26e9, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("railway track"),*/ qsl("1f6e4"), 2535, EmojiCode(0x1f6e4), EmojiCode(0x1f6e4, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("motorway"),*/ qsl("1f6e3"), 2536, EmojiCode(0x1f6e3), EmojiCode(0x1f6e3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("map of Japan"),*/ qsl("1f5fe"), 2537, EmojiCode(0x1f5fe)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("moon viewing ceremony"),*/ qsl("1f391"), 2538, EmojiCode(0x1f391)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("national park"),*/ qsl("1f3de"), 2539, EmojiCode(0x1f3de), EmojiCode(0x1f3de, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("sunrise"),*/ qsl("1f305"), 2540, EmojiCode(0x1f305)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("sunrise over mountains"),*/ qsl("1f304"), 2541, EmojiCode(0x1f304)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("shooting star"),*/ qsl("1f320"), 2542, EmojiCode(0x1f320)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("sparkler"),*/ qsl("1f387"), 2543, EmojiCode(0x1f387)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("fireworks"),*/ qsl("1f386"), 2544, EmojiCode(0x1f386)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("firecracker"),*/ qsl("1f9e8"), 2545, EmojiCode(0x1f9e8)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("sunset"),*/ qsl("1f307"), 2546, EmojiCode(0x1f307)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("cityscape at dusk"),*/ qsl("1f306"), 2547, EmojiCode(0x1f306)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("cityscape"),*/ qsl("1f3d9"), 2548, EmojiCode(0x1f3d9), EmojiCode(0x1f3d9, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("night with stars"),*/ qsl("1f303"), 2549, EmojiCode(0x1f303)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("milky way"),*/ qsl("1f30c"), 2550, EmojiCode(0x1f30c)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("bridge at night"),*/ qsl("1f309"), 2551, EmojiCode(0x1f309)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("locked"),*/ qsl("1f512"), 2552, EmojiCode(0x1f512), EmojiCode(0x1f512, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(objectsCategory(), /*qsl("unlocked"),*/ qsl("1f513"), 2553, EmojiCode(0x1f513), EmojiCode(0x1f513, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(travelCategory(), /*qsl("foggy"),*/ qsl("1f301"), 2554, EmojiCode(0x1f301)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("white flag"),*/ qsl("1f3f3"), 2555, EmojiCode(0x1f3f3), EmojiCode(0x1f3f3, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("black flag"),*/ qsl("1f3f4"), 2556, EmojiCode(0x1f3f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("chequered flag"),*/ qsl("1f3c1"), 2557, EmojiCode(0x1f3c1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("triangular flag"),*/ qsl("1f6a9"), 2558, EmojiCode(0x1f6a9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("rainbow flag"),*/ qsl("1f3f3-1f308"), 2559, EmojiCode(0x1f3f3, 0x1f308), EmojiCode(0x1f3f3, 0xfe0f, 0x200d, 0x1f308)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("pirate flag"),*/ qsl("1f3f4-2620"), 2560, EmojiCode(0x1f3f4, 0x2620), EmojiCode(0x1f3f4, 0x200d, 0x2620, 0xfe0f)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Afghanistan"),*/ qsl("1f1e6-1f1eb"), 2561, EmojiCode(0x1f1e6, 0x1f1eb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Åland Islands"),*/ qsl("1f1e6-1f1fd"), 2562, EmojiCode(0x1f1e6, 0x1f1fd)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Albania"),*/ qsl("1f1e6-1f1f1"), 2563, EmojiCode(0x1f1e6, 0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Algeria"),*/ qsl("1f1e9-1f1ff"), 2564, EmojiCode(0x1f1e9, 0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("American Samoa"),*/ qsl("1f1e6-1f1f8"), 2565, EmojiCode(0x1f1e6, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Andorra"),*/ qsl("1f1e6-1f1e9"), 2566, EmojiCode(0x1f1e6, 0x1f1e9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Angola"),*/ qsl("1f1e6-1f1f4"), 2567, EmojiCode(0x1f1e6, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Anguilla"),*/ qsl("1f1e6-1f1ee"), 2568, EmojiCode(0x1f1e6, 0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Antarctica"),*/ qsl("1f1e6-1f1f6"), 2569, EmojiCode(0x1f1e6, 0x1f1f6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Antigua &amp; Barbuda"),*/ qsl("1f1e6-1f1ec"), 2570, EmojiCode(0x1f1e6, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Argentina"),*/ qsl("1f1e6-1f1f7"), 2571, EmojiCode(0x1f1e6, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Armenia"),*/ qsl("1f1e6-1f1f2"), 2572, EmojiCode(0x1f1e6, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Aruba"),*/ qsl("1f1e6-1f1fc"), 2573, EmojiCode(0x1f1e6, 0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Australia"),*/ qsl("1f1e6-1f1fa"), 2574, EmojiCode(0x1f1e6, 0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Austria"),*/ qsl("1f1e6-1f1f9"), 2575, EmojiCode(0x1f1e6, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Azerbaijan"),*/ qsl("1f1e6-1f1ff"), 2576, EmojiCode(0x1f1e6, 0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Bahamas"),*/ qsl("1f1e7-1f1f8"), 2577, EmojiCode(0x1f1e7, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Bahrain"),*/ qsl("1f1e7-1f1ed"), 2578, EmojiCode(0x1f1e7, 0x1f1ed)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Bangladesh"),*/ qsl("1f1e7-1f1e9"), 2579, EmojiCode(0x1f1e7, 0x1f1e9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Barbados"),*/ qsl("1f1e7-1f1e7"), 2580, EmojiCode(0x1f1e7, 0x1f1e7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Belarus"),*/ qsl("1f1e7-1f1fe"), 2581, EmojiCode(0x1f1e7, 0x1f1fe)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Belgium"),*/ qsl("1f1e7-1f1ea"), 2582, EmojiCode(0x1f1e7, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Belize"),*/ qsl("1f1e7-1f1ff"), 2583, EmojiCode(0x1f1e7, 0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Benin"),*/ qsl("1f1e7-1f1ef"), 2584, EmojiCode(0x1f1e7, 0x1f1ef)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Bermuda"),*/ qsl("1f1e7-1f1f2"), 2585, EmojiCode(0x1f1e7, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Bhutan"),*/ qsl("1f1e7-1f1f9"), 2586, EmojiCode(0x1f1e7, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Bolivia"),*/ qsl("1f1e7-1f1f4"), 2587, EmojiCode(0x1f1e7, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Bosnia &amp; Herzegovina"),*/ qsl("1f1e7-1f1e6"), 2588, EmojiCode(0x1f1e7, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Botswana"),*/ qsl("1f1e7-1f1fc"), 2589, EmojiCode(0x1f1e7, 0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Brazil"),*/ qsl("1f1e7-1f1f7"), 2590, EmojiCode(0x1f1e7, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("British Indian Ocean Territory"),*/ qsl("1f1ee-1f1f4"), 2591, EmojiCode(0x1f1ee, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("British Virgin Islands"),*/ qsl("1f1fb-1f1ec"), 2592, EmojiCode(0x1f1fb, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Brunei"),*/ qsl("1f1e7-1f1f3"), 2593, EmojiCode(0x1f1e7, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Bulgaria"),*/ qsl("1f1e7-1f1ec"), 2594, EmojiCode(0x1f1e7, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Burkina Faso"),*/ qsl("1f1e7-1f1eb"), 2595, EmojiCode(0x1f1e7, 0x1f1eb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Burundi"),*/ qsl("1f1e7-1f1ee"), 2596, EmojiCode(0x1f1e7, 0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Cambodia"),*/ qsl("1f1f0-1f1ed"), 2597, EmojiCode(0x1f1f0, 0x1f1ed)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Cameroon"),*/ qsl("1f1e8-1f1f2"), 2598, EmojiCode(0x1f1e8, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Canada"),*/ qsl("1f1e8-1f1e6"), 2599, EmojiCode(0x1f1e8, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Canary Islands"),*/ qsl("1f1ee-1f1e8"), 2600, EmojiCode(0x1f1ee, 0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Cape Verde"),*/ qsl("1f1e8-1f1fb"), 2601, EmojiCode(0x1f1e8, 0x1f1fb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Caribbean Netherlands"),*/ qsl("1f1e7-1f1f6"), 2602, EmojiCode(0x1f1e7, 0x1f1f6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Cayman Islands"),*/ qsl("1f1f0-1f1fe"), 2603, EmojiCode(0x1f1f0, 0x1f1fe)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Central African Republic"),*/ qsl("1f1e8-1f1eb"), 2604, EmojiCode(0x1f1e8, 0x1f1eb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Chad"),*/ qsl("1f1f9-1f1e9"), 2605, EmojiCode(0x1f1f9, 0x1f1e9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Chile"),*/ qsl("1f1e8-1f1f1"), 2606, EmojiCode(0x1f1e8, 0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("China"),*/ qsl("1f1e8-1f1f3"), 2607, EmojiCode(0x1f1e8, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Christmas Island"),*/ qsl("1f1e8-1f1fd"), 2608, EmojiCode(0x1f1e8, 0x1f1fd)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Cocos (Keeling) Islands"),*/ qsl("1f1e8-1f1e8"), 2609, EmojiCode(0x1f1e8, 0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Colombia"),*/ qsl("1f1e8-1f1f4"), 2610, EmojiCode(0x1f1e8, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Comoros"),*/ qsl("1f1f0-1f1f2"), 2611, EmojiCode(0x1f1f0, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Congo - Brazzaville"),*/ qsl("1f1e8-1f1ec"), 2612, EmojiCode(0x1f1e8, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Congo - Kinshasa"),*/ qsl("1f1e8-1f1e9"), 2613, EmojiCode(0x1f1e8, 0x1f1e9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Cook Islands"),*/ qsl("1f1e8-1f1f0"), 2614, EmojiCode(0x1f1e8, 0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Costa Rica"),*/ qsl("1f1e8-1f1f7"), 2615, EmojiCode(0x1f1e8, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Côte d’Ivoire"),*/ qsl("1f1e8-1f1ee"), 2616, EmojiCode(0x1f1e8, 0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Croatia"),*/ qsl("1f1ed-1f1f7"), 2617, EmojiCode(0x1f1ed, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Cuba"),*/ qsl("1f1e8-1f1fa"), 2618, EmojiCode(0x1f1e8, 0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Curaçao"),*/ qsl("1f1e8-1f1fc"), 2619, EmojiCode(0x1f1e8, 0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Cyprus"),*/ qsl("1f1e8-1f1fe"), 2620, EmojiCode(0x1f1e8, 0x1f1fe)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Czechia"),*/ qsl("1f1e8-1f1ff"), 2621, EmojiCode(0x1f1e8, 0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Denmark"),*/ qsl("1f1e9-1f1f0"), 2622, EmojiCode(0x1f1e9, 0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Djibouti"),*/ qsl("1f1e9-1f1ef"), 2623, EmojiCode(0x1f1e9, 0x1f1ef)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Dominica"),*/ qsl("1f1e9-1f1f2"), 2624, EmojiCode(0x1f1e9, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Dominican Republic"),*/ qsl("1f1e9-1f1f4"), 2625, EmojiCode(0x1f1e9, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Ecuador"),*/ qsl("1f1ea-1f1e8"), 2626, EmojiCode(0x1f1ea, 0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Egypt"),*/ qsl("1f1ea-1f1ec"), 2627, EmojiCode(0x1f1ea, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("El Salvador"),*/ qsl("1f1f8-1f1fb"), 2628, EmojiCode(0x1f1f8, 0x1f1fb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Equatorial Guinea"),*/ qsl("1f1ec-1f1f6"), 2629, EmojiCode(0x1f1ec, 0x1f1f6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Eritrea"),*/ qsl("1f1ea-1f1f7"), 2630, EmojiCode(0x1f1ea, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Estonia"),*/ qsl("1f1ea-1f1ea"), 2631, EmojiCode(0x1f1ea, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Ethiopia"),*/ qsl("1f1ea-1f1f9"), 2632, EmojiCode(0x1f1ea, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("European Union"),*/ qsl("1f1ea-1f1fa"), 2633, EmojiCode(0x1f1ea, 0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Falkland Islands"),*/ qsl("1f1eb-1f1f0"), 2634, EmojiCode(0x1f1eb, 0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Faroe Islands"),*/ qsl("1f1eb-1f1f4"), 2635, EmojiCode(0x1f1eb, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Fiji"),*/ qsl("1f1eb-1f1ef"), 2636, EmojiCode(0x1f1eb, 0x1f1ef)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Finland"),*/ qsl("1f1eb-1f1ee"), 2637, EmojiCode(0x1f1eb, 0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("France"),*/ qsl("1f1eb-1f1f7"), 2638, EmojiCode(0x1f1eb, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("French Guiana"),*/ qsl("1f1ec-1f1eb"), 2639, EmojiCode(0x1f1ec, 0x1f1eb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("French Polynesia"),*/ qsl("1f1f5-1f1eb"), 2640, EmojiCode(0x1f1f5, 0x1f1eb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("French Southern Territories"),*/ qsl("1f1f9-1f1eb"), 2641, EmojiCode(0x1f1f9, 0x1f1eb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Gabon"),*/ qsl("1f1ec-1f1e6"), 2642, EmojiCode(0x1f1ec, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Gambia"),*/ qsl("1f1ec-1f1f2"), 2643, EmojiCode(0x1f1ec, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Georgia"),*/ qsl("1f1ec-1f1ea"), 2644, EmojiCode(0x1f1ec, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Germany"),*/ qsl("1f1e9-1f1ea"), 2645, EmojiCode(0x1f1e9, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Ghana"),*/ qsl("1f1ec-1f1ed"), 2646, EmojiCode(0x1f1ec, 0x1f1ed)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Gibraltar"),*/ qsl("1f1ec-1f1ee"), 2647, EmojiCode(0x1f1ec, 0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Greece"),*/ qsl("1f1ec-1f1f7"), 2648, EmojiCode(0x1f1ec, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Greenland"),*/ qsl("1f1ec-1f1f1"), 2649, EmojiCode(0x1f1ec, 0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Grenada"),*/ qsl("1f1ec-1f1e9"), 2650, EmojiCode(0x1f1ec, 0x1f1e9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Guadeloupe"),*/ qsl("1f1ec-1f1f5"), 2651, EmojiCode(0x1f1ec, 0x1f1f5)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Guam"),*/ qsl("1f1ec-1f1fa"), 2652, EmojiCode(0x1f1ec, 0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Guatemala"),*/ qsl("1f1ec-1f1f9"), 2653, EmojiCode(0x1f1ec, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Guernsey"),*/ qsl("1f1ec-1f1ec"), 2654, EmojiCode(0x1f1ec, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Guinea"),*/ qsl("1f1ec-1f1f3"), 2655, EmojiCode(0x1f1ec, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Guinea-Bissau"),*/ qsl("1f1ec-1f1fc"), 2656, EmojiCode(0x1f1ec, 0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Guyana"),*/ qsl("1f1ec-1f1fe"), 2657, EmojiCode(0x1f1ec, 0x1f1fe)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Haiti"),*/ qsl("1f1ed-1f1f9"), 2658, EmojiCode(0x1f1ed, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Honduras"),*/ qsl("1f1ed-1f1f3"), 2659, EmojiCode(0x1f1ed, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Hong Kong SAR China"),*/ qsl("1f1ed-1f1f0"), 2660, EmojiCode(0x1f1ed, 0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Hungary"),*/ qsl("1f1ed-1f1fa"), 2661, EmojiCode(0x1f1ed, 0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Iceland"),*/ qsl("1f1ee-1f1f8"), 2662, EmojiCode(0x1f1ee, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("India"),*/ qsl("1f1ee-1f1f3"), 2663, EmojiCode(0x1f1ee, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Indonesia"),*/ qsl("1f1ee-1f1e9"), 2664, EmojiCode(0x1f1ee, 0x1f1e9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Iran"),*/ qsl("1f1ee-1f1f7"), 2665, EmojiCode(0x1f1ee, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Iraq"),*/ qsl("1f1ee-1f1f6"), 2666, EmojiCode(0x1f1ee, 0x1f1f6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Ireland"),*/ qsl("1f1ee-1f1ea"), 2667, EmojiCode(0x1f1ee, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Isle of Man"),*/ qsl("1f1ee-1f1f2"), 2668, EmojiCode(0x1f1ee, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Israel"),*/ qsl("1f1ee-1f1f1"), 2669, EmojiCode(0x1f1ee, 0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Italy"),*/ qsl("1f1ee-1f1f9"), 2670, EmojiCode(0x1f1ee, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Jamaica"),*/ qsl("1f1ef-1f1f2"), 2671, EmojiCode(0x1f1ef, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Japan"),*/ qsl("1f1ef-1f1f5"), 2672, EmojiCode(0x1f1ef, 0x1f1f5)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("crossed flags"),*/ qsl("1f38c"), 2673, EmojiCode(0x1f38c)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Jersey"),*/ qsl("1f1ef-1f1ea"), 2674, EmojiCode(0x1f1ef, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Jordan"),*/ qsl("1f1ef-1f1f4"), 2675, EmojiCode(0x1f1ef, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Kazakhstan"),*/ qsl("1f1f0-1f1ff"), 2676, EmojiCode(0x1f1f0, 0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Kenya"),*/ qsl("1f1f0-1f1ea"), 2677, EmojiCode(0x1f1f0, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Kiribati"),*/ qsl("1f1f0-1f1ee"), 2678, EmojiCode(0x1f1f0, 0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Kosovo"),*/ qsl("1f1fd-1f1f0"), 2679, EmojiCode(0x1f1fd, 0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Kuwait"),*/ qsl("1f1f0-1f1fc"), 2680, EmojiCode(0x1f1f0, 0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Kyrgyzstan"),*/ qsl("1f1f0-1f1ec"), 2681, EmojiCode(0x1f1f0, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Laos"),*/ qsl("1f1f1-1f1e6"), 2682, EmojiCode(0x1f1f1, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Latvia"),*/ qsl("1f1f1-1f1fb"), 2683, EmojiCode(0x1f1f1, 0x1f1fb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Lebanon"),*/ qsl("1f1f1-1f1e7"), 2684, EmojiCode(0x1f1f1, 0x1f1e7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Lesotho"),*/ qsl("1f1f1-1f1f8"), 2685, EmojiCode(0x1f1f1, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Liberia"),*/ qsl("1f1f1-1f1f7"), 2686, EmojiCode(0x1f1f1, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Libya"),*/ qsl("1f1f1-1f1fe"), 2687, EmojiCode(0x1f1f1, 0x1f1fe)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Liechtenstein"),*/ qsl("1f1f1-1f1ee"), 2688, EmojiCode(0x1f1f1, 0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Lithuania"),*/ qsl("1f1f1-1f1f9"), 2689, EmojiCode(0x1f1f1, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Luxembourg"),*/ qsl("1f1f1-1f1fa"), 2690, EmojiCode(0x1f1f1, 0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Macau SAR China"),*/ qsl("1f1f2-1f1f4"), 2691, EmojiCode(0x1f1f2, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Macedonia"),*/ qsl("1f1f2-1f1f0"), 2692, EmojiCode(0x1f1f2, 0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Madagascar"),*/ qsl("1f1f2-1f1ec"), 2693, EmojiCode(0x1f1f2, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Malawi"),*/ qsl("1f1f2-1f1fc"), 2694, EmojiCode(0x1f1f2, 0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Malaysia"),*/ qsl("1f1f2-1f1fe"), 2695, EmojiCode(0x1f1f2, 0x1f1fe)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Maldives"),*/ qsl("1f1f2-1f1fb"), 2696, EmojiCode(0x1f1f2, 0x1f1fb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Mali"),*/ qsl("1f1f2-1f1f1"), 2697, EmojiCode(0x1f1f2, 0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Malta"),*/ qsl("1f1f2-1f1f9"), 2698, EmojiCode(0x1f1f2, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Marshall Islands"),*/ qsl("1f1f2-1f1ed"), 2699, EmojiCode(0x1f1f2, 0x1f1ed)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Martinique"),*/ qsl("1f1f2-1f1f6"), 2700, EmojiCode(0x1f1f2, 0x1f1f6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Mauritania"),*/ qsl("1f1f2-1f1f7"), 2701, EmojiCode(0x1f1f2, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Mauritius"),*/ qsl("1f1f2-1f1fa"), 2702, EmojiCode(0x1f1f2, 0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Mayotte"),*/ qsl("1f1fe-1f1f9"), 2703, EmojiCode(0x1f1fe, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Mexico"),*/ qsl("1f1f2-1f1fd"), 2704, EmojiCode(0x1f1f2, 0x1f1fd)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Micronesia"),*/ qsl("1f1eb-1f1f2"), 2705, EmojiCode(0x1f1eb, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Moldova"),*/ qsl("1f1f2-1f1e9"), 2706, EmojiCode(0x1f1f2, 0x1f1e9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Monaco"),*/ qsl("1f1f2-1f1e8"), 2707, EmojiCode(0x1f1f2, 0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Mongolia"),*/ qsl("1f1f2-1f1f3"), 2708, EmojiCode(0x1f1f2, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Montenegro"),*/ qsl("1f1f2-1f1ea"), 2709, EmojiCode(0x1f1f2, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Montserrat"),*/ qsl("1f1f2-1f1f8"), 2710, EmojiCode(0x1f1f2, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Morocco"),*/ qsl("1f1f2-1f1e6"), 2711, EmojiCode(0x1f1f2, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Mozambique"),*/ qsl("1f1f2-1f1ff"), 2712, EmojiCode(0x1f1f2, 0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Myanmar (Burma)"),*/ qsl("1f1f2-1f1f2"), 2713, EmojiCode(0x1f1f2, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Namibia"),*/ qsl("1f1f3-1f1e6"), 2714, EmojiCode(0x1f1f3, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Nauru"),*/ qsl("1f1f3-1f1f7"), 2715, EmojiCode(0x1f1f3, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Nepal"),*/ qsl("1f1f3-1f1f5"), 2716, EmojiCode(0x1f1f3, 0x1f1f5)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Netherlands"),*/ qsl("1f1f3-1f1f1"), 2717, EmojiCode(0x1f1f3, 0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("New Caledonia"),*/ qsl("1f1f3-1f1e8"), 2718, EmojiCode(0x1f1f3, 0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("New Zealand"),*/ qsl("1f1f3-1f1ff"), 2719, EmojiCode(0x1f1f3, 0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Nicaragua"),*/ qsl("1f1f3-1f1ee"), 2720, EmojiCode(0x1f1f3, 0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Niger"),*/ qsl("1f1f3-1f1ea"), 2721, EmojiCode(0x1f1f3, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Nigeria"),*/ qsl("1f1f3-1f1ec"), 2722, EmojiCode(0x1f1f3, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Niue"),*/ qsl("1f1f3-1f1fa"), 2723, EmojiCode(0x1f1f3, 0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Norfolk Island"),*/ qsl("1f1f3-1f1eb"), 2724, EmojiCode(0x1f1f3, 0x1f1eb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("North Korea"),*/ qsl("1f1f0-1f1f5"), 2725, EmojiCode(0x1f1f0, 0x1f1f5)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Northern Mariana Islands"),*/ qsl("1f1f2-1f1f5"), 2726, EmojiCode(0x1f1f2, 0x1f1f5)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Norway"),*/ qsl("1f1f3-1f1f4"), 2727, EmojiCode(0x1f1f3, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Oman"),*/ qsl("1f1f4-1f1f2"), 2728, EmojiCode(0x1f1f4, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Pakistan"),*/ qsl("1f1f5-1f1f0"), 2729, EmojiCode(0x1f1f5, 0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Palau"),*/ qsl("1f1f5-1f1fc"), 2730, EmojiCode(0x1f1f5, 0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Palestinian Territories"),*/ qsl("1f1f5-1f1f8"), 2731, EmojiCode(0x1f1f5, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Panama"),*/ qsl("1f1f5-1f1e6"), 2732, EmojiCode(0x1f1f5, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Papua New Guinea"),*/ qsl("1f1f5-1f1ec"), 2733, EmojiCode(0x1f1f5, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Paraguay"),*/ qsl("1f1f5-1f1fe"), 2734, EmojiCode(0x1f1f5, 0x1f1fe)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Peru"),*/ qsl("1f1f5-1f1ea"), 2735, EmojiCode(0x1f1f5, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Philippines"),*/ qsl("1f1f5-1f1ed"), 2736, EmojiCode(0x1f1f5, 0x1f1ed)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Pitcairn Islands"),*/ qsl("1f1f5-1f1f3"), 2737, EmojiCode(0x1f1f5, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Poland"),*/ qsl("1f1f5-1f1f1"), 2738, EmojiCode(0x1f1f5, 0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Portugal"),*/ qsl("1f1f5-1f1f9"), 2739, EmojiCode(0x1f1f5, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Puerto Rico"),*/ qsl("1f1f5-1f1f7"), 2740, EmojiCode(0x1f1f5, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Qatar"),*/ qsl("1f1f6-1f1e6"), 2741, EmojiCode(0x1f1f6, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Réunion"),*/ qsl("1f1f7-1f1ea"), 2742, EmojiCode(0x1f1f7, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Romania"),*/ qsl("1f1f7-1f1f4"), 2743, EmojiCode(0x1f1f7, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Russia"),*/ qsl("1f1f7-1f1fa"), 2744, EmojiCode(0x1f1f7, 0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Rwanda"),*/ qsl("1f1f7-1f1fc"), 2745, EmojiCode(0x1f1f7, 0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Samoa"),*/ qsl("1f1fc-1f1f8"), 2746, EmojiCode(0x1f1fc, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("San Marino"),*/ qsl("1f1f8-1f1f2"), 2747, EmojiCode(0x1f1f8, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("São Tomé &amp; Príncipe"),*/ qsl("1f1f8-1f1f9"), 2748, EmojiCode(0x1f1f8, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Saudi Arabia"),*/ qsl("1f1f8-1f1e6"), 2749, EmojiCode(0x1f1f8, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Senegal"),*/ qsl("1f1f8-1f1f3"), 2750, EmojiCode(0x1f1f8, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Serbia"),*/ qsl("1f1f7-1f1f8"), 2751, EmojiCode(0x1f1f7, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Seychelles"),*/ qsl("1f1f8-1f1e8"), 2752, EmojiCode(0x1f1f8, 0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Sierra Leone"),*/ qsl("1f1f8-1f1f1"), 2753, EmojiCode(0x1f1f8, 0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Singapore"),*/ qsl("1f1f8-1f1ec"), 2754, EmojiCode(0x1f1f8, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Sint Maarten"),*/ qsl("1f1f8-1f1fd"), 2755, EmojiCode(0x1f1f8, 0x1f1fd)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Slovakia"),*/ qsl("1f1f8-1f1f0"), 2756, EmojiCode(0x1f1f8, 0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Slovenia"),*/ qsl("1f1f8-1f1ee"), 2757, EmojiCode(0x1f1f8, 0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("South Georgia &amp; South Sandwich Islands"),*/ qsl("1f1ec-1f1f8"), 2758, EmojiCode(0x1f1ec, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Solomon Islands"),*/ qsl("1f1f8-1f1e7"), 2759, EmojiCode(0x1f1f8, 0x1f1e7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Somalia"),*/ qsl("1f1f8-1f1f4"), 2760, EmojiCode(0x1f1f8, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("South Africa"),*/ qsl("1f1ff-1f1e6"), 2761, EmojiCode(0x1f1ff, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("South Korea"),*/ qsl("1f1f0-1f1f7"), 2762, EmojiCode(0x1f1f0, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("South Sudan"),*/ qsl("1f1f8-1f1f8"), 2763, EmojiCode(0x1f1f8, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Spain"),*/ qsl("1f1ea-1f1f8"), 2764, EmojiCode(0x1f1ea, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Sri Lanka"),*/ qsl("1f1f1-1f1f0"), 2765, EmojiCode(0x1f1f1, 0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("St. Barthélemy"),*/ qsl("1f1e7-1f1f1"), 2766, EmojiCode(0x1f1e7, 0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("St. Helena"),*/ qsl("1f1f8-1f1ed"), 2767, EmojiCode(0x1f1f8, 0x1f1ed)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("St. Kitts &amp; Nevis"),*/ qsl("1f1f0-1f1f3"), 2768, EmojiCode(0x1f1f0, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("St. Lucia"),*/ qsl("1f1f1-1f1e8"), 2769, EmojiCode(0x1f1f1, 0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("St. Pierre &amp; Miquelon"),*/ qsl("1f1f5-1f1f2"), 2770, EmojiCode(0x1f1f5, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("St. Vincent &amp; Grenadines"),*/ qsl("1f1fb-1f1e8"), 2771, EmojiCode(0x1f1fb, 0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Sudan"),*/ qsl("1f1f8-1f1e9"), 2772, EmojiCode(0x1f1f8, 0x1f1e9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Suriname"),*/ qsl("1f1f8-1f1f7"), 2773, EmojiCode(0x1f1f8, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Swaziland"),*/ qsl("1f1f8-1f1ff"), 2774, EmojiCode(0x1f1f8, 0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Sweden"),*/ qsl("1f1f8-1f1ea"), 2775, EmojiCode(0x1f1f8, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Switzerland"),*/ qsl("1f1e8-1f1ed"), 2776, EmojiCode(0x1f1e8, 0x1f1ed)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Syria"),*/ qsl("1f1f8-1f1fe"), 2777, EmojiCode(0x1f1f8, 0x1f1fe)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Taiwan"),*/ qsl("1f1f9-1f1fc"), 2778, EmojiCode(0x1f1f9, 0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Tajikistan"),*/ qsl("1f1f9-1f1ef"), 2779, EmojiCode(0x1f1f9, 0x1f1ef)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Tanzania"),*/ qsl("1f1f9-1f1ff"), 2780, EmojiCode(0x1f1f9, 0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Thailand"),*/ qsl("1f1f9-1f1ed"), 2781, EmojiCode(0x1f1f9, 0x1f1ed)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Timor-Leste"),*/ qsl("1f1f9-1f1f1"), 2782, EmojiCode(0x1f1f9, 0x1f1f1)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Togo"),*/ qsl("1f1f9-1f1ec"), 2783, EmojiCode(0x1f1f9, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Tokelau"),*/ qsl("1f1f9-1f1f0"), 2784, EmojiCode(0x1f1f9, 0x1f1f0)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Tonga"),*/ qsl("1f1f9-1f1f4"), 2785, EmojiCode(0x1f1f9, 0x1f1f4)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Trinidad &amp; Tobago"),*/ qsl("1f1f9-1f1f9"), 2786, EmojiCode(0x1f1f9, 0x1f1f9)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Tunisia"),*/ qsl("1f1f9-1f1f3"), 2787, EmojiCode(0x1f1f9, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Turkey"),*/ qsl("1f1f9-1f1f7"), 2788, EmojiCode(0x1f1f9, 0x1f1f7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Turkmenistan"),*/ qsl("1f1f9-1f1f2"), 2789, EmojiCode(0x1f1f9, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Turks &amp; Caicos Islands"),*/ qsl("1f1f9-1f1e8"), 2790, EmojiCode(0x1f1f9, 0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("U.S. Virgin Islands"),*/ qsl("1f1fb-1f1ee"), 2791, EmojiCode(0x1f1fb, 0x1f1ee)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Tuvalu"),*/ qsl("1f1f9-1f1fb"), 2792, EmojiCode(0x1f1f9, 0x1f1fb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Uganda"),*/ qsl("1f1fa-1f1ec"), 2793, EmojiCode(0x1f1fa, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Ukraine"),*/ qsl("1f1fa-1f1e6"), 2794, EmojiCode(0x1f1fa, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("United Arab Emirates"),*/ qsl("1f1e6-1f1ea"), 2795, EmojiCode(0x1f1e6, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("United Kingdom"),*/ qsl("1f1ec-1f1e7"), 2796, EmojiCode(0x1f1ec, 0x1f1e7)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("England"),*/ qsl("1f3f4-e0067-e0062-e0065-e006e-e0067-e007f"), 2797, EmojiCode(0x1f3f4, 0xe0067, 0xe0062, 0xe0065, 0xe006e, 0xe0067, 0xe007f)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Scotland"),*/ qsl("1f3f4-e0067-e0062-e0073-e0063-e0074-e007f"), 2798, EmojiCode(0x1f3f4, 0xe0067, 0xe0062, 0xe0073, 0xe0063, 0xe0074, 0xe007f)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Wales"),*/ qsl("1f3f4-e0067-e0062-e0077-e006c-e0073-e007f"), 2799, EmojiCode(0x1f3f4, 0xe0067, 0xe0062, 0xe0077, 0xe006c, 0xe0073, 0xe007f)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("United States"),*/ qsl("1f1fa-1f1f8"), 2800, EmojiCode(0x1f1fa, 0x1f1f8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Uruguay"),*/ qsl("1f1fa-1f1fe"), 2801, EmojiCode(0x1f1fa, 0x1f1fe)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Uzbekistan"),*/ qsl("1f1fa-1f1ff"), 2802, EmojiCode(0x1f1fa, 0x1f1ff)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Vanuatu"),*/ qsl("1f1fb-1f1fa"), 2803, EmojiCode(0x1f1fb, 0x1f1fa)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Vatican City"),*/ qsl("1f1fb-1f1e6"), 2804, EmojiCode(0x1f1fb, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Venezuela"),*/ qsl("1f1fb-1f1ea"), 2805, EmojiCode(0x1f1fb, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Vietnam"),*/ qsl("1f1fb-1f1f3"), 2806, EmojiCode(0x1f1fb, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Wallis &amp; Futuna"),*/ qsl("1f1fc-1f1eb"), 2807, EmojiCode(0x1f1fc, 0x1f1eb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Western Sahara"),*/ qsl("1f1ea-1f1ed"), 2808, EmojiCode(0x1f1ea, 0x1f1ed)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Yemen"),*/ qsl("1f1fe-1f1ea"), 2809, EmojiCode(0x1f1fe, 0x1f1ea)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Zambia"),*/ qsl("1f1ff-1f1f2"), 2810, EmojiCode(0x1f1ff, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Zimbabwe"),*/ qsl("1f1ff-1f1fc"), 2811, EmojiCode(0x1f1ff, 0x1f1fc)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Ascension Island"),*/ qsl("1f1e6-1f1e8"), 2812, EmojiCode(0x1f1e6, 0x1f1e8)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Bouvet Island"),*/ qsl("1f1e7-1f1fb"), 2813, EmojiCode(0x1f1e7, 0x1f1fb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Clipperton Island"),*/ qsl("1f1e8-1f1f5"), 2814, EmojiCode(0x1f1e8, 0x1f1f5)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Ceuta &amp; Melilla"),*/ qsl("1f1ea-1f1e6"), 2815, EmojiCode(0x1f1ea, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Diego Garcia"),*/ qsl("1f1e9-1f1ec"), 2816, EmojiCode(0x1f1e9, 0x1f1ec)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Heard &amp; McDonald Islands"),*/ qsl("1f1ed-1f1f2"), 2817, EmojiCode(0x1f1ed, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("St. Martin"),*/ qsl("1f1f2-1f1eb"), 2818, EmojiCode(0x1f1f2, 0x1f1eb)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Svalbard &amp; Jan Mayen"),*/ qsl("1f1f8-1f1ef"), 2819, EmojiCode(0x1f1f8, 0x1f1ef)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("Tristan da Cunha"),*/ qsl("1f1f9-1f1e6"), 2820, EmojiCode(0x1f1f9, 0x1f1e6)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("U.S. Outlying Islands"),*/ qsl("1f1fa-1f1f2"), 2821, EmojiCode(0x1f1fa, 0x1f1f2)));
-        res.push_back(std::make_shared<EmojiRecord>(flagsCategory(), /*qsl("United Nations"),*/ qsl("1f1fa-1f1f3"), 2822, EmojiCode(0x1f1fa, 0x1f1f3)));
-        res.push_back(std::make_shared<EmojiRecord>(modifierCategory(), /*qsl("light skin tone"),*/ qsl("1f3fb"), 2823, EmojiCode(0x1f3fb)));
-        res.push_back(std::make_shared<EmojiRecord>(modifierCategory(), /*qsl("medium-light skin tone"),*/ qsl("1f3fc"), 2824, EmojiCode(0x1f3fc)));
-        res.push_back(std::make_shared<EmojiRecord>(modifierCategory(), /*qsl("medium skin tone"),*/ qsl("1f3fd"), 2825, EmojiCode(0x1f3fd)));
-        res.push_back(std::make_shared<EmojiRecord>(modifierCategory(), /*qsl("medium-dark skin tone"),*/ qsl("1f3fe"), 2826, EmojiCode(0x1f3fe)));
-        res.push_back(std::make_shared<EmojiRecord>(modifierCategory(), /*qsl("dark skin tone"),*/ qsl("1f3ff"), 2827, EmojiCode(0x1f3ff)));
+    // keep the order of Index_; lookup tables in EmojiIndexHash.h are generated from this table
+    // by emoji_index_gen.py and must be regenerated after any change
+    constexpr EmojiTable emojiTable =
+    {
+        EmojiRecord("symbols", /*"red heart",*/ "2764", 1, EmojiCode(0x2764), EmojiCode(0x2764, 0xfe0f)),
+        EmojiRecord("symbols", /*"orange heart",*/ "1f9e1", 2, EmojiCode(0x1f9e1)),
+        EmojiRecord("symbols", /*"yellow heart",*/ "1f49b", 3, EmojiCode(0x1f49b)),
+        EmojiRecord("symbols", /*"green heart",*/ "1f49a", 4, EmojiCode(0x1f49a)),
+        EmojiRecord("symbols", /*"blue heart",*/ "1f499", 5, EmojiCode(0x1f499)),
+        EmojiRecord("symbols", /*"purple heart",*/ "1f49c", 6, EmojiCode(0x1f49c)),
+        EmojiRecord("symbols", /*"black heart",*/ "1f5a4", 7, EmojiCode(0x1f5a4)),
+        EmojiRecord("symbols", /*"broken heart",*/ "1f494", 8, EmojiCode(0x1f494)),
+        EmojiRecord("symbols", /*"heavy heart exclamation",*/ "2763", 9, EmojiCode(0x2763), EmojiCode(0x2763, 0xfe0f)),
+        EmojiRecord("symbols", /*"two hearts",*/ "1f495", 10, EmojiCode(0x1f495)),
+        EmojiRecord("symbols", /*"revolving hearts",*/ "1f49e", 11, EmojiCode(0x1f49e)),
+        EmojiRecord("symbols", /*"beating heart",*/ "1f493", 12, EmojiCode(0x1f493)),
+        EmojiRecord("symbols", /*"growing heart",*/ "1f497", 13, EmojiCode(0x1f497)),
+        EmojiRecord("symbols", /*"sparkling heart",*/ "1f496", 14, EmojiCode(0x1f496)),
+        EmojiRecord("symbols", /*"heart with arrow",*/ "1f498", 15, EmojiCode(0x1f498)),
+        EmojiRecord("symbols", /*"heart with ribbon",*/ "1f49d", 16, EmojiCode(0x1f49d)),
+        EmojiRecord("symbols", /*"heart decoration",*/ "1f49f", 17, EmojiCode(0x1f49f)),
+        EmojiRecord("symbols", /*"peace symbol",*/ "262e", 18, EmojiCode(0x262e), EmojiCode(0x262e, 0xfe0f)),
+        EmojiRecord("symbols", /*"latin cross",*/ "271d", 19, EmojiCode(0x271d), EmojiCode(0x271d, 0xfe0f)),
+        EmojiRecord("symbols", /*"star and crescent",*/ "262a", 20, EmojiCode(0x262a), EmojiCode(0x262a, 0xfe0f)),
+        EmojiRecord("symbols", /*"om",*/ "1f549", 21, EmojiCode(0x1f549), EmojiCode(0x1f549, 0xfe0f)),
+        EmojiRecord("symbols", /*"wheel of dharma",*/ "2638", 22, EmojiCode(0x2638), EmojiCode(0x2638, 0xfe0f)),
+        EmojiRecord("symbols", /*"star of David",*/ "2721", 23, EmojiCode(0x2721), EmojiCode(0x2721, 0xfe0f)),
+        EmojiRecord("symbols", /*"dotted six-pointed star",*/ "1f52f", 24, EmojiCode(0x1f52f)),
+        EmojiRecord("symbols", /*"menorah",*/ "1f54e", 25, EmojiCode(0x1f54e)),
+        EmojiRecord("symbols", /*"yin yang",*/ "262f", 26, EmojiCode(0x262f), EmojiCode(0x262f, 0xfe0f)),
+        EmojiRecord("symbols", /*"orthodox cross",*/ "2626", 27, EmojiCode(0x2626), EmojiCode(0x2626, 0xfe0f)),
+        EmojiRecord("symbols", /*"place of worship",*/ "1f6d0", 28, EmojiCode(0x1f6d0)),
+        EmojiRecord("symbols", /*"Ophiuchus",*/ "26ce", 29, EmojiCode(0x26ce)),
+        EmojiRecord("symbols", /*"Aries",*/ "2648", 30, EmojiCode(0x2648), EmojiCode(0x2648, 0xfe0f)),
+        EmojiRecord("symbols", /*"Taurus",*/ "2649", 31, EmojiCode(0x2649), EmojiCode(0x2649, 0xfe0f)),
+        EmojiRecord("symbols", /*"Gemini",*/ "264a", 32, EmojiCode(0x264a), EmojiCode(0x264a, 0xfe0f)),
+        EmojiRecord("symbols", /*"Cancer",*/ "264b", 33, EmojiCode(0x264b), EmojiCode(0x264b, 0xfe0f)),
+        EmojiRecord("symbols", /*"Leo",*/ "264c", 34, EmojiCode(0x264c), EmojiCode(0x264c, 0xfe0f)),
+        EmojiRecord("symbols", /*"Virgo",*/ "264d", 35, EmojiCode(0x264d), EmojiCode(0x264d, 0xfe0f)),
+        EmojiRecord("symbols", /*"Libra",*/ "264e", 36, EmojiCode(0x264e), EmojiCode(0x264e, 0xfe0f)),
+        EmojiRecord("symbols", /*"Scorpio",*/ "264f", 37, EmojiCode(0x264f), EmojiCode(0x264f, 0xfe0f)),
+        EmojiRecord("symbols", /*"Sagittarius",*/ "2650", 38, EmojiCode(0x2650), EmojiCode(0x2650, 0xfe0f)),
+        EmojiRecord("symbols", /*"Capricorn",*/ "2651", 39, EmojiCode(0x2651), EmojiCode(0x2651, 0xfe0f)),
+        EmojiRecord("symbols", /*"Aquarius",*/ "2652", 40, EmojiCode(0x2652), EmojiCode(0x2652, 0xfe0f)),
+        EmojiRecord("symbols", /*"Pisces",*/ "2653", 41, EmojiCode(0x2653), EmojiCode(0x2653, 0xfe0f)),
+        EmojiRecord("symbols", /*"ID button",*/ "1f194", 42, EmojiCode(0x1f194)),
+        EmojiRecord("symbols", /*"atom symbol",*/ "269b", 43, EmojiCode(0x269b), EmojiCode(0x269b, 0xfe0f)),
+        EmojiRecord("symbols", /*"infinity",*/ "267e", 44, EmojiCode(0x267e), EmojiCode(0x267e, 0xfe0f)),
+        EmojiRecord("symbols", /*"Japanese “acceptable” button",*/ "1f251", 45, EmojiCode(0x1f251)),
+        EmojiRecord("symbols", /*"radioactive",*/ "2622", 46, EmojiCode(0x2622), EmojiCode(0x2622, 0xfe0f)),
+        EmojiRecord("symbols", /*"biohazard",*/ "2623", 47, EmojiCode(0x2623), EmojiCode(0x2623, 0xfe0f)),
+        EmojiRecord("symbols", /*"mobile phone off",*/ "1f4f4", 48, EmojiCode(0x1f4f4)),
+        EmojiRecord("symbols", /*"vibration mode",*/ "1f4f3", 49, EmojiCode(0x1f4f3)),
+        EmojiRecord("symbols", /*"Japanese “not free of charge” button",*/ "1f236", 50, EmojiCode(0x1f236)),
+        EmojiRecord("symbols", /*"Japanese “free of charge” button",*/ "1f21a", 51, EmojiCode(0x1f21a), EmojiCode(0x1f21a, 0xfe0f)),
+        EmojiRecord("symbols", /*"Japanese “application” button",*/ "1f238", 52, EmojiCode(0x1f238)),
+        EmojiRecord("symbols", /*"Japanese “open for business” button",*/ "1f23a", 53, EmojiCode(0x1f23a)),
+        EmojiRecord("symbols", /*"Japanese “monthly amount” button",*/ "1f237", 54, EmojiCode(0x1f237), EmojiCode(0x1f237, 0xfe0f)),
+        EmojiRecord("symbols", /*"eight-pointed star",*/ "2734", 55, EmojiCode(0x2734), EmojiCode(0x2734, 0xfe0f)),
+        EmojiRecord("symbols", /*"VS button",*/ "1f19a", 56, EmojiCode(0x1f19a)),
+        EmojiRecord("symbols", /*"white flower",*/ "1f4ae", 57, EmojiCode(0x1f4ae)),
+        EmojiRecord("symbols", /*"Japanese “bargain” button",*/ "1f250", 58, EmojiCode(0x1f250)),
+        EmojiRecord("symbols", /*"Japanese “secret” button",*/ "3299", 59, EmojiCode(0x3299), EmojiCode(0x3299, 0xfe0f)),
+        EmojiRecord("symbols", /*"Japanese “congratulations” button",*/ "3297", 60, EmojiCode(0x3297), EmojiCode(0x3297, 0xfe0f)),
+        EmojiRecord("symbols", /*"Japanese “passing grade” button",*/ "1f234", 61, EmojiCode(0x1f234)),
+        EmojiRecord("symbols", /*"Japanese “no vacancy” button",*/ "1f235", 62, EmojiCode(0x1f235)),
+        EmojiRecord("symbols", /*"Japanese “discount” button",*/ "1f239", 63, EmojiCode(0x1f239)),
+        EmojiRecord("symbols", /*"Japanese “prohibited” button",*/ "1f232", 64, EmojiCode(0x1f232)),
+        EmojiRecord("symbols", /*"A button (blood type)",*/ "1f170", 65, EmojiCode(0x1f170), EmojiCode(0x1f170, 0xfe0f)),
+        EmojiRecord("symbols", /*"B button (blood type)",*/ "1f171", 66, EmojiCode(0x1f171), EmojiCode(0x1f171, 0xfe0f)),
+        EmojiRecord("symbols", /*"AB button (blood type)",*/ "1f18e", 67, EmojiCode(0x1f18e)),
+        EmojiRecord("symbols", /*"CL button",*/ "1f191", 68, EmojiCode(0x1f191)),
+        EmojiRecord("symbols", /*"O button (blood type)",*/ "1f17e", 69, EmojiCode(0x1f17e), EmojiCode(0x1f17e, 0xfe0f)),
+        EmojiRecord("symbols", /*"SOS button",*/ "1f198", 70, EmojiCode(0x1f198)),
+        EmojiRecord("symbols", /*"cross mark",*/ "274c", 71, EmojiCode(0x274c)),
+        EmojiRecord("symbols", /*"heavy large circle",*/ "2b55", 72, EmojiCode(0x2b55), EmojiCode(0x2b55, 0xfe0f)),
+        EmojiRecord("symbols", /*"stop sign",*/ "1f6d1", 73, EmojiCode(0x1f6d1)),
+        EmojiRecord("symbols", /*"no entry",*/ "26d4", 74, EmojiCode(0x26d4), EmojiCode(0x26d4, 0xfe0f)),
+        EmojiRecord("symbols", /*"name badge",*/ "1f4db", 75, EmojiCode(0x1f4db)),
+        EmojiRecord("symbols", /*"prohibited",*/ "1f6ab", 76, EmojiCode(0x1f6ab)),
+        EmojiRecord("symbols", /*"hundred points",*/ "1f4af", 77, EmojiCode(0x1f4af)),
+        EmojiRecord("symbols", /*"anger symbol",*/ "1f4a2", 78, EmojiCode(0x1f4a2)),
+        EmojiRecord("symbols", /*"hot springs",*/ "2668", 79, EmojiCode(0x2668), EmojiCode(0x2668, 0xfe0f)),
+        EmojiRecord("symbols", /*"no pedestrians",*/ "1f6b7", 80, EmojiCode(0x1f6b7)),
+        EmojiRecord("symbols", /*"no littering",*/ "1f6af", 81, EmojiCode(0x1f6af)),
+        EmojiRecord("symbols", /*"no bicycles",*/ "1f6b3", 82, EmojiCode(0x1f6b3)),
+        EmojiRecord("symbols", /*"non-potable water",*/ "1f6b1", 83, EmojiCode(0x1f6b1)),
+        EmojiRecord("symbols", /*"no one under eighteen",*/ "1f51e", 84, EmojiCode(0x1f51e)),
+        EmojiRecord("symbols", /*"no mobile phones",*/ "1f4f5", 85, EmojiCode(0x1f4f5)),
+        EmojiRecord("symbols", /*"no smoking",*/ "1f6ad", 86, EmojiCode(0x1f6ad), EmojiCode(0x1f6ad, 0xfe0f)),
+        EmojiRecord("symbols", /*"exclamation mark",*/ "2757", 87, EmojiCode(0x2757), EmojiCode(0x2757, 0xfe0f)),
+        EmojiRecord("symbols", /*"white exclamation mark",*/ "2755", 88, EmojiCode(0x2755)),
+        EmojiRecord("symbols", /*"question mark",*/ "2753", 89, EmojiCode(0x2753), EmojiCode(0x2753, 0xfe0f)),
+        EmojiRecord("symbols", /*"white question mark",*/ "2754", 90, EmojiCode(0x2754)),
+        EmojiRecord("symbols", /*"double exclamation mark",*/ "203c", 91, EmojiCode(0x203c), EmojiCode(0x203c, 0xfe0f)),
+        EmojiRecord("symbols", /*"exclamation question mark",*/ "2049", 92, EmojiCode(0x2049), EmojiCode(0x2049, 0xfe0f)),
+        EmojiRecord("symbols", /*"dim button",*/ "1f505", 93, EmojiCode(0x1f505)),
+        EmojiRecord("symbols", /*"bright button",*/ "1f506", 94, EmojiCode(0x1f506)),
+        EmojiRecord("symbols", /*"part alternation mark",*/ "303d", 95, EmojiCode(0x303d), EmojiCode(0x303d, 0xfe0f)),
+        EmojiRecord("symbols", /*"warning",*/ "26a0", 96, EmojiCode(0x26a0), EmojiCode(0x26a0, 0xfe0f)),
+        EmojiRecord("symbols", /*"children crossing",*/ "1f6b8", 97, EmojiCode(0x1f6b8)),
+        EmojiRecord("symbols", /*"trident emblem",*/ "1f531", 98, EmojiCode(0x1f531)),
+        EmojiRecord("symbols", /*"fleur-de-lis",*/ "269c", 99, EmojiCode(0x269c), EmojiCode(0x269c, 0xfe0f)),
+        EmojiRecord("symbols", /*"Japanese symbol for beginner",*/ "1f530", 100, EmojiCode(0x1f530)),
+        EmojiRecord("symbols", /*"recycling symbol",*/ "267b", 101, EmojiCode(0x267b), EmojiCode(0x267b, 0xfe0f)),
+        EmojiRecord("symbols", /*"white heavy check mark",*/ "2705", 102, EmojiCode(0x2705)),
+        EmojiRecord("symbols", /*"Japanese “reserved” button",*/ "1f22f", 103, EmojiCode(0x1f22f), EmojiCode(0x1f22f, 0xfe0f)),
+        EmojiRecord("symbols", /*"chart increasing with yen",*/ "1f4b9", 104, EmojiCode(0x1f4b9)),
+        EmojiRecord("symbols", /*"sparkle",*/ "2747", 105, EmojiCode(0x2747), EmojiCode(0x2747, 0xfe0f)),
+        EmojiRecord("symbols", /*"eight-spoked asterisk",*/ "2733", 106, EmojiCode(0x2733), EmojiCode(0x2733, 0xfe0f)),
+        EmojiRecord("symbols", /*"cross mark button",*/ "274e", 107, EmojiCode(0x274e)),
+        EmojiRecord("symbols", /*"globe with meridians",*/ "1f310", 108, EmojiCode(0x1f310)),
+        EmojiRecord("symbols", /*"diamond with a dot",*/ "1f4a0", 109, EmojiCode(0x1f4a0)),
+        EmojiRecord("symbols", /*"circled M",*/ "24c2", 110, EmojiCode(0x24c2), EmojiCode(0x24c2, 0xfe0f)),
+        EmojiRecord("symbols", /*"cyclone",*/ "1f300", 111, EmojiCode(0x1f300)),
+        EmojiRecord("symbols", /*"zzz",*/ "1f4a4", 112, EmojiCode(0x1f4a4)),
+        EmojiRecord("symbols", /*"ATM sign",*/ "1f3e7", 113, EmojiCode(0x1f3e7)),
+        EmojiRecord("symbols", /*"water closet",*/ "1f6be", 114, EmojiCode(0x1f6be)),
+        EmojiRecord("symbols", /*"wheelchair symbol",*/ "267f", 115, EmojiCode(0x267f), EmojiCode(0x267f, 0xfe0f)),
+        EmojiRecord("symbols", /*"P button",*/ "1f17f", 116, EmojiCode(0x1f17f), EmojiCode(0x1f17f, 0xfe0f)),
+        EmojiRecord("symbols", /*"Japanese “vacancy” button",*/ "1f233", 117, EmojiCode(0x1f233)),
+        EmojiRecord("symbols", /*"Japanese “service charge” button",*/ "1f202", 118, EmojiCode(0x1f202), EmojiCode(0x1f202, 0xfe0f)),
+        EmojiRecord("symbols", /*"passport control",*/ "1f6c2", 119, EmojiCode(0x1f6c2)),
+        EmojiRecord("symbols", /*"customs",*/ "1f6c3", 120, EmojiCode(0x1f6c3)),
+        EmojiRecord("symbols", /*"baggage claim",*/ "1f6c4", 121, EmojiCode(0x1f6c4)),
+        EmojiRecord("symbols", /*"left luggage",*/ "1f6c5", 122, EmojiCode(0x1f6c5)),
+        EmojiRecord("symbols", /*"men’s room",*/ "1f6b9", 123, EmojiCode(0x1f6b9), EmojiCode(0x1f6b9, 0xfe0f)),
+        EmojiRecord("symbols", /*"women’s room",*/ "1f6ba", 124, EmojiCode(0x1f6ba), EmojiCode(0x1f6ba, 0xfe0f)),
+        EmojiRecord("symbols", /*"baby symbol",*/ "1f6bc", 125, EmojiCode(0x1f6bc), EmojiCode(0x1f6bc, 0xfe0f)),
+        EmojiRecord("symbols", /*"restroom",*/ "1f6bb", 126, EmojiCode(0x1f6bb)),
+        EmojiRecord("symbols", /*"litter in bin sign",*/ "1f6ae", 127, EmojiCode(0x1f6ae)),
+        EmojiRecord("symbols", /*"cinema",*/ "1f3a6", 128, EmojiCode(0x1f3a6)),
+        EmojiRecord("symbols", /*"antenna bars",*/ "1f4f6", 129, EmojiCode(0x1f4f6)),
+        EmojiRecord("symbols", /*"Japanese “here” button",*/ "1f201", 130, EmojiCode(0x1f201)),
+        EmojiRecord("symbols", /*"input symbols",*/ "1f523", 131, EmojiCode(0x1f523)),
+        EmojiRecord("symbols", /*"information",*/ "2139", 132, EmojiCode(0x2139), EmojiCode(0x2139, 0xfe0f)),
+        EmojiRecord("symbols", /*"input latin letters",*/ "1f524", 133, EmojiCode(0x1f524)),
+        EmojiRecord("symbols", /*"input latin lowercase",*/ "1f521", 134, EmojiCode(0x1f521)),
+        EmojiRecord("symbols", /*"input latin uppercase",*/ "1f520", 135, EmojiCode(0x1f520)),
+        EmojiRecord("symbols", /*"NG button",*/ "1f196", 136, EmojiCode(0x1f196)),
+        EmojiRecord("symbols", /*"OK button",*/ "1f197", 137, EmojiCode(0x1f197)),
+        EmojiRecord("symbols", /*"UP! button",*/ "1f199", 138, EmojiCode(0x1f199)),
+        EmojiRecord("symbols", /*"COOL button",*/ "1f192", 139, EmojiCode(0x1f192)),
+        EmojiRecord("symbols", /*"NEW button",*/ "1f195", 140, EmojiCode(0x1f195)),
+        EmojiRecord("symbols", /*"FREE button",*/ "1f193", 141, EmojiCode(0x1f193)),
+        EmojiRecord("symbols", /*"keycap: 0",*/ "0030-20e3", 142, EmojiCode(0x0030, 0x20e3), EmojiCode(0x0030, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: 1",*/ "0031-20e3", 143, EmojiCode(0x0031, 0x20e3), EmojiCode(0x0031, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: 2",*/ "0032-20e3", 144, EmojiCode(0x0032, 0x20e3), EmojiCode(0x0032, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: 3",*/ "0033-20e3", 145, EmojiCode(0x0033, 0x20e3), EmojiCode(0x0033, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: 4",*/ "0034-20e3", 146, EmojiCode(0x0034, 0x20e3), EmojiCode(0x0034, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: 5",*/ "0035-20e3", 147, EmojiCode(0x0035, 0x20e3), EmojiCode(0x0035, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: 6",*/ "0036-20e3", 148, EmojiCode(0x0036, 0x20e3), EmojiCode(0x0036, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: 7",*/ "0037-20e3", 149, EmojiCode(0x0037, 0x20e3), EmojiCode(0x0037, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: 8",*/ "0038-20e3", 150, EmojiCode(0x0038, 0x20e3), EmojiCode(0x0038, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: 9",*/ "0039-20e3", 151, EmojiCode(0x0039, 0x20e3), EmojiCode(0x0039, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: 10",*/ "1f51f", 152, EmojiCode(0x1f51f)),
+        EmojiRecord("symbols", /*"input numbers",*/ "1f522", 153, EmojiCode(0x1f522)),
+        EmojiRecord("symbols", /*"keycap: #",*/ "0023-20e3", 154, EmojiCode(0x0023, 0x20e3), EmojiCode(0x0023, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"keycap: *",*/ "002a-20e3", 155, EmojiCode(0x002a, 0x20e3), EmojiCode(0x002a, 0xfe0f, 0x20e3)),
+        EmojiRecord("symbols", /*"eject button",*/ "23cf", 156, EmojiCode(0x23cf), EmojiCode(0x23cf, 0xfe0f)),
+        EmojiRecord("symbols", /*"play button",*/ "25b6", 157, EmojiCode(0x25b6), EmojiCode(0x25b6, 0xfe0f)),
+        EmojiRecord("symbols", /*"pause button",*/ "23f8", 158, EmojiCode(0x23f8), EmojiCode(0x23f8, 0xfe0f)),
+        EmojiRecord("symbols", /*"play or pause button",*/ "23ef", 159, EmojiCode(0x23ef), EmojiCode(0x23ef, 0xfe0f)),
+        EmojiRecord("symbols", /*"stop button",*/ "23f9", 160, EmojiCode(0x23f9), EmojiCode(0x23f9, 0xfe0f)),
+        EmojiRecord("symbols", /*"record button",*/ "23fa", 161, EmojiCode(0x23fa), EmojiCode(0x23fa, 0xfe0f)),
+        EmojiRecord("symbols", /*"next track button",*/ "23ed", 162, EmojiCode(0x23ed), EmojiCode(0x23ed, 0xfe0f)),
+        EmojiRecord("symbols", /*"last track button",*/ "23ee", 163, EmojiCode(0x23ee), EmojiCode(0x23ee, 0xfe0f)),
+        EmojiRecord("symbols", /*"fast-forward button",*/ "23e9", 164, EmojiCode(0x23e9), EmojiCode(0x23e9, 0xfe0f)),
+        EmojiRecord("symbols", /*"fast reverse button",*/ "23ea", 165, EmojiCode(0x23ea), EmojiCode(0x23ea, 0xfe0f)),
+        EmojiRecord("symbols", /*"fast up button",*/ "23eb", 166, EmojiCode(0x23eb)),
+        EmojiRecord("symbols", /*"fast down button",*/ "23ec", 167, EmojiCode(0x23ec)),
+        EmojiRecord("symbols", /*"reverse button",*/ "25c0", 168, EmojiCode(0x25c0), EmojiCode(0x25c0, 0xfe0f)),
+        EmojiRecord("symbols", /*"upwards button",*/ "1f53c", 169, EmojiCode(0x1f53c)),
+        EmojiRecord("symbols", /*"downwards button",*/ "1f53d", 170, EmojiCode(0x1f53d)),
+        EmojiRecord("symbols", /*"right arrow",*/ "27a1", 171, EmojiCode(0x27a1), EmojiCode(0x27a1, 0xfe0f)),
+        EmojiRecord("symbols", /*"left arrow",*/ "2b05", 172, EmojiCode(0x2b05), EmojiCode(0x2b05, 0xfe0f)),
+        EmojiRecord("symbols", /*"up arrow",*/ "2b06", 173, EmojiCode(0x2b06), EmojiCode(0x2b06, 0xfe0f)),
+        EmojiRecord("symbols", /*"down arrow",*/ "2b07", 174, EmojiCode(0x2b07), EmojiCode(0x2b07, 0xfe0f)),
+        EmojiRecord("symbols", /*"up-right arrow",*/ "2197", 175, EmojiCode(0x2197), EmojiCode(0x2197, 0xfe0f)),
+        EmojiRecord("symbols", /*"down-right arrow",*/ "2198", 176, EmojiCode(0x2198), EmojiCode(0x2198, 0xfe0f)),
+        EmojiRecord("symbols", /*"down-left arrow",*/ "2199", 177, EmojiCode(0x2199), EmojiCode(0x2199, 0xfe0f)),
+        EmojiRecord("symbols", /*"up-left arrow",*/ "2196", 178, EmojiCode(0x2196), EmojiCode(0x2196, 0xfe0f)),
+        EmojiRecord("symbols", /*"up-down arrow",*/ "2195", 179, EmojiCode(0x2195), EmojiCode(0x2195, 0xfe0f)),
+        EmojiRecord("symbols", /*"left-right arrow",*/ "2194", 180, EmojiCode(0x2194), EmojiCode(0x2194, 0xfe0f)),
+        EmojiRecord("symbols", /*"left arrow curving right",*/ "21aa", 181, EmojiCode(0x21aa), EmojiCode(0x21aa, 0xfe0f)),
+        EmojiRecord("symbols", /*"right arrow curving left",*/ "21a9", 182, EmojiCode(0x21a9), EmojiCode(0x21a9, 0xfe0f)),
+        EmojiRecord("symbols", /*"right arrow curving up",*/ "2934", 183, EmojiCode(0x2934), EmojiCode(0x2934, 0xfe0f)),
+        EmojiRecord("symbols", /*"right arrow curving down",*/ "2935", 184, EmojiCode(0x2935), EmojiCode(0x2935, 0xfe0f)),
+        EmojiRecord("symbols", /*"shuffle tracks button",*/ "1f500", 185, EmojiCode(0x1f500)),
+        EmojiRecord("symbols", /*"repeat button",*/ "1f501", 186, EmojiCode(0x1f501)),
+        EmojiRecord("symbols", /*"repeat single button",*/ "1f502", 187, EmojiCode(0x1f502)),
+        EmojiRecord("symbols", /*"counterclockwise arrows button",*/ "1f504", 188, EmojiCode(0x1f504)),
+        EmojiRecord("symbols", /*"clockwise vertical arrows",*/ "1f503", 189, EmojiCode(0x1f503)),
+        EmojiRecord("symbols", /*"musical note",*/ "1f3b5", 190, EmojiCode(0x1f3b5)),
+        EmojiRecord("symbols", /*"musical notes",*/ "1f3b6", 191, EmojiCode(0x1f3b6)),
+        EmojiRecord("symbols", /*"heavy plus sign",*/ "2795", 192, EmojiCode(0x2795)),
+        EmojiRecord("symbols", /*"heavy minus sign",*/ "2796", 193, EmojiCode(0x2796)),
+        EmojiRecord("symbols", /*"heavy division sign",*/ "2797", 194, EmojiCode(0x2797)),
+        EmojiRecord("symbols", /*"heavy multiplication x",*/ "2716", 195, EmojiCode(0x2716), EmojiCode(0x2716, 0xfe0f)),
+        EmojiRecord("symbols", /*"heavy dollar sign",*/ "1f4b2", 196, EmojiCode(0x1f4b2)),
+        EmojiRecord("symbols", /*"currency exchange",*/ "1f4b1", 197, EmojiCode(0x1f4b1)),
+        EmojiRecord("symbols", /*"trade mark",*/ "2122", 198, EmojiCode(0x2122), EmojiCode(0x2122, 0xfe0f)),
+        EmojiRecord("symbols", /*"copyright",*/ "00a9", 199, EmojiCode(0x00a9), EmojiCode(0x00a9, 0xfe0f)),
+        EmojiRecord("symbols", /*"registered",*/ "00ae", 200, EmojiCode(0x00ae), EmojiCode(0x00ae, 0xfe0f)),
+        EmojiRecord("symbols", /*"wavy dash",*/ "3030", 201, EmojiCode(0x3030), EmojiCode(0x3030, 0xfe0f)),
+        EmojiRecord("symbols", /*"curly loop",*/ "27b0", 202, EmojiCode(0x27b0)),
+        EmojiRecord("symbols", /*"double curly loop",*/ "27bf", 203, EmojiCode(0x27bf)),
+        EmojiRecord("symbols", /*"END arrow",*/ "1f51a", 204, EmojiCode(0x1f51a)),
+        EmojiRecord("symbols", /*"BACK arrow",*/ "1f519", 205, EmojiCode(0x1f519)),
+        EmojiRecord("symbols", /*"ON! arrow",*/ "1f51b", 206, EmojiCode(0x1f51b)),
+        EmojiRecord("symbols", /*"TOP arrow",*/ "1f51d", 207, EmojiCode(0x1f51d)),
+        EmojiRecord("symbols", /*"SOON arrow",*/ "1f51c", 208, EmojiCode(0x1f51c)),
+        EmojiRecord("symbols", /*"heavy check mark",*/ "2714", 209, EmojiCode(0x2714), EmojiCode(0x2714, 0xfe0f)),
+        EmojiRecord("symbols", /*"ballot box with check",*/ "2611", 210, EmojiCode(0x2611), EmojiCode(0x2611, 0xfe0f)),
+        EmojiRecord("symbols", /*"radio button",*/ "1f518", 211, EmojiCode(0x1f518)),
+        EmojiRecord("symbols", /*"white circle",*/ "26aa", 212, EmojiCode(0x26aa), EmojiCode(0x26aa, 0xfe0f)),
+        EmojiRecord("symbols", /*"black circle",*/ "26ab", 213, EmojiCode(0x26ab), EmojiCode(0x26ab, 0xfe0f)),
+        EmojiRecord("symbols", /*"red circle",*/ "1f534", 214, EmojiCode(0x1f534)),
+        EmojiRecord("symbols", /*"blue circle",*/ "1f535", 215, EmojiCode(0x1f535)),
+        EmojiRecord("symbols", /*"red triangle pointed up",*/ "1f53a", 216, EmojiCode(0x1f53a)),
+        EmojiRecord("symbols", /*"red triangle pointed down",*/ "1f53b", 217, EmojiCode(0x1f53b)),
+        EmojiRecord("symbols", /*"small orange diamond",*/ "1f538", 218, EmojiCode(0x1f538)),
+        EmojiRecord("symbols", /*"small blue diamond",*/ "1f539", 219, EmojiCode(0x1f539)),
+        EmojiRecord("symbols", /*"large orange diamond",*/ "1f536", 220, EmojiCode(0x1f536)),
+        EmojiRecord("symbols", /*"large blue diamond",*/ "1f537", 221, EmojiCode(0x1f537)),
+        EmojiRecord("symbols", /*"white square button",*/ "1f533", 222, EmojiCode(0x1f533)),
+        EmojiRecord("symbols", /*"black square button",*/ "1f532", 223, EmojiCode(0x1f532)),
+        EmojiRecord("symbols", /*"black small square",*/ "25aa", 224, EmojiCode(0x25aa), EmojiCode(0x25aa, 0xfe0f)),
+        EmojiRecord("symbols", /*"white small square",*/ "25ab", 225, EmojiCode(0x25ab), EmojiCode(0x25ab, 0xfe0f)),
+        EmojiRecord("symbols", /*"black medium-small square",*/ "25fe", 226, EmojiCode(0x25fe), EmojiCode(0x25fe, 0xfe0f)),
+        EmojiRecord("symbols", /*"white medium-small square",*/ "25fd", 227, EmojiCode(0x25fd), EmojiCode(0x25fd, 0xfe0f)),
+        EmojiRecord("symbols", /*"black medium square",*/ "25fc", 228, EmojiCode(0x25fc), EmojiCode(0x25fc, 0xfe0f)),
+        EmojiRecord("symbols", /*"white medium square",*/ "25fb", 229, EmojiCode(0x25fb), EmojiCode(0x25fb, 0xfe0f)),
+        EmojiRecord("symbols", /*"black large square",*/ "2b1b", 230, EmojiCode(0x2b1b), EmojiCode(0x2b1b, 0xfe0f)),
+        EmojiRecord("symbols", /*"white large square",*/ "2b1c", 231, EmojiCode(0x2b1c), EmojiCode(0x2b1c, 0xfe0f)),
+        EmojiRecord("symbols", /*"speaker low volume",*/ "1f508", 232, EmojiCode(0x1f508), EmojiCode(0x1f508, 0xfe0f)),
+        EmojiRecord("symbols", /*"muted speaker",*/ "1f507", 233, EmojiCode(0x1f507)),
+        EmojiRecord("symbols", /*"speaker medium volume",*/ "1f509", 234, EmojiCode(0x1f509)),
+        EmojiRecord("symbols", /*"speaker high volume",*/ "1f50a", 235, EmojiCode(0x1f50a)),
+        EmojiRecord("symbols", /*"bell",*/ "1f514", 236, EmojiCode(0x1f514)),
+        EmojiRecord("symbols", /*"bell with slash",*/ "1f515", 237, EmojiCode(0x1f515)),
+        EmojiRecord("symbols", /*"megaphone",*/ "1f4e3", 238, EmojiCode(0x1f4e3)),
+        EmojiRecord("symbols", /*"loudspeaker",*/ "1f4e2", 239, EmojiCode(0x1f4e2)),
+        EmojiRecord("symbols", /*"left speech bubble",*/ "1f5e8", 240, EmojiCode(0x1f5e8), EmojiCode(0x1f5e8, 0xfe0f)),
+        EmojiRecord("symbols", /*"eye in speech bubble",*/ "1f441-1f5e8", 241, EmojiCode(0x1f441, 0x1f5e8), EmojiCode(0x1f441, 0xfe0f, 0x200d, 0x1f5e8, 0xfe0f)),
+        EmojiRecord("symbols", /*"speech balloon",*/ "1f4ac", 242, EmojiCode(0x1f4ac)),
+        EmojiRecord("symbols", /*"thought balloon",*/ "1f4ad", 243, EmojiCode(0x1f4ad)),
+        EmojiRecord("symbols", /*"right anger bubble",*/ "1f5ef", 244, EmojiCode(0x1f5ef), EmojiCode(0x1f5ef, 0xfe0f)),
+        EmojiRecord("symbols", /*"spade suit",*/ "2660", 245, EmojiCode(0x2660), EmojiCode(0x2660, 0xfe0f)),
+        EmojiRecord("symbols", /*"club suit",*/ "2663", 246, EmojiCode(0x2663), EmojiCode(0x2663, 0xfe0f)),
+        EmojiRecord("symbols", /*"heart suit",*/ "2665", 247, EmojiCode(0x2665), EmojiCode(0x2665, 0xfe0f)),
+        EmojiRecord("symbols", /*"diamond suit",*/ "2666", 248, EmojiCode(0x2666), EmojiCode(0x2666, 0xfe0f)),
+        EmojiRecord("symbols", /*"joker",*/ "1f0cf", 249, EmojiCode(0x1f0cf)),
+        EmojiRecord("symbols", /*"flower playing cards",*/ "1f3b4", 250, EmojiCode(0x1f3b4)),
+        EmojiRecord("symbols", /*"mahjong red dragon",*/ "1f004", 251, EmojiCode(0x1f004), EmojiCode(0x1f004, 0xfe0f)),
+        EmojiRecord("symbols", /*"one o’clock",*/ "1f550", 252, EmojiCode(0x1f550), EmojiCode(0x1f550, 0xfe0f)),
+        EmojiRecord("symbols", /*"two o’clock",*/ "1f551", 253, EmojiCode(0x1f551), EmojiCode(0x1f551, 0xfe0f)),
+        EmojiRecord("symbols", /*"three o’clock",*/ "1f552", 254, EmojiCode(0x1f552), EmojiCode(0x1f552, 0xfe0f)),
+        EmojiRecord("symbols", /*"four o’clock",*/ "1f553", 255, EmojiCode(0x1f553), EmojiCode(0x1f553, 0xfe0f)),
+        EmojiRecord("symbols", /*"five o’clock",*/ "1f554", 256, EmojiCode(0x1f554), EmojiCode(0x1f554, 0xfe0f)),
+        EmojiRecord("symbols", /*"six o’clock",*/ "1f555", 257, EmojiCode(0x1f555), EmojiCode(0x1f555, 0xfe0f)),
+        EmojiRecord("symbols", /*"seven o’clock",*/ "1f556", 258, EmojiCode(0x1f556), EmojiCode(0x1f556, 0xfe0f)),
+        EmojiRecord("symbols", /*"eight o’clock",*/ "1f557", 259, EmojiCode(0x1f557), EmojiCode(0x1f557, 0xfe0f)),
+        EmojiRecord("symbols", /*"nine o’clock",*/ "1f558", 260, EmojiCode(0x1f558), EmojiCode(0x1f558, 0xfe0f)),
+        EmojiRecord("symbols", /*"ten o’clock",*/ "1f559", 261, EmojiCode(0x1f559), EmojiCode(0x1f559, 0xfe0f)),
+        EmojiRecord("symbols", /*"eleven o’clock",*/ "1f55a", 262, EmojiCode(0x1f55a), EmojiCode(0x1f55a, 0xfe0f)),
+        EmojiRecord("symbols", /*"twelve o’clock",*/ "1f55b", 263, EmojiCode(0x1f55b), EmojiCode(0x1f55b, 0xfe0f)),
+        EmojiRecord("symbols", /*"one-thirty",*/ "1f55c", 264, EmojiCode(0x1f55c), EmojiCode(0x1f55c, 0xfe0f)),
+        EmojiRecord("symbols", /*"two-thirty",*/ "1f55d", 265, EmojiCode(0x1f55d), EmojiCode(0x1f55d, 0xfe0f)),
+        EmojiRecord("symbols", /*"three-thirty",*/ "1f55e", 266, EmojiCode(0x1f55e), EmojiCode(0x1f55e, 0xfe0f)),
+        EmojiRecord("symbols", /*"four-thirty",*/ "1f55f", 267, EmojiCode(0x1f55f), EmojiCode(0x1f55f, 0xfe0f)),
+        EmojiRecord("symbols", /*"five-thirty",*/ "1f560", 268, EmojiCode(0x1f560), EmojiCode(0x1f560, 0xfe0f)),
+        EmojiRecord("symbols", /*"six-thirty",*/ "1f561", 269, EmojiCode(0x1f561), EmojiCode(0x1f561, 0xfe0f)),
+        EmojiRecord("symbols", /*"seven-thirty",*/ "1f562", 270, EmojiCode(0x1f562), EmojiCode(0x1f562, 0xfe0f)),
+        EmojiRecord("symbols", /*"eight-thirty",*/ "1f563", 271, EmojiCode(0x1f563), EmojiCode(0x1f563, 0xfe0f)),
+        EmojiRecord("symbols", /*"nine-thirty",*/ "1f564", 272, EmojiCode(0x1f564), EmojiCode(0x1f564, 0xfe0f)),
+        EmojiRecord("symbols", /*"ten-thirty",*/ "1f565", 273, EmojiCode(0x1f565), EmojiCode(0x1f565, 0xfe0f)),
+        EmojiRecord("symbols", /*"eleven-thirty",*/ "1f566", 274, EmojiCode(0x1f566), EmojiCode(0x1f566, 0xfe0f)),
+        EmojiRecord("symbols", /*"twelve-thirty",*/ "1f567", 275, EmojiCode(0x1f567), EmojiCode(0x1f567, 0xfe0f)),
+        EmojiRecord("symbols", /*"digit zero",*/ "0030", 276, EmojiCode(0x0030), EmojiCode(0x0030, 0xfe0f)),
+        EmojiRecord("symbols", /*"digit one",*/ "0031", 277, EmojiCode(0x0031), EmojiCode(0x0031, 0xfe0f)),
+        EmojiRecord("symbols", /*"digit two",*/ "0032", 278, EmojiCode(0x0032), EmojiCode(0x0032, 0xfe0f)),
+        EmojiRecord("symbols", /*"digit three",*/ "0033", 279, EmojiCode(0x0033), EmojiCode(0x0033, 0xfe0f)),
+        EmojiRecord("symbols", /*"digit four",*/ "0034", 280, EmojiCode(0x0034), EmojiCode(0x0034, 0xfe0f)),
+        EmojiRecord("symbols", /*"digit five",*/ "0035", 281, EmojiCode(0x0035), EmojiCode(0x0035, 0xfe0f)),
+        EmojiRecord("symbols", /*"digit six",*/ "0036", 282, EmojiCode(0x0036), EmojiCode(0x0036, 0xfe0f)),
+        EmojiRecord("symbols", /*"digit seven",*/ "0037", 283, EmojiCode(0x0037), EmojiCode(0x0037, 0xfe0f)),
+        EmojiRecord("symbols", /*"digit eight",*/ "0038", 284, EmojiCode(0x0038), EmojiCode(0x0038, 0xfe0f)),
+        EmojiRecord("symbols", /*"digit nine",*/ "0039", 285, EmojiCode(0x0039), EmojiCode(0x0039, 0xfe0f)),
+        EmojiRecord("symbols", /*"pound symbol",*/ "0023", 286, EmojiCode(0x0023), EmojiCode(0x0023, 0xfe0f)),
+        EmojiRecord("symbols", /*"asterisk",*/ "002a", 287, EmojiCode(0x002a), EmojiCode(0x002a, 0xfe0f)),
+        EmojiRecord("symbols", /*"female sign",*/ "2640", 288, EmojiCode(0x2640), EmojiCode(0x2640, 0xfe0f)),
+        EmojiRecord("symbols", /*"male sign",*/ "2642", 289, EmojiCode(0x2642), EmojiCode(0x2642, 0xfe0f)),
+        EmojiRecord("symbols", /*"medical symbol",*/ "2695", 290, EmojiCode(0x2695), EmojiCode(0x2695, 0xfe0f)),
+        EmojiRecord("activity", /*"soccer ball",*/ "26bd", 291, EmojiCode(0x26bd), EmojiCode(0x26bd, 0xfe0f)),
+        EmojiRecord("activity", /*"basketball",*/ "1f3c0", 292, EmojiCode(0x1f3c0)),
+        EmojiRecord("activity", /*"american football",*/ "1f3c8", 293, EmojiCode(0x1f3c8)),
+        EmojiRecord("activity", /*"baseball",*/ "26be", 294, EmojiCode(0x26be), EmojiCode(0x26be, 0xfe0f)),
+        EmojiRecord("activity", /*"softball",*/ "1f94e", 295, EmojiCode(0x1f94e)),
+        EmojiRecord("activity", /*"tennis",*/ "1f3be", 296, EmojiCode(0x1f3be)),
+        EmojiRecord("activity", /*"volleyball",*/ "1f3d0", 297, EmojiCode(0x1f3d0)),
+        EmojiRecord("activity", /*"rugby football",*/ "1f3c9", 298, EmojiCode(0x1f3c9)),
+        EmojiRecord("activity", /*"pool 8 ball",*/ "1f3b1", 299, EmojiCode(0x1f3b1)),
+        EmojiRecord("activity", /*"ping pong",*/ "1f3d3", 300, EmojiCode(0x1f3d3)),
+        EmojiRecord("activity", /*"badminton",*/ "1f3f8", 301, EmojiCode(0x1f3f8)),
+        EmojiRecord("activity", /*"goal net",*/ "1f945", 302, EmojiCode(0x1f945)),
+        EmojiRecord("activity", /*"ice hockey",*/ "1f3d2", 303, EmojiCode(0x1f3d2)),
+        EmojiRecord("activity", /*"field hockey",*/ "1f3d1", 304, EmojiCode(0x1f3d1)),
+        EmojiRecord("activity", /*"cricket game",*/ "1f3cf", 305, EmojiCode(0x1f3cf)),
+        EmojiRecord("activity", /*"lacrosse",*/ "1f94d", 306, EmojiCode(0x1f94d)),
+        EmojiRecord("activity", /*"flag in hole",*/ "26f3", 307, EmojiCode(0x26f3), EmojiCode(0x26f3, 0xfe0f)),
+        EmojiRecord("activity", /*"flying disc",*/ "1f94f", 308, EmojiCode(0x1f94f)),
+        EmojiRecord("activity", /*"bow and arrow",*/ "1f3f9", 309, EmojiCode(0x1f3f9)),
+        EmojiRecord("activity", /*"fishing pole",*/ "1f3a3", 310, EmojiCode(0x1f3a3)),
+        EmojiRecord("activity", /*"boxing glove",*/ "1f94a", 311, EmojiCode(0x1f94a)),
+        EmojiRecord("activity", /*"martial arts uniform",*/ "1f94b", 312, EmojiCode(0x1f94b)),
+        EmojiRecord("activity", /*"running shirt",*/ "1f3bd", 313, EmojiCode(0x1f3bd)),
+        EmojiRecord("activity", /*"skateboard",*/ "1f6f9", 314, EmojiCode(0x1f6f9)),
+        EmojiRecord("activity", /*"ice skate",*/ "26f8", 315, EmojiCode(0x26f8), EmojiCode(0x26f8, 0xfe0f)),
+        EmojiRecord("activity", /*"curling stone",*/ "1f94c", 316, EmojiCode(0x1f94c)),
+        EmojiRecord("activity", /*"sled",*/ "1f6f7", 317, EmojiCode(0x1f6f7)),
+        EmojiRecord("activity", /*"skis",*/ "1f3bf", 318, EmojiCode(0x1f3bf)),
+        EmojiRecord("activity", /*"skier",*/ "26f7", 319, EmojiCode(0x26f7), EmojiCode(0x26f7, 0xfe0f)),
+        EmojiRecord("activity", /*"snowboarder",*/ "1f3c2", 320, EmojiCode(0x1f3c2), EmojiCode(0x1f3c2, 0xfe0f)),
+        EmojiRecord("activity", /*"snowboarder: light skin tone",*/ "1f3c2-1f3fb", 321, EmojiCode(0x1f3c2, 0x1f3fb)),
+        EmojiRecord("activity", /*"snowboarder: medium-light skin tone",*/ "1f3c2-1f3fc", 322, EmojiCode(0x1f3c2, 0x1f3fc)),
+        EmojiRecord("activity", /*"snowboarder: medium skin tone",*/ "1f3c2-1f3fd", 323, EmojiCode(0x1f3c2, 0x1f3fd)),
+        EmojiRecord("activity", /*"snowboarder: medium-dark skin tone",*/ "1f3c2-1f3fe", 324, EmojiCode(0x1f3c2, 0x1f3fe)),
+        EmojiRecord("activity", /*"snowboarder: dark skin tone",*/ "1f3c2-1f3ff", 325, EmojiCode(0x1f3c2, 0x1f3ff)),
+        EmojiRecord("activity", /*"person lifting weights",*/ "1f3cb", 326, EmojiCode(0x1f3cb), EmojiCode(0x1f3cb, 0xfe0f)),
+        EmojiRecord("activity", /*"person lifting weights: light skin tone",*/ "1f3cb-1f3fb", 327, EmojiCode(0x1f3cb, 0x1f3fb), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fb)),
+        EmojiRecord("activity", /*"person lifting weights: medium-light skin tone",*/ "1f3cb-1f3fc", 328, EmojiCode(0x1f3cb, 0x1f3fc), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fc)),
+        EmojiRecord("activity", /*"person lifting weights: medium skin tone",*/ "1f3cb-1f3fd", 329, EmojiCode(0x1f3cb, 0x1f3fd), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fd)),
+        EmojiRecord("activity", /*"person lifting weights: medium-dark skin tone",*/ "1f3cb-1f3fe", 330, EmojiCode(0x1f3cb, 0x1f3fe), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fe)),
+        EmojiRecord("activity", /*"person lifting weights: dark skin tone",*/ "1f3cb-1f3ff", 331, EmojiCode(0x1f3cb, 0x1f3ff), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman lifting weights",*/ "1f3cb-2640", 332, EmojiCode(0x1f3cb, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman lifting weights: light skin tone",*/ "1f3cb-1f3fb-2640", 333, EmojiCode(0x1f3cb, 0x1f3fb, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman lifting weights: medium-light skin tone",*/ "1f3cb-1f3fc-2640", 334, EmojiCode(0x1f3cb, 0x1f3fc, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman lifting weights: medium skin tone",*/ "1f3cb-1f3fd-2640", 335, EmojiCode(0x1f3cb, 0x1f3fd, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman lifting weights: medium-dark skin tone",*/ "1f3cb-1f3fe-2640", 336, EmojiCode(0x1f3cb, 0x1f3fe, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman lifting weights: dark skin tone",*/ "1f3cb-1f3ff-2640", 337, EmojiCode(0x1f3cb, 0x1f3ff, 0x2640), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man lifting weights",*/ "1f3cb-2642", 338, EmojiCode(0x1f3cb, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man lifting weights: light skin tone",*/ "1f3cb-1f3fb-2642", 339, EmojiCode(0x1f3cb, 0x1f3fb, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man lifting weights: medium-light skin tone",*/ "1f3cb-1f3fc-2642", 340, EmojiCode(0x1f3cb, 0x1f3fc, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man lifting weights: medium skin tone",*/ "1f3cb-1f3fd-2642", 341, EmojiCode(0x1f3cb, 0x1f3fd, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man lifting weights: medium-dark skin tone",*/ "1f3cb-1f3fe-2642", 342, EmojiCode(0x1f3cb, 0x1f3fe, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man lifting weights: dark skin tone",*/ "1f3cb-1f3ff-2642", 343, EmojiCode(0x1f3cb, 0x1f3ff, 0x2642), EmojiCode(0x1f3cb, 0xfe0f, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"people wrestling",*/ "1f93c", 344, EmojiCode(0x1f93c)),
+        EmojiRecord("activity", /*"women wrestling",*/ "1f93c-2640", 345, EmojiCode(0x1f93c, 0x2640), EmojiCode(0x1f93c, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"men wrestling",*/ "1f93c-2642", 346, EmojiCode(0x1f93c, 0x2642), EmojiCode(0x1f93c, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person cartwheeling",*/ "1f938", 347, EmojiCode(0x1f938)),
+        EmojiRecord("activity", /*"person cartwheeling: light skin tone",*/ "1f938-1f3fb", 348, EmojiCode(0x1f938, 0x1f3fb)),
+        EmojiRecord("activity", /*"person cartwheeling: medium-light skin tone",*/ "1f938-1f3fc", 349, EmojiCode(0x1f938, 0x1f3fc)),
+        EmojiRecord("activity", /*"person cartwheeling: medium skin tone",*/ "1f938-1f3fd", 350, EmojiCode(0x1f938, 0x1f3fd)),
+        EmojiRecord("activity", /*"person cartwheeling: medium-dark skin tone",*/ "1f938-1f3fe", 351, EmojiCode(0x1f938, 0x1f3fe)),
+        EmojiRecord("activity", /*"person cartwheeling: dark skin tone",*/ "1f938-1f3ff", 352, EmojiCode(0x1f938, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman cartwheeling",*/ "1f938-2640", 353, EmojiCode(0x1f938, 0x2640), EmojiCode(0x1f938, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman cartwheeling: light skin tone",*/ "1f938-1f3fb-2640", 354, EmojiCode(0x1f938, 0x1f3fb, 0x2640), EmojiCode(0x1f938, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman cartwheeling: medium-light skin tone",*/ "1f938-1f3fc-2640", 355, EmojiCode(0x1f938, 0x1f3fc, 0x2640), EmojiCode(0x1f938, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman cartwheeling: medium skin tone",*/ "1f938-1f3fd-2640", 356, EmojiCode(0x1f938, 0x1f3fd, 0x2640), EmojiCode(0x1f938, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman cartwheeling: medium-dark skin tone",*/ "1f938-1f3fe-2640", 357, EmojiCode(0x1f938, 0x1f3fe, 0x2640), EmojiCode(0x1f938, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman cartwheeling: dark skin tone",*/ "1f938-1f3ff-2640", 358, EmojiCode(0x1f938, 0x1f3ff, 0x2640), EmojiCode(0x1f938, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man cartwheeling",*/ "1f938-2642", 359, EmojiCode(0x1f938, 0x2642), EmojiCode(0x1f938, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man cartwheeling: light skin tone",*/ "1f938-1f3fb-2642", 360, EmojiCode(0x1f938, 0x1f3fb, 0x2642), EmojiCode(0x1f938, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man cartwheeling: medium-light skin tone",*/ "1f938-1f3fc-2642", 361, EmojiCode(0x1f938, 0x1f3fc, 0x2642), EmojiCode(0x1f938, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man cartwheeling: medium skin tone",*/ "1f938-1f3fd-2642", 362, EmojiCode(0x1f938, 0x1f3fd, 0x2642), EmojiCode(0x1f938, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man cartwheeling: medium-dark skin tone",*/ "1f938-1f3fe-2642", 363, EmojiCode(0x1f938, 0x1f3fe, 0x2642), EmojiCode(0x1f938, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man cartwheeling: dark skin tone",*/ "1f938-1f3ff-2642", 364, EmojiCode(0x1f938, 0x1f3ff, 0x2642), EmojiCode(0x1f938, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person bouncing ball",*/ "26f9", 365, EmojiCode(0x26f9), EmojiCode(0x26f9, 0xfe0f)),
+        EmojiRecord("activity", /*"person bouncing ball: light skin tone",*/ "26f9-1f3fb", 366, EmojiCode(0x26f9, 0x1f3fb), EmojiCode(0x26f9, 0xfe0f, 0x1f3fb)),
+        EmojiRecord("activity", /*"person bouncing ball: medium-light skin tone",*/ "26f9-1f3fc", 367, EmojiCode(0x26f9, 0x1f3fc), EmojiCode(0x26f9, 0xfe0f, 0x1f3fc)),
+        EmojiRecord("activity", /*"person bouncing ball: medium skin tone",*/ "26f9-1f3fd", 368, EmojiCode(0x26f9, 0x1f3fd), EmojiCode(0x26f9, 0xfe0f, 0x1f3fd)),
+        EmojiRecord("activity", /*"person bouncing ball: medium-dark skin tone",*/ "26f9-1f3fe", 369, EmojiCode(0x26f9, 0x1f3fe), EmojiCode(0x26f9, 0xfe0f, 0x1f3fe)),
+        EmojiRecord("activity", /*"person bouncing ball: dark skin tone",*/ "26f9-1f3ff", 370, EmojiCode(0x26f9, 0x1f3ff), EmojiCode(0x26f9, 0xfe0f, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman bouncing ball",*/ "26f9-2640", 371, EmojiCode(0x26f9, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman bouncing ball: light skin tone",*/ "26f9-1f3fb-2640", 372, EmojiCode(0x26f9, 0x1f3fb, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman bouncing ball: medium-light skin tone",*/ "26f9-1f3fc-2640", 373, EmojiCode(0x26f9, 0x1f3fc, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman bouncing ball: medium skin tone",*/ "26f9-1f3fd-2640", 374, EmojiCode(0x26f9, 0x1f3fd, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman bouncing ball: medium-dark skin tone",*/ "26f9-1f3fe-2640", 375, EmojiCode(0x26f9, 0x1f3fe, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman bouncing ball: dark skin tone",*/ "26f9-1f3ff-2640", 376, EmojiCode(0x26f9, 0x1f3ff, 0x2640), EmojiCode(0x26f9, 0xfe0f, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man bouncing ball",*/ "26f9-2642", 377, EmojiCode(0x26f9, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man bouncing ball: light skin tone",*/ "26f9-1f3fb-2642", 378, EmojiCode(0x26f9, 0x1f3fb, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man bouncing ball: medium-light skin tone",*/ "26f9-1f3fc-2642", 379, EmojiCode(0x26f9, 0x1f3fc, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man bouncing ball: medium skin tone",*/ "26f9-1f3fd-2642", 380, EmojiCode(0x26f9, 0x1f3fd, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man bouncing ball: medium-dark skin tone",*/ "26f9-1f3fe-2642", 381, EmojiCode(0x26f9, 0x1f3fe, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man bouncing ball: dark skin tone",*/ "26f9-1f3ff-2642", 382, EmojiCode(0x26f9, 0x1f3ff, 0x2642), EmojiCode(0x26f9, 0xfe0f, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person fencing",*/ "1f93a", 383, EmojiCode(0x1f93a)),
+        EmojiRecord("activity", /*"person playing handball",*/ "1f93e", 384, EmojiCode(0x1f93e)),
+        EmojiRecord("activity", /*"person playing handball: light skin tone",*/ "1f93e-1f3fb", 385, EmojiCode(0x1f93e, 0x1f3fb)),
+        EmojiRecord("activity", /*"person playing handball: medium-light skin tone",*/ "1f93e-1f3fc", 386, EmojiCode(0x1f93e, 0x1f3fc)),
+        EmojiRecord("activity", /*"person playing handball: medium skin tone",*/ "1f93e-1f3fd", 387, EmojiCode(0x1f93e, 0x1f3fd)),
+        EmojiRecord("activity", /*"person playing handball: medium-dark skin tone",*/ "1f93e-1f3fe", 388, EmojiCode(0x1f93e, 0x1f3fe)),
+        EmojiRecord("activity", /*"person playing handball: dark skin tone",*/ "1f93e-1f3ff", 389, EmojiCode(0x1f93e, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman playing handball",*/ "1f93e-2640", 390, EmojiCode(0x1f93e, 0x2640), EmojiCode(0x1f93e, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman playing handball: light skin tone",*/ "1f93e-1f3fb-2640", 391, EmojiCode(0x1f93e, 0x1f3fb, 0x2640), EmojiCode(0x1f93e, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman playing handball: medium-light skin tone",*/ "1f93e-1f3fc-2640", 392, EmojiCode(0x1f93e, 0x1f3fc, 0x2640), EmojiCode(0x1f93e, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman playing handball: medium skin tone",*/ "1f93e-1f3fd-2640", 393, EmojiCode(0x1f93e, 0x1f3fd, 0x2640), EmojiCode(0x1f93e, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman playing handball: medium-dark skin tone",*/ "1f93e-1f3fe-2640", 394, EmojiCode(0x1f93e, 0x1f3fe, 0x2640), EmojiCode(0x1f93e, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman playing handball: dark skin tone",*/ "1f93e-1f3ff-2640", 395, EmojiCode(0x1f93e, 0x1f3ff, 0x2640), EmojiCode(0x1f93e, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing handball",*/ "1f93e-2642", 396, EmojiCode(0x1f93e, 0x2642), EmojiCode(0x1f93e, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing handball: light skin tone",*/ "1f93e-1f3fb-2642", 397, EmojiCode(0x1f93e, 0x1f3fb, 0x2642), EmojiCode(0x1f93e, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing handball: medium-light skin tone",*/ "1f93e-1f3fc-2642", 398, EmojiCode(0x1f93e, 0x1f3fc, 0x2642), EmojiCode(0x1f93e, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing handball: medium skin tone",*/ "1f93e-1f3fd-2642", 399, EmojiCode(0x1f93e, 0x1f3fd, 0x2642), EmojiCode(0x1f93e, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing handball: medium-dark skin tone",*/ "1f93e-1f3fe-2642", 400, EmojiCode(0x1f93e, 0x1f3fe, 0x2642), EmojiCode(0x1f93e, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing handball: dark skin tone",*/ "1f93e-1f3ff-2642", 401, EmojiCode(0x1f93e, 0x1f3ff, 0x2642), EmojiCode(0x1f93e, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person golfing",*/ "1f3cc", 402, EmojiCode(0x1f3cc), EmojiCode(0x1f3cc, 0xfe0f)),
+        EmojiRecord("activity", /*"person golfing: light skin tone",*/ "1f3cc-1f3fb", 403, EmojiCode(0x1f3cc, 0x1f3fb), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fb)),
+        EmojiRecord("activity", /*"person golfing: medium-light skin tone",*/ "1f3cc-1f3fc", 404, EmojiCode(0x1f3cc, 0x1f3fc), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fc)),
+        EmojiRecord("activity", /*"person golfing: medium skin tone",*/ "1f3cc-1f3fd", 405, EmojiCode(0x1f3cc, 0x1f3fd), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fd)),
+        EmojiRecord("activity", /*"person golfing: medium-dark skin tone",*/ "1f3cc-1f3fe", 406, EmojiCode(0x1f3cc, 0x1f3fe), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fe)),
+        EmojiRecord("activity", /*"person golfing: dark skin tone",*/ "1f3cc-1f3ff", 407, EmojiCode(0x1f3cc, 0x1f3ff), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman golfing",*/ "1f3cc-2640", 408, EmojiCode(0x1f3cc, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman golfing: light skin tone",*/ "1f3cc-1f3fb-2640", 409, EmojiCode(0x1f3cc, 0x1f3fb, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman golfing: medium-light skin tone",*/ "1f3cc-1f3fc-2640", 410, EmojiCode(0x1f3cc, 0x1f3fc, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman golfing: medium skin tone",*/ "1f3cc-1f3fd-2640", 411, EmojiCode(0x1f3cc, 0x1f3fd, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman golfing: medium-dark skin tone",*/ "1f3cc-1f3fe-2640", 412, EmojiCode(0x1f3cc, 0x1f3fe, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman golfing: dark skin tone",*/ "1f3cc-1f3ff-2640", 413, EmojiCode(0x1f3cc, 0x1f3ff, 0x2640), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man golfing",*/ "1f3cc-2642", 414, EmojiCode(0x1f3cc, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man golfing: light skin tone",*/ "1f3cc-1f3fb-2642", 415, EmojiCode(0x1f3cc, 0x1f3fb, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man golfing: medium-light skin tone",*/ "1f3cc-1f3fc-2642", 416, EmojiCode(0x1f3cc, 0x1f3fc, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man golfing: medium skin tone",*/ "1f3cc-1f3fd-2642", 417, EmojiCode(0x1f3cc, 0x1f3fd, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man golfing: medium-dark skin tone",*/ "1f3cc-1f3fe-2642", 418, EmojiCode(0x1f3cc, 0x1f3fe, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man golfing: dark skin tone",*/ "1f3cc-1f3ff-2642", 419, EmojiCode(0x1f3cc, 0x1f3ff, 0x2642), EmojiCode(0x1f3cc, 0xfe0f, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"horse racing",*/ "1f3c7", 420, EmojiCode(0x1f3c7)),
+        EmojiRecord("activity", /*"horse racing: light skin tone",*/ "1f3c7-1f3fb", 421, EmojiCode(0x1f3c7, 0x1f3fb)),
+        EmojiRecord("activity", /*"horse racing: medium-light skin tone",*/ "1f3c7-1f3fc", 422, EmojiCode(0x1f3c7, 0x1f3fc)),
+        EmojiRecord("activity", /*"horse racing: medium skin tone",*/ "1f3c7-1f3fd", 423, EmojiCode(0x1f3c7, 0x1f3fd)),
+        EmojiRecord("activity", /*"horse racing: medium-dark skin tone",*/ "1f3c7-1f3fe", 424, EmojiCode(0x1f3c7, 0x1f3fe)),
+        EmojiRecord("activity", /*"horse racing: dark skin tone",*/ "1f3c7-1f3ff", 425, EmojiCode(0x1f3c7, 0x1f3ff)),
+        EmojiRecord("activity", /*"person in lotus position",*/ "1f9d8", 426, EmojiCode(0x1f9d8)),
+        EmojiRecord("activity", /*"person in lotus position: light skin tone",*/ "1f9d8-1f3fb", 427, EmojiCode(0x1f9d8, 0x1f3fb)),
+        EmojiRecord("activity", /*"person in lotus position: medium-light skin tone",*/ "1f9d8-1f3fc", 428, EmojiCode(0x1f9d8, 0x1f3fc)),
+        EmojiRecord("activity", /*"person in lotus position: medium skin tone",*/ "1f9d8-1f3fd", 429, EmojiCode(0x1f9d8, 0x1f3fd)),
+        EmojiRecord("activity", /*"person in lotus position: medium-dark skin tone",*/ "1f9d8-1f3fe", 430, EmojiCode(0x1f9d8, 0x1f3fe)),
+        EmojiRecord("activity", /*"person in lotus position: dark skin tone",*/ "1f9d8-1f3ff", 431, EmojiCode(0x1f9d8, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman in lotus position",*/ "1f9d8-2640", 432, EmojiCode(0x1f9d8, 0x2640), EmojiCode(0x1f9d8, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman in lotus position: light skin tone",*/ "1f9d8-1f3fb-2640", 433, EmojiCode(0x1f9d8, 0x1f3fb, 0x2640), EmojiCode(0x1f9d8, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman in lotus position: medium-light skin tone",*/ "1f9d8-1f3fc-2640", 434, EmojiCode(0x1f9d8, 0x1f3fc, 0x2640), EmojiCode(0x1f9d8, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman in lotus position: medium skin tone",*/ "1f9d8-1f3fd-2640", 435, EmojiCode(0x1f9d8, 0x1f3fd, 0x2640), EmojiCode(0x1f9d8, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman in lotus position: medium-dark skin tone",*/ "1f9d8-1f3fe-2640", 436, EmojiCode(0x1f9d8, 0x1f3fe, 0x2640), EmojiCode(0x1f9d8, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman in lotus position: dark skin tone",*/ "1f9d8-1f3ff-2640", 437, EmojiCode(0x1f9d8, 0x1f3ff, 0x2640), EmojiCode(0x1f9d8, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man in lotus position",*/ "1f9d8-2642", 438, EmojiCode(0x1f9d8, 0x2642), EmojiCode(0x1f9d8, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man in lotus position: light skin tone",*/ "1f9d8-1f3fb-2642", 439, EmojiCode(0x1f9d8, 0x1f3fb, 0x2642), EmojiCode(0x1f9d8, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man in lotus position: medium-light skin tone",*/ "1f9d8-1f3fc-2642", 440, EmojiCode(0x1f9d8, 0x1f3fc, 0x2642), EmojiCode(0x1f9d8, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man in lotus position: medium skin tone",*/ "1f9d8-1f3fd-2642", 441, EmojiCode(0x1f9d8, 0x1f3fd, 0x2642), EmojiCode(0x1f9d8, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man in lotus position: medium-dark skin tone",*/ "1f9d8-1f3fe-2642", 442, EmojiCode(0x1f9d8, 0x1f3fe, 0x2642), EmojiCode(0x1f9d8, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man in lotus position: dark skin tone",*/ "1f9d8-1f3ff-2642", 443, EmojiCode(0x1f9d8, 0x1f3ff, 0x2642), EmojiCode(0x1f9d8, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person surfing",*/ "1f3c4", 444, EmojiCode(0x1f3c4), EmojiCode(0x1f3c4, 0xfe0f)),
+        EmojiRecord("activity", /*"person surfing: light skin tone",*/ "1f3c4-1f3fb", 445, EmojiCode(0x1f3c4, 0x1f3fb)),
+        EmojiRecord("activity", /*"person surfing: medium-light skin tone",*/ "1f3c4-1f3fc", 446, EmojiCode(0x1f3c4, 0x1f3fc)),
+        EmojiRecord("activity", /*"person surfing: medium skin tone",*/ "1f3c4-1f3fd", 447, EmojiCode(0x1f3c4, 0x1f3fd)),
+        EmojiRecord("activity", /*"person surfing: medium-dark skin tone",*/ "1f3c4-1f3fe", 448, EmojiCode(0x1f3c4, 0x1f3fe)),
+        EmojiRecord("activity", /*"person surfing: dark skin tone",*/ "1f3c4-1f3ff", 449, EmojiCode(0x1f3c4, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman surfing",*/ "1f3c4-2640", 450, EmojiCode(0x1f3c4, 0x2640), EmojiCode(0x1f3c4, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman surfing: light skin tone",*/ "1f3c4-1f3fb-2640", 451, EmojiCode(0x1f3c4, 0x1f3fb, 0x2640), EmojiCode(0x1f3c4, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman surfing: medium-light skin tone",*/ "1f3c4-1f3fc-2640", 452, EmojiCode(0x1f3c4, 0x1f3fc, 0x2640), EmojiCode(0x1f3c4, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman surfing: medium skin tone",*/ "1f3c4-1f3fd-2640", 453, EmojiCode(0x1f3c4, 0x1f3fd, 0x2640), EmojiCode(0x1f3c4, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman surfing: medium-dark skin tone",*/ "1f3c4-1f3fe-2640", 454, EmojiCode(0x1f3c4, 0x1f3fe, 0x2640), EmojiCode(0x1f3c4, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman surfing: dark skin tone",*/ "1f3c4-1f3ff-2640", 455, EmojiCode(0x1f3c4, 0x1f3ff, 0x2640), EmojiCode(0x1f3c4, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man surfing",*/ "1f3c4-2642", 456, EmojiCode(0x1f3c4, 0x2642), EmojiCode(0x1f3c4, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man surfing: light skin tone",*/ "1f3c4-1f3fb-2642", 457, EmojiCode(0x1f3c4, 0x1f3fb, 0x2642), EmojiCode(0x1f3c4, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man surfing: medium-light skin tone",*/ "1f3c4-1f3fc-2642", 458, EmojiCode(0x1f3c4, 0x1f3fc, 0x2642), EmojiCode(0x1f3c4, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man surfing: medium skin tone",*/ "1f3c4-1f3fd-2642", 459, EmojiCode(0x1f3c4, 0x1f3fd, 0x2642), EmojiCode(0x1f3c4, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man surfing: medium-dark skin tone",*/ "1f3c4-1f3fe-2642", 460, EmojiCode(0x1f3c4, 0x1f3fe, 0x2642), EmojiCode(0x1f3c4, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man surfing: dark skin tone",*/ "1f3c4-1f3ff-2642", 461, EmojiCode(0x1f3c4, 0x1f3ff, 0x2642), EmojiCode(0x1f3c4, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person swimming",*/ "1f3ca", 462, EmojiCode(0x1f3ca), EmojiCode(0x1f3ca, 0xfe0f)),
+        EmojiRecord("activity", /*"person swimming: light skin tone",*/ "1f3ca-1f3fb", 463, EmojiCode(0x1f3ca, 0x1f3fb)),
+        EmojiRecord("activity", /*"person swimming: medium-light skin tone",*/ "1f3ca-1f3fc", 464, EmojiCode(0x1f3ca, 0x1f3fc)),
+        EmojiRecord("activity", /*"person swimming: medium skin tone",*/ "1f3ca-1f3fd", 465, EmojiCode(0x1f3ca, 0x1f3fd)),
+        EmojiRecord("activity", /*"person swimming: medium-dark skin tone",*/ "1f3ca-1f3fe", 466, EmojiCode(0x1f3ca, 0x1f3fe)),
+        EmojiRecord("activity", /*"person swimming: dark skin tone",*/ "1f3ca-1f3ff", 467, EmojiCode(0x1f3ca, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman swimming",*/ "1f3ca-2640", 468, EmojiCode(0x1f3ca, 0x2640), EmojiCode(0x1f3ca, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman swimming: light skin tone",*/ "1f3ca-1f3fb-2640", 469, EmojiCode(0x1f3ca, 0x1f3fb, 0x2640), EmojiCode(0x1f3ca, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman swimming: medium-light skin tone",*/ "1f3ca-1f3fc-2640", 470, EmojiCode(0x1f3ca, 0x1f3fc, 0x2640), EmojiCode(0x1f3ca, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman swimming: medium skin tone",*/ "1f3ca-1f3fd-2640", 471, EmojiCode(0x1f3ca, 0x1f3fd, 0x2640), EmojiCode(0x1f3ca, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman swimming: medium-dark skin tone",*/ "1f3ca-1f3fe-2640", 472, EmojiCode(0x1f3ca, 0x1f3fe, 0x2640), EmojiCode(0x1f3ca, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman swimming: dark skin tone",*/ "1f3ca-1f3ff-2640", 473, EmojiCode(0x1f3ca, 0x1f3ff, 0x2640), EmojiCode(0x1f3ca, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man swimming",*/ "1f3ca-2642", 474, EmojiCode(0x1f3ca, 0x2642), EmojiCode(0x1f3ca, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man swimming: light skin tone",*/ "1f3ca-1f3fb-2642", 475, EmojiCode(0x1f3ca, 0x1f3fb, 0x2642), EmojiCode(0x1f3ca, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man swimming: medium-light skin tone",*/ "1f3ca-1f3fc-2642", 476, EmojiCode(0x1f3ca, 0x1f3fc, 0x2642), EmojiCode(0x1f3ca, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man swimming: medium skin tone",*/ "1f3ca-1f3fd-2642", 477, EmojiCode(0x1f3ca, 0x1f3fd, 0x2642), EmojiCode(0x1f3ca, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man swimming: medium-dark skin tone",*/ "1f3ca-1f3fe-2642", 478, EmojiCode(0x1f3ca, 0x1f3fe, 0x2642), EmojiCode(0x1f3ca, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man swimming: dark skin tone",*/ "1f3ca-1f3ff-2642", 479, EmojiCode(0x1f3ca, 0x1f3ff, 0x2642), EmojiCode(0x1f3ca, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person playing water polo",*/ "1f93d", 480, EmojiCode(0x1f93d)),
+        EmojiRecord("activity", /*"person playing water polo: light skin tone",*/ "1f93d-1f3fb", 481, EmojiCode(0x1f93d, 0x1f3fb)),
+        EmojiRecord("activity", /*"person playing water polo: medium-light skin tone",*/ "1f93d-1f3fc", 482, EmojiCode(0x1f93d, 0x1f3fc)),
+        EmojiRecord("activity", /*"person playing water polo: medium skin tone",*/ "1f93d-1f3fd", 483, EmojiCode(0x1f93d, 0x1f3fd)),
+        EmojiRecord("activity", /*"person playing water polo: medium-dark skin tone",*/ "1f93d-1f3fe", 484, EmojiCode(0x1f93d, 0x1f3fe)),
+        EmojiRecord("activity", /*"person playing water polo: dark skin tone",*/ "1f93d-1f3ff", 485, EmojiCode(0x1f93d, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman playing water polo",*/ "1f93d-2640", 486, EmojiCode(0x1f93d, 0x2640), EmojiCode(0x1f93d, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman playing water polo: light skin tone",*/ "1f93d-1f3fb-2640", 487, EmojiCode(0x1f93d, 0x1f3fb, 0x2640), EmojiCode(0x1f93d, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman playing water polo: medium-light skin tone",*/ "1f93d-1f3fc-2640", 488, EmojiCode(0x1f93d, 0x1f3fc, 0x2640), EmojiCode(0x1f93d, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman playing water polo: medium skin tone",*/ "1f93d-1f3fd-2640", 489, EmojiCode(0x1f93d, 0x1f3fd, 0x2640), EmojiCode(0x1f93d, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman playing water polo: medium-dark skin tone",*/ "1f93d-1f3fe-2640", 490, EmojiCode(0x1f93d, 0x1f3fe, 0x2640), EmojiCode(0x1f93d, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman playing water polo: dark skin tone",*/ "1f93d-1f3ff-2640", 491, EmojiCode(0x1f93d, 0x1f3ff, 0x2640), EmojiCode(0x1f93d, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing water polo",*/ "1f93d-2642", 492, EmojiCode(0x1f93d, 0x2642), EmojiCode(0x1f93d, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing water polo: light skin tone",*/ "1f93d-1f3fb-2642", 493, EmojiCode(0x1f93d, 0x1f3fb, 0x2642), EmojiCode(0x1f93d, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing water polo: medium-light skin tone",*/ "1f93d-1f3fc-2642", 494, EmojiCode(0x1f93d, 0x1f3fc, 0x2642), EmojiCode(0x1f93d, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing water polo: medium skin tone",*/ "1f93d-1f3fd-2642", 495, EmojiCode(0x1f93d, 0x1f3fd, 0x2642), EmojiCode(0x1f93d, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing water polo: medium-dark skin tone",*/ "1f93d-1f3fe-2642", 496, EmojiCode(0x1f93d, 0x1f3fe, 0x2642), EmojiCode(0x1f93d, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man playing water polo: dark skin tone",*/ "1f93d-1f3ff-2642", 497, EmojiCode(0x1f93d, 0x1f3ff, 0x2642), EmojiCode(0x1f93d, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person rowing boat",*/ "1f6a3", 498, EmojiCode(0x1f6a3)),
+        EmojiRecord("activity", /*"person rowing boat: light skin tone",*/ "1f6a3-1f3fb", 499, EmojiCode(0x1f6a3, 0x1f3fb)),
+        EmojiRecord("activity", /*"person rowing boat: medium-light skin tone",*/ "1f6a3-1f3fc", 500, EmojiCode(0x1f6a3, 0x1f3fc)),
+        EmojiRecord("activity", /*"person rowing boat: medium skin tone",*/ "1f6a3-1f3fd", 501, EmojiCode(0x1f6a3, 0x1f3fd)),
+        EmojiRecord("activity", /*"person rowing boat: medium-dark skin tone",*/ "1f6a3-1f3fe", 502, EmojiCode(0x1f6a3, 0x1f3fe)),
+        EmojiRecord("activity", /*"person rowing boat: dark skin tone",*/ "1f6a3-1f3ff", 503, EmojiCode(0x1f6a3, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman rowing boat",*/ "1f6a3-2640", 504, EmojiCode(0x1f6a3, 0x2640), EmojiCode(0x1f6a3, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman rowing boat: light skin tone",*/ "1f6a3-1f3fb-2640", 505, EmojiCode(0x1f6a3, 0x1f3fb, 0x2640), EmojiCode(0x1f6a3, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman rowing boat: medium-light skin tone",*/ "1f6a3-1f3fc-2640", 506, EmojiCode(0x1f6a3, 0x1f3fc, 0x2640), EmojiCode(0x1f6a3, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman rowing boat: medium skin tone",*/ "1f6a3-1f3fd-2640", 507, EmojiCode(0x1f6a3, 0x1f3fd, 0x2640), EmojiCode(0x1f6a3, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman rowing boat: medium-dark skin tone",*/ "1f6a3-1f3fe-2640", 508, EmojiCode(0x1f6a3, 0x1f3fe, 0x2640), EmojiCode(0x1f6a3, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman rowing boat: dark skin tone",*/ "1f6a3-1f3ff-2640", 509, EmojiCode(0x1f6a3, 0x1f3ff, 0x2640), EmojiCode(0x1f6a3, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man rowing boat",*/ "1f6a3-2642", 510, EmojiCode(0x1f6a3, 0x2642), EmojiCode(0x1f6a3, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man rowing boat: light skin tone",*/ "1f6a3-1f3fb-2642", 511, EmojiCode(0x1f6a3, 0x1f3fb, 0x2642), EmojiCode(0x1f6a3, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man rowing boat: medium-light skin tone",*/ "1f6a3-1f3fc-2642", 512, EmojiCode(0x1f6a3, 0x1f3fc, 0x2642), EmojiCode(0x1f6a3, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man rowing boat: medium skin tone",*/ "1f6a3-1f3fd-2642", 513, EmojiCode(0x1f6a3, 0x1f3fd, 0x2642), EmojiCode(0x1f6a3, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man rowing boat: medium-dark skin tone",*/ "1f6a3-1f3fe-2642", 514, EmojiCode(0x1f6a3, 0x1f3fe, 0x2642), EmojiCode(0x1f6a3, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man rowing boat: dark skin tone",*/ "1f6a3-1f3ff-2642", 515, EmojiCode(0x1f6a3, 0x1f3ff, 0x2642), EmojiCode(0x1f6a3, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person climbing",*/ "1f9d7", 516, EmojiCode(0x1f9d7)),
+        EmojiRecord("activity", /*"person climbing: light skin tone",*/ "1f9d7-1f3fb", 517, EmojiCode(0x1f9d7, 0x1f3fb)),
+        EmojiRecord("activity", /*"person climbing: medium-light skin tone",*/ "1f9d7-1f3fc", 518, EmojiCode(0x1f9d7, 0x1f3fc)),
+        EmojiRecord("activity", /*"person climbing: medium skin tone",*/ "1f9d7-1f3fd", 519, EmojiCode(0x1f9d7, 0x1f3fd)),
+        EmojiRecord("activity", /*"person climbing: medium-dark skin tone",*/ "1f9d7-1f3fe", 520, EmojiCode(0x1f9d7, 0x1f3fe)),
+        EmojiRecord("activity", /*"person climbing: dark skin tone",*/ "1f9d7-1f3ff", 521, EmojiCode(0x1f9d7, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman climbing",*/ "1f9d7-2640", 522, EmojiCode(0x1f9d7, 0x2640), EmojiCode(0x1f9d7, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman climbing: light skin tone",*/ "1f9d7-1f3fb-2640", 523, EmojiCode(0x1f9d7, 0x1f3fb, 0x2640), EmojiCode(0x1f9d7, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman climbing: medium-light skin tone",*/ "1f9d7-1f3fc-2640", 524, EmojiCode(0x1f9d7, 0x1f3fc, 0x2640), EmojiCode(0x1f9d7, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman climbing: medium skin tone",*/ "1f9d7-1f3fd-2640", 525, EmojiCode(0x1f9d7, 0x1f3fd, 0x2640), EmojiCode(0x1f9d7, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman climbing: medium-dark skin tone",*/ "1f9d7-1f3fe-2640", 526, EmojiCode(0x1f9d7, 0x1f3fe, 0x2640), EmojiCode(0x1f9d7, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman climbing: dark skin tone",*/ "1f9d7-1f3ff-2640", 527, EmojiCode(0x1f9d7, 0x1f3ff, 0x2640), EmojiCode(0x1f9d7, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man climbing",*/ "1f9d7-2642", 528, EmojiCode(0x1f9d7, 0x2642), EmojiCode(0x1f9d7, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man climbing: light skin tone",*/ "1f9d7-1f3fb-2642", 529, EmojiCode(0x1f9d7, 0x1f3fb, 0x2642), EmojiCode(0x1f9d7, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man climbing: medium-light skin tone",*/ "1f9d7-1f3fc-2642", 530, EmojiCode(0x1f9d7, 0x1f3fc, 0x2642), EmojiCode(0x1f9d7, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man climbing: medium skin tone",*/ "1f9d7-1f3fd-2642", 531, EmojiCode(0x1f9d7, 0x1f3fd, 0x2642), EmojiCode(0x1f9d7, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man climbing: medium-dark skin tone",*/ "1f9d7-1f3fe-2642", 532, EmojiCode(0x1f9d7, 0x1f3fe, 0x2642), EmojiCode(0x1f9d7, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man climbing: dark skin tone",*/ "1f9d7-1f3ff-2642", 533, EmojiCode(0x1f9d7, 0x1f3ff, 0x2642), EmojiCode(0x1f9d7, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person mountain biking",*/ "1f6b5", 534, EmojiCode(0x1f6b5)),
+        EmojiRecord("activity", /*"person mountain biking: light skin tone",*/ "1f6b5-1f3fb", 535, EmojiCode(0x1f6b5, 0x1f3fb)),
+        EmojiRecord("activity", /*"person mountain biking: medium-light skin tone",*/ "1f6b5-1f3fc", 536, EmojiCode(0x1f6b5, 0x1f3fc)),
+        EmojiRecord("activity", /*"person mountain biking: medium skin tone",*/ "1f6b5-1f3fd", 537, EmojiCode(0x1f6b5, 0x1f3fd)),
+        EmojiRecord("activity", /*"person mountain biking: medium-dark skin tone",*/ "1f6b5-1f3fe", 538, EmojiCode(0x1f6b5, 0x1f3fe)),
+        EmojiRecord("activity", /*"person mountain biking: dark skin tone",*/ "1f6b5-1f3ff", 539, EmojiCode(0x1f6b5, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman mountain biking",*/ "1f6b5-2640", 540, EmojiCode(0x1f6b5, 0x2640), EmojiCode(0x1f6b5, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman mountain biking: light skin tone",*/ "1f6b5-1f3fb-2640", 541, EmojiCode(0x1f6b5, 0x1f3fb, 0x2640), EmojiCode(0x1f6b5, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman mountain biking: medium-light skin tone",*/ "1f6b5-1f3fc-2640", 542, EmojiCode(0x1f6b5, 0x1f3fc, 0x2640), EmojiCode(0x1f6b5, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman mountain biking: medium skin tone",*/ "1f6b5-1f3fd-2640", 543, EmojiCode(0x1f6b5, 0x1f3fd, 0x2640), EmojiCode(0x1f6b5, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman mountain biking: medium-dark skin tone",*/ "1f6b5-1f3fe-2640", 544, EmojiCode(0x1f6b5, 0x1f3fe, 0x2640), EmojiCode(0x1f6b5, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman mountain biking: dark skin tone",*/ "1f6b5-1f3ff-2640", 545, EmojiCode(0x1f6b5, 0x1f3ff, 0x2640), EmojiCode(0x1f6b5, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man mountain biking",*/ "1f6b5-2642", 546, EmojiCode(0x1f6b5, 0x2642), EmojiCode(0x1f6b5, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man mountain biking: light skin tone",*/ "1f6b5-1f3fb-2642", 547, EmojiCode(0x1f6b5, 0x1f3fb, 0x2642), EmojiCode(0x1f6b5, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man mountain biking: medium-light skin tone",*/ "1f6b5-1f3fc-2642", 548, EmojiCode(0x1f6b5, 0x1f3fc, 0x2642), EmojiCode(0x1f6b5, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man mountain biking: medium skin tone",*/ "1f6b5-1f3fd-2642", 549, EmojiCode(0x1f6b5, 0x1f3fd, 0x2642), EmojiCode(0x1f6b5, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man mountain biking: medium-dark skin tone",*/ "1f6b5-1f3fe-2642", 550, EmojiCode(0x1f6b5, 0x1f3fe, 0x2642), EmojiCode(0x1f6b5, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man mountain biking: dark skin tone",*/ "1f6b5-1f3ff-2642", 551, EmojiCode(0x1f6b5, 0x1f3ff, 0x2642), EmojiCode(0x1f6b5, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"person biking",*/ "1f6b4", 552, EmojiCode(0x1f6b4)),
+        EmojiRecord("activity", /*"person biking: light skin tone",*/ "1f6b4-1f3fb", 553, EmojiCode(0x1f6b4, 0x1f3fb)),
+        EmojiRecord("activity", /*"person biking: medium-light skin tone",*/ "1f6b4-1f3fc", 554, EmojiCode(0x1f6b4, 0x1f3fc)),
+        EmojiRecord("activity", /*"person biking: medium skin tone",*/ "1f6b4-1f3fd", 555, EmojiCode(0x1f6b4, 0x1f3fd)),
+        EmojiRecord("activity", /*"person biking: medium-dark skin tone",*/ "1f6b4-1f3fe", 556, EmojiCode(0x1f6b4, 0x1f3fe)),
+        EmojiRecord("activity", /*"person biking: dark skin tone",*/ "1f6b4-1f3ff", 557, EmojiCode(0x1f6b4, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman biking",*/ "1f6b4-2640", 558, EmojiCode(0x1f6b4, 0x2640), EmojiCode(0x1f6b4, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman biking: light skin tone",*/ "1f6b4-1f3fb-2640", 559, EmojiCode(0x1f6b4, 0x1f3fb, 0x2640), EmojiCode(0x1f6b4, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman biking: medium-light skin tone",*/ "1f6b4-1f3fc-2640", 560, EmojiCode(0x1f6b4, 0x1f3fc, 0x2640), EmojiCode(0x1f6b4, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman biking: medium skin tone",*/ "1f6b4-1f3fd-2640", 561, EmojiCode(0x1f6b4, 0x1f3fd, 0x2640), EmojiCode(0x1f6b4, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman biking: medium-dark skin tone",*/ "1f6b4-1f3fe-2640", 562, EmojiCode(0x1f6b4, 0x1f3fe, 0x2640), EmojiCode(0x1f6b4, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman biking: dark skin tone",*/ "1f6b4-1f3ff-2640", 563, EmojiCode(0x1f6b4, 0x1f3ff, 0x2640), EmojiCode(0x1f6b4, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man biking",*/ "1f6b4-2642", 564, EmojiCode(0x1f6b4, 0x2642), EmojiCode(0x1f6b4, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man biking: light skin tone",*/ "1f6b4-1f3fb-2642", 565, EmojiCode(0x1f6b4, 0x1f3fb, 0x2642), EmojiCode(0x1f6b4, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man biking: medium-light skin tone",*/ "1f6b4-1f3fc-2642", 566, EmojiCode(0x1f6b4, 0x1f3fc, 0x2642), EmojiCode(0x1f6b4, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man biking: medium skin tone",*/ "1f6b4-1f3fd-2642", 567, EmojiCode(0x1f6b4, 0x1f3fd, 0x2642), EmojiCode(0x1f6b4, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man biking: medium-dark skin tone",*/ "1f6b4-1f3fe-2642", 568, EmojiCode(0x1f6b4, 0x1f3fe, 0x2642), EmojiCode(0x1f6b4, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man biking: dark skin tone",*/ "1f6b4-1f3ff-2642", 569, EmojiCode(0x1f6b4, 0x1f3ff, 0x2642), EmojiCode(0x1f6b4, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"trophy",*/ "1f3c6", 570, EmojiCode(0x1f3c6), EmojiCode(0x1f3c6, 0xfe0f)),
+        EmojiRecord("activity", /*"1st place medal",*/ "1f947", 571, EmojiCode(0x1f947)),
+        EmojiRecord("activity", /*"2nd place medal",*/ "1f948", 572, EmojiCode(0x1f948)),
+        EmojiRecord("activity", /*"3rd place medal",*/ "1f949", 573, EmojiCode(0x1f949)),
+        EmojiRecord("activity", /*"sports medal",*/ "1f3c5", 574, EmojiCode(0x1f3c5)),
+        EmojiRecord("activity", /*"military medal",*/ "1f396", 575, EmojiCode(0x1f396), EmojiCode(0x1f396, 0xfe0f)),
+        EmojiRecord("activity", /*"rosette",*/ "1f3f5", 576, EmojiCode(0x1f3f5), EmojiCode(0x1f3f5, 0xfe0f)),
+        EmojiRecord("activity", /*"reminder ribbon",*/ "1f397", 577, EmojiCode(0x1f397), EmojiCode(0x1f397, 0xfe0f)),
+        EmojiRecord("activity", /*"ticket",*/ "1f3ab", 578, EmojiCode(0x1f3ab)),
+        EmojiRecord("activity", /*"admission tickets",*/ "1f39f", 579, EmojiCode(0x1f39f), EmojiCode(0x1f39f, 0xfe0f)),
+        EmojiRecord("activity", /*"circus tent",*/ "1f3aa", 580, EmojiCode(0x1f3aa)),
+        EmojiRecord("activity", /*"person juggling",*/ "1f939", 581, EmojiCode(0x1f939)),
+        EmojiRecord("activity", /*"person juggling: light skin tone",*/ "1f939-1f3fb", 582, EmojiCode(0x1f939, 0x1f3fb)),
+        EmojiRecord("activity", /*"person juggling: medium-light skin tone",*/ "1f939-1f3fc", 583, EmojiCode(0x1f939, 0x1f3fc)),
+        EmojiRecord("activity", /*"person juggling: medium skin tone",*/ "1f939-1f3fd", 584, EmojiCode(0x1f939, 0x1f3fd)),
+        EmojiRecord("activity", /*"person juggling: medium-dark skin tone",*/ "1f939-1f3fe", 585, EmojiCode(0x1f939, 0x1f3fe)),
+        EmojiRecord("activity", /*"person juggling: dark skin tone",*/ "1f939-1f3ff", 586, EmojiCode(0x1f939, 0x1f3ff)),
+        EmojiRecord("activity", /*"woman juggling",*/ "1f939-2640", 587, EmojiCode(0x1f939, 0x2640), EmojiCode(0x1f939, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman juggling: light skin tone",*/ "1f939-1f3fb-2640", 588, EmojiCode(0x1f939, 0x1f3fb, 0x2640), EmojiCode(0x1f939, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman juggling: medium-light skin tone",*/ "1f939-1f3fc-2640", 589, EmojiCode(0x1f939, 0x1f3fc, 0x2640), EmojiCode(0x1f939, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman juggling: medium skin tone",*/ "1f939-1f3fd-2640", 590, EmojiCode(0x1f939, 0x1f3fd, 0x2640), EmojiCode(0x1f939, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman juggling: medium-dark skin tone",*/ "1f939-1f3fe-2640", 591, EmojiCode(0x1f939, 0x1f3fe, 0x2640), EmojiCode(0x1f939, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"woman juggling: dark skin tone",*/ "1f939-1f3ff-2640", 592, EmojiCode(0x1f939, 0x1f3ff, 0x2640), EmojiCode(0x1f939, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("activity", /*"man juggling",*/ "1f939-2642", 593, EmojiCode(0x1f939, 0x2642), EmojiCode(0x1f939, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man juggling: light skin tone",*/ "1f939-1f3fb-2642", 594, EmojiCode(0x1f939, 0x1f3fb, 0x2642), EmojiCode(0x1f939, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man juggling: medium-light skin tone",*/ "1f939-1f3fc-2642", 595, EmojiCode(0x1f939, 0x1f3fc, 0x2642), EmojiCode(0x1f939, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man juggling: medium skin tone",*/ "1f939-1f3fd-2642", 596, EmojiCode(0x1f939, 0x1f3fd, 0x2642), EmojiCode(0x1f939, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man juggling: medium-dark skin tone",*/ "1f939-1f3fe-2642", 597, EmojiCode(0x1f939, 0x1f3fe, 0x2642), EmojiCode(0x1f939, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"man juggling: dark skin tone",*/ "1f939-1f3ff-2642", 598, EmojiCode(0x1f939, 0x1f3ff, 0x2642), EmojiCode(0x1f939, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("activity", /*"performing arts",*/ "1f3ad", 599, EmojiCode(0x1f3ad), EmojiCode(0x1f3ad, 0xfe0f)),
+        EmojiRecord("activity", /*"artist palette",*/ "1f3a8", 600, EmojiCode(0x1f3a8)),
+        EmojiRecord("activity", /*"clapper board",*/ "1f3ac", 601, EmojiCode(0x1f3ac), EmojiCode(0x1f3ac, 0xfe0f)),
+        EmojiRecord("activity", /*"microphone",*/ "1f3a4", 602, EmojiCode(0x1f3a4)),
+        EmojiRecord("activity", /*"headphone",*/ "1f3a7", 603, EmojiCode(0x1f3a7), EmojiCode(0x1f3a7, 0xfe0f)),
+        EmojiRecord("activity", /*"musical score",*/ "1f3bc", 604, EmojiCode(0x1f3bc)),
+        EmojiRecord("activity", /*"musical keyboard",*/ "1f3b9", 605, EmojiCode(0x1f3b9)),
+        EmojiRecord("activity", /*"drum",*/ "1f941", 606, EmojiCode(0x1f941)),
+        EmojiRecord("activity", /*"saxophone",*/ "1f3b7", 607, EmojiCode(0x1f3b7)),
+        EmojiRecord("activity", /*"trumpet",*/ "1f3ba", 608, EmojiCode(0x1f3ba)),
+        EmojiRecord("activity", /*"guitar",*/ "1f3b8", 609, EmojiCode(0x1f3b8)),
+        EmojiRecord("activity", /*"violin",*/ "1f3bb", 610, EmojiCode(0x1f3bb)),
+        EmojiRecord("activity", /*"game die",*/ "1f3b2", 611, EmojiCode(0x1f3b2)),
+        EmojiRecord("activity", /*"direct hit",*/ "1f3af", 612, EmojiCode(0x1f3af)),
+        EmojiRecord("activity", /*"bowling",*/ "1f3b3", 613, EmojiCode(0x1f3b3)),
+        EmojiRecord("activity", /*"video game",*/ "1f3ae", 614, EmojiCode(0x1f3ae), EmojiCode(0x1f3ae, 0xfe0f)),
+        EmojiRecord("activity", /*"slot machine",*/ "1f3b0", 615, EmojiCode(0x1f3b0)),
+        EmojiRecord("objects", /*"watch",*/ "231a", 616, EmojiCode(0x231a), EmojiCode(0x231a, 0xfe0f)),
+        EmojiRecord("objects", /*"mobile phone",*/ "1f4f1", 617, EmojiCode(0x1f4f1)),
+        EmojiRecord("objects", /*"mobile phone with arrow",*/ "1f4f2", 618, EmojiCode(0x1f4f2)),
+        EmojiRecord("objects", /*"laptop computer",*/ "1f4bb", 619, EmojiCode(0x1f4bb), EmojiCode(0x1f4bb, 0xfe0f)),
+        EmojiRecord("objects", /*"keyboard",*/ "2328", 620, EmojiCode(0x2328), EmojiCode(0x2328, 0xfe0f)),
+        EmojiRecord("objects", /*"desktop computer",*/ "1f5a5", 621, EmojiCode(0x1f5a5), EmojiCode(0x1f5a5, 0xfe0f)),
+        EmojiRecord("objects", /*"printer",*/ "1f5a8", 622, EmojiCode(0x1f5a8), EmojiCode(0x1f5a8, 0xfe0f)),
+        EmojiRecord("objects", /*"computer mouse",*/ "1f5b1", 623, EmojiCode(0x1f5b1), EmojiCode(0x1f5b1, 0xfe0f)),
+        EmojiRecord("objects", /*"trackball",*/ "1f5b2", 624, EmojiCode(0x1f5b2), EmojiCode(0x1f5b2, 0xfe0f)),
+        EmojiRecord("objects", /*"joystick",*/ "1f579", 625, EmojiCode(0x1f579), EmojiCode(0x1f579, 0xfe0f)),
+        EmojiRecord("objects", /*"chess pawn",*/ "265f", 626, EmojiCode(0x265f), EmojiCode(0x265f, 0xfe0f)),
+        EmojiRecord("objects", /*"jigsaw",*/ "1f9e9", 627, EmojiCode(0x1f9e9)),
+        EmojiRecord("objects", /*"clamp",*/ "1f5dc", 628, EmojiCode(0x1f5dc), EmojiCode(0x1f5dc, 0xfe0f)),
+        EmojiRecord("objects", /*"computer disk",*/ "1f4bd", 629, EmojiCode(0x1f4bd)),
+        EmojiRecord("objects", /*"floppy disk",*/ "1f4be", 630, EmojiCode(0x1f4be)),
+        EmojiRecord("objects", /*"optical disk",*/ "1f4bf", 631, EmojiCode(0x1f4bf), EmojiCode(0x1f4bf, 0xfe0f)),
+        EmojiRecord("objects", /*"dvd",*/ "1f4c0", 632, EmojiCode(0x1f4c0)),
+        EmojiRecord("objects", /*"videocassette",*/ "1f4fc", 633, EmojiCode(0x1f4fc)),
+        EmojiRecord("objects", /*"camera",*/ "1f4f7", 634, EmojiCode(0x1f4f7), EmojiCode(0x1f4f7, 0xfe0f)),
+        EmojiRecord("objects", /*"camera with flash",*/ "1f4f8", 635, EmojiCode(0x1f4f8)),
+        EmojiRecord("objects", /*"video camera",*/ "1f4f9", 636, EmojiCode(0x1f4f9), EmojiCode(0x1f4f9, 0xfe0f)),
+        EmojiRecord("objects", /*"movie camera",*/ "1f3a5", 637, EmojiCode(0x1f3a5)),
+        EmojiRecord("objects", /*"film projector",*/ "1f4fd", 638, EmojiCode(0x1f4fd), EmojiCode(0x1f4fd, 0xfe0f)),
+        EmojiRecord("objects", /*"film frames",*/ "1f39e", 639, EmojiCode(0x1f39e), EmojiCode(0x1f39e, 0xfe0f)),
+        EmojiRecord("objects", /*"telephone receiver",*/ "1f4de", 640, EmojiCode(0x1f4de)),
+        EmojiRecord("objects", /*"telephone",*/ "260e", 641, EmojiCode(0x260e), EmojiCode(0x260e, 0xfe0f)),
+        EmojiRecord("objects", /*"pager",*/ "1f4df", 642, EmojiCode(0x1f4df), EmojiCode(0x1f4df, 0xfe0f)),
+        EmojiRecord("objects", /*"fax machine",*/ "1f4e0", 643, EmojiCode(0x1f4e0)),
+        EmojiRecord("objects", /*"television",*/ "1f4fa", 644, EmojiCode(0x1f4fa), EmojiCode(0x1f4fa, 0xfe0f)),
+        EmojiRecord("objects", /*"radio",*/ "1f4fb", 645, EmojiCode(0x1f4fb), EmojiCode(0x1f4fb, 0xfe0f)),
+        EmojiRecord("objects", /*"studio microphone",*/ "1f399", 646, EmojiCode(0x1f399), EmojiCode(0x1f399, 0xfe0f)),
+        EmojiRecord("objects", /*"level slider",*/ "1f39a", 647, EmojiCode(0x1f39a), EmojiCode(0x1f39a, 0xfe0f)),
+        EmojiRecord("objects", /*"control knobs",*/ "1f39b", 648, EmojiCode(0x1f39b), EmojiCode(0x1f39b, 0xfe0f)),
+        EmojiRecord("objects", /*"stopwatch",*/ "23f1", 649, EmojiCode(0x23f1), EmojiCode(0x23f1, 0xfe0f)),
+        EmojiRecord("objects", /*"timer clock",*/ "23f2", 650, EmojiCode(0x23f2), EmojiCode(0x23f2, 0xfe0f)),
+        EmojiRecord("objects", /*"alarm clock",*/ "23f0", 651, EmojiCode(0x23f0)),
+        EmojiRecord("objects", /*"mantelpiece clock",*/ "1f570", 652, EmojiCode(0x1f570), EmojiCode(0x1f570, 0xfe0f)),
+        EmojiRecord("objects", /*"hourglass done",*/ "231b", 653, EmojiCode(0x231b), EmojiCode(0x231b, 0xfe0f)),
+        EmojiRecord("objects", /*"hourglass not done",*/ "23f3", 654, EmojiCode(0x23f3), EmojiCode(0x23f3, 0xfe0f)),
+        EmojiRecord("objects", /*"satellite antenna",*/ "1f4e1", 655, EmojiCode(0x1f4e1)),
+        EmojiRecord("objects", /*"compass",*/ "1f9ed", 656, EmojiCode(0x1f9ed)),
+        EmojiRecord("objects", /*"battery",*/ "1f50b", 657, EmojiCode(0x1f50b)),
+        EmojiRecord("objects", /*"electric plug",*/ "1f50c", 658, EmojiCode(0x1f50c)),
+        EmojiRecord("objects", /*"magnet",*/ "1f9f2", 659, EmojiCode(0x1f9f2)),
+        EmojiRecord("objects", /*"light bulb",*/ "1f4a1", 660, EmojiCode(0x1f4a1)),
+        EmojiRecord("objects", /*"flashlight",*/ "1f526", 661, EmojiCode(0x1f526)),
+        EmojiRecord("objects", /*"candle",*/ "1f56f", 662, EmojiCode(0x1f56f), EmojiCode(0x1f56f, 0xfe0f)),
+        EmojiRecord("objects", /*"fire extinguisher",*/ "1f9ef", 663, EmojiCode(0x1f9ef)),
+        EmojiRecord("objects", /*"wastebasket",*/ "1f5d1", 664, EmojiCode(0x1f5d1), EmojiCode(0x1f5d1, 0xfe0f)),
+        EmojiRecord("objects", /*"oil drum",*/ "1f6e2", 665, EmojiCode(0x1f6e2), EmojiCode(0x1f6e2, 0xfe0f)),
+        EmojiRecord("objects", /*"money with wings",*/ "1f4b8", 666, EmojiCode(0x1f4b8)),
+        EmojiRecord("objects", /*"dollar banknote",*/ "1f4b5", 667, EmojiCode(0x1f4b5)),
+        EmojiRecord("objects", /*"yen banknote",*/ "1f4b4", 668, EmojiCode(0x1f4b4)),
+        EmojiRecord("objects", /*"euro banknote",*/ "1f4b6", 669, EmojiCode(0x1f4b6)),
+        EmojiRecord("objects", /*"pound banknote",*/ "1f4b7", 670, EmojiCode(0x1f4b7)),
+        EmojiRecord("objects", /*"money bag",*/ "1f4b0", 671, EmojiCode(0x1f4b0), EmojiCode(0x1f4b0, 0xfe0f)),
+        EmojiRecord("objects", /*"credit card",*/ "1f4b3", 672, EmojiCode(0x1f4b3), EmojiCode(0x1f4b3, 0xfe0f)),
+        EmojiRecord("objects", /*"gem stone",*/ "1f48e", 673, EmojiCode(0x1f48e)),
+        EmojiRecord("objects", /*"nazar amulet",*/ "1f9ff", 674, EmojiCode(0x1f9ff)),
+        EmojiRecord("objects", /*"bricks",*/ "1f9f1", 675, EmojiCode(0x1f9f1)),
+        EmojiRecord("objects", /*"balance scale",*/ "2696", 676, EmojiCode(0x2696), EmojiCode(0x2696, 0xfe0f)),
+        EmojiRecord("objects", /*"toolbox",*/ "1f9f0", 677, EmojiCode(0x1f9f0)),
+        EmojiRecord("objects", /*"wrench",*/ "1f527", 678, EmojiCode(0x1f527)),
+        EmojiRecord("objects", /*"hammer",*/ "1f528", 679, EmojiCode(0x1f528)),
+        EmojiRecord("objects", /*"hammer and pick",*/ "2692", 680, EmojiCode(0x2692), EmojiCode(0x2692, 0xfe0f)),
+        EmojiRecord("objects", /*"hammer and wrench",*/ "1f6e0", 681, EmojiCode(0x1f6e0), EmojiCode(0x1f6e0, 0xfe0f)),
+        EmojiRecord("objects", /*"pick",*/ "26cf", 682, EmojiCode(0x26cf), EmojiCode(0x26cf, 0xfe0f)),
+        EmojiRecord("objects", /*"nut and bolt",*/ "1f529", 683, EmojiCode(0x1f529)),
+        EmojiRecord("objects", /*"gear",*/ "2699", 684, EmojiCode(0x2699), EmojiCode(0x2699, 0xfe0f)),
+        EmojiRecord("objects", /*"chains",*/ "26d3", 685, EmojiCode(0x26d3), EmojiCode(0x26d3, 0xfe0f)),
+        EmojiRecord("objects", /*"pistol",*/ "1f52b", 686, EmojiCode(0x1f52b)),
+        EmojiRecord("objects", /*"bomb",*/ "1f4a3", 687, EmojiCode(0x1f4a3), EmojiCode(0x1f4a3, 0xfe0f)),
+        EmojiRecord("objects", /*"kitchen knife",*/ "1f52a", 688, EmojiCode(0x1f52a)),
+        EmojiRecord("objects", /*"dagger",*/ "1f5e1", 689, EmojiCode(0x1f5e1), EmojiCode(0x1f5e1, 0xfe0f)),
+        EmojiRecord("objects", /*"crossed swords",*/ "2694", 690, EmojiCode(0x2694), EmojiCode(0x2694, 0xfe0f)),
+        EmojiRecord("objects", /*"shield",*/ "1f6e1", 691, EmojiCode(0x1f6e1), EmojiCode(0x1f6e1, 0xfe0f)),
+        EmojiRecord("objects", /*"cigarette",*/ "1f6ac", 692, EmojiCode(0x1f6ac)),
+        EmojiRecord("objects", /*"coffin",*/ "26b0", 693, EmojiCode(0x26b0), EmojiCode(0x26b0, 0xfe0f)),
+        EmojiRecord("objects", /*"funeral urn",*/ "26b1", 694, EmojiCode(0x26b1), EmojiCode(0x26b1, 0xfe0f)),
+        EmojiRecord("objects", /*"amphora",*/ "1f3fa", 695, EmojiCode(0x1f3fa)),
+        EmojiRecord("objects", /*"crystal ball",*/ "1f52e", 696, EmojiCode(0x1f52e)),
+        EmojiRecord("objects", /*"prayer beads",*/ "1f4ff", 697, EmojiCode(0x1f4ff)),
+        EmojiRecord("objects", /*"barber pole",*/ "1f488", 698, EmojiCode(0x1f488)),
+        EmojiRecord("objects", /*"alembic",*/ "2697", 699, EmojiCode(0x2697), EmojiCode(0x2697, 0xfe0f)),
+        EmojiRecord("objects", /*"test tube",*/ "1f9ea", 700, EmojiCode(0x1f9ea)),
+        EmojiRecord("objects", /*"petri dish",*/ "1f9eb", 701, EmojiCode(0x1f9eb)),
+        EmojiRecord("objects", /*"dna",*/ "1f9ec", 702, EmojiCode(0x1f9ec)),
+        EmojiRecord("objects", /*"abacus",*/ "1f9ee", 703, EmojiCode(0x1f9ee)),
+        EmojiRecord("objects", /*"telescope",*/ "1f52d", 704, EmojiCode(0x1f52d)),
+        EmojiRecord("objects", /*"microscope",*/ "1f52c", 705, EmojiCode(0x1f52c)),
+        EmojiRecord("objects", /*"hole",*/ "1f573", 706, EmojiCode(0x1f573), EmojiCode(0x1f573, 0xfe0f)),
+        EmojiRecord("objects", /*"pill",*/ "1f48a", 707, EmojiCode(0x1f48a)),
+        EmojiRecord("objects", /*"syringe",*/ "1f489", 708, EmojiCode(0x1f489)),
+        EmojiRecord("objects", /*"thermometer",*/ "1f321", 709, EmojiCode(0x1f321), EmojiCode(0x1f321, 0xfe0f)),
+        EmojiRecord("objects", /*"toilet",*/ "1f6bd", 710, EmojiCode(0x1f6bd)),
+        EmojiRecord("objects", /*"potable water",*/ "1f6b0", 711, EmojiCode(0x1f6b0)),
+        EmojiRecord("objects", /*"shower",*/ "1f6bf", 712, EmojiCode(0x1f6bf)),
+        EmojiRecord("objects", /*"bathtub",*/ "1f6c1", 713, EmojiCode(0x1f6c1)),
+        EmojiRecord("objects", /*"person taking bath",*/ "1f6c0", 714, EmojiCode(0x1f6c0)),
+        EmojiRecord("objects", /*"person taking bath: light skin tone",*/ "1f6c0-1f3fb", 715, EmojiCode(0x1f6c0, 0x1f3fb)),
+        EmojiRecord("objects", /*"person taking bath: medium-light skin tone",*/ "1f6c0-1f3fc", 716, EmojiCode(0x1f6c0, 0x1f3fc)),
+        EmojiRecord("objects", /*"person taking bath: medium skin tone",*/ "1f6c0-1f3fd", 717, EmojiCode(0x1f6c0, 0x1f3fd)),
+        EmojiRecord("objects", /*"person taking bath: medium-dark skin tone",*/ "1f6c0-1f3fe", 718, EmojiCode(0x1f6c0, 0x1f3fe)),
+        EmojiRecord("objects", /*"person taking bath: dark skin tone",*/ "1f6c0-1f3ff", 719, EmojiCode(0x1f6c0, 0x1f3ff)),
+        EmojiRecord("objects", /*"broom",*/ "1f9f9", 720, EmojiCode(0x1f9f9)),
+        EmojiRecord("objects", /*"basket",*/ "1f9fa", 721, EmojiCode(0x1f9fa)),
+        EmojiRecord("objects", /*"roll of paper",*/ "1f9fb", 722, EmojiCode(0x1f9fb)),
+        EmojiRecord("objects", /*"soap",*/ "1f9fc", 723, EmojiCode(0x1f9fc)),
+        EmojiRecord("objects", /*"sponge",*/ "1f9fd", 724, EmojiCode(0x1f9fd)),
+        EmojiRecord("objects", /*"squeeze bottle",*/ "1f9f4", 725, EmojiCode(0x1f9f4)),
+        EmojiRecord("objects", /*"thread",*/ "1f9f5", 726, EmojiCode(0x1f9f5)),
+        EmojiRecord("objects", /*"yarn",*/ "1f9f6", 727, EmojiCode(0x1f9f6)),
+        EmojiRecord("objects", /*"bellhop bell",*/ "1f6ce", 728, EmojiCode(0x1f6ce), EmojiCode(0x1f6ce, 0xfe0f)),
+        EmojiRecord("objects", /*"key",*/ "1f511", 729, EmojiCode(0x1f511)),
+        EmojiRecord("objects", /*"old key",*/ "1f5dd", 730, EmojiCode(0x1f5dd), EmojiCode(0x1f5dd, 0xfe0f)),
+        EmojiRecord("objects", /*"door",*/ "1f6aa", 731, EmojiCode(0x1f6aa)),
+        EmojiRecord("objects", /*"couch and lamp",*/ "1f6cb", 732, EmojiCode(0x1f6cb), EmojiCode(0x1f6cb, 0xfe0f)),
+        EmojiRecord("objects", /*"bed",*/ "1f6cf", 733, EmojiCode(0x1f6cf), EmojiCode(0x1f6cf, 0xfe0f)),
+        EmojiRecord("objects", /*"person in bed",*/ "1f6cc", 734, EmojiCode(0x1f6cc)),
+        EmojiRecord("objects", /*"person in bed: light skin tone",*/ "1f6cc-1f3fb", 735, EmojiCode(0x1f6cc, 0x1f3fb)),
+        EmojiRecord("objects", /*"person in bed: medium-light skin tone",*/ "1f6cc-1f3fc", 736, EmojiCode(0x1f6cc, 0x1f3fc)),
+        EmojiRecord("objects", /*"person in bed: medium skin tone",*/ "1f6cc-1f3fd", 737, EmojiCode(0x1f6cc, 0x1f3fd)),
+        EmojiRecord("objects", /*"person in bed: medium-dark skin tone",*/ "1f6cc-1f3fe", 738, EmojiCode(0x1f6cc, 0x1f3fe)),
+        EmojiRecord("objects", /*"person in bed: dark skin tone",*/ "1f6cc-1f3ff", 739, EmojiCode(0x1f6cc, 0x1f3ff)),
+        EmojiRecord("objects", /*"teddy bear",*/ "1f9f8", 740, EmojiCode(0x1f9f8)),
+        EmojiRecord("objects", /*"framed picture",*/ "1f5bc", 741, EmojiCode(0x1f5bc), EmojiCode(0x1f5bc, 0xfe0f)),
+        EmojiRecord("objects", /*"shopping bags",*/ "1f6cd", 742, EmojiCode(0x1f6cd), EmojiCode(0x1f6cd, 0xfe0f)),
+        EmojiRecord("objects", /*"shopping cart",*/ "1f6d2", 743, EmojiCode(0x1f6d2)),
+        EmojiRecord("objects", /*"wrapped gift",*/ "1f381", 744, EmojiCode(0x1f381)),
+        EmojiRecord("objects", /*"balloon",*/ "1f388", 745, EmojiCode(0x1f388)),
+        EmojiRecord("objects", /*"carp streamer",*/ "1f38f", 746, EmojiCode(0x1f38f)),
+        EmojiRecord("objects", /*"ribbon",*/ "1f380", 747, EmojiCode(0x1f380)),
+        EmojiRecord("objects", /*"confetti ball",*/ "1f38a", 748, EmojiCode(0x1f38a)),
+        EmojiRecord("objects", /*"party popper",*/ "1f389", 749, EmojiCode(0x1f389)),
+        EmojiRecord("objects", /*"Japanese dolls",*/ "1f38e", 750, EmojiCode(0x1f38e)),
+        EmojiRecord("objects", /*"red paper lantern",*/ "1f3ee", 751, EmojiCode(0x1f3ee)),
+        EmojiRecord("objects", /*"wind chime",*/ "1f390", 752, EmojiCode(0x1f390)),
+        EmojiRecord("objects", /*"red envelope",*/ "1f9e7", 753, EmojiCode(0x1f9e7)),
+        EmojiRecord("objects", /*"envelope",*/ "2709", 754, EmojiCode(0x2709), EmojiCode(0x2709, 0xfe0f)),
+        EmojiRecord("objects", /*"envelope with arrow",*/ "1f4e9", 755, EmojiCode(0x1f4e9)),
+        EmojiRecord("objects", /*"incoming envelope",*/ "1f4e8", 756, EmojiCode(0x1f4e8)),
+        EmojiRecord("objects", /*"e-mail",*/ "1f4e7", 757, EmojiCode(0x1f4e7)),
+        EmojiRecord("objects", /*"love letter",*/ "1f48c", 758, EmojiCode(0x1f48c)),
+        EmojiRecord("objects", /*"inbox tray",*/ "1f4e5", 759, EmojiCode(0x1f4e5), EmojiCode(0x1f4e5, 0xfe0f)),
+        EmojiRecord("objects", /*"outbox tray",*/ "1f4e4", 760, EmojiCode(0x1f4e4), EmojiCode(0x1f4e4, 0xfe0f)),
+        EmojiRecord("objects", /*"package",*/ "1f4e6", 761, EmojiCode(0x1f4e6), EmojiCode(0x1f4e6, 0xfe0f)),
+        EmojiRecord("objects", /*"label",*/ "1f3f7", 762, EmojiCode(0x1f3f7), EmojiCode(0x1f3f7, 0xfe0f)),
+        EmojiRecord("objects", /*"closed mailbox with lowered flag",*/ "1f4ea", 763, EmojiCode(0x1f4ea), EmojiCode(0x1f4ea, 0xfe0f)),
+        EmojiRecord("objects", /*"closed mailbox with raised flag",*/ "1f4eb", 764, EmojiCode(0x1f4eb), EmojiCode(0x1f4eb, 0xfe0f)),
+        EmojiRecord("objects", /*"open mailbox with raised flag",*/ "1f4ec", 765, EmojiCode(0x1f4ec), EmojiCode(0x1f4ec, 0xfe0f)),
+        EmojiRecord("objects", /*"open mailbox with lowered flag",*/ "1f4ed", 766, EmojiCode(0x1f4ed), EmojiCode(0x1f4ed, 0xfe0f)),
+        EmojiRecord("objects", /*"postbox",*/ "1f4ee", 767, EmojiCode(0x1f4ee)),
+        EmojiRecord("objects", /*"postal horn",*/ "1f4ef", 768, EmojiCode(0x1f4ef)),
+        EmojiRecord("objects", /*"scroll",*/ "1f4dc", 769, EmojiCode(0x1f4dc)),
+        EmojiRecord("objects", /*"page with curl",*/ "1f4c3", 770, EmojiCode(0x1f4c3)),
+        EmojiRecord("objects", /*"page facing up",*/ "1f4c4", 771, EmojiCode(0x1f4c4)),
+        EmojiRecord("objects", /*"receipt",*/ "1f9fe", 772, EmojiCode(0x1f9fe)),
+        EmojiRecord("objects", /*"bookmark tabs",*/ "1f4d1", 773, EmojiCode(0x1f4d1)),
+        EmojiRecord("objects", /*"bar chart",*/ "1f4ca", 774, EmojiCode(0x1f4ca)),
+        EmojiRecord("objects", /*"chart increasing",*/ "1f4c8", 775, EmojiCode(0x1f4c8)),
+        EmojiRecord("objects", /*"chart decreasing",*/ "1f4c9", 776, EmojiCode(0x1f4c9)),
+        EmojiRecord("objects", /*"spiral notepad",*/ "1f5d2", 777, EmojiCode(0x1f5d2), EmojiCode(0x1f5d2, 0xfe0f)),
+        EmojiRecord("objects", /*"spiral calendar",*/ "1f5d3", 778, EmojiCode(0x1f5d3), EmojiCode(0x1f5d3, 0xfe0f)),
+        EmojiRecord("objects", /*"tear-off calendar",*/ "1f4c6", 779, EmojiCode(0x1f4c6)),
+        EmojiRecord("objects", /*"calendar",*/ "1f4c5", 780, EmojiCode(0x1f4c5)),
+        EmojiRecord("objects", /*"card index",*/ "1f4c7", 781, EmojiCode(0x1f4c7)),
+        EmojiRecord("objects", /*"card file box",*/ "1f5c3", 782, EmojiCode(0x1f5c3), EmojiCode(0x1f5c3, 0xfe0f)),
+        EmojiRecord("objects", /*"ballot box with ballot",*/ "1f5f3", 783, EmojiCode(0x1f5f3), EmojiCode(0x1f5f3, 0xfe0f)),
+        EmojiRecord("objects", /*"file cabinet",*/ "1f5c4", 784, EmojiCode(0x1f5c4), EmojiCode(0x1f5c4, 0xfe0f)),
+        EmojiRecord("objects", /*"clipboard",*/ "1f4cb", 785, EmojiCode(0x1f4cb), EmojiCode(0x1f4cb, 0xfe0f)),
+        EmojiRecord("objects", /*"file folder",*/ "1f4c1", 786, EmojiCode(0x1f4c1)),
+        EmojiRecord("objects", /*"open file folder",*/ "1f4c2", 787, EmojiCode(0x1f4c2)),
+        EmojiRecord("objects", /*"card index dividers",*/ "1f5c2", 788, EmojiCode(0x1f5c2), EmojiCode(0x1f5c2, 0xfe0f)),
+        EmojiRecord("objects", /*"rolled-up newspaper",*/ "1f5de", 789, EmojiCode(0x1f5de), EmojiCode(0x1f5de, 0xfe0f)),
+        EmojiRecord("objects", /*"newspaper",*/ "1f4f0", 790, EmojiCode(0x1f4f0)),
+        EmojiRecord("objects", /*"notebook",*/ "1f4d3", 791, EmojiCode(0x1f4d3)),
+        EmojiRecord("objects", /*"notebook with decorative cover",*/ "1f4d4", 792, EmojiCode(0x1f4d4)),
+        EmojiRecord("objects", /*"ledger",*/ "1f4d2", 793, EmojiCode(0x1f4d2)),
+        EmojiRecord("objects", /*"closed book",*/ "1f4d5", 794, EmojiCode(0x1f4d5)),
+        EmojiRecord("objects", /*"green book",*/ "1f4d7", 795, EmojiCode(0x1f4d7)),
+        EmojiRecord("objects", /*"blue book",*/ "1f4d8", 796, EmojiCode(0x1f4d8)),
+        EmojiRecord("objects", /*"orange book",*/ "1f4d9", 797, EmojiCode(0x1f4d9)),
+        EmojiRecord("objects", /*"books",*/ "1f4da", 798, EmojiCode(0x1f4da), EmojiCode(0x1f4da, 0xfe0f)),
+        EmojiRecord("objects", /*"open book",*/ "1f4d6", 799, EmojiCode(0x1f4d6)),
+        EmojiRecord("objects", /*"bookmark",*/ "1f516", 800, EmojiCode(0x1f516)),
+        EmojiRecord("objects", /*"link",*/ "1f517", 801, EmojiCode(0x1f517)),
+        EmojiRecord("objects", /*"paperclip",*/ "1f4ce", 802, EmojiCode(0x1f4ce)),
+        EmojiRecord("objects", /*"linked paperclips",*/ "1f587", 803, EmojiCode(0x1f587), EmojiCode(0x1f587, 0xfe0f)),
+        EmojiRecord("objects", /*"triangular ruler",*/ "1f4d0", 804, EmojiCode(0x1f4d0)),
+        EmojiRecord("objects", /*"straight ruler",*/ "1f4cf", 805, EmojiCode(0x1f4cf)),
+        EmojiRecord("objects", /*"safety pin",*/ "1f9f7", 806, EmojiCode(0x1f9f7)),
+        EmojiRecord("objects", /*"pushpin",*/ "1f4cc", 807, EmojiCode(0x1f4cc)),
+        EmojiRecord("objects", /*"round pushpin",*/ "1f4cd", 808, EmojiCode(0x1f4cd)),
+        EmojiRecord("objects", /*"scissors",*/ "2702", 809, EmojiCode(0x2702), EmojiCode(0x2702, 0xfe0f)),
+        EmojiRecord("objects", /*"pen",*/ "1f58a", 810, EmojiCode(0x1f58a), EmojiCode(0x1f58a, 0xfe0f)),
+        EmojiRecord("objects", /*"fountain pen",*/ "1f58b", 811, EmojiCode(0x1f58b), EmojiCode(0x1f58b, 0xfe0f)),
+        EmojiRecord("objects", /*"black nib",*/ "2712", 812, EmojiCode(0x2712), EmojiCode(0x2712, 0xfe0f)),
+        EmojiRecord("objects", /*"paintbrush",*/ "1f58c", 813, EmojiCode(0x1f58c), EmojiCode(0x1f58c, 0xfe0f)),
+        EmojiRecord("objects", /*"crayon",*/ "1f58d", 814, EmojiCode(0x1f58d), EmojiCode(0x1f58d, 0xfe0f)),
+        EmojiRecord("objects", /*"memo",*/ "1f4dd", 815, EmojiCode(0x1f4dd)),
+        EmojiRecord("objects", /*"pencil",*/ "270f", 816, EmojiCode(0x270f), EmojiCode(0x270f, 0xfe0f)),
+        EmojiRecord("objects", /*"magnifying glass tilted left",*/ "1f50d", 817, EmojiCode(0x1f50d), EmojiCode(0x1f50d, 0xfe0f)),
+        EmojiRecord("objects", /*"magnifying glass tilted right",*/ "1f50e", 818, EmojiCode(0x1f50e)),
+        EmojiRecord("objects", /*"locked with pen",*/ "1f50f", 819, EmojiCode(0x1f50f)),
+        EmojiRecord("objects", /*"locked with key",*/ "1f510", 820, EmojiCode(0x1f510)),
+        EmojiRecord("nature", /*"dog face",*/ "1f436", 821, EmojiCode(0x1f436)),
+        EmojiRecord("nature", /*"cat face",*/ "1f431", 822, EmojiCode(0x1f431)),
+        EmojiRecord("nature", /*"mouse face",*/ "1f42d", 823, EmojiCode(0x1f42d)),
+        EmojiRecord("nature", /*"hamster face",*/ "1f439", 824, EmojiCode(0x1f439)),
+        EmojiRecord("nature", /*"rabbit face",*/ "1f430", 825, EmojiCode(0x1f430)),
+        EmojiRecord("nature", /*"fox face",*/ "1f98a", 826, EmojiCode(0x1f98a)),
+        EmojiRecord("nature", /*"raccoon",*/ "1f99d", 827, EmojiCode(0x1f99d)),
+        EmojiRecord("nature", /*"bear face",*/ "1f43b", 828, EmojiCode(0x1f43b)),
+        EmojiRecord("nature", /*"panda face",*/ "1f43c", 829, EmojiCode(0x1f43c)),
+        EmojiRecord("nature", /*"kangaroo",*/ "1f998", 830, EmojiCode(0x1f998)),
+        EmojiRecord("nature", /*"badger",*/ "1f9a1", 831, EmojiCode(0x1f9a1)),
+        EmojiRecord("nature", /*"koala",*/ "1f428", 832, EmojiCode(0x1f428)),
+        EmojiRecord("nature", /*"tiger face",*/ "1f42f", 833, EmojiCode(0x1f42f)),
+        EmojiRecord("nature", /*"lion face",*/ "1f981", 834, EmojiCode(0x1f981)),
+        EmojiRecord("nature", /*"cow face",*/ "1f42e", 835, EmojiCode(0x1f42e)),
+        EmojiRecord("nature", /*"pig face",*/ "1f437", 836, EmojiCode(0x1f437)),
+        EmojiRecord("nature", /*"pig nose",*/ "1f43d", 837, EmojiCode(0x1f43d)),
+        EmojiRecord("nature", /*"frog face",*/ "1f438", 838, EmojiCode(0x1f438)),
+        EmojiRecord("nature", /*"monkey face",*/ "1f435", 839, EmojiCode(0x1f435)),
+        EmojiRecord("nature", /*"see-no-evil monkey",*/ "1f648", 840, EmojiCode(0x1f648)),
+        EmojiRecord("nature", /*"hear-no-evil monkey",*/ "1f649", 841, EmojiCode(0x1f649)),
+        EmojiRecord("nature", /*"speak-no-evil monkey",*/ "1f64a", 842, EmojiCode(0x1f64a)),
+        EmojiRecord("nature", /*"monkey",*/ "1f412", 843, EmojiCode(0x1f412)),
+        EmojiRecord("nature", /*"chicken",*/ "1f414", 844, EmojiCode(0x1f414)),
+        EmojiRecord("nature", /*"penguin",*/ "1f427", 845, EmojiCode(0x1f427)),
+        EmojiRecord("nature", /*"bird",*/ "1f426", 846, EmojiCode(0x1f426), EmojiCode(0x1f426, 0xfe0f)),
+        EmojiRecord("nature", /*"baby chick",*/ "1f424", 847, EmojiCode(0x1f424)),
+        EmojiRecord("nature", /*"hatching chick",*/ "1f423", 848, EmojiCode(0x1f423)),
+        EmojiRecord("nature", /*"front-facing baby chick",*/ "1f425", 849, EmojiCode(0x1f425)),
+        EmojiRecord("nature", /*"duck",*/ "1f986", 850, EmojiCode(0x1f986)),
+        EmojiRecord("nature", /*"swan",*/ "1f9a2", 851, EmojiCode(0x1f9a2)),
+        EmojiRecord("nature", /*"eagle",*/ "1f985", 852, EmojiCode(0x1f985)),
+        EmojiRecord("nature", /*"owl",*/ "1f989", 853, EmojiCode(0x1f989)),
+        EmojiRecord("nature", /*"parrot",*/ "1f99c", 854, EmojiCode(0x1f99c)),
+        EmojiRecord("nature", /*"peacock",*/ "1f99a", 855, EmojiCode(0x1f99a)),
+        EmojiRecord("nature", /*"bat",*/ "1f987", 856, EmojiCode(0x1f987)),
+        EmojiRecord("nature", /*"wolf face",*/ "1f43a", 857, EmojiCode(0x1f43a)),
+        EmojiRecord("nature", /*"boar",*/ "1f417", 858, EmojiCode(0x1f417)),
+        EmojiRecord("nature", /*"horse face",*/ "1f434", 859, EmojiCode(0x1f434)),
+        EmojiRecord("nature", /*"unicorn face",*/ "1f984", 860, EmojiCode(0x1f984)),
+        EmojiRecord("nature", /*"honeybee",*/ "1f41d", 861, EmojiCode(0x1f41d)),
+        EmojiRecord("nature", /*"bug",*/ "1f41b", 862, EmojiCode(0x1f41b)),
+        EmojiRecord("nature", /*"butterfly",*/ "1f98b", 863, EmojiCode(0x1f98b)),
+        EmojiRecord("nature", /*"snail",*/ "1f40c", 864, EmojiCode(0x1f40c)),
+        EmojiRecord("nature", /*"spiral shell",*/ "1f41a", 865, EmojiCode(0x1f41a)),
+        EmojiRecord("nature", /*"lady beetle",*/ "1f41e", 866, EmojiCode(0x1f41e)),
+        EmojiRecord("nature", /*"ant",*/ "1f41c", 867, EmojiCode(0x1f41c)),
+        EmojiRecord("nature", /*"cricket",*/ "1f997", 868, EmojiCode(0x1f997)),
+        EmojiRecord("nature", /*"spider",*/ "1f577", 869, EmojiCode(0x1f577), EmojiCode(0x1f577, 0xfe0f)),
+        EmojiRecord("nature", /*"spider web",*/ "1f578", 870, EmojiCode(0x1f578), EmojiCode(0x1f578, 0xfe0f)),
+        EmojiRecord("nature", /*"scorpion",*/ "1f982", 871, EmojiCode(0x1f982)),
+        EmojiRecord("nature", /*"mosquito",*/ "1f99f", 872, EmojiCode(0x1f99f)),
+        EmojiRecord("nature", /*"microbe",*/ "1f9a0", 873, EmojiCode(0x1f9a0)),
+        EmojiRecord("nature", /*"turtle",*/ "1f422", 874, EmojiCode(0x1f422)),
+        EmojiRecord("nature", /*"snake",*/ "1f40d", 875, EmojiCode(0x1f40d)),
+        EmojiRecord("nature", /*"lizard",*/ "1f98e", 876, EmojiCode(0x1f98e)),
+        EmojiRecord("nature", /*"T-Rex",*/ "1f996", 877, EmojiCode(0x1f996)),
+        EmojiRecord("nature", /*"sauropod",*/ "1f995", 878, EmojiCode(0x1f995)),
+        EmojiRecord("nature", /*"octopus",*/ "1f419", 879, EmojiCode(0x1f419)),
+        EmojiRecord("nature", /*"squid",*/ "1f991", 880, EmojiCode(0x1f991)),
+        EmojiRecord("nature", /*"shrimp",*/ "1f990", 881, EmojiCode(0x1f990)),
+        EmojiRecord("nature", /*"crab",*/ "1f980", 882, EmojiCode(0x1f980)),
+        EmojiRecord("nature", /*"lobster",*/ "1f99e", 883, EmojiCode(0x1f99e)),
+        EmojiRecord("nature", /*"blowfish",*/ "1f421", 884, EmojiCode(0x1f421)),
+        EmojiRecord("nature", /*"tropical fish",*/ "1f420", 885, EmojiCode(0x1f420)),
+        EmojiRecord("nature", /*"fish",*/ "1f41f", 886, EmojiCode(0x1f41f), EmojiCode(0x1f41f, 0xfe0f)),
+        EmojiRecord("nature", /*"dolphin",*/ "1f42c", 887, EmojiCode(0x1f42c)),
+        EmojiRecord("nature", /*"spouting whale",*/ "1f433", 888, EmojiCode(0x1f433)),
+        EmojiRecord("nature", /*"whale",*/ "1f40b", 889, EmojiCode(0x1f40b)),
+        EmojiRecord("nature", /*"shark",*/ "1f988", 890, EmojiCode(0x1f988)),
+        EmojiRecord("nature", /*"crocodile",*/ "1f40a", 891, EmojiCode(0x1f40a)),
+        EmojiRecord("nature", /*"tiger",*/ "1f405", 892, EmojiCode(0x1f405)),
+        EmojiRecord("nature", /*"leopard",*/ "1f406", 893, EmojiCode(0x1f406)),
+        EmojiRecord("nature", /*"zebra",*/ "1f993", 894, EmojiCode(0x1f993)),
+        EmojiRecord("nature", /*"gorilla",*/ "1f98d", 895, EmojiCode(0x1f98d)),
+        EmojiRecord("nature", /*"elephant",*/ "1f418", 896, EmojiCode(0x1f418)),
+        EmojiRecord("nature", /*"rhinoceros",*/ "1f98f", 897, EmojiCode(0x1f98f)),
+        EmojiRecord("nature", /*"hippopotamus",*/ "1f99b", 898, EmojiCode(0x1f99b)),
+        EmojiRecord("nature", /*"camel",*/ "1f42a", 899, EmojiCode(0x1f42a)),
+        EmojiRecord("nature", /*"two-hump camel",*/ "1f42b", 900, EmojiCode(0x1f42b)),
+        EmojiRecord("nature", /*"giraffe",*/ "1f992", 901, EmojiCode(0x1f992)),
+        EmojiRecord("nature", /*"llama",*/ "1f999", 902, EmojiCode(0x1f999)),
+        EmojiRecord("nature", /*"water buffalo",*/ "1f403", 903, EmojiCode(0x1f403)),
+        EmojiRecord("nature", /*"ox",*/ "1f402", 904, EmojiCode(0x1f402)),
+        EmojiRecord("nature", /*"cow",*/ "1f404", 905, EmojiCode(0x1f404)),
+        EmojiRecord("nature", /*"horse",*/ "1f40e", 906, EmojiCode(0x1f40e)),
+        EmojiRecord("nature", /*"pig",*/ "1f416", 907, EmojiCode(0x1f416)),
+        EmojiRecord("nature", /*"ram",*/ "1f40f", 908, EmojiCode(0x1f40f)),
+        EmojiRecord("nature", /*"ewe",*/ "1f411", 909, EmojiCode(0x1f411)),
+        EmojiRecord("nature", /*"goat",*/ "1f410", 910, EmojiCode(0x1f410)),
+        EmojiRecord("nature", /*"deer",*/ "1f98c", 911, EmojiCode(0x1f98c)),
+        EmojiRecord("nature", /*"dog",*/ "1f415", 912, EmojiCode(0x1f415), EmojiCode(0x1f415, 0xfe0f)),
+        EmojiRecord("nature", /*"poodle",*/ "1f429", 913, EmojiCode(0x1f429)),
+        EmojiRecord("nature", /*"cat",*/ "1f408", 914, EmojiCode(0x1f408), EmojiCode(0x1f408, 0xfe0f)),
+        EmojiRecord("nature", /*"rooster",*/ "1f413", 915, EmojiCode(0x1f413)),
+        EmojiRecord("nature", /*"turkey",*/ "1f983", 916, EmojiCode(0x1f983)),
+        EmojiRecord("nature", /*"dove",*/ "1f54a", 917, EmojiCode(0x1f54a), EmojiCode(0x1f54a, 0xfe0f)),
+        EmojiRecord("nature", /*"rabbit",*/ "1f407", 918, EmojiCode(0x1f407)),
+        EmojiRecord("nature", /*"mouse",*/ "1f401", 919, EmojiCode(0x1f401)),
+        EmojiRecord("nature", /*"rat",*/ "1f400", 920, EmojiCode(0x1f400)),
+        EmojiRecord("nature", /*"chipmunk",*/ "1f43f", 921, EmojiCode(0x1f43f), EmojiCode(0x1f43f, 0xfe0f)),
+        EmojiRecord("nature", /*"hedgehog",*/ "1f994", 922, EmojiCode(0x1f994)),
+        EmojiRecord("nature", /*"paw prints",*/ "1f43e", 923, EmojiCode(0x1f43e)),
+        EmojiRecord("nature", /*"dragon",*/ "1f409", 924, EmojiCode(0x1f409)),
+        EmojiRecord("nature", /*"dragon face",*/ "1f432", 925, EmojiCode(0x1f432)),
+        EmojiRecord("nature", /*"cactus",*/ "1f335", 926, EmojiCode(0x1f335)),
+        EmojiRecord("nature", /*"Christmas tree",*/ "1f384", 927, EmojiCode(0x1f384)),
+        EmojiRecord("nature", /*"evergreen tree",*/ "1f332", 928, EmojiCode(0x1f332)),
+        EmojiRecord("nature", /*"deciduous tree",*/ "1f333", 929, EmojiCode(0x1f333)),
+        EmojiRecord("nature", /*"palm tree",*/ "1f334", 930, EmojiCode(0x1f334)),
+        EmojiRecord("nature", /*"seedling",*/ "1f331", 931, EmojiCode(0x1f331)),
+        EmojiRecord("nature", /*"herb",*/ "1f33f", 932, EmojiCode(0x1f33f)),
+        EmojiRecord("nature", /*"shamrock",*/ "2618", 933, EmojiCode(0x2618), EmojiCode(0x2618, 0xfe0f)),
+        EmojiRecord("nature", /*"four leaf clover",*/ "1f340", 934, EmojiCode(0x1f340)),
+        EmojiRecord("nature", /*"pine decoration",*/ "1f38d", 935, EmojiCode(0x1f38d)),
+        EmojiRecord("nature", /*"tanabata tree",*/ "1f38b", 936, EmojiCode(0x1f38b)),
+        EmojiRecord("nature", /*"leaf fluttering in wind",*/ "1f343", 937, EmojiCode(0x1f343)),
+        EmojiRecord("nature", /*"fallen leaf",*/ "1f342", 938, EmojiCode(0x1f342)),
+        EmojiRecord("nature", /*"maple leaf",*/ "1f341", 939, EmojiCode(0x1f341)),
+        EmojiRecord("nature", /*"mushroom",*/ "1f344", 940, EmojiCode(0x1f344)),
+        EmojiRecord("nature", /*"sheaf of rice",*/ "1f33e", 941, EmojiCode(0x1f33e)),
+        EmojiRecord("nature", /*"bouquet",*/ "1f490", 942, EmojiCode(0x1f490)),
+        EmojiRecord("nature", /*"tulip",*/ "1f337", 943, EmojiCode(0x1f337)),
+        EmojiRecord("nature", /*"rose",*/ "1f339", 944, EmojiCode(0x1f339)),
+        EmojiRecord("nature", /*"wilted flower",*/ "1f940", 945, EmojiCode(0x1f940)),
+        EmojiRecord("nature", /*"hibiscus",*/ "1f33a", 946, EmojiCode(0x1f33a)),
+        EmojiRecord("nature", /*"cherry blossom",*/ "1f338", 947, EmojiCode(0x1f338)),
+        EmojiRecord("nature", /*"blossom",*/ "1f33c", 948, EmojiCode(0x1f33c)),
+        EmojiRecord("nature", /*"sunflower",*/ "1f33b", 949, EmojiCode(0x1f33b)),
+        EmojiRecord("nature", /*"sun with face",*/ "1f31e", 950, EmojiCode(0x1f31e)),
+        EmojiRecord("nature", /*"full moon face",*/ "1f31d", 951, EmojiCode(0x1f31d)),
+        EmojiRecord("nature", /*"first quarter moon face",*/ "1f31b", 952, EmojiCode(0x1f31b)),
+        EmojiRecord("nature", /*"last quarter moon face",*/ "1f31c", 953, EmojiCode(0x1f31c), EmojiCode(0x1f31c, 0xfe0f)),
+        EmojiRecord("nature", /*"new moon face",*/ "1f31a", 954, EmojiCode(0x1f31a)),
+        EmojiRecord("nature", /*"full moon",*/ "1f315", 955, EmojiCode(0x1f315), EmojiCode(0x1f315, 0xfe0f)),
+        EmojiRecord("nature", /*"waning gibbous moon",*/ "1f316", 956, EmojiCode(0x1f316)),
+        EmojiRecord("nature", /*"last quarter moon",*/ "1f317", 957, EmojiCode(0x1f317)),
+        EmojiRecord("nature", /*"waning crescent moon",*/ "1f318", 958, EmojiCode(0x1f318)),
+        EmojiRecord("nature", /*"new moon",*/ "1f311", 959, EmojiCode(0x1f311)),
+        EmojiRecord("nature", /*"waxing crescent moon",*/ "1f312", 960, EmojiCode(0x1f312)),
+        EmojiRecord("nature", /*"first quarter moon",*/ "1f313", 961, EmojiCode(0x1f313)),
+        EmojiRecord("nature", /*"waxing gibbous moon",*/ "1f314", 962, EmojiCode(0x1f314)),
+        EmojiRecord("nature", /*"crescent moon",*/ "1f319", 963, EmojiCode(0x1f319)),
+        EmojiRecord("nature", /*"globe showing Americas",*/ "1f30e", 964, EmojiCode(0x1f30e), EmojiCode(0x1f30e, 0xfe0f)),
+        EmojiRecord("nature", /*"globe showing Europe-Africa",*/ "1f30d", 965, EmojiCode(0x1f30d), EmojiCode(0x1f30d, 0xfe0f)),
+        EmojiRecord("nature", /*"globe showing Asia-Australia",*/ "1f30f", 966, EmojiCode(0x1f30f), EmojiCode(0x1f30f, 0xfe0f)),
+        EmojiRecord("nature", /*"dizzy",*/ "1f4ab", 967, EmojiCode(0x1f4ab)),
+        EmojiRecord("nature", /*"star",*/ "2b50", 968, EmojiCode(0x2b50), EmojiCode(0x2b50, 0xfe0f)),
+        EmojiRecord("nature", /*"glowing star",*/ "1f31f", 969, EmojiCode(0x1f31f)),
+        EmojiRecord("nature", /*"sparkles",*/ "2728", 970, EmojiCode(0x2728)),
+        EmojiRecord("nature", /*"high voltage",*/ "26a1", 971, EmojiCode(0x26a1), EmojiCode(0x26a1, 0xfe0f)),
+        EmojiRecord("nature", /*"comet",*/ "2604", 972, EmojiCode(0x2604), EmojiCode(0x2604, 0xfe0f)),
+        EmojiRecord("nature", /*"collision",*/ "1f4a5", 973, EmojiCode(0x1f4a5)),
+        EmojiRecord("nature", /*"fire",*/ "1f525", 974, EmojiCode(0x1f525)),
+        EmojiRecord("nature", /*"tornado",*/ "1f32a", 975, EmojiCode(0x1f32a), EmojiCode(0x1f32a, 0xfe0f)),
+        EmojiRecord("nature", /*"rainbow",*/ "1f308", 976, EmojiCode(0x1f308)),
+        EmojiRecord("nature", /*"sun",*/ "2600", 977, EmojiCode(0x2600), EmojiCode(0x2600, 0xfe0f)),
+        EmojiRecord("nature", /*"sun behind small cloud",*/ "1f324", 978, EmojiCode(0x1f324), EmojiCode(0x1f324, 0xfe0f)),
+        EmojiRecord("nature", /*"sun behind cloud",*/ "26c5", 979, EmojiCode(0x26c5), EmojiCode(0x26c5, 0xfe0f)),
+        EmojiRecord("nature", /*"sun behind large cloud",*/ "1f325", 980, EmojiCode(0x1f325), EmojiCode(0x1f325, 0xfe0f)),
+        EmojiRecord("nature", /*"cloud",*/ "2601", 981, EmojiCode(0x2601), EmojiCode(0x2601, 0xfe0f)),
+        EmojiRecord("nature", /*"sun behind rain cloud",*/ "1f326", 982, EmojiCode(0x1f326), EmojiCode(0x1f326, 0xfe0f)),
+        EmojiRecord("nature", /*"cloud with rain",*/ "1f327", 983, EmojiCode(0x1f327), EmojiCode(0x1f327, 0xfe0f)),
+        EmojiRecord("nature", /*"cloud with lightning and rain",*/ "26c8", 984, EmojiCode(0x26c8), EmojiCode(0x26c8, 0xfe0f)),
+        EmojiRecord("nature", /*"cloud with lightning",*/ "1f329", 985, EmojiCode(0x1f329), EmojiCode(0x1f329, 0xfe0f)),
+        EmojiRecord("nature", /*"cloud with snow",*/ "1f328", 986, EmojiCode(0x1f328), EmojiCode(0x1f328, 0xfe0f)),
+        EmojiRecord("nature", /*"snowflake",*/ "2744", 987, EmojiCode(0x2744), EmojiCode(0x2744, 0xfe0f)),
+        EmojiRecord("nature", /*"snowman",*/ "2603", 988, EmojiCode(0x2603), EmojiCode(0x2603, 0xfe0f)),
+        EmojiRecord("nature", /*"snowman without snow",*/ "26c4", 989, EmojiCode(0x26c4), EmojiCode(0x26c4, 0xfe0f)),
+        EmojiRecord("nature", /*"wind face",*/ "1f32c", 990, EmojiCode(0x1f32c), EmojiCode(0x1f32c, 0xfe0f)),
+        EmojiRecord("nature", /*"dashing away",*/ "1f4a8", 991, EmojiCode(0x1f4a8)),
+        EmojiRecord("nature", /*"droplet",*/ "1f4a7", 992, EmojiCode(0x1f4a7)),
+        EmojiRecord("nature", /*"sweat droplets",*/ "1f4a6", 993, EmojiCode(0x1f4a6)),
+        EmojiRecord("nature", /*"umbrella with rain drops",*/ "2614", 994, EmojiCode(0x2614), EmojiCode(0x2614, 0xfe0f)),
+        EmojiRecord("nature", /*"umbrella",*/ "2602", 995, EmojiCode(0x2602), EmojiCode(0x2602, 0xfe0f)),
+        EmojiRecord("nature", /*"water wave",*/ "1f30a", 996, EmojiCode(0x1f30a)),
+        EmojiRecord("nature", /*"fog",*/ "1f32b", 997, EmojiCode(0x1f32b), EmojiCode(0x1f32b, 0xfe0f)),
+        EmojiRecord("food", /*"green apple",*/ "1f34f", 998, EmojiCode(0x1f34f)),
+        EmojiRecord("food", /*"red apple",*/ "1f34e", 999, EmojiCode(0x1f34e)),
+        EmojiRecord("food", /*"pear",*/ "1f350", 1000, EmojiCode(0x1f350)),
+        EmojiRecord("food", /*"tangerine",*/ "1f34a", 1001, EmojiCode(0x1f34a)),
+        EmojiRecord("food", /*"lemon",*/ "1f34b", 1002, EmojiCode(0x1f34b)),
+        EmojiRecord("food", /*"banana",*/ "1f34c", 1003, EmojiCode(0x1f34c)),
+        EmojiRecord("food", /*"watermelon",*/ "1f349", 1004, EmojiCode(0x1f349)),
+        EmojiRecord("food", /*"grapes",*/ "1f347", 1005, EmojiCode(0x1f347)),
+        EmojiRecord("food", /*"strawberry",*/ "1f353", 1006, EmojiCode(0x1f353)),
+        EmojiRecord("food", /*"melon",*/ "1f348", 1007, EmojiCode(0x1f348)),
+        EmojiRecord("food", /*"cherries",*/ "1f352", 1008, EmojiCode(0x1f352)),
+        EmojiRecord("food", /*"peach",*/ "1f351", 1009, EmojiCode(0x1f351)),
+        EmojiRecord("food", /*"mango",*/ "1f96d", 1010, EmojiCode(0x1f96d)),
+        EmojiRecord("food", /*"pineapple",*/ "1f34d", 1011, EmojiCode(0x1f34d)),
+        EmojiRecord("food", /*"coconut",*/ "1f965", 1012, EmojiCode(0x1f965)),
+        EmojiRecord("food", /*"kiwi fruit",*/ "1f95d", 1013, EmojiCode(0x1f95d)),
+        EmojiRecord("food", /*"tomato",*/ "1f345", 1014, EmojiCode(0x1f345)),
+        EmojiRecord("food", /*"eggplant",*/ "1f346", 1015, EmojiCode(0x1f346)),
+        EmojiRecord("food", /*"avocado",*/ "1f951", 1016, EmojiCode(0x1f951)),
+        EmojiRecord("food", /*"broccoli",*/ "1f966", 1017, EmojiCode(0x1f966)),
+        EmojiRecord("food", /*"leafy green",*/ "1f96c", 1018, EmojiCode(0x1f96c)),
+        EmojiRecord("food", /*"cucumber",*/ "1f952", 1019, EmojiCode(0x1f952)),
+        EmojiRecord("food", /*"hot pepper",*/ "1f336", 1020, EmojiCode(0x1f336), EmojiCode(0x1f336, 0xfe0f)),
+        EmojiRecord("food", /*"ear of corn",*/ "1f33d", 1021, EmojiCode(0x1f33d)),
+        EmojiRecord("food", /*"carrot",*/ "1f955", 1022, EmojiCode(0x1f955)),
+        EmojiRecord("food", /*"potato",*/ "1f954", 1023, EmojiCode(0x1f954)),
+        EmojiRecord("food", /*"roasted sweet potato",*/ "1f360", 1024, EmojiCode(0x1f360)),
+        EmojiRecord("food", /*"croissant",*/ "1f950", 1025, EmojiCode(0x1f950)),
+        EmojiRecord("food", /*"bread",*/ "1f35e", 1026, EmojiCode(0x1f35e)),
+        EmojiRecord("food", /*"baguette bread",*/ "1f956", 1027, EmojiCode(0x1f956)),
+        EmojiRecord("food", /*"pretzel",*/ "1f968", 1028, EmojiCode(0x1f968)),
+        EmojiRecord("food", /*"bagel",*/ "1f96f", 1029, EmojiCode(0x1f96f)),
+        EmojiRecord("food", /*"cheese wedge",*/ "1f9c0", 1030, EmojiCode(0x1f9c0)),
+        EmojiRecord("food", /*"egg",*/ "1f95a", 1031, EmojiCode(0x1f95a)),
+        EmojiRecord("food", /*"cooking",*/ "1f373", 1032, EmojiCode(0x1f373)),
+        EmojiRecord("food", /*"pancakes",*/ "1f95e", 1033, EmojiCode(0x1f95e)),
+        EmojiRecord("food", /*"bacon",*/ "1f953", 1034, EmojiCode(0x1f953)),
+        EmojiRecord("food", /*"cut of meat",*/ "1f969", 1035, EmojiCode(0x1f969)),
+        EmojiRecord("food", /*"poultry leg",*/ "1f357", 1036, EmojiCode(0x1f357)),
+        EmojiRecord("food", /*"meat on bone",*/ "1f356", 1037, EmojiCode(0x1f356)),
+        EmojiRecord("food", /*"hot dog",*/ "1f32d", 1038, EmojiCode(0x1f32d)),
+        EmojiRecord("food", /*"hamburger",*/ "1f354", 1039, EmojiCode(0x1f354)),
+        EmojiRecord("food", /*"french fries",*/ "1f35f", 1040, EmojiCode(0x1f35f)),
+        EmojiRecord("food", /*"pizza",*/ "1f355", 1041, EmojiCode(0x1f355)),
+        EmojiRecord("food", /*"sandwich",*/ "1f96a", 1042, EmojiCode(0x1f96a)),
+        EmojiRecord("food", /*"stuffed flatbread",*/ "1f959", 1043, EmojiCode(0x1f959)),
+        EmojiRecord("food", /*"taco",*/ "1f32e", 1044, EmojiCode(0x1f32e)),
+        EmojiRecord("food", /*"burrito",*/ "1f32f", 1045, EmojiCode(0x1f32f)),
+        EmojiRecord("food", /*"green salad",*/ "1f957", 1046, EmojiCode(0x1f957)),
+        EmojiRecord("food", /*"shallow pan of food",*/ "1f958", 1047, EmojiCode(0x1f958)),
+        EmojiRecord("food", /*"canned food",*/ "1f96b", 1048, EmojiCode(0x1f96b)),
+        EmojiRecord("food", /*"spaghetti",*/ "1f35d", 1049, EmojiCode(0x1f35d)),
+        EmojiRecord("food", /*"steaming bowl",*/ "1f35c", 1050, EmojiCode(0x1f35c)),
+        EmojiRecord("food", /*"pot of food",*/ "1f372", 1051, EmojiCode(0x1f372)),
+        EmojiRecord("food", /*"curry rice",*/ "1f35b", 1052, EmojiCode(0x1f35b)),
+        EmojiRecord("food", /*"sushi",*/ "1f363", 1053, EmojiCode(0x1f363)),
+        EmojiRecord("food", /*"bento box",*/ "1f371", 1054, EmojiCode(0x1f371)),
+        EmojiRecord("food", /*"fried shrimp",*/ "1f364", 1055, EmojiCode(0x1f364)),
+        EmojiRecord("food", /*"rice ball",*/ "1f359", 1056, EmojiCode(0x1f359)),
+        EmojiRecord("food", /*"cooked rice",*/ "1f35a", 1057, EmojiCode(0x1f35a)),
+        EmojiRecord("food", /*"rice cracker",*/ "1f358", 1058, EmojiCode(0x1f358)),
+        EmojiRecord("food", /*"fish cake with swirl",*/ "1f365", 1059, EmojiCode(0x1f365)),
+        EmojiRecord("food", /*"fortune cookie",*/ "1f960", 1060, EmojiCode(0x1f960)),
+        EmojiRecord("food", /*"oden",*/ "1f362", 1061, EmojiCode(0x1f362)),
+        EmojiRecord("food", /*"dango",*/ "1f361", 1062, EmojiCode(0x1f361)),
+        EmojiRecord("food", /*"shaved ice",*/ "1f367", 1063, EmojiCode(0x1f367)),
+        EmojiRecord("food", /*"ice cream",*/ "1f368", 1064, EmojiCode(0x1f368)),
+        EmojiRecord("food", /*"soft ice cream",*/ "1f366", 1065, EmojiCode(0x1f366)),
+        EmojiRecord("food", /*"pie",*/ "1f967", 1066, EmojiCode(0x1f967)),
+        EmojiRecord("food", /*"shortcake",*/ "1f370", 1067, EmojiCode(0x1f370)),
+        EmojiRecord("food", /*"birthday cake",*/ "1f382", 1068, EmojiCode(0x1f382)),
+        EmojiRecord("food", /*"moon cake",*/ "1f96e", 1069, EmojiCode(0x1f96e)),
+        EmojiRecord("food", /*"cupcake",*/ "1f9c1", 1070, EmojiCode(0x1f9c1)),
+        EmojiRecord("food", /*"custard",*/ "1f36e", 1071, EmojiCode(0x1f36e)),
+        EmojiRecord("food", /*"lollipop",*/ "1f36d", 1072, EmojiCode(0x1f36d)),
+        EmojiRecord("food", /*"candy",*/ "1f36c", 1073, EmojiCode(0x1f36c)),
+        EmojiRecord("food", /*"chocolate bar",*/ "1f36b", 1074, EmojiCode(0x1f36b)),
+        EmojiRecord("food", /*"popcorn",*/ "1f37f", 1075, EmojiCode(0x1f37f)),
+        EmojiRecord("food", /*"salt",*/ "1f9c2", 1076, EmojiCode(0x1f9c2)),
+        EmojiRecord("food", /*"doughnut",*/ "1f369", 1077, EmojiCode(0x1f369)),
+        EmojiRecord("food", /*"dumpling",*/ "1f95f", 1078, EmojiCode(0x1f95f)),
+        EmojiRecord("food", /*"cookie",*/ "1f36a", 1079, EmojiCode(0x1f36a)),
+        EmojiRecord("food", /*"chestnut",*/ "1f330", 1080, EmojiCode(0x1f330)),
+        EmojiRecord("food", /*"peanuts",*/ "1f95c", 1081, EmojiCode(0x1f95c)),
+        EmojiRecord("food", /*"honey pot",*/ "1f36f", 1082, EmojiCode(0x1f36f)),
+        EmojiRecord("food", /*"glass of milk",*/ "1f95b", 1083, EmojiCode(0x1f95b)),
+        EmojiRecord("food", /*"baby bottle",*/ "1f37c", 1084, EmojiCode(0x1f37c)),
+        EmojiRecord("food", /*"hot beverage",*/ "2615", 1085, EmojiCode(0x2615), EmojiCode(0x2615, 0xfe0f)),
+        EmojiRecord("food", /*"teacup without handle",*/ "1f375", 1086, EmojiCode(0x1f375)),
+        EmojiRecord("food", /*"cup with straw",*/ "1f964", 1087, EmojiCode(0x1f964)),
+        EmojiRecord("food", /*"sake",*/ "1f376", 1088, EmojiCode(0x1f376)),
+        EmojiRecord("food", /*"beer mug",*/ "1f37a", 1089, EmojiCode(0x1f37a)),
+        EmojiRecord("food", /*"clinking beer mugs",*/ "1f37b", 1090, EmojiCode(0x1f37b)),
+        EmojiRecord("food", /*"clinking glasses",*/ "1f942", 1091, EmojiCode(0x1f942)),
+        EmojiRecord("food", /*"wine glass",*/ "1f377", 1092, EmojiCode(0x1f377)),
+        EmojiRecord("food", /*"tumbler glass",*/ "1f943", 1093, EmojiCode(0x1f943)),
+        EmojiRecord("food", /*"cocktail glass",*/ "1f378", 1094, EmojiCode(0x1f378), EmojiCode(0x1f378, 0xfe0f)),
+        EmojiRecord("food", /*"tropical drink",*/ "1f379", 1095, EmojiCode(0x1f379)),
+        EmojiRecord("food", /*"bottle with popping cork",*/ "1f37e", 1096, EmojiCode(0x1f37e)),
+        EmojiRecord("food", /*"spoon",*/ "1f944", 1097, EmojiCode(0x1f944)),
+        EmojiRecord("food", /*"fork and knife",*/ "1f374", 1098, EmojiCode(0x1f374)),
+        EmojiRecord("food", /*"fork and knife with plate",*/ "1f37d", 1099, EmojiCode(0x1f37d), EmojiCode(0x1f37d, 0xfe0f)),
+        EmojiRecord("food", /*"bowl with spoon",*/ "1f963", 1100, EmojiCode(0x1f963)),
+        EmojiRecord("food", /*"takeout box",*/ "1f961", 1101, EmojiCode(0x1f961)),
+        EmojiRecord("food", /*"chopsticks",*/ "1f962", 1102, EmojiCode(0x1f962)),
+        EmojiRecord("people", /*"grinning face",*/ "1f600", 1103, EmojiCode(0x1f600)),
+        EmojiRecord("people", /*"grinning face with big eyes",*/ "1f603", 1104, EmojiCode(0x1f603)),
+        EmojiRecord("people", /*"grinning face with smiling eyes",*/ "1f604", 1105, EmojiCode(0x1f604)),
+        EmojiRecord("people", /*"beaming face with smiling eyes",*/ "1f601", 1106, EmojiCode(0x1f601)),
+        EmojiRecord("people", /*"grinning squinting face",*/ "1f606", 1107, EmojiCode(0x1f606)),
+        EmojiRecord("people", /*"grinning face with sweat",*/ "1f605", 1108, EmojiCode(0x1f605)),
+        EmojiRecord("people", /*"face with tears of joy",*/ "1f602", 1109, EmojiCode(0x1f602)),
+        EmojiRecord("people", /*"rolling on the floor laughing",*/ "1f923", 1110, EmojiCode(0x1f923)),
+        EmojiRecord("people", /*"smiling face",*/ "263a", 1111, EmojiCode(0x263a), EmojiCode(0x263a, 0xfe0f)),
+        EmojiRecord("people", /*"smiling face with smiling eyes",*/ "1f60a", 1112, EmojiCode(0x1f60a)),
+        EmojiRecord("people", /*"smiling face with halo",*/ "1f607", 1113, EmojiCode(0x1f607)),
+        EmojiRecord("people", /*"slightly smiling face",*/ "1f642", 1114, EmojiCode(0x1f642)),
+        EmojiRecord("people", /*"upside-down face",*/ "1f643", 1115, EmojiCode(0x1f643)),
+        EmojiRecord("people", /*"winking face",*/ "1f609", 1116, EmojiCode(0x1f609)),
+        EmojiRecord("people", /*"relieved face",*/ "1f60c", 1117, EmojiCode(0x1f60c)),
+        EmojiRecord("people", /*"smiling face with heart-eyes",*/ "1f60d", 1118, EmojiCode(0x1f60d)),
+        EmojiRecord("people", /*"face blowing a kiss",*/ "1f618", 1119, EmojiCode(0x1f618)),
+        EmojiRecord("people", /*"smiling face with 3 hearts",*/ "1f970", 1120, EmojiCode(0x1f970)),
+        EmojiRecord("people", /*"kissing face",*/ "1f617", 1121, EmojiCode(0x1f617)),
+        EmojiRecord("people", /*"kissing face with smiling eyes",*/ "1f619", 1122, EmojiCode(0x1f619)),
+        EmojiRecord("people", /*"kissing face with closed eyes",*/ "1f61a", 1123, EmojiCode(0x1f61a)),
+        EmojiRecord("people", /*"face savoring food",*/ "1f60b", 1124, EmojiCode(0x1f60b)),
+        EmojiRecord("people", /*"face with tongue",*/ "1f61b", 1125, EmojiCode(0x1f61b)),
+        EmojiRecord("people", /*"squinting face with tongue",*/ "1f61d", 1126, EmojiCode(0x1f61d)),
+        EmojiRecord("people", /*"winking face with tongue",*/ "1f61c", 1127, EmojiCode(0x1f61c)),
+        EmojiRecord("people", /*"zany face",*/ "1f92a", 1128, EmojiCode(0x1f92a)),
+        EmojiRecord("people", /*"face with raised eyebrow",*/ "1f928", 1129, EmojiCode(0x1f928)),
+        EmojiRecord("people", /*"face with monocle",*/ "1f9d0", 1130, EmojiCode(0x1f9d0)),
+        EmojiRecord("people", /*"nerd face",*/ "1f913", 1131, EmojiCode(0x1f913)),
+        EmojiRecord("people", /*"smiling face with sunglasses",*/ "1f60e", 1132, EmojiCode(0x1f60e)),
+        EmojiRecord("people", /*"star-struck",*/ "1f929", 1133, EmojiCode(0x1f929)),
+        EmojiRecord("people", /*"partying face",*/ "1f973", 1134, EmojiCode(0x1f973)),
+        EmojiRecord("people", /*"smirking face",*/ "1f60f", 1135, EmojiCode(0x1f60f)),
+        EmojiRecord("people", /*"unamused face",*/ "1f612", 1136, EmojiCode(0x1f612)),
+        EmojiRecord("people", /*"disappointed face",*/ "1f61e", 1137, EmojiCode(0x1f61e)),
+        EmojiRecord("people", /*"pensive face",*/ "1f614", 1138, EmojiCode(0x1f614)),
+        EmojiRecord("people", /*"worried face",*/ "1f61f", 1139, EmojiCode(0x1f61f)),
+        EmojiRecord("people", /*"confused face",*/ "1f615", 1140, EmojiCode(0x1f615)),
+        EmojiRecord("people", /*"slightly frowning face",*/ "1f641", 1141, EmojiCode(0x1f641)),
+        EmojiRecord("people", /*"frowning face",*/ "2639", 1142, EmojiCode(0x2639), EmojiCode(0x2639, 0xfe0f)),
+        EmojiRecord("people", /*"persevering face",*/ "1f623", 1143, EmojiCode(0x1f623)),
+        EmojiRecord("people", /*"confounded face",*/ "1f616", 1144, EmojiCode(0x1f616)),
+        EmojiRecord("people", /*"tired face",*/ "1f62b", 1145, EmojiCode(0x1f62b)),
+        EmojiRecord("people", /*"weary face",*/ "1f629", 1146, EmojiCode(0x1f629)),
+        EmojiRecord("people", /*"crying face",*/ "1f622", 1147, EmojiCode(0x1f622)),
+        EmojiRecord("people", /*"loudly crying face",*/ "1f62d", 1148, EmojiCode(0x1f62d)),
+        EmojiRecord("people", /*"face with steam from nose",*/ "1f624", 1149, EmojiCode(0x1f624)),
+        EmojiRecord("people", /*"angry face",*/ "1f620", 1150, EmojiCode(0x1f620)),
+        EmojiRecord("people", /*"pouting face",*/ "1f621", 1151, EmojiCode(0x1f621)),
+        EmojiRecord("people", /*"face with symbols on mouth",*/ "1f92c", 1152, EmojiCode(0x1f92c)),
+        EmojiRecord("people", /*"exploding head",*/ "1f92f", 1153, EmojiCode(0x1f92f)),
+        EmojiRecord("people", /*"flushed face",*/ "1f633", 1154, EmojiCode(0x1f633)),
+        EmojiRecord("people", /*"face screaming in fear",*/ "1f631", 1155, EmojiCode(0x1f631)),
+        EmojiRecord("people", /*"fearful face",*/ "1f628", 1156, EmojiCode(0x1f628)),
+        EmojiRecord("people", /*"anxious face with sweat",*/ "1f630", 1157, EmojiCode(0x1f630)),
+        EmojiRecord("people", /*"hot face",*/ "1f975", 1158, EmojiCode(0x1f975)),
+        EmojiRecord("people", /*"cold face",*/ "1f976", 1159, EmojiCode(0x1f976)),
+        EmojiRecord("people", /*"pleading face",*/ "1f97a", 1160, EmojiCode(0x1f97a)),
+        EmojiRecord("people", /*"sad but relieved face",*/ "1f625", 1161, EmojiCode(0x1f625)),
+        EmojiRecord("people", /*"downcast face with sweat",*/ "1f613", 1162, EmojiCode(0x1f613)),
+        EmojiRecord("people", /*"hugging face",*/ "1f917", 1163, EmojiCode(0x1f917)),
+        EmojiRecord("people", /*"thinking face",*/ "1f914", 1164, EmojiCode(0x1f914)),
+        EmojiRecord("people", /*"face with hand over mouth",*/ "1f92d", 1165, EmojiCode(0x1f92d)),
+        EmojiRecord("people", /*"shushing face",*/ "1f92b", 1166, EmojiCode(0x1f92b)),
+        EmojiRecord("people", /*"lying face",*/ "1f925", 1167, EmojiCode(0x1f925)),
+        EmojiRecord("people", /*"face without mouth",*/ "1f636", 1168, EmojiCode(0x1f636)),
+        EmojiRecord("people", /*"neutral face",*/ "1f610", 1169, EmojiCode(0x1f610), EmojiCode(0x1f610, 0xfe0f)),
+        EmojiRecord("people", /*"expressionless face",*/ "1f611", 1170, EmojiCode(0x1f611)),
+        EmojiRecord("people", /*"grimacing face",*/ "1f62c", 1171, EmojiCode(0x1f62c)),
+        EmojiRecord("people", /*"face with rolling eyes",*/ "1f644", 1172, EmojiCode(0x1f644)),
+        EmojiRecord("people", /*"hushed face",*/ "1f62f", 1173, EmojiCode(0x1f62f)),
+        EmojiRecord("people", /*"frowning face with open mouth",*/ "1f626", 1174, EmojiCode(0x1f626)),
+        EmojiRecord("people", /*"anguished face",*/ "1f627", 1175, EmojiCode(0x1f627)),
+        EmojiRecord("people", /*"face with open mouth",*/ "1f62e", 1176, EmojiCode(0x1f62e)),
+        EmojiRecord("people", /*"astonished face",*/ "1f632", 1177, EmojiCode(0x1f632)),
+        EmojiRecord("people", /*"sleeping face",*/ "1f634", 1178, EmojiCode(0x1f634)),
+        EmojiRecord("people", /*"drooling face",*/ "1f924", 1179, EmojiCode(0x1f924)),
+        EmojiRecord("people", /*"sleepy face",*/ "1f62a", 1180, EmojiCode(0x1f62a)),
+        EmojiRecord("people", /*"dizzy face",*/ "1f635", 1181, EmojiCode(0x1f635)),
+        EmojiRecord("people", /*"zipper-mouth face",*/ "1f910", 1182, EmojiCode(0x1f910)),
+        EmojiRecord("people", /*"woozy face",*/ "1f974", 1183, EmojiCode(0x1f974)),
+        EmojiRecord("people", /*"nauseated face",*/ "1f922", 1184, EmojiCode(0x1f922)),
+        EmojiRecord("people", /*"face vomiting",*/ "1f92e", 1185, EmojiCode(0x1f92e)),
+        EmojiRecord("people", /*"sneezing face",*/ "1f927", 1186, EmojiCode(0x1f927)),
+        EmojiRecord("people", /*"face with medical mask",*/ "1f637", 1187, EmojiCode(0x1f637)),
+        EmojiRecord("people", /*"face with thermometer",*/ "1f912", 1188, EmojiCode(0x1f912)),
+        EmojiRecord("people", /*"face with head-bandage",*/ "1f915", 1189, EmojiCode(0x1f915)),
+        EmojiRecord("people", /*"money-mouth face",*/ "1f911", 1190, EmojiCode(0x1f911)),
+        EmojiRecord("people", /*"cowboy hat face",*/ "1f920", 1191, EmojiCode(0x1f920)),
+        EmojiRecord("people", /*"smiling face with horns",*/ "1f608", 1192, EmojiCode(0x1f608)),
+        EmojiRecord("people", /*"angry face with horns",*/ "1f47f", 1193, EmojiCode(0x1f47f)),
+        EmojiRecord("people", /*"ogre",*/ "1f479", 1194, EmojiCode(0x1f479)),
+        EmojiRecord("people", /*"goblin",*/ "1f47a", 1195, EmojiCode(0x1f47a)),
+        EmojiRecord("people", /*"clown face",*/ "1f921", 1196, EmojiCode(0x1f921)),
+        EmojiRecord("people", /*"pile of poo",*/ "1f4a9", 1197, EmojiCode(0x1f4a9)),
+        EmojiRecord("people", /*"ghost",*/ "1f47b", 1198, EmojiCode(0x1f47b)),
+        EmojiRecord("people", /*"skull",*/ "1f480", 1199, EmojiCode(0x1f480)),
+        EmojiRecord("people", /*"skull and crossbones",*/ "2620", 1200, EmojiCode(0x2620), EmojiCode(0x2620, 0xfe0f)),
+        EmojiRecord("people", /*"alien",*/ "1f47d", 1201, EmojiCode(0x1f47d), EmojiCode(0x1f47d, 0xfe0f)),
+        EmojiRecord("people", /*"alien monster",*/ "1f47e", 1202, EmojiCode(0x1f47e)),
+        EmojiRecord("people", /*"robot face",*/ "1f916", 1203, EmojiCode(0x1f916)),
+        EmojiRecord("people", /*"jack-o-lantern",*/ "1f383", 1204, EmojiCode(0x1f383)),
+        EmojiRecord("people", /*"grinning cat face",*/ "1f63a", 1205, EmojiCode(0x1f63a)),
+        EmojiRecord("people", /*"grinning cat face with smiling eyes",*/ "1f638", 1206, EmojiCode(0x1f638)),
+        EmojiRecord("people", /*"cat face with tears of joy",*/ "1f639", 1207, EmojiCode(0x1f639)),
+        EmojiRecord("people", /*"smiling cat face with heart-eyes",*/ "1f63b", 1208, EmojiCode(0x1f63b)),
+        EmojiRecord("people", /*"cat face with wry smile",*/ "1f63c", 1209, EmojiCode(0x1f63c)),
+        EmojiRecord("people", /*"kissing cat face",*/ "1f63d", 1210, EmojiCode(0x1f63d)),
+        EmojiRecord("people", /*"weary cat face",*/ "1f640", 1211, EmojiCode(0x1f640)),
+        EmojiRecord("people", /*"crying cat face",*/ "1f63f", 1212, EmojiCode(0x1f63f)),
+        EmojiRecord("people", /*"pouting cat face",*/ "1f63e", 1213, EmojiCode(0x1f63e)),
+        EmojiRecord("people", /*"palms up together",*/ "1f932", 1214, EmojiCode(0x1f932)),
+        EmojiRecord("people", /*"palms up together: light skin tone",*/ "1f932-1f3fb", 1215, EmojiCode(0x1f932, 0x1f3fb)),
+        EmojiRecord("people", /*"palms up together: medium-light skin tone",*/ "1f932-1f3fc", 1216, EmojiCode(0x1f932, 0x1f3fc)),
+        EmojiRecord("people", /*"palms up together: medium skin tone",*/ "1f932-1f3fd", 1217, EmojiCode(0x1f932, 0x1f3fd)),
+        EmojiRecord("people", /*"palms up together: medium-dark skin tone",*/ "1f932-1f3fe", 1218, EmojiCode(0x1f932, 0x1f3fe)),
+        EmojiRecord("people", /*"palms up together: dark skin tone",*/ "1f932-1f3ff", 1219, EmojiCode(0x1f932, 0x1f3ff)),
+        EmojiRecord("people", /*"open hands",*/ "1f450", 1220, EmojiCode(0x1f450)),
+        EmojiRecord("people", /*"open hands: light skin tone",*/ "1f450-1f3fb", 1221, EmojiCode(0x1f450, 0x1f3fb)),
+        EmojiRecord("people", /*"open hands: medium-light skin tone",*/ "1f450-1f3fc", 1222, EmojiCode(0x1f450, 0x1f3fc)),
+        EmojiRecord("people", /*"open hands: medium skin tone",*/ "1f450-1f3fd", 1223, EmojiCode(0x1f450, 0x1f3fd)),
+        EmojiRecord("people", /*"open hands: medium-dark skin tone",*/ "1f450-1f3fe", 1224, EmojiCode(0x1f450, 0x1f3fe)),
+        EmojiRecord("people", /*"open hands: dark skin tone",*/ "1f450-1f3ff", 1225, EmojiCode(0x1f450, 0x1f3ff)),
+        EmojiRecord("people", /*"raising hands",*/ "1f64c", 1226, EmojiCode(0x1f64c)),
+        EmojiRecord("people", /*"raising hands: light skin tone",*/ "1f64c-1f3fb", 1227, EmojiCode(0x1f64c, 0x1f3fb)),
+        EmojiRecord("people", /*"raising hands: medium-light skin tone",*/ "1f64c-1f3fc", 1228, EmojiCode(0x1f64c, 0x1f3fc)),
+        EmojiRecord("people", /*"raising hands: medium skin tone",*/ "1f64c-1f3fd", 1229, EmojiCode(0x1f64c, 0x1f3fd)),
+        EmojiRecord("people", /*"raising hands: medium-dark skin tone",*/ "1f64c-1f3fe", 1230, EmojiCode(0x1f64c, 0x1f3fe)),
+        EmojiRecord("people", /*"raising hands: dark skin tone",*/ "1f64c-1f3ff", 1231, EmojiCode(0x1f64c, 0x1f3ff)),
+        EmojiRecord("people", /*"clapping hands",*/ "1f44f", 1232, EmojiCode(0x1f44f)),
+        EmojiRecord("people", /*"clapping hands: light skin tone",*/ "1f44f-1f3fb", 1233, EmojiCode(0x1f44f, 0x1f3fb)),
+        EmojiRecord("people", /*"clapping hands: medium-light skin tone",*/ "1f44f-1f3fc", 1234, EmojiCode(0x1f44f, 0x1f3fc)),
+        EmojiRecord("people", /*"clapping hands: medium skin tone",*/ "1f44f-1f3fd", 1235, EmojiCode(0x1f44f, 0x1f3fd)),
+        EmojiRecord("people", /*"clapping hands: medium-dark skin tone",*/ "1f44f-1f3fe", 1236, EmojiCode(0x1f44f, 0x1f3fe)),
+        EmojiRecord("people", /*"clapping hands: dark skin tone",*/ "1f44f-1f3ff", 1237, EmojiCode(0x1f44f, 0x1f3ff)),
+        EmojiRecord("people", /*"handshake",*/ "1f91d", 1238, EmojiCode(0x1f91d)),
+        EmojiRecord("people", /*"thumbs up",*/ "1f44d", 1239, EmojiCode(0x1f44d), EmojiCode(0x1f44d, 0xfe0f)),
+        EmojiRecord("people", /*"thumbs up: light skin tone",*/ "1f44d-1f3fb", 1240, EmojiCode(0x1f44d, 0x1f3fb)),
+        EmojiRecord("people", /*"thumbs up: medium-light skin tone",*/ "1f44d-1f3fc", 1241, EmojiCode(0x1f44d, 0x1f3fc)),
+        EmojiRecord("people", /*"thumbs up: medium skin tone",*/ "1f44d-1f3fd", 1242, EmojiCode(0x1f44d, 0x1f3fd)),
+        EmojiRecord("people", /*"thumbs up: medium-dark skin tone",*/ "1f44d-1f3fe", 1243, EmojiCode(0x1f44d, 0x1f3fe)),
+        EmojiRecord("people", /*"thumbs up: dark skin tone",*/ "1f44d-1f3ff", 1244, EmojiCode(0x1f44d, 0x1f3ff)),
+        EmojiRecord("people", /*"thumbs down",*/ "1f44e", 1245, EmojiCode(0x1f44e), EmojiCode(0x1f44e, 0xfe0f)),
+        EmojiRecord("people", /*"thumbs down: light skin tone",*/ "1f44e-1f3fb", 1246, EmojiCode(0x1f44e, 0x1f3fb)),
+        EmojiRecord("people", /*"thumbs down: medium-light skin tone",*/ "1f44e-1f3fc", 1247, EmojiCode(0x1f44e, 0x1f3fc)),
+        EmojiRecord("people", /*"thumbs down: medium skin tone",*/ "1f44e-1f3fd", 1248, EmojiCode(0x1f44e, 0x1f3fd)),
+        EmojiRecord("people", /*"thumbs down: medium-dark skin tone",*/ "1f44e-1f3fe", 1249, EmojiCode(0x1f44e, 0x1f3fe)),
+        EmojiRecord("people", /*"thumbs down: dark skin tone",*/ "1f44e-1f3ff", 1250, EmojiCode(0x1f44e, 0x1f3ff)),
+        EmojiRecord("people", /*"oncoming fist",*/ "1f44a", 1251, EmojiCode(0x1f44a)),
+        EmojiRecord("people", /*"oncoming fist: light skin tone",*/ "1f44a-1f3fb", 1252, EmojiCode(0x1f44a, 0x1f3fb)),
+        EmojiRecord("people", /*"oncoming fist: medium-light skin tone",*/ "1f44a-1f3fc", 1253, EmojiCode(0x1f44a, 0x1f3fc)),
+        EmojiRecord("people", /*"oncoming fist: medium skin tone",*/ "1f44a-1f3fd", 1254, EmojiCode(0x1f44a, 0x1f3fd)),
+        EmojiRecord("people", /*"oncoming fist: medium-dark skin tone",*/ "1f44a-1f3fe", 1255, EmojiCode(0x1f44a, 0x1f3fe)),
+        EmojiRecord("people", /*"oncoming fist: dark skin tone",*/ "1f44a-1f3ff", 1256, EmojiCode(0x1f44a, 0x1f3ff)),
+        EmojiRecord("people", /*"raised fist",*/ "270a", 1257, EmojiCode(0x270a)),
+        EmojiRecord("people", /*"raised fist: light skin tone",*/ "270a-1f3fb", 1258, EmojiCode(0x270a, 0x1f3fb)),
+        EmojiRecord("people", /*"raised fist: medium-light skin tone",*/ "270a-1f3fc", 1259, EmojiCode(0x270a, 0x1f3fc)),
+        EmojiRecord("people", /*"raised fist: medium skin tone",*/ "270a-1f3fd", 1260, EmojiCode(0x270a, 0x1f3fd)),
+        EmojiRecord("people", /*"raised fist: medium-dark skin tone",*/ "270a-1f3fe", 1261, EmojiCode(0x270a, 0x1f3fe)),
+        EmojiRecord("people", /*"raised fist: dark skin tone",*/ "270a-1f3ff", 1262, EmojiCode(0x270a, 0x1f3ff)),
+        EmojiRecord("people", /*"left-facing fist",*/ "1f91b", 1263, EmojiCode(0x1f91b)),
+        EmojiRecord("people", /*"left-facing fist: light skin tone",*/ "1f91b-1f3fb", 1264, EmojiCode(0x1f91b, 0x1f3fb)),
+        EmojiRecord("people", /*"left-facing fist: medium-light skin tone",*/ "1f91b-1f3fc", 1265, EmojiCode(0x1f91b, 0x1f3fc)),
+        EmojiRecord("people", /*"left-facing fist: medium skin tone",*/ "1f91b-1f3fd", 1266, EmojiCode(0x1f91b, 0x1f3fd)),
+        EmojiRecord("people", /*"left-facing fist: medium-dark skin tone",*/ "1f91b-1f3fe", 1267, EmojiCode(0x1f91b, 0x1f3fe)),
+        EmojiRecord("people", /*"left-facing fist: dark skin tone",*/ "1f91b-1f3ff", 1268, EmojiCode(0x1f91b, 0x1f3ff)),
+        EmojiRecord("people", /*"right-facing fist",*/ "1f91c", 1269, EmojiCode(0x1f91c)),
+        EmojiRecord("people", /*"right-facing fist: light skin tone",*/ "1f91c-1f3fb", 1270, EmojiCode(0x1f91c, 0x1f3fb)),
+        EmojiRecord("people", /*"right-facing fist: medium-light skin tone",*/ "1f91c-1f3fc", 1271, EmojiCode(0x1f91c, 0x1f3fc)),
+        EmojiRecord("people", /*"right-facing fist: medium skin tone",*/ "1f91c-1f3fd", 1272, EmojiCode(0x1f91c, 0x1f3fd)),
+        EmojiRecord("people", /*"right-facing fist: medium-dark skin tone",*/ "1f91c-1f3fe", 1273, EmojiCode(0x1f91c, 0x1f3fe)),
+        EmojiRecord("people", /*"right-facing fist: dark skin tone",*/ "1f91c-1f3ff", 1274, EmojiCode(0x1f91c, 0x1f3ff)),
+        EmojiRecord("people", /*"crossed fingers",*/ "1f91e", 1275, EmojiCode(0x1f91e)),
+        EmojiRecord("people", /*"crossed fingers: light skin tone",*/ "1f91e-1f3fb", 1276, EmojiCode(0x1f91e, 0x1f3fb)),
+        EmojiRecord("people", /*"crossed fingers: medium-light skin tone",*/ "1f91e-1f3fc", 1277, EmojiCode(0x1f91e, 0x1f3fc)),
+        EmojiRecord("people", /*"crossed fingers: medium skin tone",*/ "1f91e-1f3fd", 1278, EmojiCode(0x1f91e, 0x1f3fd)),
+        EmojiRecord("people", /*"crossed fingers: medium-dark skin tone",*/ "1f91e-1f3fe", 1279, EmojiCode(0x1f91e, 0x1f3fe)),
+        EmojiRecord("people", /*"crossed fingers: dark skin tone",*/ "1f91e-1f3ff", 1280, EmojiCode(0x1f91e, 0x1f3ff)),
+        EmojiRecord("people", /*"victory hand",*/ "270c", 1281, EmojiCode(0x270c), EmojiCode(0x270c, 0xfe0f)),
+        EmojiRecord("people", /*"victory hand: light skin tone",*/ "270c-1f3fb", 1282, EmojiCode(0x270c, 0x1f3fb), EmojiCode(0x270c, 0xfe0f, 0x1f3fb)),
+        EmojiRecord("people", /*"victory hand: medium-light skin tone",*/ "270c-1f3fc", 1283, EmojiCode(0x270c, 0x1f3fc), EmojiCode(0x270c, 0xfe0f, 0x1f3fc)),
+        EmojiRecord("people", /*"victory hand: medium skin tone",*/ "270c-1f3fd", 1284, EmojiCode(0x270c, 0x1f3fd), EmojiCode(0x270c, 0xfe0f, 0x1f3fd)),
+        EmojiRecord("people", /*"victory hand: medium-dark skin tone",*/ "270c-1f3fe", 1285, EmojiCode(0x270c, 0x1f3fe), EmojiCode(0x270c, 0xfe0f, 0x1f3fe)),
+        EmojiRecord("people", /*"victory hand: dark skin tone",*/ "270c-1f3ff", 1286, EmojiCode(0x270c, 0x1f3ff), EmojiCode(0x270c, 0xfe0f, 0x1f3ff)),
+        EmojiRecord("people", /*"love-you gesture",*/ "1f91f", 1287, EmojiCode(0x1f91f)),
+        EmojiRecord("people", /*"love-you gesture: light skin tone",*/ "1f91f-1f3fb", 1288, EmojiCode(0x1f91f, 0x1f3fb)),
+        EmojiRecord("people", /*"love-you gesture: medium-light skin tone",*/ "1f91f-1f3fc", 1289, EmojiCode(0x1f91f, 0x1f3fc)),
+        EmojiRecord("people", /*"love-you gesture: medium skin tone",*/ "1f91f-1f3fd", 1290, EmojiCode(0x1f91f, 0x1f3fd)),
+        EmojiRecord("people", /*"love-you gesture: medium-dark skin tone",*/ "1f91f-1f3fe", 1291, EmojiCode(0x1f91f, 0x1f3fe)),
+        EmojiRecord("people", /*"love-you gesture: dark skin tone",*/ "1f91f-1f3ff", 1292, EmojiCode(0x1f91f, 0x1f3ff)),
+        EmojiRecord("people", /*"sign of the horns",*/ "1f918", 1293, EmojiCode(0x1f918)),
+        EmojiRecord("people", /*"sign of the horns: light skin tone",*/ "1f918-1f3fb", 1294, EmojiCode(0x1f918, 0x1f3fb)),
+        EmojiRecord("people", /*"sign of the horns: medium-light skin tone",*/ "1f918-1f3fc", 1295, EmojiCode(0x1f918, 0x1f3fc)),
+        EmojiRecord("people", /*"sign of the horns: medium skin tone",*/ "1f918-1f3fd", 1296, EmojiCode(0x1f918, 0x1f3fd)),
+        EmojiRecord("people", /*"sign of the horns: medium-dark skin tone",*/ "1f918-1f3fe", 1297, EmojiCode(0x1f918, 0x1f3fe)),
+        EmojiRecord("people", /*"sign of the horns: dark skin tone",*/ "1f918-1f3ff", 1298, EmojiCode(0x1f918, 0x1f3ff)),
+        EmojiRecord("people", /*"OK hand",*/ "1f44c", 1299, EmojiCode(0x1f44c)),
+        EmojiRecord("people", /*"OK hand: light skin tone",*/ "1f44c-1f3fb", 1300, EmojiCode(0x1f44c, 0x1f3fb)),
+        EmojiRecord("people", /*"OK hand: medium-light skin tone",*/ "1f44c-1f3fc", 1301, EmojiCode(0x1f44c, 0x1f3fc)),
+        EmojiRecord("people", /*"OK hand: medium skin tone",*/ "1f44c-1f3fd", 1302, EmojiCode(0x1f44c, 0x1f3fd)),
+        EmojiRecord("people", /*"OK hand: medium-dark skin tone",*/ "1f44c-1f3fe", 1303, EmojiCode(0x1f44c, 0x1f3fe)),
+        EmojiRecord("people", /*"OK hand: dark skin tone",*/ "1f44c-1f3ff", 1304, EmojiCode(0x1f44c, 0x1f3ff)),
+        EmojiRecord("people", /*"backhand index pointing left",*/ "1f448", 1305, EmojiCode(0x1f448), EmojiCode(0x1f448, 0xfe0f)),
+        EmojiRecord("people", /*"backhand index pointing left: light skin tone",*/ "1f448-1f3fb", 1306, EmojiCode(0x1f448, 0x1f3fb)),
+        EmojiRecord("people", /*"backhand index pointing left: medium-light skin tone",*/ "1f448-1f3fc", 1307, EmojiCode(0x1f448, 0x1f3fc)),
+        EmojiRecord("people", /*"backhand index pointing left: medium skin tone",*/ "1f448-1f3fd", 1308, EmojiCode(0x1f448, 0x1f3fd)),
+        EmojiRecord("people", /*"backhand index pointing left: medium-dark skin tone",*/ "1f448-1f3fe", 1309, EmojiCode(0x1f448, 0x1f3fe)),
+        EmojiRecord("people", /*"backhand index pointing left: dark skin tone",*/ "1f448-1f3ff", 1310, EmojiCode(0x1f448, 0x1f3ff)),
+        EmojiRecord("people", /*"backhand index pointing right",*/ "1f449", 1311, EmojiCode(0x1f449), EmojiCode(0x1f449, 0xfe0f)),
+        EmojiRecord("people", /*"backhand index pointing right: light skin tone",*/ "1f449-1f3fb", 1312, EmojiCode(0x1f449, 0x1f3fb)),
+        EmojiRecord("people", /*"backhand index pointing right: medium-light skin tone",*/ "1f449-1f3fc", 1313, EmojiCode(0x1f449, 0x1f3fc)),
+        EmojiRecord("people", /*"backhand index pointing right: medium skin tone",*/ "1f449-1f3fd", 1314, EmojiCode(0x1f449, 0x1f3fd)),
+        EmojiRecord("people", /*"backhand index pointing right: medium-dark skin tone",*/ "1f449-1f3fe", 1315, EmojiCode(0x1f449, 0x1f3fe)),
+        EmojiRecord("people", /*"backhand index pointing right: dark skin tone",*/ "1f449-1f3ff", 1316, EmojiCode(0x1f449, 0x1f3ff)),
+        EmojiRecord("people", /*"backhand index pointing up",*/ "1f446", 1317, EmojiCode(0x1f446), EmojiCode(0x1f446, 0xfe0f)),
+        EmojiRecord("people", /*"backhand index pointing up: light skin tone",*/ "1f446-1f3fb", 1318, EmojiCode(0x1f446, 0x1f3fb)),
+        EmojiRecord("people", /*"backhand index pointing up: medium-light skin tone",*/ "1f446-1f3fc", 1319, EmojiCode(0x1f446, 0x1f3fc)),
+        EmojiRecord("people", /*"backhand index pointing up: medium skin tone",*/ "1f446-1f3fd", 1320, EmojiCode(0x1f446, 0x1f3fd)),
+        EmojiRecord("people", /*"backhand index pointing up: medium-dark skin tone",*/ "1f446-1f3fe", 1321, EmojiCode(0x1f446, 0x1f3fe)),
+        EmojiRecord("people", /*"backhand index pointing up: dark skin tone",*/ "1f446-1f3ff", 1322, EmojiCode(0x1f446, 0x1f3ff)),
+        EmojiRecord("people", /*"backhand index pointing down",*/ "1f447", 1323, EmojiCode(0x1f447), EmojiCode(0x1f447, 0xfe0f)),
+        EmojiRecord("people", /*"backhand index pointing down: light skin tone",*/ "1f447-1f3fb", 1324, EmojiCode(0x1f447, 0x1f3fb)),
+        EmojiRecord("people", /*"backhand index pointing down: medium-light skin tone",*/ "1f447-1f3fc", 1325, EmojiCode(0x1f447, 0x1f3fc)),
+        EmojiRecord("people", /*"backhand index pointing down: medium skin tone",*/ "1f447-1f3fd", 1326, EmojiCode(0x1f447, 0x1f3fd)),
+        EmojiRecord("people", /*"backhand index pointing down: medium-dark skin tone",*/ "1f447-1f3fe", 1327, EmojiCode(0x1f447, 0x1f3fe)),
+        EmojiRecord("people", /*"backhand index pointing down: dark skin tone",*/ "1f447-1f3ff", 1328, EmojiCode(0x1f447, 0x1f3ff)),
+        EmojiRecord("people", /*"index pointing up",*/ "261d", 1329, EmojiCode(0x261d), EmojiCode(0x261d, 0xfe0f)),
+        EmojiRecord("people", /*"index pointing up: light skin tone",*/ "261d-1f3fb", 1330, EmojiCode(0x261d, 0x1f3fb), EmojiCode(0x261d, 0xfe0f, 0x1f3fb)),
+        EmojiRecord("people", /*"index pointing up: medium-light skin tone",*/ "261d-1f3fc", 1331, EmojiCode(0x261d, 0x1f3fc), EmojiCode(0x261d, 0xfe0f, 0x1f3fc)),
+        EmojiRecord("people", /*"index pointing up: medium skin tone",*/ "261d-1f3fd", 1332, EmojiCode(0x261d, 0x1f3fd), EmojiCode(0x261d, 0xfe0f, 0x1f3fd)),
+        EmojiRecord("people", /*"index pointing up: medium-dark skin tone",*/ "261d-1f3fe", 1333, EmojiCode(0x261d, 0x1f3fe), EmojiCode(0x261d, 0xfe0f, 0x1f3fe)),
+        EmojiRecord("people", /*"index pointing up: dark skin tone",*/ "261d-1f3ff", 1334, EmojiCode(0x261d, 0x1f3ff), EmojiCode(0x261d, 0xfe0f, 0x1f3ff)),
+        EmojiRecord("people", /*"raised hand",*/ "270b", 1335, EmojiCode(0x270b)),
+        EmojiRecord("people", /*"raised hand: light skin tone",*/ "270b-1f3fb", 1336, EmojiCode(0x270b, 0x1f3fb)),
+        EmojiRecord("people", /*"raised hand: medium-light skin tone",*/ "270b-1f3fc", 1337, EmojiCode(0x270b, 0x1f3fc)),
+        EmojiRecord("people", /*"raised hand: medium skin tone",*/ "270b-1f3fd", 1338, EmojiCode(0x270b, 0x1f3fd)),
+        EmojiRecord("people", /*"raised hand: medium-dark skin tone",*/ "270b-1f3fe", 1339, EmojiCode(0x270b, 0x1f3fe)),
+        EmojiRecord("people", /*"raised hand: dark skin tone",*/ "270b-1f3ff", 1340, EmojiCode(0x270b, 0x1f3ff)),
+        EmojiRecord("people", /*"raised back of hand",*/ "1f91a", 1341, EmojiCode(0x1f91a)),
+        EmojiRecord("people", /*"raised back of hand: light skin tone",*/ "1f91a-1f3fb", 1342, EmojiCode(0x1f91a, 0x1f3fb)),
+        EmojiRecord("people", /*"raised back of hand: medium-light skin tone",*/ "1f91a-1f3fc", 1343, EmojiCode(0x1f91a, 0x1f3fc)),
+        EmojiRecord("people", /*"raised back of hand: medium skin tone",*/ "1f91a-1f3fd", 1344, EmojiCode(0x1f91a, 0x1f3fd)),
+        EmojiRecord("people", /*"raised back of hand: medium-dark skin tone",*/ "1f91a-1f3fe", 1345, EmojiCode(0x1f91a, 0x1f3fe)),
+        EmojiRecord("people", /*"raised back of hand: dark skin tone",*/ "1f91a-1f3ff", 1346, EmojiCode(0x1f91a, 0x1f3ff)),
+        EmojiRecord("people", /*"hand with fingers splayed",*/ "1f590", 1347, EmojiCode(0x1f590), EmojiCode(0x1f590, 0xfe0f)),
+        EmojiRecord("people", /*"hand with fingers splayed: light skin tone",*/ "1f590-1f3fb", 1348, EmojiCode(0x1f590, 0x1f3fb), EmojiCode(0x1f590, 0xfe0f, 0x1f3fb)),
+        EmojiRecord("people", /*"hand with fingers splayed: medium-light skin tone",*/ "1f590-1f3fc", 1349, EmojiCode(0x1f590, 0x1f3fc), EmojiCode(0x1f590, 0xfe0f, 0x1f3fc)),
+        EmojiRecord("people", /*"hand with fingers splayed: medium skin tone",*/ "1f590-1f3fd", 1350, EmojiCode(0x1f590, 0x1f3fd), EmojiCode(0x1f590, 0xfe0f, 0x1f3fd)),
+        EmojiRecord("people", /*"hand with fingers splayed: medium-dark skin tone",*/ "1f590-1f3fe", 1351, EmojiCode(0x1f590, 0x1f3fe), EmojiCode(0x1f590, 0xfe0f, 0x1f3fe)),
+        EmojiRecord("people", /*"hand with fingers splayed: dark skin tone",*/ "1f590-1f3ff", 1352, EmojiCode(0x1f590, 0x1f3ff), EmojiCode(0x1f590, 0xfe0f, 0x1f3ff)),
+        EmojiRecord("people", /*"vulcan salute",*/ "1f596", 1353, EmojiCode(0x1f596)),
+        EmojiRecord("people", /*"vulcan salute: light skin tone",*/ "1f596-1f3fb", 1354, EmojiCode(0x1f596, 0x1f3fb)),
+        EmojiRecord("people", /*"vulcan salute: medium-light skin tone",*/ "1f596-1f3fc", 1355, EmojiCode(0x1f596, 0x1f3fc)),
+        EmojiRecord("people", /*"vulcan salute: medium skin tone",*/ "1f596-1f3fd", 1356, EmojiCode(0x1f596, 0x1f3fd)),
+        EmojiRecord("people", /*"vulcan salute: medium-dark skin tone",*/ "1f596-1f3fe", 1357, EmojiCode(0x1f596, 0x1f3fe)),
+        EmojiRecord("people", /*"vulcan salute: dark skin tone",*/ "1f596-1f3ff", 1358, EmojiCode(0x1f596, 0x1f3ff)),
+        EmojiRecord("people", /*"waving hand",*/ "1f44b", 1359, EmojiCode(0x1f44b)),
+        EmojiRecord("people", /*"waving hand: light skin tone",*/ "1f44b-1f3fb", 1360, EmojiCode(0x1f44b, 0x1f3fb)),
+        EmojiRecord("people", /*"waving hand: medium-light skin tone",*/ "1f44b-1f3fc", 1361, EmojiCode(0x1f44b, 0x1f3fc)),
+        EmojiRecord("people", /*"waving hand: medium skin tone",*/ "1f44b-1f3fd", 1362, EmojiCode(0x1f44b, 0x1f3fd)),
+        EmojiRecord("people", /*"waving hand: medium-dark skin tone",*/ "1f44b-1f3fe", 1363, EmojiCode(0x1f44b, 0x1f3fe)),
+        EmojiRecord("people", /*"waving hand: dark skin tone",*/ "1f44b-1f3ff", 1364, EmojiCode(0x1f44b, 0x1f3ff)),
+        EmojiRecord("people", /*"call me hand",*/ "1f919", 1365, EmojiCode(0x1f919)),
+        EmojiRecord("people", /*"call me hand: light skin tone",*/ "1f919-1f3fb", 1366, EmojiCode(0x1f919, 0x1f3fb)),
+        EmojiRecord("people", /*"call me hand: medium-light skin tone",*/ "1f919-1f3fc", 1367, EmojiCode(0x1f919, 0x1f3fc)),
+        EmojiRecord("people", /*"call me hand: medium skin tone",*/ "1f919-1f3fd", 1368, EmojiCode(0x1f919, 0x1f3fd)),
+        EmojiRecord("people", /*"call me hand: medium-dark skin tone",*/ "1f919-1f3fe", 1369, EmojiCode(0x1f919, 0x1f3fe)),
+        EmojiRecord("people", /*"call me hand: dark skin tone",*/ "1f919-1f3ff", 1370, EmojiCode(0x1f919, 0x1f3ff)),
+        EmojiRecord("people", /*"flexed biceps",*/ "1f4aa", 1371, EmojiCode(0x1f4aa)),
+        EmojiRecord("people", /*"flexed biceps: light skin tone",*/ "1f4aa-1f3fb", 1372, EmojiCode(0x1f4aa, 0x1f3fb)),
+        EmojiRecord("people", /*"flexed biceps: medium-light skin tone",*/ "1f4aa-1f3fc", 1373, EmojiCode(0x1f4aa, 0x1f3fc)),
+        EmojiRecord("people", /*"flexed biceps: medium skin tone",*/ "1f4aa-1f3fd", 1374, EmojiCode(0x1f4aa, 0x1f3fd)),
+        EmojiRecord("people", /*"flexed biceps: medium-dark skin tone",*/ "1f4aa-1f3fe", 1375, EmojiCode(0x1f4aa, 0x1f3fe)),
+        EmojiRecord("people", /*"flexed biceps: dark skin tone",*/ "1f4aa-1f3ff", 1376, EmojiCode(0x1f4aa, 0x1f3ff)),
+        EmojiRecord("people", /*"leg",*/ "1f9b5", 1377, EmojiCode(0x1f9b5)),
+        EmojiRecord("people", /*"leg: light skin tone",*/ "1f9b5-1f3fb", 1378, EmojiCode(0x1f9b5, 0x1f3fb)),
+        EmojiRecord("people", /*"leg: medium-light skin tone",*/ "1f9b5-1f3fc", 1379, EmojiCode(0x1f9b5, 0x1f3fc)),
+        EmojiRecord("people", /*"leg: medium skin tone",*/ "1f9b5-1f3fd", 1380, EmojiCode(0x1f9b5, 0x1f3fd)),
+        EmojiRecord("people", /*"leg: medium-dark skin tone",*/ "1f9b5-1f3fe", 1381, EmojiCode(0x1f9b5, 0x1f3fe)),
+        EmojiRecord("people", /*"leg: dark skin tone",*/ "1f9b5-1f3ff", 1382, EmojiCode(0x1f9b5, 0x1f3ff)),
+        EmojiRecord("people", /*"foot",*/ "1f9b6", 1383, EmojiCode(0x1f9b6)),
+        EmojiRecord("people", /*"foot: light skin tone",*/ "1f9b6-1f3fb", 1384, EmojiCode(0x1f9b6, 0x1f3fb)),
+        EmojiRecord("people", /*"foot: medium-light skin tone",*/ "1f9b6-1f3fc", 1385, EmojiCode(0x1f9b6, 0x1f3fc)),
+        EmojiRecord("people", /*"foot: medium skin tone",*/ "1f9b6-1f3fd", 1386, EmojiCode(0x1f9b6, 0x1f3fd)),
+        EmojiRecord("people", /*"foot: medium-dark skin tone",*/ "1f9b6-1f3fe", 1387, EmojiCode(0x1f9b6, 0x1f3fe)),
+        EmojiRecord("people", /*"foot: dark skin tone",*/ "1f9b6-1f3ff", 1388, EmojiCode(0x1f9b6, 0x1f3ff)),
+        EmojiRecord("people", /*"middle finger",*/ "1f595", 1389, EmojiCode(0x1f595)),
+        EmojiRecord("people", /*"middle finger: light skin tone",*/ "1f595-1f3fb", 1390, EmojiCode(0x1f595, 0x1f3fb)),
+        EmojiRecord("people", /*"middle finger: medium-light skin tone",*/ "1f595-1f3fc", 1391, EmojiCode(0x1f595, 0x1f3fc)),
+        EmojiRecord("people", /*"middle finger: medium skin tone",*/ "1f595-1f3fd", 1392, EmojiCode(0x1f595, 0x1f3fd)),
+        EmojiRecord("people", /*"middle finger: medium-dark skin tone",*/ "1f595-1f3fe", 1393, EmojiCode(0x1f595, 0x1f3fe)),
+        EmojiRecord("people", /*"middle finger: dark skin tone",*/ "1f595-1f3ff", 1394, EmojiCode(0x1f595, 0x1f3ff)),
+        EmojiRecord("people", /*"writing hand",*/ "270d", 1395, EmojiCode(0x270d), EmojiCode(0x270d, 0xfe0f)),
+        EmojiRecord("people", /*"writing hand: light skin tone",*/ "270d-1f3fb", 1396, EmojiCode(0x270d, 0x1f3fb), EmojiCode(0x270d, 0xfe0f, 0x1f3fb)),
+        EmojiRecord("people", /*"writing hand: medium-light skin tone",*/ "270d-1f3fc", 1397, EmojiCode(0x270d, 0x1f3fc), EmojiCode(0x270d, 0xfe0f, 0x1f3fc)),
+        EmojiRecord("people", /*"writing hand: medium skin tone",*/ "270d-1f3fd", 1398, EmojiCode(0x270d, 0x1f3fd), EmojiCode(0x270d, 0xfe0f, 0x1f3fd)),
+        EmojiRecord("people", /*"writing hand: medium-dark skin tone",*/ "270d-1f3fe", 1399, EmojiCode(0x270d, 0x1f3fe), EmojiCode(0x270d, 0xfe0f, 0x1f3fe)),
+        EmojiRecord("people", /*"writing hand: dark skin tone",*/ "270d-1f3ff", 1400, EmojiCode(0x270d, 0x1f3ff), EmojiCode(0x270d, 0xfe0f, 0x1f3ff)),
+        EmojiRecord("people", /*"folded hands",*/ "1f64f", 1401, EmojiCode(0x1f64f)),
+        EmojiRecord("people", /*"folded hands: light skin tone",*/ "1f64f-1f3fb", 1402, EmojiCode(0x1f64f, 0x1f3fb)),
+        EmojiRecord("people", /*"folded hands: medium-light skin tone",*/ "1f64f-1f3fc", 1403, EmojiCode(0x1f64f, 0x1f3fc)),
+        EmojiRecord("people", /*"folded hands: medium skin tone",*/ "1f64f-1f3fd", 1404, EmojiCode(0x1f64f, 0x1f3fd)),
+        EmojiRecord("people", /*"folded hands: medium-dark skin tone",*/ "1f64f-1f3fe", 1405, EmojiCode(0x1f64f, 0x1f3fe)),
+        EmojiRecord("people", /*"folded hands: dark skin tone",*/ "1f64f-1f3ff", 1406, EmojiCode(0x1f64f, 0x1f3ff)),
+        EmojiRecord("people", /*"ring",*/ "1f48d", 1407, EmojiCode(0x1f48d)),
+        EmojiRecord("people", /*"lipstick",*/ "1f484", 1408, EmojiCode(0x1f484)),
+        EmojiRecord("people", /*"kiss mark",*/ "1f48b", 1409, EmojiCode(0x1f48b)),
+        EmojiRecord("people", /*"mouth",*/ "1f444", 1410, EmojiCode(0x1f444)),
+        EmojiRecord("people", /*"tongue",*/ "1f445", 1411, EmojiCode(0x1f445)),
+        EmojiRecord("people", /*"ear",*/ "1f442", 1412, EmojiCode(0x1f442), EmojiCode(0x1f442, 0xfe0f)),
+        EmojiRecord("people", /*"ear: light skin tone",*/ "1f442-1f3fb", 1413, EmojiCode(0x1f442, 0x1f3fb)),
+        EmojiRecord("people", /*"ear: medium-light skin tone",*/ "1f442-1f3fc", 1414, EmojiCode(0x1f442, 0x1f3fc)),
+        EmojiRecord("people", /*"ear: medium skin tone",*/ "1f442-1f3fd", 1415, EmojiCode(0x1f442, 0x1f3fd)),
+        EmojiRecord("people", /*"ear: medium-dark skin tone",*/ "1f442-1f3fe", 1416, EmojiCode(0x1f442, 0x1f3fe)),
+        EmojiRecord("people", /*"ear: dark skin tone",*/ "1f442-1f3ff", 1417, EmojiCode(0x1f442, 0x1f3ff)),
+        EmojiRecord("people", /*"nose",*/ "1f443", 1418, EmojiCode(0x1f443)),
+        EmojiRecord("people", /*"nose: light skin tone",*/ "1f443-1f3fb", 1419, EmojiCode(0x1f443, 0x1f3fb)),
+        EmojiRecord("people", /*"nose: medium-light skin tone",*/ "1f443-1f3fc", 1420, EmojiCode(0x1f443, 0x1f3fc)),
+        EmojiRecord("people", /*"nose: medium skin tone",*/ "1f443-1f3fd", 1421, EmojiCode(0x1f443, 0x1f3fd)),
+        EmojiRecord("people", /*"nose: medium-dark skin tone",*/ "1f443-1f3fe", 1422, EmojiCode(0x1f443, 0x1f3fe)),
+        EmojiRecord("people", /*"nose: dark skin tone",*/ "1f443-1f3ff", 1423, EmojiCode(0x1f443, 0x1f3ff)),
+        EmojiRecord("people", /*"footprints",*/ "1f463", 1424, EmojiCode(0x1f463)),
+        EmojiRecord("people", /*"eye",*/ "1f441", 1425, EmojiCode(0x1f441), EmojiCode(0x1f441, 0xfe0f)),
+        EmojiRecord("people", /*"eyes",*/ "1f440", 1426, EmojiCode(0x1f440)),
+        EmojiRecord("people", /*"brain",*/ "1f9e0", 1427, EmojiCode(0x1f9e0)),
+        EmojiRecord("people", /*"bone",*/ "1f9b4", 1428, EmojiCode(0x1f9b4)),
+        EmojiRecord("people", /*"tooth",*/ "1f9b7", 1429, EmojiCode(0x1f9b7)),
+        EmojiRecord("people", /*"speaking head",*/ "1f5e3", 1430, EmojiCode(0x1f5e3), EmojiCode(0x1f5e3, 0xfe0f)),
+        EmojiRecord("people", /*"bust in silhouette",*/ "1f464", 1431, EmojiCode(0x1f464)),
+        EmojiRecord("people", /*"busts in silhouette",*/ "1f465", 1432, EmojiCode(0x1f465)),
+        EmojiRecord("people", /*"baby",*/ "1f476", 1433, EmojiCode(0x1f476)),
+        EmojiRecord("people", /*"baby: light skin tone",*/ "1f476-1f3fb", 1434, EmojiCode(0x1f476, 0x1f3fb)),
+        EmojiRecord("people", /*"baby: medium-light skin tone",*/ "1f476-1f3fc", 1435, EmojiCode(0x1f476, 0x1f3fc)),
+        EmojiRecord("people", /*"baby: medium skin tone",*/ "1f476-1f3fd", 1436, EmojiCode(0x1f476, 0x1f3fd)),
+        EmojiRecord("people", /*"baby: medium-dark skin tone",*/ "1f476-1f3fe", 1437, EmojiCode(0x1f476, 0x1f3fe)),
+        EmojiRecord("people", /*"baby: dark skin tone",*/ "1f476-1f3ff", 1438, EmojiCode(0x1f476, 0x1f3ff)),
+        EmojiRecord("people", /*"girl",*/ "1f467", 1439, EmojiCode(0x1f467)),
+        EmojiRecord("people", /*"girl: light skin tone",*/ "1f467-1f3fb", 1440, EmojiCode(0x1f467, 0x1f3fb)),
+        EmojiRecord("people", /*"girl: medium-light skin tone",*/ "1f467-1f3fc", 1441, EmojiCode(0x1f467, 0x1f3fc)),
+        EmojiRecord("people", /*"girl: medium skin tone",*/ "1f467-1f3fd", 1442, EmojiCode(0x1f467, 0x1f3fd)),
+        EmojiRecord("people", /*"girl: medium-dark skin tone",*/ "1f467-1f3fe", 1443, EmojiCode(0x1f467, 0x1f3fe)),
+        EmojiRecord("people", /*"girl: dark skin tone",*/ "1f467-1f3ff", 1444, EmojiCode(0x1f467, 0x1f3ff)),
+        EmojiRecord("people", /*"child",*/ "1f9d2", 1445, EmojiCode(0x1f9d2)),
+        EmojiRecord("people", /*"child: light skin tone",*/ "1f9d2-1f3fb", 1446, EmojiCode(0x1f9d2, 0x1f3fb)),
+        EmojiRecord("people", /*"child: medium-light skin tone",*/ "1f9d2-1f3fc", 1447, EmojiCode(0x1f9d2, 0x1f3fc)),
+        EmojiRecord("people", /*"child: medium skin tone",*/ "1f9d2-1f3fd", 1448, EmojiCode(0x1f9d2, 0x1f3fd)),
+        EmojiRecord("people", /*"child: medium-dark skin tone",*/ "1f9d2-1f3fe", 1449, EmojiCode(0x1f9d2, 0x1f3fe)),
+        EmojiRecord("people", /*"child: dark skin tone",*/ "1f9d2-1f3ff", 1450, EmojiCode(0x1f9d2, 0x1f3ff)),
+        EmojiRecord("people", /*"boy",*/ "1f466", 1451, EmojiCode(0x1f466)),
+        EmojiRecord("people", /*"boy: light skin tone",*/ "1f466-1f3fb", 1452, EmojiCode(0x1f466, 0x1f3fb)),
+        EmojiRecord("people", /*"boy: medium-light skin tone",*/ "1f466-1f3fc", 1453, EmojiCode(0x1f466, 0x1f3fc)),
+        EmojiRecord("people", /*"boy: medium skin tone",*/ "1f466-1f3fd", 1454, EmojiCode(0x1f466, 0x1f3fd)),
+        EmojiRecord("people", /*"boy: medium-dark skin tone",*/ "1f466-1f3fe", 1455, EmojiCode(0x1f466, 0x1f3fe)),
+        EmojiRecord("people", /*"boy: dark skin tone",*/ "1f466-1f3ff", 1456, EmojiCode(0x1f466, 0x1f3ff)),
+        EmojiRecord("people", /*"woman",*/ "1f469", 1457, EmojiCode(0x1f469)),
+        EmojiRecord("people", /*"woman: light skin tone",*/ "1f469-1f3fb", 1458, EmojiCode(0x1f469, 0x1f3fb)),
+        EmojiRecord("people", /*"woman: medium-light skin tone",*/ "1f469-1f3fc", 1459, EmojiCode(0x1f469, 0x1f3fc)),
+        EmojiRecord("people", /*"woman: medium skin tone",*/ "1f469-1f3fd", 1460, EmojiCode(0x1f469, 0x1f3fd)),
+        EmojiRecord("people", /*"woman: medium-dark skin tone",*/ "1f469-1f3fe", 1461, EmojiCode(0x1f469, 0x1f3fe)),
+        EmojiRecord("people", /*"woman: dark skin tone",*/ "1f469-1f3ff", 1462, EmojiCode(0x1f469, 0x1f3ff)),
+        EmojiRecord("people", /*"adult",*/ "1f9d1", 1463, EmojiCode(0x1f9d1)),
+        EmojiRecord("people", /*"adult: light skin tone",*/ "1f9d1-1f3fb", 1464, EmojiCode(0x1f9d1, 0x1f3fb)),
+        EmojiRecord("people", /*"adult: medium-light skin tone",*/ "1f9d1-1f3fc", 1465, EmojiCode(0x1f9d1, 0x1f3fc)),
+        EmojiRecord("people", /*"adult: medium skin tone",*/ "1f9d1-1f3fd", 1466, EmojiCode(0x1f9d1, 0x1f3fd)),
+        EmojiRecord("people", /*"adult: medium-dark skin tone",*/ "1f9d1-1f3fe", 1467, EmojiCode(0x1f9d1, 0x1f3fe)),
+        EmojiRecord("people", /*"adult: dark skin tone",*/ "1f9d1-1f3ff", 1468, EmojiCode(0x1f9d1, 0x1f3ff)),
+        EmojiRecord("people", /*"man",*/ "1f468", 1469, EmojiCode(0x1f468)),
+        EmojiRecord("people", /*"man: light skin tone",*/ "1f468-1f3fb", 1470, EmojiCode(0x1f468, 0x1f3fb)),
+        EmojiRecord("people", /*"man: medium-light skin tone",*/ "1f468-1f3fc", 1471, EmojiCode(0x1f468, 0x1f3fc)),
+        EmojiRecord("people", /*"man: medium skin tone",*/ "1f468-1f3fd", 1472, EmojiCode(0x1f468, 0x1f3fd)),
+        EmojiRecord("people", /*"man: medium-dark skin tone",*/ "1f468-1f3fe", 1473, EmojiCode(0x1f468, 0x1f3fe)),
+        EmojiRecord("people", /*"man: dark skin tone",*/ "1f468-1f3ff", 1474, EmojiCode(0x1f468, 0x1f3ff)),
+        EmojiRecord("people", /*"blond-haired person",*/ "1f471", 1475, EmojiCode(0x1f471)),
+        EmojiRecord("people", /*"blond-haired person: light skin tone",*/ "1f471-1f3fb", 1476, EmojiCode(0x1f471, 0x1f3fb)),
+        EmojiRecord("people", /*"blond-haired person: medium-light skin tone",*/ "1f471-1f3fc", 1477, EmojiCode(0x1f471, 0x1f3fc)),
+        EmojiRecord("people", /*"blond-haired person: medium skin tone",*/ "1f471-1f3fd", 1478, EmojiCode(0x1f471, 0x1f3fd)),
+        EmojiRecord("people", /*"blond-haired person: medium-dark skin tone",*/ "1f471-1f3fe", 1479, EmojiCode(0x1f471, 0x1f3fe)),
+        EmojiRecord("people", /*"blond-haired person: dark skin tone",*/ "1f471-1f3ff", 1480, EmojiCode(0x1f471, 0x1f3ff)),
+        EmojiRecord("people", /*"blond-haired woman",*/ "1f471-2640", 1481, EmojiCode(0x1f471, 0x2640), EmojiCode(0x1f471, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired woman: light skin tone",*/ "1f471-1f3fb-2640", 1482, EmojiCode(0x1f471, 0x1f3fb, 0x2640), EmojiCode(0x1f471, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired woman: medium-light skin tone",*/ "1f471-1f3fc-2640", 1483, EmojiCode(0x1f471, 0x1f3fc, 0x2640), EmojiCode(0x1f471, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired woman: medium skin tone",*/ "1f471-1f3fd-2640", 1484, EmojiCode(0x1f471, 0x1f3fd, 0x2640), EmojiCode(0x1f471, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired woman: medium-dark skin tone",*/ "1f471-1f3fe-2640", 1485, EmojiCode(0x1f471, 0x1f3fe, 0x2640), EmojiCode(0x1f471, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired woman: dark skin tone",*/ "1f471-1f3ff-2640", 1486, EmojiCode(0x1f471, 0x1f3ff, 0x2640), EmojiCode(0x1f471, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired man",*/ "1f471-2642", 1487, EmojiCode(0x1f471, 0x2642), EmojiCode(0x1f471, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired man: light skin tone",*/ "1f471-1f3fb-2642", 1488, EmojiCode(0x1f471, 0x1f3fb, 0x2642), EmojiCode(0x1f471, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired man: medium-light skin tone",*/ "1f471-1f3fc-2642", 1489, EmojiCode(0x1f471, 0x1f3fc, 0x2642), EmojiCode(0x1f471, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired man: medium skin tone",*/ "1f471-1f3fd-2642", 1490, EmojiCode(0x1f471, 0x1f3fd, 0x2642), EmojiCode(0x1f471, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired man: medium-dark skin tone",*/ "1f471-1f3fe-2642", 1491, EmojiCode(0x1f471, 0x1f3fe, 0x2642), EmojiCode(0x1f471, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"blond-haired man: dark skin tone",*/ "1f471-1f3ff-2642", 1492, EmojiCode(0x1f471, 0x1f3ff, 0x2642), EmojiCode(0x1f471, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"woman, red haired",*/ "1f469-1f9b0", 1493, EmojiCode(0x1f469, 0x1f9b0), EmojiCode(0x1f469, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"woman, red haired: light skin tone",*/ "1f469-1f3fb-1f9b0", 1494, EmojiCode(0x1f469, 0x1f3fb, 0x1f9b0), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"woman, red haired: medium-light skin tone",*/ "1f469-1f3fc-1f9b0", 1495, EmojiCode(0x1f469, 0x1f3fc, 0x1f9b0), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"woman, red haired: medium skin tone",*/ "1f469-1f3fd-1f9b0", 1496, EmojiCode(0x1f469, 0x1f3fd, 0x1f9b0), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"woman, red haired: medium-dark skin tone",*/ "1f469-1f3fe-1f9b0", 1497, EmojiCode(0x1f469, 0x1f3fe, 0x1f9b0), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"woman, red haired: dark skin tone",*/ "1f469-1f3ff-1f9b0", 1498, EmojiCode(0x1f469, 0x1f3ff, 0x1f9b0), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"man, red haired",*/ "1f468-1f9b0", 1499, EmojiCode(0x1f468, 0x1f9b0), EmojiCode(0x1f468, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"man, red haired: light skin tone",*/ "1f468-1f3fb-1f9b0", 1500, EmojiCode(0x1f468, 0x1f3fb, 0x1f9b0), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"man, red haired: medium-light skin tone",*/ "1f468-1f3fc-1f9b0", 1501, EmojiCode(0x1f468, 0x1f3fc, 0x1f9b0), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"man, red haired: medium skin tone",*/ "1f468-1f3fd-1f9b0", 1502, EmojiCode(0x1f468, 0x1f3fd, 0x1f9b0), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"man, red haired: medium-dark skin tone",*/ "1f468-1f3fe-1f9b0", 1503, EmojiCode(0x1f468, 0x1f3fe, 0x1f9b0), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"man, red haired: dark skin tone",*/ "1f468-1f3ff-1f9b0", 1504, EmojiCode(0x1f468, 0x1f3ff, 0x1f9b0), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f9b0)),
+        EmojiRecord("people", /*"woman, curly haired",*/ "1f469-1f9b1", 1505, EmojiCode(0x1f469, 0x1f9b1), EmojiCode(0x1f469, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"woman, curly haired: light skin tone",*/ "1f469-1f3fb-1f9b1", 1506, EmojiCode(0x1f469, 0x1f3fb, 0x1f9b1), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"woman, curly haired: medium-light skin tone",*/ "1f469-1f3fc-1f9b1", 1507, EmojiCode(0x1f469, 0x1f3fc, 0x1f9b1), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"woman, curly haired: medium skin tone",*/ "1f469-1f3fd-1f9b1", 1508, EmojiCode(0x1f469, 0x1f3fd, 0x1f9b1), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"woman, curly haired: medium-dark skin tone",*/ "1f469-1f3fe-1f9b1", 1509, EmojiCode(0x1f469, 0x1f3fe, 0x1f9b1), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"woman, curly haired: dark skin tone",*/ "1f469-1f3ff-1f9b1", 1510, EmojiCode(0x1f469, 0x1f3ff, 0x1f9b1), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"man, curly haired",*/ "1f468-1f9b1", 1511, EmojiCode(0x1f468, 0x1f9b1), EmojiCode(0x1f468, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"man, curly haired: light skin tone",*/ "1f468-1f3fb-1f9b1", 1512, EmojiCode(0x1f468, 0x1f3fb, 0x1f9b1), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"man, curly haired: medium-light skin tone",*/ "1f468-1f3fc-1f9b1", 1513, EmojiCode(0x1f468, 0x1f3fc, 0x1f9b1), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"man, curly haired: medium skin tone",*/ "1f468-1f3fd-1f9b1", 1514, EmojiCode(0x1f468, 0x1f3fd, 0x1f9b1), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"man, curly haired: medium-dark skin tone",*/ "1f468-1f3fe-1f9b1", 1515, EmojiCode(0x1f468, 0x1f3fe, 0x1f9b1), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"man, curly haired: dark skin tone",*/ "1f468-1f3ff-1f9b1", 1516, EmojiCode(0x1f468, 0x1f3ff, 0x1f9b1), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f9b1)),
+        EmojiRecord("people", /*"woman, white haired",*/ "1f469-1f9b3", 1517, EmojiCode(0x1f469, 0x1f9b3), EmojiCode(0x1f469, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"woman, white haired: light skin tone",*/ "1f469-1f3fb-1f9b3", 1518, EmojiCode(0x1f469, 0x1f3fb, 0x1f9b3), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"woman, white haired: medium-light skin tone",*/ "1f469-1f3fc-1f9b3", 1519, EmojiCode(0x1f469, 0x1f3fc, 0x1f9b3), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"woman, white haired: medium skin tone",*/ "1f469-1f3fd-1f9b3", 1520, EmojiCode(0x1f469, 0x1f3fd, 0x1f9b3), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"woman, white haired: medium-dark skin tone",*/ "1f469-1f3fe-1f9b3", 1521, EmojiCode(0x1f469, 0x1f3fe, 0x1f9b3), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"woman, white haired: dark skin tone",*/ "1f469-1f3ff-1f9b3", 1522, EmojiCode(0x1f469, 0x1f3ff, 0x1f9b3), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"man, white haired",*/ "1f468-1f9b3", 1523, EmojiCode(0x1f468, 0x1f9b3), EmojiCode(0x1f468, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"man, white haired: light skin tone",*/ "1f468-1f3fb-1f9b3", 1524, EmojiCode(0x1f468, 0x1f3fb, 0x1f9b3), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"man, white haired: medium-light skin tone",*/ "1f468-1f3fc-1f9b3", 1525, EmojiCode(0x1f468, 0x1f3fc, 0x1f9b3), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"man, white haired: medium skin tone",*/ "1f468-1f3fd-1f9b3", 1526, EmojiCode(0x1f468, 0x1f3fd, 0x1f9b3), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"man, white haired: medium-dark skin tone",*/ "1f468-1f3fe-1f9b3", 1527, EmojiCode(0x1f468, 0x1f3fe, 0x1f9b3), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"man, white haired: dark skin tone",*/ "1f468-1f3ff-1f9b3", 1528, EmojiCode(0x1f468, 0x1f3ff, 0x1f9b3), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f9b3)),
+        EmojiRecord("people", /*"woman, bald",*/ "1f469-1f9b2", 1529, EmojiCode(0x1f469, 0x1f9b2), EmojiCode(0x1f469, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"woman, bald: light skin tone",*/ "1f469-1f3fb-1f9b2", 1530, EmojiCode(0x1f469, 0x1f3fb, 0x1f9b2), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"woman, bald: medium-light skin tone",*/ "1f469-1f3fc-1f9b2", 1531, EmojiCode(0x1f469, 0x1f3fc, 0x1f9b2), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"woman, bald: medium skin tone",*/ "1f469-1f3fd-1f9b2", 1532, EmojiCode(0x1f469, 0x1f3fd, 0x1f9b2), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"woman, bald: medium-dark skin tone",*/ "1f469-1f3fe-1f9b2", 1533, EmojiCode(0x1f469, 0x1f3fe, 0x1f9b2), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"woman, bald: dark skin tone",*/ "1f469-1f3ff-1f9b2", 1534, EmojiCode(0x1f469, 0x1f3ff, 0x1f9b2), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"man, bald",*/ "1f468-1f9b2", 1535, EmojiCode(0x1f468, 0x1f9b2), EmojiCode(0x1f468, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"man, bald: light skin tone",*/ "1f468-1f3fb-1f9b2", 1536, EmojiCode(0x1f468, 0x1f3fb, 0x1f9b2), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"man, bald: medium-light skin tone",*/ "1f468-1f3fc-1f9b2", 1537, EmojiCode(0x1f468, 0x1f3fc, 0x1f9b2), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"man, bald: medium skin tone",*/ "1f468-1f3fd-1f9b2", 1538, EmojiCode(0x1f468, 0x1f3fd, 0x1f9b2), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"man, bald: medium-dark skin tone",*/ "1f468-1f3fe-1f9b2", 1539, EmojiCode(0x1f468, 0x1f3fe, 0x1f9b2), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"man, bald: dark skin tone",*/ "1f468-1f3ff-1f9b2", 1540, EmojiCode(0x1f468, 0x1f3ff, 0x1f9b2), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f9b2)),
+        EmojiRecord("people", /*"bearded person",*/ "1f9d4", 1541, EmojiCode(0x1f9d4)),
+        EmojiRecord("people", /*"bearded person: light skin tone",*/ "1f9d4-1f3fb", 1542, EmojiCode(0x1f9d4, 0x1f3fb)),
+        EmojiRecord("people", /*"bearded person: medium-light skin tone",*/ "1f9d4-1f3fc", 1543, EmojiCode(0x1f9d4, 0x1f3fc)),
+        EmojiRecord("people", /*"bearded person: medium skin tone",*/ "1f9d4-1f3fd", 1544, EmojiCode(0x1f9d4, 0x1f3fd)),
+        EmojiRecord("people", /*"bearded person: medium-dark skin tone",*/ "1f9d4-1f3fe", 1545, EmojiCode(0x1f9d4, 0x1f3fe)),
+        EmojiRecord("people", /*"bearded person: dark skin tone",*/ "1f9d4-1f3ff", 1546, EmojiCode(0x1f9d4, 0x1f3ff)),
+        EmojiRecord("people", /*"old woman",*/ "1f475", 1547, EmojiCode(0x1f475)),
+        EmojiRecord("people", /*"old woman: light skin tone",*/ "1f475-1f3fb", 1548, EmojiCode(0x1f475, 0x1f3fb)),
+        EmojiRecord("people", /*"old woman: medium-light skin tone",*/ "1f475-1f3fc", 1549, EmojiCode(0x1f475, 0x1f3fc)),
+        EmojiRecord("people", /*"old woman: medium skin tone",*/ "1f475-1f3fd", 1550, EmojiCode(0x1f475, 0x1f3fd)),
+        EmojiRecord("people", /*"old woman: medium-dark skin tone",*/ "1f475-1f3fe", 1551, EmojiCode(0x1f475, 0x1f3fe)),
+        EmojiRecord("people", /*"old woman: dark skin tone",*/ "1f475-1f3ff", 1552, EmojiCode(0x1f475, 0x1f3ff)),
+        EmojiRecord("people", /*"older adult",*/ "1f9d3", 1553, EmojiCode(0x1f9d3)),
+        EmojiRecord("people", /*"older adult: light skin tone",*/ "1f9d3-1f3fb", 1554, EmojiCode(0x1f9d3, 0x1f3fb)),
+        EmojiRecord("people", /*"older adult: medium-light skin tone",*/ "1f9d3-1f3fc", 1555, EmojiCode(0x1f9d3, 0x1f3fc)),
+        EmojiRecord("people", /*"older adult: medium skin tone",*/ "1f9d3-1f3fd", 1556, EmojiCode(0x1f9d3, 0x1f3fd)),
+        EmojiRecord("people", /*"older adult: medium-dark skin tone",*/ "1f9d3-1f3fe", 1557, EmojiCode(0x1f9d3, 0x1f3fe)),
+        EmojiRecord("people", /*"older adult: dark skin tone",*/ "1f9d3-1f3ff", 1558, EmojiCode(0x1f9d3, 0x1f3ff)),
+        EmojiRecord("people", /*"old man",*/ "1f474", 1559, EmojiCode(0x1f474)),
+        EmojiRecord("people", /*"old man: light skin tone",*/ "1f474-1f3fb", 1560, EmojiCode(0x1f474, 0x1f3fb)),
+        EmojiRecord("people", /*"old man: medium-light skin tone",*/ "1f474-1f3fc", 1561, EmojiCode(0x1f474, 0x1f3fc)),
+        EmojiRecord("people", /*"old man: medium skin tone",*/ "1f474-1f3fd", 1562, EmojiCode(0x1f474, 0x1f3fd)),
+        EmojiRecord("people", /*"old man: medium-dark skin tone",*/ "1f474-1f3fe", 1563, EmojiCode(0x1f474, 0x1f3fe)),
+        EmojiRecord("people", /*"old man: dark skin tone",*/ "1f474-1f3ff", 1564, EmojiCode(0x1f474, 0x1f3ff)),
+        EmojiRecord("people", /*"man with Chinese cap",*/ "1f472", 1565, EmojiCode(0x1f472)),
+        EmojiRecord("people", /*"man with Chinese cap: light skin tone",*/ "1f472-1f3fb", 1566, EmojiCode(0x1f472, 0x1f3fb)),
+        EmojiRecord("people", /*"man with Chinese cap: medium-light skin tone",*/ "1f472-1f3fc", 1567, EmojiCode(0x1f472, 0x1f3fc)),
+        EmojiRecord("people", /*"man with Chinese cap: medium skin tone",*/ "1f472-1f3fd", 1568, EmojiCode(0x1f472, 0x1f3fd)),
+        EmojiRecord("people", /*"man with Chinese cap: medium-dark skin tone",*/ "1f472-1f3fe", 1569, EmojiCode(0x1f472, 0x1f3fe)),
+        EmojiRecord("people", /*"man with Chinese cap: dark skin tone",*/ "1f472-1f3ff", 1570, EmojiCode(0x1f472, 0x1f3ff)),
+        EmojiRecord("people", /*"person wearing turban",*/ "1f473", 1571, EmojiCode(0x1f473)),
+        EmojiRecord("people", /*"person wearing turban: light skin tone",*/ "1f473-1f3fb", 1572, EmojiCode(0x1f473, 0x1f3fb)),
+        EmojiRecord("people", /*"person wearing turban: medium-light skin tone",*/ "1f473-1f3fc", 1573, EmojiCode(0x1f473, 0x1f3fc)),
+        EmojiRecord("people", /*"person wearing turban: medium skin tone",*/ "1f473-1f3fd", 1574, EmojiCode(0x1f473, 0x1f3fd)),
+        EmojiRecord("people", /*"person wearing turban: medium-dark skin tone",*/ "1f473-1f3fe", 1575, EmojiCode(0x1f473, 0x1f3fe)),
+        EmojiRecord("people", /*"person wearing turban: dark skin tone",*/ "1f473-1f3ff", 1576, EmojiCode(0x1f473, 0x1f3ff)),
+        EmojiRecord("people", /*"woman wearing turban",*/ "1f473-2640", 1577, EmojiCode(0x1f473, 0x2640), EmojiCode(0x1f473, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman wearing turban: light skin tone",*/ "1f473-1f3fb-2640", 1578, EmojiCode(0x1f473, 0x1f3fb, 0x2640), EmojiCode(0x1f473, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman wearing turban: medium-light skin tone",*/ "1f473-1f3fc-2640", 1579, EmojiCode(0x1f473, 0x1f3fc, 0x2640), EmojiCode(0x1f473, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman wearing turban: medium skin tone",*/ "1f473-1f3fd-2640", 1580, EmojiCode(0x1f473, 0x1f3fd, 0x2640), EmojiCode(0x1f473, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman wearing turban: medium-dark skin tone",*/ "1f473-1f3fe-2640", 1581, EmojiCode(0x1f473, 0x1f3fe, 0x2640), EmojiCode(0x1f473, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman wearing turban: dark skin tone",*/ "1f473-1f3ff-2640", 1582, EmojiCode(0x1f473, 0x1f3ff, 0x2640), EmojiCode(0x1f473, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man wearing turban",*/ "1f473-2642", 1583, EmojiCode(0x1f473, 0x2642), EmojiCode(0x1f473, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man wearing turban: light skin tone",*/ "1f473-1f3fb-2642", 1584, EmojiCode(0x1f473, 0x1f3fb, 0x2642), EmojiCode(0x1f473, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man wearing turban: medium-light skin tone",*/ "1f473-1f3fc-2642", 1585, EmojiCode(0x1f473, 0x1f3fc, 0x2642), EmojiCode(0x1f473, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man wearing turban: medium skin tone",*/ "1f473-1f3fd-2642", 1586, EmojiCode(0x1f473, 0x1f3fd, 0x2642), EmojiCode(0x1f473, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man wearing turban: medium-dark skin tone",*/ "1f473-1f3fe-2642", 1587, EmojiCode(0x1f473, 0x1f3fe, 0x2642), EmojiCode(0x1f473, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man wearing turban: dark skin tone",*/ "1f473-1f3ff-2642", 1588, EmojiCode(0x1f473, 0x1f3ff, 0x2642), EmojiCode(0x1f473, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"woman with headscarf",*/ "1f9d5", 1589, EmojiCode(0x1f9d5)),
+        EmojiRecord("people", /*"woman with headscarf: light skin tone",*/ "1f9d5-1f3fb", 1590, EmojiCode(0x1f9d5, 0x1f3fb)),
+        EmojiRecord("people", /*"woman with headscarf: medium-light skin tone",*/ "1f9d5-1f3fc", 1591, EmojiCode(0x1f9d5, 0x1f3fc)),
+        EmojiRecord("people", /*"woman with headscarf: medium skin tone",*/ "1f9d5-1f3fd", 1592, EmojiCode(0x1f9d5, 0x1f3fd)),
+        EmojiRecord("people", /*"woman with headscarf: medium-dark skin tone",*/ "1f9d5-1f3fe", 1593, EmojiCode(0x1f9d5, 0x1f3fe)),
+        EmojiRecord("people", /*"woman with headscarf: dark skin tone",*/ "1f9d5-1f3ff", 1594, EmojiCode(0x1f9d5, 0x1f3ff)),
+        EmojiRecord("people", /*"police officer",*/ "1f46e", 1595, EmojiCode(0x1f46e)),
+        EmojiRecord("people", /*"police officer: light skin tone",*/ "1f46e-1f3fb", 1596, EmojiCode(0x1f46e, 0x1f3fb)),
+        EmojiRecord("people", /*"police officer: medium-light skin tone",*/ "1f46e-1f3fc", 1597, EmojiCode(0x1f46e, 0x1f3fc)),
+        EmojiRecord("people", /*"police officer: medium skin tone",*/ "1f46e-1f3fd", 1598, EmojiCode(0x1f46e, 0x1f3fd)),
+        EmojiRecord("people", /*"police officer: medium-dark skin tone",*/ "1f46e-1f3fe", 1599, EmojiCode(0x1f46e, 0x1f3fe)),
+        EmojiRecord("people", /*"police officer: dark skin tone",*/ "1f46e-1f3ff", 1600, EmojiCode(0x1f46e, 0x1f3ff)),
+        EmojiRecord("people", /*"woman police officer",*/ "1f46e-2640", 1601, EmojiCode(0x1f46e, 0x2640), EmojiCode(0x1f46e, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman police officer: light skin tone",*/ "1f46e-1f3fb-2640", 1602, EmojiCode(0x1f46e, 0x1f3fb, 0x2640), EmojiCode(0x1f46e, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman police officer: medium-light skin tone",*/ "1f46e-1f3fc-2640", 1603, EmojiCode(0x1f46e, 0x1f3fc, 0x2640), EmojiCode(0x1f46e, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman police officer: medium skin tone",*/ "1f46e-1f3fd-2640", 1604, EmojiCode(0x1f46e, 0x1f3fd, 0x2640), EmojiCode(0x1f46e, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman police officer: medium-dark skin tone",*/ "1f46e-1f3fe-2640", 1605, EmojiCode(0x1f46e, 0x1f3fe, 0x2640), EmojiCode(0x1f46e, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman police officer: dark skin tone",*/ "1f46e-1f3ff-2640", 1606, EmojiCode(0x1f46e, 0x1f3ff, 0x2640), EmojiCode(0x1f46e, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man police officer",*/ "1f46e-2642", 1607, EmojiCode(0x1f46e, 0x2642), EmojiCode(0x1f46e, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man police officer: light skin tone",*/ "1f46e-1f3fb-2642", 1608, EmojiCode(0x1f46e, 0x1f3fb, 0x2642), EmojiCode(0x1f46e, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man police officer: medium-light skin tone",*/ "1f46e-1f3fc-2642", 1609, EmojiCode(0x1f46e, 0x1f3fc, 0x2642), EmojiCode(0x1f46e, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man police officer: medium skin tone",*/ "1f46e-1f3fd-2642", 1610, EmojiCode(0x1f46e, 0x1f3fd, 0x2642), EmojiCode(0x1f46e, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man police officer: medium-dark skin tone",*/ "1f46e-1f3fe-2642", 1611, EmojiCode(0x1f46e, 0x1f3fe, 0x2642), EmojiCode(0x1f46e, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man police officer: dark skin tone",*/ "1f46e-1f3ff-2642", 1612, EmojiCode(0x1f46e, 0x1f3ff, 0x2642), EmojiCode(0x1f46e, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"construction worker",*/ "1f477", 1613, EmojiCode(0x1f477)),
+        EmojiRecord("people", /*"construction worker: light skin tone",*/ "1f477-1f3fb", 1614, EmojiCode(0x1f477, 0x1f3fb)),
+        EmojiRecord("people", /*"construction worker: medium-light skin tone",*/ "1f477-1f3fc", 1615, EmojiCode(0x1f477, 0x1f3fc)),
+        EmojiRecord("people", /*"construction worker: medium skin tone",*/ "1f477-1f3fd", 1616, EmojiCode(0x1f477, 0x1f3fd)),
+        EmojiRecord("people", /*"construction worker: medium-dark skin tone",*/ "1f477-1f3fe", 1617, EmojiCode(0x1f477, 0x1f3fe)),
+        EmojiRecord("people", /*"construction worker: dark skin tone",*/ "1f477-1f3ff", 1618, EmojiCode(0x1f477, 0x1f3ff)),
+        EmojiRecord("people", /*"woman construction worker",*/ "1f477-2640", 1619, EmojiCode(0x1f477, 0x2640), EmojiCode(0x1f477, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman construction worker: light skin tone",*/ "1f477-1f3fb-2640", 1620, EmojiCode(0x1f477, 0x1f3fb, 0x2640), EmojiCode(0x1f477, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman construction worker: medium-light skin tone",*/ "1f477-1f3fc-2640", 1621, EmojiCode(0x1f477, 0x1f3fc, 0x2640), EmojiCode(0x1f477, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman construction worker: medium skin tone",*/ "1f477-1f3fd-2640", 1622, EmojiCode(0x1f477, 0x1f3fd, 0x2640), EmojiCode(0x1f477, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman construction worker: medium-dark skin tone",*/ "1f477-1f3fe-2640", 1623, EmojiCode(0x1f477, 0x1f3fe, 0x2640), EmojiCode(0x1f477, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman construction worker: dark skin tone",*/ "1f477-1f3ff-2640", 1624, EmojiCode(0x1f477, 0x1f3ff, 0x2640), EmojiCode(0x1f477, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man construction worker",*/ "1f477-2642", 1625, EmojiCode(0x1f477, 0x2642), EmojiCode(0x1f477, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man construction worker: light skin tone",*/ "1f477-1f3fb-2642", 1626, EmojiCode(0x1f477, 0x1f3fb, 0x2642), EmojiCode(0x1f477, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man construction worker: medium-light skin tone",*/ "1f477-1f3fc-2642", 1627, EmojiCode(0x1f477, 0x1f3fc, 0x2642), EmojiCode(0x1f477, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man construction worker: medium skin tone",*/ "1f477-1f3fd-2642", 1628, EmojiCode(0x1f477, 0x1f3fd, 0x2642), EmojiCode(0x1f477, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man construction worker: medium-dark skin tone",*/ "1f477-1f3fe-2642", 1629, EmojiCode(0x1f477, 0x1f3fe, 0x2642), EmojiCode(0x1f477, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man construction worker: dark skin tone",*/ "1f477-1f3ff-2642", 1630, EmojiCode(0x1f477, 0x1f3ff, 0x2642), EmojiCode(0x1f477, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"guard",*/ "1f482", 1631, EmojiCode(0x1f482)),
+        EmojiRecord("people", /*"guard: light skin tone",*/ "1f482-1f3fb", 1632, EmojiCode(0x1f482, 0x1f3fb)),
+        EmojiRecord("people", /*"guard: medium-light skin tone",*/ "1f482-1f3fc", 1633, EmojiCode(0x1f482, 0x1f3fc)),
+        EmojiRecord("people", /*"guard: medium skin tone",*/ "1f482-1f3fd", 1634, EmojiCode(0x1f482, 0x1f3fd)),
+        EmojiRecord("people", /*"guard: medium-dark skin tone",*/ "1f482-1f3fe", 1635, EmojiCode(0x1f482, 0x1f3fe)),
+        EmojiRecord("people", /*"guard: dark skin tone",*/ "1f482-1f3ff", 1636, EmojiCode(0x1f482, 0x1f3ff)),
+        EmojiRecord("people", /*"woman guard",*/ "1f482-2640", 1637, EmojiCode(0x1f482, 0x2640), EmojiCode(0x1f482, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman guard: light skin tone",*/ "1f482-1f3fb-2640", 1638, EmojiCode(0x1f482, 0x1f3fb, 0x2640), EmojiCode(0x1f482, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman guard: medium-light skin tone",*/ "1f482-1f3fc-2640", 1639, EmojiCode(0x1f482, 0x1f3fc, 0x2640), EmojiCode(0x1f482, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman guard: medium skin tone",*/ "1f482-1f3fd-2640", 1640, EmojiCode(0x1f482, 0x1f3fd, 0x2640), EmojiCode(0x1f482, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman guard: medium-dark skin tone",*/ "1f482-1f3fe-2640", 1641, EmojiCode(0x1f482, 0x1f3fe, 0x2640), EmojiCode(0x1f482, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman guard: dark skin tone",*/ "1f482-1f3ff-2640", 1642, EmojiCode(0x1f482, 0x1f3ff, 0x2640), EmojiCode(0x1f482, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man guard",*/ "1f482-2642", 1643, EmojiCode(0x1f482, 0x2642), EmojiCode(0x1f482, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man guard: light skin tone",*/ "1f482-1f3fb-2642", 1644, EmojiCode(0x1f482, 0x1f3fb, 0x2642), EmojiCode(0x1f482, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man guard: medium-light skin tone",*/ "1f482-1f3fc-2642", 1645, EmojiCode(0x1f482, 0x1f3fc, 0x2642), EmojiCode(0x1f482, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man guard: medium skin tone",*/ "1f482-1f3fd-2642", 1646, EmojiCode(0x1f482, 0x1f3fd, 0x2642), EmojiCode(0x1f482, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man guard: medium-dark skin tone",*/ "1f482-1f3fe-2642", 1647, EmojiCode(0x1f482, 0x1f3fe, 0x2642), EmojiCode(0x1f482, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man guard: dark skin tone",*/ "1f482-1f3ff-2642", 1648, EmojiCode(0x1f482, 0x1f3ff, 0x2642), EmojiCode(0x1f482, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"detective",*/ "1f575", 1649, EmojiCode(0x1f575), EmojiCode(0x1f575, 0xfe0f)),
+        EmojiRecord("people", /*"detective: light skin tone",*/ "1f575-1f3fb", 1650, EmojiCode(0x1f575, 0x1f3fb), EmojiCode(0x1f575, 0xfe0f, 0x1f3fb)),
+        EmojiRecord("people", /*"detective: medium-light skin tone",*/ "1f575-1f3fc", 1651, EmojiCode(0x1f575, 0x1f3fc), EmojiCode(0x1f575, 0xfe0f, 0x1f3fc)),
+        EmojiRecord("people", /*"detective: medium skin tone",*/ "1f575-1f3fd", 1652, EmojiCode(0x1f575, 0x1f3fd), EmojiCode(0x1f575, 0xfe0f, 0x1f3fd)),
+        EmojiRecord("people", /*"detective: medium-dark skin tone",*/ "1f575-1f3fe", 1653, EmojiCode(0x1f575, 0x1f3fe), EmojiCode(0x1f575, 0xfe0f, 0x1f3fe)),
+        EmojiRecord("people", /*"detective: dark skin tone",*/ "1f575-1f3ff", 1654, EmojiCode(0x1f575, 0x1f3ff), EmojiCode(0x1f575, 0xfe0f, 0x1f3ff)),
+        EmojiRecord("people", /*"woman detective",*/ "1f575-2640", 1655, EmojiCode(0x1f575, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman detective: light skin tone",*/ "1f575-1f3fb-2640", 1656, EmojiCode(0x1f575, 0x1f3fb, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman detective: medium-light skin tone",*/ "1f575-1f3fc-2640", 1657, EmojiCode(0x1f575, 0x1f3fc, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman detective: medium skin tone",*/ "1f575-1f3fd-2640", 1658, EmojiCode(0x1f575, 0x1f3fd, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman detective: medium-dark skin tone",*/ "1f575-1f3fe-2640", 1659, EmojiCode(0x1f575, 0x1f3fe, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman detective: dark skin tone",*/ "1f575-1f3ff-2640", 1660, EmojiCode(0x1f575, 0x1f3ff, 0x2640), EmojiCode(0x1f575, 0xfe0f, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man detective",*/ "1f575-2642", 1661, EmojiCode(0x1f575, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man detective: light skin tone",*/ "1f575-1f3fb-2642", 1662, EmojiCode(0x1f575, 0x1f3fb, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man detective: medium-light skin tone",*/ "1f575-1f3fc-2642", 1663, EmojiCode(0x1f575, 0x1f3fc, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man detective: medium skin tone",*/ "1f575-1f3fd-2642", 1664, EmojiCode(0x1f575, 0x1f3fd, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man detective: medium-dark skin tone",*/ "1f575-1f3fe-2642", 1665, EmojiCode(0x1f575, 0x1f3fe, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man detective: dark skin tone",*/ "1f575-1f3ff-2642", 1666, EmojiCode(0x1f575, 0x1f3ff, 0x2642), EmojiCode(0x1f575, 0xfe0f, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"woman health worker",*/ "1f469-2695", 1667, EmojiCode(0x1f469, 0x2695), EmojiCode(0x1f469, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"woman health worker: light skin tone",*/ "1f469-1f3fb-2695", 1668, EmojiCode(0x1f469, 0x1f3fb, 0x2695), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"woman health worker: medium-light skin tone",*/ "1f469-1f3fc-2695", 1669, EmojiCode(0x1f469, 0x1f3fc, 0x2695), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"woman health worker: medium skin tone",*/ "1f469-1f3fd-2695", 1670, EmojiCode(0x1f469, 0x1f3fd, 0x2695), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"woman health worker: medium-dark skin tone",*/ "1f469-1f3fe-2695", 1671, EmojiCode(0x1f469, 0x1f3fe, 0x2695), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"woman health worker: dark skin tone",*/ "1f469-1f3ff-2695", 1672, EmojiCode(0x1f469, 0x1f3ff, 0x2695), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"man health worker",*/ "1f468-2695", 1673, EmojiCode(0x1f468, 0x2695), EmojiCode(0x1f468, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"man health worker: light skin tone",*/ "1f468-1f3fb-2695", 1674, EmojiCode(0x1f468, 0x1f3fb, 0x2695), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"man health worker: medium-light skin tone",*/ "1f468-1f3fc-2695", 1675, EmojiCode(0x1f468, 0x1f3fc, 0x2695), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"man health worker: medium skin tone",*/ "1f468-1f3fd-2695", 1676, EmojiCode(0x1f468, 0x1f3fd, 0x2695), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"man health worker: medium-dark skin tone",*/ "1f468-1f3fe-2695", 1677, EmojiCode(0x1f468, 0x1f3fe, 0x2695), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"man health worker: dark skin tone",*/ "1f468-1f3ff-2695", 1678, EmojiCode(0x1f468, 0x1f3ff, 0x2695), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x2695, 0xfe0f)),
+        EmojiRecord("people", /*"woman farmer",*/ "1f469-1f33e", 1679, EmojiCode(0x1f469, 0x1f33e), EmojiCode(0x1f469, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"woman farmer: light skin tone",*/ "1f469-1f3fb-1f33e", 1680, EmojiCode(0x1f469, 0x1f3fb, 0x1f33e), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"woman farmer: medium-light skin tone",*/ "1f469-1f3fc-1f33e", 1681, EmojiCode(0x1f469, 0x1f3fc, 0x1f33e), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"woman farmer: medium skin tone",*/ "1f469-1f3fd-1f33e", 1682, EmojiCode(0x1f469, 0x1f3fd, 0x1f33e), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"woman farmer: medium-dark skin tone",*/ "1f469-1f3fe-1f33e", 1683, EmojiCode(0x1f469, 0x1f3fe, 0x1f33e), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"woman farmer: dark skin tone",*/ "1f469-1f3ff-1f33e", 1684, EmojiCode(0x1f469, 0x1f3ff, 0x1f33e), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"man farmer",*/ "1f468-1f33e", 1685, EmojiCode(0x1f468, 0x1f33e), EmojiCode(0x1f468, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"man farmer: light skin tone",*/ "1f468-1f3fb-1f33e", 1686, EmojiCode(0x1f468, 0x1f3fb, 0x1f33e), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"man farmer: medium-light skin tone",*/ "1f468-1f3fc-1f33e", 1687, EmojiCode(0x1f468, 0x1f3fc, 0x1f33e), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"man farmer: medium skin tone",*/ "1f468-1f3fd-1f33e", 1688, EmojiCode(0x1f468, 0x1f3fd, 0x1f33e), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"man farmer: medium-dark skin tone",*/ "1f468-1f3fe-1f33e", 1689, EmojiCode(0x1f468, 0x1f3fe, 0x1f33e), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"man farmer: dark skin tone",*/ "1f468-1f3ff-1f33e", 1690, EmojiCode(0x1f468, 0x1f3ff, 0x1f33e), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f33e)),
+        EmojiRecord("people", /*"woman cook",*/ "1f469-1f373", 1691, EmojiCode(0x1f469, 0x1f373), EmojiCode(0x1f469, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"woman cook: light skin tone",*/ "1f469-1f3fb-1f373", 1692, EmojiCode(0x1f469, 0x1f3fb, 0x1f373), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"woman cook: medium-light skin tone",*/ "1f469-1f3fc-1f373", 1693, EmojiCode(0x1f469, 0x1f3fc, 0x1f373), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"woman cook: medium skin tone",*/ "1f469-1f3fd-1f373", 1694, EmojiCode(0x1f469, 0x1f3fd, 0x1f373), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"woman cook: medium-dark skin tone",*/ "1f469-1f3fe-1f373", 1695, EmojiCode(0x1f469, 0x1f3fe, 0x1f373), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"woman cook: dark skin tone",*/ "1f469-1f3ff-1f373", 1696, EmojiCode(0x1f469, 0x1f3ff, 0x1f373), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"man cook",*/ "1f468-1f373", 1697, EmojiCode(0x1f468, 0x1f373), EmojiCode(0x1f468, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"man cook: light skin tone",*/ "1f468-1f3fb-1f373", 1698, EmojiCode(0x1f468, 0x1f3fb, 0x1f373), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"man cook: medium-light skin tone",*/ "1f468-1f3fc-1f373", 1699, EmojiCode(0x1f468, 0x1f3fc, 0x1f373), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"man cook: medium skin tone",*/ "1f468-1f3fd-1f373", 1700, EmojiCode(0x1f468, 0x1f3fd, 0x1f373), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"man cook: medium-dark skin tone",*/ "1f468-1f3fe-1f373", 1701, EmojiCode(0x1f468, 0x1f3fe, 0x1f373), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"man cook: dark skin tone",*/ "1f468-1f3ff-1f373", 1702, EmojiCode(0x1f468, 0x1f3ff, 0x1f373), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f373)),
+        EmojiRecord("people", /*"woman student",*/ "1f469-1f393", 1703, EmojiCode(0x1f469, 0x1f393), EmojiCode(0x1f469, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"woman student: light skin tone",*/ "1f469-1f3fb-1f393", 1704, EmojiCode(0x1f469, 0x1f3fb, 0x1f393), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"woman student: medium-light skin tone",*/ "1f469-1f3fc-1f393", 1705, EmojiCode(0x1f469, 0x1f3fc, 0x1f393), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"woman student: medium skin tone",*/ "1f469-1f3fd-1f393", 1706, EmojiCode(0x1f469, 0x1f3fd, 0x1f393), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"woman student: medium-dark skin tone",*/ "1f469-1f3fe-1f393", 1707, EmojiCode(0x1f469, 0x1f3fe, 0x1f393), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"woman student: dark skin tone",*/ "1f469-1f3ff-1f393", 1708, EmojiCode(0x1f469, 0x1f3ff, 0x1f393), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"man student",*/ "1f468-1f393", 1709, EmojiCode(0x1f468, 0x1f393), EmojiCode(0x1f468, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"man student: light skin tone",*/ "1f468-1f3fb-1f393", 1710, EmojiCode(0x1f468, 0x1f3fb, 0x1f393), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"man student: medium-light skin tone",*/ "1f468-1f3fc-1f393", 1711, EmojiCode(0x1f468, 0x1f3fc, 0x1f393), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"man student: medium skin tone",*/ "1f468-1f3fd-1f393", 1712, EmojiCode(0x1f468, 0x1f3fd, 0x1f393), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"man student: medium-dark skin tone",*/ "1f468-1f3fe-1f393", 1713, EmojiCode(0x1f468, 0x1f3fe, 0x1f393), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"man student: dark skin tone",*/ "1f468-1f3ff-1f393", 1714, EmojiCode(0x1f468, 0x1f3ff, 0x1f393), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f393)),
+        EmojiRecord("people", /*"woman singer",*/ "1f469-1f3a4", 1715, EmojiCode(0x1f469, 0x1f3a4), EmojiCode(0x1f469, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"woman singer: light skin tone",*/ "1f469-1f3fb-1f3a4", 1716, EmojiCode(0x1f469, 0x1f3fb, 0x1f3a4), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"woman singer: medium-light skin tone",*/ "1f469-1f3fc-1f3a4", 1717, EmojiCode(0x1f469, 0x1f3fc, 0x1f3a4), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"woman singer: medium skin tone",*/ "1f469-1f3fd-1f3a4", 1718, EmojiCode(0x1f469, 0x1f3fd, 0x1f3a4), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"woman singer: medium-dark skin tone",*/ "1f469-1f3fe-1f3a4", 1719, EmojiCode(0x1f469, 0x1f3fe, 0x1f3a4), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"woman singer: dark skin tone",*/ "1f469-1f3ff-1f3a4", 1720, EmojiCode(0x1f469, 0x1f3ff, 0x1f3a4), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"man singer",*/ "1f468-1f3a4", 1721, EmojiCode(0x1f468, 0x1f3a4), EmojiCode(0x1f468, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"man singer: light skin tone",*/ "1f468-1f3fb-1f3a4", 1722, EmojiCode(0x1f468, 0x1f3fb, 0x1f3a4), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"man singer: medium-light skin tone",*/ "1f468-1f3fc-1f3a4", 1723, EmojiCode(0x1f468, 0x1f3fc, 0x1f3a4), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"man singer: medium skin tone",*/ "1f468-1f3fd-1f3a4", 1724, EmojiCode(0x1f468, 0x1f3fd, 0x1f3a4), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"man singer: medium-dark skin tone",*/ "1f468-1f3fe-1f3a4", 1725, EmojiCode(0x1f468, 0x1f3fe, 0x1f3a4), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"man singer: dark skin tone",*/ "1f468-1f3ff-1f3a4", 1726, EmojiCode(0x1f468, 0x1f3ff, 0x1f3a4), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f3a4)),
+        EmojiRecord("people", /*"woman teacher",*/ "1f469-1f3eb", 1727, EmojiCode(0x1f469, 0x1f3eb), EmojiCode(0x1f469, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"woman teacher: light skin tone",*/ "1f469-1f3fb-1f3eb", 1728, EmojiCode(0x1f469, 0x1f3fb, 0x1f3eb), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"woman teacher: medium-light skin tone",*/ "1f469-1f3fc-1f3eb", 1729, EmojiCode(0x1f469, 0x1f3fc, 0x1f3eb), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"woman teacher: medium skin tone",*/ "1f469-1f3fd-1f3eb", 1730, EmojiCode(0x1f469, 0x1f3fd, 0x1f3eb), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"woman teacher: medium-dark skin tone",*/ "1f469-1f3fe-1f3eb", 1731, EmojiCode(0x1f469, 0x1f3fe, 0x1f3eb), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"woman teacher: dark skin tone",*/ "1f469-1f3ff-1f3eb", 1732, EmojiCode(0x1f469, 0x1f3ff, 0x1f3eb), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"man teacher",*/ "1f468-1f3eb", 1733, EmojiCode(0x1f468, 0x1f3eb), EmojiCode(0x1f468, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"man teacher: light skin tone",*/ "1f468-1f3fb-1f3eb", 1734, EmojiCode(0x1f468, 0x1f3fb, 0x1f3eb), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"man teacher: medium-light skin tone",*/ "1f468-1f3fc-1f3eb", 1735, EmojiCode(0x1f468, 0x1f3fc, 0x1f3eb), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"man teacher: medium skin tone",*/ "1f468-1f3fd-1f3eb", 1736, EmojiCode(0x1f468, 0x1f3fd, 0x1f3eb), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"man teacher: medium-dark skin tone",*/ "1f468-1f3fe-1f3eb", 1737, EmojiCode(0x1f468, 0x1f3fe, 0x1f3eb), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"man teacher: dark skin tone",*/ "1f468-1f3ff-1f3eb", 1738, EmojiCode(0x1f468, 0x1f3ff, 0x1f3eb), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f3eb)),
+        EmojiRecord("people", /*"woman factory worker",*/ "1f469-1f3ed", 1739, EmojiCode(0x1f469, 0x1f3ed), EmojiCode(0x1f469, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"woman factory worker: light skin tone",*/ "1f469-1f3fb-1f3ed", 1740, EmojiCode(0x1f469, 0x1f3fb, 0x1f3ed), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"woman factory worker: medium-light skin tone",*/ "1f469-1f3fc-1f3ed", 1741, EmojiCode(0x1f469, 0x1f3fc, 0x1f3ed), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"woman factory worker: medium skin tone",*/ "1f469-1f3fd-1f3ed", 1742, EmojiCode(0x1f469, 0x1f3fd, 0x1f3ed), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"woman factory worker: medium-dark skin tone",*/ "1f469-1f3fe-1f3ed", 1743, EmojiCode(0x1f469, 0x1f3fe, 0x1f3ed), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"woman factory worker: dark skin tone",*/ "1f469-1f3ff-1f3ed", 1744, EmojiCode(0x1f469, 0x1f3ff, 0x1f3ed), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"man factory worker",*/ "1f468-1f3ed", 1745, EmojiCode(0x1f468, 0x1f3ed), EmojiCode(0x1f468, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"man factory worker: light skin tone",*/ "1f468-1f3fb-1f3ed", 1746, EmojiCode(0x1f468, 0x1f3fb, 0x1f3ed), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"man factory worker: medium-light skin tone",*/ "1f468-1f3fc-1f3ed", 1747, EmojiCode(0x1f468, 0x1f3fc, 0x1f3ed), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"man factory worker: medium skin tone",*/ "1f468-1f3fd-1f3ed", 1748, EmojiCode(0x1f468, 0x1f3fd, 0x1f3ed), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"man factory worker: medium-dark skin tone",*/ "1f468-1f3fe-1f3ed", 1749, EmojiCode(0x1f468, 0x1f3fe, 0x1f3ed), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"man factory worker: dark skin tone",*/ "1f468-1f3ff-1f3ed", 1750, EmojiCode(0x1f468, 0x1f3ff, 0x1f3ed), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f3ed)),
+        EmojiRecord("people", /*"woman technologist",*/ "1f469-1f4bb", 1751, EmojiCode(0x1f469, 0x1f4bb), EmojiCode(0x1f469, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"woman technologist: light skin tone",*/ "1f469-1f3fb-1f4bb", 1752, EmojiCode(0x1f469, 0x1f3fb, 0x1f4bb), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"woman technologist: medium-light skin tone",*/ "1f469-1f3fc-1f4bb", 1753, EmojiCode(0x1f469, 0x1f3fc, 0x1f4bb), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"woman technologist: medium skin tone",*/ "1f469-1f3fd-1f4bb", 1754, EmojiCode(0x1f469, 0x1f3fd, 0x1f4bb), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"woman technologist: medium-dark skin tone",*/ "1f469-1f3fe-1f4bb", 1755, EmojiCode(0x1f469, 0x1f3fe, 0x1f4bb), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"woman technologist: dark skin tone",*/ "1f469-1f3ff-1f4bb", 1756, EmojiCode(0x1f469, 0x1f3ff, 0x1f4bb), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"man technologist",*/ "1f468-1f4bb", 1757, EmojiCode(0x1f468, 0x1f4bb), EmojiCode(0x1f468, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"man technologist: light skin tone",*/ "1f468-1f3fb-1f4bb", 1758, EmojiCode(0x1f468, 0x1f3fb, 0x1f4bb), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"man technologist: medium-light skin tone",*/ "1f468-1f3fc-1f4bb", 1759, EmojiCode(0x1f468, 0x1f3fc, 0x1f4bb), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"man technologist: medium skin tone",*/ "1f468-1f3fd-1f4bb", 1760, EmojiCode(0x1f468, 0x1f3fd, 0x1f4bb), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"man technologist: medium-dark skin tone",*/ "1f468-1f3fe-1f4bb", 1761, EmojiCode(0x1f468, 0x1f3fe, 0x1f4bb), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"man technologist: dark skin tone",*/ "1f468-1f3ff-1f4bb", 1762, EmojiCode(0x1f468, 0x1f3ff, 0x1f4bb), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f4bb)),
+        EmojiRecord("people", /*"woman office worker",*/ "1f469-1f4bc", 1763, EmojiCode(0x1f469, 0x1f4bc), EmojiCode(0x1f469, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"woman office worker: light skin tone",*/ "1f469-1f3fb-1f4bc", 1764, EmojiCode(0x1f469, 0x1f3fb, 0x1f4bc), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"woman office worker: medium-light skin tone",*/ "1f469-1f3fc-1f4bc", 1765, EmojiCode(0x1f469, 0x1f3fc, 0x1f4bc), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"woman office worker: medium skin tone",*/ "1f469-1f3fd-1f4bc", 1766, EmojiCode(0x1f469, 0x1f3fd, 0x1f4bc), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"woman office worker: medium-dark skin tone",*/ "1f469-1f3fe-1f4bc", 1767, EmojiCode(0x1f469, 0x1f3fe, 0x1f4bc), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"woman office worker: dark skin tone",*/ "1f469-1f3ff-1f4bc", 1768, EmojiCode(0x1f469, 0x1f3ff, 0x1f4bc), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"man office worker",*/ "1f468-1f4bc", 1769, EmojiCode(0x1f468, 0x1f4bc), EmojiCode(0x1f468, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"man office worker: light skin tone",*/ "1f468-1f3fb-1f4bc", 1770, EmojiCode(0x1f468, 0x1f3fb, 0x1f4bc), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"man office worker: medium-light skin tone",*/ "1f468-1f3fc-1f4bc", 1771, EmojiCode(0x1f468, 0x1f3fc, 0x1f4bc), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"man office worker: medium skin tone",*/ "1f468-1f3fd-1f4bc", 1772, EmojiCode(0x1f468, 0x1f3fd, 0x1f4bc), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"man office worker: medium-dark skin tone",*/ "1f468-1f3fe-1f4bc", 1773, EmojiCode(0x1f468, 0x1f3fe, 0x1f4bc), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"man office worker: dark skin tone",*/ "1f468-1f3ff-1f4bc", 1774, EmojiCode(0x1f468, 0x1f3ff, 0x1f4bc), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f4bc)),
+        EmojiRecord("people", /*"woman mechanic",*/ "1f469-1f527", 1775, EmojiCode(0x1f469, 0x1f527), EmojiCode(0x1f469, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"woman mechanic: light skin tone",*/ "1f469-1f3fb-1f527", 1776, EmojiCode(0x1f469, 0x1f3fb, 0x1f527), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"woman mechanic: medium-light skin tone",*/ "1f469-1f3fc-1f527", 1777, EmojiCode(0x1f469, 0x1f3fc, 0x1f527), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"woman mechanic: medium skin tone",*/ "1f469-1f3fd-1f527", 1778, EmojiCode(0x1f469, 0x1f3fd, 0x1f527), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"woman mechanic: medium-dark skin tone",*/ "1f469-1f3fe-1f527", 1779, EmojiCode(0x1f469, 0x1f3fe, 0x1f527), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"woman mechanic: dark skin tone",*/ "1f469-1f3ff-1f527", 1780, EmojiCode(0x1f469, 0x1f3ff, 0x1f527), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"man mechanic",*/ "1f468-1f527", 1781, EmojiCode(0x1f468, 0x1f527), EmojiCode(0x1f468, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"man mechanic: light skin tone",*/ "1f468-1f3fb-1f527", 1782, EmojiCode(0x1f468, 0x1f3fb, 0x1f527), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"man mechanic: medium-light skin tone",*/ "1f468-1f3fc-1f527", 1783, EmojiCode(0x1f468, 0x1f3fc, 0x1f527), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"man mechanic: medium skin tone",*/ "1f468-1f3fd-1f527", 1784, EmojiCode(0x1f468, 0x1f3fd, 0x1f527), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"man mechanic: medium-dark skin tone",*/ "1f468-1f3fe-1f527", 1785, EmojiCode(0x1f468, 0x1f3fe, 0x1f527), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"man mechanic: dark skin tone",*/ "1f468-1f3ff-1f527", 1786, EmojiCode(0x1f468, 0x1f3ff, 0x1f527), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f527)),
+        EmojiRecord("people", /*"woman scientist",*/ "1f469-1f52c", 1787, EmojiCode(0x1f469, 0x1f52c), EmojiCode(0x1f469, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"woman scientist: light skin tone",*/ "1f469-1f3fb-1f52c", 1788, EmojiCode(0x1f469, 0x1f3fb, 0x1f52c), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"woman scientist: medium-light skin tone",*/ "1f469-1f3fc-1f52c", 1789, EmojiCode(0x1f469, 0x1f3fc, 0x1f52c), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"woman scientist: medium skin tone",*/ "1f469-1f3fd-1f52c", 1790, EmojiCode(0x1f469, 0x1f3fd, 0x1f52c), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"woman scientist: medium-dark skin tone",*/ "1f469-1f3fe-1f52c", 1791, EmojiCode(0x1f469, 0x1f3fe, 0x1f52c), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"woman scientist: dark skin tone",*/ "1f469-1f3ff-1f52c", 1792, EmojiCode(0x1f469, 0x1f3ff, 0x1f52c), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"man scientist",*/ "1f468-1f52c", 1793, EmojiCode(0x1f468, 0x1f52c), EmojiCode(0x1f468, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"man scientist: light skin tone",*/ "1f468-1f3fb-1f52c", 1794, EmojiCode(0x1f468, 0x1f3fb, 0x1f52c), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"man scientist: medium-light skin tone",*/ "1f468-1f3fc-1f52c", 1795, EmojiCode(0x1f468, 0x1f3fc, 0x1f52c), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"man scientist: medium skin tone",*/ "1f468-1f3fd-1f52c", 1796, EmojiCode(0x1f468, 0x1f3fd, 0x1f52c), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"man scientist: medium-dark skin tone",*/ "1f468-1f3fe-1f52c", 1797, EmojiCode(0x1f468, 0x1f3fe, 0x1f52c), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"man scientist: dark skin tone",*/ "1f468-1f3ff-1f52c", 1798, EmojiCode(0x1f468, 0x1f3ff, 0x1f52c), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f52c)),
+        EmojiRecord("people", /*"woman artist",*/ "1f469-1f3a8", 1799, EmojiCode(0x1f469, 0x1f3a8), EmojiCode(0x1f469, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"woman artist: light skin tone",*/ "1f469-1f3fb-1f3a8", 1800, EmojiCode(0x1f469, 0x1f3fb, 0x1f3a8), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"woman artist: medium-light skin tone",*/ "1f469-1f3fc-1f3a8", 1801, EmojiCode(0x1f469, 0x1f3fc, 0x1f3a8), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"woman artist: medium skin tone",*/ "1f469-1f3fd-1f3a8", 1802, EmojiCode(0x1f469, 0x1f3fd, 0x1f3a8), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"woman artist: medium-dark skin tone",*/ "1f469-1f3fe-1f3a8", 1803, EmojiCode(0x1f469, 0x1f3fe, 0x1f3a8), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"woman artist: dark skin tone",*/ "1f469-1f3ff-1f3a8", 1804, EmojiCode(0x1f469, 0x1f3ff, 0x1f3a8), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"man artist",*/ "1f468-1f3a8", 1805, EmojiCode(0x1f468, 0x1f3a8), EmojiCode(0x1f468, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"man artist: light skin tone",*/ "1f468-1f3fb-1f3a8", 1806, EmojiCode(0x1f468, 0x1f3fb, 0x1f3a8), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"man artist: medium-light skin tone",*/ "1f468-1f3fc-1f3a8", 1807, EmojiCode(0x1f468, 0x1f3fc, 0x1f3a8), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"man artist: medium skin tone",*/ "1f468-1f3fd-1f3a8", 1808, EmojiCode(0x1f468, 0x1f3fd, 0x1f3a8), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"man artist: medium-dark skin tone",*/ "1f468-1f3fe-1f3a8", 1809, EmojiCode(0x1f468, 0x1f3fe, 0x1f3a8), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"man artist: dark skin tone",*/ "1f468-1f3ff-1f3a8", 1810, EmojiCode(0x1f468, 0x1f3ff, 0x1f3a8), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f3a8)),
+        EmojiRecord("people", /*"woman firefighter",*/ "1f469-1f692", 1811, EmojiCode(0x1f469, 0x1f692), EmojiCode(0x1f469, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"woman firefighter: light skin tone",*/ "1f469-1f3fb-1f692", 1812, EmojiCode(0x1f469, 0x1f3fb, 0x1f692), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"woman firefighter: medium-light skin tone",*/ "1f469-1f3fc-1f692", 1813, EmojiCode(0x1f469, 0x1f3fc, 0x1f692), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"woman firefighter: medium skin tone",*/ "1f469-1f3fd-1f692", 1814, EmojiCode(0x1f469, 0x1f3fd, 0x1f692), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"woman firefighter: medium-dark skin tone",*/ "1f469-1f3fe-1f692", 1815, EmojiCode(0x1f469, 0x1f3fe, 0x1f692), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"woman firefighter: dark skin tone",*/ "1f469-1f3ff-1f692", 1816, EmojiCode(0x1f469, 0x1f3ff, 0x1f692), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"man firefighter",*/ "1f468-1f692", 1817, EmojiCode(0x1f468, 0x1f692), EmojiCode(0x1f468, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"man firefighter: light skin tone",*/ "1f468-1f3fb-1f692", 1818, EmojiCode(0x1f468, 0x1f3fb, 0x1f692), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"man firefighter: medium-light skin tone",*/ "1f468-1f3fc-1f692", 1819, EmojiCode(0x1f468, 0x1f3fc, 0x1f692), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"man firefighter: medium skin tone",*/ "1f468-1f3fd-1f692", 1820, EmojiCode(0x1f468, 0x1f3fd, 0x1f692), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"man firefighter: medium-dark skin tone",*/ "1f468-1f3fe-1f692", 1821, EmojiCode(0x1f468, 0x1f3fe, 0x1f692), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"man firefighter: dark skin tone",*/ "1f468-1f3ff-1f692", 1822, EmojiCode(0x1f468, 0x1f3ff, 0x1f692), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f692)),
+        EmojiRecord("people", /*"woman pilot",*/ "1f469-2708", 1823, EmojiCode(0x1f469, 0x2708), EmojiCode(0x1f469, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"woman pilot: light skin tone",*/ "1f469-1f3fb-2708", 1824, EmojiCode(0x1f469, 0x1f3fb, 0x2708), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"woman pilot: medium-light skin tone",*/ "1f469-1f3fc-2708", 1825, EmojiCode(0x1f469, 0x1f3fc, 0x2708), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"woman pilot: medium skin tone",*/ "1f469-1f3fd-2708", 1826, EmojiCode(0x1f469, 0x1f3fd, 0x2708), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"woman pilot: medium-dark skin tone",*/ "1f469-1f3fe-2708", 1827, EmojiCode(0x1f469, 0x1f3fe, 0x2708), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"woman pilot: dark skin tone",*/ "1f469-1f3ff-2708", 1828, EmojiCode(0x1f469, 0x1f3ff, 0x2708), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"man pilot",*/ "1f468-2708", 1829, EmojiCode(0x1f468, 0x2708), EmojiCode(0x1f468, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"man pilot: light skin tone",*/ "1f468-1f3fb-2708", 1830, EmojiCode(0x1f468, 0x1f3fb, 0x2708), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"man pilot: medium-light skin tone",*/ "1f468-1f3fc-2708", 1831, EmojiCode(0x1f468, 0x1f3fc, 0x2708), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"man pilot: medium skin tone",*/ "1f468-1f3fd-2708", 1832, EmojiCode(0x1f468, 0x1f3fd, 0x2708), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"man pilot: medium-dark skin tone",*/ "1f468-1f3fe-2708", 1833, EmojiCode(0x1f468, 0x1f3fe, 0x2708), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"man pilot: dark skin tone",*/ "1f468-1f3ff-2708", 1834, EmojiCode(0x1f468, 0x1f3ff, 0x2708), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x2708, 0xfe0f)),
+        EmojiRecord("people", /*"woman astronaut",*/ "1f469-1f680", 1835, EmojiCode(0x1f469, 0x1f680), EmojiCode(0x1f469, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"woman astronaut: light skin tone",*/ "1f469-1f3fb-1f680", 1836, EmojiCode(0x1f469, 0x1f3fb, 0x1f680), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"woman astronaut: medium-light skin tone",*/ "1f469-1f3fc-1f680", 1837, EmojiCode(0x1f469, 0x1f3fc, 0x1f680), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"woman astronaut: medium skin tone",*/ "1f469-1f3fd-1f680", 1838, EmojiCode(0x1f469, 0x1f3fd, 0x1f680), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"woman astronaut: medium-dark skin tone",*/ "1f469-1f3fe-1f680", 1839, EmojiCode(0x1f469, 0x1f3fe, 0x1f680), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"woman astronaut: dark skin tone",*/ "1f469-1f3ff-1f680", 1840, EmojiCode(0x1f469, 0x1f3ff, 0x1f680), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"man astronaut",*/ "1f468-1f680", 1841, EmojiCode(0x1f468, 0x1f680), EmojiCode(0x1f468, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"man astronaut: light skin tone",*/ "1f468-1f3fb-1f680", 1842, EmojiCode(0x1f468, 0x1f3fb, 0x1f680), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"man astronaut: medium-light skin tone",*/ "1f468-1f3fc-1f680", 1843, EmojiCode(0x1f468, 0x1f3fc, 0x1f680), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"man astronaut: medium skin tone",*/ "1f468-1f3fd-1f680", 1844, EmojiCode(0x1f468, 0x1f3fd, 0x1f680), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"man astronaut: medium-dark skin tone",*/ "1f468-1f3fe-1f680", 1845, EmojiCode(0x1f468, 0x1f3fe, 0x1f680), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"man astronaut: dark skin tone",*/ "1f468-1f3ff-1f680", 1846, EmojiCode(0x1f468, 0x1f3ff, 0x1f680), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x1f680)),
+        EmojiRecord("people", /*"woman judge",*/ "1f469-2696", 1847, EmojiCode(0x1f469, 0x2696), EmojiCode(0x1f469, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"woman judge: light skin tone",*/ "1f469-1f3fb-2696", 1848, EmojiCode(0x1f469, 0x1f3fb, 0x2696), EmojiCode(0x1f469, 0x1f3fb, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"woman judge: medium-light skin tone",*/ "1f469-1f3fc-2696", 1849, EmojiCode(0x1f469, 0x1f3fc, 0x2696), EmojiCode(0x1f469, 0x1f3fc, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"woman judge: medium skin tone",*/ "1f469-1f3fd-2696", 1850, EmojiCode(0x1f469, 0x1f3fd, 0x2696), EmojiCode(0x1f469, 0x1f3fd, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"woman judge: medium-dark skin tone",*/ "1f469-1f3fe-2696", 1851, EmojiCode(0x1f469, 0x1f3fe, 0x2696), EmojiCode(0x1f469, 0x1f3fe, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"woman judge: dark skin tone",*/ "1f469-1f3ff-2696", 1852, EmojiCode(0x1f469, 0x1f3ff, 0x2696), EmojiCode(0x1f469, 0x1f3ff, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"man judge",*/ "1f468-2696", 1853, EmojiCode(0x1f468, 0x2696), EmojiCode(0x1f468, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"man judge: light skin tone",*/ "1f468-1f3fb-2696", 1854, EmojiCode(0x1f468, 0x1f3fb, 0x2696), EmojiCode(0x1f468, 0x1f3fb, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"man judge: medium-light skin tone",*/ "1f468-1f3fc-2696", 1855, EmojiCode(0x1f468, 0x1f3fc, 0x2696), EmojiCode(0x1f468, 0x1f3fc, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"man judge: medium skin tone",*/ "1f468-1f3fd-2696", 1856, EmojiCode(0x1f468, 0x1f3fd, 0x2696), EmojiCode(0x1f468, 0x1f3fd, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"man judge: medium-dark skin tone",*/ "1f468-1f3fe-2696", 1857, EmojiCode(0x1f468, 0x1f3fe, 0x2696), EmojiCode(0x1f468, 0x1f3fe, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"man judge: dark skin tone",*/ "1f468-1f3ff-2696", 1858, EmojiCode(0x1f468, 0x1f3ff, 0x2696), EmojiCode(0x1f468, 0x1f3ff, 0x200d, 0x2696, 0xfe0f)),
+        EmojiRecord("people", /*"bride with veil",*/ "1f470", 1859, EmojiCode(0x1f470)),
+        EmojiRecord("people", /*"bride with veil: light skin tone",*/ "1f470-1f3fb", 1860, EmojiCode(0x1f470, 0x1f3fb)),
+        EmojiRecord("people", /*"bride with veil: medium-light skin tone",*/ "1f470-1f3fc", 1861, EmojiCode(0x1f470, 0x1f3fc)),
+        EmojiRecord("people", /*"bride with veil: medium skin tone",*/ "1f470-1f3fd", 1862, EmojiCode(0x1f470, 0x1f3fd)),
+        EmojiRecord("people", /*"bride with veil: medium-dark skin tone",*/ "1f470-1f3fe", 1863, EmojiCode(0x1f470, 0x1f3fe)),
+        EmojiRecord("people", /*"bride with veil: dark skin tone",*/ "1f470-1f3ff", 1864, EmojiCode(0x1f470, 0x1f3ff)),
+        EmojiRecord("people", /*"man in tuxedo",*/ "1f935", 1865, EmojiCode(0x1f935)),
+        EmojiRecord("people", /*"man in tuxedo: light skin tone",*/ "1f935-1f3fb", 1866, EmojiCode(0x1f935, 0x1f3fb)),
+        EmojiRecord("people", /*"man in tuxedo: medium-light skin tone",*/ "1f935-1f3fc", 1867, EmojiCode(0x1f935, 0x1f3fc)),
+        EmojiRecord("people", /*"man in tuxedo: medium skin tone",*/ "1f935-1f3fd", 1868, EmojiCode(0x1f935, 0x1f3fd)),
+        EmojiRecord("people", /*"man in tuxedo: medium-dark skin tone",*/ "1f935-1f3fe", 1869, EmojiCode(0x1f935, 0x1f3fe)),
+        EmojiRecord("people", /*"man in tuxedo: dark skin tone",*/ "1f935-1f3ff", 1870, EmojiCode(0x1f935, 0x1f3ff)),
+        EmojiRecord("people", /*"princess",*/ "1f478", 1871, EmojiCode(0x1f478)),
+        EmojiRecord("people", /*"princess: light skin tone",*/ "1f478-1f3fb", 1872, EmojiCode(0x1f478, 0x1f3fb)),
+        EmojiRecord("people", /*"princess: medium-light skin tone",*/ "1f478-1f3fc", 1873, EmojiCode(0x1f478, 0x1f3fc)),
+        EmojiRecord("people", /*"princess: medium skin tone",*/ "1f478-1f3fd", 1874, EmojiCode(0x1f478, 0x1f3fd)),
+        EmojiRecord("people", /*"princess: medium-dark skin tone",*/ "1f478-1f3fe", 1875, EmojiCode(0x1f478, 0x1f3fe)),
+        EmojiRecord("people", /*"princess: dark skin tone",*/ "1f478-1f3ff", 1876, EmojiCode(0x1f478, 0x1f3ff)),
+        EmojiRecord("people", /*"prince",*/ "1f934", 1877, EmojiCode(0x1f934)),
+        EmojiRecord("people", /*"prince: light skin tone",*/ "1f934-1f3fb", 1878, EmojiCode(0x1f934, 0x1f3fb)),
+        EmojiRecord("people", /*"prince: medium-light skin tone",*/ "1f934-1f3fc", 1879, EmojiCode(0x1f934, 0x1f3fc)),
+        EmojiRecord("people", /*"prince: medium skin tone",*/ "1f934-1f3fd", 1880, EmojiCode(0x1f934, 0x1f3fd)),
+        EmojiRecord("people", /*"prince: medium-dark skin tone",*/ "1f934-1f3fe", 1881, EmojiCode(0x1f934, 0x1f3fe)),
+        EmojiRecord("people", /*"prince: dark skin tone",*/ "1f934-1f3ff", 1882, EmojiCode(0x1f934, 0x1f3ff)),
+        EmojiRecord("people", /*"Mrs. Claus",*/ "1f936", 1883, EmojiCode(0x1f936)),
+        EmojiRecord("people", /*"Mrs. Claus: light skin tone",*/ "1f936-1f3fb", 1884, EmojiCode(0x1f936, 0x1f3fb)),
+        EmojiRecord("people", /*"Mrs. Claus: medium skin tone",*/ "1f936-1f3fd", 1885, EmojiCode(0x1f936, 0x1f3fd)),
+        EmojiRecord("people", /*"Mrs. Claus: medium-light skin tone",*/ "1f936-1f3fc", 1886, EmojiCode(0x1f936, 0x1f3fc)),
+        EmojiRecord("people", /*"Mrs. Claus: medium-dark skin tone",*/ "1f936-1f3fe", 1887, EmojiCode(0x1f936, 0x1f3fe)),
+        EmojiRecord("people", /*"Mrs. Claus: dark skin tone",*/ "1f936-1f3ff", 1888, EmojiCode(0x1f936, 0x1f3ff)),
+        EmojiRecord("people", /*"Santa Claus",*/ "1f385", 1889, EmojiCode(0x1f385)),
+        EmojiRecord("people", /*"Santa Claus: light skin tone",*/ "1f385-1f3fb", 1890, EmojiCode(0x1f385, 0x1f3fb)),
+        EmojiRecord("people", /*"Santa Claus: medium-light skin tone",*/ "1f385-1f3fc", 1891, EmojiCode(0x1f385, 0x1f3fc)),
+        EmojiRecord("people", /*"Santa Claus: medium skin tone",*/ "1f385-1f3fd", 1892, EmojiCode(0x1f385, 0x1f3fd)),
+        EmojiRecord("people", /*"Santa Claus: medium-dark skin tone",*/ "1f385-1f3fe", 1893, EmojiCode(0x1f385, 0x1f3fe)),
+        EmojiRecord("people", /*"Santa Claus: dark skin tone",*/ "1f385-1f3ff", 1894, EmojiCode(0x1f385, 0x1f3ff)),
+        EmojiRecord("people", /*"superhero",*/ "1f9b8", 1895, EmojiCode(0x1f9b8)),
+        EmojiRecord("people", /*"superhero: light skin tone",*/ "1f9b8-1f3fb", 1896, EmojiCode(0x1f9b8, 0x1f3fb)),
+        EmojiRecord("people", /*"superhero: medium-light skin tone",*/ "1f9b8-1f3fc", 1897, EmojiCode(0x1f9b8, 0x1f3fc)),
+        EmojiRecord("people", /*"superhero: medium skin tone",*/ "1f9b8-1f3fd", 1898, EmojiCode(0x1f9b8, 0x1f3fd)),
+        EmojiRecord("people", /*"superhero: medium-dark skin tone",*/ "1f9b8-1f3fe", 1899, EmojiCode(0x1f9b8, 0x1f3fe)),
+        EmojiRecord("people", /*"superhero: dark skin tone",*/ "1f9b8-1f3ff", 1900, EmojiCode(0x1f9b8, 0x1f3ff)),
+        EmojiRecord("people", /*"woman superhero",*/ "1f9b8-2640", 1901, EmojiCode(0x1f9b8, 0x2640), EmojiCode(0x1f9b8, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman superhero: light skin tone",*/ "1f9b8-1f3fb-2640", 1902, EmojiCode(0x1f9b8, 0x1f3fb, 0x2640), EmojiCode(0x1f9b8, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman superhero: medium-light skin tone",*/ "1f9b8-1f3fc-2640", 1903, EmojiCode(0x1f9b8, 0x1f3fc, 0x2640), EmojiCode(0x1f9b8, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman superhero: medium skin tone",*/ "1f9b8-1f3fd-2640", 1904, EmojiCode(0x1f9b8, 0x1f3fd, 0x2640), EmojiCode(0x1f9b8, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman superhero: medium-dark skin tone",*/ "1f9b8-1f3fe-2640", 1905, EmojiCode(0x1f9b8, 0x1f3fe, 0x2640), EmojiCode(0x1f9b8, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman superhero: dark skin tone",*/ "1f9b8-1f3ff-2640", 1906, EmojiCode(0x1f9b8, 0x1f3ff, 0x2640), EmojiCode(0x1f9b8, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man superhero",*/ "1f9b8-2642", 1907, EmojiCode(0x1f9b8, 0x2642), EmojiCode(0x1f9b8, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man superhero: light skin tone",*/ "1f9b8-1f3fb-2642", 1908, EmojiCode(0x1f9b8, 0x1f3fb, 0x2642), EmojiCode(0x1f9b8, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man superhero: medium-light skin tone",*/ "1f9b8-1f3fc-2642", 1909, EmojiCode(0x1f9b8, 0x1f3fc, 0x2642), EmojiCode(0x1f9b8, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man superhero: medium skin tone",*/ "1f9b8-1f3fd-2642", 1910, EmojiCode(0x1f9b8, 0x1f3fd, 0x2642), EmojiCode(0x1f9b8, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man superhero: medium-dark skin tone",*/ "1f9b8-1f3fe-2642", 1911, EmojiCode(0x1f9b8, 0x1f3fe, 0x2642), EmojiCode(0x1f9b8, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man superhero: dark skin tone",*/ "1f9b8-1f3ff-2642", 1912, EmojiCode(0x1f9b8, 0x1f3ff, 0x2642), EmojiCode(0x1f9b8, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"supervillain",*/ "1f9b9", 1913, EmojiCode(0x1f9b9)),
+        EmojiRecord("people", /*"supervillain: light skin tone",*/ "1f9b9-1f3fb", 1914, EmojiCode(0x1f9b9, 0x1f3fb)),
+        EmojiRecord("people", /*"supervillain: medium-light skin tone",*/ "1f9b9-1f3fc", 1915, EmojiCode(0x1f9b9, 0x1f3fc)),
+        EmojiRecord("people", /*"supervillain: medium skin tone",*/ "1f9b9-1f3fd", 1916, EmojiCode(0x1f9b9, 0x1f3fd)),
+        EmojiRecord("people", /*"supervillain: medium-dark skin tone",*/ "1f9b9-1f3fe", 1917, EmojiCode(0x1f9b9, 0x1f3fe)),
+        EmojiRecord("people", /*"supervillain: dark skin tone",*/ "1f9b9-1f3ff", 1918, EmojiCode(0x1f9b9, 0x1f3ff)),
+        EmojiRecord("people", /*"woman supervillain: light skin tone",*/ "1f9b9-1f3fb-2640", 1919, EmojiCode(0x1f9b9, 0x1f3fb, 0x2640), EmojiCode(0x1f9b9, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman supervillain",*/ "1f9b9-2640", 1920, EmojiCode(0x1f9b9, 0x2640), EmojiCode(0x1f9b9, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman supervillain: medium-light skin tone",*/ "1f9b9-1f3fc-2640", 1921, EmojiCode(0x1f9b9, 0x1f3fc, 0x2640), EmojiCode(0x1f9b9, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman supervillain: medium skin tone",*/ "1f9b9-1f3fd-2640", 1922, EmojiCode(0x1f9b9, 0x1f3fd, 0x2640), EmojiCode(0x1f9b9, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman supervillain: medium-dark skin tone",*/ "1f9b9-1f3fe-2640", 1923, EmojiCode(0x1f9b9, 0x1f3fe, 0x2640), EmojiCode(0x1f9b9, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman supervillain: dark skin tone",*/ "1f9b9-1f3ff-2640", 1924, EmojiCode(0x1f9b9, 0x1f3ff, 0x2640), EmojiCode(0x1f9b9, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man supervillain",*/ "1f9b9-2642", 1925, EmojiCode(0x1f9b9, 0x2642), EmojiCode(0x1f9b9, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man supervillain: light skin tone",*/ "1f9b9-1f3fb-2642", 1926, EmojiCode(0x1f9b9, 0x1f3fb, 0x2642), EmojiCode(0x1f9b9, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man supervillain: medium-light skin tone",*/ "1f9b9-1f3fc-2642", 1927, EmojiCode(0x1f9b9, 0x1f3fc, 0x2642), EmojiCode(0x1f9b9, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man supervillain: medium skin tone",*/ "1f9b9-1f3fd-2642", 1928, EmojiCode(0x1f9b9, 0x1f3fd, 0x2642), EmojiCode(0x1f9b9, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man supervillain: medium-dark skin tone",*/ "1f9b9-1f3fe-2642", 1929, EmojiCode(0x1f9b9, 0x1f3fe, 0x2642), EmojiCode(0x1f9b9, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man supervillain: dark skin tone",*/ "1f9b9-1f3ff-2642", 1930, EmojiCode(0x1f9b9, 0x1f3ff, 0x2642), EmojiCode(0x1f9b9, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"mage",*/ "1f9d9", 1931, EmojiCode(0x1f9d9)),
+        EmojiRecord("people", /*"mage: light skin tone",*/ "1f9d9-1f3fb", 1932, EmojiCode(0x1f9d9, 0x1f3fb)),
+        EmojiRecord("people", /*"mage: medium-light skin tone",*/ "1f9d9-1f3fc", 1933, EmojiCode(0x1f9d9, 0x1f3fc)),
+        EmojiRecord("people", /*"mage: medium skin tone",*/ "1f9d9-1f3fd", 1934, EmojiCode(0x1f9d9, 0x1f3fd)),
+        EmojiRecord("people", /*"mage: medium-dark skin tone",*/ "1f9d9-1f3fe", 1935, EmojiCode(0x1f9d9, 0x1f3fe)),
+        EmojiRecord("people", /*"mage: dark skin tone",*/ "1f9d9-1f3ff", 1936, EmojiCode(0x1f9d9, 0x1f3ff)),
+        EmojiRecord("people", /*"woman mage",*/ "1f9d9-2640", 1937, EmojiCode(0x1f9d9, 0x2640), EmojiCode(0x1f9d9, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman mage: light skin tone",*/ "1f9d9-1f3fb-2640", 1938, EmojiCode(0x1f9d9, 0x1f3fb, 0x2640), EmojiCode(0x1f9d9, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman mage: medium-light skin tone",*/ "1f9d9-1f3fc-2640", 1939, EmojiCode(0x1f9d9, 0x1f3fc, 0x2640), EmojiCode(0x1f9d9, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman mage: medium skin tone",*/ "1f9d9-1f3fd-2640", 1940, EmojiCode(0x1f9d9, 0x1f3fd, 0x2640), EmojiCode(0x1f9d9, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman mage: medium-dark skin tone",*/ "1f9d9-1f3fe-2640", 1941, EmojiCode(0x1f9d9, 0x1f3fe, 0x2640), EmojiCode(0x1f9d9, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman mage: dark skin tone",*/ "1f9d9-1f3ff-2640", 1942, EmojiCode(0x1f9d9, 0x1f3ff, 0x2640), EmojiCode(0x1f9d9, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man mage",*/ "1f9d9-2642", 1943, EmojiCode(0x1f9d9, 0x2642), EmojiCode(0x1f9d9, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man mage: light skin tone",*/ "1f9d9-1f3fb-2642", 1944, EmojiCode(0x1f9d9, 0x1f3fb, 0x2642), EmojiCode(0x1f9d9, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man mage: medium-light skin tone",*/ "1f9d9-1f3fc-2642", 1945, EmojiCode(0x1f9d9, 0x1f3fc, 0x2642), EmojiCode(0x1f9d9, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man mage: medium skin tone",*/ "1f9d9-1f3fd-2642", 1946, EmojiCode(0x1f9d9, 0x1f3fd, 0x2642), EmojiCode(0x1f9d9, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man mage: medium-dark skin tone",*/ "1f9d9-1f3fe-2642", 1947, EmojiCode(0x1f9d9, 0x1f3fe, 0x2642), EmojiCode(0x1f9d9, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man mage: dark skin tone",*/ "1f9d9-1f3ff-2642", 1948, EmojiCode(0x1f9d9, 0x1f3ff, 0x2642), EmojiCode(0x1f9d9, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"elf",*/ "1f9dd", 1949, EmojiCode(0x1f9dd)),
+        EmojiRecord("people", /*"elf: light skin tone",*/ "1f9dd-1f3fb", 1950, EmojiCode(0x1f9dd, 0x1f3fb)),
+        EmojiRecord("people", /*"elf: medium-light skin tone",*/ "1f9dd-1f3fc", 1951, EmojiCode(0x1f9dd, 0x1f3fc)),
+        EmojiRecord("people", /*"elf: medium skin tone",*/ "1f9dd-1f3fd", 1952, EmojiCode(0x1f9dd, 0x1f3fd)),
+        EmojiRecord("people", /*"elf: medium-dark skin tone",*/ "1f9dd-1f3fe", 1953, EmojiCode(0x1f9dd, 0x1f3fe)),
+        EmojiRecord("people", /*"elf: dark skin tone",*/ "1f9dd-1f3ff", 1954, EmojiCode(0x1f9dd, 0x1f3ff)),
+        EmojiRecord("people", /*"woman elf",*/ "1f9dd-2640", 1955, EmojiCode(0x1f9dd, 0x2640), EmojiCode(0x1f9dd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman elf: light skin tone",*/ "1f9dd-1f3fb-2640", 1956, EmojiCode(0x1f9dd, 0x1f3fb, 0x2640), EmojiCode(0x1f9dd, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman elf: medium-light skin tone",*/ "1f9dd-1f3fc-2640", 1957, EmojiCode(0x1f9dd, 0x1f3fc, 0x2640), EmojiCode(0x1f9dd, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman elf: medium skin tone",*/ "1f9dd-1f3fd-2640", 1958, EmojiCode(0x1f9dd, 0x1f3fd, 0x2640), EmojiCode(0x1f9dd, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman elf: medium-dark skin tone",*/ "1f9dd-1f3fe-2640", 1959, EmojiCode(0x1f9dd, 0x1f3fe, 0x2640), EmojiCode(0x1f9dd, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman elf: dark skin tone",*/ "1f9dd-1f3ff-2640", 1960, EmojiCode(0x1f9dd, 0x1f3ff, 0x2640), EmojiCode(0x1f9dd, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man elf",*/ "1f9dd-2642", 1961, EmojiCode(0x1f9dd, 0x2642), EmojiCode(0x1f9dd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man elf: light skin tone",*/ "1f9dd-1f3fb-2642", 1962, EmojiCode(0x1f9dd, 0x1f3fb, 0x2642), EmojiCode(0x1f9dd, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man elf: medium-light skin tone",*/ "1f9dd-1f3fc-2642", 1963, EmojiCode(0x1f9dd, 0x1f3fc, 0x2642), EmojiCode(0x1f9dd, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man elf: medium skin tone",*/ "1f9dd-1f3fd-2642", 1964, EmojiCode(0x1f9dd, 0x1f3fd, 0x2642), EmojiCode(0x1f9dd, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man elf: medium-dark skin tone",*/ "1f9dd-1f3fe-2642", 1965, EmojiCode(0x1f9dd, 0x1f3fe, 0x2642), EmojiCode(0x1f9dd, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man elf: dark skin tone",*/ "1f9dd-1f3ff-2642", 1966, EmojiCode(0x1f9dd, 0x1f3ff, 0x2642), EmojiCode(0x1f9dd, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"vampire",*/ "1f9db", 1967, EmojiCode(0x1f9db)),
+        EmojiRecord("people", /*"vampire: light skin tone",*/ "1f9db-1f3fb", 1968, EmojiCode(0x1f9db, 0x1f3fb)),
+        EmojiRecord("people", /*"vampire: medium-light skin tone",*/ "1f9db-1f3fc", 1969, EmojiCode(0x1f9db, 0x1f3fc)),
+        EmojiRecord("people", /*"vampire: medium skin tone",*/ "1f9db-1f3fd", 1970, EmojiCode(0x1f9db, 0x1f3fd)),
+        EmojiRecord("people", /*"vampire: medium-dark skin tone",*/ "1f9db-1f3fe", 1971, EmojiCode(0x1f9db, 0x1f3fe)),
+        EmojiRecord("people", /*"vampire: dark skin tone",*/ "1f9db-1f3ff", 1972, EmojiCode(0x1f9db, 0x1f3ff)),
+        EmojiRecord("people", /*"woman vampire",*/ "1f9db-2640", 1973, EmojiCode(0x1f9db, 0x2640), EmojiCode(0x1f9db, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman vampire: light skin tone",*/ "1f9db-1f3fb-2640", 1974, EmojiCode(0x1f9db, 0x1f3fb, 0x2640), EmojiCode(0x1f9db, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman vampire: medium-light skin tone",*/ "1f9db-1f3fc-2640", 1975, EmojiCode(0x1f9db, 0x1f3fc, 0x2640), EmojiCode(0x1f9db, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman vampire: medium skin tone",*/ "1f9db-1f3fd-2640", 1976, EmojiCode(0x1f9db, 0x1f3fd, 0x2640), EmojiCode(0x1f9db, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman vampire: medium-dark skin tone",*/ "1f9db-1f3fe-2640", 1977, EmojiCode(0x1f9db, 0x1f3fe, 0x2640), EmojiCode(0x1f9db, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman vampire: dark skin tone",*/ "1f9db-1f3ff-2640", 1978, EmojiCode(0x1f9db, 0x1f3ff, 0x2640), EmojiCode(0x1f9db, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man vampire",*/ "1f9db-2642", 1979, EmojiCode(0x1f9db, 0x2642), EmojiCode(0x1f9db, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man vampire: light skin tone",*/ "1f9db-1f3fb-2642", 1980, EmojiCode(0x1f9db, 0x1f3fb, 0x2642), EmojiCode(0x1f9db, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man vampire: medium-light skin tone",*/ "1f9db-1f3fc-2642", 1981, EmojiCode(0x1f9db, 0x1f3fc, 0x2642), EmojiCode(0x1f9db, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man vampire: medium skin tone",*/ "1f9db-1f3fd-2642", 1982, EmojiCode(0x1f9db, 0x1f3fd, 0x2642), EmojiCode(0x1f9db, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man vampire: medium-dark skin tone",*/ "1f9db-1f3fe-2642", 1983, EmojiCode(0x1f9db, 0x1f3fe, 0x2642), EmojiCode(0x1f9db, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man vampire: dark skin tone",*/ "1f9db-1f3ff-2642", 1984, EmojiCode(0x1f9db, 0x1f3ff, 0x2642), EmojiCode(0x1f9db, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"zombie",*/ "1f9df", 1985, EmojiCode(0x1f9df)),
+        EmojiRecord("people", /*"woman zombie",*/ "1f9df-2640", 1986, EmojiCode(0x1f9df, 0x2640), EmojiCode(0x1f9df, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man zombie",*/ "1f9df-2642", 1987, EmojiCode(0x1f9df, 0x2642), EmojiCode(0x1f9df, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"genie",*/ "1f9de", 1988, EmojiCode(0x1f9de)),
+        EmojiRecord("people", /*"woman genie",*/ "1f9de-2640", 1989, EmojiCode(0x1f9de, 0x2640), EmojiCode(0x1f9de, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man genie",*/ "1f9de-2642", 1990, EmojiCode(0x1f9de, 0x2642), EmojiCode(0x1f9de, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"merperson",*/ "1f9dc", 1991, EmojiCode(0x1f9dc)),
+        EmojiRecord("people", /*"merperson: light skin tone",*/ "1f9dc-1f3fb", 1992, EmojiCode(0x1f9dc, 0x1f3fb)),
+        EmojiRecord("people", /*"merperson: medium-light skin tone",*/ "1f9dc-1f3fc", 1993, EmojiCode(0x1f9dc, 0x1f3fc)),
+        EmojiRecord("people", /*"merperson: medium skin tone",*/ "1f9dc-1f3fd", 1994, EmojiCode(0x1f9dc, 0x1f3fd)),
+        EmojiRecord("people", /*"merperson: medium-dark skin tone",*/ "1f9dc-1f3fe", 1995, EmojiCode(0x1f9dc, 0x1f3fe)),
+        EmojiRecord("people", /*"merperson: dark skin tone",*/ "1f9dc-1f3ff", 1996, EmojiCode(0x1f9dc, 0x1f3ff)),
+        EmojiRecord("people", /*"mermaid",*/ "1f9dc-2640", 1997, EmojiCode(0x1f9dc, 0x2640), EmojiCode(0x1f9dc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"mermaid: light skin tone",*/ "1f9dc-1f3fb-2640", 1998, EmojiCode(0x1f9dc, 0x1f3fb, 0x2640), EmojiCode(0x1f9dc, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"mermaid: medium-light skin tone",*/ "1f9dc-1f3fc-2640", 1999, EmojiCode(0x1f9dc, 0x1f3fc, 0x2640), EmojiCode(0x1f9dc, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"mermaid: medium skin tone",*/ "1f9dc-1f3fd-2640", 2000, EmojiCode(0x1f9dc, 0x1f3fd, 0x2640), EmojiCode(0x1f9dc, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"mermaid: medium-dark skin tone",*/ "1f9dc-1f3fe-2640", 2001, EmojiCode(0x1f9dc, 0x1f3fe, 0x2640), EmojiCode(0x1f9dc, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"mermaid: dark skin tone",*/ "1f9dc-1f3ff-2640", 2002, EmojiCode(0x1f9dc, 0x1f3ff, 0x2640), EmojiCode(0x1f9dc, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"merman",*/ "1f9dc-2642", 2003, EmojiCode(0x1f9dc, 0x2642), EmojiCode(0x1f9dc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"merman: light skin tone",*/ "1f9dc-1f3fb-2642", 2004, EmojiCode(0x1f9dc, 0x1f3fb, 0x2642), EmojiCode(0x1f9dc, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"merman: medium-light skin tone",*/ "1f9dc-1f3fc-2642", 2005, EmojiCode(0x1f9dc, 0x1f3fc, 0x2642), EmojiCode(0x1f9dc, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"merman: medium skin tone",*/ "1f9dc-1f3fd-2642", 2006, EmojiCode(0x1f9dc, 0x1f3fd, 0x2642), EmojiCode(0x1f9dc, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"merman: medium-dark skin tone",*/ "1f9dc-1f3fe-2642", 2007, EmojiCode(0x1f9dc, 0x1f3fe, 0x2642), EmojiCode(0x1f9dc, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"merman: dark skin tone",*/ "1f9dc-1f3ff-2642", 2008, EmojiCode(0x1f9dc, 0x1f3ff, 0x2642), EmojiCode(0x1f9dc, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"fairy",*/ "1f9da", 2009, EmojiCode(0x1f9da)),
+        EmojiRecord("people", /*"fairy: light skin tone",*/ "1f9da-1f3fb", 2010, EmojiCode(0x1f9da, 0x1f3fb)),
+        EmojiRecord("people", /*"fairy: medium-light skin tone",*/ "1f9da-1f3fc", 2011, EmojiCode(0x1f9da, 0x1f3fc)),
+        EmojiRecord("people", /*"fairy: medium skin tone",*/ "1f9da-1f3fd", 2012, EmojiCode(0x1f9da, 0x1f3fd)),
+        EmojiRecord("people", /*"fairy: medium-dark skin tone",*/ "1f9da-1f3fe", 2013, EmojiCode(0x1f9da, 0x1f3fe)),
+        EmojiRecord("people", /*"fairy: dark skin tone",*/ "1f9da-1f3ff", 2014, EmojiCode(0x1f9da, 0x1f3ff)),
+        EmojiRecord("people", /*"woman fairy",*/ "1f9da-2640", 2015, EmojiCode(0x1f9da, 0x2640), EmojiCode(0x1f9da, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman fairy: light skin tone",*/ "1f9da-1f3fb-2640", 2016, EmojiCode(0x1f9da, 0x1f3fb, 0x2640), EmojiCode(0x1f9da, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman fairy: medium-light skin tone",*/ "1f9da-1f3fc-2640", 2017, EmojiCode(0x1f9da, 0x1f3fc, 0x2640), EmojiCode(0x1f9da, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman fairy: medium skin tone",*/ "1f9da-1f3fd-2640", 2018, EmojiCode(0x1f9da, 0x1f3fd, 0x2640), EmojiCode(0x1f9da, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman fairy: medium-dark skin tone",*/ "1f9da-1f3fe-2640", 2019, EmojiCode(0x1f9da, 0x1f3fe, 0x2640), EmojiCode(0x1f9da, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman fairy: dark skin tone",*/ "1f9da-1f3ff-2640", 2020, EmojiCode(0x1f9da, 0x1f3ff, 0x2640), EmojiCode(0x1f9da, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man fairy",*/ "1f9da-2642", 2021, EmojiCode(0x1f9da, 0x2642), EmojiCode(0x1f9da, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man fairy: light skin tone",*/ "1f9da-1f3fb-2642", 2022, EmojiCode(0x1f9da, 0x1f3fb, 0x2642), EmojiCode(0x1f9da, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man fairy: medium-light skin tone",*/ "1f9da-1f3fc-2642", 2023, EmojiCode(0x1f9da, 0x1f3fc, 0x2642), EmojiCode(0x1f9da, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man fairy: medium skin tone",*/ "1f9da-1f3fd-2642", 2024, EmojiCode(0x1f9da, 0x1f3fd, 0x2642), EmojiCode(0x1f9da, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man fairy: medium-dark skin tone",*/ "1f9da-1f3fe-2642", 2025, EmojiCode(0x1f9da, 0x1f3fe, 0x2642), EmojiCode(0x1f9da, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man fairy: dark skin tone",*/ "1f9da-1f3ff-2642", 2026, EmojiCode(0x1f9da, 0x1f3ff, 0x2642), EmojiCode(0x1f9da, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"baby angel",*/ "1f47c", 2027, EmojiCode(0x1f47c)),
+        EmojiRecord("people", /*"baby angel: light skin tone",*/ "1f47c-1f3fb", 2028, EmojiCode(0x1f47c, 0x1f3fb)),
+        EmojiRecord("people", /*"baby angel: medium-light skin tone",*/ "1f47c-1f3fc", 2029, EmojiCode(0x1f47c, 0x1f3fc)),
+        EmojiRecord("people", /*"baby angel: medium skin tone",*/ "1f47c-1f3fd", 2030, EmojiCode(0x1f47c, 0x1f3fd)),
+        EmojiRecord("people", /*"baby angel: medium-dark skin tone",*/ "1f47c-1f3fe", 2031, EmojiCode(0x1f47c, 0x1f3fe)),
+        EmojiRecord("people", /*"baby angel: dark skin tone",*/ "1f47c-1f3ff", 2032, EmojiCode(0x1f47c, 0x1f3ff)),
+        EmojiRecord("people", /*"pregnant woman",*/ "1f930", 2033, EmojiCode(0x1f930)),
+        EmojiRecord("people", /*"pregnant woman: light skin tone",*/ "1f930-1f3fb", 2034, EmojiCode(0x1f930, 0x1f3fb)),
+        EmojiRecord("people", /*"pregnant woman: medium-light skin tone",*/ "1f930-1f3fc", 2035, EmojiCode(0x1f930, 0x1f3fc)),
+        EmojiRecord("people", /*"pregnant woman: medium skin tone",*/ "1f930-1f3fd", 2036, EmojiCode(0x1f930, 0x1f3fd)),
+        EmojiRecord("people", /*"pregnant woman: medium-dark skin tone",*/ "1f930-1f3fe", 2037, EmojiCode(0x1f930, 0x1f3fe)),
+        EmojiRecord("people", /*"pregnant woman: dark skin tone",*/ "1f930-1f3ff", 2038, EmojiCode(0x1f930, 0x1f3ff)),
+        EmojiRecord("people", /*"breast-feeding",*/ "1f931", 2039, EmojiCode(0x1f931)),
+        EmojiRecord("people", /*"breast-feeding: light skin tone",*/ "1f931-1f3fb", 2040, EmojiCode(0x1f931, 0x1f3fb)),
+        EmojiRecord("people", /*"breast-feeding: medium-light skin tone",*/ "1f931-1f3fc", 2041, EmojiCode(0x1f931, 0x1f3fc)),
+        EmojiRecord("people", /*"breast-feeding: medium skin tone",*/ "1f931-1f3fd", 2042, EmojiCode(0x1f931, 0x1f3fd)),
+        EmojiRecord("people", /*"breast-feeding: medium-dark skin tone",*/ "1f931-1f3fe", 2043, EmojiCode(0x1f931, 0x1f3fe)),
+        EmojiRecord("people", /*"breast-feeding: dark skin tone",*/ "1f931-1f3ff", 2044, EmojiCode(0x1f931, 0x1f3ff)),
+        EmojiRecord("people", /*"person bowing",*/ "1f647", 2045, EmojiCode(0x1f647)),
+        EmojiRecord("people", /*"person bowing: light skin tone",*/ "1f647-1f3fb", 2046, EmojiCode(0x1f647, 0x1f3fb)),
+        EmojiRecord("people", /*"person bowing: medium-light skin tone",*/ "1f647-1f3fc", 2047, EmojiCode(0x1f647, 0x1f3fc)),
+        EmojiRecord("people", /*"person bowing: medium skin tone",*/ "1f647-1f3fd", 2048, EmojiCode(0x1f647, 0x1f3fd)),
+        EmojiRecord("people", /*"person bowing: medium-dark skin tone",*/ "1f647-1f3fe", 2049, EmojiCode(0x1f647, 0x1f3fe)),
+        EmojiRecord("people", /*"person bowing: dark skin tone",*/ "1f647-1f3ff", 2050, EmojiCode(0x1f647, 0x1f3ff)),
+        EmojiRecord("people", /*"woman bowing",*/ "1f647-2640", 2051, EmojiCode(0x1f647, 0x2640), EmojiCode(0x1f647, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman bowing: light skin tone",*/ "1f647-1f3fb-2640", 2052, EmojiCode(0x1f647, 0x1f3fb, 0x2640), EmojiCode(0x1f647, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman bowing: medium-light skin tone",*/ "1f647-1f3fc-2640", 2053, EmojiCode(0x1f647, 0x1f3fc, 0x2640), EmojiCode(0x1f647, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman bowing: medium skin tone",*/ "1f647-1f3fd-2640", 2054, EmojiCode(0x1f647, 0x1f3fd, 0x2640), EmojiCode(0x1f647, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman bowing: medium-dark skin tone",*/ "1f647-1f3fe-2640", 2055, EmojiCode(0x1f647, 0x1f3fe, 0x2640), EmojiCode(0x1f647, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman bowing: dark skin tone",*/ "1f647-1f3ff-2640", 2056, EmojiCode(0x1f647, 0x1f3ff, 0x2640), EmojiCode(0x1f647, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man bowing",*/ "1f647-2642", 2057, EmojiCode(0x1f647, 0x2642), EmojiCode(0x1f647, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man bowing: light skin tone",*/ "1f647-1f3fb-2642", 2058, EmojiCode(0x1f647, 0x1f3fb, 0x2642), EmojiCode(0x1f647, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man bowing: medium-light skin tone",*/ "1f647-1f3fc-2642", 2059, EmojiCode(0x1f647, 0x1f3fc, 0x2642), EmojiCode(0x1f647, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man bowing: medium skin tone",*/ "1f647-1f3fd-2642", 2060, EmojiCode(0x1f647, 0x1f3fd, 0x2642), EmojiCode(0x1f647, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man bowing: medium-dark skin tone",*/ "1f647-1f3fe-2642", 2061, EmojiCode(0x1f647, 0x1f3fe, 0x2642), EmojiCode(0x1f647, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man bowing: dark skin tone",*/ "1f647-1f3ff-2642", 2062, EmojiCode(0x1f647, 0x1f3ff, 0x2642), EmojiCode(0x1f647, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person tipping hand",*/ "1f481", 2063, EmojiCode(0x1f481)),
+        EmojiRecord("people", /*"person tipping hand: light skin tone",*/ "1f481-1f3fb", 2064, EmojiCode(0x1f481, 0x1f3fb)),
+        EmojiRecord("people", /*"person tipping hand: medium-light skin tone",*/ "1f481-1f3fc", 2065, EmojiCode(0x1f481, 0x1f3fc)),
+        EmojiRecord("people", /*"person tipping hand: medium skin tone",*/ "1f481-1f3fd", 2066, EmojiCode(0x1f481, 0x1f3fd)),
+        EmojiRecord("people", /*"person tipping hand: medium-dark skin tone",*/ "1f481-1f3fe", 2067, EmojiCode(0x1f481, 0x1f3fe)),
+        EmojiRecord("people", /*"person tipping hand: dark skin tone",*/ "1f481-1f3ff", 2068, EmojiCode(0x1f481, 0x1f3ff)),
+        EmojiRecord("people", /*"woman tipping hand",*/ "1f481-2640", 2069, EmojiCode(0x1f481, 0x2640), EmojiCode(0x1f481, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman tipping hand: light skin tone",*/ "1f481-1f3fb-2640", 2070, EmojiCode(0x1f481, 0x1f3fb, 0x2640), EmojiCode(0x1f481, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman tipping hand: medium-light skin tone",*/ "1f481-1f3fc-2640", 2071, EmojiCode(0x1f481, 0x1f3fc, 0x2640), EmojiCode(0x1f481, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman tipping hand: medium skin tone",*/ "1f481-1f3fd-2640", 2072, EmojiCode(0x1f481, 0x1f3fd, 0x2640), EmojiCode(0x1f481, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman tipping hand: medium-dark skin tone",*/ "1f481-1f3fe-2640", 2073, EmojiCode(0x1f481, 0x1f3fe, 0x2640), EmojiCode(0x1f481, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman tipping hand: dark skin tone",*/ "1f481-1f3ff-2640", 2074, EmojiCode(0x1f481, 0x1f3ff, 0x2640), EmojiCode(0x1f481, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man tipping hand",*/ "1f481-2642", 2075, EmojiCode(0x1f481, 0x2642), EmojiCode(0x1f481, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man tipping hand: light skin tone",*/ "1f481-1f3fb-2642", 2076, EmojiCode(0x1f481, 0x1f3fb, 0x2642), EmojiCode(0x1f481, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man tipping hand: medium-light skin tone",*/ "1f481-1f3fc-2642", 2077, EmojiCode(0x1f481, 0x1f3fc, 0x2642), EmojiCode(0x1f481, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man tipping hand: medium skin tone",*/ "1f481-1f3fd-2642", 2078, EmojiCode(0x1f481, 0x1f3fd, 0x2642), EmojiCode(0x1f481, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man tipping hand: medium-dark skin tone",*/ "1f481-1f3fe-2642", 2079, EmojiCode(0x1f481, 0x1f3fe, 0x2642), EmojiCode(0x1f481, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man tipping hand: dark skin tone",*/ "1f481-1f3ff-2642", 2080, EmojiCode(0x1f481, 0x1f3ff, 0x2642), EmojiCode(0x1f481, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person gesturing NO",*/ "1f645", 2081, EmojiCode(0x1f645)),
+        EmojiRecord("people", /*"person gesturing NO: light skin tone",*/ "1f645-1f3fb", 2082, EmojiCode(0x1f645, 0x1f3fb)),
+        EmojiRecord("people", /*"person gesturing NO: medium-light skin tone",*/ "1f645-1f3fc", 2083, EmojiCode(0x1f645, 0x1f3fc)),
+        EmojiRecord("people", /*"person gesturing NO: medium skin tone",*/ "1f645-1f3fd", 2084, EmojiCode(0x1f645, 0x1f3fd)),
+        EmojiRecord("people", /*"person gesturing NO: medium-dark skin tone",*/ "1f645-1f3fe", 2085, EmojiCode(0x1f645, 0x1f3fe)),
+        EmojiRecord("people", /*"person gesturing NO: dark skin tone",*/ "1f645-1f3ff", 2086, EmojiCode(0x1f645, 0x1f3ff)),
+        EmojiRecord("people", /*"woman gesturing NO",*/ "1f645-2640", 2087, EmojiCode(0x1f645, 0x2640), EmojiCode(0x1f645, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman gesturing NO: light skin tone",*/ "1f645-1f3fb-2640", 2088, EmojiCode(0x1f645, 0x1f3fb, 0x2640), EmojiCode(0x1f645, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman gesturing NO: medium-light skin tone",*/ "1f645-1f3fc-2640", 2089, EmojiCode(0x1f645, 0x1f3fc, 0x2640), EmojiCode(0x1f645, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman gesturing NO: medium skin tone",*/ "1f645-1f3fd-2640", 2090, EmojiCode(0x1f645, 0x1f3fd, 0x2640), EmojiCode(0x1f645, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman gesturing NO: medium-dark skin tone",*/ "1f645-1f3fe-2640", 2091, EmojiCode(0x1f645, 0x1f3fe, 0x2640), EmojiCode(0x1f645, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman gesturing NO: dark skin tone",*/ "1f645-1f3ff-2640", 2092, EmojiCode(0x1f645, 0x1f3ff, 0x2640), EmojiCode(0x1f645, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing NO",*/ "1f645-2642", 2093, EmojiCode(0x1f645, 0x2642), EmojiCode(0x1f645, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing NO: light skin tone",*/ "1f645-1f3fb-2642", 2094, EmojiCode(0x1f645, 0x1f3fb, 0x2642), EmojiCode(0x1f645, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing NO: medium-light skin tone",*/ "1f645-1f3fc-2642", 2095, EmojiCode(0x1f645, 0x1f3fc, 0x2642), EmojiCode(0x1f645, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing NO: medium skin tone",*/ "1f645-1f3fd-2642", 2096, EmojiCode(0x1f645, 0x1f3fd, 0x2642), EmojiCode(0x1f645, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing NO: medium-dark skin tone",*/ "1f645-1f3fe-2642", 2097, EmojiCode(0x1f645, 0x1f3fe, 0x2642), EmojiCode(0x1f645, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing NO: dark skin tone",*/ "1f645-1f3ff-2642", 2098, EmojiCode(0x1f645, 0x1f3ff, 0x2642), EmojiCode(0x1f645, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person gesturing OK",*/ "1f646", 2099, EmojiCode(0x1f646)),
+        EmojiRecord("people", /*"person gesturing OK: light skin tone",*/ "1f646-1f3fb", 2100, EmojiCode(0x1f646, 0x1f3fb)),
+        EmojiRecord("people", /*"person gesturing OK: medium-light skin tone",*/ "1f646-1f3fc", 2101, EmojiCode(0x1f646, 0x1f3fc)),
+        EmojiRecord("people", /*"person gesturing OK: medium skin tone",*/ "1f646-1f3fd", 2102, EmojiCode(0x1f646, 0x1f3fd)),
+        EmojiRecord("people", /*"person gesturing OK: medium-dark skin tone",*/ "1f646-1f3fe", 2103, EmojiCode(0x1f646, 0x1f3fe)),
+        EmojiRecord("people", /*"person gesturing OK: dark skin tone",*/ "1f646-1f3ff", 2104, EmojiCode(0x1f646, 0x1f3ff)),
+        EmojiRecord("people", /*"woman gesturing OK",*/ "1f646-2640", 2105, EmojiCode(0x1f646, 0x2640), EmojiCode(0x1f646, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman gesturing OK: light skin tone",*/ "1f646-1f3fb-2640", 2106, EmojiCode(0x1f646, 0x1f3fb, 0x2640), EmojiCode(0x1f646, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman gesturing OK: medium-light skin tone",*/ "1f646-1f3fc-2640", 2107, EmojiCode(0x1f646, 0x1f3fc, 0x2640), EmojiCode(0x1f646, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman gesturing OK: medium skin tone",*/ "1f646-1f3fd-2640", 2108, EmojiCode(0x1f646, 0x1f3fd, 0x2640), EmojiCode(0x1f646, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman gesturing OK: medium-dark skin tone",*/ "1f646-1f3fe-2640", 2109, EmojiCode(0x1f646, 0x1f3fe, 0x2640), EmojiCode(0x1f646, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman gesturing OK: dark skin tone",*/ "1f646-1f3ff-2640", 2110, EmojiCode(0x1f646, 0x1f3ff, 0x2640), EmojiCode(0x1f646, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing OK",*/ "1f646-2642", 2111, EmojiCode(0x1f646, 0x2642), EmojiCode(0x1f646, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing OK: light skin tone",*/ "1f646-1f3fb-2642", 2112, EmojiCode(0x1f646, 0x1f3fb, 0x2642), EmojiCode(0x1f646, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing OK: medium-light skin tone",*/ "1f646-1f3fc-2642", 2113, EmojiCode(0x1f646, 0x1f3fc, 0x2642), EmojiCode(0x1f646, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing OK: medium skin tone",*/ "1f646-1f3fd-2642", 2114, EmojiCode(0x1f646, 0x1f3fd, 0x2642), EmojiCode(0x1f646, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing OK: medium-dark skin tone",*/ "1f646-1f3fe-2642", 2115, EmojiCode(0x1f646, 0x1f3fe, 0x2642), EmojiCode(0x1f646, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man gesturing OK: dark skin tone",*/ "1f646-1f3ff-2642", 2116, EmojiCode(0x1f646, 0x1f3ff, 0x2642), EmojiCode(0x1f646, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person raising hand",*/ "1f64b", 2117, EmojiCode(0x1f64b)),
+        EmojiRecord("people", /*"person raising hand: light skin tone",*/ "1f64b-1f3fb", 2118, EmojiCode(0x1f64b, 0x1f3fb)),
+        EmojiRecord("people", /*"person raising hand: medium-light skin tone",*/ "1f64b-1f3fc", 2119, EmojiCode(0x1f64b, 0x1f3fc)),
+        EmojiRecord("people", /*"person raising hand: medium skin tone",*/ "1f64b-1f3fd", 2120, EmojiCode(0x1f64b, 0x1f3fd)),
+        EmojiRecord("people", /*"person raising hand: medium-dark skin tone",*/ "1f64b-1f3fe", 2121, EmojiCode(0x1f64b, 0x1f3fe)),
+        EmojiRecord("people", /*"person raising hand: dark skin tone",*/ "1f64b-1f3ff", 2122, EmojiCode(0x1f64b, 0x1f3ff)),
+        EmojiRecord("people", /*"woman raising hand",*/ "1f64b-2640", 2123, EmojiCode(0x1f64b, 0x2640), EmojiCode(0x1f64b, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman raising hand: light skin tone",*/ "1f64b-1f3fb-2640", 2124, EmojiCode(0x1f64b, 0x1f3fb, 0x2640), EmojiCode(0x1f64b, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman raising hand: medium-light skin tone",*/ "1f64b-1f3fc-2640", 2125, EmojiCode(0x1f64b, 0x1f3fc, 0x2640), EmojiCode(0x1f64b, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman raising hand: medium skin tone",*/ "1f64b-1f3fd-2640", 2126, EmojiCode(0x1f64b, 0x1f3fd, 0x2640), EmojiCode(0x1f64b, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman raising hand: medium-dark skin tone",*/ "1f64b-1f3fe-2640", 2127, EmojiCode(0x1f64b, 0x1f3fe, 0x2640), EmojiCode(0x1f64b, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman raising hand: dark skin tone",*/ "1f64b-1f3ff-2640", 2128, EmojiCode(0x1f64b, 0x1f3ff, 0x2640), EmojiCode(0x1f64b, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man raising hand",*/ "1f64b-2642", 2129, EmojiCode(0x1f64b, 0x2642), EmojiCode(0x1f64b, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man raising hand: light skin tone",*/ "1f64b-1f3fb-2642", 2130, EmojiCode(0x1f64b, 0x1f3fb, 0x2642), EmojiCode(0x1f64b, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man raising hand: medium-light skin tone",*/ "1f64b-1f3fc-2642", 2131, EmojiCode(0x1f64b, 0x1f3fc, 0x2642), EmojiCode(0x1f64b, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man raising hand: medium skin tone",*/ "1f64b-1f3fd-2642", 2132, EmojiCode(0x1f64b, 0x1f3fd, 0x2642), EmojiCode(0x1f64b, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man raising hand: medium-dark skin tone",*/ "1f64b-1f3fe-2642", 2133, EmojiCode(0x1f64b, 0x1f3fe, 0x2642), EmojiCode(0x1f64b, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man raising hand: dark skin tone",*/ "1f64b-1f3ff-2642", 2134, EmojiCode(0x1f64b, 0x1f3ff, 0x2642), EmojiCode(0x1f64b, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person facepalming",*/ "1f926", 2135, EmojiCode(0x1f926)),
+        EmojiRecord("people", /*"person facepalming: light skin tone",*/ "1f926-1f3fb", 2136, EmojiCode(0x1f926, 0x1f3fb)),
+        EmojiRecord("people", /*"person facepalming: medium-light skin tone",*/ "1f926-1f3fc", 2137, EmojiCode(0x1f926, 0x1f3fc)),
+        EmojiRecord("people", /*"person facepalming: medium skin tone",*/ "1f926-1f3fd", 2138, EmojiCode(0x1f926, 0x1f3fd)),
+        EmojiRecord("people", /*"person facepalming: medium-dark skin tone",*/ "1f926-1f3fe", 2139, EmojiCode(0x1f926, 0x1f3fe)),
+        EmojiRecord("people", /*"person facepalming: dark skin tone",*/ "1f926-1f3ff", 2140, EmojiCode(0x1f926, 0x1f3ff)),
+        EmojiRecord("people", /*"woman facepalming",*/ "1f926-2640", 2141, EmojiCode(0x1f926, 0x2640), EmojiCode(0x1f926, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman facepalming: light skin tone",*/ "1f926-1f3fb-2640", 2142, EmojiCode(0x1f926, 0x1f3fb, 0x2640), EmojiCode(0x1f926, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman facepalming: medium-light skin tone",*/ "1f926-1f3fc-2640", 2143, EmojiCode(0x1f926, 0x1f3fc, 0x2640), EmojiCode(0x1f926, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman facepalming: medium skin tone",*/ "1f926-1f3fd-2640", 2144, EmojiCode(0x1f926, 0x1f3fd, 0x2640), EmojiCode(0x1f926, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman facepalming: medium-dark skin tone",*/ "1f926-1f3fe-2640", 2145, EmojiCode(0x1f926, 0x1f3fe, 0x2640), EmojiCode(0x1f926, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman facepalming: dark skin tone",*/ "1f926-1f3ff-2640", 2146, EmojiCode(0x1f926, 0x1f3ff, 0x2640), EmojiCode(0x1f926, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man facepalming",*/ "1f926-2642", 2147, EmojiCode(0x1f926, 0x2642), EmojiCode(0x1f926, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man facepalming: light skin tone",*/ "1f926-1f3fb-2642", 2148, EmojiCode(0x1f926, 0x1f3fb, 0x2642), EmojiCode(0x1f926, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man facepalming: medium-light skin tone",*/ "1f926-1f3fc-2642", 2149, EmojiCode(0x1f926, 0x1f3fc, 0x2642), EmojiCode(0x1f926, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man facepalming: medium skin tone",*/ "1f926-1f3fd-2642", 2150, EmojiCode(0x1f926, 0x1f3fd, 0x2642), EmojiCode(0x1f926, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man facepalming: medium-dark skin tone",*/ "1f926-1f3fe-2642", 2151, EmojiCode(0x1f926, 0x1f3fe, 0x2642), EmojiCode(0x1f926, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man facepalming: dark skin tone",*/ "1f926-1f3ff-2642", 2152, EmojiCode(0x1f926, 0x1f3ff, 0x2642), EmojiCode(0x1f926, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person shrugging",*/ "1f937", 2153, EmojiCode(0x1f937)),
+        EmojiRecord("people", /*"person shrugging: light skin tone",*/ "1f937-1f3fb", 2154, EmojiCode(0x1f937, 0x1f3fb)),
+        EmojiRecord("people", /*"person shrugging: medium-light skin tone",*/ "1f937-1f3fc", 2155, EmojiCode(0x1f937, 0x1f3fc)),
+        EmojiRecord("people", /*"person shrugging: medium skin tone",*/ "1f937-1f3fd", 2156, EmojiCode(0x1f937, 0x1f3fd)),
+        EmojiRecord("people", /*"person shrugging: medium-dark skin tone",*/ "1f937-1f3fe", 2157, EmojiCode(0x1f937, 0x1f3fe)),
+        EmojiRecord("people", /*"person shrugging: dark skin tone",*/ "1f937-1f3ff", 2158, EmojiCode(0x1f937, 0x1f3ff)),
+        EmojiRecord("people", /*"woman shrugging",*/ "1f937-2640", 2159, EmojiCode(0x1f937, 0x2640), EmojiCode(0x1f937, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman shrugging: light skin tone",*/ "1f937-1f3fb-2640", 2160, EmojiCode(0x1f937, 0x1f3fb, 0x2640), EmojiCode(0x1f937, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman shrugging: medium-light skin tone",*/ "1f937-1f3fc-2640", 2161, EmojiCode(0x1f937, 0x1f3fc, 0x2640), EmojiCode(0x1f937, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman shrugging: medium skin tone",*/ "1f937-1f3fd-2640", 2162, EmojiCode(0x1f937, 0x1f3fd, 0x2640), EmojiCode(0x1f937, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman shrugging: medium-dark skin tone",*/ "1f937-1f3fe-2640", 2163, EmojiCode(0x1f937, 0x1f3fe, 0x2640), EmojiCode(0x1f937, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman shrugging: dark skin tone",*/ "1f937-1f3ff-2640", 2164, EmojiCode(0x1f937, 0x1f3ff, 0x2640), EmojiCode(0x1f937, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man shrugging",*/ "1f937-2642", 2165, EmojiCode(0x1f937, 0x2642), EmojiCode(0x1f937, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man shrugging: light skin tone",*/ "1f937-1f3fb-2642", 2166, EmojiCode(0x1f937, 0x1f3fb, 0x2642), EmojiCode(0x1f937, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man shrugging: medium-light skin tone",*/ "1f937-1f3fc-2642", 2167, EmojiCode(0x1f937, 0x1f3fc, 0x2642), EmojiCode(0x1f937, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man shrugging: medium skin tone",*/ "1f937-1f3fd-2642", 2168, EmojiCode(0x1f937, 0x1f3fd, 0x2642), EmojiCode(0x1f937, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man shrugging: medium-dark skin tone",*/ "1f937-1f3fe-2642", 2169, EmojiCode(0x1f937, 0x1f3fe, 0x2642), EmojiCode(0x1f937, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man shrugging: dark skin tone",*/ "1f937-1f3ff-2642", 2170, EmojiCode(0x1f937, 0x1f3ff, 0x2642), EmojiCode(0x1f937, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person pouting",*/ "1f64e", 2171, EmojiCode(0x1f64e)),
+        EmojiRecord("people", /*"person pouting: light skin tone",*/ "1f64e-1f3fb", 2172, EmojiCode(0x1f64e, 0x1f3fb)),
+        EmojiRecord("people", /*"person pouting: medium-light skin tone",*/ "1f64e-1f3fc", 2173, EmojiCode(0x1f64e, 0x1f3fc)),
+        EmojiRecord("people", /*"person pouting: medium skin tone",*/ "1f64e-1f3fd", 2174, EmojiCode(0x1f64e, 0x1f3fd)),
+        EmojiRecord("people", /*"person pouting: medium-dark skin tone",*/ "1f64e-1f3fe", 2175, EmojiCode(0x1f64e, 0x1f3fe)),
+        EmojiRecord("people", /*"person pouting: dark skin tone",*/ "1f64e-1f3ff", 2176, EmojiCode(0x1f64e, 0x1f3ff)),
+        EmojiRecord("people", /*"woman pouting",*/ "1f64e-2640", 2177, EmojiCode(0x1f64e, 0x2640), EmojiCode(0x1f64e, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman pouting: light skin tone",*/ "1f64e-1f3fb-2640", 2178, EmojiCode(0x1f64e, 0x1f3fb, 0x2640), EmojiCode(0x1f64e, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman pouting: medium-light skin tone",*/ "1f64e-1f3fc-2640", 2179, EmojiCode(0x1f64e, 0x1f3fc, 0x2640), EmojiCode(0x1f64e, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman pouting: medium skin tone",*/ "1f64e-1f3fd-2640", 2180, EmojiCode(0x1f64e, 0x1f3fd, 0x2640), EmojiCode(0x1f64e, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman pouting: medium-dark skin tone",*/ "1f64e-1f3fe-2640", 2181, EmojiCode(0x1f64e, 0x1f3fe, 0x2640), EmojiCode(0x1f64e, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman pouting: dark skin tone",*/ "1f64e-1f3ff-2640", 2182, EmojiCode(0x1f64e, 0x1f3ff, 0x2640), EmojiCode(0x1f64e, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man pouting",*/ "1f64e-2642", 2183, EmojiCode(0x1f64e, 0x2642), EmojiCode(0x1f64e, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man pouting: light skin tone",*/ "1f64e-1f3fb-2642", 2184, EmojiCode(0x1f64e, 0x1f3fb, 0x2642), EmojiCode(0x1f64e, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man pouting: medium-light skin tone",*/ "1f64e-1f3fc-2642", 2185, EmojiCode(0x1f64e, 0x1f3fc, 0x2642), EmojiCode(0x1f64e, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man pouting: medium skin tone",*/ "1f64e-1f3fd-2642", 2186, EmojiCode(0x1f64e, 0x1f3fd, 0x2642), EmojiCode(0x1f64e, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man pouting: medium-dark skin tone",*/ "1f64e-1f3fe-2642", 2187, EmojiCode(0x1f64e, 0x1f3fe, 0x2642), EmojiCode(0x1f64e, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man pouting: dark skin tone",*/ "1f64e-1f3ff-2642", 2188, EmojiCode(0x1f64e, 0x1f3ff, 0x2642), EmojiCode(0x1f64e, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person frowning",*/ "1f64d", 2189, EmojiCode(0x1f64d)),
+        EmojiRecord("people", /*"person frowning: light skin tone",*/ "1f64d-1f3fb", 2190, EmojiCode(0x1f64d, 0x1f3fb)),
+        EmojiRecord("people", /*"person frowning: medium-light skin tone",*/ "1f64d-1f3fc", 2191, EmojiCode(0x1f64d, 0x1f3fc)),
+        EmojiRecord("people", /*"person frowning: medium skin tone",*/ "1f64d-1f3fd", 2192, EmojiCode(0x1f64d, 0x1f3fd)),
+        EmojiRecord("people", /*"person frowning: medium-dark skin tone",*/ "1f64d-1f3fe", 2193, EmojiCode(0x1f64d, 0x1f3fe)),
+        EmojiRecord("people", /*"person frowning: dark skin tone",*/ "1f64d-1f3ff", 2194, EmojiCode(0x1f64d, 0x1f3ff)),
+        EmojiRecord("people", /*"woman frowning",*/ "1f64d-2640", 2195, EmojiCode(0x1f64d, 0x2640), EmojiCode(0x1f64d, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman frowning: light skin tone",*/ "1f64d-1f3fb-2640", 2196, EmojiCode(0x1f64d, 0x1f3fb, 0x2640), EmojiCode(0x1f64d, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman frowning: medium-light skin tone",*/ "1f64d-1f3fc-2640", 2197, EmojiCode(0x1f64d, 0x1f3fc, 0x2640), EmojiCode(0x1f64d, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman frowning: medium skin tone",*/ "1f64d-1f3fd-2640", 2198, EmojiCode(0x1f64d, 0x1f3fd, 0x2640), EmojiCode(0x1f64d, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman frowning: medium-dark skin tone",*/ "1f64d-1f3fe-2640", 2199, EmojiCode(0x1f64d, 0x1f3fe, 0x2640), EmojiCode(0x1f64d, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman frowning: dark skin tone",*/ "1f64d-1f3ff-2640", 2200, EmojiCode(0x1f64d, 0x1f3ff, 0x2640), EmojiCode(0x1f64d, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man frowning",*/ "1f64d-2642", 2201, EmojiCode(0x1f64d, 0x2642), EmojiCode(0x1f64d, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man frowning: light skin tone",*/ "1f64d-1f3fb-2642", 2202, EmojiCode(0x1f64d, 0x1f3fb, 0x2642), EmojiCode(0x1f64d, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man frowning: medium-light skin tone",*/ "1f64d-1f3fc-2642", 2203, EmojiCode(0x1f64d, 0x1f3fc, 0x2642), EmojiCode(0x1f64d, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man frowning: medium skin tone",*/ "1f64d-1f3fd-2642", 2204, EmojiCode(0x1f64d, 0x1f3fd, 0x2642), EmojiCode(0x1f64d, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man frowning: medium-dark skin tone",*/ "1f64d-1f3fe-2642", 2205, EmojiCode(0x1f64d, 0x1f3fe, 0x2642), EmojiCode(0x1f64d, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man frowning: dark skin tone",*/ "1f64d-1f3ff-2642", 2206, EmojiCode(0x1f64d, 0x1f3ff, 0x2642), EmojiCode(0x1f64d, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person getting haircut",*/ "1f487", 2207, EmojiCode(0x1f487)),
+        EmojiRecord("people", /*"person getting haircut: light skin tone",*/ "1f487-1f3fb", 2208, EmojiCode(0x1f487, 0x1f3fb)),
+        EmojiRecord("people", /*"person getting haircut: medium-light skin tone",*/ "1f487-1f3fc", 2209, EmojiCode(0x1f487, 0x1f3fc)),
+        EmojiRecord("people", /*"person getting haircut: medium skin tone",*/ "1f487-1f3fd", 2210, EmojiCode(0x1f487, 0x1f3fd)),
+        EmojiRecord("people", /*"person getting haircut: medium-dark skin tone",*/ "1f487-1f3fe", 2211, EmojiCode(0x1f487, 0x1f3fe)),
+        EmojiRecord("people", /*"person getting haircut: dark skin tone",*/ "1f487-1f3ff", 2212, EmojiCode(0x1f487, 0x1f3ff)),
+        EmojiRecord("people", /*"woman getting haircut",*/ "1f487-2640", 2213, EmojiCode(0x1f487, 0x2640), EmojiCode(0x1f487, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman getting haircut: light skin tone",*/ "1f487-1f3fb-2640", 2214, EmojiCode(0x1f487, 0x1f3fb, 0x2640), EmojiCode(0x1f487, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman getting haircut: medium-light skin tone",*/ "1f487-1f3fc-2640", 2215, EmojiCode(0x1f487, 0x1f3fc, 0x2640), EmojiCode(0x1f487, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman getting haircut: medium skin tone",*/ "1f487-1f3fd-2640", 2216, EmojiCode(0x1f487, 0x1f3fd, 0x2640), EmojiCode(0x1f487, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman getting haircut: medium-dark skin tone",*/ "1f487-1f3fe-2640", 2217, EmojiCode(0x1f487, 0x1f3fe, 0x2640), EmojiCode(0x1f487, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman getting haircut: dark skin tone",*/ "1f487-1f3ff-2640", 2218, EmojiCode(0x1f487, 0x1f3ff, 0x2640), EmojiCode(0x1f487, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man getting haircut",*/ "1f487-2642", 2219, EmojiCode(0x1f487, 0x2642), EmojiCode(0x1f487, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man getting haircut: light skin tone",*/ "1f487-1f3fb-2642", 2220, EmojiCode(0x1f487, 0x1f3fb, 0x2642), EmojiCode(0x1f487, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man getting haircut: medium-light skin tone",*/ "1f487-1f3fc-2642", 2221, EmojiCode(0x1f487, 0x1f3fc, 0x2642), EmojiCode(0x1f487, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man getting haircut: medium skin tone",*/ "1f487-1f3fd-2642", 2222, EmojiCode(0x1f487, 0x1f3fd, 0x2642), EmojiCode(0x1f487, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man getting haircut: medium-dark skin tone",*/ "1f487-1f3fe-2642", 2223, EmojiCode(0x1f487, 0x1f3fe, 0x2642), EmojiCode(0x1f487, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man getting haircut: dark skin tone",*/ "1f487-1f3ff-2642", 2224, EmojiCode(0x1f487, 0x1f3ff, 0x2642), EmojiCode(0x1f487, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person getting massage",*/ "1f486", 2225, EmojiCode(0x1f486)),
+        EmojiRecord("people", /*"person getting massage: light skin tone",*/ "1f486-1f3fb", 2226, EmojiCode(0x1f486, 0x1f3fb)),
+        EmojiRecord("people", /*"person getting massage: medium-light skin tone",*/ "1f486-1f3fc", 2227, EmojiCode(0x1f486, 0x1f3fc)),
+        EmojiRecord("people", /*"person getting massage: medium skin tone",*/ "1f486-1f3fd", 2228, EmojiCode(0x1f486, 0x1f3fd)),
+        EmojiRecord("people", /*"person getting massage: medium-dark skin tone",*/ "1f486-1f3fe", 2229, EmojiCode(0x1f486, 0x1f3fe)),
+        EmojiRecord("people", /*"person getting massage: dark skin tone",*/ "1f486-1f3ff", 2230, EmojiCode(0x1f486, 0x1f3ff)),
+        EmojiRecord("people", /*"woman getting massage",*/ "1f486-2640", 2231, EmojiCode(0x1f486, 0x2640), EmojiCode(0x1f486, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman getting massage: light skin tone",*/ "1f486-1f3fb-2640", 2232, EmojiCode(0x1f486, 0x1f3fb, 0x2640), EmojiCode(0x1f486, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman getting massage: medium-light skin tone",*/ "1f486-1f3fc-2640", 2233, EmojiCode(0x1f486, 0x1f3fc, 0x2640), EmojiCode(0x1f486, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman getting massage: medium skin tone",*/ "1f486-1f3fd-2640", 2234, EmojiCode(0x1f486, 0x1f3fd, 0x2640), EmojiCode(0x1f486, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman getting massage: medium-dark skin tone",*/ "1f486-1f3fe-2640", 2235, EmojiCode(0x1f486, 0x1f3fe, 0x2640), EmojiCode(0x1f486, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman getting massage: dark skin tone",*/ "1f486-1f3ff-2640", 2236, EmojiCode(0x1f486, 0x1f3ff, 0x2640), EmojiCode(0x1f486, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man getting massage",*/ "1f486-2642", 2237, EmojiCode(0x1f486, 0x2642), EmojiCode(0x1f486, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man getting massage: light skin tone",*/ "1f486-1f3fb-2642", 2238, EmojiCode(0x1f486, 0x1f3fb, 0x2642), EmojiCode(0x1f486, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man getting massage: medium-light skin tone",*/ "1f486-1f3fc-2642", 2239, EmojiCode(0x1f486, 0x1f3fc, 0x2642), EmojiCode(0x1f486, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man getting massage: medium skin tone",*/ "1f486-1f3fd-2642", 2240, EmojiCode(0x1f486, 0x1f3fd, 0x2642), EmojiCode(0x1f486, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man getting massage: medium-dark skin tone",*/ "1f486-1f3fe-2642", 2241, EmojiCode(0x1f486, 0x1f3fe, 0x2642), EmojiCode(0x1f486, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man getting massage: dark skin tone",*/ "1f486-1f3ff-2642", 2242, EmojiCode(0x1f486, 0x1f3ff, 0x2642), EmojiCode(0x1f486, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person in steamy room",*/ "1f9d6", 2243, EmojiCode(0x1f9d6)),
+        EmojiRecord("people", /*"person in steamy room: light skin tone",*/ "1f9d6-1f3fb", 2244, EmojiCode(0x1f9d6, 0x1f3fb)),
+        EmojiRecord("people", /*"person in steamy room: medium-light skin tone",*/ "1f9d6-1f3fc", 2245, EmojiCode(0x1f9d6, 0x1f3fc)),
+        EmojiRecord("people", /*"person in steamy room: medium skin tone",*/ "1f9d6-1f3fd", 2246, EmojiCode(0x1f9d6, 0x1f3fd)),
+        EmojiRecord("people", /*"person in steamy room: medium-dark skin tone",*/ "1f9d6-1f3fe", 2247, EmojiCode(0x1f9d6, 0x1f3fe)),
+        EmojiRecord("people", /*"person in steamy room: dark skin tone",*/ "1f9d6-1f3ff", 2248, EmojiCode(0x1f9d6, 0x1f3ff)),
+        EmojiRecord("people", /*"woman in steamy room",*/ "1f9d6-2640", 2249, EmojiCode(0x1f9d6, 0x2640), EmojiCode(0x1f9d6, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman in steamy room: light skin tone",*/ "1f9d6-1f3fb-2640", 2250, EmojiCode(0x1f9d6, 0x1f3fb, 0x2640), EmojiCode(0x1f9d6, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman in steamy room: medium-light skin tone",*/ "1f9d6-1f3fc-2640", 2251, EmojiCode(0x1f9d6, 0x1f3fc, 0x2640), EmojiCode(0x1f9d6, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman in steamy room: medium skin tone",*/ "1f9d6-1f3fd-2640", 2252, EmojiCode(0x1f9d6, 0x1f3fd, 0x2640), EmojiCode(0x1f9d6, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman in steamy room: medium-dark skin tone",*/ "1f9d6-1f3fe-2640", 2253, EmojiCode(0x1f9d6, 0x1f3fe, 0x2640), EmojiCode(0x1f9d6, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman in steamy room: dark skin tone",*/ "1f9d6-1f3ff-2640", 2254, EmojiCode(0x1f9d6, 0x1f3ff, 0x2640), EmojiCode(0x1f9d6, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man in steamy room",*/ "1f9d6-2642", 2255, EmojiCode(0x1f9d6, 0x2642), EmojiCode(0x1f9d6, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man in steamy room: light skin tone",*/ "1f9d6-1f3fb-2642", 2256, EmojiCode(0x1f9d6, 0x1f3fb, 0x2642), EmojiCode(0x1f9d6, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man in steamy room: medium-light skin tone",*/ "1f9d6-1f3fc-2642", 2257, EmojiCode(0x1f9d6, 0x1f3fc, 0x2642), EmojiCode(0x1f9d6, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man in steamy room: medium skin tone",*/ "1f9d6-1f3fd-2642", 2258, EmojiCode(0x1f9d6, 0x1f3fd, 0x2642), EmojiCode(0x1f9d6, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man in steamy room: medium-dark skin tone",*/ "1f9d6-1f3fe-2642", 2259, EmojiCode(0x1f9d6, 0x1f3fe, 0x2642), EmojiCode(0x1f9d6, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man in steamy room: dark skin tone",*/ "1f9d6-1f3ff-2642", 2260, EmojiCode(0x1f9d6, 0x1f3ff, 0x2642), EmojiCode(0x1f9d6, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"nail polish",*/ "1f485", 2261, EmojiCode(0x1f485)),
+        EmojiRecord("people", /*"nail polish: light skin tone",*/ "1f485-1f3fb", 2262, EmojiCode(0x1f485, 0x1f3fb)),
+        EmojiRecord("people", /*"nail polish: medium-light skin tone",*/ "1f485-1f3fc", 2263, EmojiCode(0x1f485, 0x1f3fc)),
+        EmojiRecord("people", /*"nail polish: medium skin tone",*/ "1f485-1f3fd", 2264, EmojiCode(0x1f485, 0x1f3fd)),
+        EmojiRecord("people", /*"nail polish: medium-dark skin tone",*/ "1f485-1f3fe", 2265, EmojiCode(0x1f485, 0x1f3fe)),
+        EmojiRecord("people", /*"nail polish: dark skin tone",*/ "1f485-1f3ff", 2266, EmojiCode(0x1f485, 0x1f3ff)),
+        EmojiRecord("people", /*"selfie",*/ "1f933", 2267, EmojiCode(0x1f933)),
+        EmojiRecord("people", /*"selfie: light skin tone",*/ "1f933-1f3fb", 2268, EmojiCode(0x1f933, 0x1f3fb)),
+        EmojiRecord("people", /*"selfie: medium-light skin tone",*/ "1f933-1f3fc", 2269, EmojiCode(0x1f933, 0x1f3fc)),
+        EmojiRecord("people", /*"selfie: medium skin tone",*/ "1f933-1f3fd", 2270, EmojiCode(0x1f933, 0x1f3fd)),
+        EmojiRecord("people", /*"selfie: medium-dark skin tone",*/ "1f933-1f3fe", 2271, EmojiCode(0x1f933, 0x1f3fe)),
+        EmojiRecord("people", /*"selfie: dark skin tone",*/ "1f933-1f3ff", 2272, EmojiCode(0x1f933, 0x1f3ff)),
+        EmojiRecord("people", /*"woman dancing",*/ "1f483", 2273, EmojiCode(0x1f483)),
+        EmojiRecord("people", /*"woman dancing: light skin tone",*/ "1f483-1f3fb", 2274, EmojiCode(0x1f483, 0x1f3fb)),
+        EmojiRecord("people", /*"woman dancing: medium-light skin tone",*/ "1f483-1f3fc", 2275, EmojiCode(0x1f483, 0x1f3fc)),
+        EmojiRecord("people", /*"woman dancing: medium skin tone",*/ "1f483-1f3fd", 2276, EmojiCode(0x1f483, 0x1f3fd)),
+        EmojiRecord("people", /*"woman dancing: medium-dark skin tone",*/ "1f483-1f3fe", 2277, EmojiCode(0x1f483, 0x1f3fe)),
+        EmojiRecord("people", /*"woman dancing: dark skin tone",*/ "1f483-1f3ff", 2278, EmojiCode(0x1f483, 0x1f3ff)),
+        EmojiRecord("people", /*"man dancing",*/ "1f57a", 2279, EmojiCode(0x1f57a)),
+        EmojiRecord("people", /*"man dancing: light skin tone",*/ "1f57a-1f3fb", 2280, EmojiCode(0x1f57a, 0x1f3fb)),
+        EmojiRecord("people", /*"man dancing: medium-light skin tone",*/ "1f57a-1f3fc", 2281, EmojiCode(0x1f57a, 0x1f3fc)),
+        EmojiRecord("people", /*"man dancing: medium skin tone",*/ "1f57a-1f3fd", 2282, EmojiCode(0x1f57a, 0x1f3fd)),
+        EmojiRecord("people", /*"man dancing: dark skin tone",*/ "1f57a-1f3ff", 2283, EmojiCode(0x1f57a, 0x1f3ff)),
+        EmojiRecord("people", /*"man dancing: medium-dark skin tone",*/ "1f57a-1f3fe", 2284, EmojiCode(0x1f57a, 0x1f3fe)),
+        EmojiRecord("people", /*"people with bunny ears",*/ "1f46f", 2285, EmojiCode(0x1f46f)),
+        EmojiRecord("people", /*"women with bunny ears",*/ "1f46f-2640", 2286, EmojiCode(0x1f46f, 0x2640), EmojiCode(0x1f46f, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"men with bunny ears",*/ "1f46f-2642", 2287, EmojiCode(0x1f46f, 0x2642), EmojiCode(0x1f46f, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man in suit levitating",*/ "1f574", 2288, EmojiCode(0x1f574), EmojiCode(0x1f574, 0xfe0f)),
+        EmojiRecord("people", /*"man in suit levitating: light skin tone",*/ "1f574-1f3fb", 2289, EmojiCode(0x1f574, 0x1f3fb), EmojiCode(0x1f574, 0xfe0f, 0x1f3fb)),
+        EmojiRecord("people", /*"man in suit levitating: medium-light skin tone",*/ "1f574-1f3fc", 2290, EmojiCode(0x1f574, 0x1f3fc), EmojiCode(0x1f574, 0xfe0f, 0x1f3fc)),
+        EmojiRecord("people", /*"man in suit levitating: medium skin tone",*/ "1f574-1f3fd", 2291, EmojiCode(0x1f574, 0x1f3fd), EmojiCode(0x1f574, 0xfe0f, 0x1f3fd)),
+        EmojiRecord("people", /*"man in suit levitating: medium-dark skin tone",*/ "1f574-1f3fe", 2292, EmojiCode(0x1f574, 0x1f3fe), EmojiCode(0x1f574, 0xfe0f, 0x1f3fe)),
+        EmojiRecord("people", /*"man in suit levitating: dark skin tone",*/ "1f574-1f3ff", 2293, EmojiCode(0x1f574, 0x1f3ff), EmojiCode(0x1f574, 0xfe0f, 0x1f3ff)),
+        EmojiRecord("people", /*"person walking",*/ "1f6b6", 2294, EmojiCode(0x1f6b6)),
+        EmojiRecord("people", /*"person walking: light skin tone",*/ "1f6b6-1f3fb", 2295, EmojiCode(0x1f6b6, 0x1f3fb)),
+        EmojiRecord("people", /*"person walking: medium-light skin tone",*/ "1f6b6-1f3fc", 2296, EmojiCode(0x1f6b6, 0x1f3fc)),
+        EmojiRecord("people", /*"person walking: medium skin tone",*/ "1f6b6-1f3fd", 2297, EmojiCode(0x1f6b6, 0x1f3fd)),
+        EmojiRecord("people", /*"person walking: medium-dark skin tone",*/ "1f6b6-1f3fe", 2298, EmojiCode(0x1f6b6, 0x1f3fe)),
+        EmojiRecord("people", /*"person walking: dark skin tone",*/ "1f6b6-1f3ff", 2299, EmojiCode(0x1f6b6, 0x1f3ff)),
+        EmojiRecord("people", /*"woman walking",*/ "1f6b6-2640", 2300, EmojiCode(0x1f6b6, 0x2640), EmojiCode(0x1f6b6, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman walking: light skin tone",*/ "1f6b6-1f3fb-2640", 2301, EmojiCode(0x1f6b6, 0x1f3fb, 0x2640), EmojiCode(0x1f6b6, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman walking: medium-light skin tone",*/ "1f6b6-1f3fc-2640", 2302, EmojiCode(0x1f6b6, 0x1f3fc, 0x2640), EmojiCode(0x1f6b6, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman walking: medium skin tone",*/ "1f6b6-1f3fd-2640", 2303, EmojiCode(0x1f6b6, 0x1f3fd, 0x2640), EmojiCode(0x1f6b6, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman walking: medium-dark skin tone",*/ "1f6b6-1f3fe-2640", 2304, EmojiCode(0x1f6b6, 0x1f3fe, 0x2640), EmojiCode(0x1f6b6, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman walking: dark skin tone",*/ "1f6b6-1f3ff-2640", 2305, EmojiCode(0x1f6b6, 0x1f3ff, 0x2640), EmojiCode(0x1f6b6, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man walking",*/ "1f6b6-2642", 2306, EmojiCode(0x1f6b6, 0x2642), EmojiCode(0x1f6b6, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man walking: light skin tone",*/ "1f6b6-1f3fb-2642", 2307, EmojiCode(0x1f6b6, 0x1f3fb, 0x2642), EmojiCode(0x1f6b6, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man walking: medium-light skin tone",*/ "1f6b6-1f3fc-2642", 2308, EmojiCode(0x1f6b6, 0x1f3fc, 0x2642), EmojiCode(0x1f6b6, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man walking: medium skin tone",*/ "1f6b6-1f3fd-2642", 2309, EmojiCode(0x1f6b6, 0x1f3fd, 0x2642), EmojiCode(0x1f6b6, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man walking: medium-dark skin tone",*/ "1f6b6-1f3fe-2642", 2310, EmojiCode(0x1f6b6, 0x1f3fe, 0x2642), EmojiCode(0x1f6b6, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man walking: dark skin tone",*/ "1f6b6-1f3ff-2642", 2311, EmojiCode(0x1f6b6, 0x1f3ff, 0x2642), EmojiCode(0x1f6b6, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"person running",*/ "1f3c3", 2312, EmojiCode(0x1f3c3)),
+        EmojiRecord("people", /*"person running: light skin tone",*/ "1f3c3-1f3fb", 2313, EmojiCode(0x1f3c3, 0x1f3fb)),
+        EmojiRecord("people", /*"person running: medium-light skin tone",*/ "1f3c3-1f3fc", 2314, EmojiCode(0x1f3c3, 0x1f3fc)),
+        EmojiRecord("people", /*"person running: medium skin tone",*/ "1f3c3-1f3fd", 2315, EmojiCode(0x1f3c3, 0x1f3fd)),
+        EmojiRecord("people", /*"person running: medium-dark skin tone",*/ "1f3c3-1f3fe", 2316, EmojiCode(0x1f3c3, 0x1f3fe)),
+        EmojiRecord("people", /*"person running: dark skin tone",*/ "1f3c3-1f3ff", 2317, EmojiCode(0x1f3c3, 0x1f3ff)),
+        EmojiRecord("people", /*"woman running",*/ "1f3c3-2640", 2318, EmojiCode(0x1f3c3, 0x2640), EmojiCode(0x1f3c3, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman running: light skin tone",*/ "1f3c3-1f3fb-2640", 2319, EmojiCode(0x1f3c3, 0x1f3fb, 0x2640), EmojiCode(0x1f3c3, 0x1f3fb, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman running: medium-light skin tone",*/ "1f3c3-1f3fc-2640", 2320, EmojiCode(0x1f3c3, 0x1f3fc, 0x2640), EmojiCode(0x1f3c3, 0x1f3fc, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman running: medium skin tone",*/ "1f3c3-1f3fd-2640", 2321, EmojiCode(0x1f3c3, 0x1f3fd, 0x2640), EmojiCode(0x1f3c3, 0x1f3fd, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman running: medium-dark skin tone",*/ "1f3c3-1f3fe-2640", 2322, EmojiCode(0x1f3c3, 0x1f3fe, 0x2640), EmojiCode(0x1f3c3, 0x1f3fe, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"woman running: dark skin tone",*/ "1f3c3-1f3ff-2640", 2323, EmojiCode(0x1f3c3, 0x1f3ff, 0x2640), EmojiCode(0x1f3c3, 0x1f3ff, 0x200d, 0x2640, 0xfe0f)),
+        EmojiRecord("people", /*"man running",*/ "1f3c3-2642", 2324, EmojiCode(0x1f3c3, 0x2642), EmojiCode(0x1f3c3, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man running: light skin tone",*/ "1f3c3-1f3fb-2642", 2325, EmojiCode(0x1f3c3, 0x1f3fb, 0x2642), EmojiCode(0x1f3c3, 0x1f3fb, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man running: medium-light skin tone",*/ "1f3c3-1f3fc-2642", 2326, EmojiCode(0x1f3c3, 0x1f3fc, 0x2642), EmojiCode(0x1f3c3, 0x1f3fc, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man running: medium skin tone",*/ "1f3c3-1f3fd-2642", 2327, EmojiCode(0x1f3c3, 0x1f3fd, 0x2642), EmojiCode(0x1f3c3, 0x1f3fd, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man running: medium-dark skin tone",*/ "1f3c3-1f3fe-2642", 2328, EmojiCode(0x1f3c3, 0x1f3fe, 0x2642), EmojiCode(0x1f3c3, 0x1f3fe, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man running: dark skin tone",*/ "1f3c3-1f3ff-2642", 2329, EmojiCode(0x1f3c3, 0x1f3ff, 0x2642), EmojiCode(0x1f3c3, 0x1f3ff, 0x200d, 0x2642, 0xfe0f)),
+        EmojiRecord("people", /*"man and woman holding hands",*/ "1f46b", 2330, EmojiCode(0x1f46b)),
+        EmojiRecord("people", /*"two women holding hands",*/ "1f46d", 2331, EmojiCode(0x1f46d)),
+        EmojiRecord("people", /*"two men holding hands",*/ "1f46c", 2332, EmojiCode(0x1f46c)),
+        EmojiRecord("people", /*"couple with heart",*/ "1f491", 2333, EmojiCode(0x1f491)),
+        EmojiRecord("people", /*"couple with heart: woman, man",*/ "1f469-2764-1f468", 2334, EmojiCode(0x1f469, 0x2764, 0x1f468), EmojiCode(0x1f469, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f468)),
+        EmojiRecord("people", /*"couple with heart: woman, woman",*/ "1f469-2764-1f469", 2335, EmojiCode(0x1f469, 0x2764, 0x1f469), EmojiCode(0x1f469, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f469)),
+        EmojiRecord("people", /*"couple with heart: man, man",*/ "1f468-2764-1f468", 2336, EmojiCode(0x1f468, 0x2764, 0x1f468), EmojiCode(0x1f468, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f468)),
+        EmojiRecord("people", /*"kiss",*/ "1f48f", 2337, EmojiCode(0x1f48f)),
+        EmojiRecord("people", /*"kiss: woman, man",*/ "1f469-2764-1f48b-1f468", 2338, EmojiCode(0x1f469, 0x2764, 0x1f48b, 0x1f468), EmojiCode(0x1f469, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f48b, 0x200d, 0x1f468)),
+        EmojiRecord("people", /*"kiss: woman, woman",*/ "1f469-2764-1f48b-1f469", 2339, EmojiCode(0x1f469, 0x2764, 0x1f48b, 0x1f469), EmojiCode(0x1f469, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f48b, 0x200d, 0x1f469)),
+        EmojiRecord("people", /*"kiss: man, man",*/ "1f468-2764-1f48b-1f468", 2340, EmojiCode(0x1f468, 0x2764, 0x1f48b, 0x1f468), EmojiCode(0x1f468, 0x200d, 0x2764, 0xfe0f, 0x200d, 0x1f48b, 0x200d, 0x1f468)),
+        EmojiRecord("people", /*"family",*/ "1f46a", 2341, EmojiCode(0x1f46a), EmojiCode(0x1f46a, 0xfe0f)),
+        EmojiRecord("people", /*"family: man, woman, boy",*/ "1f468-1f469-1f466", 2342, EmojiCode(0x1f468, 0x1f469, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: man, woman, girl",*/ "1f468-1f469-1f467", 2343, EmojiCode(0x1f468, 0x1f469, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f467)),
+        EmojiRecord("people", /*"family: man, woman, girl, boy",*/ "1f468-1f469-1f467-1f466", 2344, EmojiCode(0x1f468, 0x1f469, 0x1f467, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: man, woman, boy, boy",*/ "1f468-1f469-1f466-1f466", 2345, EmojiCode(0x1f468, 0x1f469, 0x1f466, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f466, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: man, woman, girl, girl",*/ "1f468-1f469-1f467-1f467", 2346, EmojiCode(0x1f468, 0x1f469, 0x1f467, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f467)),
+        EmojiRecord("people", /*"family: woman, woman, boy",*/ "1f469-1f469-1f466", 2347, EmojiCode(0x1f469, 0x1f469, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f469, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: woman, woman, girl",*/ "1f469-1f469-1f467", 2348, EmojiCode(0x1f469, 0x1f469, 0x1f467), EmojiCode(0x1f469, 0x200d, 0x1f469, 0x200d, 0x1f467)),
+        EmojiRecord("people", /*"family: woman, woman, girl, boy",*/ "1f469-1f469-1f467-1f466", 2349, EmojiCode(0x1f469, 0x1f469, 0x1f467, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: woman, woman, boy, boy",*/ "1f469-1f469-1f466-1f466", 2350, EmojiCode(0x1f469, 0x1f469, 0x1f466, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f469, 0x200d, 0x1f466, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: woman, woman, girl, girl",*/ "1f469-1f469-1f467-1f467", 2351, EmojiCode(0x1f469, 0x1f469, 0x1f467, 0x1f467), EmojiCode(0x1f469, 0x200d, 0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f467)),
+        EmojiRecord("people", /*"family: man, man, boy",*/ "1f468-1f468-1f466", 2352, EmojiCode(0x1f468, 0x1f468, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f468, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: man, man, girl",*/ "1f468-1f468-1f467", 2353, EmojiCode(0x1f468, 0x1f468, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f468, 0x200d, 0x1f467)),
+        EmojiRecord("people", /*"family: man, man, girl, boy",*/ "1f468-1f468-1f467-1f466", 2354, EmojiCode(0x1f468, 0x1f468, 0x1f467, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f468, 0x200d, 0x1f467, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: man, man, boy, boy",*/ "1f468-1f468-1f466-1f466", 2355, EmojiCode(0x1f468, 0x1f468, 0x1f466, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f468, 0x200d, 0x1f466, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: man, man, girl, girl",*/ "1f468-1f468-1f467-1f467", 2356, EmojiCode(0x1f468, 0x1f468, 0x1f467, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f468, 0x200d, 0x1f467, 0x200d, 0x1f467)),
+        EmojiRecord("people", /*"family: woman, boy",*/ "1f469-1f466", 2357, EmojiCode(0x1f469, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: woman, girl",*/ "1f469-1f467", 2358, EmojiCode(0x1f469, 0x1f467), EmojiCode(0x1f469, 0x200d, 0x1f467)),
+        EmojiRecord("people", /*"family: woman, girl, boy",*/ "1f469-1f467-1f466", 2359, EmojiCode(0x1f469, 0x1f467, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: woman, boy, boy",*/ "1f469-1f466-1f466", 2360, EmojiCode(0x1f469, 0x1f466, 0x1f466), EmojiCode(0x1f469, 0x200d, 0x1f466, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: woman, girl, girl",*/ "1f469-1f467-1f467", 2361, EmojiCode(0x1f469, 0x1f467, 0x1f467), EmojiCode(0x1f469, 0x200d, 0x1f467, 0x200d, 0x1f467)),
+        EmojiRecord("people", /*"family: man, boy",*/ "1f468-1f466", 2362, EmojiCode(0x1f468, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: man, girl",*/ "1f468-1f467", 2363, EmojiCode(0x1f468, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f467)),
+        EmojiRecord("people", /*"family: man, girl, boy",*/ "1f468-1f467-1f466", 2364, EmojiCode(0x1f468, 0x1f467, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f467, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: man, boy, boy",*/ "1f468-1f466-1f466", 2365, EmojiCode(0x1f468, 0x1f466, 0x1f466), EmojiCode(0x1f468, 0x200d, 0x1f466, 0x200d, 0x1f466)),
+        EmojiRecord("people", /*"family: man, girl, girl",*/ "1f468-1f467-1f467", 2366, EmojiCode(0x1f468, 0x1f467, 0x1f467), EmojiCode(0x1f468, 0x200d, 0x1f467, 0x200d, 0x1f467)),
+        EmojiRecord("people", /*"coat",*/ "1f9e5", 2367, EmojiCode(0x1f9e5)),
+        EmojiRecord("people", /*"woman’s clothes",*/ "1f45a", 2368, EmojiCode(0x1f45a)),
+        EmojiRecord("people", /*"t-shirt",*/ "1f455", 2369, EmojiCode(0x1f455)),
+        EmojiRecord("people", /*"jeans",*/ "1f456", 2370, EmojiCode(0x1f456)),
+        EmojiRecord("people", /*"necktie",*/ "1f454", 2371, EmojiCode(0x1f454)),
+        EmojiRecord("people", /*"dress",*/ "1f457", 2372, EmojiCode(0x1f457)),
+        EmojiRecord("people", /*"bikini",*/ "1f459", 2373, EmojiCode(0x1f459)),
+        EmojiRecord("people", /*"kimono",*/ "1f458", 2374, EmojiCode(0x1f458)),
+        EmojiRecord("people", /*"lab coat",*/ "1f97c", 2375, EmojiCode(0x1f97c)),
+        EmojiRecord("people", /*"high-heeled shoe",*/ "1f460", 2376, EmojiCode(0x1f460)),
+        EmojiRecord("people", /*"woman’s sandal",*/ "1f461", 2377, EmojiCode(0x1f461)),
+        EmojiRecord("people", /*"woman’s boot",*/ "1f462", 2378, EmojiCode(0x1f462)),
+        EmojiRecord("people", /*"man’s shoe",*/ "1f45e", 2379, EmojiCode(0x1f45e)),
+        EmojiRecord("people", /*"running shoe",*/ "1f45f", 2380, EmojiCode(0x1f45f)),
+        EmojiRecord("people", /*"hiking boot",*/ "1f97e", 2381, EmojiCode(0x1f97e)),
+        EmojiRecord("people", /*"woman’s flat shoe",*/ "1f97f", 2382, EmojiCode(0x1f97f)),
+        EmojiRecord("people", /*"socks",*/ "1f9e6", 2383, EmojiCode(0x1f9e6)),
+        EmojiRecord("people", /*"gloves",*/ "1f9e4", 2384, EmojiCode(0x1f9e4)),
+        EmojiRecord("people", /*"scarf",*/ "1f9e3", 2385, EmojiCode(0x1f9e3)),
+        EmojiRecord("people", /*"top hat",*/ "1f3a9", 2386, EmojiCode(0x1f3a9)),
+        EmojiRecord("people", /*"billed cap",*/ "1f9e2", 2387, EmojiCode(0x1f9e2)),
+        EmojiRecord("people", /*"woman’s hat",*/ "1f452", 2388, EmojiCode(0x1f452)),
+        EmojiRecord("people", /*"graduation cap",*/ "1f393", 2389, EmojiCode(0x1f393), EmojiCode(0x1f393, 0xfe0f)),
+        EmojiRecord("people", /*"rescue worker’s helmet",*/ "26d1", 2390, EmojiCode(0x26d1), EmojiCode(0x26d1, 0xfe0f)),
+        EmojiRecord("people", /*"crown",*/ "1f451", 2391, EmojiCode(0x1f451)),
+        EmojiRecord("people", /*"clutch bag",*/ "1f45d", 2392, EmojiCode(0x1f45d)),
+        EmojiRecord("people", /*"purse",*/ "1f45b", 2393, EmojiCode(0x1f45b)),
+        EmojiRecord("people", /*"handbag",*/ "1f45c", 2394, EmojiCode(0x1f45c)),
+        EmojiRecord("people", /*"briefcase",*/ "1f4bc", 2395, EmojiCode(0x1f4bc)),
+        EmojiRecord("people", /*"school backpack",*/ "1f392", 2396, EmojiCode(0x1f392)),
+        EmojiRecord("people", /*"glasses",*/ "1f453", 2397, EmojiCode(0x1f453), EmojiCode(0x1f453, 0xfe0f)),
+        EmojiRecord("people", /*"sunglasses",*/ "1f576", 2398, EmojiCode(0x1f576), EmojiCode(0x1f576, 0xfe0f)),
+        EmojiRecord("people", /*"goggles",*/ "1f97d", 2399, EmojiCode(0x1f97d)),
+        EmojiRecord("people", /*"closed umbrella",*/ "1f302", 2400, EmojiCode(0x1f302)),
+        EmojiRecord("people", /*"red-haired",*/ "1f9b0", 2401, EmojiCode(0x1f9b0)),
+        EmojiRecord("people", /*"curly-haired",*/ "1f9b1", 2402, EmojiCode(0x1f9b1)),
+        EmojiRecord("people", /*"white-haired",*/ "1f9b3", 2403, EmojiCode(0x1f9b3)),
+        EmojiRecord("people", /*"bald",*/ "1f9b2", 2404, EmojiCode(0x1f9b2)),
+        EmojiRecord("regional", /*"regional indicator symbol letter z",*/ "1f1ff", 2405, EmojiCode(0x1f1ff)),
+        EmojiRecord("regional", /*"regional indicator symbol letter y",*/ "1f1fe", 2406, EmojiCode(0x1f1fe)),
+        EmojiRecord("regional", /*"regional indicator symbol letter x",*/ "1f1fd", 2407, EmojiCode(0x1f1fd)),
+        EmojiRecord("regional", /*"regional indicator symbol letter w",*/ "1f1fc", 2408, EmojiCode(0x1f1fc)),
+        EmojiRecord("regional", /*"regional indicator symbol letter v",*/ "1f1fb", 2409, EmojiCode(0x1f1fb)),
+        EmojiRecord("regional", /*"regional indicator symbol letter u",*/ "1f1fa", 2410, EmojiCode(0x1f1fa)),
+        EmojiRecord("regional", /*"regional indicator symbol letter t",*/ "1f1f9", 2411, EmojiCode(0x1f1f9)),
+        EmojiRecord("regional", /*"regional indicator symbol letter s",*/ "1f1f8", 2412, EmojiCode(0x1f1f8)),
+        EmojiRecord("regional", /*"regional indicator symbol letter r",*/ "1f1f7", 2413, EmojiCode(0x1f1f7)),
+        EmojiRecord("regional", /*"regional indicator symbol letter q",*/ "1f1f6", 2414, EmojiCode(0x1f1f6)),
+        EmojiRecord("regional", /*"regional indicator symbol letter p",*/ "1f1f5", 2415, EmojiCode(0x1f1f5)),
+        EmojiRecord("regional", /*"regional indicator symbol letter o",*/ "1f1f4", 2416, EmojiCode(0x1f1f4)),
+        EmojiRecord("regional", /*"regional indicator symbol letter n",*/ "1f1f3", 2417, EmojiCode(0x1f1f3)),
+        EmojiRecord("regional", /*"regional indicator symbol letter m",*/ "1f1f2", 2418, EmojiCode(0x1f1f2)),
+        EmojiRecord("regional", /*"regional indicator symbol letter l",*/ "1f1f1", 2419, EmojiCode(0x1f1f1)),
+        EmojiRecord("regional", /*"regional indicator symbol letter k",*/ "1f1f0", 2420, EmojiCode(0x1f1f0)),
+        EmojiRecord("regional", /*"regional indicator symbol letter j",*/ "1f1ef", 2421, EmojiCode(0x1f1ef)),
+        EmojiRecord("regional", /*"regional indicator symbol letter i",*/ "1f1ee", 2422, EmojiCode(0x1f1ee)),
+        EmojiRecord("regional", /*"regional indicator symbol letter h",*/ "1f1ed", 2423, EmojiCode(0x1f1ed)),
+        EmojiRecord("regional", /*"regional indicator symbol letter g",*/ "1f1ec", 2424, EmojiCode(0x1f1ec)),
+        EmojiRecord("regional", /*"regional indicator symbol letter f",*/ "1f1eb", 2425, EmojiCode(0x1f1eb)),
+        EmojiRecord("regional", /*"regional indicator symbol letter e",*/ "1f1ea", 2426, EmojiCode(0x1f1ea)),
+        EmojiRecord("regional", /*"regional indicator symbol letter d",*/ "1f1e9", 2427, EmojiCode(0x1f1e9)),
+        EmojiRecord("regional", /*"regional indicator symbol letter c",*/ "1f1e8", 2428, EmojiCode(0x1f1e8)),
+        EmojiRecord("regional", /*"regional indicator symbol letter b",*/ "1f1e7", 2429, EmojiCode(0x1f1e7)),
+        EmojiRecord("regional", /*"regional indicator symbol letter a",*/ "1f1e6", 2430, EmojiCode(0x1f1e6)),
+        EmojiRecord("travel", /*"automobile",*/ "1f697", 2431, EmojiCode(0x1f697)),
+        EmojiRecord("travel", /*"taxi",*/ "1f695", 2432, EmojiCode(0x1f695)),
+        EmojiRecord("travel", /*"sport utility vehicle",*/ "1f699", 2433, EmojiCode(0x1f699)),
+        EmojiRecord("travel", /*"bus",*/ "1f68c", 2434, EmojiCode(0x1f68c)),
+        EmojiRecord("travel", /*"trolleybus",*/ "1f68e", 2435, EmojiCode(0x1f68e)),
+        EmojiRecord("travel", /*"racing car",*/ "1f3ce", 2436, EmojiCode(0x1f3ce), EmojiCode(0x1f3ce, 0xfe0f)),
+        EmojiRecord("travel", /*"police car",*/ "1f693", 2437, EmojiCode(0x1f693)),
+        EmojiRecord("travel", /*"ambulance",*/ "1f691", 2438, EmojiCode(0x1f691), EmojiCode(0x1f691, 0xfe0f)),
+        EmojiRecord("travel", /*"fire engine",*/ "1f692", 2439, EmojiCode(0x1f692)),
+        EmojiRecord("travel", /*"minibus",*/ "1f690", 2440, EmojiCode(0x1f690)),
+        EmojiRecord("travel", /*"delivery truck",*/ "1f69a", 2441, EmojiCode(0x1f69a)),
+        EmojiRecord("travel", /*"articulated lorry",*/ "1f69b", 2442, EmojiCode(0x1f69b)),
+        EmojiRecord("travel", /*"tractor",*/ "1f69c", 2443, EmojiCode(0x1f69c)),
+        EmojiRecord("travel", /*"kick scooter",*/ "1f6f4", 2444, EmojiCode(0x1f6f4)),
+        EmojiRecord("travel", /*"bicycle",*/ "1f6b2", 2445, EmojiCode(0x1f6b2), EmojiCode(0x1f6b2, 0xfe0f)),
+        EmojiRecord("travel", /*"motor scooter",*/ "1f6f5", 2446, EmojiCode(0x1f6f5)),
+        EmojiRecord("travel", /*"motorcycle",*/ "1f3cd", 2447, EmojiCode(0x1f3cd), EmojiCode(0x1f3cd, 0xfe0f)),
+        EmojiRecord("travel", /*"police car light",*/ "1f6a8", 2448, EmojiCode(0x1f6a8)),
+        EmojiRecord("travel", /*"oncoming police car",*/ "1f694", 2449, EmojiCode(0x1f694), EmojiCode(0x1f694, 0xfe0f)),
+        EmojiRecord("travel", /*"oncoming bus",*/ "1f68d", 2450, EmojiCode(0x1f68d), EmojiCode(0x1f68d, 0xfe0f)),
+        EmojiRecord("travel", /*"oncoming automobile",*/ "1f698", 2451, EmojiCode(0x1f698), EmojiCode(0x1f698, 0xfe0f)),
+        EmojiRecord("travel", /*"oncoming taxi",*/ "1f696", 2452, EmojiCode(0x1f696)),
+        EmojiRecord("travel", /*"aerial tramway",*/ "1f6a1", 2453, EmojiCode(0x1f6a1)),
+        EmojiRecord("travel", /*"mountain cableway",*/ "1f6a0", 2454, EmojiCode(0x1f6a0)),
+        EmojiRecord("travel", /*"suspension railway",*/ "1f69f", 2455, EmojiCode(0x1f69f)),
+        EmojiRecord("travel", /*"railway car",*/ "1f683", 2456, EmojiCode(0x1f683)),
+        EmojiRecord("travel", /*"tram car",*/ "1f68b", 2457, EmojiCode(0x1f68b)),
+        EmojiRecord("travel", /*"mountain railway",*/ "1f69e", 2458, EmojiCode(0x1f69e)),
+        EmojiRecord("travel", /*"monorail",*/ "1f69d", 2459, EmojiCode(0x1f69d)),
+        EmojiRecord("travel", /*"high-speed train",*/ "1f684", 2460, EmojiCode(0x1f684)),
+        EmojiRecord("travel", /*"bullet train",*/ "1f685", 2461, EmojiCode(0x1f685)),
+        EmojiRecord("travel", /*"light rail",*/ "1f688", 2462, EmojiCode(0x1f688)),
+        EmojiRecord("travel", /*"locomotive",*/ "1f682", 2463, EmojiCode(0x1f682)),
+        EmojiRecord("travel", /*"train",*/ "1f686", 2464, EmojiCode(0x1f686)),
+        EmojiRecord("travel", /*"metro",*/ "1f687", 2465, EmojiCode(0x1f687), EmojiCode(0x1f687, 0xfe0f)),
+        EmojiRecord("travel", /*"tram",*/ "1f68a", 2466, EmojiCode(0x1f68a)),
+        EmojiRecord("travel", /*"station",*/ "1f689", 2467, EmojiCode(0x1f689)),
+        EmojiRecord("travel", /*"airplane",*/ "2708", 2468, EmojiCode(0x2708), EmojiCode(0x2708, 0xfe0f)),
+        EmojiRecord("travel", /*"airplane departure",*/ "1f6eb", 2469, EmojiCode(0x1f6eb)),
+        EmojiRecord("travel", /*"airplane arrival",*/ "1f6ec", 2470, EmojiCode(0x1f6ec)),
+        EmojiRecord("travel", /*"small airplane",*/ "1f6e9", 2471, EmojiCode(0x1f6e9), EmojiCode(0x1f6e9, 0xfe0f)),
+        EmojiRecord("travel", /*"seat",*/ "1f4ba", 2472, EmojiCode(0x1f4ba)),
+        EmojiRecord("travel", /*"luggage",*/ "1f9f3", 2473, EmojiCode(0x1f9f3)),
+        EmojiRecord("travel", /*"satellite",*/ "1f6f0", 2474, EmojiCode(0x1f6f0), EmojiCode(0x1f6f0, 0xfe0f)),
+        EmojiRecord("travel", /*"rocket",*/ "1f680", 2475, EmojiCode(0x1f680)),
+        EmojiRecord("travel", /*"flying saucer",*/ "1f6f8", 2476, EmojiCode(0x1f6f8)),
+        EmojiRecord("travel", /*"helicopter",*/ "1f681", 2477, EmojiCode(0x1f681)),
+        EmojiRecord("travel", /*"canoe",*/ "1f6f6", 2478, EmojiCode(0x1f6f6)),
+        EmojiRecord("travel", /*"sailboat",*/ "26f5", 2479, EmojiCode(0x26f5), EmojiCode(0x26f5, 0xfe0f)),
+        EmojiRecord("travel", /*"speedboat",*/ "1f6a4", 2480, EmojiCode(0x1f6a4)),
+        EmojiRecord("travel", /*"motor boat",*/ "1f6e5", 2481, EmojiCode(0x1f6e5), EmojiCode(0x1f6e5, 0xfe0f)),
+        EmojiRecord("travel", /*"passenger ship",*/ "1f6f3", 2482, EmojiCode(0x1f6f3), EmojiCode(0x1f6f3, 0xfe0f)),
+        EmojiRecord("travel", /*"ferry",*/ "26f4", 2483, EmojiCode(0x26f4), EmojiCode(0x26f4, 0xfe0f)),
+        EmojiRecord("travel", /*"ship",*/ "1f6a2", 2484, EmojiCode(0x1f6a2)),
+        EmojiRecord("travel", /*"anchor",*/ "2693", 2485, EmojiCode(0x2693), EmojiCode(0x2693, 0xfe0f)),
+        EmojiRecord("travel", /*"fuel pump",*/ "26fd", 2486, EmojiCode(0x26fd), EmojiCode(0x26fd, 0xfe0f)),
+        EmojiRecord("travel", /*"construction",*/ "1f6a7", 2487, EmojiCode(0x1f6a7)),
+        EmojiRecord("travel", /*"vertical traffic light",*/ "1f6a6", 2488, EmojiCode(0x1f6a6)),
+        EmojiRecord("travel", /*"horizontal traffic light",*/ "1f6a5", 2489, EmojiCode(0x1f6a5)),
+        EmojiRecord("travel", /*"bus stop",*/ "1f68f", 2490, EmojiCode(0x1f68f)),
+        EmojiRecord("travel", /*"world map",*/ "1f5fa", 2491, EmojiCode(0x1f5fa), EmojiCode(0x1f5fa, 0xfe0f)),
+        EmojiRecord("travel", /*"moai",*/ "1f5ff", 2492, EmojiCode(0x1f5ff)),
+        EmojiRecord("travel", /*"Statue of Liberty",*/ "1f5fd", 2493, EmojiCode(0x1f5fd)),
+        EmojiRecord("travel", /*"Tokyo tower",*/ "1f5fc", 2494, EmojiCode(0x1f5fc)),
+        EmojiRecord("travel", /*"castle",*/ "1f3f0", 2495, EmojiCode(0x1f3f0)),
+        EmojiRecord("travel", /*"Japanese castle",*/ "1f3ef", 2496, EmojiCode(0x1f3ef)),
+        EmojiRecord("travel", /*"stadium",*/ "1f3df", 2497, EmojiCode(0x1f3df), EmojiCode(0x1f3df, 0xfe0f)),
+        EmojiRecord("travel", /*"ferris wheel",*/ "1f3a1", 2498, EmojiCode(0x1f3a1)),
+        EmojiRecord("travel", /*"roller coaster",*/ "1f3a2", 2499, EmojiCode(0x1f3a2)),
+        EmojiRecord("travel", /*"carousel horse",*/ "1f3a0", 2500, EmojiCode(0x1f3a0)),
+        EmojiRecord("travel", /*"fountain",*/ "26f2", 2501, EmojiCode(0x26f2), EmojiCode(0x26f2, 0xfe0f)),
+        EmojiRecord("travel", /*"umbrella on ground",*/ "26f1", 2502, EmojiCode(0x26f1), EmojiCode(0x26f1, 0xfe0f)),
+        EmojiRecord("travel", /*"beach with umbrella",*/ "1f3d6", 2503, EmojiCode(0x1f3d6), EmojiCode(0x1f3d6, 0xfe0f)),
+        EmojiRecord("travel", /*"desert island",*/ "1f3dd", 2504, EmojiCode(0x1f3dd), EmojiCode(0x1f3dd, 0xfe0f)),
+        EmojiRecord("travel", /*"desert",*/ "1f3dc", 2505, EmojiCode(0x1f3dc), EmojiCode(0x1f3dc, 0xfe0f)),
+        EmojiRecord("travel", /*"volcano",*/ "1f30b", 2506, EmojiCode(0x1f30b)),
+        EmojiRecord("travel", /*"mountain",*/ "26f0", 2507, EmojiCode(0x26f0), EmojiCode(0x26f0, 0xfe0f)),
+        EmojiRecord("travel", /*"snow-capped mountain",*/ "1f3d4", 2508, EmojiCode(0x1f3d4), EmojiCode(0x1f3d4, 0xfe0f)),
+        EmojiRecord("travel", /*"mount fuji",*/ "1f5fb", 2509, EmojiCode(0x1f5fb)),
+        EmojiRecord("travel", /*"camping",*/ "1f3d5", 2510, EmojiCode(0x1f3d5), EmojiCode(0x1f3d5, 0xfe0f)),
+        EmojiRecord("travel", /*"tent",*/ "26fa", 2511, EmojiCode(0x26fa), EmojiCode(0x26fa, 0xfe0f)),
+        EmojiRecord("travel", /*"house",*/ "1f3e0", 2512, EmojiCode(0x1f3e0), EmojiCode(0x1f3e0, 0xfe0f)),
+        EmojiRecord("travel", /*"house with garden",*/ "1f3e1", 2513, EmojiCode(0x1f3e1)),
+        EmojiRecord("travel", /*"houses",*/ "1f3d8", 2514, EmojiCode(0x1f3d8), EmojiCode(0x1f3d8, 0xfe0f)),
+        EmojiRecord("travel", /*"derelict house",*/ "1f3da", 2515, EmojiCode(0x1f3da), EmojiCode(0x1f3da, 0xfe0f)),
+        EmojiRecord("travel", /*"building construction",*/ "1f3d7", 2516, EmojiCode(0x1f3d7), EmojiCode(0x1f3d7, 0xfe0f)),
+        EmojiRecord("travel", /*"factory",*/ "1f3ed", 2517, EmojiCode(0x1f3ed), EmojiCode(0x1f3ed, 0xfe0f)),
+        EmojiRecord("travel", /*"office building",*/ "1f3e2", 2518, EmojiCode(0x1f3e2)),
+        EmojiRecord("travel", /*"department store",*/ "1f3ec", 2519, EmojiCode(0x1f3ec)),
+        EmojiRecord("travel", /*"Japanese post office",*/ "1f3e3", 2520, EmojiCode(0x1f3e3)),
+        EmojiRecord("travel", /*"post office",*/ "1f3e4", 2521, EmojiCode(0x1f3e4)),
+        EmojiRecord("travel", /*"hospital",*/ "1f3e5", 2522, EmojiCode(0x1f3e5)),
+        EmojiRecord("travel", /*"bank",*/ "1f3e6", 2523, EmojiCode(0x1f3e6)),
+        EmojiRecord("travel", /*"hotel",*/ "1f3e8", 2524, EmojiCode(0x1f3e8)),
+        EmojiRecord("travel", /*"convenience store",*/ "1f3ea", 2525, EmojiCode(0x1f3ea)),
+        EmojiRecord("travel", /*"school",*/ "1f3eb", 2526, EmojiCode(0x1f3eb)),
+        EmojiRecord("travel", /*"love hotel",*/ "1f3e9", 2527, EmojiCode(0x1f3e9)),
+        EmojiRecord("travel", /*"wedding",*/ "1f492", 2528, EmojiCode(0x1f492)),
+        EmojiRecord("travel", /*"classical building",*/ "1f3db", 2529, EmojiCode(0x1f3db), EmojiCode(0x1f3db, 0xfe0f)),
+        EmojiRecord("travel", /*"church",*/ "26ea", 2530, EmojiCode(0x26ea), EmojiCode(0x26ea, 0xfe0f)),
+        EmojiRecord("travel", /*"mosque",*/ "1f54c", 2531, EmojiCode(0x1f54c)),
+        EmojiRecord("travel", /*"synagogue",*/ "1f54d", 2532, EmojiCode(0x1f54d)),
+        EmojiRecord("travel", /*"kaaba",*/ "1f54b", 2533, EmojiCode(0x1f54b)),
+        EmojiRecord("travel", /*"shinto shrine",*/ "26e9", 2534, EmojiCode(0x26e9), EmojiCode(0x26e9, 0xfe0f)),
+        EmojiRecord("travel", /*"railway track",*/ "1f6e4", 2535, EmojiCode(0x1f6e4), EmojiCode(0x1f6e4, 0xfe0f)),
+        EmojiRecord("travel", /*"motorway",*/ "1f6e3", 2536, EmojiCode(0x1f6e3), EmojiCode(0x1f6e3, 0xfe0f)),
+        EmojiRecord("travel", /*"map of Japan",*/ "1f5fe", 2537, EmojiCode(0x1f5fe)),
+        EmojiRecord("travel", /*"moon viewing ceremony",*/ "1f391", 2538, EmojiCode(0x1f391)),
+        EmojiRecord("travel", /*"national park",*/ "1f3de", 2539, EmojiCode(0x1f3de), EmojiCode(0x1f3de, 0xfe0f)),
+        EmojiRecord("travel", /*"sunrise",*/ "1f305", 2540, EmojiCode(0x1f305)),
+        EmojiRecord("travel", /*"sunrise over mountains",*/ "1f304", 2541, EmojiCode(0x1f304)),
+        EmojiRecord("travel", /*"shooting star",*/ "1f320", 2542, EmojiCode(0x1f320)),
+        EmojiRecord("travel", /*"sparkler",*/ "1f387", 2543, EmojiCode(0x1f387)),
+        EmojiRecord("travel", /*"fireworks",*/ "1f386", 2544, EmojiCode(0x1f386)),
+        EmojiRecord("travel", /*"firecracker",*/ "1f9e8", 2545, EmojiCode(0x1f9e8)),
+        EmojiRecord("travel", /*"sunset",*/ "1f307", 2546, EmojiCode(0x1f307)),
+        EmojiRecord("travel", /*"cityscape at dusk",*/ "1f306", 2547, EmojiCode(0x1f306)),
+        EmojiRecord("travel", /*"cityscape",*/ "1f3d9", 2548, EmojiCode(0x1f3d9), EmojiCode(0x1f3d9, 0xfe0f)),
+        EmojiRecord("travel", /*"night with stars",*/ "1f303", 2549, EmojiCode(0x1f303)),
+        EmojiRecord("travel", /*"milky way",*/ "1f30c", 2550, EmojiCode(0x1f30c)),
+        EmojiRecord("travel", /*"bridge at night",*/ "1f309", 2551, EmojiCode(0x1f309)),
+        EmojiRecord("objects", /*"locked",*/ "1f512", 2552, EmojiCode(0x1f512), EmojiCode(0x1f512, 0xfe0f)),
+        EmojiRecord("objects", /*"unlocked",*/ "1f513", 2553, EmojiCode(0x1f513), EmojiCode(0x1f513, 0xfe0f)),
+        EmojiRecord("travel", /*"foggy",*/ "1f301", 2554, EmojiCode(0x1f301)),
+        EmojiRecord("flags", /*"white flag",*/ "1f3f3", 2555, EmojiCode(0x1f3f3), EmojiCode(0x1f3f3, 0xfe0f)),
+        EmojiRecord("flags", /*"black flag",*/ "1f3f4", 2556, EmojiCode(0x1f3f4)),
+        EmojiRecord("flags", /*"chequered flag",*/ "1f3c1", 2557, EmojiCode(0x1f3c1)),
+        EmojiRecord("flags", /*"triangular flag",*/ "1f6a9", 2558, EmojiCode(0x1f6a9)),
+        EmojiRecord("flags", /*"rainbow flag",*/ "1f3f3-1f308", 2559, EmojiCode(0x1f3f3, 0x1f308), EmojiCode(0x1f3f3, 0xfe0f, 0x200d, 0x1f308)),
+        EmojiRecord("flags", /*"pirate flag",*/ "1f3f4-2620", 2560, EmojiCode(0x1f3f4, 0x2620), EmojiCode(0x1f3f4, 0x200d, 0x2620, 0xfe0f)),
+        EmojiRecord("flags", /*"Afghanistan",*/ "1f1e6-1f1eb", 2561, EmojiCode(0x1f1e6, 0x1f1eb)),
+        EmojiRecord("flags", /*"Åland Islands",*/ "1f1e6-1f1fd", 2562, EmojiCode(0x1f1e6, 0x1f1fd)),
+        EmojiRecord("flags", /*"Albania",*/ "1f1e6-1f1f1", 2563, EmojiCode(0x1f1e6, 0x1f1f1)),
+        EmojiRecord("flags", /*"Algeria",*/ "1f1e9-1f1ff", 2564, EmojiCode(0x1f1e9, 0x1f1ff)),
+        EmojiRecord("flags", /*"American Samoa",*/ "1f1e6-1f1f8", 2565, EmojiCode(0x1f1e6, 0x1f1f8)),
+        EmojiRecord("flags", /*"Andorra",*/ "1f1e6-1f1e9", 2566, EmojiCode(0x1f1e6, 0x1f1e9)),
+        EmojiRecord("flags", /*"Angola",*/ "1f1e6-1f1f4", 2567, EmojiCode(0x1f1e6, 0x1f1f4)),
+        EmojiRecord("flags", /*"Anguilla",*/ "1f1e6-1f1ee", 2568, EmojiCode(0x1f1e6, 0x1f1ee)),
+        EmojiRecord("flags", /*"Antarctica",*/ "1f1e6-1f1f6", 2569, EmojiCode(0x1f1e6, 0x1f1f6)),
+        EmojiRecord("flags", /*"Antigua &amp; Barbuda",*/ "1f1e6-1f1ec", 2570, EmojiCode(0x1f1e6, 0x1f1ec)),
+        EmojiRecord("flags", /*"Argentina",*/ "1f1e6-1f1f7", 2571, EmojiCode(0x1f1e6, 0x1f1f7)),
+        EmojiRecord("flags", /*"Armenia",*/ "1f1e6-1f1f2", 2572, EmojiCode(0x1f1e6, 0x1f1f2)),
+        EmojiRecord("flags", /*"Aruba",*/ "1f1e6-1f1fc", 2573, EmojiCode(0x1f1e6, 0x1f1fc)),
+        EmojiRecord("flags", /*"Australia",*/ "1f1e6-1f1fa", 2574, EmojiCode(0x1f1e6, 0x1f1fa)),
+        EmojiRecord("flags", /*"Austria",*/ "1f1e6-1f1f9", 2575, EmojiCode(0x1f1e6, 0x1f1f9)),
+        EmojiRecord("flags", /*"Azerbaijan",*/ "1f1e6-1f1ff", 2576, EmojiCode(0x1f1e6, 0x1f1ff)),
+        EmojiRecord("flags", /*"Bahamas",*/ "1f1e7-1f1f8", 2577, EmojiCode(0x1f1e7, 0x1f1f8)),
+        EmojiRecord("flags", /*"Bahrain",*/ "1f1e7-1f1ed", 2578, EmojiCode(0x1f1e7, 0x1f1ed)),
+        EmojiRecord("flags", /*"Bangladesh",*/ "1f1e7-1f1e9", 2579, EmojiCode(0x1f1e7, 0x1f1e9)),
+        EmojiRecord("flags", /*"Barbados",*/ "1f1e7-1f1e7", 2580, EmojiCode(0x1f1e7, 0x1f1e7)),
+        EmojiRecord("flags", /*"Belarus",*/ "1f1e7-1f1fe", 2581, EmojiCode(0x1f1e7, 0x1f1fe)),
+        EmojiRecord("flags", /*"Belgium",*/ "1f1e7-1f1ea", 2582, EmojiCode(0x1f1e7, 0x1f1ea)),
+        EmojiRecord("flags", /*"Belize",*/ "1f1e7-1f1ff", 2583, EmojiCode(0x1f1e7, 0x1f1ff)),
+        EmojiRecord("flags", /*"Benin",*/ "1f1e7-1f1ef", 2584, EmojiCode(0x1f1e7, 0x1f1ef)),
+        EmojiRecord("flags", /*"Bermuda",*/ "1f1e7-1f1f2", 2585, EmojiCode(0x1f1e7, 0x1f1f2)),
+        EmojiRecord("flags", /*"Bhutan",*/ "1f1e7-1f1f9", 2586, EmojiCode(0x1f1e7, 0x1f1f9)),
+        EmojiRecord("flags", /*"Bolivia",*/ "1f1e7-1f1f4", 2587, EmojiCode(0x1f1e7, 0x1f1f4)),
+        EmojiRecord("flags", /*"Bosnia &amp; Herzegovina",*/ "1f1e7-1f1e6", 2588, EmojiCode(0x1f1e7, 0x1f1e6)),
+        EmojiRecord("flags", /*"Botswana",*/ "1f1e7-1f1fc", 2589, EmojiCode(0x1f1e7, 0x1f1fc)),
+        EmojiRecord("flags", /*"Brazil",*/ "1f1e7-1f1f7", 2590, EmojiCode(0x1f1e7, 0x1f1f7)),
+        EmojiRecord("flags", /*"British Indian Ocean Territory",*/ "1f1ee-1f1f4", 2591, EmojiCode(0x1f1ee, 0x1f1f4)),
+        EmojiRecord("flags", /*"British Virgin Islands",*/ "1f1fb-1f1ec", 2592, EmojiCode(0x1f1fb, 0x1f1ec)),
+        EmojiRecord("flags", /*"Brunei",*/ "1f1e7-1f1f3", 2593, EmojiCode(0x1f1e7, 0x1f1f3)),
+        EmojiRecord("flags", /*"Bulgaria",*/ "1f1e7-1f1ec", 2594, EmojiCode(0x1f1e7, 0x1f1ec)),
+        EmojiRecord("flags", /*"Burkina Faso",*/ "1f1e7-1f1eb", 2595, EmojiCode(0x1f1e7, 0x1f1eb)),
+        EmojiRecord("flags", /*"Burundi",*/ "1f1e7-1f1ee", 2596, EmojiCode(0x1f1e7, 0x1f1ee)),
+        EmojiRecord("flags", /*"Cambodia",*/ "1f1f0-1f1ed", 2597, EmojiCode(0x1f1f0, 0x1f1ed)),
+        EmojiRecord("flags", /*"Cameroon",*/ "1f1e8-1f1f2", 2598, EmojiCode(0x1f1e8, 0x1f1f2)),
+        EmojiRecord("flags", /*"Canada",*/ "1f1e8-1f1e6", 2599, EmojiCode(0x1f1e8, 0x1f1e6)),
+        EmojiRecord("flags", /*"Canary Islands",*/ "1f1ee-1f1e8", 2600, EmojiCode(0x1f1ee, 0x1f1e8)),
+        EmojiRecord("flags", /*"Cape Verde",*/ "1f1e8-1f1fb", 2601, EmojiCode(0x1f1e8, 0x1f1fb)),
+        EmojiRecord("flags", /*"Caribbean Netherlands",*/ "1f1e7-1f1f6", 2602, EmojiCode(0x1f1e7, 0x1f1f6)),
+        EmojiRecord("flags", /*"Cayman Islands",*/ "1f1f0-1f1fe", 2603, EmojiCode(0x1f1f0, 0x1f1fe)),
+        EmojiRecord("flags", /*"Central African Republic",*/ "1f1e8-1f1eb", 2604, EmojiCode(0x1f1e8, 0x1f1eb)),
+        EmojiRecord("flags", /*"Chad",*/ "1f1f9-1f1e9", 2605, EmojiCode(0x1f1f9, 0x1f1e9)),
+        EmojiRecord("flags", /*"Chile",*/ "1f1e8-1f1f1", 2606, EmojiCode(0x1f1e8, 0x1f1f1)),
+        EmojiRecord("flags", /*"China",*/ "1f1e8-1f1f3", 2607, EmojiCode(0x1f1e8, 0x1f1f3)),
+        EmojiRecord("flags", /*"Christmas Island",*/ "1f1e8-1f1fd", 2608, EmojiCode(0x1f1e8, 0x1f1fd)),
+        EmojiRecord("flags", /*"Cocos (Keeling) Islands",*/ "1f1e8-1f1e8", 2609, EmojiCode(0x1f1e8, 0x1f1e8)),
+        EmojiRecord("flags", /*"Colombia",*/ "1f1e8-1f1f4", 2610, EmojiCode(0x1f1e8, 0x1f1f4)),
+        EmojiRecord("flags", /*"Comoros",*/ "1f1f0-1f1f2", 2611, EmojiCode(0x1f1f0, 0x1f1f2)),
+        EmojiRecord("flags", /*"Congo - Brazzaville",*/ "1f1e8-1f1ec", 2612, EmojiCode(0x1f1e8, 0x1f1ec)),
+        EmojiRecord("flags", /*"Congo - Kinshasa",*/ "1f1e8-1f1e9", 2613, EmojiCode(0x1f1e8, 0x1f1e9)),
+        EmojiRecord("flags", /*"Cook Islands",*/ "1f1e8-1f1f0", 2614, EmojiCode(0x1f1e8, 0x1f1f0)),
+        EmojiRecord("flags", /*"Costa Rica",*/ "1f1e8-1f1f7", 2615, EmojiCode(0x1f1e8, 0x1f1f7)),
+        EmojiRecord("flags", /*"Côte d’Ivoire",*/ "1f1e8-1f1ee", 2616, EmojiCode(0x1f1e8, 0x1f1ee)),
+        EmojiRecord("flags", /*"Croatia",*/ "1f1ed-1f1f7", 2617, EmojiCode(0x1f1ed, 0x1f1f7)),
+        EmojiRecord("flags", /*"Cuba",*/ "1f1e8-1f1fa", 2618, EmojiCode(0x1f1e8, 0x1f1fa)),
+        EmojiRecord("flags", /*"Curaçao",*/ "1f1e8-1f1fc", 2619, EmojiCode(0x1f1e8, 0x1f1fc)),
+        EmojiRecord("flags", /*"Cyprus",*/ "1f1e8-1f1fe", 2620, EmojiCode(0x1f1e8, 0x1f1fe)),
+        EmojiRecord("flags", /*"Czechia",*/ "1f1e8-1f1ff", 2621, EmojiCode(0x1f1e8, 0x1f1ff)),
+        EmojiRecord("flags", /*"Denmark",*/ "1f1e9-1f1f0", 2622, EmojiCode(0x1f1e9, 0x1f1f0)),
+        EmojiRecord("flags", /*"Djibouti",*/ "1f1e9-1f1ef", 2623, EmojiCode(0x1f1e9, 0x1f1ef)),
+        EmojiRecord("flags", /*"Dominica",*/ "1f1e9-1f1f2", 2624, EmojiCode(0x1f1e9, 0x1f1f2)),
+        EmojiRecord("flags", /*"Dominican Republic",*/ "1f1e9-1f1f4", 2625, EmojiCode(0x1f1e9, 0x1f1f4)),
+        EmojiRecord("flags", /*"Ecuador",*/ "1f1ea-1f1e8", 2626, EmojiCode(0x1f1ea, 0x1f1e8)),
+        EmojiRecord("flags", /*"Egypt",*/ "1f1ea-1f1ec", 2627, EmojiCode(0x1f1ea, 0x1f1ec)),
+        EmojiRecord("flags", /*"El Salvador",*/ "1f1f8-1f1fb", 2628, EmojiCode(0x1f1f8, 0x1f1fb)),
+        EmojiRecord("flags", /*"Equatorial Guinea",*/ "1f1ec-1f1f6", 2629, EmojiCode(0x1f1ec, 0x1f1f6)),
+        EmojiRecord("flags", /*"Eritrea",*/ "1f1ea-1f1f7", 2630, EmojiCode(0x1f1ea, 0x1f1f7)),
+        EmojiRecord("flags", /*"Estonia",*/ "1f1ea-1f1ea", 2631, EmojiCode(0x1f1ea, 0x1f1ea)),
+        EmojiRecord("flags", /*"Ethiopia",*/ "1f1ea-1f1f9", 2632, EmojiCode(0x1f1ea, 0x1f1f9)),
+        EmojiRecord("flags", /*"European Union",*/ "1f1ea-1f1fa", 2633, EmojiCode(0x1f1ea, 0x1f1fa)),
+        EmojiRecord("flags", /*"Falkland Islands",*/ "1f1eb-1f1f0", 2634, EmojiCode(0x1f1eb, 0x1f1f0)),
+        EmojiRecord("flags", /*"Faroe Islands",*/ "1f1eb-1f1f4", 2635, EmojiCode(0x1f1eb, 0x1f1f4)),
+        EmojiRecord("flags", /*"Fiji",*/ "1f1eb-1f1ef", 2636, EmojiCode(0x1f1eb, 0x1f1ef)),
+        EmojiRecord("flags", /*"Finland",*/ "1f1eb-1f1ee", 2637, EmojiCode(0x1f1eb, 0x1f1ee)),
+        EmojiRecord("flags", /*"France",*/ "1f1eb-1f1f7", 2638, EmojiCode(0x1f1eb, 0x1f1f7)),
+        EmojiRecord("flags", /*"French Guiana",*/ "1f1ec-1f1eb", 2639, EmojiCode(0x1f1ec, 0x1f1eb)),
+        EmojiRecord("flags", /*"French Polynesia",*/ "1f1f5-1f1eb", 2640, EmojiCode(0x1f1f5, 0x1f1eb)),
+        EmojiRecord("flags", /*"French Southern Territories",*/ "1f1f9-1f1eb", 2641, EmojiCode(0x1f1f9, 0x1f1eb)),
+        EmojiRecord("flags", /*"Gabon",*/ "1f1ec-1f1e6", 2642, EmojiCode(0x1f1ec, 0x1f1e6)),
+        EmojiRecord("flags", /*"Gambia",*/ "1f1ec-1f1f2", 2643, EmojiCode(0x1f1ec, 0x1f1f2)),
+        EmojiRecord("flags", /*"Georgia",*/ "1f1ec-1f1ea", 2644, EmojiCode(0x1f1ec, 0x1f1ea)),
+        EmojiRecord("flags", /*"Germany",*/ "1f1e9-1f1ea", 2645, EmojiCode(0x1f1e9, 0x1f1ea)),
+        EmojiRecord("flags", /*"Ghana",*/ "1f1ec-1f1ed", 2646, EmojiCode(0x1f1ec, 0x1f1ed)),
+        EmojiRecord("flags", /*"Gibraltar",*/ "1f1ec-1f1ee", 2647, EmojiCode(0x1f1ec, 0x1f1ee)),
+        EmojiRecord("flags", /*"Greece",*/ "1f1ec-1f1f7", 2648, EmojiCode(0x1f1ec, 0x1f1f7)),
+        EmojiRecord("flags", /*"Greenland",*/ "1f1ec-1f1f1", 2649, EmojiCode(0x1f1ec, 0x1f1f1)),
+        EmojiRecord("flags", /*"Grenada",*/ "1f1ec-1f1e9", 2650, EmojiCode(0x1f1ec, 0x1f1e9)),
+        EmojiRecord("flags", /*"Guadeloupe",*/ "1f1ec-1f1f5", 2651, EmojiCode(0x1f1ec, 0x1f1f5)),
+        EmojiRecord("flags", /*"Guam",*/ "1f1ec-1f1fa", 2652, EmojiCode(0x1f1ec, 0x1f1fa)),
+        EmojiRecord("flags", /*"Guatemala",*/ "1f1ec-1f1f9", 2653, EmojiCode(0x1f1ec, 0x1f1f9)),
+        EmojiRecord("flags", /*"Guernsey",*/ "1f1ec-1f1ec", 2654, EmojiCode(0x1f1ec, 0x1f1ec)),
+        EmojiRecord("flags", /*"Guinea",*/ "1f1ec-1f1f3", 2655, EmojiCode(0x1f1ec, 0x1f1f3)),
+        EmojiRecord("flags", /*"Guinea-Bissau",*/ "1f1ec-1f1fc", 2656, EmojiCode(0x1f1ec, 0x1f1fc)),
+        EmojiRecord("flags", /*"Guyana",*/ "1f1ec-1f1fe", 2657, EmojiCode(0x1f1ec, 0x1f1fe)),
+        EmojiRecord("flags", /*"Haiti",*/ "1f1ed-1f1f9", 2658, EmojiCode(0x1f1ed, 0x1f1f9)),
+        EmojiRecord("flags", /*"Honduras",*/ "1f1ed-1f1f3", 2659, EmojiCode(0x1f1ed, 0x1f1f3)),
+        EmojiRecord("flags", /*"Hong Kong SAR China",*/ "1f1ed-1f1f0", 2660, EmojiCode(0x1f1ed, 0x1f1f0)),
+        EmojiRecord("flags", /*"Hungary",*/ "1f1ed-1f1fa", 2661, EmojiCode(0x1f1ed, 0x1f1fa)),
+        EmojiRecord("flags", /*"Iceland",*/ "1f1ee-1f1f8", 2662, EmojiCode(0x1f1ee, 0x1f1f8)),
+        EmojiRecord("flags", /*"India",*/ "1f1ee-1f1f3", 2663, EmojiCode(0x1f1ee, 0x1f1f3)),
+        EmojiRecord("flags", /*"Indonesia",*/ "1f1ee-1f1e9", 2664, EmojiCode(0x1f1ee, 0x1f1e9)),
+        EmojiRecord("flags", /*"Iran",*/ "1f1ee-1f1f7", 2665, EmojiCode(0x1f1ee, 0x1f1f7)),
+        EmojiRecord("flags", /*"Iraq",*/ "1f1ee-1f1f6", 2666, EmojiCode(0x1f1ee, 0x1f1f6)),
+        EmojiRecord("flags", /*"Ireland",*/ "1f1ee-1f1ea", 2667, EmojiCode(0x1f1ee, 0x1f1ea)),
+        EmojiRecord("flags", /*"Isle of Man",*/ "1f1ee-1f1f2", 2668, EmojiCode(0x1f1ee, 0x1f1f2)),
+        EmojiRecord("flags", /*"Israel",*/ "1f1ee-1f1f1", 2669, EmojiCode(0x1f1ee, 0x1f1f1)),
+        EmojiRecord("flags", /*"Italy",*/ "1f1ee-1f1f9", 2670, EmojiCode(0x1f1ee, 0x1f1f9)),
+        EmojiRecord("flags", /*"Jamaica",*/ "1f1ef-1f1f2", 2671, EmojiCode(0x1f1ef, 0x1f1f2)),
+        EmojiRecord("flags", /*"Japan",*/ "1f1ef-1f1f5", 2672, EmojiCode(0x1f1ef, 0x1f1f5)),
+        EmojiRecord("flags", /*"crossed flags",*/ "1f38c", 2673, EmojiCode(0x1f38c)),
+        EmojiRecord("flags", /*"Jersey",*/ "1f1ef-1f1ea", 2674, EmojiCode(0x1f1ef, 0x1f1ea)),
+        EmojiRecord("flags", /*"Jordan",*/ "1f1ef-1f1f4", 2675, EmojiCode(0x1f1ef, 0x1f1f4)),
+        EmojiRecord("flags", /*"Kazakhstan",*/ "1f1f0-1f1ff", 2676, EmojiCode(0x1f1f0, 0x1f1ff)),
+        EmojiRecord("flags", /*"Kenya",*/ "1f1f0-1f1ea", 2677, EmojiCode(0x1f1f0, 0x1f1ea)),
+        EmojiRecord("flags", /*"Kiribati",*/ "1f1f0-1f1ee", 2678, EmojiCode(0x1f1f0, 0x1f1ee)),
+        EmojiRecord("flags", /*"Kosovo",*/ "1f1fd-1f1f0", 2679, EmojiCode(0x1f1fd, 0x1f1f0)),
+        EmojiRecord("flags", /*"Kuwait",*/ "1f1f0-1f1fc", 2680, EmojiCode(0x1f1f0, 0x1f1fc)),
+        EmojiRecord("flags", /*"Kyrgyzstan",*/ "1f1f0-1f1ec", 2681, EmojiCode(0x1f1f0, 0x1f1ec)),
+        EmojiRecord("flags", /*"Laos",*/ "1f1f1-1f1e6", 2682, EmojiCode(0x1f1f1, 0x1f1e6)),
+        EmojiRecord("flags", /*"Latvia",*/ "1f1f1-1f1fb", 2683, EmojiCode(0x1f1f1, 0x1f1fb)),
+        EmojiRecord("flags", /*"Lebanon",*/ "1f1f1-1f1e7", 2684, EmojiCode(0x1f1f1, 0x1f1e7)),
+        EmojiRecord("flags", /*"Lesotho",*/ "1f1f1-1f1f8", 2685, EmojiCode(0x1f1f1, 0x1f1f8)),
+        EmojiRecord("flags", /*"Liberia",*/ "1f1f1-1f1f7", 2686, EmojiCode(0x1f1f1, 0x1f1f7)),
+        EmojiRecord("flags", /*"Libya",*/ "1f1f1-1f1fe", 2687, EmojiCode(0x1f1f1, 0x1f1fe)),
+        EmojiRecord("flags", /*"Liechtenstein",*/ "1f1f1-1f1ee", 2688, EmojiCode(0x1f1f1, 0x1f1ee)),
+        EmojiRecord("flags", /*"Lithuania",*/ "1f1f1-1f1f9", 2689, EmojiCode(0x1f1f1, 0x1f1f9)),
+        EmojiRecord("flags", /*"Luxembourg",*/ "1f1f1-1f1fa", 2690, EmojiCode(0x1f1f1, 0x1f1fa)),
+        EmojiRecord("flags", /*"Macau SAR China",*/ "1f1f2-1f1f4", 2691, EmojiCode(0x1f1f2, 0x1f1f4)),
+        EmojiRecord("flags", /*"Macedonia",*/ "1f1f2-1f1f0", 2692, EmojiCode(0x1f1f2, 0x1f1f0)),
+        EmojiRecord("flags", /*"Madagascar",*/ "1f1f2-1f1ec", 2693, EmojiCode(0x1f1f2, 0x1f1ec)),
+        EmojiRecord("flags", /*"Malawi",*/ "1f1f2-1f1fc", 2694, EmojiCode(0x1f1f2, 0x1f1fc)),
+        EmojiRecord("flags", /*"Malaysia",*/ "1f1f2-1f1fe", 2695, EmojiCode(0x1f1f2, 0x1f1fe)),
+        EmojiRecord("flags", /*"Maldives",*/ "1f1f2-1f1fb", 2696, EmojiCode(0x1f1f2, 0x1f1fb)),
+        EmojiRecord("flags", /*"Mali",*/ "1f1f2-1f1f1", 2697, EmojiCode(0x1f1f2, 0x1f1f1)),
+        EmojiRecord("flags", /*"Malta",*/ "1f1f2-1f1f9", 2698, EmojiCode(0x1f1f2, 0x1f1f9)),
+        EmojiRecord("flags", /*"Marshall Islands",*/ "1f1f2-1f1ed", 2699, EmojiCode(0x1f1f2, 0x1f1ed)),
+        EmojiRecord("flags", /*"Martinique",*/ "1f1f2-1f1f6", 2700, EmojiCode(0x1f1f2, 0x1f1f6)),
+        EmojiRecord("flags", /*"Mauritania",*/ "1f1f2-1f1f7", 2701, EmojiCode(0x1f1f2, 0x1f1f7)),
+        EmojiRecord("flags", /*"Mauritius",*/ "1f1f2-1f1fa", 2702, EmojiCode(0x1f1f2, 0x1f1fa)),
+        EmojiRecord("flags", /*"Mayotte",*/ "1f1fe-1f1f9", 2703, EmojiCode(0x1f1fe, 0x1f1f9)),
+        EmojiRecord("flags", /*"Mexico",*/ "1f1f2-1f1fd", 2704, EmojiCode(0x1f1f2, 0x1f1fd)),
+        EmojiRecord("flags", /*"Micronesia",*/ "1f1eb-1f1f2", 2705, EmojiCode(0x1f1eb, 0x1f1f2)),
+        EmojiRecord("flags", /*"Moldova",*/ "1f1f2-1f1e9", 2706, EmojiCode(0x1f1f2, 0x1f1e9)),
+        EmojiRecord("flags", /*"Monaco",*/ "1f1f2-1f1e8", 2707, EmojiCode(0x1f1f2, 0x1f1e8)),
+        EmojiRecord("flags", /*"Mongolia",*/ "1f1f2-1f1f3", 2708, EmojiCode(0x1f1f2, 0x1f1f3)),
+        EmojiRecord("flags", /*"Montenegro",*/ "1f1f2-1f1ea", 2709, EmojiCode(0x1f1f2, 0x1f1ea)),
+        EmojiRecord("flags", /*"Montserrat",*/ "1f1f2-1f1f8", 2710, EmojiCode(0x1f1f2, 0x1f1f8)),
+        EmojiRecord("flags", /*"Morocco",*/ "1f1f2-1f1e6", 2711, EmojiCode(0x1f1f2, 0x1f1e6)),
+        EmojiRecord("flags", /*"Mozambique",*/ "1f1f2-1f1ff", 2712, EmojiCode(0x1f1f2, 0x1f1ff)),
+        EmojiRecord("flags", /*"Myanmar (Burma)",*/ "1f1f2-1f1f2", 2713, EmojiCode(0x1f1f2, 0x1f1f2)),
+        EmojiRecord("flags", /*"Namibia",*/ "1f1f3-1f1e6", 2714, EmojiCode(0x1f1f3, 0x1f1e6)),
+        EmojiRecord("flags", /*"Nauru",*/ "1f1f3-1f1f7", 2715, EmojiCode(0x1f1f3, 0x1f1f7)),
+        EmojiRecord("flags", /*"Nepal",*/ "1f1f3-1f1f5", 2716, EmojiCode(0x1f1f3, 0x1f1f5)),
+        EmojiRecord("flags", /*"Netherlands",*/ "1f1f3-1f1f1", 2717, EmojiCode(0x1f1f3, 0x1f1f1)),
+        EmojiRecord("flags", /*"New Caledonia",*/ "1f1f3-1f1e8", 2718, EmojiCode(0x1f1f3, 0x1f1e8)),
+        EmojiRecord("flags", /*"New Zealand",*/ "1f1f3-1f1ff", 2719, EmojiCode(0x1f1f3, 0x1f1ff)),
+        EmojiRecord("flags", /*"Nicaragua",*/ "1f1f3-1f1ee", 2720, EmojiCode(0x1f1f3, 0x1f1ee)),
+        EmojiRecord("flags", /*"Niger",*/ "1f1f3-1f1ea", 2721, EmojiCode(0x1f1f3, 0x1f1ea)),
+        EmojiRecord("flags", /*"Nigeria",*/ "1f1f3-1f1ec", 2722, EmojiCode(0x1f1f3, 0x1f1ec)),
+        EmojiRecord("flags", /*"Niue",*/ "1f1f3-1f1fa", 2723, EmojiCode(0x1f1f3, 0x1f1fa)),
+        EmojiRecord("flags", /*"Norfolk Island",*/ "1f1f3-1f1eb", 2724, EmojiCode(0x1f1f3, 0x1f1eb)),
+        EmojiRecord("flags", /*"North Korea",*/ "1f1f0-1f1f5", 2725, EmojiCode(0x1f1f0, 0x1f1f5)),
+        EmojiRecord("flags", /*"Northern Mariana Islands",*/ "1f1f2-1f1f5", 2726, EmojiCode(0x1f1f2, 0x1f1f5)),
+        EmojiRecord("flags", /*"Norway",*/ "1f1f3-1f1f4", 2727, EmojiCode(0x1f1f3, 0x1f1f4)),
+        EmojiRecord("flags", /*"Oman",*/ "1f1f4-1f1f2", 2728, EmojiCode(0x1f1f4, 0x1f1f2)),
+        EmojiRecord("flags", /*"Pakistan",*/ "1f1f5-1f1f0", 2729, EmojiCode(0x1f1f5, 0x1f1f0)),
+        EmojiRecord("flags", /*"Palau",*/ "1f1f5-1f1fc", 2730, EmojiCode(0x1f1f5, 0x1f1fc)),
+        EmojiRecord("flags", /*"Palestinian Territories",*/ "1f1f5-1f1f8", 2731, EmojiCode(0x1f1f5, 0x1f1f8)),
+        EmojiRecord("flags", /*"Panama",*/ "1f1f5-1f1e6", 2732, EmojiCode(0x1f1f5, 0x1f1e6)),
+        EmojiRecord("flags", /*"Papua New Guinea",*/ "1f1f5-1f1ec", 2733, EmojiCode(0x1f1f5, 0x1f1ec)),
+        EmojiRecord("flags", /*"Paraguay",*/ "1f1f5-1f1fe", 2734, EmojiCode(0x1f1f5, 0x1f1fe)),
+        EmojiRecord("flags", /*"Peru",*/ "1f1f5-1f1ea", 2735, EmojiCode(0x1f1f5, 0x1f1ea)),
+        EmojiRecord("flags", /*"Philippines",*/ "1f1f5-1f1ed", 2736, EmojiCode(0x1f1f5, 0x1f1ed)),
+        EmojiRecord("flags", /*"Pitcairn Islands",*/ "1f1f5-1f1f3", 2737, EmojiCode(0x1f1f5, 0x1f1f3)),
+        EmojiRecord("flags", /*"Poland",*/ "1f1f5-1f1f1", 2738, EmojiCode(0x1f1f5, 0x1f1f1)),
+        EmojiRecord("flags", /*"Portugal",*/ "1f1f5-1f1f9", 2739, EmojiCode(0x1f1f5, 0x1f1f9)),
+        EmojiRecord("flags", /*"Puerto Rico",*/ "1f1f5-1f1f7", 2740, EmojiCode(0x1f1f5, 0x1f1f7)),
+        EmojiRecord("flags", /*"Qatar",*/ "1f1f6-1f1e6", 2741, EmojiCode(0x1f1f6, 0x1f1e6)),
+        EmojiRecord("flags", /*"Réunion",*/ "1f1f7-1f1ea", 2742, EmojiCode(0x1f1f7, 0x1f1ea)),
+        EmojiRecord("flags", /*"Romania",*/ "1f1f7-1f1f4", 2743, EmojiCode(0x1f1f7, 0x1f1f4)),
+        EmojiRecord("flags", /*"Russia",*/ "1f1f7-1f1fa", 2744, EmojiCode(0x1f1f7, 0x1f1fa)),
+        EmojiRecord("flags", /*"Rwanda",*/ "1f1f7-1f1fc", 2745, EmojiCode(0x1f1f7, 0x1f1fc)),
+        EmojiRecord("flags", /*"Samoa",*/ "1f1fc-1f1f8", 2746, EmojiCode(0x1f1fc, 0x1f1f8)),
+        EmojiRecord("flags", /*"San Marino",*/ "1f1f8-1f1f2", 2747, EmojiCode(0x1f1f8, 0x1f1f2)),
+        EmojiRecord("flags", /*"São Tomé &amp; Príncipe",*/ "1f1f8-1f1f9", 2748, EmojiCode(0x1f1f8, 0x1f1f9)),
+        EmojiRecord("flags", /*"Saudi Arabia",*/ "1f1f8-1f1e6", 2749, EmojiCode(0x1f1f8, 0x1f1e6)),
+        EmojiRecord("flags", /*"Senegal",*/ "1f1f8-1f1f3", 2750, EmojiCode(0x1f1f8, 0x1f1f3)),
+        EmojiRecord("flags", /*"Serbia",*/ "1f1f7-1f1f8", 2751, EmojiCode(0x1f1f7, 0x1f1f8)),
+        EmojiRecord("flags", /*"Seychelles",*/ "1f1f8-1f1e8", 2752, EmojiCode(0x1f1f8, 0x1f1e8)),
+        EmojiRecord("flags", /*"Sierra Leone",*/ "1f1f8-1f1f1", 2753, EmojiCode(0x1f1f8, 0x1f1f1)),
+        EmojiRecord("flags", /*"Singapore",*/ "1f1f8-1f1ec", 2754, EmojiCode(0x1f1f8, 0x1f1ec)),
+        EmojiRecord("flags", /*"Sint Maarten",*/ "1f1f8-1f1fd", 2755, EmojiCode(0x1f1f8, 0x1f1fd)),
+        EmojiRecord("flags", /*"Slovakia",*/ "1f1f8-1f1f0", 2756, EmojiCode(0x1f1f8, 0x1f1f0)),
+        EmojiRecord("flags", /*"Slovenia",*/ "1f1f8-1f1ee", 2757, EmojiCode(0x1f1f8, 0x1f1ee)),
+        EmojiRecord("flags", /*"South Georgia &amp; South Sandwich Islands",*/ "1f1ec-1f1f8", 2758, EmojiCode(0x1f1ec, 0x1f1f8)),
+        EmojiRecord("flags", /*"Solomon Islands",*/ "1f1f8-1f1e7", 2759, EmojiCode(0x1f1f8, 0x1f1e7)),
+        EmojiRecord("flags", /*"Somalia",*/ "1f1f8-1f1f4", 2760, EmojiCode(0x1f1f8, 0x1f1f4)),
+        EmojiRecord("flags", /*"South Africa",*/ "1f1ff-1f1e6", 2761, EmojiCode(0x1f1ff, 0x1f1e6)),
+        EmojiRecord("flags", /*"South Korea",*/ "1f1f0-1f1f7", 2762, EmojiCode(0x1f1f0, 0x1f1f7)),
+        EmojiRecord("flags", /*"South Sudan",*/ "1f1f8-1f1f8", 2763, EmojiCode(0x1f1f8, 0x1f1f8)),
+        EmojiRecord("flags", /*"Spain",*/ "1f1ea-1f1f8", 2764, EmojiCode(0x1f1ea, 0x1f1f8)),
+        EmojiRecord("flags", /*"Sri Lanka",*/ "1f1f1-1f1f0", 2765, EmojiCode(0x1f1f1, 0x1f1f0)),
+        EmojiRecord("flags", /*"St. Barthélemy",*/ "1f1e7-1f1f1", 2766, EmojiCode(0x1f1e7, 0x1f1f1)),
+        EmojiRecord("flags", /*"St. Helena",*/ "1f1f8-1f1ed", 2767, EmojiCode(0x1f1f8, 0x1f1ed)),
+        EmojiRecord("flags", /*"St. Kitts &amp; Nevis",*/ "1f1f0-1f1f3", 2768, EmojiCode(0x1f1f0, 0x1f1f3)),
+        EmojiRecord("flags", /*"St. Lucia",*/ "1f1f1-1f1e8", 2769, EmojiCode(0x1f1f1, 0x1f1e8)),
+        EmojiRecord("flags", /*"St. Pierre &amp; Miquelon",*/ "1f1f5-1f1f2", 2770, EmojiCode(0x1f1f5, 0x1f1f2)),
+        EmojiRecord("flags", /*"St. Vincent &amp; Grenadines",*/ "1f1fb-1f1e8", 2771, EmojiCode(0x1f1fb, 0x1f1e8)),
+        EmojiRecord("flags", /*"Sudan",*/ "1f1f8-1f1e9", 2772, EmojiCode(0x1f1f8, 0x1f1e9)),
+        EmojiRecord("flags", /*"Suriname",*/ "1f1f8-1f1f7", 2773, EmojiCode(0x1f1f8, 0x1f1f7)),
+        EmojiRecord("flags", /*"Swaziland",*/ "1f1f8-1f1ff", 2774, EmojiCode(0x1f1f8, 0x1f1ff)),
+        EmojiRecord("flags", /*"Sweden",*/ "1f1f8-1f1ea", 2775, EmojiCode(0x1f1f8, 0x1f1ea)),
+        EmojiRecord("flags", /*"Switzerland",*/ "1f1e8-1f1ed", 2776, EmojiCode(0x1f1e8, 0x1f1ed)),
+        EmojiRecord("flags", /*"Syria",*/ "1f1f8-1f1fe", 2777, EmojiCode(0x1f1f8, 0x1f1fe)),
+        EmojiRecord("flags", /*"Taiwan",*/ "1f1f9-1f1fc", 2778, EmojiCode(0x1f1f9, 0x1f1fc)),
+        EmojiRecord("flags", /*"Tajikistan",*/ "1f1f9-1f1ef", 2779, EmojiCode(0x1f1f9, 0x1f1ef)),
+        EmojiRecord("flags", /*"Tanzania",*/ "1f1f9-1f1ff", 2780, EmojiCode(0x1f1f9, 0x1f1ff)),
+        EmojiRecord("flags", /*"Thailand",*/ "1f1f9-1f1ed", 2781, EmojiCode(0x1f1f9, 0x1f1ed)),
+        EmojiRecord("flags", /*"Timor-Leste",*/ "1f1f9-1f1f1", 2782, EmojiCode(0x1f1f9, 0x1f1f1)),
+        EmojiRecord("flags", /*"Togo",*/ "1f1f9-1f1ec", 2783, EmojiCode(0x1f1f9, 0x1f1ec)),
+        EmojiRecord("flags", /*"Tokelau",*/ "1f1f9-1f1f0", 2784, EmojiCode(0x1f1f9, 0x1f1f0)),
+        EmojiRecord("flags", /*"Tonga",*/ "1f1f9-1f1f4", 2785, EmojiCode(0x1f1f9, 0x1f1f4)),
+        EmojiRecord("flags", /*"Trinidad &amp; Tobago",*/ "1f1f9-1f1f9", 2786, EmojiCode(0x1f1f9, 0x1f1f9)),
+        EmojiRecord("flags", /*"Tunisia",*/ "1f1f9-1f1f3", 2787, EmojiCode(0x1f1f9, 0x1f1f3)),
+        EmojiRecord("flags", /*"Turkey",*/ "1f1f9-1f1f7", 2788, EmojiCode(0x1f1f9, 0x1f1f7)),
+        EmojiRecord("flags", /*"Turkmenistan",*/ "1f1f9-1f1f2", 2789, EmojiCode(0x1f1f9, 0x1f1f2)),
+        EmojiRecord("flags", /*"Turks &amp; Caicos Islands",*/ "1f1f9-1f1e8", 2790, EmojiCode(0x1f1f9, 0x1f1e8)),
+        EmojiRecord("flags", /*"U.S. Virgin Islands",*/ "1f1fb-1f1ee", 2791, EmojiCode(0x1f1fb, 0x1f1ee)),
+        EmojiRecord("flags", /*"Tuvalu",*/ "1f1f9-1f1fb", 2792, EmojiCode(0x1f1f9, 0x1f1fb)),
+        EmojiRecord("flags", /*"Uganda",*/ "1f1fa-1f1ec", 2793, EmojiCode(0x1f1fa, 0x1f1ec)),
+        EmojiRecord("flags", /*"Ukraine",*/ "1f1fa-1f1e6", 2794, EmojiCode(0x1f1fa, 0x1f1e6)),
+        EmojiRecord("flags", /*"United Arab Emirates",*/ "1f1e6-1f1ea", 2795, EmojiCode(0x1f1e6, 0x1f1ea)),
+        EmojiRecord("flags", /*"United Kingdom",*/ "1f1ec-1f1e7", 2796, EmojiCode(0x1f1ec, 0x1f1e7)),
+        EmojiRecord("flags", /*"England",*/ "1f3f4-e0067-e0062-e0065-e006e-e0067-e007f", 2797, EmojiCode(0x1f3f4, 0xe0067, 0xe0062, 0xe0065, 0xe006e, 0xe0067, 0xe007f)),
+        EmojiRecord("flags", /*"Scotland",*/ "1f3f4-e0067-e0062-e0073-e0063-e0074-e007f", 2798, EmojiCode(0x1f3f4, 0xe0067, 0xe0062, 0xe0073, 0xe0063, 0xe0074, 0xe007f)),
+        EmojiRecord("flags", /*"Wales",*/ "1f3f4-e0067-e0062-e0077-e006c-e0073-e007f", 2799, EmojiCode(0x1f3f4, 0xe0067, 0xe0062, 0xe0077, 0xe006c, 0xe0073, 0xe007f)),
+        EmojiRecord("flags", /*"United States",*/ "1f1fa-1f1f8", 2800, EmojiCode(0x1f1fa, 0x1f1f8)),
+        EmojiRecord("flags", /*"Uruguay",*/ "1f1fa-1f1fe", 2801, EmojiCode(0x1f1fa, 0x1f1fe)),
+        EmojiRecord("flags", /*"Uzbekistan",*/ "1f1fa-1f1ff", 2802, EmojiCode(0x1f1fa, 0x1f1ff)),
+        EmojiRecord("flags", /*"Vanuatu",*/ "1f1fb-1f1fa", 2803, EmojiCode(0x1f1fb, 0x1f1fa)),
+        EmojiRecord("flags", /*"Vatican City",*/ "1f1fb-1f1e6", 2804, EmojiCode(0x1f1fb, 0x1f1e6)),
+        EmojiRecord("flags", /*"Venezuela",*/ "1f1fb-1f1ea", 2805, EmojiCode(0x1f1fb, 0x1f1ea)),
+        EmojiRecord("flags", /*"Vietnam",*/ "1f1fb-1f1f3", 2806, EmojiCode(0x1f1fb, 0x1f1f3)),
+        EmojiRecord("flags", /*"Wallis &amp; Futuna",*/ "1f1fc-1f1eb", 2807, EmojiCode(0x1f1fc, 0x1f1eb)),
+        EmojiRecord("flags", /*"Western Sahara",*/ "1f1ea-1f1ed", 2808, EmojiCode(0x1f1ea, 0x1f1ed)),
+        EmojiRecord("flags", /*"Yemen",*/ "1f1fe-1f1ea", 2809, EmojiCode(0x1f1fe, 0x1f1ea)),
+        EmojiRecord("flags", /*"Zambia",*/ "1f1ff-1f1f2", 2810, EmojiCode(0x1f1ff, 0x1f1f2)),
+        EmojiRecord("flags", /*"Zimbabwe",*/ "1f1ff-1f1fc", 2811, EmojiCode(0x1f1ff, 0x1f1fc)),
+        EmojiRecord("flags", /*"Ascension Island",*/ "1f1e6-1f1e8", 2812, EmojiCode(0x1f1e6, 0x1f1e8)),
+        EmojiRecord("flags", /*"Bouvet Island",*/ "1f1e7-1f1fb", 2813, EmojiCode(0x1f1e7, 0x1f1fb)),
+        EmojiRecord("flags", /*"Clipperton Island",*/ "1f1e8-1f1f5", 2814, EmojiCode(0x1f1e8, 0x1f1f5)),
+        EmojiRecord("flags", /*"Ceuta &amp; Melilla",*/ "1f1ea-1f1e6", 2815, EmojiCode(0x1f1ea, 0x1f1e6)),
+        EmojiRecord("flags", /*"Diego Garcia",*/ "1f1e9-1f1ec", 2816, EmojiCode(0x1f1e9, 0x1f1ec)),
+        EmojiRecord("flags", /*"Heard &amp; McDonald Islands",*/ "1f1ed-1f1f2", 2817, EmojiCode(0x1f1ed, 0x1f1f2)),
+        EmojiRecord("flags", /*"St. Martin",*/ "1f1f2-1f1eb", 2818, EmojiCode(0x1f1f2, 0x1f1eb)),
+        EmojiRecord("flags", /*"Svalbard &amp; Jan Mayen",*/ "1f1f8-1f1ef", 2819, EmojiCode(0x1f1f8, 0x1f1ef)),
+        EmojiRecord("flags", /*"Tristan da Cunha",*/ "1f1f9-1f1e6", 2820, EmojiCode(0x1f1f9, 0x1f1e6)),
+        EmojiRecord("flags", /*"U.S. Outlying Islands",*/ "1f1fa-1f1f2", 2821, EmojiCode(0x1f1fa, 0x1f1f2)),
+        EmojiRecord("flags", /*"United Nations",*/ "1f1fa-1f1f3", 2822, EmojiCode(0x1f1fa, 0x1f1f3)),
+        EmojiRecord("modifier", /*"light skin tone",*/ "1f3fb", 2823, EmojiCode(0x1f3fb)),
+        EmojiRecord("modifier", /*"medium-light skin tone",*/ "1f3fc", 2824, EmojiCode(0x1f3fc)),
+        EmojiRecord("modifier", /*"medium skin tone",*/ "1f3fd", 2825, EmojiCode(0x1f3fd)),
+        EmojiRecord("modifier", /*"medium-dark skin tone",*/ "1f3fe", 2826, EmojiCode(0x1f3fe)),
+        EmojiRecord("modifier", /*"dark skin tone",*/ "1f3ff", 2827, EmojiCode(0x1f3ff)),
+    };
+}
 
-        return res;
+namespace Emoji
+{
+    const EmojiTable& getEmojiTable() noexcept
+    {
+        return emojiTable;
     }
 }
@@ -1,12 +1,13 @@
 #pragma once
 
-#include <vector>
-#include <memory>
+#include "EmojiDb.h"
 
 namespace Emoji
 {
-    struct EmojiRecord;
-    using EmojiRecordSptr = std::shared_ptr<EmojiRecord>;
+    constexpr size_t emojiTableSize = 2827;
 
-    std::vector<EmojiRecordSptr> getEmojiVector();
+    using EmojiTable = std::array<EmojiRecord, emojiTableSize>;
+
+    // ordered by EmojiRecord::Index_
+    const EmojiTable& getEmojiTable() noexcept;
 }
@@ -0,0 +1,820 @@
+#pragma once
+
+// generated by emoji_index_gen.py from EmojiIndexDataNew.cpp, do not edit
+
+#include "EmojiIndexDataNew.h"
+
+namespace Emoji
+{
+    namespace HashIndex
+    {
+        static_assert(emojiTableSize == 2827, "EmojiIndexHash.h is out of date, run emoji_index_gen.py");
+
+        constexpr uint32_t bucketsCount = 1024;
+        constexpr uint32_t slotsCount = 4096;
+
+        constexpr uint32_t hashCode(const EmojiCode& _code, uint32_t _seed) noexcept
+        {
+            uint32_t h = 2166136261u ^ _seed;
+            for (size_t i = 0, size = _code.size(); i < size; ++i)
+            {
+                h ^= _code.codepointAt(i);
+                h *= 16777619u;
+            }
+            h ^= h >> 16;
+            h *= 0x85ebca6bu;
+            h ^= h >> 13;
+            h *= 0xc2b2ae35u;
+            h ^= h >> 16;
+            return h;
+        }
+
+        // fullCode: second level seed per bucket
+        constexpr uint16_t fullCodeSeeds[bucketsCount] =
+        {
+            2, 1, 1, 4, 1, 1, 39, 36, 3, 2, 16, 86, 1, 0, 3, 6,
+            28, 1, 2, 0, 3, 7, 273, 55, 10, 28, 0, 3, 3, 25, 0, 0,
+            1, 9, 14, 1, 0, 1, 16, 1, 30, 8, 17, 4, 12, 6, 7, 64,
+            3, 36, 1, 36, 258, 0, 10, 1, 1, 2, 10, 1, 11, 9, 15, 257,
+            2, 69, 6, 1, 2, 3, 1, 29, 94, 95, 48, 5, 29, 3, 17, 20,
+            4, 1, 66, 1, 21, 0, 29, 256, 1, 2, 3, 4, 10, 0, 66, 1,
+            1, 5, 3, 2, 1, 0, 0, 2, 9, 2, 2, 6, 3, 9, 1, 2,
+            1, 2, 9, 17, 1, 3, 3, 14, 2, 9, 8, 67, 2, 5, 97, 52,
+            25, 0, 1, 1, 2, 126, 7, 1, 17, 17, 1, 6, 5, 22, 6, 1,
+            1, 8, 8, 4, 4, 0, 3, 57, 5, 3, 19, 11, 1, 2, 36, 28,
+            14, 9, 2, 71, 1, 65, 90, 0, 1, 17, 1, 7, 1, 1, 2, 4,
+            7, 59, 4, 4, 2, 7, 64, 3, 1, 2, 10, 2, 6, 2, 4, 2,
+            1, 331, 18, 5, 36, 1, 207, 5, 7, 18, 20, 256, 21, 2, 5, 1,
+            4, 5, 2, 23, 5, 19, 7, 10, 21, 16, 166, 181, 1, 66, 34, 25,
+            6, 2, 12, 3, 5, 4, 13, 5, 172, 1, 3, 55, 87, 0, 16, 17,
+            177, 1, 0, 256, 35, 0, 1, 78, 1, 4, 1, 4, 1, 8, 19, 10,
+            2, 27, 21, 122, 4, 1, 32, 4, 4, 136, 4, 4, 128, 1, 82, 16,
+            2, 3, 12, 2, 1, 1, 1, 2, 14, 1, 0, 44, 1, 7, 5, 3,
+            36, 0, 32, 84, 1, 22, 16, 15, 73, 0, 1, 10, 1, 1, 1, 1,
+            56, 27, 8, 1, 4, 2, 2, 2, 1, 0, 3, 25, 262, 9, 3, 1,
+            61, 4, 12, 4, 216, 27, 5, 1, 6, 14, 2, 0, 1, 24, 0, 26,
+            2, 1, 2, 1, 2, 0, 8, 2, 2, 48, 257, 0, 4, 11, 1, 4,
+            1, 0, 49, 121, 6, 6, 1, 15, 0, 5, 259, 16, 1, 3, 1, 27,
+            6, 45, 29, 34, 0, 1, 7, 1, 1, 1, 22, 1, 0, 5, 0, 4,
+            1, 3, 32, 1, 2, 0, 61, 2, 69, 0, 258, 9, 1, 40, 7, 81,
+            9, 0, 13, 34, 4, 82, 34, 1, 21, 135, 14, 1, 1, 1, 1, 22,
+            15, 9, 50, 1, 65, 1, 416, 64, 2, 86, 0, 4, 9, 53, 1, 21,
+            1, 2, 1, 54, 16, 139, 384, 9, 42, 4, 1, 3, 0, 0, 0, 1,
+            50, 22, 135, 126, 2, 7, 18, 256, 1, 0, 25, 15, 45, 30, 24, 1,
+            1, 3, 33, 10, 4, 170, 3, 256, 6, 4, 17, 1, 8, 7, 6, 3,
+            0, 10, 22, 4, 6, 3, 17, 2, 6, 4, 55, 7, 21, 13, 333, 1,
+            2, 1, 5, 43, 5, 6, 145, 11, 16, 1, 19, 81, 17, 1, 45, 16,
+            5, 3, 1, 2, 14, 6, 124, 144, 256, 8, 35, 1, 5, 53, 1, 41,
+            3, 66, 9, 6, 170, 2, 4, 37, 18, 1, 21, 1, 271, 2, 1, 66,
+            257, 258, 9, 11, 262, 13, 23, 10, 0, 31, 3, 57, 0, 79, 10, 256,
+            0, 1, 276, 5, 14, 28, 29, 27, 277, 0, 60, 1, 4, 15, 1, 5,
+            3, 5, 64, 15, 1, 3, 7, 8, 58, 0, 11, 7, 1, 34, 7, 71,
+            0, 3, 3, 246, 5, 5, 10, 1, 384, 1, 1, 1, 0, 267, 24, 2,
+            12, 289, 5, 10, 6, 6, 5, 1, 1, 18, 2, 2, 5, 257, 10, 5,
+            275, 8, 11, 144, 241, 2, 16, 34, 259, 1, 6, 13, 2, 6, 268, 20,
+            66, 12, 1, 1, 33, 11, 23, 15, 17, 0, 69, 0, 7, 64, 9, 4,
+            115, 1, 1, 6, 261, 40, 3, 40, 8, 1, 15, 25, 1, 0, 45, 3,
+            18, 0, 1, 25, 7, 130, 2, 0, 0, 0, 68, 76, 1, 32, 8, 2,
+            5, 1, 279, 1, 11, 23, 17, 2, 12, 0, 13, 72, 27, 139, 12, 49,
+            137, 0, 7, 7, 1, 0, 6, 33, 19, 30, 262, 1, 8, 1, 1, 74,
+            6, 1, 1, 3, 80, 3, 5, 19, 13, 6, 323, 21, 14, 13, 272, 38,
+            265, 90, 42, 1, 1, 7, 17, 18, 1, 256, 264, 12, 11, 20, 251, 262,
+            5, 15, 128, 1, 3, 257, 77, 0, 12, 10, 71, 1, 7, 0, 12, 257,
+            45, 5, 83, 16, 1, 28, 1, 6, 48, 266, 2, 8, 0, 4, 257, 2,
+            3, 16, 0, 20, 1, 267, 11, 2, 9, 3, 125, 16, 1, 124, 58, 5,
+            6, 24, 37, 52, 7, 1, 257, 2, 2, 272, 4, 118, 257, 256, 9, 40,
+            3, 266, 206, 0, 2, 1, 268, 257, 1, 10, 146, 1, 261, 12, 17, 1,
+            105, 4, 3, 0, 259, 18, 257, 256, 4, 77, 9, 10, 384, 3, 125, 40,
+            104, 2, 1, 6, 322, 4, 5, 4, 0, 11, 10, 4, 263, 5, 46, 1,
+            17, 3, 25, 335, 26, 8, 286, 19, 16, 30, 2, 0, 19, 12, 0, 8,
+            0, 31, 1, 6, 19, 7, 18, 3, 61, 0, 256, 258, 5, 1, 46, 17,
+            1, 28, 59, 23, 2, 10, 2, 264, 26, 6, 2, 295, 41, 3, 6, 290,
+            9, 260, 65, 10, 6, 273, 45, 8, 10, 9, 1, 198, 1, 6, 0, 23,
+            14, 14, 53, 266, 45, 97, 21, 72, 12, 3, 71, 275, 76, 258, 46, 10,
+            333, 262, 66, 34, 256, 7, 85, 1, 0, 13, 256, 15, 1, 282, 1, 8,
+            264, 180, 20, 64, 4, 25, 262, 9, 0, 4, 338, 0, 26, 50, 5, 2,
+            60, 13, 0, 4, 1, 260, 9, 3, 19, 3, 3, 272, 4, 21, 293, 5,
+            1, 4, 68, 0, 259, 7, 11, 1, 0, 69, 1, 257, 259, 1, 17, 20,
+            4, 3, 165, 256, 52, 67, 37, 8, 5, 0, 2, 163, 0, 261, 1, 1,
+        };
+
+        // fullCode: table position + 1 per slot, 0 is an empty slot
+        constexpr uint16_t fullCodeSlots[slotsCount] =
+        {
+            1937, 903, 2044, 2048, 2120, 1753, 68, 0, 1687, 0, 1510, 0, 1423, 2506, 0, 2474,
+            2252, 567, 1867, 1187, 0, 0, 0, 1182, 986, 2462, 1106, 940, 2388, 1466, 0, 1780,
+            995, 705, 2355, 1500, 2402, 0, 1272, 2521, 1680, 0, 0, 1619, 0, 704, 0, 0,
+            365, 1728, 2153, 0, 1337, 2396, 0, 1706, 396, 821, 0, 1877, 0, 1834, 0, 0,
+            2039, 0, 0, 0, 0, 1571, 738, 0, 0, 0, 2781, 1861, 1586, 1907, 2384, 0,
+            2624, 0, 0, 2329, 2134, 1267, 2178, 0, 2023, 2577, 397, 429, 1677, 0, 1891, 2563,
+            1377, 0, 0, 0, 607, 0, 1309, 0, 0, 115, 1767, 20, 2417, 298, 0, 0,
+            1432, 0, 0, 691, 0, 0, 1906, 1249, 2694, 1661, 0, 1396, 2265, 2703, 1461, 1477,
+            0, 1612, 0, 1030, 1748, 209, 194, 2065, 0, 2515, 0, 0, 2681, 596, 2349, 1488,
+            2089, 108, 1088, 1876, 2215, 0, 1699, 47, 2102, 0, 0, 1405, 1884, 1200, 0, 753,
+            1395, 1445, 0, 1754, 726, 2589, 1729, 245, 341, 822, 0, 0, 1097, 1616, 0, 2054,
+            2503, 2541, 0, 0, 1928, 0, 1540, 0, 2378, 2326, 334, 1898, 0, 0, 319, 2194,
+            1971, 0, 2755, 1757, 1105, 0, 2292, 1864, 998, 0, 906, 0, 2465, 0, 132, 0,
+            0, 1737, 0, 0, 1575, 2196, 547, 1909, 39, 1786, 0, 834, 1414, 1213, 2210, 1263,
+            894, 1169, 408, 67, 0, 0, 0, 0, 0, 0, 1605, 893, 2066, 0, 0, 1589,
+            0, 0, 0, 2604, 0, 2220, 1146, 0, 0, 0, 410, 601, 2745, 2498, 61, 1439,
+            0, 1119, 0, 0, 0, 2770, 2058, 2241, 1485, 1648, 1384, 167, 645, 0, 683, 1995,
+            0, 1518, 0, 0, 0, 81, 1850, 0, 2678, 195, 0, 0, 584, 31, 2074, 2304,
+            2536, 768, 373, 116, 2695, 1885, 0, 697, 2454, 2082, 1627, 1623, 0, 1048, 0, 443,
+            0, 2240, 1413, 1064, 788, 0, 1852, 13, 2496, 0, 349, 2420, 1469, 0, 1226, 0,
+            0, 599, 0, 1611, 244, 21, 0, 0, 2426, 0, 681, 542, 1704, 824, 1301, 0,
+            0, 339, 1281, 153, 2232, 2587, 521, 2727, 2258, 85, 863, 2741, 0, 0, 1800, 2077,
+            469, 743, 82, 0, 1215, 831, 2435, 1465, 2777, 264, 2298, 2552, 1358, 1027, 2523, 2418,
+            0, 0, 0, 1700, 0, 1959, 0, 0, 2551, 0, 707, 2393, 624, 0, 0, 867,
+            544, 0, 2479, 0, 294, 0, 2665, 0, 208, 0, 1269, 0, 1367, 0, 1220, 1168,
+            2675, 2031, 0, 0, 1134, 1467, 1115, 0, 2113, 0, 689, 253, 0, 766, 1994, 1446,
+            1615, 0, 0, 0, 974, 0, 2081, 226, 1649, 1176, 0, 0, 0, 296, 1579, 749,
+            1127, 820, 675, 0, 1496, 1793, 0, 0, 0, 1533, 456, 0, 0, 0, 2234, 1202,
+            182, 0, 0, 342, 1233, 1695, 418, 1179, 0, 1942, 299, 1124, 511, 2807, 2481, 0,
+            1118, 2706, 0, 1896, 2381, 1953, 710, 0, 1927, 1022, 1990, 461, 1042, 2704, 961, 0,
+            1882, 145, 2246, 589, 1863, 102, 217, 0, 2702, 2264, 2333, 0, 0, 0, 2138, 1425,
+            1186, 880, 0, 458, 261, 2154, 2309, 0, 1583, 1120, 0, 2579, 2323, 2128, 446, 243,
+            0, 1329, 2395, 2222, 0, 0, 909, 480, 2185, 0, 0, 2806, 1141, 439, 2368, 0,
+            0, 0, 221, 0, 288, 56, 1495, 2573, 1188, 401, 1472, 0, 792, 179, 314, 0,
+            2310, 2581, 0, 2114, 0, 0, 75, 549, 399, 1865, 0, 0, 0, 1065, 269, 0,
+            0, 0, 2145, 1957, 1231, 846, 376, 2491, 808, 0, 836, 0, 0, 0, 2334, 0,
+            1276, 0, 1552, 2517, 0, 0, 0, 2117, 6, 2733, 2585, 466, 2354, 2415, 1873, 2507,
+            0, 0, 0, 1194, 1531, 0, 0, 1701, 0, 798, 2821, 0, 0, 0, 784, 0,
+            2660, 0, 1316, 2056, 1813, 1975, 2062, 0, 0, 0, 0, 1670, 1416, 1239, 2600, 1738,
+            0, 1686, 1033, 1024, 2315, 720, 1028, 0, 1520, 2205, 2277, 1285, 0, 0, 0, 1755,
+            1710, 2511, 0, 0, 1112, 0, 0, 442, 829, 62, 2798, 0, 0, 0, 0, 30,
+            770, 1266, 127, 1584, 2635, 2141, 0, 2630, 2206, 0, 2106, 79, 2405, 0, 598, 0,
+            258, 0, 403, 1392, 0, 678, 1635, 0, 2763, 1702, 0, 1049, 11, 0, 1476, 0,
+            742, 2690, 1868, 2504, 2565, 516, 1722, 353, 2784, 2148, 325, 2404, 2512, 0, 2492, 0,
+            2477, 0, 0, 0, 1698, 0, 135, 633, 0, 2033, 0, 2348, 184, 2297, 0, 126,
+            1996, 2647, 0, 0, 1939, 0, 2319, 634, 10, 2331, 1237, 2606, 2623, 2400, 1375, 782,
+            2108, 0, 856, 275, 1165, 2290, 46, 0, 530, 531, 1731, 92, 1624, 380, 2439, 1039,
+            1603, 0, 0, 1806, 2799, 0, 387, 2782, 0, 2243, 1839, 1558, 0, 0, 513, 0,
+            1062, 1944, 313, 0, 0, 1101, 2699, 2459, 0, 0, 1597, 1037, 2610, 939, 1224, 929,
+            1147, 249, 0, 1914, 454, 0, 886, 457, 0, 2711, 1869, 1723, 0, 0, 670, 552,
+            1148, 0, 0, 262, 0, 59, 632, 2626, 1451, 0, 1000, 0, 2668, 413, 0, 1041,
+            1830, 1199, 381, 292, 0, 74, 0, 1690, 0, 1356, 1079, 617, 0, 175, 1746, 344,
+            2332, 230, 1730, 0, 0, 869, 2820, 1311, 698, 2501, 259, 0, 0, 2708, 2792, 2730,
+            186, 0, 2514, 2313, 825, 2286, 1076, 449, 1763, 1692, 2009, 2338, 655, 2825, 2156, 1219,
+            0, 0, 0, 1689, 0, 2055, 1803, 1355, 0, 0, 0, 1320, 1932, 1369, 0, 787,
+            0, 0, 2450, 0, 0, 0, 0, 393, 308, 323, 1777, 993, 935, 1835, 2484, 2059,
+            0, 752, 0, 2146, 1167, 188, 2006, 2540, 2566, 420, 1943, 0, 523, 80, 0, 2747,
+            0, 1633, 0, 0, 0, 0, 0, 2254, 1307, 755, 2656, 14, 17, 0, 422, 908,
+            2776, 110, 866, 816, 1762, 0, 1070, 0, 0, 2356, 2827, 1191, 1497, 1204, 0, 1025,
+            0, 156, 0, 0, 692, 1212, 0, 1029, 471, 0, 219, 0, 2061, 1775, 1843, 1257,
+            1183, 1074, 0, 1095, 1847, 2629, 2466, 0, 1138, 0, 879, 0, 2245, 1390, 687, 1796,
+            307, 762, 2429, 1694, 0, 1989, 1642, 202, 2801, 0, 2796, 1438, 1921, 1761, 635, 0,
+            0, 1770, 0, 0, 0, 2648, 0, 0, 2659, 524, 1596, 1043, 467, 2087, 2649, 1643,
+            2722, 0, 0, 1293, 1326, 0, 0, 0, 2595, 0, 2191, 266, 871, 2001, 537, 1479,
+            267, 0, 2358, 868, 2163, 2295, 225, 0, 1792, 1387, 0, 44, 2811, 1969, 1069, 1992,
+            1400, 2493, 602, 690, 42, 0, 779, 0, 363, 723, 2568, 0, 2041, 594, 979, 0,
+            382, 2556, 464, 0, 0, 1626, 1291, 1849, 2236, 1282, 1625, 1137, 1703, 564, 1637, 724,
+            0, 2064, 239, 2815, 1344, 0, 0, 0, 0, 1067, 1846, 2042, 0, 0, 2458, 0,
+            0, 0, 173, 346, 0, 994, 0, 1142, 16, 0, 0, 0, 570, 1593, 0, 2633,
+            1669, 1709, 2455, 1854, 2110, 2096, 794, 0, 1268, 2560, 0, 1521, 1831, 2561, 0, 130,
+            0, 1998, 1837, 1827, 2571, 1385, 0, 0, 1334, 2287, 2785, 0, 641, 1815, 2809, 2720,
+            1708, 0, 1026, 38, 0, 658, 2499, 1501, 122, 0, 844, 18, 0, 2464, 1073, 0,
+            2672, 1222, 51, 1551, 1318, 934, 0, 0, 235, 0, 1795, 0, 2200, 64, 959, 0,
+            2208, 0, 0, 0, 1471, 0, 1456, 2275, 0, 1719, 826, 0, 1086, 2216, 27, 0,
+            1235, 0, 2557, 94, 0, 1035, 984, 582, 1152, 1051, 1657, 1151, 2410, 2698, 2207, 0,
+            386, 1352, 668, 0, 1308, 2095, 237, 535, 963, 2591, 0, 2818, 0, 0, 0, 1773,
+            107, 885, 2150, 509, 101, 737, 497, 485, 592, 0, 2387, 0, 0, 2029, 680, 0,
+            2221, 9, 1402, 0, 1131, 367, 0, 973, 0, 2276, 956, 2341, 0, 398, 2683, 141,
+            0, 0, 2259, 1093, 1296, 0, 0, 0, 0, 2530, 1453, 1408, 0, 2692, 812, 263,
+            1053, 566, 0, 0, 660, 1894, 1482, 0, 0, 2111, 1697, 1666, 0, 1175, 1265, 1582,
+            0, 0, 1373, 0, 732, 0, 527, 270, 0, 0, 671, 1475, 0, 0, 2433, 2774,
+            121, 2718, 0, 0, 1382, 884, 137, 0, 377, 775, 0, 745, 0, 756, 2073, 800,
+            1522, 1688, 2670, 2339, 583, 0, 2360, 818, 97, 407, 0, 0, 1797, 2749, 252, 1107,
+            1009, 1135, 1109, 0, 0, 1511, 1546, 317, 1102, 0, 2195, 234, 1486, 1901, 0, 638,
+            2270, 1822, 1297, 0, 1672, 1739, 0, 830, 460, 2478, 0, 0, 2743, 0, 0, 34,
+            0, 0, 1503, 533, 1362, 0, 0, 447, 2116, 2130, 0, 233, 0, 1842, 712, 1769,
+            988, 492, 2057, 1878, 0, 0, 1436, 0, 0, 0, 0, 2619, 1243, 2184, 0, 1744,
+            2413, 1410, 0, 0, 0, 757, 1713, 0, 1933, 2735, 310, 0, 1083, 2076, 2596, 89,
+            406, 2223, 0, 172, 2453, 345, 534, 0, 0, 289, 305, 0, 915, 432, 0, 0,
+            2548, 0, 813, 210, 0, 0, 0, 2677, 1782, 0, 2166, 2765, 2324, 623, 2674, 1091,
+            0, 1248, 0, 1502, 2797, 0, 0, 98, 2575, 1113, 0, 248, 1974, 2139, 0, 2412,
+            2406, 0, 1640, 2030, 550, 902, 306, 0, 1478, 0, 1807, 0, 0, 0, 361, 0,
+            93, 1349, 0, 1935, 2267, 1247, 2473, 484, 1814, 1899, 106, 2495, 0, 2529, 2022, 1904,
+            498, 2330, 185, 2460, 2576, 595, 0, 0, 0, 801, 648, 2165, 1242, 1149, 1057, 483,
+            0, 1821, 2289, 274, 0, 1819, 254, 0, 0, 0, 1528, 0, 927, 2021, 1197, 1435,
+            0, 384, 2380, 0, 311, 0, 0, 134, 1536, 2640, 2756, 1598, 2621, 87, 1735, 0,
+            0, 1954, 860, 0, 2750, 2180, 0, 529, 0, 2661, 0, 548, 436, 797, 1359, 0,
+            1306, 104, 1561, 1776, 2161, 573, 2794, 1656, 722, 2325, 247, 0, 1816, 0, 0, 0,
+            572, 2362, 1193, 0, 120, 759, 0, 0, 0, 2239, 0, 943, 0, 1342, 0, 434,
+            0, 2249, 2308, 300, 0, 2445, 1314, 1912, 0, 1621, 0, 0, 1376, 0, 0, 0,
+            1116, 297, 0, 1328, 2739, 0, 2198, 0, 36, 0, 2787, 1450, 644, 1565, 2043, 0,
+            1203, 260, 2010, 0, 0, 1527, 2716, 2028, 1240, 2588, 0, 953, 1441, 0, 0, 950,
+            2463, 1559, 242, 2705, 2317, 0, 1444, 2401, 932, 2248, 0, 1573, 0, 394, 730, 2700,
+            105, 146, 2639, 2201, 725, 1732, 2186, 0, 0, 48, 142, 1910, 2701, 0, 1133, 0,
+            0, 1678, 1664, 0, 0, 2651, 1139, 1978, 2376, 0, 1548, 1018, 2447, 1178, 1790, 316,
+            2686, 0, 1756, 1110, 1092, 851, 0, 1580, 845, 1981, 702, 0, 0, 0, 916, 1007,
+            2389, 0, 0, 876, 1766, 1685, 2724, 796, 0, 0, 0, 1798, 1038, 1613, 2537, 0,
+            124, 90, 1040, 0, 937, 1412, 2328, 0, 0, 0, 0, 1023, 0, 0, 2391, 24,
+            1060, 0, 504, 0, 799, 0, 1125, 2228, 2436, 0, 2810, 2253, 545, 1221, 1765, 1160,
+            1126, 0, 438, 481, 1525, 2187, 2729, 2316, 0, 1406, 838, 0, 0, 0, 0, 1541,
+            922, 0, 0, 0, 0, 2099, 1707, 2011, 0, 882, 1143, 786, 897, 1363, 250, 0,
+            686, 0, 216, 2188, 1225, 2172, 1075, 2168, 2422, 1428, 32, 0, 0, 2620, 719, 1668,
+            1949, 149, 1982, 415, 328, 0, 0, 0, 1427, 3, 1044, 0, 0, 1209, 0, 1915,
+            2202, 1631, 0, 2263, 1454, 445, 2598, 1844, 2487, 1986, 0, 425, 1931, 359, 2037, 0,
+            203, 0, 2382, 0, 2760, 892, 968, 268, 557, 332, 881, 0, 669, 2086, 2170, 0,
+            486, 333, 0, 2816, 1244, 15, 1132, 554, 0, 0, 1828, 0, 335, 347, 0, 2217,
+            610, 0, 0, 487, 0, 1629, 490, 0, 2525, 657, 1879, 1519, 1632, 0, 0, 790,
+            388, 2714, 1833, 1577, 301, 0, 1788, 1964, 0, 646, 495, 0, 1020, 924, 901, 1716,
+            1911, 1916, 343, 412, 0, 0, 229, 1361, 2093, 0, 2115, 0, 2485, 1140, 2732, 0,
+            0, 928, 0, 967, 1783, 78, 736, 585, 171, 366, 25, 0, 0, 0, 714, 2428,
+            1958, 2715, 1096, 0, 0, 293, 23, 331, 41, 2312, 2642, 0, 1128, 1539, 2080, 791,
+            2262, 1659, 2446, 740, 921, 0, 2414, 1658, 0, 964, 2590, 1275, 133, 0, 2802, 0,
+            1778, 823, 0, 1902, 2804, 2470, 2594, 1278, 2361, 1234, 1145, 1016, 0, 1104, 0, 590,
+            577, 1826, 2490, 329, 2719, 435, 0, 1805, 0, 2752, 1874, 2322, 1951, 360, 0, 1945,
+            0, 606, 0, 2558, 0, 0, 0, 2176, 1283, 1036, 0, 423, 970, 1211, 0, 0,
+            783, 1654, 1515, 2564, 1411, 1462, 0, 793, 2078, 0, 1534, 0, 2553, 2407, 0, 0,
+            1789, 2562, 2800, 802, 109, 1277, 2657, 0, 0, 0, 2122, 0, 637, 1650, 357, 996,
+            488, 0, 1856, 459, 0, 2026, 877, 0, 626, 1779, 0, 0, 2237, 0, 2545, 0,
+            1811, 0, 980, 0, 0, 0, 1437, 2137, 0, 1434, 895, 2374, 1013, 2318, 578, 176,
+            0, 2819, 579, 427, 631, 1985, 2101, 0, 0, 2516, 371, 2337, 1903, 2546, 718, 1652,
+            2567, 833, 0, 0, 2060, 2632, 2035, 1254, 2441, 169, 0, 1289, 2502, 1426, 563, 1836,
+            2284, 2518, 1005, 2123, 0, 0, 0, 0, 2696, 0, 918, 2271, 0, 630, 0, 1889,
+            2274, 2472, 2592, 2155, 2174, 161, 0, 2532, 0, 843, 1270, 193, 664, 0, 0, 290,
+            629, 1908, 0, 1019, 1166, 0, 0, 1114, 1100, 0, 0, 0, 2125, 997, 0, 196,
+            0, 29, 874, 0, 0, 1890, 773, 2748, 0, 0, 2020, 0, 1618, 1574, 1715, 0,
+            0, 2063, 0, 0, 212, 1887, 2131, 2091, 0, 0, 0, 1966, 0, 679, 0, 2709,
+            198, 1507, 2038, 2346, 751, 1380, 2631, 2578, 1315, 0, 2817, 1545, 0, 0, 2627, 352,
+            1081, 1563, 0, 2508, 1517, 1636, 0, 2079, 1883, 785, 2112, 760, 1021, 1324, 1897, 482,
+            1608, 806, 2373, 1483, 957, 0, 2147, 1537, 2369, 1493, 2779, 0, 71, 0, 0, 2280,
+            12, 2133, 1628, 2183, 652, 2121, 0, 2584, 0, 665, 1553, 2761, 1015, 1443, 0, 1245,
+            1017, 2025, 236, 0, 2653, 873, 0, 560, 837, 2773, 2510, 0, 350, 368, 1341, 0,
+            1581, 1374, 1532, 0, 1403, 1383, 0, 962, 0, 0, 861, 0, 0, 2352, 1418, 143,
+            789, 0, 2067, 764, 2052, 2486, 1473, 622, 889, 0, 0, 0, 1136, 1655, 2448, 2392,
+            817, 674, 200, 2547, 526, 2666, 1691, 546, 1768, 992, 2204, 0, 2780, 1941, 2169, 0,
+            0, 1705, 1542, 1663, 1319, 0, 0, 433, 0, 2109, 1001, 1417, 2370, 0, 0, 1372,
+            0, 540, 1388, 0, 238, 776, 864, 2469, 151, 2040, 1673, 1223, 1606, 0, 569, 291,
+            2285, 0, 659, 0, 374, 518, 1164, 150, 0, 322, 1063, 473, 479, 1050, 910, 1161,
+            1936, 987, 0, 1174, 0, 0, 1304, 1733, 0, 2149, 1566, 0, 1505, 1570, 2419, 0,
+            70, 0, 2778, 0, 154, 1508, 2526, 2805, 2320, 1371, 0, 662, 1714, 2599, 390, 2377,
+            0, 2034, 0, 1433, 1391, 2257, 904, 0, 0, 1638, 982, 1965, 0, 1394, 0, 1258,
+            204, 265, 593, 114, 1440, 588, 1590, 1011, 694, 2421, 2399, 0, 1993, 701, 1238, 2451,
+            2342, 112, 1419, 855, 2764, 944, 1398, 0, 0, 2182, 0, 2476, 0, 2650, 336, 2783,
+            538, 1810, 1196, 2497, 0, 0, 522, 684, 0, 2140, 0, 272, 0, 0, 0, 2408,
+            0, 0, 847, 0, 2050, 0, 0, 2637, 1256, 1003, 2609, 2364, 0, 618, 2427, 0,
+            0, 0, 709, 441, 348, 1841, 0, 931, 653, 2127, 1491, 139, 231, 0, 0, 1004,
+            0, 0, 2452, 0, 1129, 1366, 0, 0, 2482, 1745, 2231, 0, 0, 0, 734, 1014,
+            1431, 162, 981, 49, 839, 1948, 2636, 977, 2088, 0, 616, 0, 555, 605, 972, 0,
+            1484, 2544, 22, 2302, 0, 0, 1294, 2549, 1567, 2018, 976, 0, 0, 1430, 2027, 1724,
+            0, 1592, 0, 1094, 1368, 763, 0, 0, 0, 192, 1332, 1082, 86, 528, 2126, 0,
+            55, 0, 0, 0, 1227, 0, 2612, 2424, 1676, 1560, 2611, 1108, 1848, 2728, 858, 500,
+            0, 1970, 765, 1926, 0, 1853, 2353, 330, 0, 945, 0, 688, 754, 0, 0, 1287,
+            1922, 1535, 2047, 222, 2663, 0, 1594, 1457, 2634, 491, 2003, 0, 0, 1963, 1066, 1504,
+            0, 1153, 2786, 0, 1576, 2260, 1300, 510, 0, 0, 0, 0, 0, 0, 2664, 95,
+            2160, 444, 157, 465, 1399, 0, 0, 1056, 0, 2772, 1918, 214, 2192, 2669, 240, 228,
+            739, 1217, 218, 0, 2790, 1808, 0, 1474, 0, 0, 2197, 1058, 1340, 227, 0, 666,
+            703, 1045, 1498, 2394, 0, 1872, 37, 614, 832, 1799, 2644, 463, 0, 0, 1305, 1787,
+            2605, 676, 1595, 470, 1273, 2167, 119, 1818, 887, 819, 0, 925, 0, 1184, 1506, 0,
+            2826, 1335, 539, 0, 0, 0, 541, 2335, 0, 2721, 2423, 2100, 2425, 1523, 0, 717,
+            0, 0, 520, 0, 125, 385, 1452, 1913, 865, 0, 2279, 416, 0, 1934, 0, 1639,
+            2132, 2268, 840, 66, 2449, 117, 0, 615, 643, 2554, 0, 43, 1327, 1449, 1442, 0,
+            0, 405, 942, 475, 1929, 0, 1646, 0, 174, 0, 1785, 0, 2350, 0, 587, 0,
+            952, 919, 0, 2712, 2725, 1817, 1253, 1393, 969, 2757, 1760, 2347, 1089, 571, 1046, 2017,
+            2230, 0, 1353, 612, 654, 0, 1601, 2753, 508, 667, 1538, 2613, 2593, 147, 0, 0,
+            370, 2129, 2438, 28, 1401, 0, 1313, 2754, 1741, 619, 2509, 0, 419, 57, 0, 0,
+            1720, 2520, 862, 0, 0, 0, 1893, 991, 271, 1764, 2524, 0, 1264, 0, 0, 2366,
+            2531, 0, 2124, 1530, 2519, 2403, 0, 0, 0, 2572, 2467, 450, 451, 1492, 1607, 627,
+            0, 1512, 2303, 1725, 2242, 452, 2336, 2014, 0, 2142, 0, 990, 0, 1010, 1991, 26,
+            0, 2767, 0, 462, 2016, 0, 0, 1771, 0, 0, 2143, 0, 99, 2135, 0, 144,
+            2468, 0, 1286, 1871, 0, 2680, 2085, 1832, 2513, 158, 2793, 1084, 0, 1292, 2173, 1972,
+            1468, 1343, 1784, 2097, 1085, 878, 2266, 1198, 2505, 536, 1866, 2004, 0, 1824, 0, 489,
+            2212, 0, 213, 53, 404, 0, 767, 1155, 0, 0, 1726, 0, 424, 0, 391, 211,
+            0, 747, 2103, 378, 0, 650, 327, 2740, 0, 0, 1404, 1206, 197, 1682, 136, 0,
+            60, 0, 0, 905, 0, 0, 1740, 1711, 0, 2582, 183, 1157, 0, 1312, 621, 841,
+            0, 911, 1298, 0, 966, 1681, 0, 0, 983, 362, 1609, 642, 2199, 0, 2311, 0,
+            2024, 0, 2046, 1252, 576, 0, 870, 0, 1031, 1851, 1564, 1357, 1087, 0, 0, 0,
+            0, 1002, 0, 1630, 1360, 0, 0, 0, 1350, 914, 0, 201, 1662, 1364, 0, 2107,
+            0, 558, 2607, 604, 0, 273, 0, 0, 2281, 2457, 2256, 372, 0, 0, 591, 713,
+            586, 1857, 0, 515, 0, 1192, 1458, 383, 0, 2527, 0, 1930, 1303, 1279, 1346, 2597,
+            949, 0, 1940, 0, 1061, 2615, 2105, 708, 2296, 0, 1323, 0, 1389, 715, 2250, 257,
+            295, 324, 0, 1947, 0, 581, 0, 1544, 1513, 1602, 514, 815, 1516, 494, 0, 2269,
+            0, 700, 1208, 0, 1875, 1973, 0, 1804, 1987, 2751, 0, 850, 1052, 656, 2177, 0,
+            0, 478, 2671, 2282, 2766, 771, 0, 2002, 2693, 2104, 0, 1718, 2411, 190, 2434, 351,
+            0, 2157, 2431, 340, 1721, 0, 1190, 1660, 1415, 2738, 543, 2273, 0, 421, 2209, 1727,
+            0, 1054, 0, 2685, 989, 0, 1229, 379, 2214, 1156, 0, 2483, 1919, 559, 2000, 0,
+            2480, 1514, 2758, 1881, 0, 2559, 551, 649, 0, 0, 0, 2365, 2586, 1299, 1228, 1260,
+            0, 0, 369, 965, 1078, 0, 1845, 0, 2788, 1524, 2007, 1712, 814, 2049, 0, 0,
+            975, 1144, 519, 0, 129, 232, 1333, 0, 1459, 1378, 0, 111, 936, 0, 0, 0,
+            1012, 2539, 0, 1347, 453, 0, 2, 312, 0, 96, 0, 0, 77, 1858, 1645, 0,
+            0, 1099, 1549, 2162, 1494, 0, 0, 729, 1997, 1185, 0, 699, 0, 0, 7, 0,
+            1322, 1262, 364, 0, 0, 568, 947, 2437, 1379, 744, 1480, 0, 0, 1177, 1117, 1622,
+            0, 951, 0, 603, 1961, 0, 1860, 2359, 1671, 113, 2193, 0, 0, 0, 761, 73,
+            1420, 1310, 2475, 0, 2071, 985, 1617, 2118, 2367, 2314, 501, 1802, 506, 2119, 0, 611,
+            392, 1487, 1280, 2321, 0, 1150, 772, 0, 0, 1455, 0, 2538, 2036, 827, 721, 0,
+            2645, 0, 2053, 2628, 414, 1600, 0, 0, 875, 69, 0, 1960, 0, 1034, 455, 2688,
+            1246, 0, 0, 45, 0, 525, 2528, 1983, 1895, 395, 0, 1988, 1825, 1259, 0, 2068,
+            711, 118, 2583, 1032, 1750, 0, 76, 941, 2397, 2247, 696, 2375, 913, 0, 2136, 103,
+            2618, 651, 472, 2812, 1968, 0, 2646, 0, 72, 2227, 0, 178, 2181, 84, 2070, 2662,
+            91, 2689, 1925, 2726, 0, 1693, 2443, 1210, 2294, 2641, 848, 532, 0, 778, 0, 224,
+            2211, 2654, 0, 1158, 1781, 0, 1489, 1207, 2713, 628, 2090, 140, 0, 0, 375, 0,
+            0, 503, 1717, 1331, 2345, 0, 1556, 0, 0, 565, 0, 677, 0, 0, 859, 0,
+            1205, 0, 2616, 0, 2045, 0, 2471, 0, 0, 0, 1924, 0, 0, 2307, 0, 0,
+            1578, 0, 2775, 2682, 647, 164, 0, 402, 1855, 0, 1674, 1338, 682, 1641, 1162, 1330,
+            0, 2301, 1950, 1216, 0, 0, 2655, 2357, 0, 389, 0, 0, 318, 187, 2769, 978,
+            1271, 2488, 0, 2697, 1072, 0, 1490, 872, 2098, 1255, 853, 1999, 0, 1569, 1749, 805,
+            1962, 0, 1920, 1604, 0, 1230, 2372, 0, 0, 0, 2379, 0, 2534, 807, 0, 0,
+            0, 0, 0, 1977, 693, 2409, 180, 0, 1302, 0, 1336, 0, 2219, 1812, 0, 54,
+            40, 0, 1386, 1946, 168, 2094, 0, 1956, 2570, 409, 0, 0, 2416, 2083, 1509, 2386,
+            810, 0, 0, 1170, 2203, 0, 896, 0, 499, 100, 620, 1976, 0, 2494, 1370, 0,
+            2390, 0, 220, 0, 160, 0, 1232, 0, 1651, 2218, 2213, 2652, 256, 0, 562, 0,
+            2440, 746, 0, 849, 1447, 477, 899, 0, 804, 2189, 0, 1870, 1568, 2608, 0, 302,
+            1923, 2288, 152, 0, 795, 241, 0, 0, 2759, 2658, 0, 337, 0, 1543, 1980, 474,
+            1791, 0, 1354, 2238, 2398, 1365, 315, 781, 0, 2233, 1751, 181, 731, 159, 1905, 505,
+            2550, 0, 63, 1071, 0, 561, 0, 1900, 0, 2229, 0, 1644, 0, 2432, 907, 2535,
+            1554, 0, 553, 2533, 639, 0, 1059, 0, 0, 2723, 1381, 0, 65, 440, 1236, 1620,
+            1675, 2489, 0, 1752, 0, 0, 0, 2744, 2456, 0, 695, 52, 955, 0, 5, 2742,
+            0, 0, 437, 2500, 1195, 661, 1421, 448, 835, 2013, 1917, 2710, 0, 890, 1460, 673,
+            0, 0, 0, 923, 663, 1422, 0, 1121, 0, 828, 852, 898, 165, 148, 2051, 0,
+            2299, 1838, 758, 2737, 685, 1103, 0, 0, 0, 1047, 0, 580, 0, 0, 0, 0,
+            2272, 2261, 0, 0, 199, 215, 468, 0, 2383, 0, 0, 1555, 2808, 0, 356, 131,
+            2015, 960, 1547, 0, 0, 0, 2638, 0, 496, 1774, 0, 2363, 0, 999, 0, 0,
+            917, 625, 1759, 0, 1955, 0, 0, 556, 954, 1888, 163, 2084, 0, 0, 0, 431,
+            1634, 1463, 205, 2244, 2679, 2226, 177, 2291, 0, 0, 2789, 809, 733, 2075, 430, 0,
+            207, 0, 1348, 2522, 609, 1171, 0, 0, 1181, 428, 0, 0, 0, 1840, 0, 2731,
+            35, 0, 2707, 2008, 0, 0, 0, 0, 2300, 1321, 1, 0, 1892, 0, 1189, 1683,
+            1218, 0, 0, 1742, 2385, 0, 0, 0, 1448, 0, 166, 189, 2814, 636, 1290, 769,
+            1317, 2676, 1585, 0, 1251, 507, 1859, 0, 358, 857, 750, 50, 0, 1008, 958, 1599,
+            0, 0, 0, 512, 2717, 1679, 88, 672, 0, 2305, 1214, 597, 575, 191, 4, 0,
+            574, 0, 355, 1610, 1429, 728, 0, 1862, 0, 2175, 0, 2327, 0, 1397, 2813, 735,
+            2371, 0, 706, 1979, 0, 854, 2251, 0, 1172, 2179, 0, 0, 1794, 123, 0, 2225,
+            1068, 0, 0, 2278, 0, 2555, 2822, 0, 1734, 0, 2824, 1180, 1154, 255, 2144, 774,
+            1351, 0, 716, 842, 0, 2442, 2461, 1984, 0, 1241, 1591, 2171, 2283, 0, 2430, 0,
+            1090, 1295, 0, 1665, 926, 938, 803, 2574, 417, 2736, 1159, 741, 0, 2734, 1562, 2771,
+            1587, 1080, 1938, 338, 0, 2667, 303, 128, 1055, 2340, 0, 1122, 2092, 883, 0, 2601,
+            1747, 2746, 1809, 0, 223, 400, 0, 1130, 1588, 1820, 0, 0, 2823, 2235, 2614, 0,
+            1464, 0, 1499, 0, 2673, 0, 0, 0, 777, 1758, 1823, 246, 971, 1829, 326, 946,
+            811, 2762, 0, 0, 2684, 2190, 0, 0, 0, 0, 1407, 0, 0, 608, 2791, 1572,
+            426, 0, 0, 2795, 1163, 0, 0, 1201, 2543, 2012, 0, 2159, 0, 0, 155, 0,
+            1684, 321, 600, 1529, 0, 1339, 1526, 0, 0, 2351, 1123, 1261, 0, 0, 1801, 1325,
+            1424, 0, 2580, 2444, 1736, 0, 930, 1345, 0, 2344, 0, 780, 1173, 0, 0, 0,
+            2691, 1274, 138, 493, 2005, 1667, 0, 1614, 2293, 0, 0, 0, 0, 748, 0, 2622,
+            2603, 0, 2625, 304, 0, 727, 354, 1880, 0, 2158, 33, 1481, 1077, 0, 411, 900,
+            888, 2643, 2542, 2687, 0, 0, 309, 1967, 476, 1653, 2072, 1111, 613, 891, 1098, 2569,
+            83, 2151, 2768, 1006, 206, 1696, 0, 251, 933, 1250, 0, 0, 320, 2224, 640, 8,
+            0, 0, 0, 1772, 0, 58, 2803, 2255, 1557, 2306, 2019, 0, 1550, 0, 2032, 1743,
+            0, 170, 1952, 0, 2152, 1284, 502, 1470, 0, 1288, 2343, 0, 0, 0, 517, 0,
+            2617, 0, 2602, 1886, 1647, 19, 912, 2069, 0, 0, 0, 948, 0, 2164, 920, 1409,
+        };
+
+        // baseCode: second level seed per bucket
+        constexpr uint16_t baseCodeSeeds[bucketsCount] =
+        {
+            262, 3, 1, 31, 4, 1, 5, 5, 13, 3, 1, 98, 2, 2, 1, 1,
+            2, 1, 169, 9, 1, 9, 23, 13, 257, 18, 1, 260, 560, 14, 3, 0,
+            2, 256, 6, 1, 0, 1, 6, 91, 1, 19, 4, 6, 3, 1, 1, 3,
+            11, 79, 1, 49, 258, 14, 0, 1, 3, 1, 2, 2, 6, 22, 72, 1,
+            2, 44, 1, 1, 8, 2, 3, 2, 707, 10, 9, 1, 260, 1, 9, 6,
+            13, 2, 36, 249, 514, 10, 9, 5, 14, 2, 0, 5, 142, 0, 256, 3,
+            0, 54, 5, 4, 8, 0, 2, 19, 3, 44, 6, 8, 11, 8, 1, 1,
+            1, 1, 1, 256, 8, 0, 199, 56, 17, 5, 1, 3, 3, 1, 74, 15,
+            776, 18, 3, 1, 2, 116, 5, 4, 120, 258, 3, 8, 0, 136, 3, 1,
+            1, 1, 4, 4, 9, 0, 1, 8, 15, 2, 8, 3, 34, 10, 134, 1,
+            1, 2, 27, 66, 262, 17, 1, 0, 38, 7, 2, 8, 1, 4, 4, 7,
+            1, 256, 36, 14, 2, 1, 512, 3, 1, 1, 264, 1, 9, 18, 6, 256,
+            1, 344, 7, 1, 81, 0, 258, 14, 1, 0, 3, 260, 6, 2, 29, 10,
+            56, 3, 20, 3, 2, 2, 4, 7, 2, 25, 3, 29, 1, 66, 1, 25,
+            49, 1, 8, 36, 18, 7, 4, 1, 43, 2, 262, 3, 71, 8, 1, 2,
+            258, 1, 4, 258, 771, 0, 11, 39, 258, 2, 1, 15, 43, 260, 15, 3,
+            1, 138, 11, 9, 6, 5, 13, 18, 33, 256, 2, 1, 104, 2, 195, 4,
+            39, 92, 5, 5, 1, 1, 2, 1, 1, 2, 1, 1, 5, 4, 26, 131,
+            1, 0, 7, 260, 2, 264, 1, 136, 8, 1, 11, 5, 1, 2, 398, 0,
+            10, 26, 9, 1, 25, 2, 11, 264, 261, 3, 270, 1, 68, 30, 8, 1,
+            269, 2, 16, 1, 256, 1, 10, 1, 3, 3, 1, 1, 3, 7, 1, 771,
+            6, 1, 4, 1, 288, 7, 10, 2, 1, 11, 40, 10, 3, 13, 1, 2,
+            1, 513, 1, 8, 1, 36, 1, 259, 0, 37, 11, 5, 1, 1, 5, 2,
+            512, 257, 32, 257, 0, 5, 2, 0, 1, 1, 2, 4, 0, 0, 9, 3,
+            2, 0, 159, 1, 0, 8, 46, 2, 12, 0, 11, 16, 3, 51, 769, 88,
+            25, 7, 512, 87, 17, 27, 21, 1, 2, 520, 3, 10, 1, 2, 1, 28,
+            14, 0, 142, 4, 145, 12, 773, 139, 4, 66, 0, 20, 1, 256, 1, 19,
+            20, 16, 2, 16, 6, 260, 768, 0, 264, 22, 6, 0, 3, 7, 24, 1,
+            9, 1, 7, 27, 1, 0, 1, 246, 0, 3, 7, 4, 2, 3, 28, 1,
+            1, 1, 27, 1, 1, 17, 13, 268, 3, 13, 3, 5, 19, 2, 15, 512,
+            18, 773, 3, 0, 3, 3, 32, 9, 7, 4, 46, 262, 7, 263, 100, 8,
+            2, 4, 389, 53, 66, 2, 18, 1, 2, 4, 5, 84, 27, 25, 129, 81,
+            0, 3, 1, 2, 56, 2, 769, 256, 65, 34, 32, 1, 0, 325, 1, 0,
+            9, 768, 73, 264, 389, 2, 18, 6, 88, 6, 261, 0, 224, 75, 1, 11,
+            71, 7, 387, 44, 259, 157, 16, 32, 0, 19, 23, 127, 11, 273, 1, 81,
+            0, 0, 13, 3, 18, 4, 12, 9, 1, 1, 1, 1, 12, 1, 0, 20,
+            3, 37, 151, 1, 2, 2, 10, 9, 3, 6, 36, 66, 1, 182, 0, 11,
+            7, 16, 395, 402, 3, 4, 4, 10, 605, 6, 15, 2, 518, 285, 6, 8,
+            1, 2, 8, 4, 0, 2, 24, 1, 296, 2, 0, 111, 21, 257, 4, 1,
+            1, 259, 20, 204, 7, 282, 9, 7, 257, 37, 6, 30, 39, 10, 260, 9,
+            522, 2, 1, 1, 1, 56, 54, 18, 30, 0, 19, 1, 2, 71, 2, 23,
+            24, 1, 1, 11, 281, 429, 0, 6, 74, 9, 267, 8, 8, 0, 1, 1,
+            1, 5, 2, 1, 262, 161, 3, 74, 11, 8, 261, 23, 1, 772, 4, 9,
+            261, 1, 14, 9, 42, 256, 390, 19, 98, 512, 7, 257, 51, 256, 265, 11,
+            265, 0, 2, 11, 1, 0, 1, 1, 7, 206, 68, 2, 24, 170, 12, 75,
+            76, 5, 10, 6, 261, 0, 1, 7, 8, 1, 30, 1, 6, 1, 262, 5,
+            137, 16, 9, 97, 1, 43, 0, 5, 0, 36, 259, 0, 9, 18, 79, 19,
+            1, 12, 3, 1, 23, 258, 17, 27, 2, 2, 103, 1, 16, 0, 1, 3,
+            259, 0, 271, 267, 0, 259, 22, 116, 60, 771, 1, 28, 7, 256, 115, 2,
+            78, 11, 11, 3, 327, 269, 9, 2, 4, 3, 4, 2, 7, 7, 64, 67,
+            15, 24, 74, 339, 7, 21, 328, 259, 53, 258, 3, 6, 276, 257, 23, 39,
+            419, 258, 504, 5, 159, 5, 257, 195, 113, 4, 113, 265, 259, 102, 1, 0,
+            257, 0, 35, 1, 260, 528, 518, 98, 2, 871, 16, 43, 720, 8, 5, 1,
+            221, 12, 13, 11, 421, 3, 1, 3, 0, 25, 2, 1, 17, 2, 14, 11,
+            7, 8, 0, 618, 2, 0, 10, 3, 3, 2, 0, 4, 281, 1, 0, 60,
+            0, 25, 1, 513, 1, 8, 23, 6, 258, 1, 8, 260, 11, 10, 256, 2,
+            8, 258, 8, 4, 518, 252, 273, 277, 15, 149, 16, 49, 3, 265, 34, 3,
+            3, 324, 62, 1, 171, 13, 3, 11, 26, 14, 1, 20, 5, 0, 0, 15,
+            4, 469, 19, 266, 2, 274, 7, 24, 8, 258, 171, 14, 4, 87, 66, 513,
+            771, 20, 19, 14, 257, 210, 6, 1, 2, 15, 6, 0, 18, 161, 1, 9,
+            272, 119, 5, 1, 25, 10, 263, 7, 1, 0, 773, 1, 30, 271, 768, 1,
+            1, 266, 28, 35, 514, 268, 0, 17, 23, 8, 0, 131, 18, 7, 7, 18,
+            1, 13, 265, 10, 769, 35, 0, 9, 3, 6, 5, 259, 18, 18, 4, 37,
+            13, 1, 8, 262, 519, 29, 8, 24, 3, 0, 4, 46, 5, 256, 1, 271,
+        };
+
+        // baseCode: table position + 1 per slot, 0 is an empty slot
+        constexpr uint16_t baseCodeSlots[slotsCount] =
+        {
+            1621, 773, 389, 1382, 1907, 0, 68, 0, 0, 0, 2182, 0, 1322, 130, 1748, 1998,
+            1759, 403, 1867, 1175, 1278, 527, 0, 1365, 1355, 1794, 1169, 1041, 2368, 0, 0, 2720,
+            0, 219, 1803, 400, 1163, 2622, 2303, 113, 128, 0, 2733, 2750, 0, 625, 38, 2055,
+            0, 1741, 1128, 443, 1337, 2673, 2226, 0, 669, 821, 0, 344, 0, 1554, 0, 2596,
+            2267, 0, 0, 0, 597, 1220, 394, 2619, 0, 1745, 0, 1615, 1828, 0, 2384, 0,
+            431, 2114, 0, 0, 923, 651, 1727, 2763, 674, 47, 1061, 1970, 592, 395, 2139, 2606,
+            1215, 2108, 0, 0, 959, 0, 0, 0, 0, 0, 212, 0, 2420, 574, 0, 2215,
+            1595, 1712, 0, 1170, 0, 0, 433, 1243, 0, 988, 1694, 0, 2265, 2557, 672, 1978,
+            0, 0, 0, 853, 924, 0, 194, 2065, 0, 2259, 2492, 0, 2681, 258, 1947, 0,
+            2059, 1050, 1054, 1462, 330, 0, 0, 0, 2102, 0, 0, 0, 0, 0, 0, 753,
+            898, 1461, 0, 360, 2169, 422, 851, 0, 2153, 346, 0, 2648, 1097, 0, 2719, 0,
+            2045, 601, 0, 2097, 987, 1854, 664, 2657, 2330, 2579, 0, 1898, 0, 0, 371, 2510,
+            430, 368, 2106, 0, 1109, 0, 636, 1864, 680, 0, 2207, 0, 485, 171, 0, 0,
+            414, 2441, 1779, 0, 1575, 0, 0, 0, 0, 1549, 0, 1383, 1414, 1208, 2812, 1269,
+            880, 0, 0, 0, 1634, 0, 1743, 2561, 226, 0, 0, 892, 1406, 2356, 1730, 1813,
+            0, 0, 4, 720, 2708, 1090, 1213, 2252, 1460, 1202, 1871, 1661, 1659, 2499, 54, 1232,
+            1567, 2379, 0, 0, 0, 0, 310, 1310, 0, 1019, 0, 163, 0, 0, 661, 1971,
+            0, 567, 0, 1751, 0, 81, 2675, 2373, 0, 0, 0, 0, 1824, 336, 1544, 0,
+            2272, 704, 1806, 605, 0, 1889, 1766, 763, 2454, 343, 1819, 175, 0, 1134, 2250, 1958,
+            0, 0, 1360, 1260, 393, 512, 193, 2225, 2524, 0, 1877, 135, 1469, 2148, 1226, 0,
+            1344, 0, 2479, 1959, 2123, 0, 2291, 0, 2425, 0, 1740, 1361, 0, 264, 897, 166,
+            0, 762, 865, 232, 2043, 1793, 1468, 2727, 357, 1199, 179, 2761, 0, 2070, 1464, 0,
+            754, 28, 82, 0, 1380, 1428, 1291, 0, 0, 1358, 396, 0, 1431, 306, 2555, 2417,
+            1627, 1782, 2061, 0, 1352, 0, 2655, 0, 1251, 1523, 771, 2393, 0, 1983, 0, 915,
+            2183, 0, 932, 0, 0, 2650, 2256, 32, 819, 1917, 1018, 0, 1950, 173, 2391, 1718,
+            0, 1599, 0, 2090, 1023, 1467, 1107, 0, 2017, 1975, 0, 0, 2355, 1666, 519, 1446,
+            0, 0, 2066, 1250, 170, 2019, 1795, 0, 2124, 1176, 2578, 410, 2700, 612, 1778, 2656,
+            2694, 2801, 685, 0, 1762, 1095, 0, 0, 0, 0, 2615, 2214, 2815, 350, 2641, 1565,
+            2044, 240, 0, 0, 0, 820, 2570, 495, 2286, 0, 648, 0, 1702, 2724, 0, 2616,
+            1940, 813, 0, 426, 2381, 2300, 2432, 37, 0, 1287, 0, 1499, 1203, 1891, 957, 0,
+            2022, 0, 1513, 2010, 1479, 809, 1371, 40, 0, 2264, 1605, 2522, 353, 0, 0, 706,
+            1818, 1682, 0, 0, 204, 0, 333, 0, 1857, 1159, 1588, 1489, 2144, 0, 0, 243,
+            507, 1543, 2210, 0, 0, 0, 920, 1184, 0, 0, 1536, 1067, 1212, 2532, 2374, 2731,
+            74, 0, 658, 476, 2527, 56, 359, 906, 1188, 2075, 2316, 0, 792, 1934, 407, 0,
+            0, 2581, 0, 0, 0, 0, 775, 2028, 1658, 1883, 0, 0, 2765, 1065, 2131, 0,
+            0, 0, 2206, 0, 1231, 1121, 0, 0, 807, 531, 794, 224, 0, 0, 2572, 0,
+            1276, 0, 0, 2785, 0, 0, 2181, 45, 6, 366, 683, 2005, 0, 2415, 1873, 0,
+            1698, 0, 2771, 1194, 149, 0, 0, 1919, 0, 2085, 0, 291, 690, 2024, 547, 1938,
+            506, 0, 1316, 319, 0, 2235, 261, 1928, 0, 2223, 0, 1234, 948, 0, 1723, 2704,
+            2468, 2535, 1033, 1003, 2056, 516, 573, 1048, 991, 474, 0, 2545, 0, 0, 0, 0,
+            0, 870, 0, 1229, 1192, 0, 0, 2103, 849, 62, 2798, 0, 2411, 0, 1540, 0,
+            774, 1868, 127, 0, 2760, 2702, 0, 2773, 0, 1733, 563, 1943, 429, 0, 0, 1771,
+            0, 1981, 1379, 1356, 1641, 24, 0, 2639, 2274, 2321, 861, 1005, 5, 0, 1434, 0,
+            0, 677, 0, 1545, 2149, 1913, 0, 2260, 928, 575, 2244, 2401, 1535, 0, 1475, 0,
+            2462, 0, 0, 228, 599, 0, 223, 152, 0, 2033, 0, 724, 1533, 0, 0, 123,
+            947, 2647, 0, 0, 1589, 0, 935, 2141, 657, 918, 1237, 2031, 1336, 1923, 0, 973,
+            0, 1737, 856, 2433, 0, 1521, 0, 1789, 2273, 375, 2069, 1969, 0, 2351, 2439, 1039,
+            1511, 0, 147, 0, 1753, 0, 387, 1275, 0, 1030, 0, 1582, 0, 1965, 0, 0,
+            1062, 0, 747, 369, 0, 710, 2699, 1187, 1548, 0, 697, 1026, 2360, 1071, 1422, 2547,
+            314, 1233, 649, 0, 0, 539, 0, 1266, 0, 2711, 1869, 1841, 0, 39, 525, 2450,
+            1137, 0, 801, 738, 0, 0, 632, 2128, 1451, 0, 938, 356, 0, 933, 0, 1006,
+            832, 13, 0, 2312, 0, 1201, 0, 0, 0, 0, 1055, 776, 2092, 1238, 148, 384,
+            2341, 2600, 1638, 0, 653, 0, 0, 0, 1348, 2408, 168, 2580, 0, 0, 2792, 2573,
+            1036, 0, 2192, 2313, 828, 1678, 1076, 325, 0, 2348, 2009, 2172, 764, 0, 1471, 406,
+            1529, 471, 2188, 1941, 1775, 1517, 1786, 2762, 0, 560, 1413, 1362, 2115, 1116, 0, 787,
+            438, 1669, 824, 0, 0, 0, 1823, 0, 1131, 2349, 208, 2395, 2346, 0, 1538, 0,
+            0, 1932, 132, 1587, 2537, 2331, 77, 952, 615, 2503, 0, 1525, 125, 2469, 2071, 2747,
+            0, 1633, 251, 35, 0, 0, 0, 1357, 1253, 761, 2778, 755, 217, 0, 446, 844,
+            2776, 2467, 1508, 0, 2782, 90, 796, 510, 1427, 0, 1092, 1293, 0, 1945, 0, 255,
+            0, 713, 1764, 1320, 2489, 1145, 783, 1010, 1750, 0, 884, 1267, 1691, 641, 1706, 102,
+            1341, 1088, 2193, 1623, 1600, 2665, 492, 0, 1172, 0, 903, 0, 2245, 1099, 2239, 817,
+            1625, 1130, 1200, 0, 0, 0, 0, 860, 0, 1391, 0, 1570, 2626, 1825, 630, 0,
+            1926, 703, 0, 0, 0, 2638, 0, 0, 2663, 1628, 867, 308, 0, 0, 900, 1241,
+            2612, 2113, 1797, 2403, 1648, 0, 1646, 0, 2517, 0, 0, 0, 2399, 79, 1000, 1875,
+            736, 2583, 1432, 872, 665, 0, 759, 80, 136, 2237, 2016, 0, 0, 518, 1313, 323,
+            459, 645, 2520, 789, 1844, 0, 791, 0, 620, 723, 1445, 0, 1966, 0, 1614, 0,
+            927, 2496, 1843, 334, 0, 2328, 1369, 1673, 1977, 0, 0, 1148, 2118, 2484, 1802, 702,
+            0, 1808, 239, 1979, 2736, 2007, 370, 1903, 0, 2359, 655, 2042, 1847, 0, 2458, 43,
+            1384, 2563, 0, 1295, 470, 129, 0, 1504, 766, 1717, 160, 2485, 1993, 1885, 0, 2185,
+            1809, 871, 2431, 1709, 2799, 0, 908, 0, 1268, 0, 0, 0, 0, 2807, 253, 2540,
+            0, 2506, 0, 1514, 2571, 1385, 0, 488, 0, 0, 2610, 0, 995, 0, 2809, 2678,
+            0, 1114, 1098, 0, 0, 154, 2498, 0, 2184, 501, 909, 2553, 0, 2464, 1073, 1677,
+            177, 0, 167, 2241, 1440, 934, 0, 0, 729, 0, 1007, 0, 2825, 2658, 961, 0,
+            0, 0, 2494, 144, 1534, 1905, 0, 1339, 1274, 1437, 1895, 417, 1086, 1085, 0, 0,
+            1235, 0, 1002, 94, 2110, 572, 1112, 2154, 588, 1528, 1027, 2117, 1547, 2698, 1893, 0,
+            329, 1811, 684, 1396, 0, 0, 185, 535, 954, 420, 806, 1848, 0, 552, 0, 1179,
+            23, 885, 0, 0, 0, 737, 0, 352, 0, 1656, 2387, 513, 0, 1477, 364, 0,
+            768, 9, 0, 971, 2685, 445, 1752, 2378, 1904, 0, 2819, 0, 338, 0, 2459, 137,
+            0, 0, 1516, 1093, 1290, 351, 0, 1721, 558, 800, 2495, 778, 0, 2692, 0, 1671,
+            1096, 1962, 0, 1459, 660, 0, 0, 1577, 0, 1744, 2701, 1560, 107, 1597, 0, 2644,
+            2074, 0, 2533, 0, 0, 1944, 0, 1626, 0, 0, 0, 2000, 0, 1556, 2466, 814,
+            121, 2718, 2723, 0, 2151, 2552, 140, 1707, 1985, 779, 0, 292, 0, 2275, 1153, 187,
+            2594, 464, 379, 1305, 2620, 0, 1402, 210, 2478, 483, 405, 0, 0, 2749, 1009, 1177,
+            2376, 1106, 2171, 0, 0, 1562, 2470, 1652, 1101, 0, 0, 218, 0, 454, 0, 111,
+            0, 2772, 1366, 0, 0, 0, 941, 855, 2230, 2487, 1840, 0, 1524, 537, 1838, 0,
+            0, 0, 380, 2397, 1719, 0, 638, 0, 413, 11, 0, 260, 1769, 182, 712, 2676,
+            1651, 0, 1397, 0, 0, 0, 57, 0, 2347, 449, 1770, 2589, 1327, 2588, 468, 0,
+            2426, 2491, 0, 0, 0, 85, 2767, 0, 1933, 1271, 1, 0, 0, 544, 0, 0,
+            2014, 0, 902, 2345, 2443, 0, 2456, 1443, 0, 1329, 444, 2407, 1239, 548, 0, 1609,
+            1788, 0, 418, 2161, 0, 0, 2296, 78, 1618, 392, 2538, 2729, 0, 1784, 0, 675,
+            2111, 1455, 0, 0, 2686, 0, 442, 214, 2280, 1113, 0, 0, 29, 2754, 0, 2400,
+            2410, 469, 1505, 2030, 2818, 1657, 1160, 213, 2136, 1004, 0, 0, 455, 0, 0, 0,
+            679, 1100, 2222, 1722, 1117, 0, 1167, 484, 2735, 1787, 1520, 1563, 2145, 0, 1527, 0,
+            2445, 2380, 93, 2448, 2541, 2150, 490, 1801, 0, 2531, 1400, 1650, 1552, 1118, 1057, 256,
+            0, 0, 0, 0, 2802, 165, 0, 1480, 2062, 0, 1830, 0, 1973, 989, 2261, 1861,
+            0, 1060, 1311, 388, 1035, 1395, 0, 2651, 0, 2640, 245, 1568, 0, 75, 0, 1154,
+            726, 1450, 2251, 0, 2827, 1747, 0, 2774, 1654, 2683, 0, 0, 0, 780, 1735, 0,
+            1306, 104, 1561, 0, 0, 311, 1249, 0, 1541, 1152, 0, 0, 378, 0, 2814, 1758,
+            1102, 564, 1193, 1639, 733, 1573, 2311, 596, 2219, 0, 0, 802, 2238, 0, 105, 0,
+            1756, 0, 2514, 2196, 452, 0, 1314, 0, 1492, 602, 750, 0, 532, 1345, 0, 514,
+            692, 297, 0, 1417, 2689, 0, 2306, 1024, 1470, 0, 2806, 1996, 613, 858, 0, 0,
+            1897, 358, 0, 241, 18, 0, 174, 0, 460, 2500, 2127, 434, 0, 2073, 324, 610,
+            2453, 1829, 2528, 2817, 2766, 0, 1763, 1921, 929, 1539, 1884, 25, 0, 1272, 0, 1672,
+            2363, 477, 0, 1058, 1069, 1927, 2012, 2198, 0, 770, 1607, 0, 2811, 0, 20, 0,
+            1330, 1309, 0, 27, 1433, 0, 1209, 0, 381, 0, 0, 1111, 247, 1178, 0, 295,
+            2740, 0, 1340, 1110, 982, 863, 0, 1221, 845, 116, 701, 1856, 1696, 0, 894, 1014,
+            59, 2283, 699, 895, 1817, 0, 2748, 643, 2140, 404, 0, 584, 1045, 1613, 2493, 0,
+            0, 1077, 1037, 502, 937, 2366, 50, 1836, 0, 0, 0, 1083, 0, 0, 1439, 786,
+            606, 2389, 1820, 1773, 635, 1986, 1125, 2228, 2278, 0, 1173, 1925, 2006, 1591, 51, 594,
+            1636, 0, 437, 348, 0, 176, 1283, 1642, 0, 2050, 838, 1522, 0, 2781, 0, 2310,
+            876, 2158, 1800, 622, 0, 1103, 115, 2011, 1008, 850, 522, 788, 0, 1416, 2734, 0,
+            270, 0, 216, 234, 0, 0, 1075, 2058, 2405, 2404, 0, 1746, 2120, 76, 719, 1710,
+            725, 1728, 717, 1031, 254, 0, 0, 0, 916, 3, 1044, 562, 0, 1138, 0, 0,
+            0, 1409, 0, 2263, 1454, 2078, 2598, 533, 534, 0, 156, 186, 197, 8, 1334, 374,
+            203, 0, 616, 1805, 2691, 912, 0, 2741, 2299, 0, 1418, 0, 2472, 0, 1240, 1761,
+            960, 0, 1911, 0, 1328, 15, 1210, 180, 0, 355, 1946, 0, 998, 0, 0, 0,
+            614, 288, 0, 0, 1206, 798, 873, 0, 1620, 236, 139, 1580, 1632, 0, 2195, 644,
+            274, 2714, 0, 2504, 604, 0, 0, 782, 2744, 0, 0, 1668, 2076, 896, 2233, 1593,
+            1254, 145, 0, 2023, 225, 0, 804, 1692, 0, 2093, 190, 0, 2502, 1136, 0, 0,
+            0, 2542, 2679, 1197, 0, 671, 0, 1881, 2674, 2543, 244, 1494, 2560, 0, 714, 905,
+            0, 2199, 305, 0, 0, 2447, 0, 408, 0, 2436, 2764, 0, 1351, 878, 138, 634,
+            2262, 2613, 2446, 722, 478, 2253, 2429, 0, 1984, 2544, 2788, 1263, 134, 2327, 2780, 0,
+            1016, 875, 0, 0, 2794, 2490, 2654, 1296, 0, 1688, 1155, 1043, 1704, 1171, 1217, 0,
+            0, 289, 2460, 0, 2712, 0, 1282, 2094, 0, 2752, 1874, 0, 1951, 910, 19, 88,
+            587, 271, 231, 159, 0, 2119, 0, 2488, 1594, 117, 0, 423, 0, 1211, 0, 0,
+            0, 2530, 0, 2564, 2288, 1576, 0, 1430, 0, 183, 530, 1749, 0, 2412, 524, 0,
+            1218, 2562, 2800, 262, 2063, 1277, 0, 2002, 0, 1598, 1273, 0, 2060, 2270, 0, 1415,
+            0, 401, 0, 221, 373, 1486, 882, 0, 2804, 2190, 0, 249, 1393, 2287, 2383, 0,
+            579, 1350, 0, 2100, 198, 0, 993, 2155, 1755, 1860, 877, 888, 1013, 1583, 578, 0,
+            2202, 1665, 0, 205, 1307, 1703, 2173, 0, 0, 2258, 981, 14, 0, 2546, 662, 2248,
+            693, 201, 1392, 0, 1681, 2276, 0, 493, 2753, 2279, 0, 0, 0, 848, 2133, 1960,
+            0, 2512, 1052, 0, 568, 0, 0, 0, 0, 0, 2664, 2707, 0, 980, 0, 1056,
+            2068, 196, 2730, 2269, 2084, 555, 0, 233, 0, 921, 1270, 290, 1732, 2706, 2213, 0,
+            891, 1509, 0, 2029, 0, 1689, 0, 1104, 441, 0, 0, 979, 2739, 0, 0, 785,
+            2309, 1174, 621, 1388, 0, 1890, 797, 419, 450, 0, 2548, 0, 1289, 1742, 2320, 0,
+            0, 2104, 0, 0, 0, 0, 0, 0, 447, 676, 0, 1812, 1976, 98, 0, 2709,
+            879, 0, 2038, 2629, 301, 1515, 2690, 728, 1315, 994, 2643, 1995, 0, 1754, 741, 0,
+            2323, 1846, 0, 2137, 363, 1376, 0, 0, 480, 1999, 0, 0, 646, 0, 131, 2035,
+            0, 772, 1412, 1624, 950, 248, 642, 2677, 266, 2216, 2779, 0, 36, 30, 2550, 2147,
+            2333, 0, 372, 0, 0, 2175, 0, 2584, 1955, 890, 1991, 2820, 1655, 1551, 0, 2821,
+            1017, 0, 2232, 0, 2632, 1931, 2082, 0, 101, 528, 2294, 416, 2083, 2481, 2662, 0,
+            0, 0, 0, 1224, 2176, 1046, 0, 956, 2628, 2200, 263, 0, 2790, 0, 2337, 0,
+            0, 0, 1635, 1644, 0, 2098, 637, 1375, 919, 0, 565, 341, 1143, 1990, 2696, 267,
+            435, 1089, 0, 108, 0, 2666, 0, 0, 0, 756, 0, 0, 529, 0, 2775, 0,
+            2047, 2130, 0, 2018, 0, 0, 0, 0, 2072, 0, 2529, 811, 2370, 1851, 0, 0,
+            2793, 0, 0, 0, 238, 815, 864, 691, 1765, 2040, 2461, 1308, 0, 2322, 1663, 0,
+            2285, 2627, 659, 0, 526, 0, 2787, 2343, 1490, 0, 985, 0, 83, 1094, 846, 1181,
+            1954, 2660, 1265, 1149, 2134, 2682, 2770, 0, 0, 1783, 1572, 0, 1772, 1438, 2427, 141,
+            70, 0, 593, 0, 1147, 466, 2556, 273, 2329, 757, 1774, 0, 1935, 2599, 1518, 2559,
+            0, 2268, 1906, 2392, 2726, 494, 265, 0, 0, 315, 857, 2132, 1832, 0, 1729, 1258,
+            917, 0, 887, 498, 1012, 2652, 1878, 748, 730, 2421, 2375, 0, 1997, 727, 1444, 500,
+            0, 631, 1318, 830, 2565, 930, 0, 543, 2051, 1068, 2756, 2476, 0, 0, 0, 2783,
+            538, 1503, 1028, 0, 2095, 2364, 2732, 1987, 0, 554, 0, 377, 114, 545, 2126, 2418,
+            508, 0, 153, 0, 2483, 0, 0, 2637, 1256, 1049, 0, 2064, 0, 617, 2428, 2813,
+            0, 229, 0, 0, 481, 0, 1288, 997, 0, 0, 427, 2671, 0, 1695, 0, 1015,
+            0, 0, 0, 0, 1129, 0, 0, 970, 0, 949, 2725, 0, 0, 0, 734, 1040,
+            1559, 1247, 0, 667, 889, 0, 425, 0, 0, 0, 0, 195, 1165, 608, 0, 0,
+            1248, 486, 0, 2168, 1790, 2822, 0, 2549, 1321, 1711, 976, 0, 1799, 0, 2027, 0,
+            0, 242, 0, 0, 1368, 0, 626, 1281, 339, 461, 150, 402, 0, 2319, 1815, 2642,
+            2001, 650, 0, 0, 1227, 0, 0, 2424, 986, 0, 428, 1180, 1734, 0, 259, 496,
+            2728, 2604, 2382, 0, 0, 0, 2623, 0, 0, 2167, 1862, 1974, 0, 0, 157, 1697,
+            118, 0, 2170, 619, 0, 1495, 1546, 1849, 2634, 0, 0, 0, 0, 162, 1066, 0,
+            0, 1186, 2653, 945, 1876, 2576, 1300, 294, 1612, 0, 0, 0, 1497, 2422, 1452, 2471,
+            0, 1982, 448, 0, 0, 439, 542, 1189, 1244, 2605, 2746, 1135, 0, 2738, 0, 1399,
+            2336, 1569, 100, 2105, 2609, 2116, 161, 2156, 2636, 0, 2558, 293, 0, 0, 0, 618,
+            1537, 990, 1603, 914, 0, 1476, 0, 0, 1937, 745, 0, 463, 215, 0, 0, 0,
+            0, 1791, 1359, 1555, 0, 0, 2437, 1653, 2394, 235, 1957, 925, 0, 1191, 0, 1225,
+            2826, 1814, 1252, 99, 2125, 0, 0, 0, 2539, 1606, 2414, 1082, 2344, 1579, 2122, 1482,
+            1510, 0, 972, 0, 421, 1915, 58, 852, 893, 60, 2568, 0, 1630, 1629, 424, 0,
+            1029, 0, 2081, 0, 0, 839, 0, 2301, 2751, 962, 0, 191, 1363, 2247, 0, 1796,
+            0, 0, 1353, 0, 0, 0, 0, 0, 0, 0, 1483, 399, 627, 200, 0, 716,
+            2551, 886, 0, 739, 0, 1390, 1222, 0, 2586, 456, 479, 0, 1064, 571, 2179, 0,
+            0, 1664, 1389, 576, 1519, 0, 0, 0, 2087, 698, 0, 1821, 0, 383, 246, 1826,
+            0, 0, 0, 743, 842, 549, 2281, 2255, 2284, 1435, 2618, 155, 2109, 1909, 1496, 557,
+            0, 320, 866, 926, 0, 0, 0, 687, 0, 0, 2526, 515, 1264, 120, 1807, 2180,
+            257, 0, 2178, 2048, 2519, 2166, 499, 2670, 0, 967, 1132, 505, 0, 504, 0, 663,
+            0, 0, 2645, 2162, 2567, 2021, 0, 2054, 0, 2227, 523, 1436, 268, 868, 1967, 0,
+            0, 2482, 0, 0, 87, 1845, 0, 0, 1294, 0, 1425, 0, 0, 827, 0, 2601,
+            0, 2254, 0, 707, 0, 2745, 2121, 0, 2523, 0, 2592, 996, 0, 0, 810, 1972,
+            1285, 0, 2302, 977, 312, 826, 2266, 793, 73, 536, 1866, 0, 1922, 1484, 1354, 2143,
+            0, 2611, 2475, 53, 0, 1346, 462, 1168, 0, 0, 0, 2797, 55, 0, 2661, 2096,
+            451, 1611, 1930, 2308, 0, 2249, 0, 2474, 550, 0, 1404, 133, 668, 2332, 44, 0,
+            0, 1022, 0, 862, 2290, 0, 0, 742, 603, 2795, 1394, 840, 2052, 1419, 2338, 841,
+            0, 2243, 1298, 0, 2743, 1487, 0, 0, 472, 0, 520, 2342, 487, 1936, 2020, 2212,
+            2435, 943, 2377, 1246, 0, 0, 0, 1684, 1372, 1349, 0, 0, 1166, 2318, 0, 0,
+            126, 2242, 1956, 968, 1312, 0, 0, 1531, 2034, 1939, 0, 0, 0, 26, 0, 769,
+            0, 1780, 581, 751, 1301, 2157, 0, 0, 397, 682, 0, 1645, 0, 0, 0, 681,
+            586, 0, 0, 2574, 0, 1183, 1458, 1214, 0, 2513, 398, 1896, 92, 1781, 2, 2597,
+            482, 0, 2354, 2480, 999, 2590, 0, 708, 337, 2352, 347, 209, 942, 715, 0, 2659,
+            316, 0, 0, 1230, 313, 0, 1731, 1592, 0, 340, 0, 2369, 1324, 0, 1831, 2041,
+            0, 1408, 1151, 0, 1617, 966, 0, 1647, 0, 0, 72, 2402, 1601, 969, 0, 0,
+            1335, 0, 705, 0, 0, 1571, 1257, 0, 0, 0, 2304, 1842, 0, 2518, 2465, 585,
+            467, 1297, 711, 2768, 1423, 0, 1190, 2189, 1421, 511, 1590, 189, 1441, 590, 2107, 0,
+            0, 1853, 1637, 0, 1908, 0, 1374, 0, 0, 1156, 0, 0, 143, 1604, 541, 0,
+            7, 142, 2217, 2305, 0, 1865, 805, 2191, 0, 0, 0, 1051, 1899, 1326, 2326, 1398,
+            1886, 1373, 119, 0, 1081, 0, 0, 0, 2398, 0, 1879, 2295, 317, 2049, 777, 34,
+            0, 1127, 2246, 0, 790, 2339, 700, 328, 1319, 1378, 0, 1053, 744, 1491, 0, 1472,
+            2367, 21, 0, 2324, 1726, 0, 881, 1182, 2057, 2205, 0, 0, 760, 1858, 2177, 409,
+            0, 0, 1882, 0, 983, 345, 2077, 252, 0, 1133, 0, 1716, 0, 1643, 765, 0,
+            1364, 1262, 1757, 0, 0, 0, 64, 904, 2340, 1001, 818, 2361, 0, 822, 1144, 2507,
+            1662, 964, 0, 1834, 1063, 0, 1566, 2289, 0, 2521, 1485, 1498, 0, 0, 1080, 2315,
+            1420, 1304, 237, 0, 1442, 0, 1924, 752, 2473, 2314, 0, 0, 2591, 598, 0, 611,
+            2357, 0, 1280, 0, 458, 1150, 688, 181, 0, 0, 1502, 1011, 2423, 901, 184, 0,
+            2631, 1667, 2194, 2221, 0, 1474, 1196, 1880, 580, 559, 0, 2455, 0, 1034, 0, 0,
+            823, 1798, 354, 1892, 199, 0, 112, 1047, 1377, 0, 0, 1988, 46, 1259, 0, 2164,
+            2434, 331, 1342, 940, 975, 0, 2236, 63, 0, 1449, 696, 1699, 2438, 1760, 0, 1140,
+            673, 654, 2607, 0, 2209, 362, 2646, 0, 103, 1142, 0, 561, 0, 859, 1581, 275,
+            1564, 2786, 2240, 0, 0, 2534, 2442, 2805, 2440, 1512, 825, 1687, 0, 0, 0, 0,
+            2067, 2816, 1686, 1158, 2036, 0, 2577, 367, 2585, 1488, 0, 42, 2257, 2234, 0, 0,
+            0, 1228, 411, 0, 0, 0, 1466, 2003, 0, 2419, 0, 721, 0, 1792, 321, 0,
+            1205, 0, 0, 2758, 2451, 0, 0, 0, 1660, 1602, 2142, 342, 0, 1816, 0, 1833,
+            2593, 1387, 0, 0, 0, 0, 2575, 0, 52, 22, 0, 1338, 1407, 475, 1162, 2684,
+            0, 0, 0, 1216, 0, 0, 0, 944, 1679, 1219, 0, 0, 318, 207, 2769, 0,
+            0, 41, 0, 2697, 965, 0, 831, 382, 1715, 2680, 1164, 2163, 0, 1236, 2508, 48,
+            951, 869, 1713, 1837, 1481, 2511, 799, 0, 1332, 95, 633, 2174, 307, 781, 0, 0,
+            0, 465, 0, 0, 1405, 2409, 0, 2231, 96, 0, 110, 0, 412, 0, 0, 202,
+            206, 0, 577, 2635, 0, 390, 1948, 1596, 1532, 0, 2501, 546, 0, 2101, 2722, 2386,
+            1701, 0, 0, 1122, 0, 0, 1457, 0, 1918, 1767, 556, 2757, 0, 1198, 1370, 0,
+            1989, 1708, 220, 0, 1994, 2649, 1426, 0, 1929, 0, 922, 2803, 2796, 0, 0, 0,
+            732, 1693, 2350, 2406, 2091, 1105, 899, 2595, 784, 1401, 0, 2297, 1574, 2608, 0, 302,
+            0, 2008, 69, 0, 795, 0, 1670, 0, 0, 2086, 1084, 2784, 2197, 1465, 911, 0,
+            1720, 591, 0, 2201, 686, 436, 0, 188, 361, 0, 0, 322, 86, 551, 978, 0,
+            953, 489, 946, 1331, 0, 2362, 0, 1900, 1683, 2229, 0, 1079, 0, 2463, 907, 0,
+            0, 0, 553, 2457, 2026, 1675, 1074, 146, 2204, 843, 1863, 2334, 0, 0, 847, 709,
+            385, 2536, 0, 2220, 2079, 1736, 521, 0, 731, 89, 2823, 1725, 0, 0, 10, 2742,
+            1622, 0, 0, 415, 1195, 440, 1739, 1302, 835, 2013, 1381, 0, 0, 2516, 1616, 629,
+            158, 172, 0, 2372, 656, 106, 0, 1284, 1070, 837, 1185, 1429, 0, 365, 0, 0,
+            503, 0, 913, 2039, 0, 2099, 1410, 2452, 0, 1078, 812, 2716, 0, 0, 0, 0,
+            2211, 12, 1852, 0, 376, 2715, 607, 2015, 1507, 1619, 1087, 0, 2808, 1992, 1124, 678,
+            1872, 955, 1411, 0, 0, 0, 1473, 2703, 169, 0, 2624, 808, 0, 931, 0, 335,
+            758, 0, 1586, 0, 0, 566, 0, 2298, 2554, 2630, 0, 1680, 0, 1961, 0, 1558,
+            0, 1463, 2388, 1542, 227, 2159, 0, 1146, 0, 0, 2789, 0, 1091, 0, 1953, 1888,
+            84, 1530, 1032, 1916, 250, 1119, 0, 386, 2444, 497, 2165, 2365, 735, 509, 0, 2710,
+            0, 1920, 1901, 0, 1910, 1822, 0, 2135, 327, 1333, 1255, 67, 984, 0, 2325, 1021,
+            2037, 1700, 124, 0, 1705, 1902, 272, 0, 1386, 1912, 0, 211, 2004, 0, 0, 1323,
+            0, 0, 0, 0, 1299, 122, 1859, 689, 0, 652, 749, 391, 2390, 570, 958, 2025,
+            0, 0, 0, 2509, 2717, 0, 91, 2146, 1952, 2307, 1120, 0, 0, 609, 803, 0,
+            0, 1608, 2186, 1894, 1855, 0, 0, 1242, 1724, 1640, 1839, 2687, 0, 2486, 2824, 582,
+            2371, 1500, 0, 2203, 1963, 854, 0, 1685, 1286, 0, 0, 1157, 2317, 2224, 0, 647,
+            2688, 33, 2633, 1676, 0, 589, 0, 164, 0, 0, 2525, 992, 1207, 0, 1610, 767,
+            0, 0, 833, 1115, 1804, 2477, 2449, 1553, 2759, 0, 1245, 1126, 2672, 2152, 2430, 2032,
+            600, 269, 0, 2282, 1303, 1020, 624, 1501, 2587, 0, 0, 1343, 0, 1161, 1478, 670,
+            1141, 61, 0, 0, 0, 2667, 303, 298, 2695, 491, 1914, 1139, 2293, 883, 0, 963,
+            1578, 1453, 829, 0, 1649, 0, 1585, 1949, 0, 2112, 2292, 0, 299, 1738, 2614, 222,
+            517, 0, 192, 1584, 746, 1785, 694, 569, 1964, 0, 0, 0, 457, 0, 0, 2089,
+            0, 2138, 0, 2218, 2129, 1690, 718, 0, 583, 230, 17, 2358, 0, 1835, 2791, 300,
+            2335, 1827, 0, 2582, 1042, 0, 0, 2080, 2396, 1448, 2621, 595, 0, 0, 0, 326,
+            0, 2413, 695, 0, 0, 1261, 0, 0, 1403, 0, 2721, 0, 0, 109, 1887, 1325,
+            1424, 0, 1674, 65, 0, 0, 939, 0, 1777, 0, 1292, 1631, 2187, 31, 1776, 2602,
+            0, 0, 0, 0, 151, 1108, 2271, 296, 0, 0, 1942, 0, 0, 936, 1447, 453,
+            2603, 2277, 2625, 304, 0, 2385, 2088, 66, 0, 1870, 2505, 0, 1850, 740, 0, 2755,
+            1317, 2713, 1072, 2777, 1059, 2208, 309, 1123, 1714, 0, 623, 2416, 2497, 49, 1223, 2569,
+            97, 2669, 2737, 2515, 432, 666, 71, 2668, 834, 0, 0, 0, 349, 816, 640, 16,
+            0, 2053, 1506, 473, 0, 1204, 178, 639, 1557, 0, 1810, 0, 1550, 0, 1456, 0,
+            1768, 974, 2566, 628, 874, 0, 2353, 0, 540, 1980, 1279, 2160, 2693, 0, 1968, 0,
+            2617, 0, 1025, 1493, 2810, 1347, 2705, 332, 0, 1367, 2046, 1038, 0, 0, 836, 1526,
+        };
+
+        // table positions of the picker emojis grouped by category
+        constexpr uint16_t pickerRecords[] =
+        {
+            1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117,
+            1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133,
+            1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+            1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165,
+            1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181,
+            1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197,
+            1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
+            1219, 1225, 1231, 1237, 1238, 1244, 1250, 1256, 1262, 1268, 1274, 1280, 1286, 1292, 1298, 1304,
+            1310, 1316, 1322, 1328, 1334, 1340, 1346, 1352, 1358, 1364, 1370, 1376, 1382, 1388, 1394, 1400,
+            1406, 1407, 1408, 1409, 1410, 1411, 1417, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431,
+            1432, 1438, 1444, 1450, 1456, 1462, 1468, 1480, 1486, 1492, 1498, 1504, 1510, 1516, 1522, 1528,
+            1534, 1540, 1546, 1552, 1558, 1564, 1576, 1582, 1588, 1600, 1606, 1618, 1624, 1636, 1642, 1654,
+            1660, 1666, 1672, 1678, 1684, 1690, 1696, 1702, 1708, 1714, 1720, 1726, 1732, 1738, 1744, 1750,
+            1756, 1762, 1768, 1774, 1780, 1786, 1792, 1798, 1804, 1810, 1816, 1822, 1828, 1834, 1840, 1846,
+            1852, 1858, 1864, 1870, 1876, 1882, 1888, 1900, 1906, 1919, 1924, 1936, 1942, 1954, 1960, 1972,
+            1978, 1985, 1986, 1988, 1989, 1996, 2002, 2014, 2020, 2026, 2032, 2038, 2050, 2056, 2068, 2074,
+            2086, 2092, 2104, 2110, 2122, 2128, 2140, 2146, 2158, 2164, 2176, 2182, 2194, 2200, 2212, 2218,
+            2230, 2236, 2248, 2254, 2260, 2266, 2272, 2278, 2285, 2286, 2287, 2299, 2305, 2317, 2323, 2329,
+            2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345,
+            2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361,
+            2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377,
+            2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393,
+            2394, 2395, 2396, 2397, 2398, 2399, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829,
+            830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845,
+            846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861,
+            862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877,
+            878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893,
+            894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909,
+            910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925,
+            926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941,
+            942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957,
+            958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973,
+            974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989,
+            990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005,
+            1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021,
+            1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037,
+            1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+            1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+            1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085,
+            1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101,
+            290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+            306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 331, 337,
+            344, 345, 352, 358, 370, 376, 382, 389, 395, 407, 413, 419, 431, 437, 449, 455,
+            467, 473, 485, 491, 503, 509, 521, 527, 539, 545, 557, 563, 569, 570, 571, 572,
+            573, 574, 575, 576, 577, 578, 579, 586, 592, 598, 599, 600, 601, 602, 603, 604,
+            605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 2430, 2431, 2432, 2433, 2434, 2435,
+            2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451,
+            2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467,
+            2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483,
+            2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499,
+            2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515,
+            2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531,
+            2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547,
+            2548, 2549, 2550, 2553, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626,
+            627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642,
+            643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658,
+            659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
+            675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690,
+            691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706,
+            707, 708, 709, 710, 711, 712, 713, 719, 720, 721, 722, 723, 724, 725, 726, 727,
+            728, 729, 730, 731, 732, 733, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748,
+            749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
+            765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780,
+            781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796,
+            797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812,
+            813, 814, 815, 816, 817, 818, 819, 2551, 2552, 0, 1, 2, 3, 4, 5, 6,
+            7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+            23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+            39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+            55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70,
+            71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+            87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+            103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+            119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
+            135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150,
+            151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166,
+            167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+            183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198,
+            199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
+            215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230,
+            231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246,
+            247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262,
+            263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 287, 288, 289, 2554,
+            2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570,
+            2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586,
+            2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602,
+            2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618,
+            2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634,
+            2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650,
+            2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666,
+            2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682,
+            2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698,
+            2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714,
+            2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730,
+            2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746,
+            2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762,
+            2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778,
+            2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794,
+            2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810,
+            2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2404, 2405, 2406, 2407, 2408,
+            2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424,
+            2425, 2426, 2427, 2428, 2429,
+        };
+
+        struct CategoryRange
+        {
+            std::string_view name_;
+            uint16_t begin_;
+            uint16_t end_;
+        };
+
+        constexpr CategoryRange categoryRanges[] =
+        {
+            { "people", 0, 358 },
+            { "nature", 358, 535 },
+            { "food", 535, 640 },
+            { "activity", 640, 730 },
+            { "travel", 730, 852 },
+            { "objects", 852, 1049 },
+            { "symbols", 1049, 1327 },
+            { "flags", 1327, 1595 },
+            { "modifier", 1595, 1595 },
+            { "regional", 1595, 1621 },
+        };
+    }
+}
@@ -0,0 +1,218 @@
+import os.path, re, sys
+
+# Generates EmojiIndexHash.h from the constexpr table in EmojiIndexDataNew.cpp:
+# perfect hash tables (hash and displace) for lookups by full and by base code points
+# and the picker order of emojis grouped by category.
+# Run after every change of the table: python emoji_index_gen.py
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+TABLE_PATH = os.path.join(ROOT, "EmojiIndexDataNew.cpp")
+OUTPUT_PATH = os.path.join(ROOT, "EmojiIndexHash.h")
+
+SLOTS_COUNT = 4096
+BUCKETS_COUNT = 1024
+MAX_CODEPOINTS = 8
+
+CATEGORIES_ORDER = ("people", "nature", "food", "activity", "travel", "objects", "symbols", "flags", "modifier", "regional")
+
+RECORD_REGEX = re.compile(r'EmojiRecord\("([a-z]+)", /\*.*\*/ "([0-9a-f-]+)", ([0-9]+), EmojiCode\(([0-9a-fx, ]+)\)(?:, EmojiCode\(([0-9a-fx, ]+)\))?\),')
+
+SKIN_TONES = (0x1f3fb, 0x1f3fc, 0x1f3fd, 0x1f3fe, 0x1f3ff)
+GENDERS = (0x2640, 0x2642)
+HAIR_TYPES = (0x1f9b0, 0x1f9b1, 0x1f9b2, 0x1f9b3)
+
+def parse_code(text):
+	return tuple(int(x, 16) for x in text.split(", "))
+
+def read_table():
+	records = []
+	with open(TABLE_PATH, encoding="utf-8") as file:
+		for line in file:
+			match = RECORD_REGEX.search(line)
+			if not match:
+				continue
+
+			category, file_name, index, base, full = match.groups()
+			base = parse_code(base)
+			full = parse_code(full) if full else base
+			assert len(base) <= MAX_CODEPOINTS and len(full) <= MAX_CODEPOINTS
+			records.append((category, file_name, int(index), base, full))
+
+	assert records, "emoji table not found"
+	return records
+
+# must match Emoji::HashIndex::hashCode
+def hash_code(code, seed):
+	h = (2166136261 ^ seed) & 0xffffffff
+	for codepoint in code:
+		h ^= codepoint
+		h = (h * 16777619) & 0xffffffff
+	h ^= h >> 16
+	h = (h * 0x85ebca6b) & 0xffffffff
+	h ^= h >> 13
+	h = (h * 0xc2b2ae35) & 0xffffffff
+	h ^= h >> 16
+	return h
+
+def skip_emoji(code):
+	if len(code) == 1:
+		main = code[0]
+		return ord('0') <= main <= ord('9') or main == ord('#') or main == ord('*')
+	return False
+
+def make_index(records, code_of):
+	index = {}
+	for pos, record in enumerate(records):
+		code = code_of(record)
+		if skip_emoji(record[3]):
+			continue
+		index.setdefault(code, pos)
+	return index
+
+def make_perfect_hash(index):
+	assert len(index) < SLOTS_COUNT
+
+	buckets = [[] for _ in range(BUCKETS_COUNT)]
+	for code in index:
+		buckets[hash_code(code, 0) % BUCKETS_COUNT].append(code)
+
+	seeds = [0] * BUCKETS_COUNT
+	slots = [0] * SLOTS_COUNT
+
+	for bucket_idx in sorted(range(BUCKETS_COUNT), key=lambda i: -len(buckets[i])):
+		bucket = buckets[bucket_idx]
+		if not bucket:
+			break
+
+		for seed in range(1, 0x10000):
+			positions = [hash_code(code, seed) % SLOTS_COUNT for code in bucket]
+			if len(set(positions)) == len(positions) and all(slots[p] == 0 for p in positions):
+				break
+		else:
+			sys.exit("can't build perfect hash, increase SLOTS_COUNT")
+
+		seeds[bucket_idx] = seed
+		for code, position in zip(bucket, positions):
+			slots[position] = index[code] + 1
+
+	return seeds, slots
+
+def contains_with_gender(base_index, code):
+	if len(code) >= MAX_CODEPOINTS:
+		return False
+	return any((code + (gender,)) in base_index for gender in GENDERS)
+
+def make_picker(records, base_index):
+	by_category = {category: [] for category in CATEGORIES_ORDER}
+	for pos, (category, _, _, base, _) in enumerate(records):
+		if skip_emoji(base):
+			continue
+		if any(tone in base for tone in SKIN_TONES):
+			continue
+		if contains_with_gender(base_index, base):
+			continue
+		if len(base) <= 1 and any(hair in base for hair in HAIR_TYPES):
+			continue
+		by_category[category].append(pos)
+
+	picker = []
+	ranges = []
+	for category in CATEGORIES_ORDER:
+		begin = len(picker)
+		picker += by_category[category]
+		ranges.append((category, begin, len(picker)))
+	return picker, ranges
+
+def format_array(values, indent):
+	lines = []
+	for i in range(0, len(values), 16):
+		lines.append(indent + ", ".join(str(v) for v in values[i:i + 16]) + ",")
+	return "\n".join(lines)
+
+def main():
+	records = read_table()
+	full_index = make_index(records, lambda r: r[4])
+	base_index = make_index(records, lambda r: r[3])
+
+	full_seeds, full_slots = make_perfect_hash(full_index)
+	base_seeds, base_slots = make_perfect_hash(base_index)
+	picker, ranges = make_picker(records, base_index)
+
+	indent = " " * 8
+	out = []
+	out.append("#pragma once")
+	out.append("")
+	out.append("// generated by emoji_index_gen.py from EmojiIndexDataNew.cpp, do not edit")
+	out.append("")
+	out.append("#include \"EmojiIndexDataNew.h\"")
+	out.append("")
+	out.append("namespace Emoji")
+	out.append("{")
+	out.append("    namespace HashIndex")
+	out.append("    {")
+	out.append("        static_assert(emojiTableSize == %d, \"EmojiIndexHash.h is out of date, run emoji_index_gen.py\");" % len(records))
+	out.append("")
+	out.append("        constexpr uint32_t bucketsCount = %d;" % BUCKETS_COUNT)
+	out.append("        constexpr uint32_t slotsCount = %d;" % SLOTS_COUNT)
+	out.append("")
+	out.append("        constexpr uint32_t hashCode(const EmojiCode& _code, uint32_t _seed) noexcept")
+	out.append("        {")
+	out.append("            uint32_t h = 2166136261u ^ _seed;")
+	out.append("            for (size_t i = 0, size = _code.size(); i < size; ++i)")
+	out.append("            {")
+	out.append("                h ^= _code.codepointAt(i);")
+	out.append("                h *= 16777619u;")
+	out.append("            }")
+	out.append("            h ^= h >> 16;")
+	out.append("            h *= 0x85ebca6bu;")
+	out.append("            h ^= h >> 13;")
+	out.append("            h *= 0xc2b2ae35u;")
+	out.append("            h ^= h >> 16;")
+	out.append("            return h;")
+	out.append("        }")
+	out.append("")
+
+	def emit_hash(name, seeds, slots):
+		out.append("        // %s: second level seed per bucket" % name)
+		out.append("        constexpr uint16_t %sSeeds[bucketsCount] =" % name)
+		out.append("        {")
+		out.append(format_array(seeds, indent + "    "))
+		out.append("        };")
+		out.append("")
+		out.append("        // %s: table position + 1 per slot, 0 is an empty slot" % name)
+		out.append("        constexpr uint16_t %sSlots[slotsCount] =" % name)
+		out.append("        {")
+		out.append(format_array(slots, indent + "    "))
+		out.append("        };")
+		out.append("")
+
+	emit_hash("fullCode", full_seeds, full_slots)
+	emit_hash("baseCode", base_seeds, base_slots)
+
+	out.append("        // table positions of the picker emojis grouped by category")
+	out.append("        constexpr uint16_t pickerRecords[] =")
+	out.append("        {")
+	out.append(format_array(picker, indent + "    "))
+	out.append("        };")
+	out.append("")
+	out.append("        struct CategoryRange")
+	out.append("        {")
+	out.append("            std::string_view name_;")
+	out.append("            uint16_t begin_;")
+	out.append("            uint16_t end_;")
+	out.append("        };")
+	out.append("")
+	out.append("        constexpr CategoryRange categoryRanges[] =")
+	out.append("        {")
+	for category, begin, end in ranges:
+		out.append("            { \"%s\", %d, %d }," % (category, begin, end))
+	out.append("        };")
+	out.append("    }")
+	out.append("}")
+	out.append("")
+
+	with open(OUTPUT_PATH, "w", encoding="utf-8", newline="\n") as file:
+		file.write("\n".join(out))
+
+if __name__ == '__main__':
+	main()
@@ -1,18 +1,16 @@
 #pragma once
 
+#include "../EmojiIndexDataNew.h"
+
 namespace Emoji
 {
 
-    struct EmojiRecord;
-    using EmojiRecordSptr = std::shared_ptr<EmojiRecord>;
-    using EmojiRecordSptrVec = std::vector<EmojiRecordSptr>;
-
     class EmojiCode;
 
     namespace mac {
         QImage getEmoji(const EmojiCode& code, int rectSize);
         bool supportEmoji(const EmojiCode& code);
-        void setEmojiVector(const EmojiRecordSptrVec& vector);
+        void setEmojiVector(const EmojiTable& table);
         bool isSkipEmojiFullCode(const EmojiCode& code);
     }
 }
@@ -45,15 +45,15 @@ static int getGlyphIndex(const EmojiCode& code)
     }
 }
 
-void setEmojiVector(const EmojiRecordSptrVec& vector)
+void setEmojiVector(const EmojiTable& table)
 {
     glyphs.clear();
-    for (const auto& record : vector)
+    for (const auto& record : table)
     {
-        if (isSkipEmojiFullCode(record->fullCodePoints))
+        if (isSkipEmojiFullCode(record.fullCodePoints))
             continue;
 
-        const auto g = getGlyphIndex(record->fullCodePoints);
+        const auto g = getGlyphIndex(record.fullCodePoints);
         if (g)
             glyphs.insert(g);
     }
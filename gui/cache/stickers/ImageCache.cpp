@@ -0,0 +1,122 @@
+#include "stdafx.h"
+
+#include "ImageCache.h"
+
+#include "../../core_dispatcher.h"
+#include "../../utils/DecodeStickerTask.h"
+
+namespace
+{
+    // a failed file still takes a slot, so it isn't decoded on every paint
+    constexpr qint64 failedEntrySize = 1024;
+}
+
+UI_STICKERS_NS_BEGIN
+
+ImageCache::ImageCache(qint64 _budget)
+    : budget_(_budget)
+{
+    assert(budget_ > 0);
+}
+
+QImage ImageCache::get(const QString& _path, const Waiter& _waiter)
+{
+    if (_path.isEmpty())
+        return QImage();
+
+    if (const auto it = index_.find(_path); it != index_.end())
+    {
+        entries_.splice(entries_.begin(), entries_, *it);
+        return entries_.front().image_;
+    }
+
+    const auto decoding = pending_.contains(_path);
+
+    // painted again and again until it is decoded
+    auto& waiting = pending_[_path];
+    if (std::find(waiting.begin(), waiting.end(), _waiter) == waiting.end())
+        waiting.push_back(_waiter);
+
+    if (!decoding)
+    {
+        auto task = new Utils::DecodeStickerTask(_path);
+
+        const auto succeeded = QObject::connect(task, &Utils::DecodeStickerTask::decoded, this, [this](const QString& _file, const QImage& _image)
+        {
+            onDecoded(_file, _image);
+        });
+        assert(succeeded);
+
+        QThreadPool::globalInstance()->start(task);
+    }
+
+    return QImage();
+}
+
+bool ImageCache::isPending(const QString& _path) const
+{
+    return pending_.contains(_path);
+}
+
+void ImageCache::clear()
+{
+    entries_.clear();
+    index_.clear();
+    pending_.clear();
+    footprint_ = 0;
+}
+
+void ImageCache::onDecoded(const QString& _path, const QImage& _image)
+{
+    // dropped by clear while it was decoded
+    const auto it = pending_.find(_path);
+    if (it == pending_.end())
+        return;
+
+    const auto waiting = std::move(*it);
+    pending_.erase(it);
+
+    if (index_.contains(_path))
+        return;
+
+    const qint64 size = _image.isNull() ? failedEntrySize : _image.byteCount();
+
+    entries_.push_front({ _path, _image, size });
+    index_.insert(_path, entries_.begin());
+    footprint_ += size;
+
+    trim();
+
+    for (const auto& w : waiting)
+        emit Ui::GetDispatcher()->onSticker(0, w.setId_, w.stickerId_, w.fsId_);
+}
+
+void ImageCache::dropFailed(const QString& _path)
+{
+    const auto it = index_.find(_path);
+    if (it == index_.end() || !(*it)->image_.isNull())
+        return;
+
+    footprint_ -= (*it)->size_;
+    entries_.erase(*it);
+    index_.erase(it);
+}
+
+qint64 ImageCache::footprint() const
+{
+    return footprint_;
+}
+
+void ImageCache::trim()
+{
+    // the image just added stays even if it doesn't fit
+    while (footprint_ > budget_ && entries_.size() > 1)
+    {
+        const auto& last = entries_.back();
+        footprint_ -= last.size_;
+        index_.remove(last.path_);
+        entries_.pop_back();
+    }
+}
+
+UI_STICKERS_NS_END
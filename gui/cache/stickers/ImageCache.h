@@ -0,0 +1,63 @@
+#pragma once
+
+#include "stickers.h"
+
+UI_STICKERS_NS_BEGIN
+
+// decoded sticker images by file, bounded by the size of their pixels.
+// core stores the images by content, so the stickers sharing a picture share the entry.
+// an image is decoded from the mapped file on a worker on the first use, the least recently used ones are dropped first
+class ImageCache : public QObject
+{
+public:
+    // the sticker repainted once its pending image is decoded
+    struct Waiter
+    {
+        int32_t setId_ = -1;
+        int32_t stickerId_ = 0;
+        QString fsId_;
+
+        bool operator==(const Waiter& _other) const
+        {
+            return setId_ == _other.setId_ && stickerId_ == _other.stickerId_ && fsId_ == _other.fsId_;
+        }
+    };
+
+    explicit ImageCache(qint64 _budget);
+
+    // null if the file can't be decoded or while it is decoded,
+    // in the latter case core_dispatcher::onSticker is emitted for _waiter once the image is in the cache
+    QImage get(const QString& _path, const Waiter& _waiter);
+    bool isPending(const QString& _path) const;
+    void clear();
+
+    // forgets the failed decode of _path, called when the file is stored again
+    void dropFailed(const QString& _path);
+
+    qint64 footprint() const;
+
+private:
+    struct Entry
+    {
+        QString path_;
+        QImage image_;
+        qint64 size_;
+    };
+
+    using Entries = std::list<Entry>;
+
+    void onDecoded(const QString& _path, const QImage& _image);
+    void trim();
+
+    // the most recently used first
+    Entries entries_;
+    QHash<QString, Entries::iterator> index_;
+
+    // files being decoded and the stickers waiting for them
+    QHash<QString, std::vector<Waiter>> pending_;
+
+    const qint64 budget_;
+    qint64 footprint_ = 0;
+};
+
+UI_STICKERS_NS_END
@@ -0,0 +1,197 @@
+#include "stdafx.h"
+
+#include "SuggestIndex.h"
+
+namespace
+{
+    // completions of a shorter input are mostly noise
+    constexpr int minCompletionLength = 2;
+    constexpr size_t maxCompletionsCount = 20;
+}
+
+UI_STICKERS_NS_BEGIN
+
+void SuggestIndex::build(const StickersSuggests& _suggests, const SuggestsAliases& _aliases)
+{
+    clear();
+
+    struct BuildNode
+    {
+        std::map<char16_t, uint32_t> children_;
+        std::vector<Posting> postings_;
+    };
+
+    std::vector<BuildNode> trie(1);
+    QHash<QString, uint32_t> stickers;
+
+    const auto insertKeyword = [&trie](const QString& _keyword) -> BuildNode&
+    {
+        uint32_t node = 0;
+        for (const auto c : _keyword)
+        {
+            const auto ch = static_cast<char16_t>(c.unicode());
+            auto it = trie[node].children_.find(ch);
+            if (it == trie[node].children_.end())
+            {
+                trie.emplace_back();
+                it = trie[node].children_.emplace(ch, uint32_t(trie.size() - 1)).first;
+            }
+            node = it->second;
+        }
+        return trie[node];
+    };
+
+    const auto addPostings = [this, &stickers](BuildNode& _node, const Suggest& _suggest, bool _alias)
+    {
+        for (const auto& s : _suggest)
+        {
+            auto it = stickers.find(s.fsId_);
+            if (it == stickers.end())
+            {
+                it = stickers.insert(s.fsId_, uint32_t(fsIds_.size()));
+                fsIds_.push_back(s.fsId_);
+            }
+            _node.postings_.push_back({ *it, s.type_, _alias });
+        }
+    };
+
+    for (const auto& [keyword, suggest] : _suggests)
+    {
+        if (!keyword.isEmpty())
+            addPostings(insertKeyword(keyword), suggest, false);
+    }
+
+    // the stickers of the word itself go before the stickers of its emojis
+    for (const auto& [word, emojis] : _aliases)
+    {
+        if (word.isEmpty())
+            continue;
+
+        auto& node = insertKeyword(word);
+        for (const auto& emoji : emojis)
+        {
+            if (const auto it = _suggests.find(emoji); it != _suggests.end())
+                addPostings(node, it->second, true);
+        }
+    }
+
+    nodes_.resize(trie.size());
+    chars_.resize(trie.size());
+
+    std::vector<uint32_t> order;
+    order.reserve(trie.size());
+    order.push_back(0);
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        const auto& buildNode = trie[order[i]];
+        auto& node = nodes_[i];
+
+        node.firstChild_ = uint32_t(order.size());
+        node.childrenCount_ = uint32_t(buildNode.children_.size());
+        for (const auto& [ch, child] : buildNode.children_)
+        {
+            chars_[order.size()] = ch;
+            order.push_back(child);
+        }
+
+        node.postingsBegin_ = uint32_t(postings_.size());
+        postings_.insert(postings_.end(), buildNode.postings_.begin(), buildNode.postings_.end());
+        node.postingsEnd_ = uint32_t(postings_.size());
+    }
+
+    seen_.assign(fsIds_.size(), 0);
+    queue_.reserve(nodes_.size());
+}
+
+void SuggestIndex::clear()
+{
+    nodes_.clear();
+    chars_.clear();
+    postings_.clear();
+    fsIds_.clear();
+    seen_.clear();
+    generation_ = 0;
+    queue_.clear();
+}
+
+bool SuggestIndex::find(const QString& _keyword, SuggestTypes _types, Suggest& _suggest) const
+{
+    _suggest.clear();
+
+    if (_keyword.isEmpty() || _types.isEmpty())
+        return false;
+
+    const auto nodeIndex = findNode(_keyword);
+    if (nodeIndex == invalidNode)
+        return false;
+
+    if (++generation_ == 0)
+    {
+        std::fill(seen_.begin(), seen_.end(), 0);
+        generation_ = 1;
+    }
+
+    const auto& node = nodes_[nodeIndex];
+    appendPostings(node, _types, std::numeric_limits<size_t>::max(), _suggest);
+
+    // emojis have no meaningful completions
+    if (_keyword.size() >= minCompletionLength && _keyword.at(0).isLetter())
+    {
+        queue_.clear();
+        for (uint32_t i = 0; i < node.childrenCount_; ++i)
+            queue_.push_back(node.firstChild_ + i);
+
+        for (size_t head = 0; head < queue_.size() && _suggest.size() < maxCompletionsCount; ++head)
+        {
+            const auto& child = nodes_[queue_[head]];
+            appendPostings(child, _types, maxCompletionsCount, _suggest);
+
+            for (uint32_t i = 0; i < child.childrenCount_; ++i)
+                queue_.push_back(child.firstChild_ + i);
+        }
+    }
+
+    return !_suggest.empty();
+}
+
+uint32_t SuggestIndex::findNode(const QString& _keyword) const
+{
+    if (nodes_.empty())
+        return invalidNode;
+
+    uint32_t node = 0;
+    for (const auto c : _keyword)
+    {
+        const auto ch = static_cast<char16_t>(c.unicode());
+        const auto begin = chars_.begin() + nodes_[node].firstChild_;
+        const auto end = begin + nodes_[node].childrenCount_;
+
+        const auto it = std::lower_bound(begin, end, ch);
+        if (it == end || *it != ch)
+            return invalidNode;
+
+        node = uint32_t(it - chars_.begin());
+    }
+
+    return node;
+}
+
+void SuggestIndex::appendPostings(const Node& _node, SuggestTypes _types, size_t _maxCount, Suggest& _suggest) const
+{
+    for (auto i = _node.postingsBegin_; i < _node.postingsEnd_ && _suggest.size() < _maxCount; ++i)
+    {
+        const auto& posting = postings_[i];
+        if (!_types.has(posting.type_) || (posting.alias_ && !_types.has(SuggestType::suggestWord)))
+            continue;
+
+        auto& seen = seen_[posting.sticker_];
+        if (seen == generation_)
+            continue;
+
+        seen = generation_;
+        _suggest.emplace_back(QString(fsIds_[posting.sticker_]), posting.type_);
+    }
+}
+
+UI_STICKERS_NS_END
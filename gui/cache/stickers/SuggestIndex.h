@@ -0,0 +1,54 @@
+#pragma once
+
+#include "stickers.h"
+
+UI_STICKERS_NS_BEGIN
+
+// prefix trie over the suggest keywords and the word aliases, built once per suggests update.
+// the nodes are laid out breadth-first with the children of a node next to each other,
+// so a lookup is a binary search per input char and a query doesn't allocate
+class SuggestIndex
+{
+public:
+    void build(const StickersSuggests& _suggests, const SuggestsAliases& _aliases);
+    void clear();
+
+    // the stickers of _keyword itself first, then of the longer keywords starting with it, shorter keywords go first.
+    // a sticker is returned once
+    bool find(const QString& _keyword, SuggestTypes _types, Suggest& _suggest) const;
+
+private:
+    struct Posting
+    {
+        uint32_t sticker_;
+        SuggestType type_;
+        // came from a word alias, used for the word suggests only
+        bool alias_;
+    };
+
+    struct Node
+    {
+        uint32_t firstChild_ = 0;
+        uint32_t childrenCount_ = 0;
+        uint32_t postingsBegin_ = 0;
+        uint32_t postingsEnd_ = 0;
+    };
+
+    static constexpr uint32_t invalidNode = std::numeric_limits<uint32_t>::max();
+
+    uint32_t findNode(const QString& _keyword) const;
+    void appendPostings(const Node& _node, SuggestTypes _types, size_t _maxCount, Suggest& _suggest) const;
+
+    std::vector<Node> nodes_;
+    // the char leading to the node
+    std::vector<char16_t> chars_;
+    std::vector<Posting> postings_;
+    std::vector<QString> fsIds_;
+
+    // query scratch, the generation marks the stickers already returned by the current query
+    mutable std::vector<uint32_t> seen_;
+    mutable uint32_t generation_ = 0;
+    mutable std::vector<uint32_t> queue_;
+};
+
+UI_STICKERS_NS_END
@@ -15,6 +15,8 @@
 #include <boost/range/adaptor/reversed.hpp>
 
 #include "stickers.h"
+#include "SuggestIndex.h"
+#include "ImageCache.h"
 
 UI_STICKERS_NS_BEGIN
 
@@ -23,6 +25,9 @@ Cache& getCache();
 
 constexpr const std::string_view emoji_type("emoji");
 
+// enough for a page of the smiles menu and the recent stickers in the history
+constexpr qint64 imageCacheBudget = 32 * 1024 * 1024;
+
 const int32_t getSetIconEmptySize()
 {
     return Utils::scale_value(128);
@@ -30,8 +35,9 @@ const int32_t getSetIconEmptySize()
 
 Sticker::Sticker() = default;
 
-Sticker::Sticker(const int32_t _id)
+Sticker::Sticker(const int32_t _id, const int32_t _setId)
     : id_(_id)
+    , setId_(_setId)
 {
     assert(id_ > 0);
 }
@@ -47,7 +53,7 @@ void Sticker::unserialize(core::coll_helper _coll)
 
     fsId_ = QString::fromUtf8(_coll.get_value_as_string("fs_id", ""));
 
-    setId_ = _coll.get_value_as_int("set_id", -1);
+    setId_ = _coll.get_value_as_int("set_id", setId_);
 
     if (_coll.is_value_exist("emoji"))
     {
@@ -90,41 +96,60 @@ QImage Sticker::getImage(const core::sticker_size _size, const bool _scaleIfNeed
 {
     _scaled = false;
 
+    auto& cache = getCache().getImages();
+    const ImageCache::Waiter waiter = { setId_, int32_t(id_), fsId_ };
+
     if (const auto found = images_.find(_size); found != images_.end())
     {
-        const auto& image = std::get<0>(found->second);
+        auto image = cache.get(std::get<0>(found->second), waiter);
 
         if (!image.isNull() || !_scaleIfNeed)
             return image;
     }
 
-    if (!images_.empty() && _scaleIfNeed)
+    if (_scaleIfNeed)
     {
         for (const auto& x : boost::adaptors::reverse(boost::adaptors::values(images_)))
         {
-            if (const auto& image = std::get<0>(x); !image.isNull())
+            if (const auto& path = std::get<0>(x); !path.isEmpty())
             {
-                _scaled = true;
-                return image;
+                if (auto image = cache.get(path, waiter); !image.isNull())
+                {
+                    _scaled = true;
+                    return image;
+                }
+
+                // the biggest stored size is decoded first, the others aren't started meanwhile
+                if (cache.isPending(path))
+                    break;
             }
         }
-
-        return std::get<0>(images_.rbegin()->second);
     }
 
     return QImage();
 }
 
-void Sticker::setImage(const core::sticker_size _size, QImage _image)
+void Sticker::setImageFile(const core::sticker_size _size, const QString& _path)
 {
-    assert(!_image.isNull());
+    assert(!_path.isEmpty());
     assert(_size > core::sticker_size::min);
     assert(_size < core::sticker_size::max);
 
-    auto &imageData = images_[_size];
+    std::get<0>(images_[_size]) = _path;
+}
 
-    if (std::get<0>(imageData).isNull())
-        imageData = std::make_tuple(std::move(_image), false);
+bool Sticker::hasImageFile(const core::sticker_size _size) const
+{
+    if (const auto found = images_.find(_size); found != images_.end())
+        return !std::get<0>(found->second).isEmpty();
+    return false;
+}
+
+bool Sticker::isImagePending(const core::sticker_size _size) const
+{
+    if (const auto found = images_.find(_size); found != images_.end())
+        return getCache().getImages().isPending(std::get<0>(found->second));
+    return false;
 }
 
 bool Sticker::isImageRequested(const core::sticker_size _size) const
@@ -136,14 +161,7 @@ bool Sticker::isImageRequested(const core::sticker_size _size) const
 
 void Sticker::setImageRequested(const core::sticker_size _size, const bool _val)
 {
-    auto &imageData = images_[_size];
-
-    imageData = std::make_tuple(
-        std::get<0>(imageData),
-        _val
-        );
-
-    assert(!_val || std::get<0>(imageData).isNull());
+    std::get<1>(images_[_size]) = _val;
 }
 
 const std::vector<QString>& Sticker::getEmojis()
@@ -153,13 +171,9 @@ const std::vector<QString>& Sticker::getEmojis()
 
 void Sticker::clearCache()
 {
+    // the files stay, the pixels are dropped with the image cache
     for (auto &pair : images_)
-        pair.second = std::make_tuple(QImage(), false);
-}
-
-const std::map<core::sticker_size, Sticker::image_data>& Sticker::getImages() const
-{
-    return images_;
+        std::get<1>(pair.second) = false;
 }
 
 bool Sticker::isGif() const
@@ -185,13 +199,20 @@ QImage Set::getStickerImage(const int32_t _stickerId, const core::sticker_size _
     auto iter = stickersTree_.find(_stickerId);
     if (iter == stickersTree_.end())
     {
-        iter = stickersTree_.insert(std::make_pair(_stickerId, std::make_shared<Sticker>(_stickerId))).first;
+        iter = stickersTree_.insert(std::make_pair(_stickerId, std::make_shared<Sticker>(_stickerId, getId()))).first;
     }
 
     bool scaled = false;
     auto image = iter->second->getImage(_size, _scaleIfNeed, scaled);
 
-    if ((scaled || image.isNull()) && !iter->second->isImageRequested(_size) && !iter->second->isFailed())
+    // repainted once the stored file is decoded
+    const auto pending = iter->second->isImagePending(_size);
+
+    // the stored file is broken, requesting it again returns the same file
+    if (image.isNull() && iter->second->hasImageFile(_size) && !pending)
+        iter->second->setFailed(true);
+
+    if ((scaled || image.isNull()) && !pending && !iter->second->isImageRequested(_size) && !iter->second->isFailed())
     {
         const auto setId = getId();
         assert(setId > 0);
@@ -216,7 +237,7 @@ void Set::setStickerFailed(const int32_t _stickerId)
     auto iter = stickersTree_.find(_stickerId);
     if (iter == stickersTree_.end())
     {
-        updateSticker = std::make_shared<Ui::Stickers::Sticker>(_stickerId);
+        updateSticker = std::make_shared<Ui::Stickers::Sticker>(_stickerId, getId());
         stickersTree_[_stickerId] = updateSticker;
     }
     else
@@ -227,7 +248,7 @@ void Set::setStickerFailed(const int32_t _stickerId)
     updateSticker->setFailed(true);
 }
 
-void Set::setStickerImage(const int32_t _stickerId, const core::sticker_size _size, QImage _image)
+void Set::setStickerImageFile(const int32_t _stickerId, const core::sticker_size _size, const QString& _path)
 {
     assert(_stickerId > 0);
 
@@ -236,7 +257,7 @@ void Set::setStickerImage(const int32_t _stickerId, const core::sticker_size _si
     auto iter = stickersTree_.find(_stickerId);
     if (iter == stickersTree_.end())
     {
-        updateSticker = std::make_shared<Ui::Stickers::Sticker>(_stickerId);
+        updateSticker = std::make_shared<Ui::Stickers::Sticker>(_stickerId, getId());
         stickersTree_[_stickerId] = updateSticker;
     }
     else
@@ -244,7 +265,7 @@ void Set::setStickerImage(const int32_t _stickerId, const core::sticker_size _si
         updateSticker = iter->second;
     }
 
-    updateSticker->setImage(_size, std::move(_image));
+    updateSticker->setImageFile(_size, _path);
 }
 
 void Set::setBigIcon(QImage _image)
@@ -557,7 +578,13 @@ QString getSendBaseUrl()
     return getCache().getTemplateSendBaseUrl();
 }
 
-Cache::Cache() = default;
+Cache::Cache()
+    : suggestIndex_(std::make_unique<SuggestIndex>())
+    , images_(std::make_unique<ImageCache>(imageCacheBudget))
+{
+}
+
+Cache::~Cache() = default;
 
 void Cache::setStickerData(const core::coll_helper& _coll)
 {
@@ -595,21 +622,21 @@ void Cache::setStickerData(const core::coll_helper& _coll)
 
     if (error == 0)
     {
-        const auto loadData = [&_coll, stickerSet, sticker, stickerId](std::string_view _id, const core::sticker_size _size)
+        // the image is decoded when it is painted
+        const auto loadPath = [this, &_coll, stickerSet, sticker, stickerId](std::string_view _id, const core::sticker_size _size)
         {
             if (_coll->is_value_exist(_id))
             {
-                auto data = _coll.get_value_as_stream(_id);
-                const auto dataSize = data->size();
-
-                QImage image;
-                if (!image.loadFromData(data->read(dataSize), dataSize))
+                const auto path = QString::fromUtf8(_coll.get_value_as_string(_id));
+                if (path.isEmpty())
                     return false;
 
+                images_->dropFailed(path);
+
                 if (stickerSet)
-                    stickerSet->setStickerImage(stickerId, _size, std::move(image));
+                    stickerSet->setStickerImageFile(stickerId, _size, path);
                 else if (sticker)
-                    sticker->setImage(_size, std::move(image));
+                    sticker->setImageFile(_size, path);
                 else
                     assert(!"sticker error");
             }
@@ -618,11 +645,11 @@ void Cache::setStickerData(const core::coll_helper& _coll)
 
         const auto res =
         {
-            loadData("data/small", core::sticker_size::small),
-            loadData("data/medium", core::sticker_size::medium),
-            loadData("data/large", core::sticker_size::large),
-            loadData("data/xlarge", core::sticker_size::xlarge),
-            loadData("data/xxlarge", core::sticker_size::xxlarge),
+            loadPath("path/small", core::sticker_size::small),
+            loadPath("path/medium", core::sticker_size::medium),
+            loadPath("path/large", core::sticker_size::large),
+            loadPath("path/xlarge", core::sticker_size::xlarge),
+            loadPath("path/xxlarge", core::sticker_size::xxlarge),
         };
         if (std::any_of(res.begin(), res.end(), [](const bool _r) { return !_r; }))
         {
@@ -818,8 +845,8 @@ void Cache::unserialize_suggests(const core::coll_helper &_coll)
     if (!suggests)
         return;
 
-    suggests_.clear();
-    aliases_.clear();
+    StickersSuggests suggestsMap;
+    SuggestsAliases aliasesMap;
 
     for (core::iarray::size_type i = 0, suggestsSize = suggests->size(); i < suggestsSize; ++i)
     {
@@ -843,30 +870,31 @@ void Cache::unserialize_suggests(const core::coll_helper &_coll)
                 ((collSticker.get_value_as_string("type") == emoji_type) ? SuggestType::suggestEmoji : SuggestType::suggestWord));
         }
 
-        suggests_.emplace(std::move(emoji), std::move(suggest));
+        suggestsMap.emplace(std::move(emoji), std::move(suggest));
     }
 
-    core::iarray* aliases = _coll.get_value_as_array("aliases");
-    if (!aliases)
-        return;
-
-    for (core::iarray::size_type i = 0, aliasesSize = aliases->size(); i < aliasesSize; ++i)
+    if (core::iarray* aliases = _coll.get_value_as_array("aliases"))
     {
-        core::coll_helper coll_alias(aliases->get_at(i)->get_as_collection(), false);
+        for (core::iarray::size_type i = 0, aliasesSize = aliases->size(); i < aliasesSize; ++i)
+        {
+            core::coll_helper coll_alias(aliases->get_at(i)->get_as_collection(), false);
 
-        core::iarray* emojiArray = coll_alias.get_value_as_array("emojies");
-        if (!emojiArray)
-            return;
+            core::iarray* emojiArray = coll_alias.get_value_as_array("emojies");
+            if (!emojiArray)
+                continue;
 
-        const QString word = QString::fromUtf8(coll_alias.get_value_as_string("word")).toLower();
+            const QString word = QString::fromUtf8(coll_alias.get_value_as_string("word")).toLower();
 
-        for (core::iarray::size_type j = 0, emojiArraySize = emojiArray->size(); j < emojiArraySize; ++j)
-        {
-            QString emoji = QString::fromUtf8(emojiArray->get_at(j)->get_as_string());
+            for (core::iarray::size_type j = 0, emojiArraySize = emojiArray->size(); j < emojiArraySize; ++j)
+            {
+                QString emoji = QString::fromUtf8(emojiArray->get_at(j)->get_as_string());
 
-            aliases_[word].push_back(std::move(emoji));
+                aliasesMap[word].push_back(std::move(emoji));
+            }
         }
     }
+
+    suggestIndex_->build(suggestsMap, aliasesMap);
 }
 
 void Cache::clean_search_cache()
@@ -956,40 +984,23 @@ void Cache::clearCache()
 
     for (auto& [_, s] : fsStickers_)
         s->clearCache();
+
+    images_->clear();
 }
 
-bool Cache::getSuggest(const QString& _keyword, Suggest& _suggest, const std::set<SuggestType>& _types) const
+ImageCache& Cache::getImages()
 {
-    QVarLengthArray<QString> keywords;
-    keywords.push_back(_keyword);
-
-    if (const auto iter_alias = aliases_.find(_keyword); iter_alias != aliases_.end() && _types.find(SuggestType::suggestWord) != _types.end())
-    {
-        for (const auto& _emoji : iter_alias->second)
-            keywords.push_back(_emoji);
-    }
-
-    _suggest.clear();
-
-    for (const auto& _cur_keyword : keywords)
-    {
-        auto iter_suggest = suggests_.find(_cur_keyword);
-        if (iter_suggest == suggests_.end())
-            continue;
+    return *images_;
+}
 
-        for (const auto& _s : iter_suggest->second)
-        {
-            if (_types.find(_s.type_) != _types.end())
-            {
-                if (_suggest.end() == std::find(_suggest.begin(), _suggest.end(), _s))
-                {
-                    _suggest.push_back(_s);
-                }
-            }
-        }
-    }
+qint64 Cache::getImagesFootprint() const
+{
+    return images_->footprint();
+}
 
-    return !_suggest.empty();
+bool Cache::getSuggest(const QString& _keyword, Suggest& _suggest, SuggestTypes _types) const
+{
+    return suggestIndex_->find(_keyword, _types, _suggest);
 }
 
 void Cache::requestSearch(const QString &_term)
@@ -1076,7 +1087,12 @@ QImage getStickerImage(const QString& _fsId, const core::sticker_size _size, con
     bool scaled = false;
     auto image = s->getImage(_size, _scaleIfNeed, scaled);
 
-    if ((scaled || image.isNull()) && !s->isImageRequested(_size) && !s->isFailed())
+    const auto pending = s->isImagePending(_size);
+
+    if (image.isNull() && s->hasImageFile(_size) && !pending)
+        s->setFailed(true);
+
+    if ((scaled || image.isNull()) && !pending && !s->isImageRequested(_size) && !s->isFailed())
     {
         Ui::GetDispatcher()->getSticker(_fsId, _size);
 
@@ -1178,20 +1194,20 @@ setSptr getStoreSet(const int32_t _setId)
     return getCache().getStoreSet(_setId);
 }
 
-bool getSuggest(const QString& _keyword, Suggest& _suggest, std::set<SuggestType>& _types)
+bool getSuggest(const QString& _keyword, Suggest& _suggest, SuggestTypes _types)
 {
     return getCache().getSuggest(_keyword, _suggest, _types);
 }
 
 bool getSuggestWithSettings(const QString& _keyword, Suggest& _suggest)
 {
-    std::set<SuggestType> types;
+    SuggestTypes types;
 
     if (get_gui_settings()->get_value<bool>(settings_show_suggests_emoji, true))
-        types.insert(SuggestType::suggestEmoji);
+        types.add(SuggestType::suggestEmoji);
 
     if (get_gui_settings()->get_value<bool>(settings_show_suggests_words, true))
-        types.insert(SuggestType::suggestWord);
+        types.add(SuggestType::suggestWord);
 
     return getCache().getSuggest(_keyword, _suggest, types);
 }
@@ -1218,6 +1234,11 @@ void resetCache()
         g_cache.reset();
 }
 
+qint64 getImagesFootprint()
+{
+    return g_cache ? g_cache->getImagesFootprint() : 0;
+}
+
 Cache& getCache()
 {
     if (!g_cache)
@@ -16,7 +16,8 @@ UI_STICKERS_NS_BEGIN
 class Sticker
 {
 public:
-    typedef std::tuple<QImage, bool> image_data;
+    // the stored file and whether it is requested, the pixels live in the image cache
+    typedef std::tuple<QString, bool> image_data;
 
 private:
     uint32_t id_ = 0;
@@ -35,7 +36,7 @@ private:
 
 public:
     Sticker();
-    Sticker(const int32_t _id);
+    Sticker(const int32_t _id, const int32_t _setId = -1);
     Sticker(const QString& _fsId);
 
     int32_t getId() const;
@@ -45,7 +46,9 @@ public:
     const QString& getFsId() const;
 
     QImage getImage(const core::sticker_size _size, bool _scaleIfNeed, bool& _scaled) const;
-    void setImage(const core::sticker_size _size, QImage _image);
+    void setImageFile(const core::sticker_size _size, const QString& _path);
+    bool hasImageFile(const core::sticker_size _size) const;
+    bool isImagePending(const core::sticker_size _size) const;
 
     void setFailed(const bool _failed);
     bool isFailed() const;
@@ -58,8 +61,6 @@ public:
     void unserialize(core::coll_helper _coll);
     void clearCache();
 
-    const std::map<core::sticker_size, image_data>& getImages() const;
-
     bool isGif() const;
 };
 
@@ -134,7 +135,7 @@ public:
     bool empty() const;
 
     QImage getStickerImage(const int32_t _stickerId, const core::sticker_size _size, const bool _scaleIfNeed);
-    void setStickerImage(const int32_t _stickerId, const core::sticker_size _size, QImage _image);
+    void setStickerImageFile(const int32_t _stickerId, const core::sticker_size _size, const QString& _path);
     void setBigIcon(QImage _image);
     void setStickerFailed(const int32_t _stickerId);
     void resetFlagRequested(const int32_t _stickerId, const core::sticker_size _size);
@@ -173,6 +174,24 @@ enum class SuggestType
     suggestWord = 1
 };
 
+class SuggestTypes
+{
+public:
+    SuggestTypes& add(SuggestType _type) noexcept
+    {
+        mask_ |= bit(_type);
+        return *this;
+    }
+
+    bool has(SuggestType _type) const noexcept { return (mask_ & bit(_type)) != 0; }
+    bool isEmpty() const noexcept { return mask_ == 0; }
+
+private:
+    static constexpr uint8_t bit(SuggestType _type) noexcept { return uint8_t(1u << static_cast<int>(_type)); }
+
+    uint8_t mask_ = 0;
+};
+
 struct StickerInfo
 {
     const QString fsId_;
@@ -199,11 +218,15 @@ typedef std::vector<QString> EmojiList;
 
 typedef std::map<QString, EmojiList> SuggestsAliases;
 
+class SuggestIndex;
+class ImageCache;
+
 class Cache
 {
 public:
 
     Cache();
+    ~Cache();
 
     void unserialize(const core::coll_helper &_coll);
     void unserialize_store(const core::coll_helper &_coll);
@@ -233,7 +256,10 @@ public:
 
     void clearCache();
 
-    bool getSuggest(const QString& _keyword, Suggest& _suggest, const std::set<SuggestType>& _types) const;
+    ImageCache& getImages();
+    qint64 getImagesFootprint() const;
+
+    bool getSuggest(const QString& _keyword, Suggest& _suggest, SuggestTypes _types) const;
 
     void requestSearch(const QString& _term);
 
@@ -258,8 +284,8 @@ private:
     setsIdsArray searchSets_;
     int64_t searchSeqId_ = -1;
 
-    StickersSuggests suggests_;
-    SuggestsAliases aliases_;
+    std::unique_ptr<SuggestIndex> suggestIndex_;
+    std::unique_ptr<ImageCache> images_;
 
     QString templatePreviewBaseUrl_;
     QString templateOriginalBaseUrl_;
@@ -329,7 +355,9 @@ void requestSearch(const QString& _term);
 void clearCache();
 void resetCache();
 
-bool getSuggest(const QString& _keyword, Suggest& _suggest, const std::set<SuggestType>& _types);
+qint64 getImagesFootprint();
+
+bool getSuggest(const QString& _keyword, Suggest& _suggest, SuggestTypes _types);
 bool getSuggestWithSettings(const QString& _keyword, Suggest& _suggest);
 
 QString getBotUin();
@@ -225,8 +225,10 @@ namespace
         std::vector<QString> selectParts;
         selectParts.reserve(3);
 
+        Emoji::EmojiBatch emojis;
+
         auto drawWord =
-                [&x, &_p, _point, _lineHeight, _pos, &_selectColor, &_linkColor, &_highlightColor, _selectionDiff, _lineSpacing, &prepareEngine, &prepareGlyph, &selectParts]
+                [&x, &_p, _point, _lineHeight, _pos, &_selectColor, &_linkColor, &_highlightColor, _selectionDiff, _lineSpacing, &prepareEngine, &prepareGlyph, &selectParts, &emojis]
                 (const auto& w, const auto& _nextWord, const bool _needsSpace = true)
         {
             auto pen = QPen(w.getColor());
@@ -239,11 +241,10 @@ namespace
             {
                 const bool selected = w.isFullSelected();
 
-                const auto emojiSize = w.emojiSize();
-                auto emoji = Emoji::GetEmoji(w.getCode(), emojiSize * Utils::scale_bitmap_ratio());
-                Utils::check_pixel_ratio(emoji);
                 const auto b = Utils::scale_bitmap_ratio();
-                auto y = _point.y() + (_lineHeight / 2.0 - emoji.height() / 2.0 / b);
+                const int32_t emojiSizePx = w.emojiSize() * b;
+                const auto emojiSize = emojiSizePx / b;
+                auto y = _point.y() + (_lineHeight / 2.0 - emojiSize / 2.0);
 
                 if (_pos == Ui::TextRendering::VerPosition::MIDDLE) //todo: handle other cases
                     y -= _lineHeight / 2.0;
@@ -252,7 +253,7 @@ namespace
                 else if (_pos == Ui::TextRendering::VerPosition::BOTTOM)
                     y -= _lineHeight;
 
-                const auto r = QRectF(x.toReal(), y, emoji.width() / b, emoji.height() / b);
+                const auto r = QRectF(x.toReal(), y, emojiSize, emojiSize);
                 const auto s = w.isSpaceAfter() ? w.spaceWidth() : 0;
 
                 if (selected)
@@ -263,7 +264,7 @@ namespace
                     auto someSpaces = qsl(" ");
                     const auto fontMetrics = getMetrics(w.getFont());
 
-                    while (fontMetrics.width(someSpaces) <= emoji.width() / b)
+                    while (fontMetrics.width(someSpaces) <= emojiSize)
                     {
                         someSpaces += ql1c(' ');
                     }
@@ -305,7 +306,7 @@ namespace
                     }
                 }
 
-                _p.drawImage(r, emoji);
+                emojis.add(w.getCode(), emojiSizePx, r);
 
                 x += (roundToInt(w.cachedWidth()) + s);
 
@@ -465,6 +466,8 @@ namespace
                 }
             }
         }
+
+        emojis.draw(_p);
     }
 
     QString stringFromCode(int _code)
@@ -14,6 +14,8 @@
 #include "utils/gui_coll_helper.h"
 #include "utils/InterConnector.h"
 #include "utils/LoadPixmapFromDataTask.h"
+#include "utils/DecodeMessagesTask.h"
+#include "utils/DecodeAvatarTask.h"
 #include "utils/uid.h"
 #include "utils/utils.h"
 #include "utils/gui_metrics.h"
@@ -131,7 +133,11 @@ core_dispatcher::core_dispatcher()
     , userStateGoneAway_(false)
     , connectionState_(Ui::ConnectionState::stateConnecting)
     , typingCheckTimer_(new QTimer(this))
+    , pendingArchiveDecodes_(0)
 {
+    archiveDecodePool_.setMaxThreadCount(1);
+    avatarDecodePool_.setMaxThreadCount(1);
+
     init();
 }
 
@@ -478,6 +484,19 @@ int64_t core_dispatcher::setUrlPlayed(const QString& _url, const bool _isPlayed)
     return post_message_to_core("files/set_url_played", collection.get());
 }
 
+int64_t core_dispatcher::setFileSharingWaveform(const QString& _url, const QByteArray& _waveform)
+{
+    assert(!_url.isEmpty());
+    assert(!_waveform.isEmpty());
+
+    Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
+
+    collection.set<QString>("url", _url);
+    collection.set_value_as_string("waveform", _waveform.toBase64().toStdString());
+
+    return post_message_to_core("files/set_waveform", collection.get());
+}
+
 qint64 core_dispatcher::deleteMessage(const int64_t _messageId, const QString& _internalId, const QString& _contactAimId, const bool _forAll)
 {
     assert(!_contactAimId.isEmpty());
@@ -667,6 +686,7 @@ void core_dispatcher::initMessageMap()
 
     REGISTER_IM_MESSAGE("dialogs/search/local/result", onDialogsSearchLocalResults);
     REGISTER_IM_MESSAGE("dialogs/search/local/empty", onDialogsSearchLocalEmptyResult);
+    REGISTER_IM_MESSAGE("dialogs/search/local/finished", onDialogsSearchLocalFinished);
     REGISTER_IM_MESSAGE("dialogs/search/server/result", onDialogsSearchServerResults);
 
     REGISTER_IM_MESSAGE("dialogs/search/pattern_history", onDialogsSearchPatternHistory);
@@ -913,6 +933,7 @@ void core_dispatcher::fileSharingMetainfoResult(const int64_t _seq, core::coll_h
     meta.downloadUri_ = _params.get<QString>("file_dlink");
     meta.lastModified_ = _params.get<int64_t>("last_modified");
     meta.filenameShort_ = _params.get<QString>("file_name_short");
+    meta.waveform_ = QByteArray::fromBase64(_params.get_value_as_string("waveform"));
 
     emit fileSharingFileMetainfoDownloaded(_seq, meta);
 }
@@ -1592,15 +1613,35 @@ void core_dispatcher::onLoginResult(const int64_t _seq, core::coll_helper _param
 
 void core_dispatcher::onAvatarsGetResult(const int64_t _seq, core::coll_helper _params)
 {
-    QPixmap avatar;
-
-    bool result = Data::UnserializeAvatar(&_params, avatar);
-
     const QString contact = QString::fromUtf8(_params.get_value_as_string("contact"));
 
     const int size = _params.get_value_as_int("size");
 
-    emit avatarLoaded(_seq, contact, avatar, size, result);
+    const auto result = _params.get_value_as_bool("result");
+
+    // dropped by core as not shown for too long, asked again when it is painted
+    if (!result && _params.get_value_as_int("error", core::avatar_error::ae_success) == core::avatar_error::ae_cancelled)
+    {
+        emit avatarCancelled(_seq, contact);
+        return;
+    }
+
+    auto stream = result ? _params.get_value_as_stream("avatar") : nullptr;
+
+    auto task = new Utils::DecodeAvatarTask(stream, size);
+
+    const auto succeeded = QObject::connect(
+        task, &Utils::DecodeAvatarTask::decoded,
+        this,
+        [this, _seq, contact, size, result]
+        (const QImage& _image)
+        {
+            auto avatar = QPixmap::fromImage(_image);
+            emit avatarLoaded(_seq, contact, avatar, size, result);
+        });
+    assert(succeeded);
+
+    avatarDecodePool_.start(task);
 }
 
 void core_dispatcher::onAvatarsPresenceUpdated(const int64_t _seq, core::coll_helper _params)
@@ -1643,31 +1684,53 @@ void core_dispatcher::onCoreLogins(const int64_t _seq, core::coll_helper _params
 
 void core_dispatcher::onArchiveMessages(Ui::MessagesBuddiesOpt _type, const int64_t _seq, core::coll_helper _params)
 {
-    const auto myAimid = _params.get<QString>("my_aimid");
+    // history pages are decoded off the gui thread, smaller batches too while
+    // any decode is pending, so that they don't overtake it
+    const auto decodeAsync =
+        _type == Ui::MessagesBuddiesOpt::Requested ||
+        _type == Ui::MessagesBuddiesOpt::Init ||
+        _type == Ui::MessagesBuddiesOpt::Context ||
+        pendingArchiveDecodes_ > 0;
 
-    const auto result = Data::UnserializeMessageBuddies(&_params, myAimid);
+    auto task = new Utils::DecodeMessagesTask(std::move(_params));
 
-    /*if (!result.introMessages.isEmpty())
-        emit messageBuddies(result.introMessages, result.aimId, Ui::MessagesBuddiesOpt::Intro, result.havePending, _seq, result.lastMsgId);
-        */
+    QObject::connect(task, &Utils::DecodeMessagesTask::decoded, this, [this, task, _type, _seq, decodeAsync]()
+    {
+        if (decodeAsync)
+            --pendingArchiveDecodes_;
 
-    emit messageBuddies(result.messages, result.aimId, _type, result.havePending, _seq, result.lastMsgId);
+        auto& result = task->result();
+        Data::resolveNames(result);
 
-    if (_params.is_value_exist("deleted"))
-    {
-        Data::MessageBuddies deleted;
+        /*if (!result.introMessages.isEmpty())
+            emit messageBuddies(result.introMessages, result.aimId, Ui::MessagesBuddiesOpt::Intro, result.havePending, _seq, result.lastMsgId);
+            */
 
-        auto deletedArray = _params.get_value_as_array("deleted");
-        const auto theirs_last_delivered = _params.get_value_as_int64("theirs_last_delivered", -1);
-        const auto theirs_last_read = _params.get_value_as_int64("theirs_last_read", -1);
+        emit messageBuddies(result.messages, result.aimId, _type, result.havePending, _seq, result.lastMsgId);
 
-        Data::unserializeMessages(deletedArray, result.aimId, myAimid, theirs_last_delivered, theirs_last_read, Out deleted);
+        if (auto& deleted = task->deleted())
+        {
+            Data::resolveNames(*deleted);
+            emit messagesDeleted(result.aimId, *deleted);
+        }
 
-        emit messagesDeleted(result.aimId, deleted);
-    }
+        if (!result.modifications.isEmpty())
+            emit messagesModified(result.aimId, result.modifications);
 
-    if (!result.modifications.isEmpty())
-        emit messagesModified(result.aimId, result.modifications);
+        task->deleteLater();
+    });
+
+    task->setAutoDelete(false);
+
+    if (decodeAsync)
+    {
+        ++pendingArchiveDecodes_;
+        archiveDecodePool_.start(task);
+    }
+    else
+    {
+        task->run();
+    }
 }
 
 void core_dispatcher::getCodeByPhoneCall(const QString& _ivr_url)
@@ -1930,6 +1993,11 @@ void core_dispatcher::onDialogsSearchLocalEmptyResult(const int64_t _seq, core::
     emit searchedMessagesLocalEmptyResult(_seq);
 }
 
+void core_dispatcher::onDialogsSearchLocalFinished(const int64_t _seq, core::coll_helper _params)
+{
+    emit searchedMessagesLocalFinished(_seq);
+}
+
 void core_dispatcher::onDialogsSearchServerResults(const int64_t _seq, core::coll_helper _params)
 {
     onDialogsSearchResult(_seq, _params, false);
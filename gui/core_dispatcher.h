@@ -155,6 +155,7 @@ Q_SIGNALS:
         void loginResultAttachUin(int64_t, int _code);
         void loginResultAttachPhone(int64_t, int _code);
         void avatarLoaded(int64_t, const QString&, QPixmap&, int, bool _result);
+        void avatarCancelled(int64_t, const QString&);
         void avatarUpdated(const QString &);
 
         void presense(const std::shared_ptr<Data::Buddy>&);
@@ -164,6 +165,7 @@ Q_SIGNALS:
 
         void searchedMessagesLocal(const Data::SearchResultsV& _msg, const qint64 _seq);
         void searchedMessagesLocalEmptyResult(const qint64 _seq);
+        void searchedMessagesLocalFinished(const qint64 _seq);
         void searchedMessagesServer(const Data::SearchResultsV& _results, const QString& _cursorNext, const int _total, const qint64 _seq);
 
         void searchedContactsLocal(const Data::SearchResultsV& _results, const qint64 _seq);
@@ -405,6 +407,7 @@ Q_SIGNALS:
         int64_t pttToText(const QString& _pttLink, const QString& _locale);
 
         int64_t setUrlPlayed(const QString& _url, const bool _isPlayed);
+        int64_t setFileSharingWaveform(const QString& _url, const QByteArray& _waveform);
 
         void setUserState(const core::profile_state state);
         void invokeStateAway();
@@ -470,6 +473,7 @@ Q_SIGNALS:
 
         void onDialogsSearchLocalResults(const int64_t _seq, core::coll_helper _params);
         void onDialogsSearchLocalEmptyResult(const int64_t _seq, core::coll_helper _params);
+        void onDialogsSearchLocalFinished(const int64_t _seq, core::coll_helper _params);
         void onDialogsSearchServerResults(const int64_t _seq, core::coll_helper _params);
         void onDialogsSearchResult(const int64_t _seq, core::coll_helper _params, const bool _fromLocalSearch);
 
@@ -646,6 +650,13 @@ Q_SIGNALS:
         ConnectionState connectionState_;
 
         QTimer* typingCheckTimer_;
+
+        // single thread keeps the decoded batches in the order core sent them
+        QThreadPool archiveDecodePool_;
+        int pendingArchiveDecodes_;
+
+        // single thread, failed and decoded avatars go through it so they are emitted in the order core sent them
+        QThreadPool avatarDecodePool_;
     };
 
     core_dispatcher* GetDispatcher();
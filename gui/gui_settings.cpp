@@ -297,7 +297,7 @@ namespace Ui
 
     int qt_gui_settings::get_current_shadow_width() const
     {
-        return (get_value<bool>(settings_window_maximized, false) == true ? 0 : shadowWidth_);
+        return (cached_settings::window_maximized().get() ? 0 : shadowWidth_);
     }
 
     void qt_gui_settings::unserialize(core::coll_helper _collection)
@@ -343,12 +343,71 @@ namespace Ui
         GetDispatcher()->post_message_to_core("settings/value/set", cl_coll.get());
     }
 
+    void qt_gui_settings::reload_handles(const QString& _name) const
+    {
+        if (const auto it = handles_.find(_name); it != handles_.end())
+        {
+            for (auto handle : it->second)
+                handle->reload(*this);
+        }
+    }
+
+    void qt_gui_settings::register_handle(setting_handle_base* _handle)
+    {
+        assert(_handle);
+
+        handles_[_handle->name()].push_back(_handle);
+        _handle->reload(*this);
+    }
+
+    void qt_gui_settings::unregister_handle(setting_handle_base* _handle)
+    {
+        if (const auto it = handles_.find(_handle->name()); it != handles_.end())
+        {
+            auto& handles = it->second;
+            handles.erase(std::remove(handles.begin(), handles.end(), _handle), handles.end());
+        }
+    }
+
     qt_gui_settings* get_gui_settings()
     {
         static auto settings = std::make_unique<qt_gui_settings>();
         return settings.get();
     }
 
+    namespace cached_settings
+    {
+        const setting_handle<bool>& partial_read()
+        {
+            static const setting_handle<bool> handle(settings_partial_read, settings_partial_read_deafult());
+            return handle;
+        }
+
+        const setting_handle<bool>& show_last_message()
+        {
+            static const setting_handle<bool> handle(settings_show_last_message, true);
+            return handle;
+        }
+
+        const setting_handle<bool>& show_groupchat_heads()
+        {
+            static const setting_handle<bool> handle(settings_show_groupchat_heads, true);
+            return handle;
+        }
+
+        const setting_handle<bool>& hide_message_notification()
+        {
+            static const setting_handle<bool> handle(settings_hide_message_notification, false);
+            return handle;
+        }
+
+        const setting_handle<bool>& window_maximized()
+        {
+            static const setting_handle<bool> handle(settings_window_maximized, false);
+            return handle;
+        }
+    }
+
     std::string get_account_setting_name(const std::string& _settingName)
     {
         return MyInfo()->aimId().toStdString() + '/' + _settingName;
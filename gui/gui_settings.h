@@ -7,6 +7,8 @@ namespace Ui
     constexpr std::chrono::milliseconds period_for_stats_settings_ms = std::chrono::minutes(24);
     constexpr std::chrono::milliseconds period_for_start_stats_settings_ms = std::chrono::minutes(1);
 
+    class setting_handle_base;
+
     class qt_gui_settings : public QObject
     {
         Q_OBJECT
@@ -28,7 +30,10 @@ Q_SIGNALS:
 
         std::map<QString, settings_value, StringComparator>   values_;
 
+        std::map<QString, std::vector<setting_handle_base*>, StringComparator> handles_;
+
         void post_value_to_core(const QString& _name, const settings_value& _val) const;
+        void reload_handles(const QString& _name) const;
 
         void set_value_simple_data(const QString& _name, const char* _data, int _len, bool _postToCore = true)
         {
@@ -46,6 +51,8 @@ Q_SIGNALS:
             if (_postToCore)
                 post_value_to_core(_name, val);
 
+            reload_handles(_name);
+
             emit changed(_name);
         }
 
@@ -69,10 +76,11 @@ Q_SIGNALS:
         template <class t_, class u_>
         t_ get_value_simple(const u_& _name, const t_& _defaultValue) const
         {
-            std::vector<char> data;
-            if (!get_value_simple_data(_name, data))
+            auto iter = values_.find(_name);
+            if (iter == values_.end())
                 return _defaultValue;
 
+            const auto& data = iter->second.data_;
             if (data.size() != sizeof(t_))
             {
                 assert(false);
@@ -80,7 +88,7 @@ Q_SIGNALS:
             }
 
             t_ val;
-            ::memcpy(&val, &data[0], sizeof(t_));
+            ::memcpy(&val, data.data(), sizeof(t_));
 
             return val;
         }
@@ -135,6 +143,9 @@ Q_SIGNALS:
 
         bool getIsLoaded() const { return isLoaded_; };
         void setIsLoaded(bool _isLoaded) { isLoaded_ = _isLoaded; };
+
+        void register_handle(setting_handle_base* _handle);
+        void unregister_handle(setting_handle_base* _handle);
     };
 
     template<> void qt_gui_settings::set_value<QString>(const QString& _name, const QString& _value);
@@ -164,6 +175,74 @@ Q_SIGNALS:
 
     qt_gui_settings* get_gui_settings();
 
+    // a setting read on the hot paths. the value is cached in an atomic and reloaded by qt_gui_settings
+    // on set_value and on the settings received from core, so a read is a single load
+    class setting_handle_base
+    {
+    public:
+        const QString& name() const noexcept { return name_; }
+
+        virtual void reload(const qt_gui_settings& _settings) = 0;
+
+    protected:
+        explicit setting_handle_base(const char* _name)
+            : name_(QString::fromLatin1(_name))
+        {
+        }
+
+        virtual ~setting_handle_base() = default;
+
+    private:
+        const QString name_;
+    };
+
+    template <class t_>
+    class setting_handle final : public setting_handle_base
+    {
+        static_assert(std::is_trivially_copyable_v<t_>);
+
+    public:
+        setting_handle(const char* _name, const t_& _defaultValue)
+            : setting_handle_base(_name)
+            , defaultValue_(_defaultValue)
+            , value_(_defaultValue)
+        {
+            get_gui_settings()->register_handle(this);
+        }
+
+        ~setting_handle()
+        {
+            get_gui_settings()->unregister_handle(this);
+        }
+
+        setting_handle(const setting_handle&) = delete;
+        setting_handle& operator=(const setting_handle&) = delete;
+
+        t_ get() const noexcept
+        {
+            return value_.load(std::memory_order_relaxed);
+        }
+
+        void reload(const qt_gui_settings& _settings) override
+        {
+            value_.store(_settings.get_value<t_>(name(), defaultValue_), std::memory_order_relaxed);
+        }
+
+    private:
+        const t_ defaultValue_;
+        std::atomic<t_> value_;
+    };
+
+    // the settings read while painting and scrolling
+    namespace cached_settings
+    {
+        const setting_handle<bool>& partial_read();
+        const setting_handle<bool>& show_last_message();
+        const setting_handle<bool>& show_groupchat_heads();
+        const setting_handle<bool>& hide_message_notification();
+        const setting_handle<bool>& window_maximized();
+    }
+
     std::string get_account_setting_name(const std::string& settingName);
 
     QString getDownloadPath();
@@ -227,7 +227,7 @@ namespace Ui
         }
         else
         {
-            const auto show_last_message = Ui::get_gui_settings()->get_value<bool>(settings_show_last_message, true);
+            const auto show_last_message = Ui::cached_settings::show_last_message().get();
             static ContactListParams params(!show_last_message);
             params.setIsCL(!show_last_message);
             return params;
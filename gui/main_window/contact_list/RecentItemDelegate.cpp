@@ -526,6 +526,16 @@ namespace Ui
             _p.fillRect(_rect, color);
     }
 
+    bool RecentItemBase::isRenderCacheable() const
+    {
+        return false;
+    }
+
+    bool RecentItemBase::hasAvatarOf(const QString& _aimId) const
+    {
+        return aimid_ == _aimId;
+    }
+
     const QString& RecentItemBase::getAimid() const
     {
         return aimid_;
@@ -628,7 +638,7 @@ namespace Ui
     //////////////////////////////////////////////////////////////////////////
     RecentItemUnknowns::RecentItemUnknowns(const Data::DlgState& _state)
         : RecentItemBase(_state)
-        , compactMode_(!Ui::get_gui_settings()->get_value<bool>(settings_show_last_message, true))
+        , compactMode_(!Ui::cached_settings::show_last_message().get())
         , count_(Logic::getUnknownsModel()->totalUnreads())
     {
         text_ = TextRendering::MakeTextUnit(QT_TRANSLATE_NOOP("contact_list", "New contacts"));
@@ -1070,6 +1080,19 @@ namespace Ui
     {
     }
 
+    bool RecentItemRecent::isRenderCacheable() const
+    {
+        return true;
+    }
+
+    bool RecentItemRecent::hasAvatarOf(const QString& _aimId) const
+    {
+        if (RecentItemBase::hasAvatarOf(_aimId))
+            return true;
+
+        return std::any_of(heads_.begin(), heads_.end(), [&_aimId](const auto& _head) { return _head.first == _aimId; });
+    }
+
     void RecentItemRecent::draw(
         QPainter& _p,
         const QRect& _rect,
@@ -1444,7 +1467,7 @@ namespace Ui
         : RecentItemRecent(
             _state,
             _compactMode,
-            get_gui_settings()->get_value<bool>(settings_hide_message_notification, false) || LocalPIN::instance()->locked(), false)
+            Ui::cached_settings::hide_message_notification().get() || LocalPIN::instance()->locked(), false)
     {
         mention_ = _state.mentionAlert_;
     }
@@ -1817,13 +1840,26 @@ namespace Ui
     //////////////////////////////////////////////////////////////////////////
     // RecentItemDelegate
     //////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        constexpr int renderCacheLimitKb = 32 * 1024;
+
+        int pixmapCostKb(const QPixmap& _pixmap)
+        {
+            return std::max(1, _pixmap.width() * _pixmap.height() * _pixmap.depth() / 8 / 1024);
+        }
+    }
+
     RecentItemDelegate::RecentItemDelegate(QObject* parent)
         : AbstractItemDelegateWithRegim(parent)
         , stateBlocked_(false)
+        , renderCache_(renderCacheLimitKb)
     {
         connect(Logic::getContactListModel(), &Logic::ContactListModel::select, this, &RecentItemDelegate::onContactSelected);
         connect(Logic::getContactListModel(), &Logic::ContactListModel::selectedContactChanged, this, &RecentItemDelegate::onItemClicked);
+        connect(Logic::getContactListModel(), &Logic::ContactListModel::contactChanged, this, &RecentItemDelegate::onContactChanged);
         connect(Logic::GetFriendlyContainer(), &Logic::FriendlyContainer::friendlyChanged, this, &RecentItemDelegate::onFriendlyChanged);
+        connect(Logic::GetAvatarStorage(), &Logic::AvatarStorage::avatarChanged, this, &RecentItemDelegate::onAvatarChanged);
     }
 
     RecentItemDelegate::~RecentItemDelegate()
@@ -1845,7 +1881,46 @@ namespace Ui
         const bool isSelected = (dlg.AimId_ == selectedAimId_);
         const bool isHovered = (_option.state & QStyle::State_Selected) && !stateBlocked_ && !isSelected && !dragIndex_.isValid();
 
-        item->draw(*_painter, _option.rect, viewParams_, isSelected, isHovered, isDrag, isKeyboardFocused());
+        if (isDrag || !item->isRenderCacheable() || _option.rect.isEmpty())
+        {
+            item->draw(*_painter, _option.rect, viewParams_, isSelected, isHovered, isDrag, isKeyboardFocused());
+            return;
+        }
+
+        RenderKey key;
+        key.size_ = _option.rect.size();
+        key.dpr_ = _painter->device() ? _painter->device()->devicePixelRatioF() : 1.0;
+        key.regim_ = viewParams_.regim_;
+        key.pictOnly_ = viewParams_.pictOnly_;
+        key.isSelected_ = isSelected;
+        key.isHovered_ = isHovered;
+        key.isKeyboardFocused_ = isHovered && isKeyboardFocused();
+
+        auto cached = renderCache_.object(dlg.AimId_);
+        if (!cached || !(cached->key_ == key))
+        {
+            auto entry = std::make_unique<RenderCacheEntry>();
+            entry->key_ = key;
+            entry->pixmap_ = QPixmap(key.size_ * key.dpr_);
+            entry->pixmap_.setDevicePixelRatio(key.dpr_);
+            entry->pixmap_.fill(Qt::transparent);
+            {
+                QPainter p(&entry->pixmap_);
+                p.setRenderHints(_painter->renderHints());
+                item->draw(p, QRect(QPoint(), key.size_), viewParams_, key.isSelected_, key.isHovered_, false, key.isKeyboardFocused_);
+            }
+
+            cached = entry.get();
+            const auto cost = pixmapCostKb(entry->pixmap_);
+            if (!renderCache_.insert(dlg.AimId_, entry.release(), cost))
+            {
+                // the row is bigger than the whole cache, QCache has already deleted it
+                item->draw(*_painter, _option.rect, viewParams_, isSelected, isHovered, isDrag, isKeyboardFocused());
+                return;
+            }
+        }
+
+        _painter->drawPixmap(_option.rect.topLeft(), cached->pixmap_);
     }
 
     QSize RecentItemDelegate::sizeHint(const QStyleOptionViewItem& _option, const QModelIndex& _i) const
@@ -1911,6 +1986,9 @@ namespace Ui
 
     void RecentItemDelegate::setFixedWidth(int _newWidth)
     {
+        if (viewParams_.fixedWidth_ != _newWidth)
+            renderCache_.clear();
+
         viewParams_.fixedWidth_ = _newWidth;
     }
 
@@ -1939,13 +2017,13 @@ namespace Ui
             return std::make_unique<RecentItemService>(_state);
         }
 
-        const bool compactMode = !Ui::get_gui_settings()->get_value<bool>(settings_show_last_message, true);
+        const bool compactMode = !Ui::cached_settings::show_last_message().get();
         return std::make_unique<RecentItemRecent>(_state, compactMode, false, shouldDisplayHeads(_state));
     }
 
     bool RecentItemDelegate::shouldDisplayHeads(const Data::DlgState &_state)
     {
-        if (!Ui::get_gui_settings()->get_value<bool>(settings_show_groupchat_heads, true))
+        if (!Ui::cached_settings::show_groupchat_heads().get())
             return false;
 
         if (_state.mediaType_ == Ui::MediaType::mediaTypeVoip)
@@ -1959,8 +2037,25 @@ namespace Ui
         removeItem(_aimId);
     }
 
+    void RecentItemDelegate::onAvatarChanged(const QString& _aimId)
+    {
+        for (const auto& [aimId, item] : items_)
+        {
+            if (item && item->hasAvatarOf(_aimId))
+                renderCache_.remove(aimId);
+        }
+    }
+
+    void RecentItemDelegate::onContactChanged(const QString& _aimId)
+    {
+        // presence is read at draw time, so only the pixmap is stale
+        renderCache_.remove(_aimId);
+    }
+
     void RecentItemDelegate::removeItem(const QString& _aimId)
     {
+        renderCache_.remove(_aimId);
+
         if (const auto iter = std::as_const(items_).find(_aimId); iter != std::as_const(items_).end())
             items_.erase(iter);
     }
@@ -1972,9 +2067,21 @@ namespace Ui
 
     void RecentItemDelegate::refreshAll()
     {
+        renderCache_.clear();
         items_.clear();
     }
 
+    bool RecentItemDelegate::RenderKey::operator==(const RenderKey& _key) const
+    {
+        return size_ == _key.size_
+            && qFuzzyCompare(dpr_, _key.dpr_)
+            && regim_ == _key.regim_
+            && pictOnly_ == _key.pictOnly_
+            && isSelected_ == _key.isSelected_
+            && isHovered_ == _key.isHovered_
+            && isKeyboardFocused_ == _key.isKeyboardFocused_;
+    }
+
 
     RecentItemDelegate::ItemKey::ItemKey(const bool isSelected, const bool isHovered, const int unreadDigitsNumber)
         : IsSelected(isSelected)
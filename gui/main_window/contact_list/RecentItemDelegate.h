@@ -40,6 +40,12 @@ namespace Ui
 
         virtual void drawMouseState(QPainter& _p, const QRect& _rect, const bool _isHovered, const bool _isSelected, const bool _isKeyboardFocused = false);
 
+        // item renders only from its own state, avatars and presence, so the result can be cached as a pixmap
+        virtual bool isRenderCacheable() const;
+
+        // true if the rendered item shows the avatar of _aimId
+        virtual bool hasAvatarOf(const QString& _aimId) const;
+
         const QString& getAimid() const;
     };
 
@@ -187,6 +193,9 @@ namespace Ui
 
     public:
 
+        bool isRenderCacheable() const override;
+        bool hasAvatarOf(const QString& _aimId) const override;
+
         RecentItemRecent(
             const Data::DlgState& _state,
             const bool _compactMode,
@@ -322,6 +331,8 @@ namespace Ui
 
     private:
         void onFriendlyChanged(const QString& _aimId, const QString& _friendly);
+        void onAvatarChanged(const QString& _aimId);
+        void onContactChanged(const QString& _aimId);
         void removeItem(const QString& _aimId);
 
     private:
@@ -341,6 +352,25 @@ namespace Ui
             bool operator < (const ItemKey &_key) const;
         };
 
+        struct RenderKey
+        {
+            QSize size_;
+            qreal dpr_ = 1.0;
+            int regim_ = -1;
+            bool pictOnly_ = false;
+            bool isSelected_ = false;
+            bool isHovered_ = false;
+            bool isKeyboardFocused_ = false;
+
+            bool operator==(const RenderKey& _key) const;
+        };
+
+        struct RenderCacheEntry
+        {
+            RenderKey key_;
+            QPixmap pixmap_;
+        };
+
         bool stateBlocked_;
 
         QModelIndex dragIndex_;
@@ -352,5 +382,8 @@ namespace Ui
         QString selectedAimId_;
 
         mutable std::unordered_map<QString, std::unique_ptr<RecentItemBase>, Utils::QStringHasher> items_;
+
+        // pre-rendered rows, cost is in kilobytes
+        mutable QCache<QString, RenderCacheEntry> renderCache_;
     };
 }
@@ -443,7 +443,7 @@ namespace Logic
     {
         if (const auto searchedAimId = _aimId.isEmpty() ? Logic::getContactListModel()->selectedContact() : _aimId; !searchedAimId.isEmpty())
         {
-            if (force || !Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult()))
+            if (force || !Ui::cached_settings::partial_read().get())
             {
                 const auto iter = std::find_if(Dialogs_.begin(), Dialogs_.end(), isEqualDlgState(searchedAimId));
                 if (iter != Dialogs_.end() && (iter->UnreadCount_ != 0 || iter->YoursLastRead_ < iter->LastMsgId_))
@@ -30,6 +30,20 @@ namespace
         sr->accessibleName_ = _accessName;
         return sr;
     }
+
+    bool isNewerMessage(const Data::AbstractSearchResultSptr& _first, const Data::AbstractSearchResultSptr& _second)
+    {
+        if (!_first->isMessage())
+            return false;
+
+        if (!_second->isMessage())
+            return false;
+
+        const auto msgFirst = std::static_pointer_cast<Data::SearchResultMessage>(_first);
+        const auto msgSecond = std::static_pointer_cast<Data::SearchResultMessage>(_second);
+
+        return msgFirst->message_->GetTime() > msgSecond->message_->GetTime();
+    }
 }
 
 namespace Logic
@@ -66,7 +80,7 @@ namespace Logic
 
         connect(GetAvatarStorage(), &Logic::AvatarStorage::avatarChanged, this, &SearchModel::avatarLoaded);
 
-        for (auto v : { &results_, &contactLocalRes_, &contactServerRes_, &msgLocalRes_, &msgServerRes_})
+        for (auto v : { &results_, &contactLocalRes_, &contactServerRes_, &msgLocalRes_, &msgServerRes_, &msgMergedRes_ })
             v->reserve(common::get_limit_search_results());
 
         Logic::getLastSearchPatterns(); // init
@@ -213,29 +227,15 @@ namespace Logic
         if (messageSearcher_->getSearchPattern() != searchPattern_)
             return;
 
-        if (messageResServerRcvd_) // if we already have server results - do nothing
-            return;
-
+        // called for every batch the archive scan finds, the results are shown as they come
         msgLocalRes_ = messageSearcher_->getLocalResults();
-        localMsgSearchNoMore_ = msgLocalRes_.isEmpty();
-
-        std::sort(msgLocalRes_.begin(), msgLocalRes_.end(), [](const Data::AbstractSearchResultSptr& _first, const Data::AbstractSearchResultSptr& _second)
-        {
-            if (!_first->isMessage())
-                return false;
-
-            if (!_second->isMessage())
-                return false;
 
-            const auto msgFirst = std::static_pointer_cast<Data::SearchResultMessage>(_first);
-            const auto msgSecond = std::static_pointer_cast<Data::SearchResultMessage>(_second);
-
-            return msgFirst->message_->GetTime() > msgSecond->message_->GetTime();
-        });
+        std::sort(msgLocalRes_.begin(), msgLocalRes_.end(), isNewerMessage);
 
         if (msgLocalRes_.size() > (int)common::get_limit_search_results())
             msgLocalRes_.resize(common::get_limit_search_results());
 
+        mergeMessages();
         composeResults();
     }
 
@@ -247,9 +247,6 @@ namespace Logic
         if (messageSearcher_->isServerTimedOut())
             return;
 
-        endLocalSearch();
-
-        messageResServerRcvd_ = true;
         allMessageResRcvd_ = true;
 
         if (msgServerRes_.isEmpty())
@@ -258,11 +255,15 @@ namespace Logic
         msgServerRes_ = messageSearcher_->getServerResults();
         qCDebug(searchModel) << this << "got more results from server, currently have" << msgServerRes_.size() << "items";
 
+        mergeMessages();
         composeResults();
     }
 
     void SearchModel::onMessagesAll()
     {
+        if (messageSearcher_->getSearchPattern() == searchPattern_ && (messageSearcher_->getSearchSource() & SearchDataSource::local))
+            localMsgSearchNoMore_ = messageSearcher_->getLocalResults().isEmpty();
+
         allMessageResRcvd_ = true;
         composeResults();
     }
@@ -375,9 +376,8 @@ namespace Logic
 
         allContactResRcvd_ = !isSearchInContacts();
         allMessageResRcvd_ = !isSearchInDialogs();
-        messageResServerRcvd_ = false;
 
-        for (auto v : { &results_, &contactLocalRes_, &contactServerRes_, &msgLocalRes_, &msgServerRes_ })
+        for (auto v : { &results_, &contactLocalRes_, &contactServerRes_, &msgLocalRes_, &msgServerRes_, &msgMergedRes_ })
             v->clear();
 
         emit dataChanged(index(0), index(rowCount()));
@@ -479,7 +479,7 @@ namespace Logic
 
     int SearchModel::getTotalMessagesCount() const
     {
-        return !msgServerRes_.isEmpty() ? messageSearcher_->getTotalServerEntries() : msgLocalRes_.size();
+        return !msgServerRes_.isEmpty() ? std::max(messageSearcher_->getTotalServerEntries(), msgMergedRes_.size()) : msgMergedRes_.size();
     }
 
     bool Logic::SearchModel::isAllDataReceived() const
@@ -570,19 +570,20 @@ namespace Logic
     void SearchModel::composeResults()
     {
         results_.clear();
-        results_.reserve(contactLocalRes_.size() + contactServerRes_.size() + std::max(msgLocalRes_.size(), msgServerRes_.size()));
+        results_.reserve(contactLocalRes_.size() + contactServerRes_.size() + msgMergedRes_.size());
 
         if (isCategoriesEnabled())
             composeResultsChatsCategorized();
         else
             composeResultsChatsSimple();
 
-        if (allMessageResRcvd_)
+        if (allMessageResRcvd_ || !msgMergedRes_.isEmpty())
             composeResultsMessages();
 
         qCDebug(searchModel) << this << "composed" << results_.size() << "items:\n"
-            << msgLocalRes_.size() << "local messages" << (!msgServerRes_.isEmpty() ? "(unused)" : "")
-            << msgServerRes_.size() << "server messages";
+            << msgLocalRes_.size() << "local messages"
+            << msgServerRes_.size() << "server messages"
+            << msgMergedRes_.size() << "merged";
 
         emit dataChanged(index(0), index(rowCount()));
 
@@ -629,8 +630,7 @@ namespace Logic
 
     void SearchModel::composeResultsMessages()
     {
-        const bool haveMessages = !msgServerRes_.isEmpty() || (!msgLocalRes_.isEmpty() && !messageResServerRcvd_);
-        if (haveMessages)
+        if (!msgMergedRes_.isEmpty())
         {
             if (isCategoriesEnabled())
             {
@@ -642,11 +642,28 @@ namespace Logic
                 results_.append(msgsHdr);
             }
 
-            if (!messageResServerRcvd_)
-                results_.append(msgLocalRes_);
-            else
-                results_.append(msgServerRes_);
+            results_.append(msgMergedRes_);
+        }
+    }
+
+    void SearchModel::mergeMessages()
+    {
+        // the server results win, the local ones it doesn't have are added by id
+        msgMergedRes_ = msgServerRes_;
+
+        QSet<QPair<QString, qint64>> serverIds;
+        serverIds.reserve(msgServerRes_.size());
+        for (const auto& res : std::as_const(msgServerRes_))
+            serverIds.insert(qMakePair(res->getAimId(), res->getMessageId()));
+
+        for (const auto& res : std::as_const(msgLocalRes_))
+        {
+            if (!serverIds.contains(qMakePair(res->getAimId(), res->getMessageId())))
+                msgMergedRes_.append(res);
         }
+
+        if (msgMergedRes_.size() != msgServerRes_.size())
+            std::stable_sort(msgMergedRes_.begin(), msgMergedRes_.end(), isNewerMessage);
     }
 
     void SearchModel::composeSuggests()
@@ -86,6 +86,7 @@ namespace Logic
         void composeResultsChatsCategorized();
         void composeResultsChatsSimple();
         void composeResultsMessages();
+        void mergeMessages();
 
         void composeSuggests();
 
@@ -103,12 +104,12 @@ namespace Logic
 
         bool allContactResRcvd_;
         bool allMessageResRcvd_;
-        bool messageResServerRcvd_;
 
         Data::SearchResultsV contactLocalRes_;
         Data::SearchResultsV contactServerRes_;
         Data::SearchResultsV msgLocalRes_;
         Data::SearchResultsV msgServerRes_;
+        Data::SearchResultsV msgMergedRes_;
         Data::SearchResultsV results_;
     };
 }
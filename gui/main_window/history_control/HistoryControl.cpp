@@ -328,7 +328,7 @@ namespace Ui
         auto oldPage = getCurrentPage();
         if (oldPage)
         {
-            const bool canScrollToBottom = scrollMode == hist::scroll_mode_type::unread && Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult());
+            const bool canScrollToBottom = scrollMode == hist::scroll_mode_type::unread && Ui::cached_settings::partial_read().get();
             if (_messageId == -1 || canScrollToBottom)
             {
                 if (oldPage->aimId() == _aimId)
@@ -345,7 +345,7 @@ namespace Ui
                         if (it != Dialog_->newMessageIds_.cend())
                         {
                             Dialog_->newMessageIds_.erase(it);
-                            if (!Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult()))
+                            if (!Ui::cached_settings::partial_read().get())
                                 Dialog_->buttonDown_->setCounter(Dialog_->newMessageIds_.size());
                         }
                     }
@@ -1890,7 +1890,7 @@ namespace Ui
                 newMessageIds_.insert(newMessageIds_.end(), _ids.begin(), _ids.end());
                 std::sort(newMessageIds_.begin(), newMessageIds_.end());
                 newMessageIds_.erase(std::unique(newMessageIds_.begin(), newMessageIds_.end()), newMessageIds_.end());
-                if (!Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult()))
+                if (!Ui::cached_settings::partial_read().get())
                     buttonDown_->setCounter(newMessageIds_.size());
             }
 
@@ -2495,7 +2495,7 @@ namespace Ui
         reader_->onReadAllMentionsLess(_dlgState.LastReadMention_, false);
         reader_->setDlgState(_dlgState);
 
-        if (Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult()))
+        if (Ui::cached_settings::partial_read().get())
             buttonDown_->setCounter(_dlgState.UnreadCount_);
 
         auto contact = Logic::getContactListModel()->getContactItem(aimId_);
@@ -3139,7 +3139,7 @@ namespace Ui
             GetDispatcher()->post_stats_to_core(core::stats::stats_event_names::chatscr_blockbar_action, { { "type", "ignor" },{ "chat_type", Utils::chatTypeByAimId(aimId_) } });
 
         qint64 msgid = -1;
-        if (Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult()))
+        if (Ui::cached_settings::partial_read().get())
             msgid = dlg.YoursLastRead_;
 
         reader_->onReadAllMentionsLess(msgid, false);
@@ -1329,7 +1329,7 @@ namespace Ui
     void MessagesScrollArea::updateItems()
     {
         Layout_->updateItemsWidth();
-        if (Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult()))
+        if (Ui::cached_settings::partial_read().get())
             Layout_->readVisibleItems();
     }
 
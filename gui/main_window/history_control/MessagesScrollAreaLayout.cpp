@@ -540,7 +540,7 @@ namespace Ui
             applyShiftingParams();
         }
 
-        const bool needCheckVisibility = Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult());
+        const bool needCheckVisibility = Ui::cached_settings::partial_read().get();
 
         applyItemsGeometry(needCheckVisibility);
 
@@ -883,7 +883,7 @@ namespace Ui
         const QMargins visibilityMargins(0, visibilityMargin, 0, visibilityMargin);
         const auto viewportVisibilityAbsRect = viewportAbsRect.marginsAdded(visibilityMargins);
 
-        const auto isPartialReadEnabled = scrollActivityFlag_ && Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult());
+        const auto isPartialReadEnabled = scrollActivityFlag_ && Ui::cached_settings::partial_read().get();
 
         for (auto &item : LayoutItems_)
         {
@@ -1359,7 +1359,7 @@ namespace Ui
 
     void MessagesScrollAreaLayout::checkVisibilityForRead()
     {
-        if (Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult()))
+        if (Ui::cached_settings::partial_read().get())
         {
             applyItemsGeometry(true);
             readVisibleItems();
@@ -1511,7 +1511,7 @@ namespace Ui
     {
         const bool isWindowActive = Utils::InterConnector::instance().getMainWindow()->isActiveWindow();
 
-        const auto isPartialReadEnabled = scrollActivityFlag_ && Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult());
+        const auto isPartialReadEnabled = scrollActivityFlag_ && Ui::cached_settings::partial_read().get();
 
         for (auto &item : LayoutItems_)
         {
@@ -59,17 +59,16 @@ core::file_sharing_content_type getFileSharingContentType(const TextChunk::Type
 
 FixedUrls getFixedUrls()
 {
-    common::tools::url_parser::compare_item profileDomain;
-    profileDomain.str = Features::getProfileDomain().toStdString() + '/';
-    profileDomain.ok_state = common::tools::url_parser::states::profile_id;
-    profileDomain.safe_pos = profileDomain.str.length() - 1;
+    return common::tools::make_profile_urls(Features::getProfileDomain().toStdString(), Features::getProfileDomainAgent().toStdString());
+}
 
-    common::tools::url_parser::compare_item profileDomainAgent;
-    profileDomainAgent.str = Features::getProfileDomainAgent().toStdString() + '/';
-    profileDomainAgent.ok_state = common::tools::url_parser::states::profile_id;
-    profileDomainAgent.safe_pos = profileDomainAgent.str.length() - 1;
+ChunkIterator makeChunkIterator(const QString& _text, const common::tools::message_spans* _spans)
+{
+    auto urls = getFixedUrls();
+    if (_spans && _spans->is_valid_for(_text.toStdString(), common::tools::spans_key(Ui::GetAppConfig().getUrlFilesGet(), urls)))
+        return ChunkIterator(_text, *_spans);
 
-    return { std::move(profileDomain), std::move(profileDomainAgent) };
+    return ChunkIterator(_text, std::move(urls));
 }
 
 struct parseResult
@@ -104,7 +103,7 @@ struct parseResult
     }
 };
 
-parseResult parseText(const QString& _text, const bool _allowSnippet, const bool _forcePreview)
+parseResult parseText(const QString& _text, const bool _allowSnippet, const bool _forcePreview, const common::tools::message_spans* _spans = nullptr)
 {
     parseResult result;
 
@@ -153,7 +152,7 @@ parseResult parseText(const QString& _text, const bool _allowSnippet, const bool
         }
     }
 
-    ChunkIterator it(_text, getFixedUrls());
+    auto it = makeChunkIterator(_text, _spans);
     while (it.hasNext())
     {
         auto chunk = it.current(_allowSnippet, _forcePreview);
@@ -328,7 +327,8 @@ namespace ComplexMessageItemBuilder
         const bool _forcePreview,
         const QString& _description,
         const QString& _url,
-        const Data::SharedContact& _sharedContact)
+        const Data::SharedContact& _sharedContact,
+        const common::tools::message_spans* _textSpans)
     {
         assert(_id >= -1);
         assert(!_senderAimid.isEmpty());
@@ -445,7 +445,7 @@ namespace ComplexMessageItemBuilder
             }
             else
             {
-                const auto parsedMsg = parseText(_text, allowSnippet, _forcePreview);
+                const auto parsedMsg = parseText(_text, allowSnippet, _forcePreview, _textSpans);
 
                 messageBlocks = createBlocks(parsedMsg, complexItem.get(), _id, _prev);
                 hasTrailingLink = parsedMsg.hasTrailingLink;
@@ -2,6 +2,14 @@
 
 #include "../../../namespaces.h"
 
+namespace common
+{
+    namespace tools
+    {
+        struct message_spans;
+    }
+}
+
 UI_COMPLEX_MESSAGE_NS_BEGIN
 
 class ComplexMessageItem;
@@ -26,7 +34,8 @@ namespace ComplexMessageItemBuilder
         const bool _forcePreview,
         const QString& _description,
         const QString& _url,
-        const Data::SharedContact& _sharedContact);
+        const Data::SharedContact& _sharedContact,
+        const common::tools::message_spans* _textSpans = nullptr);
 
 }
 
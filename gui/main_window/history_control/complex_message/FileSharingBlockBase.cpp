@@ -632,6 +632,7 @@ void FileSharingBlockBase::onFileMetainfoDownloaded(qint64 seq, const Data::File
     gotAudio_ = _meta.gotAudio_;
     recognize_ = _meta.recognize_;
     LastModified_ = _meta.lastModified_;
+    waveform_ = _meta.waveform_;
 
     onMetainfoDownloaded();
 
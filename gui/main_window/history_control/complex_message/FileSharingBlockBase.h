@@ -214,6 +214,7 @@ protected:
     bool recognize_;
     bool gotAudio_;
     int32_t duration_;
+    QByteArray waveform_;
 
 private Q_SLOTS:
     void onFileDownloaded(qint64 seq, const Data::FileSharingDownloadResult& _result);
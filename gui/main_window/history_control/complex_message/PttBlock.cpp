@@ -16,6 +16,7 @@
 #include "../../input_widget/InputWidgetUtils.h"
 
 #include "../../sounds/SoundsManager.h"
+#include "../../../media/ptt/Waveform.h"
 
 #include "../ActionButtonWidget.h"
 #include "../MessageStyle.h"
@@ -610,6 +611,8 @@ void PttBlock::onDownloaded()
 
         startPlayback();
     }
+
+    requestWaveform();
 }
 
 void PttBlock::onDownloadedAction()
@@ -671,6 +674,8 @@ void PttBlock::onMetainfoDownloaded()
 
         connect(buttonText_, &PttDetails::ButtonWithBackground::clicked, this, &PttBlock::onTextButtonClicked);
     }
+
+    requestWaveform();
 }
 
 void PttBlock::onPreviewMetainfoDownloaded(const QString &_miniPreviewUri, const QString &_fullPreviewUri)
@@ -691,6 +696,8 @@ void PttBlock::connectSignals()
 
     connect(GetSoundsManager(), &SoundsManager::pttPaused,   this, &PttBlock::onPttPaused);
     connect(GetSoundsManager(), &SoundsManager::pttFinished, this, &PttBlock::onPttFinished);
+
+    connect(&ptt::getWaveformLoader(), &ptt::WaveformLoader::waveformReady, this, &PttBlock::onWaveformReady);
 }
 
 void PttBlock::drawBubble(QPainter &_p, const QRect &_bubbleRect)
@@ -759,6 +766,12 @@ void PttBlock::drawPlaybackProgress(QPainter &_p, const int32_t _progressMsec, c
         _p.drawLine(left, top, right, top);
     };
 
+    if (!waveform_.isEmpty())
+    {
+        drawWaveform(_p, x, y + MessageStyle::Ptt::getPttProgressWidth(), totalWidth, playedWidth);
+        return;
+    }
+
     Utils::PainterSaver ps(_p);
     if (!isPlayed_)
     {
@@ -773,6 +786,69 @@ void PttBlock::drawPlaybackProgress(QPainter &_p, const int32_t _progressMsec, c
     }
 }
 
+void PttBlock::drawWaveform(QPainter &_p, const int _x, const int _centerY, const int _width, const int _playedWidth)
+{
+    const auto barWidth = Utils::scale_value(2);
+    const auto barStep = Utils::scale_value(4);
+    const auto maxHeight = Utils::scale_value(12);
+
+    const auto barsCount = std::max(_width / barStep, 1);
+    const auto size = waveform_.size();
+
+    const auto byteValue = [this](int _i) { return int(uchar(waveform_.at(_i))); };
+
+    // the bars are scaled to the loudest one, the stored peaks are absolute
+    auto loudest = 1;
+    for (auto i = 0; i < size; ++i)
+        loudest = std::max(loudest, byteValue(i));
+
+    Utils::PainterSaver ps(_p);
+    _p.setRenderHint(QPainter::Antialiasing);
+    _p.setPen(Qt::NoPen);
+
+    for (auto i = 0; i < barsCount; ++i)
+    {
+        const auto first = i * size / barsCount;
+        const auto last = std::max(first + 1, (i + 1) * size / barsCount);
+
+        auto value = 0;
+        for (auto j = first; j < last; ++j)
+            value = std::max(value, byteValue(j));
+
+        const auto height = std::max(barWidth, maxHeight * value / loudest);
+        const auto left = _x + i * barStep;
+        const auto isPlayedBar = !isPlayed_ || left < _x + _playedWidth;
+
+        _p.setBrush(isPlayedBar ? getPlaybackColor() : getProgressColor());
+        _p.drawRoundedRect(QRectF(left, _centerY - height / 2., barWidth, height), barWidth / 2., barWidth / 2.);
+    }
+}
+
+void PttBlock::requestWaveform()
+{
+    if (!waveform_.isEmpty() || !isFileDownloaded())
+        return;
+
+    auto& loader = ptt::getWaveformLoader();
+    if (auto waveform = loader.waveform(getLink()); !waveform.isEmpty())
+    {
+        waveform_ = std::move(waveform);
+        update();
+        return;
+    }
+
+    loader.request(getLink(), getFileLocalPath());
+}
+
+void PttBlock::onWaveformReady(const QString& _url, const QByteArray& _waveform)
+{
+    if (_url != getLink() || !waveform_.isEmpty())
+        return;
+
+    waveform_ = _waveform;
+    update();
+}
+
 int32_t PttBlock::getPlaybackProgress() const
 {
     assert(playbackProgressMsec_ >= 0);
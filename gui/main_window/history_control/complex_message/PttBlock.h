@@ -206,6 +206,10 @@ private:
 
     void drawPlaybackProgress(QPainter &_p, const int32_t _progressMsec, const int32_t _durationMsec);
 
+    void drawWaveform(QPainter &_p, const int _x, const int _centerY, const int _width, const int _playedWidth);
+
+    void requestWaveform();
+
     int32_t getPlaybackProgress() const;
 
     void setPlaybackProgress(const int32_t _value);
@@ -304,6 +308,8 @@ private Q_SLOTS:
 
     void onPttPaused(int _id);
 
+    void onWaveformReady(const QString& _url, const QByteArray& _waveform);
+
     void onPttText(qint64 _seq, int _error, QString _text, int _comeback);
 
     void pttPlayed(qint64);
@@ -118,6 +118,10 @@ void StickerBlock::requestPinPreview()
                     auto unused = false;
                     auto image = sticker->getImage(getStickerSize(), false, unused);
 
+                    // onSticker comes again once the stored file is decoded
+                    if (image.isNull() && sticker->isImagePending(getStickerSize()))
+                        return;
+
                     emit getParentComplexMessage()->pinPreview(QPixmap::fromImage(image));
                 }
             }
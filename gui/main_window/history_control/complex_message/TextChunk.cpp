@@ -23,6 +23,11 @@ Ui::ComplexMessage::ChunkIterator::ChunkIterator(const QString& _text, FixedUrls
 {
 }
 
+Ui::ComplexMessage::ChunkIterator::ChunkIterator(const QString& _text, const common::tools::message_spans& _spans)
+    : tokenizer_(_text.toStdString(), _spans)
+{
+}
+
 bool Ui::ComplexMessage::ChunkIterator::hasNext() const
 {
     return tokenizer_.has_token();
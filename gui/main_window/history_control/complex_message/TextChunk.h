@@ -66,6 +66,9 @@ namespace Ui
             explicit ChunkIterator(const QString& _text);
             ChunkIterator(const QString& _text, FixedUrls&& _urls);
 
+            // _spans must be valid for the utf-8 _text, see message_spans::is_valid_for
+            ChunkIterator(const QString& _text, const common::tools::message_spans& _spans);
+
             bool hasNext() const;
             TextChunk current(bool _allowSnippet = true, bool _forcePreview = false) const;
             void next();
@@ -17,7 +17,7 @@ namespace Heads
         connect(&Utils::InterConnector::instance(), &Utils::InterConnector::hideHeads, this, &Heads::HeadContainer::onHideHeads);
         connect(&Utils::InterConnector::instance(), &Utils::InterConnector::showHeads, this, &Heads::HeadContainer::onShowHeads);
 
-        if (Ui::get_gui_settings()->get_value<bool>(settings_show_groupchat_heads, true))
+        if (Ui::cached_settings::show_groupchat_heads().get())
             onShowHeads();
     }
 
@@ -104,7 +104,7 @@ namespace hist::MessageBuilder
                 _msg.GetSticker(),
                 _msg.GetFileSharing(),
                 _msg.IsOutgoing(),
-                isNotAuth, false, _msg.GetDescription(), _msg.GetUrl(), _msg.sharedContact_);
+                isNotAuth, false, _msg.GetDescription(), _msg.GetUrl(), _msg.sharedContact_, _msg.TextSpans_.get());
 
         item->setContact(_msg.AimId_);
         item->setTime(_msg.GetTime());
@@ -193,7 +193,8 @@ namespace hist::MessageBuilder
                 true,// _forcePreview
                 buddy.GetDescription(),
                 buddy.GetUrl(),
-                buddy.sharedContact_);
+                buddy.sharedContact_,
+                buddy.TextSpans_.get());
 
         return { item->formatRecentsText(), item->getMediaType() };
     }
@@ -133,7 +133,7 @@ namespace hist
 
             const auto dlgState = hist::getDlgState(aimId_);
             const auto lastReadMention = std::max(lastReads_.mention, dlgState.LastReadMention_);
-            if (Ui::get_gui_settings()->get_value<bool>(settings_partial_read, settings_partial_read_deafult()))
+            if (Ui::cached_settings::partial_read().get())
             {
                 const auto yoursLastRead = dlgState.YoursLastRead_;
                 const auto needResetUnreadCount = (dlgState.UnreadCount_ != 0 && yoursLastRead == _messageId);
@@ -55,7 +55,8 @@
 
 namespace
 {
-    constexpr std::chrono::milliseconds suggestTimerTimeout() noexcept { return std::chrono::milliseconds(400); }
+    // the suggests are looked up in a prefix index, it only debounces the popup
+    constexpr std::chrono::milliseconds suggestTimerTimeout() noexcept { return std::chrono::milliseconds(150); }
     constexpr std::chrono::milliseconds viewTransitDuration() noexcept { return std::chrono::milliseconds(100); }
     const auto symbolAt = ql1c('@');
 
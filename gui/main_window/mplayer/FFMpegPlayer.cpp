@@ -38,6 +38,14 @@ namespace Ui
 
     const int64_t empty_pts = -1000000;
 
+    constexpr int32_t maxCodecThreads = 4;
+
+    int32_t videoDecodeWorkersCount()
+    {
+        static const auto count = std::clamp(QThread::idealThreadCount() / 2, 1, 4);
+        return count;
+    }
+
     bool ThreadMessagesQueue::getMessage(ThreadMessage& _message, std::function<bool()> _isQuit, int32_t _wait_timeout)
     {
         condition_.tryAcquire(1, _wait_timeout);
@@ -77,6 +85,22 @@ namespace Ui
         condition_.release(1);
     }
 
+    void ThreadMessagesQueue::pushUrgentMessage(const ThreadMessage& _message)
+    {
+        decltype(messages_) tmpList;
+        tmpList.push_back(_message);
+        {
+            std::scoped_lock lock(queue_mutex_);
+
+            // ahead of the other media, but never ahead of the queued messages of the same one
+            const auto id = _message.videoId_;
+            const auto last = std::find_if(messages_.rbegin(), messages_.rend(), [id](const auto& x) { return x.videoId_ == id; });
+            messages_.splice(last.base(), tmpList, tmpList.begin());
+        }
+
+        condition_.release(1);
+    }
+
     void ThreadMessagesQueue::clear()
     {
         decltype(messages_) tmpList;
@@ -86,6 +110,12 @@ namespace Ui
         }
     }
 
+    bool ThreadMessagesQueue::isEmpty()
+    {
+        std::scoped_lock lock(queue_mutex_);
+        return messages_.empty();
+    }
+
 
     //////////////////////////////////////////////////////////////////////////
     // PacketQueue
@@ -169,6 +199,55 @@ namespace Ui
     }
 
 
+    constexpr size_t maxPooledFrames = 4;
+    constexpr int frameAlign = 64;
+
+    FramePool::FramePool()
+    {
+        images_.reserve(maxPooledFrames);
+    }
+
+    QImage& FramePool::acquire(const QSize& _size)
+    {
+        if (!images_.empty() && images_.front().size() != _size)
+            images_.clear();
+
+        for (auto& image : images_)
+        {
+            if (image.isDetached())
+                return image;
+        }
+
+        if (images_.size() < maxPooledFrames)
+        {
+            images_.push_back(allocate(_size));
+            return images_.back();
+        }
+
+        // all pooled images are still held by the gui
+        spare_ = allocate(_size);
+        return spare_;
+    }
+
+    void FramePool::clear()
+    {
+        images_.clear();
+        spare_ = QImage();
+    }
+
+    QImage FramePool::allocate(const QSize& _size)
+    {
+        const auto bytesPerLine = (_size.width() * 4 + frameAlign - 1) / frameAlign * frameAlign;
+
+        // one more row since simd writers may run past the end of the last one
+        auto data = static_cast<uchar*>(ffmpeg::av_malloc(size_t(bytesPerLine) * (_size.height() + 1)));
+        if (!data)
+            return QImage();
+
+        return QImage(data, _size.width(), _size.height(), bytesPerLine, QImage::Format_RGBA8888, [](void* _data) { ffmpeg::av_free(_data); }, data);
+    }
+
+
     MediaData::MediaData()
         : syncWithAudio_(false)
         , videoStream_(nullptr)
@@ -179,7 +258,6 @@ namespace Ui
         , audioQueue_(QSharedPointer<PacketQueue>::create())
         , needUpdateSwsContext_(false)
         , swsContext_(nullptr)
-        , frameRGB_(nullptr)
         , width_(0)
         , height_(0)
         , rotation_(0)
@@ -201,6 +279,7 @@ namespace Ui
         , videoQuitRecv_(false)
         , demuxQuitRecv_(false)
         , streamClosed_(false)
+        , priority_(dp_visible)
     {
     }
 
@@ -216,6 +295,9 @@ namespace Ui
         QObject::connect(this, &VideoContext::videoQuit, this, &VideoContext::onVideoQuit);
         QObject::connect(this, &VideoContext::demuxQuit, this, &VideoContext::onDemuxQuit);
         QObject::connect(this, &VideoContext::streamsClosed, this, &VideoContext::onStreamsClosed);
+
+        for (auto i = 0; i < videoDecodeWorkersCount(); ++i)
+            videoThreadMessagesQueues_.push_back(std::make_unique<ThreadMessagesQueue>());
     }
 
     VideoContext::~VideoContext()
@@ -274,7 +356,7 @@ namespace Ui
         getMediaContainer()->stopMedia(_videoId);
     }
 
-    ffmpeg::AVStream* VideoContext::openStream(int32_t _type, ffmpeg::AVFormatContext* _context)
+    ffmpeg::AVStream* VideoContext::openStream(int32_t _type, ffmpeg::AVFormatContext* _context, bool _threaded)
     {
         ffmpeg::AVStream* stream = 0;
 
@@ -299,6 +381,13 @@ namespace Ui
             return 0;
         }
 
+        if (_threaded)
+        {
+            // a decode worker serves several media, so a single stream decodes on the codec's own threads
+            codecContext->thread_count = std::min(QThread::idealThreadCount(), maxCodecThreads);
+            codecContext->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+        }
+
         if (avcodec_open2(codecContext, codec, 0) < 0)
         {
             // Failed to open codec
@@ -567,6 +656,9 @@ namespace Ui
         static std::mutex firstFrameMutex_;
         std::scoped_lock lock(firstFrameMutex_);
 
+        // previews mostly come in runs of the same format, keep the context between calls
+        static ffmpeg::SwsContext* firstFrameSwsContext = nullptr;
+
         QImage result;
 
         ffmpeg::AVFormatContext* ctx = nullptr;
@@ -628,41 +720,20 @@ namespace Ui
                     {
                         QSize scaledSize(width, height);
 
-                        int align = 256;
-                        while (1)
-                        {
-                            if (frame->linesize[0] % align == 0)
-                                break;
-
-                            align = align / 2;
-                        }
-
-                        ffmpeg::AVFrame* frameRGB = ffmpeg::av_frame_alloc();
-                        int numBytes = ffmpeg::av_image_get_buffer_size(ffmpeg::AV_PIX_FMT_RGBA, scaledSize.width(), scaledSize.height(), align);
-                        std::vector<uint8_t> scaledBuffer(numBytes);
-                        av_image_fill_arrays(frameRGB->data, frameRGB->linesize, &scaledBuffer[0], ffmpeg::AV_PIX_FMT_RGBA, scaledSize.width(), scaledSize.height(), align);
-
-                        ffmpeg::SwsContext* swsContext = nullptr;
-                        swsContext = sws_getCachedContext(swsContext, frame->width, frame->height, ffmpeg::AVPixelFormat(frame->format), scaledSize.width(), scaledSize.height(), ffmpeg::AV_PIX_FMT_RGBA, SWS_POINT, 0, 0, 0);
+                        firstFrameSwsContext = sws_getCachedContext(firstFrameSwsContext, frame->width, frame->height, ffmpeg::AVPixelFormat(frame->format), scaledSize.width(), scaledSize.height(), ffmpeg::AV_PIX_FMT_RGBA, SWS_POINT, 0, 0, 0);
 
-                        ffmpeg::sws_scale(swsContext, frame->data, frame->linesize, 0, frame->height, frameRGB->data, frameRGB->linesize);
-
-                        QImage lastFrame(scaledSize.width(), scaledSize.height(), QImage::Format_RGBA8888);
-
-                        for (int32_t y = 0; y < scaledSize.height(); ++y)
+                        QImage lastFrame = FramePool::allocate(scaledSize);
+                        if (firstFrameSwsContext && !lastFrame.isNull())
                         {
-                            memcpy(lastFrame.scanLine(y), frameRGB->data[0] + y*frameRGB->linesize[0], scaledSize.width() * 4);
-                        }
-
-                        if (rotation)
-                            lastFrame = lastFrame.transformed(QTransform().rotate(rotation));
+                            uint8_t* const dstData[] = { lastFrame.bits() };
+                            const int dstLinesize[] = { lastFrame.bytesPerLine() };
+                            ffmpeg::sws_scale(firstFrameSwsContext, frame->data, frame->linesize, 0, frame->height, dstData, dstLinesize);
 
-                        result = std::move(lastFrame);
-
-                        ffmpeg::av_frame_unref(frameRGB);
-                        ffmpeg::av_frame_free(&frameRGB);
+                            if (rotation)
+                                lastFrame = lastFrame.transformed(QTransform().rotate(rotation));
 
-                        sws_freeContext(swsContext);
+                            result = std::move(lastFrame);
+                        }
 
                         ffmpeg::av_packet_unref(&packet);
                         break;
@@ -758,7 +829,7 @@ namespace Ui
         }
 
         // Open video and audio streams
-        _media.videoStream_ = openStream(ffmpeg::AVMEDIA_TYPE_VIDEO, _media.formatContext_);
+        _media.videoStream_ = openStream(ffmpeg::AVMEDIA_TYPE_VIDEO, _media.formatContext_, true);
 
         if (!_media.videoStream_)
         {
@@ -1391,7 +1462,54 @@ namespace Ui
 
     void VideoContext::postVideoThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others)
     {
-        videoThreadMessagesQueue_.pushMessage(_message, _forward, _clear_others);
+        if (_message.message_ == thread_message_type::tmt_wake_up)
+        {
+            for (auto& queue : videoThreadMessagesQueues_)
+                queue->pushMessage(_message, _forward, _clear_others);
+
+            return;
+        }
+
+        auto& queue = *videoThreadMessagesQueues_[getVideoDecodeWorker(_message.videoId_)];
+
+        if (!_forward && !_clear_others)
+        {
+            const auto media = getMediaData(_message.videoId_);
+            if (media && getPriority(*media) == dp_focused)
+            {
+                queue.pushUrgentMessage(_message);
+                return;
+            }
+        }
+
+        queue.pushMessage(_message, _forward, _clear_others);
+    }
+
+    bool VideoContext::hasVideoThreadMessages(int32_t _worker)
+    {
+        return !videoThreadMessagesQueues_[_worker]->isEmpty();
+    }
+
+    int32_t VideoContext::getVideoDecodeWorkers() const
+    {
+        return int32_t(videoThreadMessagesQueues_.size());
+    }
+
+    int32_t VideoContext::getVideoDecodeWorker(uint32_t _videoId) const
+    {
+        // ids are handed out sequentially, so this spreads the media evenly
+        return int32_t(_videoId % videoThreadMessagesQueues_.size());
+    }
+
+    void VideoContext::setPriority(uint32_t _videoId, decode_priority _priority)
+    {
+        if (auto media = getMediaData(_videoId))
+            media->priority_ = _priority;
+    }
+
+    decode_priority VideoContext::getPriority(MediaData& _media) const
+    {
+        return _media.priority_;
     }
 
     void VideoContext::postDemuxThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others)
@@ -1416,7 +1534,9 @@ namespace Ui
 
     void VideoContext::clearMessageQueue()
     {
-        videoThreadMessagesQueue_.clear();
+        for (auto& queue : videoThreadMessagesQueues_)
+            queue->clear();
+
         audioThreadMessageQueue_.clear();
         demuxThreadMessageQueue_.clear();
     }
@@ -1431,9 +1551,9 @@ namespace Ui
         _media.audioData_.state_ = _state;
     }
 
-    bool VideoContext::getVideoThreadMessage(ThreadMessage& _message, int32_t _waitTimeout)
+    bool VideoContext::getVideoThreadMessage(ThreadMessage& _message, int32_t _waitTimeout, int32_t _worker)
     {
-        return videoThreadMessagesQueue_.getMessage(_message, [this]{return isQuit();}, _waitTimeout);
+        return videoThreadMessagesQueues_[_worker]->getMessage(_message, [this]{return isQuit();}, _waitTimeout);
     }
 
     bool VideoContext::updateScaleContext(MediaData& _media, const QSize _sz)
@@ -1452,15 +1572,10 @@ namespace Ui
 
     void VideoContext::freeScaleContext(MediaData& _media)
     {
-        if (_media.frameRGB_)
-        {
-            ffmpeg::av_frame_unref(_media.frameRGB_);
-            ffmpeg::av_frame_free(&_media.frameRGB_);
-        }
-
-        _media.frameRGB_ = 0;
+        _media.framePool_.clear();
 
         sws_freeContext(_media.swsContext_);
+        _media.swsContext_ = nullptr;
     }
 
     bool VideoContext::enableAudio(MediaData& _media) const
@@ -2006,8 +2121,9 @@ namespace Ui
     //////////////////////////////////////////////////////////////////////////
     // VideoDecodeThread
     //////////////////////////////////////////////////////////////////////////
-    VideoDecodeThread::VideoDecodeThread(VideoContext& _ctx)
-        :   ctx_(_ctx)
+    VideoDecodeThread::VideoDecodeThread(VideoContext& _ctx, int32_t _worker)
+        :   ctx_(_ctx),
+            worker_(_worker)
     {
 
     }
@@ -2037,7 +2153,7 @@ namespace Ui
 
         while (!ctx_.isQuit())
         {
-            if (ctx_.getVideoThreadMessage(msg, waitMsgTimeout))
+            if (ctx_.getVideoThreadMessage(msg, waitMsgTimeout, worker_))
             {
                 auto videoId = msg.videoId_;
 
@@ -2140,6 +2256,14 @@ namespace Ui
                             break;
                         }
 
+                        // an off-screen media lets the other media of this worker go first, x_ marks the request as already deferred
+                        if (ctx_.getPriority(media) == dp_background && msg.x_ == 0 && ctx_.hasVideoThreadMessages(worker_))
+                        {
+                            msg.x_ = 1;
+                            ctx_.postVideoThreadMessage(msg, false);
+                            break;
+                        }
+
                         ffmpeg::av_frame_unref(frame);
 
                         videoData[videoId].eof_ = false;
@@ -2188,50 +2312,28 @@ namespace Ui
                             // update scale context
                             if ((media.needUpdateSwsContext_) || (frame->format != -1 && frame->format != media.codecContext_->pix_fmt) || !media.swsContext_)
                             {
-                                if (media.frameRGB_)
-                                {
-                                    ffmpeg::av_frame_unref(media.frameRGB_);
-                                    ffmpeg::av_frame_free(&media.frameRGB_);
-
-                                    media.frameRGB_ = 0;
-                                }
-
                                 media.needUpdateSwsContext_ = false;
                                 media.swsContext_ = sws_getCachedContext(
                                     media.swsContext_,
                                     frame->width,
                                     frame->height,
                                     ffmpeg::AVPixelFormat(frame->format), scaledSize.width(), scaledSize.height(), ffmpeg::AV_PIX_FMT_RGBA, SWS_POINT, 0, 0, 0);
-
-                                int align = 256;
-                                while (1)
-                                {
-                                    if (frame->linesize[0] % align == 0)
-                                        break;
-
-                                    align = align / 2;
-                                }
-
-                                media.frameRGB_ = ffmpeg::av_frame_alloc();
-                                int numBytes = ffmpeg::av_image_get_buffer_size(ffmpeg::AV_PIX_FMT_RGBA, scaledSize.width(), scaledSize.height(), align);
-                                media.scaledBuffer_.resize(numBytes);
-                                av_image_fill_arrays(media.frameRGB_->data, media.frameRGB_->linesize, &media.scaledBuffer_[0], ffmpeg::AV_PIX_FMT_RGBA, scaledSize.width(), scaledSize.height(), align);
                             }
 
-                            ffmpeg::sws_scale(media.swsContext_, frame->data, frame->linesize, 0, frame->height, media.frameRGB_->data, media.frameRGB_->linesize);
+                            // scale straight into the pooled image, the gui gets a shared copy of it
+                            QImage& lastFrame = media.framePool_.acquire(scaledSize);
+                            if (lastFrame.isNull() || !media.swsContext_)
+                                break;
 
-                            QImage lastFrame(scaledSize.width(), scaledSize.height(), QImage::Format_RGBA8888);
-
-                            for (int y = 0; y < scaledSize.height(); ++y)
-                            {
-                                memcpy(lastFrame.scanLine(y), media.frameRGB_->data[0] + y * media.frameRGB_->linesize[0], scaledSize.width() * 4);
-                            }
+                            uint8_t* const dstData[] = { lastFrame.bits() };
+                            const int dstLinesize[] = { lastFrame.bytesPerLine() };
+                            ffmpeg::sws_scale(media.swsContext_, frame->data, frame->linesize, 0, frame->height, dstData, dstLinesize);
 
                             const auto rotation = ctx_.getRotation(media);
                             if (rotation)
-                                lastFrame = lastFrame.transformed(QTransform().rotate(rotation));
-
-                            emit ctx_.nextframeReady(videoId, lastFrame, pts, false);
+                                emit ctx_.nextframeReady(videoId, lastFrame.transformed(QTransform().rotate(rotation)), pts, false);
+                            else
+                                emit ctx_.nextframeReady(videoId, lastFrame, pts, false);
                         }
                         else if (videoData[videoId].eof_)
                         {
@@ -2834,6 +2936,7 @@ namespace Ui
             mute_(false),
             dataReady_(false),
             pausedByUser_(false),
+            priority_(dp_visible),
             imageDuration_(0),
             imageProgress_(0),
             seek_request_id_(0)
@@ -3223,6 +3326,7 @@ namespace Ui
             return false;
 
         media->isImage_ = _isImage;
+        media->priority_ = priority_;
 
         getMediaContainer()->DemuxThreadStart(mediaId);
 
@@ -3450,6 +3554,18 @@ namespace Ui
         return volume_;
     }
 
+    void FFMpegPlayer::setPriority(decode_priority _priority)
+    {
+        priority_ = _priority;
+
+        auto container = getMediaContainer();
+
+        container->setPriority(mediaId_, _priority);
+
+        for (auto media : queuedMedia_)
+            container->setPriority(media, _priority);
+    }
+
     void FFMpegPlayer::setMute(bool _mute)
     {
         ThreadMessage msg(mediaId_, thread_message_type::tmt_set_mute);
@@ -3725,9 +3841,11 @@ namespace Ui
         : is_decods_inited_(false)
         , is_demux_inited_(false)
         , demuxThread_(ctx_)
-        , videoDecodeThread_(ctx_)
         , audioDecodeThread_(ctx_)
-    {}
+    {
+        for (auto i = 0; i < ctx_.getVideoDecodeWorkers(); ++i)
+            videoDecodeThreads_.push_back(std::make_unique<VideoDecodeThread>(ctx_, i));
+    }
 
     MediaContainer::~MediaContainer()
     {
@@ -3752,7 +3870,8 @@ namespace Ui
 
     void MediaContainer::VideoDecodeThreadStart(uint32_t _mediaId)
     {
-        videoDecodeThread_.start();
+        for (auto& thread : videoDecodeThreads_)
+            thread->start();
     }
 
     void MediaContainer::AudioDecodeThreadStart(uint32_t _mediaId)
@@ -3835,6 +3954,11 @@ namespace Ui
         ctx_.updateScaledVideoSize(_mediaId, _sz);
     }
 
+    void MediaContainer::setPriority(const uint32_t _mediaId, decode_priority _priority)
+    {
+        ctx_.setPriority(_mediaId, _priority);
+    }
+
     void MediaContainer::postDemuxThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others)
     {
         ctx_.postDemuxThreadMessage(_message, _forward, _clear_others);
@@ -3925,7 +4049,8 @@ namespace Ui
 
     void MediaContainer::VideoDecodeThreadWait()
     {
-        videoDecodeThread_.wait();
+        for (auto& thread : videoDecodeThreads_)
+            thread->wait();
     }
 
     void MediaContainer::AudioDecodeThreadWait()
@@ -27,6 +27,14 @@ namespace Ui
         dts_failed = 5
     };
 
+    // order in which the decode workers serve their media
+    enum decode_priority
+    {
+        dp_background = 0,
+        dp_visible = 1,
+        dp_focused = 2
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // ThreadMessage
     //////////////////////////////////////////////////////////////////////////
@@ -85,7 +93,9 @@ namespace Ui
 
         bool getMessage(ThreadMessage& _message, std::function<bool()> _isQuit, int32_t _wait_timeout);
         void pushMessage(const ThreadMessage& _message, bool _forward, bool _clear_others);
+        void pushUrgentMessage(const ThreadMessage& _message);
         void clear();
+        bool isEmpty();
     };
 
 
@@ -116,6 +126,30 @@ namespace Ui
     };
 
 
+    //////////////////////////////////////////////////////////////////////////
+    // FramePool
+    //////////////////////////////////////////////////////////////////////////
+    // decoded frame images of one media; an image is reused as soon as
+    // the gui drops its copy, so playback doesn't allocate per frame
+    class FramePool
+    {
+        std::vector<QImage> images_;
+
+        QImage spare_;
+
+    public:
+
+        FramePool();
+
+        // image of _size that nobody else holds, valid until the next call
+        QImage& acquire(const QSize& _size);
+        void clear();
+
+        // sws scales straight into the image, so rows are aligned for its simd writers
+        static QImage allocate(const QSize& _size);
+    };
+
+
     //////////////////////////////////////////////////////////////////////////
     // DecodeAudioData
     //////////////////////////////////////////////////////////////////////////
@@ -191,8 +225,7 @@ namespace Ui
 
         bool needUpdateSwsContext_;
         ffmpeg::SwsContext* swsContext_;
-        std::vector<uint8_t> scaledBuffer_;
-        ffmpeg::AVFrame* frameRGB_;
+        FramePool framePool_;
         DecodeAudioData audioData_;
 
         std::map<int32_t, QImage> frames_;
@@ -230,6 +263,8 @@ namespace Ui
         bool streamClosed_;
         bool isImage_;
 
+        std::atomic<decode_priority> priority_;
+
         std::queue<double> audio_queue_ptss_;
 
         MediaData();
@@ -300,13 +335,14 @@ namespace Ui
         mutable std::unordered_map<uint32_t, bool> activeVideos_;
         mutable std::mutex activeVideosMutex_;
 
-        ThreadMessagesQueue videoThreadMessagesQueue_;
+        // one queue per video decode worker, a media always goes to the same worker
+        std::vector<std::unique_ptr<ThreadMessagesQueue>> videoThreadMessagesQueues_;
         ThreadMessagesQueue demuxThreadMessageQueue_;
         ThreadMessagesQueue audioThreadMessageQueue_;
 
     private:
 
-        static ffmpeg::AVStream* openStream(int32_t _type, ffmpeg::AVFormatContext* _context);
+        static ffmpeg::AVStream* openStream(int32_t _type, ffmpeg::AVFormatContext* _context, bool _threaded = false);
         static void closeStream(ffmpeg::AVStream* _stream);
         void sendCloseStreams(uint32_t _videoId);
 
@@ -401,7 +437,14 @@ namespace Ui
         void updateScaledVideoSize(uint32_t _videoId, const QSize& _sz);
 
         void postVideoThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others = false);
-        bool getVideoThreadMessage(ThreadMessage& _message, int32_t _waitTimeout);
+        bool getVideoThreadMessage(ThreadMessage& _message, int32_t _waitTimeout, int32_t _worker);
+        bool hasVideoThreadMessages(int32_t _worker);
+
+        int32_t getVideoDecodeWorkers() const;
+        int32_t getVideoDecodeWorker(uint32_t _videoId) const;
+
+        void setPriority(uint32_t _videoId, decode_priority _priority);
+        decode_priority getPriority(MediaData& _media) const;
 
         void postDemuxThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others = false);
         bool getDemuxThreadMessage(ThreadMessage& _message, int32_t _waitTimeout);
@@ -469,13 +512,15 @@ namespace Ui
 
         VideoContext& ctx_;
 
+        const int32_t worker_;
+
     protected:
 
         virtual void run() override;
 
     public:
 
-        explicit VideoDecodeThread(VideoContext& _ctx);
+        VideoDecodeThread(VideoContext& _ctx, int32_t _worker);
 
         void prepareCtx(MediaData& _media);
     };
@@ -640,6 +685,7 @@ namespace Ui
 
         void stopMedia(uint32_t _mediaId);
         void updateVideoScaleSize(const uint32_t _mediaId, const QSize _sz);
+        void setPriority(const uint32_t _mediaId, decode_priority _priority);
 
         VideoContext ctx_;
 
@@ -651,7 +697,7 @@ namespace Ui
         std::unordered_set<uint32_t> active_video_ids_;
 
         DemuxThread demuxThread_;
-        VideoDecodeThread videoDecodeThread_;
+        std::vector<std::unique_ptr<VideoDecodeThread>> videoDecodeThreads_;
         AudioDecodeThread audioDecodeThread_;
 
         void DemuxThreadWait();
@@ -728,6 +774,8 @@ namespace Ui
         bool dataReady_;
         bool pausedByUser_;
 
+        decode_priority priority_;
+
         int imageDuration_;
         int imageProgress_;
 
@@ -834,6 +882,9 @@ namespace Ui
         void setRestoreVolume(const int32_t _volume);
         int32_t getRestoreVolume() const;
 
+        // off-screen media yield their decode worker to the visible ones
+        void setPriority(decode_priority _priority);
+
         void requestFirstFrame(const QString& _file, std::function<void(QPixmap)> _ready);
 
         void setRenderer(std::shared_ptr<FrameRenderer> _renderer);
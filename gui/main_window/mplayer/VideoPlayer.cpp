@@ -1609,6 +1609,7 @@ namespace Ui
         init(_parent, (_flags &DialogPlayer::Flags::is_gif),(_flags &DialogPlayer::Flags::is_sticker));
 
         isFullScreen_ = DialogPlayer::Flags::as_window & _flags;
+        updateDecodePriority();
 
         rootLayout_->addWidget(renderer_->getWidget());
 
@@ -1664,6 +1665,7 @@ namespace Ui
 
         rootLayout_->addWidget(renderer_->getWidget());
         isFullScreen_ = true;
+        updateDecodePriority();
 
         controlPanel_ = std::make_unique<Ui::VideoPlayerControlPanel>(_attached->controlPanel_.get(), this, ffplayer_, qsl("window"));
         controlPanel_->installEventFilter(this);
@@ -1693,6 +1695,7 @@ namespace Ui
             attachedPlayer_->setVolume(getVolume(), false);
             attachedPlayer_->setAttachedPlayer(nullptr);
             attachedPlayer_->renderer_->updateFrame(renderer_->getActiveImage());
+            attachedPlayer_->updateDecodePriority();
         }
     }
 
@@ -2110,6 +2113,20 @@ namespace Ui
     void DialogPlayer::setIsFullScreen(bool _isFullScreen)
     {
         isFullScreen_ = _isFullScreen;
+
+        updateDecodePriority();
+    }
+
+    void DialogPlayer::updateDecodePriority()
+    {
+        // the gallery decides for the media it shows
+        if (attachedPlayer_ && !isFullScreen_)
+            return;
+
+        if (isFullScreen_)
+            ffplayer_->setPriority(dp_focused);
+        else
+            ffplayer_->setPriority(visible_ ? dp_visible : dp_background);
     }
 
     bool DialogPlayer::inited()
@@ -2247,6 +2264,8 @@ namespace Ui
     {
         visible_ = _visible;
 
+        updateDecodePriority();
+
         if (attachedPlayer_ || mediaPath_.isEmpty() || (ffplayer_->state() == QMovie::NotRunning && !visible_))
             return;
 
@@ -228,6 +228,7 @@ namespace Ui
 
         void init(QWidget* _parent, const bool _isGif, const bool _isSticker);
         void moveToScreen();
+        void updateDecodePriority();
 
     public:
 
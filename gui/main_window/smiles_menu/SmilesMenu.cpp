@@ -200,7 +200,7 @@ namespace Ui
         return QModelIndex();
     }
 
-    Emoji::EmojiRecordSptr EmojiViewItemModel::getEmoji(int _col, int _row) const
+    Emoji::EmojiRecordPtr EmojiViewItemModel::getEmoji(int _col, int _row) const
     {
         if (const auto idx = getLinearIndex(_row, _col); idx < getEmojisCount())
         {
@@ -240,7 +240,7 @@ namespace Ui
                 const auto emoji = getEmoji(_idx.column(), _idx.row());
                 if (emoji)
                 {
-                    QImage emojiPixmap = Emoji::GetEmoji(emoji->fullCodePoints, int(getPickerEmojiSize()));
+                    QPixmap emojiPixmap = Emoji::GetEmojiPixmap(emoji->fullCodePoints, int(getPickerEmojiSize()));
                     Utils::check_pixel_ratio(emojiPixmap);
 
                     assert(!emojiPixmap.isNull());
@@ -254,7 +254,7 @@ namespace Ui
 
     int EmojiViewItemModel::addCategory(const QString& _category)
     {
-        const Emoji::EmojiRecordSptrVec& emojisVector = Emoji::GetEmojiInfoByCategory(_category);
+        const Emoji::EmojiRecordVec& emojisVector = Emoji::GetEmojiInfoByCategory(_category);
         emojiCategories_.emplace_back(_category, emojisVector);
 
         emojisCount_ += emojisVector.size();
@@ -435,7 +435,7 @@ namespace Ui
         return model_->getCategories();
     }
 
-    Emoji::EmojiRecordSptr EmojiTableView::getEmoji(int _col, int _row) const
+    Emoji::EmojiRecordPtr EmojiTableView::getEmoji(int _col, int _row) const
     {
         return model_->getEmoji(_col, _row);
     }
@@ -584,8 +584,9 @@ namespace Ui
 
     void EmojiTableItemDelegate::paint(QPainter* _painter, const QStyleOptionViewItem& _option, const QModelIndex& _index) const
     {
-        const auto data = _index.data(Qt::DecorationRole).value<QImage>();
-        if (data.isNull())
+        const auto model = dynamic_cast<const EmojiViewItemModel*>(_index.model());
+        const auto emoji = model ? model->getEmoji(_index.column(), _index.row()) : nullptr;
+        if (!emoji)
             return;
 
         const int col = _index.column();
@@ -616,7 +617,7 @@ namespace Ui
             _painter->drawRoundedRect(itemRect, radius, radius);
         }
 
-        _painter->drawImage(imageRect, data);
+        Emoji::DrawEmoji(*_painter, emoji->fullCodePoints, int(getPickerEmojiSize()), imageRect);
     }
 
     QSize EmojiTableItemDelegate::sizeHint(const QStyleOptionViewItem&, const QModelIndex&) const
@@ -1749,7 +1750,7 @@ namespace Ui
         stickersView_->onStickerAdded();
     }
 
-    void RecentsWidget::addEmoji(Emoji::EmojiRecordSptr _emoji)
+    void RecentsWidget::addEmoji(Emoji::EmojiRecordPtr _emoji)
     {
         init();
 
@@ -2634,7 +2635,7 @@ namespace Ui
 
     void SmilesMenu::InitRecents()
     {
-        connect(recentsView_, &RecentsWidget::emojiSelected, this, [this](Emoji::EmojiRecordSptr _emoji, const QPoint _pos)
+        connect(recentsView_, &RecentsWidget::emojiSelected, this, [this](Emoji::EmojiRecordPtr _emoji, const QPoint _pos)
         {
             emit emojiSelected(_emoji->fullCodePoints, _pos);
         });
@@ -2991,7 +2992,7 @@ namespace Ui
 
         emojiButton->toggle();
 
-        connect(emojiView_, &EmojisWidget::emojiSelected, this, [this](Emoji::EmojiRecordSptr _emoji, const QPoint _pos)
+        connect(emojiView_, &EmojisWidget::emojiSelected, this, [this](Emoji::EmojiRecordPtr _emoji, const QPoint _pos)
         {
             emit emojiSelected(_emoji->fullCodePoints, _pos);
 
@@ -7,8 +7,8 @@ class QPushButton;
 namespace Emoji
 {
     struct EmojiRecord;
-    typedef std::shared_ptr<EmojiRecord> EmojiRecordSptr;
-    typedef std::vector<EmojiRecordSptr> EmojiRecordSptrVec;
+    typedef const EmojiRecord* EmojiRecordPtr;
+    typedef std::vector<EmojiRecordPtr> EmojiRecordVec;
     class EmojiCode;
 }
 
@@ -45,9 +45,9 @@ namespace Ui
         struct emoji_category
         {
             QString name_;
-            const Emoji::EmojiRecordSptrVec& emojis_;
+            const Emoji::EmojiRecordVec& emojis_;
 
-            emoji_category(const QString& _name, const Emoji::EmojiRecordSptrVec& _emojis)
+            emoji_category(const QString& _name, const Emoji::EmojiRecordVec& _emojis)
                 : name_(_name), emojis_(_emojis)
             {
             }
@@ -113,7 +113,7 @@ namespace Ui
 
             QModelIndex index(int _row, int _column, const QModelIndex& _parent = QModelIndex()) const override;
 
-            Emoji::EmojiRecordSptr getEmoji(int _col, int _row) const;
+            Emoji::EmojiRecordPtr getEmoji(int _col, int _row) const;
 
         private:
             int getLinearIndex(const int _row, const int _col) const;
@@ -177,7 +177,7 @@ namespace Ui
             int addCategory(const emoji_category& _category);
             int getCategoryPos(int _index);
             const std::vector<emoji_category>& getCategories() const;
-            Emoji::EmojiRecordSptr getEmoji(int _col, int _row) const;
+            Emoji::EmojiRecordPtr getEmoji(int _col, int _row) const;
             void onEmojiAdded();
 
             bool selectUp() override;
@@ -207,7 +207,7 @@ namespace Ui
             Q_OBJECT
 
         Q_SIGNALS:
-            void emojiSelected(Emoji::EmojiRecordSptr _emoji, const QPoint _pos);
+            void emojiSelected(Emoji::EmojiRecordPtr _emoji, const QPoint _pos);
             void scrollToGroup(const int _pos);
             void emojiMouseMoved(QPrivateSignal) const;
 
@@ -250,7 +250,7 @@ namespace Ui
             Q_OBJECT
 
         Q_SIGNALS:
-            void emojiSelected(Emoji::EmojiRecordSptr _emoji, const QPoint _pos);
+            void emojiSelected(Emoji::EmojiRecordPtr _emoji, const QPoint _pos);
             void stickerSelected(qint32 _setId, const QString& _stickerId);
             void stickerHovered(qint32 _setId, const QString& _stickerId);
             void stickerPreview(qint32 _setId, const QString& _stickerId);
@@ -267,7 +267,7 @@ namespace Ui
             void leaveEvent(QEvent* _e) override;
 
         private:
-            Emoji::EmojiRecordSptrVec emojis_;
+            Emoji::EmojiRecordVec emojis_;
 
             QVBoxLayout* vLayout_;
             EmojiTableView* emojiView_;
@@ -291,7 +291,7 @@ namespace Ui
             RecentsWidget(QWidget* _parent);
 
             void addSticker(int32_t _set_id, const QString& _stickerOd);
-            void addEmoji(Emoji::EmojiRecordSptr _emoji);
+            void addEmoji(Emoji::EmojiRecordPtr _emoji);
             void initEmojisFromSettings();
             void initStickersFromSettings();
             void onStickerUpdated(int32_t _setOd, const QString& _stickerOd);
@@ -0,0 +1,271 @@
+#include "stdafx.h"
+
+#include "PttStream.h"
+#include "MpegLoader.h"
+
+namespace
+{
+    // a chunk is a quarter of a second, enough to outlive the ptt timer tick
+    constexpr qint64 ChunksPerSecond = 4;
+    constexpr size_t MaxChunksAhead = 4;
+
+    int sampleSize(qint64 _format)
+    {
+        switch (_format)
+        {
+        case AL_FORMAT_MONO8:
+            return 1;
+        case AL_FORMAT_MONO16:
+        case AL_FORMAT_STEREO8:
+            return 2;
+        case AL_FORMAT_STEREO16:
+        default:
+            return 4;
+        }
+    }
+}
+
+namespace Ui
+{
+    struct PttStream::State
+    {
+        State(const QString& _file, std::unique_ptr<MpegLoader> _loader, qint64 _frequency, qint64 _format)
+            : file_(_file)
+            , loader_(std::move(_loader))
+            , chunkSamples_(std::max<qint64>(_frequency / ChunksPerSecond, 1))
+            , sampleSize_(sampleSize(_format))
+        {
+        }
+
+        const QString file_;
+
+        std::mutex mutex_;
+        PttStream* receiver_ = nullptr;
+        std::deque<Chunk> chunks_;
+        size_t startOffset_ = 0;
+        bool running_ = false;
+        bool decodeEnded_ = false;
+
+        std::atomic<uint64_t> generation_ = 0;
+        std::atomic<bool> cancelled_ = false;
+
+        // used by the running task only
+        std::unique_ptr<MpegLoader> loader_;
+        uint64_t loaderGeneration_ = 0;
+        qint64 loaderPosition_ = 0;
+        qint64 skipTo_ = 0;
+
+        const qint64 chunkSamples_;
+        const int sampleSize_;
+    };
+
+    namespace
+    {
+        class DecodeTask : public QRunnable
+        {
+        public:
+            explicit DecodeTask(std::shared_ptr<PttStream::State> _state)
+                : state_(std::move(_state))
+            {
+            }
+
+            void run() override
+            {
+                auto& state = *state_;
+
+                std::unique_lock lock(state.mutex_);
+                while (!state.cancelled_ && !state.decodeEnded_ && state.chunks_.size() < MaxChunksAhead)
+                {
+                    const uint64_t generation = state.generation_;
+                    const auto offset = state.startOffset_;
+                    lock.unlock();
+
+                    PttStream::Chunk chunk;
+                    const auto ended = !decodeChunk(generation, offset, chunk);
+
+                    lock.lock();
+                    if (generation != state.generation_)
+                        continue;
+
+                    if (chunk.samples_ > 0)
+                        state.chunks_.push_back(std::move(chunk));
+                    state.decodeEnded_ = ended;
+
+                    if (state.receiver_)
+                        QMetaObject::invokeMethod(state.receiver_, "onDecoded", Qt::QueuedConnection);
+                }
+                state.running_ = false;
+            }
+
+        private:
+            // false when the file is over, the last chunk can still have samples
+            bool decodeChunk(uint64_t _generation, size_t _offset, PttStream::Chunk& _chunk)
+            {
+                auto& state = *state_;
+
+                if (state.loaderGeneration_ != _generation)
+                {
+                    // a seek forward goes on with the same loader, a seek back has to read the file again
+                    if (!state.loader_ || state.loaderPosition_ > qint64(_offset))
+                    {
+                        state.loader_ = std::make_unique<MpegLoader>(state.file_, true);
+                        state.loaderPosition_ = 0;
+                        if (!state.loader_->open())
+                        {
+                            state.loader_.reset();
+                            return false;
+                        }
+                    }
+                    state.loaderGeneration_ = _generation;
+                    state.skipTo_ = qint64(_offset);
+                }
+
+                if (!state.loader_)
+                    return false;
+
+                QByteArray data;
+                while (data.size() / state.sampleSize_ < state.chunkSamples_)
+                {
+                    if (state.cancelled_ || state.generation_ != _generation)
+                        return true;
+
+                    const auto before = state.loaderPosition_;
+                    qint64 added = 0;
+                    if (state.loader_->readMore(data, added) < 0)
+                    {
+                        _chunk.samples_ = size_t(data.size() / state.sampleSize_);
+                        _chunk.data_ = std::move(data);
+                        return false;
+                    }
+                    state.loaderPosition_ += added;
+
+                    if (state.loaderPosition_ <= state.skipTo_)
+                        data.clear();
+                    else if (before < state.skipTo_)
+                        data.remove(0, int((state.skipTo_ - before) * state.sampleSize_));
+                }
+
+                _chunk.samples_ = size_t(data.size() / state.sampleSize_);
+                _chunk.data_ = std::move(data);
+                return true;
+            }
+
+            std::shared_ptr<PttStream::State> state_;
+        };
+    }
+
+    PttStream::PttStream(const QString& _file)
+        : file_(_file)
+        , frequency_(0)
+        , format_(0)
+        , durationSamples_(0)
+    {
+    }
+
+    PttStream::~PttStream()
+    {
+        if (state_)
+        {
+            std::scoped_lock lock(state_->mutex_);
+            state_->receiver_ = nullptr;
+            state_->cancelled_ = true;
+        }
+    }
+
+    bool PttStream::open()
+    {
+        auto loader = std::make_unique<MpegLoader>(file_, true);
+        if (!loader->open())
+            return false;
+
+        frequency_ = loader->frequency();
+        format_ = loader->format();
+        durationSamples_ = loader->duration();
+
+        state_ = std::make_shared<State>(file_, std::move(loader), frequency_, format_);
+        state_->receiver_ = this;
+
+        decodeMore();
+        return true;
+    }
+
+    qint64 PttStream::frequency() const noexcept
+    {
+        return frequency_;
+    }
+
+    qint64 PttStream::format() const noexcept
+    {
+        return format_;
+    }
+
+    std::chrono::milliseconds PttStream::duration() const noexcept
+    {
+        if (frequency_ <= 0 || durationSamples_ <= 0)
+            return std::chrono::milliseconds::zero();
+
+        return std::chrono::milliseconds(durationSamples_ * 1000 / frequency_);
+    }
+
+    void PttStream::seek(size_t _sampleOffset)
+    {
+        if (!state_)
+            return;
+
+        {
+            std::scoped_lock lock(state_->mutex_);
+            ++state_->generation_;
+            state_->startOffset_ = _sampleOffset;
+            state_->chunks_.clear();
+            state_->decodeEnded_ = false;
+        }
+
+        decodeMore();
+    }
+
+    std::optional<PttStream::Chunk> PttStream::take()
+    {
+        if (!state_)
+            return std::nullopt;
+
+        std::optional<Chunk> chunk;
+        {
+            std::scoped_lock lock(state_->mutex_);
+            if (state_->chunks_.empty())
+                return std::nullopt;
+
+            chunk = std::move(state_->chunks_.front());
+            state_->chunks_.pop_front();
+        }
+
+        decodeMore();
+        return chunk;
+    }
+
+    void PttStream::onDecoded()
+    {
+        emit decoded(QPrivateSignal());
+    }
+
+    bool PttStream::isEnded() const
+    {
+        if (!state_)
+            return true;
+
+        std::scoped_lock lock(state_->mutex_);
+        return state_->decodeEnded_ && state_->chunks_.empty();
+    }
+
+    void PttStream::decodeMore()
+    {
+        {
+            std::scoped_lock lock(state_->mutex_);
+            if (state_->running_ || state_->decodeEnded_ || state_->chunks_.size() >= MaxChunksAhead)
+                return;
+
+            state_->running_ = true;
+        }
+
+        QThreadPool::globalInstance()->start(new DecodeTask(state_));
+    }
+}
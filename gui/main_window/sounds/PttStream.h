@@ -0,0 +1,58 @@
+#pragma once
+
+namespace Ui
+{
+    // a voice message decoded by chunks for the playback from a queue of openal buffers.
+    // the chunks are decoded on the thread pool a few ahead of the playback, so only a couple of seconds of pcm are kept in memory.
+    // a seek drops the decoded chunks and restarts the decoding from the new offset
+    class PttStream : public QObject
+    {
+        Q_OBJECT
+
+    Q_SIGNALS:
+        // emitted on the gui thread when a chunk is ready or the decoding ended
+        void decoded(QPrivateSignal);
+
+    public:
+        struct Chunk
+        {
+            QByteArray data_;
+            size_t samples_ = 0;
+        };
+
+        explicit PttStream(const QString& _file);
+        ~PttStream();
+
+        // reads the header and starts the decoding from the beginning
+        bool open();
+
+        qint64 frequency() const noexcept;
+        qint64 format() const noexcept;
+
+        // by the header, zero if the file doesn't tell
+        std::chrono::milliseconds duration() const noexcept;
+
+        void seek(size_t _sampleOffset);
+
+        // the next chunk, nullopt if it isn't decoded yet
+        std::optional<Chunk> take();
+
+        // all the chunks are taken
+        bool isEnded() const;
+
+        struct State;
+
+    private Q_SLOTS:
+        void onDecoded();
+
+    private:
+        void decodeMore();
+
+        std::shared_ptr<State> state_;
+
+        QString file_;
+        qint64 frequency_;
+        qint64 format_;
+        qint64 durationSamples_;
+    };
+}
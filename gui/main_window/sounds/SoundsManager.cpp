@@ -10,6 +10,7 @@
 #endif
 
 #include "MpegLoader.h"
+#include "PttStream.h"
 
 namespace openal
 {
@@ -22,6 +23,7 @@ namespace
     constexpr int IncomingMessageInterval = 3000;
     constexpr int PttCheckInterval = 100;
     constexpr int DeviceCheckInterval = 60 * 1000;
+    constexpr int PttStreamBuffersCount = 4;
 
     QString getFilePath(Ui::SoundsManager::Sound _s)
     {
@@ -71,6 +73,13 @@ namespace Ui
         if (isEmpty())
             return std::chrono::milliseconds::zero();
 
+        if (Stream_)
+        {
+            StreamState_ = AL_PLAYING;
+            updateStream();
+            return Stream_->duration();
+        }
+
         auto duration = calcDuration();
         GetSoundsManager()->sourcePlay(Source_);
         return duration;
@@ -81,6 +90,9 @@ namespace Ui
         if (isEmpty())
             return;
 
+        if (Stream_)
+            StreamState_ = AL_PAUSED;
+
         openal::alSourcePause(Source_);
     }
 
@@ -90,6 +102,9 @@ namespace Ui
             return;
 
         openal::alSourceStop(Source_);
+        if (Stream_)
+            releaseStream();
+
         if (openal::alIsBuffer(Buffer_))
         {
             openal::alSourcei(Source_, AL_BUFFER, 0);
@@ -102,6 +117,13 @@ namespace Ui
         Buffer_ = 0;
         Source_ = 0;
         Id_ = -1;
+
+        Stream_.reset();
+        StreamBuffers_.clear();
+        FreeBuffers_.clear();
+        QueuedSamples_.clear();
+        StreamOffset_ = 0;
+        StreamState_ = AL_INITIAL;
     }
 
     void PlayingData::free()
@@ -147,6 +169,9 @@ namespace Ui
         openal::ALenum state = AL_NONE;
         if (!isEmpty())
         {
+            if (Stream_)
+                return StreamState_;
+
             openal::alGetSourcei(Source_, AL_SOURCE_STATE, &state);
         }
         return state;
@@ -156,12 +181,117 @@ namespace Ui
     {
         openal::ALint sampleOffset;
         openal::alGetSourcei(Source_, AL_SAMPLE_OFFSET, &sampleOffset);
-        return size_t(sampleOffset);
+        if (!Stream_)
+            return size_t(sampleOffset);
+
+        // a stopped source has played all the queued buffers but reports zero
+        openal::ALenum sourceState = AL_NONE;
+        openal::alGetSourcei(Source_, AL_SOURCE_STATE, &sourceState);
+        if (sourceState == AL_STOPPED)
+            return StreamOffset_ + std::accumulate(QueuedSamples_.begin(), QueuedSamples_.end(), size_t(0));
+
+        return StreamOffset_ + size_t(sampleOffset);
     }
 
     void PlayingData::setCurrentSampleOffset(size_t _offset)
     {
-        openal::alSourcei(Source_, AL_SAMPLE_OFFSET, openal::ALint(_offset));
+        if (!Stream_)
+        {
+            openal::alSourcei(Source_, AL_SAMPLE_OFFSET, openal::ALint(_offset));
+            return;
+        }
+
+        openal::ALenum sourceState = AL_NONE;
+        openal::alGetSourcei(Source_, AL_SOURCE_STATE, &sourceState);
+
+        const auto queued = std::accumulate(QueuedSamples_.begin(), QueuedSamples_.end(), size_t(0));
+        if (sourceState != AL_STOPPED && _offset >= StreamOffset_ && _offset < StreamOffset_ + queued)
+        {
+            openal::alSourcei(Source_, AL_SAMPLE_OFFSET, openal::ALint(_offset - StreamOffset_));
+            return;
+        }
+
+        // the offset isn't decoded, the buffers are dropped and the decoder starts over from it
+        openal::alSourceStop(Source_);
+        openal::alSourcei(Source_, AL_BUFFER, 0);
+        FreeBuffers_ = StreamBuffers_;
+        QueuedSamples_.clear();
+        StreamOffset_ = _offset;
+        Stream_->seek(_offset);
+        updateStream();
+    }
+
+    void PlayingData::setStream(std::shared_ptr<PttStream> _stream)
+    {
+        Stream_ = std::move(_stream);
+        StreamBuffers_.resize(PttStreamBuffersCount);
+        openal::alGenBuffers(PttStreamBuffersCount, StreamBuffers_.data());
+        FreeBuffers_ = StreamBuffers_;
+        QueuedSamples_.clear();
+        StreamOffset_ = 0;
+        StreamState_ = AL_INITIAL;
+    }
+
+    bool PlayingData::isStreaming() const
+    {
+        return !!Stream_;
+    }
+
+    void PlayingData::updateStream()
+    {
+        if (!Stream_)
+            return;
+
+        openal::ALint processed = 0;
+        openal::alGetSourcei(Source_, AL_BUFFERS_PROCESSED, &processed);
+        for (; processed > 0 && !QueuedSamples_.empty(); --processed)
+        {
+            openal::ALuint buffer = 0;
+            openal::alSourceUnqueueBuffers(Source_, 1, &buffer);
+            StreamOffset_ += QueuedSamples_.front();
+            QueuedSamples_.pop_front();
+            FreeBuffers_.push_back(buffer);
+        }
+
+        while (!FreeBuffers_.empty())
+        {
+            auto chunk = Stream_->take();
+            if (!chunk)
+                break;
+
+            const auto buffer = FreeBuffers_.back();
+            FreeBuffers_.pop_back();
+            openal::alBufferData(buffer, Stream_->format(), chunk->data_.constData(), chunk->data_.size(), Stream_->frequency());
+            openal::alSourceQueueBuffers(Source_, 1, &buffer);
+            QueuedSamples_.push_back(chunk->samples_);
+        }
+
+        if (StreamState_ != AL_PLAYING)
+            return;
+
+        openal::ALenum sourceState = AL_NONE;
+        openal::alGetSourcei(Source_, AL_SOURCE_STATE, &sourceState);
+        if (sourceState == AL_PLAYING)
+            return;
+
+        // the first buffer is ready or the decoder has caught up
+        if (!QueuedSamples_.empty())
+            GetSoundsManager()->sourcePlay(Source_);
+        else if (Stream_->isEnded())
+            StreamState_ = AL_STOPPED;
+    }
+
+    void PlayingData::releaseStream()
+    {
+        openal::alSourcei(Source_, AL_BUFFER, 0);
+        openal::alDeleteBuffers(openal::ALsizei(StreamBuffers_.size()), StreamBuffers_.data());
+
+        Stream_.reset();
+        StreamBuffers_.clear();
+        FreeBuffers_.clear();
+        QueuedSamples_.clear();
+        StreamOffset_ = 0;
+        StreamState_ = AL_INITIAL;
     }
 
     SoundsManager::SoundsManager()
@@ -373,6 +503,17 @@ namespace Ui
         return CurPlay_.Id_;
     }
 
+    int SoundsManager::playPttStream(std::shared_ptr<PttStream> _stream, int& duration)
+    {
+        connect(_stream.get(), &PttStream::decoded, this, &SoundsManager::pttDecoded);
+        CurPlay_.setStream(std::move(_stream));
+
+        CurPlay_.Id_ = ++AlId;
+        duration = CurPlay_.play().count();
+        PttTimer_->start();
+        return CurPlay_.Id_;
+    }
+
     void SoundsManager::initPlayingData(PlayingData& _data, const QString& _file)
     {
         if (!AlInited_)
@@ -441,7 +582,16 @@ namespace Ui
         if (CurPlay_.Source_ != 0)
         {
             openal::ALenum state;
-            openal::alGetSourcei(CurPlay_.Source_, AL_SOURCE_STATE, &state);
+            if (CurPlay_.isStreaming())
+            {
+                CurPlay_.updateStream();
+                state = CurPlay_.state();
+            }
+            else
+            {
+                openal::alGetSourcei(CurPlay_.Source_, AL_SOURCE_STATE, &state);
+            }
+
             if (state == AL_PLAYING || state == AL_INITIAL)
             {
                 PttTimer_->start();
@@ -473,6 +623,12 @@ namespace Ui
         }
     }
 
+    void SoundsManager::pttDecoded()
+    {
+        CurPlay_.updateStream();
+        PrevPlay_.updateStream();
+    }
+
     void SoundsManager::deviceTimeOut()
     {
         if (CurPlay_.state() == AL_PLAYING)
@@ -486,6 +642,10 @@ namespace Ui
         if (auto res = checkPlayPtt(id, duration, std::nullopt); res)
             return *res;
 
+        // the whole file is decoded only if the header has no duration to show the progress against
+        if (auto stream = std::make_shared<PttStream>(file); stream->open() && stream->duration().count() > 0)
+            return playPttStream(std::move(stream), duration);
+
         if (auto res = getBuffer(file); res)
         {
             const auto& data = (*res).data;
@@ -4,6 +4,8 @@
 
 namespace Ui
 {
+    class PttStream;
+
     struct PlayingData
     {
         PlayingData()
@@ -32,9 +34,28 @@ namespace Ui
         size_t currentSampleOffset() const;
         void setCurrentSampleOffset(size_t _offset);
 
+        // plays _stream from a ring of buffers instead of the single Buffer_
+        void setStream(std::shared_ptr<PttStream> _stream);
+        bool isStreaming() const;
+
+        // recycles the played buffers and queues the decoded chunks
+        void updateStream();
+
         openal::ALuint Source_;
         openal::ALuint Buffer_;
         int Id_;
+
+    private:
+        void releaseStream();
+
+        std::shared_ptr<PttStream> Stream_;
+        std::vector<openal::ALuint> StreamBuffers_;
+        std::vector<openal::ALuint> FreeBuffers_;
+        std::deque<size_t> QueuedSamples_;
+        // the samples of the unqueued buffers, relative to them is AL_SAMPLE_OFFSET
+        size_t StreamOffset_ = 0;
+        // the state of the playback, the source stops when the decoder falls behind
+        openal::ALenum StreamState_ = AL_INITIAL;
     };
 
     class SoundsManager : public QObject, device::DeviceMonitoringCallback
@@ -93,6 +114,7 @@ Q_SIGNALS:
         void checkPttState();
         void contactChanged(const QString&);
         void deviceTimeOut();
+        void pttDecoded();
 
         void initOpenAl();
         void shutdownOpenAl();
@@ -110,6 +132,7 @@ Q_SIGNALS:
         std::optional<int> checkPlayPtt(int id, int& duration, const std::optional<size_t>& sampleOffset);
         std::optional<PttBuffer> getBuffer(const QString& file);
         int playPttImpl(const char* data, size_t size, qint64 freq, qint64 fmt, int& duration, size_t sampleOffset);
+        int playPttStream(std::shared_ptr<PttStream> _stream, int& duration);
         void initPlayingData(PlayingData& _data, const QString& _file);
 
         void initSounds();
@@ -3,6 +3,7 @@
 #include "AmplitudeCalc.h"
 #include "AudioRecorder2.h"
 #include "AudioUtils.h"
+#include "Waveform.h"
 
 namespace ptt
 {
@@ -27,7 +28,7 @@ namespace ptt
             const auto last = first + sampleBlockSizeForHist();
             pos_ += sampleBlockSizeForHist() * sizeof(valueType);
 
-            const auto maxAmpl = std::abs(*std::max_element(first, last, [](auto l, auto r) { return std::abs(l) < std::abs(r); })) * 1.5;
+            const auto maxAmpl = peakAmplitude(first, last) * 1.5;
 
             res.push_back(double(maxAmpl) / std::numeric_limits<std::make_signed_t<valueType>>::max() / 2.0);
         }
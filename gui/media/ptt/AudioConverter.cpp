@@ -82,7 +82,7 @@ static int open_input_file(const char *filename,
  * Some of these parameters are based on the input file's parameters.
  */
 static int open_output_file(const char *filename,
-    AVCodecContext *input_codec_context,
+    const int sample_rate,
     AVFormatContext **output_format_context,
     AVCodecContext **output_codec_context)
 {
@@ -131,7 +131,7 @@ static int open_output_file(const char *filename,
      */
     (*output_codec_context)->channels = OUTPUT_CHANNELS;
     (*output_codec_context)->channel_layout = av_get_default_channel_layout(OUTPUT_CHANNELS);
-    (*output_codec_context)->sample_rate = input_codec_context->sample_rate;
+    (*output_codec_context)->sample_rate = sample_rate;
     (*output_codec_context)->sample_fmt = AV_SAMPLE_FMT_FLTP;
     (*output_codec_context)->bit_rate = OUTPUT_BIT_RATE;
     /**
@@ -613,7 +613,7 @@ static AacResult convertPcmToAac(const QByteArray& _wavData, int sampleRate, int
         &input_codec_context, inputAvFormat))
         goto cleanup;
     /** Open the output file for writing. */
-    if (open_output_file(tmpAacName.toUtf8().constData(), input_codec_context,
+    if (open_output_file(tmpAacName.toUtf8().constData(), input_codec_context->sample_rate,
         &output_format_context, &output_codec_context))
         goto cleanup;
     /** Initialize the resampler to be able to convert audio sample formats. */
@@ -735,4 +735,123 @@ namespace ptt
             emit error(QPrivateSignal());
         }
     }
-}
\ No newline at end of file
+}
+
+namespace ptt
+{
+    AacEncoder::AacEncoder(int _sampleRate, int _channelsCount)
+        : sampleRate_(_sampleRate)
+        , channelsCount_(_channelsCount)
+    {
+    }
+
+    AacEncoder::~AacEncoder()
+    {
+        close();
+        if (!fileName_.isEmpty())
+            QFile::remove(fileName_);
+    }
+
+    bool AacEncoder::open()
+    {
+        av_register_all();
+
+        fileName_ = getTmpFileName();
+        if (open_output_file(fileName_.toUtf8().constData(), sampleRate_, &formatContext_, &codecContext_))
+            return false;
+
+        resampleContext_ = swr_alloc_set_opts(NULL,
+            av_get_default_channel_layout(codecContext_->channels),
+            codecContext_->sample_fmt,
+            codecContext_->sample_rate,
+            av_get_default_channel_layout(channelsCount_),
+            AV_SAMPLE_FMT_S16,
+            sampleRate_,
+            0, NULL);
+        if (!resampleContext_ || swr_init(resampleContext_) < 0)
+            return false;
+
+        if (init_fifo(&fifo_))
+            return false;
+
+        return write_output_file_header(formatContext_) == 0;
+    }
+
+    bool AacEncoder::write(const char* _data, size_t _size)
+    {
+        const int frameSize = int(_size / (sizeof(int16_t) * channelsCount_));
+        if (frameSize <= 0)
+            return true;
+
+        uint8_t** converted = NULL;
+        if (init_converted_samples(&converted, codecContext_, frameSize))
+            return false;
+
+        const uint8_t* input[] = { reinterpret_cast<const uint8_t*>(_data) };
+        const auto added = !convert_samples(input, converted, frameSize, resampleContext_) && !add_samples_to_fifo(fifo_, converted, frameSize);
+
+        av_freep(&converted[0]);
+        free(converted);
+
+        if (!added)
+            return false;
+
+        pcmSize_ += size_t(frameSize) * sizeof(int16_t) * channelsCount_;
+
+        // the tail shorter than a frame waits for the next write or finish()
+        while (av_audio_fifo_size(fifo_) >= codecContext_->frame_size)
+        {
+            if (load_encode_and_write(fifo_, formatContext_, codecContext_))
+                return false;
+        }
+        return true;
+    }
+
+    QString AacEncoder::finish()
+    {
+        while (av_audio_fifo_size(fifo_) > 0)
+        {
+            if (load_encode_and_write(fifo_, formatContext_, codecContext_))
+                return QString();
+        }
+
+        int dataWritten = 0;
+        do
+        {
+            if (encode_audio_frame(NULL, formatContext_, codecContext_, &dataWritten))
+                return QString();
+        } while (dataWritten);
+
+        if (write_output_file_trailer(formatContext_))
+            return QString();
+
+        close();
+        return std::exchange(fileName_, QString());
+    }
+
+    size_t AacEncoder::pcmSize() const noexcept
+    {
+        return pcmSize_;
+    }
+
+    void AacEncoder::close()
+    {
+        if (fifo_)
+        {
+            av_audio_fifo_free(fifo_);
+            fifo_ = NULL;
+        }
+        swr_free(&resampleContext_);
+        if (codecContext_)
+        {
+            avcodec_close(codecContext_);
+            codecContext_ = NULL;
+        }
+        if (formatContext_)
+        {
+            avio_close(formatContext_->pb);
+            avformat_free_context(formatContext_);
+            formatContext_ = NULL;
+        }
+    }
+}
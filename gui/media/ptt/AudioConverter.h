@@ -1,5 +1,10 @@
 #pragma once
 
+struct AVFormatContext;
+struct AVCodecContext;
+struct SwrContext;
+struct AVAudioFifo;
+
 namespace ptt
 {
     class ConvertTask
@@ -25,4 +30,39 @@ namespace ptt
         const int channelsCount_;
         const int bitesPerSample_;
     };
-}
\ No newline at end of file
+
+    // encodes the pcm while it is recorded, so only the last frame is left to encode when the recording stops.
+    // the adts stream is written to the file as it goes
+    class AacEncoder
+    {
+    public:
+        AacEncoder(int _sampleRate, int _channelsCount);
+
+        // removes the file unless it was finished
+        ~AacEncoder();
+
+        bool open();
+
+        // 16-bit samples of _channelsCount channels
+        bool write(const char* _data, size_t _size);
+
+        // encodes the rest and closes the file, empty on error
+        QString finish();
+
+        // the bytes of pcm taken by write()
+        size_t pcmSize() const noexcept;
+
+    private:
+        void close();
+
+        const int sampleRate_;
+        const int channelsCount_;
+        size_t pcmSize_ = 0;
+        QString fileName_;
+
+        AVFormatContext* formatContext_ = nullptr;
+        AVCodecContext* codecContext_ = nullptr;
+        SwrContext* resampleContext_ = nullptr;
+        AVAudioFifo* fifo_ = nullptr;
+    };
+}
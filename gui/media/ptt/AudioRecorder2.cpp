@@ -221,6 +221,8 @@ namespace ptt
             buffer_.append(reinterpret_cast<const char*>(internalBuffer_.data()), sample * sizeof(openal::ALCushort) * channelsCount());
             if (auto v = fft_->getSamples(); !v.isEmpty())
                 emit spectrum(v, contact_, QPrivateSignal());
+
+            encodePcm();
         }
         catch (const std::bad_alloc&)
         {
@@ -259,6 +261,51 @@ namespace ptt
         setDurationImpl(std::chrono::seconds::zero());
 
         fft_->reset();
+
+        encoder_.reset();
+        encoderFailed_ = false;
+    }
+
+    void AudioRecorder2::encodePcm()
+    {
+        assert(!inGuiThread());
+
+        if (encoderFailed_)
+            return;
+
+        // a new encoder catches up with the whole buffer
+        if (!encoder_)
+        {
+            encoder_ = std::make_unique<AacEncoder>(rate(), channelsCount());
+            if (!encoder_->open())
+            {
+                encoder_.reset();
+                encoderFailed_ = true;
+                return;
+            }
+        }
+
+        const auto encoded = getWavHeaderSize() + encoder_->pcmSize();
+        if (size_t(buffer_.size()) <= encoded)
+            return;
+
+        if (!encoder_->write(buffer_.constData() + encoded, buffer_.size() - encoded))
+        {
+            qCDebug(pttLog) << "encoder failed, the wav is converted after the recording";
+            encoder_.reset();
+            encoderFailed_ = true;
+        }
+    }
+
+    QString AudioRecorder2::finishEncoding()
+    {
+        encodePcm();
+        if (!encoder_)
+            return QString();
+
+        auto file = encoder_->finish();
+        encoder_.reset();
+        return file;
     }
 
     bool AudioRecorder2::insertWavHeader()
@@ -390,7 +437,19 @@ namespace ptt
         assert(!inGuiThread());
 
         if ((currentDurationImpl() >= minDuration_) && insertWavHeader())
-            emit dataReady(buffer_, contact_, _statInfo, QPrivateSignal());
+        {
+            if (const auto aacFile = finishEncoding(); !aacFile.isEmpty())
+            {
+                const auto realDuration = calculateDuration(buffer_.size() - getWavHeaderSize(), rate(), channelsCount(), bitesPerSample());
+                auto stat = _statInfo;
+                stat.duration = std::max(std::chrono::duration_cast<std::chrono::seconds>(realDuration), std::chrono::seconds(1));
+                emit aacReady(contact_, aacFile, stat.duration, stat, QPrivateSignal());
+            }
+            else
+            {
+                emit dataReady(buffer_, contact_, _statInfo, QPrivateSignal());
+            }
+        }
     }
 
     void AudioRecorder2::getPcmDataImpl()
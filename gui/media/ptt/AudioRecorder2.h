@@ -3,6 +3,7 @@
 namespace ptt
 {
     class AmplitudeCalc;
+    class AacEncoder;
     struct Buffer;
     struct StatInfo;
 
@@ -86,6 +87,9 @@ namespace ptt
         void onTimer();
         void resetBuffer();
 
+        void encodePcm();
+        QString finishEncoding();
+
         bool insertWavHeader();
 
         bool needReinit() const noexcept;
@@ -114,5 +118,9 @@ namespace ptt
         bool needReinitDevice_ = true;
         std::string deviceName_;
         std::unique_ptr<AmplitudeCalc> fft_;
+
+        // keeps up with buffer_, null if it has failed and the wav is converted after the recording
+        std::unique_ptr<AacEncoder> encoder_;
+        bool encoderFailed_ = false;
     };
 }
\ No newline at end of file
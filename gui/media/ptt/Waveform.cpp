@@ -0,0 +1,178 @@
+#include "stdafx.h"
+
+#include "Waveform.h"
+
+#include "../../core_dispatcher.h"
+#include "../../main_window/sounds/MpegLoader.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define PTT_WAVEFORM_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace
+{
+    // the envelope is first taken by 10ms blocks, then the blocks are merged into the bars
+    constexpr int envelopeBlocksPerSecond = 100;
+
+    QByteArray makeBars(const std::vector<int>& _envelope)
+    {
+        QByteArray bars;
+        if (_envelope.empty())
+            return bars;
+
+        bars.resize(ptt::waveformSize());
+
+        const auto blocks = _envelope.size();
+        for (int i = 0; i < ptt::waveformSize(); ++i)
+        {
+            const auto first = i * blocks / ptt::waveformSize();
+            const auto last = std::max(first + 1, (i + 1) * blocks / ptt::waveformSize());
+            const auto peak = *std::max_element(_envelope.begin() + first, _envelope.begin() + last);
+
+            // the square root scale leaves the quiet messages some resolution in a byte
+            const auto value = std::lround(255. * std::sqrt(double(peak) / std::numeric_limits<int16_t>::max()));
+            bars[i] = char(std::clamp<long>(value, 0, 255));
+        }
+        return bars;
+    }
+}
+
+namespace ptt
+{
+    int peakAmplitude(const int16_t* _first, const int16_t* _last) noexcept
+    {
+        int16_t hi = 0;
+        int16_t lo = 0;
+        auto it = _first;
+
+#ifdef PTT_WAVEFORM_SSE2
+        if (_last - it >= 8)
+        {
+            auto vhi = _mm_setzero_si128();
+            auto vlo = _mm_setzero_si128();
+            for (; _last - it >= 8; it += 8)
+            {
+                const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+                vhi = _mm_max_epi16(vhi, v);
+                vlo = _mm_min_epi16(vlo, v);
+            }
+
+            alignas(16) int16_t his[8];
+            alignas(16) int16_t los[8];
+            _mm_store_si128(reinterpret_cast<__m128i*>(his), vhi);
+            _mm_store_si128(reinterpret_cast<__m128i*>(los), vlo);
+            hi = *std::max_element(std::begin(his), std::end(his));
+            lo = *std::min_element(std::begin(los), std::end(los));
+        }
+#endif
+
+        for (; it != _last; ++it)
+        {
+            hi = std::max(hi, *it);
+            lo = std::min(lo, *it);
+        }
+
+        return std::min(std::max(int(hi), -int(lo)), int(std::numeric_limits<int16_t>::max()));
+    }
+
+    WaveformTask::WaveformTask(const QString& _url, const QString& _file)
+        : QObject(nullptr)
+        , url_(_url)
+        , file_(_file)
+    {
+    }
+
+    void WaveformTask::run()
+    {
+        emit ready(url_, extract(), QPrivateSignal());
+    }
+
+    QByteArray WaveformTask::extract() const
+    {
+        Ui::MpegLoader loader(file_, true);
+        if (!loader.open())
+            return QByteArray();
+
+        const auto format = loader.format();
+        if (format != AL_FORMAT_MONO16 && format != AL_FORMAT_STEREO16)
+            return QByteArray();
+
+        const auto channels = (format == AL_FORMAT_STEREO16) ? 2 : 1;
+        const auto blockSize = std::max(1, loader.frequency() * channels / envelopeBlocksPerSecond);
+
+        std::vector<int> envelope;
+        if (const auto duration = loader.duration(); duration > 0)
+            envelope.reserve(size_t(duration * envelopeBlocksPerSecond / std::max(loader.frequency(), 1) + 1));
+
+        // only the samples of the last unfinished block are kept
+        QByteArray pcm;
+        qint64 samplesAdded = 0;
+        while (loader.readMore(pcm, samplesAdded) >= 0)
+        {
+            const auto samples = reinterpret_cast<const int16_t*>(pcm.constData());
+            const auto count = int(pcm.size() / sizeof(int16_t));
+
+            int offset = 0;
+            for (; count - offset >= blockSize; offset += blockSize)
+                envelope.push_back(peakAmplitude(samples + offset, samples + offset + blockSize));
+
+            if (offset > 0)
+                pcm.remove(0, offset * int(sizeof(int16_t)));
+        }
+
+        if (const auto count = int(pcm.size() / sizeof(int16_t)); count > 0)
+        {
+            const auto samples = reinterpret_cast<const int16_t*>(pcm.constData());
+            envelope.push_back(peakAmplitude(samples, samples + count));
+        }
+
+        return makeBars(envelope);
+    }
+
+    WaveformLoader::WaveformLoader(QObject* _parent)
+        : QObject(_parent)
+    {
+    }
+
+    void WaveformLoader::request(const QString& _url, const QString& _file)
+    {
+        assert(!_url.isEmpty());
+
+        if (_file.isEmpty() || inProgress_.contains(_url) || computed_.contains(_url))
+            return;
+
+        inProgress_.insert(_url);
+
+        auto task = new WaveformTask(_url, _file);
+        QObject::connect(task, &WaveformTask::ready, this, &WaveformLoader::onReady);
+        QThreadPool::globalInstance()->start(task);
+    }
+
+    QByteArray WaveformLoader::waveform(const QString& _url) const
+    {
+        return computed_.value(_url);
+    }
+
+    void WaveformLoader::onReady(const QString& _url, const QByteArray& _waveform)
+    {
+        inProgress_.remove(_url);
+        computed_.insert(_url, _waveform);
+
+        if (_waveform.isEmpty())
+            return;
+
+        Ui::GetDispatcher()->setFileSharingWaveform(_url, _waveform);
+
+        emit waveformReady(_url, _waveform, QPrivateSignal());
+    }
+
+    WaveformLoader& getWaveformLoader()
+    {
+        static QPointer<WaveformLoader> loader;
+        if (!loader)
+            loader = new WaveformLoader(qApp);
+
+        return *loader;
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+namespace ptt
+{
+    // the bars of a stored waveform, one byte each
+    constexpr int waveformSize() noexcept { return 64; }
+
+    // the largest magnitude in [_first, _last), -32768 counts as 32767
+    int peakAmplitude(const int16_t* _first, const int16_t* _last) noexcept;
+
+    class WaveformTask
+        : public QObject
+        , public QRunnable
+    {
+        Q_OBJECT
+
+    Q_SIGNALS:
+        // _waveform is empty if the file can't be decoded
+        void ready(const QString& _url, const QByteArray& _waveform, QPrivateSignal) const;
+
+    public:
+        WaveformTask(const QString& _url, const QString& _file);
+
+        void run() override;
+
+    private:
+        QByteArray extract() const;
+
+        const QString url_;
+        const QString file_;
+    };
+
+    // computes the waveforms of the downloaded voice messages on the thread pool.
+    // a waveform is stored by core with the file sharing metainfo, so a message is decoded for it only once
+    class WaveformLoader : public QObject
+    {
+        Q_OBJECT
+
+    Q_SIGNALS:
+        void waveformReady(const QString& _url, const QByteArray& _waveform, QPrivateSignal) const;
+
+    public:
+        explicit WaveformLoader(QObject* _parent);
+
+        void request(const QString& _url, const QString& _file);
+
+        // computed in this session and possibly not in the metainfo yet, empty if none
+        QByteArray waveform(const QString& _url) const;
+
+    private:
+        void onReady(const QString& _url, const QByteArray& _waveform);
+
+        QSet<QString> inProgress_;
+        // the failed files are kept empty, so they aren't decoded again
+        QHash<QString, QByteArray> computed_;
+    };
+
+    WaveformLoader& getWaveformLoader();
+}
@@ -213,27 +213,7 @@ Memory_Stats::MemoryStatsReport GuiMemoryMonitor::getEmojisReport()
 
 Memory_Stats::MemoryStatsReport GuiMemoryMonitor::getStickersReport()
 {
-    qint64 total = 0;
-
-    auto calcStickers = [&total](const Ui::Stickers::setsMap& _stickerSets)
-    {
-        for (const auto& it: _stickerSets)
-        {
-            Ui::Stickers::setSptr set = it.second;
-            auto stickersMap = set->getStickersTree();
-            for (const auto& sticker: stickersMap)
-            {
-                const auto &stickerImgs = sticker.second->getImages();
-                for (const auto &stickerImgIt: stickerImgs)
-                {
-                    total += Utils::getMemoryFootprint(std::get<0>(stickerImgIt.second));
-                }
-            }
-        }
-    };
-
-    calcStickers(Ui::Stickers::getSetsTree());
-    calcStickers(Ui::Stickers::getStoreTree());
+    const qint64 total = Ui::Stickers::getImagesFootprint();
 
     Memory_Stats::MemoryStatsReport report(ReporteeName,
                                            total,
@@ -15,6 +15,7 @@ namespace Logic
     {
         connect(Ui::GetDispatcher(), &Ui::core_dispatcher::searchedMessagesLocal, this, &MessageSearcher::onLocalResults);
         connect(Ui::GetDispatcher(), &Ui::core_dispatcher::searchedMessagesLocalEmptyResult, this, &MessageSearcher::onEmptyLocalResults);
+        connect(Ui::GetDispatcher(), &Ui::core_dispatcher::searchedMessagesLocalFinished, this, &MessageSearcher::onLocalFinished);
         connect(Ui::GetDispatcher(), &Ui::core_dispatcher::searchedMessagesServer, this, &MessageSearcher::onServerResults);
     }
 
@@ -92,7 +93,7 @@ namespace Logic
 
     void MessageSearcher::onLocalResults(const Data::SearchResultsV& _localResults, const qint64 _reqId)
     {
-        if (_reqId != localReqId_)
+        if (localReqId_ == -1 || _reqId != localReqId_)
             return;
 
         const auto singleSearchRes = isSearchInSingleDialog();
@@ -104,7 +105,23 @@ namespace Logic
 
         qCDebug(messageSearcher) << "got" << _localResults.size() << "items from local";
 
+        // a part of the results, the scan goes on until onLocalFinished
         emit localResults();
+    }
+
+    void MessageSearcher::onLocalFinished(const qint64 _reqId)
+    {
+        if (localReqId_ == -1 || _reqId != localReqId_)
+            return;
+
+        qCDebug(messageSearcher) << "local search finished with" << localResults_.size() << "items";
+
+        localSearchReturned();
+    }
+
+    void MessageSearcher::localSearchReturned()
+    {
+        localReqId_ = -1;
         onRequestReturned();
     }
 
@@ -138,13 +155,13 @@ namespace Logic
 
     void MessageSearcher::onEmptyLocalResults(const qint64 _reqId)
     {
-        if (_reqId != localReqId_)
+        if (localReqId_ == -1 || _reqId != localReqId_)
             return;
 
         qCDebug(messageSearcher) << "local results empty";
 
         emit localResults();
-        onRequestReturned();
+        localSearchReturned();
     }
 
     void MessageSearcher::onServerResults(const Data::SearchResultsV& _serverResults, const QString& _cursorNext, const int _totalEntries, const qint64 _reqId)
@@ -13,6 +13,7 @@ namespace Logic
     private Q_SLOTS:
        void onLocalResults(const Data::SearchResultsV& _localResults, const qint64 _reqId);
        void onEmptyLocalResults(const qint64 _reqId);
+       void onLocalFinished(const qint64 _reqId);
        void onServerResults(const Data::SearchResultsV& _serverResults, const QString& _cursorNext, const int _totalEntries, const qint64 _reqId);
 
    public:
@@ -46,6 +47,8 @@ namespace Logic
 
        void onServerTimedOut() override;
 
+       void localSearchReturned();
+
        QString dialogAimid_;
        QString cursorNext_;
        int totalServerEntries_;
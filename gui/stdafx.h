@@ -142,6 +142,7 @@
 #include <QFileDialog>
 #include <QTextDocumentFragment>
 #include <QPixmapCache>
+#include <QCache>
 #include <QTextBrowser>
 #include <QClipboard>
 #include <QGraphicsOpacityEffect>
@@ -63,25 +63,6 @@ namespace Data
         }
     }
 
-    bool UnserializeAvatar(core::coll_helper* helper, QPixmap& _avatar)
-    {
-        if (helper->get_value_as_bool("result"))
-        {
-            core::istream* stream = helper->get_value_as_stream("avatar");
-            if (stream)
-            {
-                uint32_t size = stream->size();
-
-                _avatar.loadFromData(stream->read(size), size);
-
-                stream->reset();
-            }
-            return true;
-        }
-
-        return false;
-    }
-
     BuddyPtr UnserializePresence(core::coll_helper* helper)
     {
         auto result = std::make_shared<Buddy>();
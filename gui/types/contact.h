@@ -248,8 +248,6 @@ namespace Data
 
     void UnserializeContactList(core::coll_helper* helper, ContactList& cl, QString& type);
 
-    bool UnserializeAvatar(core::coll_helper* helper, QPixmap& _avatar);
-
     BuddyPtr UnserializePresence(core::coll_helper* helper);
 
     QString UnserializeActiveDialogHide(core::coll_helper* helper);
@@ -14,6 +14,7 @@ struct FileSharingMeta
     bool savedByUser_;
     bool recognize_;
     bool gotAudio_;
+    QByteArray waveform_; // ptt only, 8-bit peaks, empty until the gui has computed them once
 };
 
 }
@@ -8,6 +8,7 @@
 #include "../utils/log/log.h"
 #include "../utils/UrlParser.h"
 #include "../utils/utils.h"
+#include "../../common.shared/message_processing/message_tokenizer.h"
 
 #include "../main_window/history_control/FileSharingInfo.h"
 #include "../main_window/history_control/StickerInfo.h"
@@ -619,6 +620,7 @@ namespace Data
     void MessageBuddy::SetText(const QString &text)
     {
         Text_ = text;
+        TextSpans_.reset();
     }
 
     void MessageBuddy::SetTime(const qint32 time)
@@ -807,6 +809,13 @@ namespace Data
     }
 
     MessagesResult UnserializeMessageBuddies(core::coll_helper* helper, const QString &myAimid)
+    {
+        auto result = DecodeMessageBuddies(helper, myAimid);
+        resolveNames(result);
+        return result;
+    }
+
+    MessagesResult DecodeMessageBuddies(core::coll_helper* helper, const QString &myAimid)
     {
         assert(!myAimid.isEmpty());
 
@@ -825,26 +834,26 @@ namespace Data
             if (helper->is_value_exist("messages"))
             {
                 auto msgArray = helper->get_value_as_array("messages");
-                unserializeMessages(msgArray, aimId, myAimid, theirs_last_delivered, theirs_last_read, Out messages);
+                decodeMessages(msgArray, aimId, myAimid, theirs_last_delivered, theirs_last_read, Out messages);
             }
 
             if (helper->is_value_exist("pending_messages"))
             {
                 havePending = true;
                 auto msgArray = helper->get_value_as_array("pending_messages");
-                unserializeMessages(msgArray, aimId, myAimid, theirs_last_delivered, theirs_last_read, Out messages);
+                decodeMessages(msgArray, aimId, myAimid, theirs_last_delivered, theirs_last_read, Out messages);
             }
 
             if (helper->is_value_exist("intro_messages"))
             {
                 auto introArray = helper->get_value_as_array("intro_messages");
-                unserializeMessages(introArray, aimId, myAimid, theirs_last_delivered, theirs_last_read, Out introMessages);
+                decodeMessages(introArray, aimId, myAimid, theirs_last_delivered, theirs_last_read, Out introMessages);
             }
 
             if (helper->is_value_exist("modified"))
             {
                 auto modificationsArray = helper->get_value_as_array("modified");
-                unserializeMessages(modificationsArray, aimId, myAimid, theirs_last_delivered, theirs_last_read, Out modifications);
+                decodeMessages(modificationsArray, aimId, myAimid, theirs_last_delivered, theirs_last_read, Out modifications);
             }
 
             if (helper->is_value_exist("last_msg_in_index"))
@@ -860,6 +869,18 @@ namespace Data
         const QString &myAimid,
         const qint64 theirs_last_delivered,
         const qint64 theirs_last_read)
+    {
+        auto message = decodeMessage(msgColl, aimId, myAimid, theirs_last_delivered, theirs_last_read);
+        resolveNames(*message);
+        return message;
+    }
+
+    Data::MessageBuddySptr decodeMessage(
+        core::coll_helper &msgColl,
+        const QString &aimId,
+        const QString &myAimid,
+        const qint64 theirs_last_delivered,
+        const qint64 theirs_last_read)
     {
         auto message = std::make_shared<Data::MessageBuddy>();
 
@@ -982,10 +1003,7 @@ namespace Data
                 auto currentAimId = QString::fromUtf8(ment_helper.get_value_as_string("sn"));
 
                 if (!currentAimId.isEmpty())
-                {
-                    const auto friendly = Logic::GetFriendlyContainer()->getFriendly(currentAimId);
-                    message->Mentions_.emplace(std::move(currentAimId), friendly);
-                }
+                    message->Mentions_.emplace(std::move(currentAimId), QString());
             }
         }
 
@@ -1002,6 +1020,36 @@ namespace Data
             }
         }
 
+        if (msgColl->is_value_exist("text_spans"))
+        {
+            core::coll_helper spansColl(msgColl.get_value_as_collection("text_spans"), false);
+
+            auto spans = std::make_shared<common::tools::message_spans>();
+            spans->key_ = spansColl.get_value_as_uint("key");
+            spans->text_size_ = spansColl.get_value_as_uint("size");
+
+            core::iarray* spansArray = spansColl.get_value_as_array("spans");
+            const auto size = spansArray->size();
+            spans->spans_.reserve(size);
+            for (auto i = 0; i < size; ++i)
+            {
+                core::coll_helper spanColl(spansArray->get_at(i)->get_as_collection(), false);
+
+                common::tools::token_span span;
+                span.offset_ = spanColl.get_value_as_uint("offset");
+                span.length_ = spanColl.get_value_as_uint("length");
+                span.type_ = common::tools::url::type(spanColl.get_value_as_int("type"));
+                span.protocol_ = common::tools::url::protocol(spanColl.get_value_as_int("protocol"));
+                span.extension_ = common::tools::url::extension(spanColl.get_value_as_int("extension"));
+                if (spanColl->is_value_exist("url"))
+                    span.url_ = spanColl.get_value_as_string("url");
+
+                spans->spans_.push_back(std::move(span));
+            }
+
+            message->TextSpans_ = std::move(spans);
+        }
+
         if (msgColl->is_value_exist("shared_contact"))
         {
             auto contact_coll = msgColl.get_value_as_collection("shared_contact");
@@ -1013,6 +1061,28 @@ namespace Data
         return message;
     }
 
+    void resolveNames(MessageBuddy& _message)
+    {
+        for (auto& [aimId, friendly] : _message.Mentions_)
+            friendly = Logic::GetFriendlyContainer()->getFriendly(aimId);
+
+        for (auto& quote : _message.Quotes_)
+            quote.resolveNames();
+    }
+
+    void resolveNames(MessageBuddies& _messages)
+    {
+        for (const auto& message : std::as_const(_messages))
+            resolveNames(*message);
+    }
+
+    void resolveNames(MessagesResult& _result)
+    {
+        resolveNames(_result.messages);
+        resolveNames(_result.introMessages);
+        resolveNames(_result.modifications);
+    }
+
     ServerMessagesIds UnserializeServerMessagesIds(const core::coll_helper& helper)
     {
         auto aimId = QString::fromUtf8(helper.get_value_as_string("contact"));
@@ -1174,9 +1244,6 @@ namespace Data
         if (coll->is_value_exist("msg"))
             msgId_ = coll.get_value_as_int64("msg");
 
-        if (!senderId_.isEmpty())
-            senderFriendly_ = Logic::GetFriendlyContainer()->getFriendly(senderId_);
-
         if (coll->is_value_exist("forward"))
             isForward_ = coll.get_value_as_bool("forward");
 
@@ -1195,16 +1262,9 @@ namespace Data
         if (coll->is_value_exist("description"))
             description_ = QString::fromUtf8(coll.get_value_as_string("description"));
 
-        if (!chatId_.isEmpty() && Utils::isChat(chatId_))
-        {
-            if (const auto name = Logic::GetFriendlyContainer()->getFriendly(chatId_); !name.isEmpty() && name != chatId_)
-                chatName_ = name;
-            else if (coll->is_value_exist("chatName"))
-                chatName_ = QString::fromUtf8(coll.get_value_as_string("chatName"));
-        }
-
-        if (senderId_ == Ui::MyInfo()->aimId())
-            senderFriendly_ = Ui::MyInfo()->friendly();
+        // overridden by the friendly name in resolveNames, if there is one
+        if (!chatId_.isEmpty() && Utils::isChat(chatId_) && coll->is_value_exist("chatName"))
+            chatName_ = QString::fromUtf8(coll.get_value_as_string("chatName"));
 
         if (coll.is_value_exist("shared_contact"))
         {
@@ -1215,6 +1275,21 @@ namespace Data
         }
     }
 
+    void Quote::resolveNames()
+    {
+        if (!senderId_.isEmpty())
+            senderFriendly_ = Logic::GetFriendlyContainer()->getFriendly(senderId_);
+
+        if (!chatId_.isEmpty() && Utils::isChat(chatId_))
+        {
+            if (const auto name = Logic::GetFriendlyContainer()->getFriendly(chatId_); !name.isEmpty() && name != chatId_)
+                chatName_ = name;
+        }
+
+        if (senderId_ == Ui::MyInfo()->aimId())
+            senderFriendly_ = Ui::MyInfo()->friendly();
+    }
+
     void UrlSnippet::unserialize(core::icollection * _collection)
     {
         Ui::gui_coll_helper coll(_collection, false);
@@ -1246,6 +1321,21 @@ namespace Data
         const qint64 theirs_last_delivered,
         const qint64 theirs_last_read,
         Out Data::MessageBuddies &messages)
+    {
+        const auto first = messages.size();
+        decodeMessages(msgArray, aimId, myAimid, theirs_last_delivered, theirs_last_read, Out messages);
+
+        for (auto i = first; i < messages.size(); ++i)
+            resolveNames(*messages.at(i));
+    }
+
+    void decodeMessages(
+        core::iarray* msgArray,
+        const QString &aimId,
+        const QString &myAimid,
+        const qint64 theirs_last_delivered,
+        const qint64 theirs_last_read,
+        Out Data::MessageBuddies &messages)
     {
         assert(!aimId.isEmpty());
         assert(!myAimid.isEmpty());
@@ -1266,7 +1356,7 @@ namespace Data
                 false
             );
 
-            messages.push_back(Data::unserializeMessage(value, aimId, myAimid, theirs_last_delivered, theirs_last_read));
+            messages.push_back(Data::decodeMessage(value, aimId, myAimid, theirs_last_delivered, theirs_last_read));
         }
     }
 }
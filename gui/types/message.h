@@ -20,6 +20,14 @@ namespace HistoryControl
     using VoipEventInfoSptr = std::shared_ptr<class VoipEventInfo>;
 }
 
+namespace common
+{
+    namespace tools
+    {
+        struct message_spans;
+    }
+}
+
 namespace Logic
 {
     class MessageKey;
@@ -217,6 +225,9 @@ namespace Data
         MentionMap Mentions_;
         std::vector<UrlSnippet> snippets_;
 
+        // url spans of the trimmed text precomputed by the core, null if it sent none
+        std::shared_ptr<const common::tools::message_spans> TextSpans_;
+
         bool Chat_;
         QString ChatFriendly_;
 
@@ -399,6 +410,9 @@ namespace Data
 
         void serialize(core::icollection* _collection) const;
         void unserialize(core::icollection* _collection);
+
+        // friendly names of the sender and the chat, gui thread only
+        void resolveNames();
     };
 
     using QuotesVec = QVector<Data::Quote>;
@@ -447,6 +461,29 @@ namespace Data
         const qint64 theirs_last_delivered,
         const qint64 theirs_last_read);
 
+    // decode* are the unserialize* above without the friendly names lookups,
+    // so they can run off the gui thread; resolveNames fills the names in on the gui thread
+    MessagesResult DecodeMessageBuddies(core::coll_helper* helper, const QString &myAimid);
+
+    void decodeMessages(
+        core::iarray* msgArray,
+        const QString &aimId,
+        const QString &myAimid,
+        const qint64 theirs_last_delivered,
+        const qint64 theirs_last_read,
+        Out Data::MessageBuddies &messages);
+
+    Data::MessageBuddySptr decodeMessage(
+        core::coll_helper &msgColl,
+        const QString &aimId,
+        const QString &myAimid,
+        const qint64 theirs_last_delivered,
+        const qint64 theirs_last_read);
+
+    void resolveNames(MessageBuddy& _message);
+    void resolveNames(MessageBuddies& _messages);
+    void resolveNames(MessagesResult& _result);
+
     struct ServerMessagesIds
     {
         QString AimId_;
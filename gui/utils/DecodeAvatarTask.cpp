@@ -0,0 +1,45 @@
+#include "stdafx.h"
+
+#include "../../corelib/collection_helper.h"
+
+#include "DecodeAvatarTask.h"
+
+namespace Utils
+{
+    DecodeAvatarTask::DecodeAvatarTask(core::istream* _stream, const int _sizePx)
+        : stream_(_stream)
+        , sizePx_(_sizePx)
+    {
+        if (stream_)
+            stream_->addref();
+    }
+
+    DecodeAvatarTask::~DecodeAvatarTask()
+    {
+        if (stream_)
+            stream_->release();
+    }
+
+    void DecodeAvatarTask::run()
+    {
+        QImage image;
+
+        if (const auto size = stream_ ? stream_->size() : 0; size > 0)
+        {
+            image.loadFromData(stream_->read(size), int(size));
+            stream_->reset();
+        }
+
+        if (!image.isNull())
+        {
+            // small avatars are kept as they are, upscaling here only costs memory
+            if (sizePx_ > 0 && (image.width() > sizePx_ || image.height() > sizePx_))
+                image = image.scaled(sizePx_, sizePx_, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+            // the format raster pixmaps use, so QPixmap::fromImage doesn't convert
+            image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+        }
+
+        emit decoded(image);
+    }
+}
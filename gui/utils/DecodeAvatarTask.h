@@ -0,0 +1,32 @@
+#pragma once
+
+namespace core
+{
+    struct istream;
+}
+
+namespace Utils
+{
+    // decodes an avatar and scales it down to the requested size, so the gui thread only wraps it into a pixmap;
+    // a null stream gives a null image
+    class DecodeAvatarTask
+        : public QObject
+        , public QRunnable
+    {
+        Q_OBJECT
+
+    Q_SIGNALS:
+        void decoded(const QImage& _image);
+
+    public:
+        DecodeAvatarTask(core::istream* _stream, const int _sizePx);
+
+        virtual ~DecodeAvatarTask();
+
+        void run() override;
+
+    private:
+        core::istream* stream_;
+        int sizePx_;
+    };
+}
@@ -0,0 +1,39 @@
+#include "stdafx.h"
+
+#include "gui_coll_helper.h"
+
+#include "DecodeMessagesTask.h"
+
+namespace Utils
+{
+    DecodeMessagesTask::DecodeMessagesTask(core::coll_helper _params)
+        : params_(std::move(_params))
+    {
+    }
+
+    DecodeMessagesTask::~DecodeMessagesTask()
+    {
+    }
+
+    void DecodeMessagesTask::run()
+    {
+        const auto myAimid = params_.get<QString>("my_aimid");
+
+        result_ = Data::DecodeMessageBuddies(&params_, myAimid);
+
+        if (params_.is_value_exist("deleted"))
+        {
+            Data::MessageBuddies deleted;
+
+            auto deletedArray = params_.get_value_as_array("deleted");
+            const auto theirs_last_delivered = params_.get_value_as_int64("theirs_last_delivered", -1);
+            const auto theirs_last_read = params_.get_value_as_int64("theirs_last_read", -1);
+
+            Data::decodeMessages(deletedArray, result_.aimId, myAimid, theirs_last_delivered, theirs_last_read, Out deleted);
+
+            deleted_ = std::move(deleted);
+        }
+
+        emit decoded();
+    }
+}
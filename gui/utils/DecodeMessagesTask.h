@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../../corelib/collection_helper.h"
+#include "../types/message.h"
+
+namespace Utils
+{
+    // decodes an archive messages batch, friendly names are left for Data::resolveNames
+    class DecodeMessagesTask
+        : public QObject
+        , public QRunnable
+    {
+        Q_OBJECT
+
+    Q_SIGNALS:
+        void decoded();
+
+    public:
+        explicit DecodeMessagesTask(core::coll_helper _params);
+
+        virtual ~DecodeMessagesTask();
+
+        void run() override;
+
+        Data::MessagesResult& result() noexcept { return result_; }
+        std::optional<Data::MessageBuddies>& deleted() noexcept { return deleted_; }
+
+    private:
+        core::coll_helper params_;
+
+        Data::MessagesResult result_;
+        std::optional<Data::MessageBuddies> deleted_;
+    };
+}
@@ -0,0 +1,36 @@
+#include "stdafx.h"
+
+#include "DecodeStickerTask.h"
+
+namespace Utils
+{
+    DecodeStickerTask::DecodeStickerTask(const QString& _path)
+        : path_(_path)
+    {
+        assert(!path_.isEmpty());
+    }
+
+    DecodeStickerTask::~DecodeStickerTask() = default;
+
+    void DecodeStickerTask::run()
+    {
+        QImage image;
+
+        QFile file(path_);
+        if (file.open(QIODevice::ReadOnly))
+        {
+            // the png is read in place, only the pixels are allocated
+            const auto size = file.size();
+            if (size > 0 && size <= std::numeric_limits<int>::max())
+            {
+                if (const auto data = file.map(0, size))
+                {
+                    image.loadFromData(data, int(size));
+                    file.unmap(data);
+                }
+            }
+        }
+
+        emit decoded(path_, image);
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+namespace Utils
+{
+    // decodes a stored sticker image off the gui thread, a null image if the file can't be decoded
+    class DecodeStickerTask
+        : public QObject
+        , public QRunnable
+    {
+        Q_OBJECT
+
+    Q_SIGNALS:
+        void decoded(const QString& _path, const QImage& _image);
+
+    public:
+        explicit DecodeStickerTask(const QString& _path);
+
+        virtual ~DecodeStickerTask();
+
+        void run() override;
+
+    private:
+        const QString path_;
+    };
+}
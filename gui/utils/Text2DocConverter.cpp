@@ -328,6 +328,9 @@ namespace
         UriCallback_ = uriCallback;
         HtmlMode_ = htmlMode;
 
+        // most texts have no urls at all, don't feed them to the parser char by char
+        const auto findLinks = convertLinks && common::tools::url_parser::has_url_candidates(reinterpret_cast<const char16_t*>(text.utf16()), size_t(text.size()));
+
         while (!IsEos())
         {
             InputCursorStack_.resize(0);
@@ -342,7 +345,7 @@ namespace
                 continue;
             }
 
-            if (convertLinks && ParseUrl(breakDocument))
+            if (findLinks && ParseUrl(breakDocument))
             {
                 continue;
             }
@@ -1,6 +1,11 @@
 #include "stdafx.h"
 #include "stackblur.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STACKBLUR_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace
 {
     constexpr unsigned short const stackblur_mul[] =
@@ -46,12 +51,10 @@ namespace
     constexpr auto precomputedArraySize = 255;
     static_assert(std::size(stackblur_mul) == precomputedArraySize);
     static_assert(std::size(stackblur_shr) == precomputedArraySize);
-}
 
-namespace Utils
-{
-    /// Stackblur algorithm body
-    void stackblurJob(unsigned char* src,   ///< input image data
+    /// Stackblur algorithm body, scalar version
+    [[maybe_unused]]
+    void stackblurJobScalar(unsigned char* src,   ///< input image data
         const unsigned int w,               ///< image width
         const unsigned int h,               ///< image height
         const unsigned int radius,          ///< blur intensity (should be in 2..254 range)
@@ -313,6 +316,221 @@ namespace Utils
         }
     }
 
+#ifdef STACKBLUR_SSE2
+    // pixel channels widened to 32 bit lanes
+    inline __m128i loadPixel(const unsigned char* _p) noexcept
+    {
+        int32_t v;
+        memcpy(&v, _p, sizeof(v));
+        const auto zero = _mm_setzero_si128();
+        return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(v), zero), zero);
+    }
+
+    inline void storePixel(unsigned char* _p, __m128i _v) noexcept
+    {
+        _v = _mm_packs_epi32(_v, _v);
+        _v = _mm_packus_epi16(_v, _v);
+        const int32_t v = _mm_cvtsi128_si32(_v);
+        memcpy(_p, &v, sizeof(v));
+    }
+
+    // _pixel * _factor, both fit 16 bits so the high halves of the lanes stay zero
+    inline __m128i mulPixel(__m128i _pixel, unsigned int _factor) noexcept
+    {
+        return _mm_mullo_epi16(_pixel, _mm_set1_epi32(int(_factor)));
+    }
+
+    // (_sum * _mul) >> _shr, products don't fit 32 bits so even and odd lanes are multiplied as 64 bit
+    inline __m128i mulShift(__m128i _sum, __m128i _mul, __m128i _shr) noexcept
+    {
+        const auto even = _mm_srl_epi64(_mm_mul_epu32(_sum, _mul), _shr);
+        const auto odd = _mm_srl_epi64(_mm_mul_epu32(_mm_srli_epi64(_sum, 32), _mul), _shr);
+        return _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+    }
+
+    /// same steps as the scalar body, all 4 channels of a pixel are summed at once
+    void blurLineSse2(unsigned char* _line,     ///< first pixel of a row or a column
+        const unsigned int _len,                ///< pixels in the line
+        const size_t _stride,                   ///< bytes between neighbour pixels
+        const unsigned int _radius,
+        unsigned char* _stack,
+        const __m128i _mul,
+        const __m128i _shr
+        ) noexcept
+    {
+        const unsigned int lm = _len - 1;
+        const unsigned int div = (_radius * 2) + 1;
+
+        auto sum = _mm_setzero_si128();
+        auto sumIn = _mm_setzero_si128();
+        auto sumOut = _mm_setzero_si128();
+
+        const unsigned char* srcPtr = _line;
+        const auto first = loadPixel(srcPtr);
+        for (unsigned int i = 0; i <= _radius; ++i)
+        {
+            memcpy(_stack + 4 * i, srcPtr, 4);
+            sum = _mm_add_epi32(sum, mulPixel(first, i + 1));
+            sumOut = _mm_add_epi32(sumOut, first);
+        }
+
+        for (unsigned int i = 1; i <= _radius; ++i)
+        {
+            if (i <= lm)
+                srcPtr += _stride;
+
+            memcpy(_stack + 4 * (i + _radius), srcPtr, 4);
+            const auto pixel = loadPixel(srcPtr);
+            sum = _mm_add_epi32(sum, mulPixel(pixel, _radius + 1 - i));
+            sumIn = _mm_add_epi32(sumIn, pixel);
+        }
+
+        unsigned int sp = _radius;
+        unsigned int xp = std::min(_radius, lm);
+        srcPtr = _line + xp * _stride;
+        unsigned char* dstPtr = _line;
+        for (unsigned int x = 0; x < _len; ++x)
+        {
+            storePixel(dstPtr, mulShift(sum, _mul, _shr));
+            dstPtr += _stride;
+
+            sum = _mm_sub_epi32(sum, sumOut);
+
+            auto stackStart = sp + div - _radius;
+            if (stackStart >= div)
+                stackStart -= div;
+            const auto stackPtr = _stack + 4 * stackStart;
+            sumOut = _mm_sub_epi32(sumOut, loadPixel(stackPtr));
+
+            if (xp < lm)
+            {
+                srcPtr += _stride;
+                ++xp;
+            }
+
+            memcpy(stackPtr, srcPtr, 4);
+            sumIn = _mm_add_epi32(sumIn, loadPixel(srcPtr));
+            sum = _mm_add_epi32(sum, sumIn);
+
+            if (++sp >= div)
+                sp = 0;
+
+            const auto out = loadPixel(_stack + 4 * sp);
+            sumOut = _mm_add_epi32(sumOut, out);
+            sumIn = _mm_sub_epi32(sumIn, out);
+        }
+    }
+
+    void stackblurJobSse2(unsigned char* src, const unsigned int w, const unsigned int h, const unsigned int radius, const int cores, const int core, const int step, unsigned char* stack)
+    {
+        const auto mul = _mm_set1_epi32(stackblur_mul[radius]);
+        const auto shr = _mm_cvtsi32_si128(stackblur_shr[radius]);
+        const size_t w4 = size_t(w) * 4;
+
+        if (step == 1)
+        {
+            const unsigned int minY = core * h / cores;
+            const unsigned int maxY = (core + 1) * h / cores;
+            for (auto y = minY; y < maxY; ++y)
+                blurLineSse2(src + w4 * y, w, 4, radius, stack, mul, shr);
+        }
+        else if (step == 2)
+        {
+            const unsigned int minX = core * w / cores;
+            const unsigned int maxX = (core + 1) * w / cores;
+            for (auto x = minX; x < maxX; ++x)
+                blurLineSse2(src + 4 * x, h, w4, radius, stack, mul, shr);
+        }
+    }
+#endif
+
+    // blur threads live between calls, the global pool isn't used since callers run in it themselves
+    QThreadPool& blurPool()
+    {
+        static QThreadPool pool;
+        return pool;
+    }
+
+    // the calling thread takes the first band, the pool the others
+    void runPass(std::vector<std::unique_ptr<Utils::StackBlurTask>>& _workers, QSemaphore& _done, int _step)
+    {
+        for (size_t i = 1; i < _workers.size(); ++i)
+        {
+            _workers[i]->step_ = _step;
+            blurPool().start(_workers[i].get());
+        }
+
+        _workers.front()->step_ = _step;
+        _workers.front()->run();
+        _done.acquire(int(_workers.size()));
+    }
+
+    void stackblurPasses(unsigned char* src, const unsigned int w, const unsigned int h, const unsigned int radius, const int cores)
+    {
+        const unsigned int div = (radius * 2) + 1;
+        std::vector<unsigned char> stack(div * 4 * cores);
+
+        if (cores <= 1)
+        {
+            // no multithreading
+            Utils::stackblurJob(src, w, h, radius, 1, 0, 1, stack.data());
+            Utils::stackblurJob(src, w, h, radius, 1, 0, 2, stack.data());
+            return;
+        }
+
+        QSemaphore done;
+        std::vector<std::unique_ptr<Utils::StackBlurTask>> workers(cores);
+        for (int i = 0; i < cores; ++i)
+        {
+            workers[i] = std::make_unique<Utils::StackBlurTask>(src, w, h, radius, cores, i, 1, stack.data() + div * 4 * i);
+            workers[i]->setAutoDelete(false);
+            workers[i]->done_ = &done;
+        }
+
+        runPass(workers, done, 1);
+        runPass(workers, done, 2);
+    }
+
+    // radii from this one are blurred on a downscaled copy: the result looks the same,
+    // while the work drops with the square of the scale
+    constexpr unsigned int downscaleMinRadius = 32;
+    constexpr unsigned int downscaleMaxFactor = 4;
+    constexpr unsigned int downscaleMinSize = 32;
+
+    unsigned int downscaleFactor(const unsigned int w, const unsigned int h, const unsigned int radius) noexcept
+    {
+        if (radius < downscaleMinRadius)
+            return 1;
+
+        auto factor = std::min(radius / (downscaleMinRadius / 2), downscaleMaxFactor);
+        while (factor > 1 && (w / factor < downscaleMinSize || h / factor < downscaleMinSize))
+            --factor;
+        return factor;
+    }
+
+    void stackblurDownscaled(unsigned char* src, const unsigned int w, const unsigned int h, const unsigned int radius, const int cores, const unsigned int factor)
+    {
+        const QImage source(src, int(w), int(h), QImage::Format_ARGB32); // no copy
+        auto small = source.scaled(int(w / factor), int(h / factor), Qt::IgnoreAspectRatio, Qt::SmoothTransformation).convertToFormat(QImage::Format_ARGB32);
+        stackblurPasses(small.bits(), small.width(), small.height(), std::max(radius / factor, Utils::minRadius()), cores);
+
+        const auto result = small.scaled(int(w), int(h), Qt::IgnoreAspectRatio, Qt::SmoothTransformation).convertToFormat(QImage::Format_ARGB32);
+        assert(result.bytesPerLine() == int(w * 4));
+        memcpy(src, result.constBits(), size_t(w) * 4 * h);
+    }
+}
+
+namespace Utils
+{
+    void stackblurJob(unsigned char* src, const unsigned int w, const unsigned int h, const unsigned int radius, const int cores, const int core, const int step, unsigned char* stack)
+    {
+#ifdef STACKBLUR_SSE2
+        stackblurJobSse2(src, w, h, radius, cores, core, step, stack);
+#else
+        stackblurJobScalar(src, w, h, radius, cores, core, step, stack);
+#endif
+    }
+
     void stackblur(unsigned char* src,  ///< input image data
         const unsigned int w,           ///< image width
         const unsigned int h,           ///< image height
@@ -322,40 +540,75 @@ namespace Utils
     {
         assert(src);
         assert(radius <= maxRadius() && radius >= minRadius());
-        if (radius > maxRadius() || radius < minRadius() || !src)
+        if (radius > maxRadius() || radius < minRadius() || !src || !w || !h)
             return;
 
         const auto maxCores = QThread::idealThreadCount();
         const auto cores = std::clamp(coreCount == -1 ? maxCores : coreCount, 1, maxCores);
-        const unsigned int div = (radius * 2) + 1;
-        std::vector<unsigned char> stack(div * 4 * cores);
 
-        if (cores <= 1)
-        {
-            // no multithreading
-            stackblurJob(src, w, h, radius, 1, 0, 1, stack.data());
-            stackblurJob(src, w, h, radius, 1, 0, 2, stack.data());
-        }
+        if (const auto factor = downscaleFactor(w, h, radius); factor > 1)
+            stackblurDownscaled(src, w, h, radius, cores, factor);
         else
+            stackblurPasses(src, w, h, radius, cores);
+    }
+
+#ifdef GUI_TESTS
+    bool stackblurBenchmark()
+    {
+#ifdef STACKBLUR_SSE2
+        struct BenchCase
         {
-            QThreadPool pool;
+            unsigned int w_;
+            unsigned int h_;
+            unsigned int radius_;
+        };
 
-            std::vector<std::unique_ptr<StackBlurTask>> workers(cores);
-            for (int i = 0; i < cores; ++i)
-            {
-                workers[i] = std::make_unique<StackBlurTask>(src, w, h, radius, cores, i, 1, stack.data() + div * 4 * i);
-                workers[i]->setAutoDelete(false);
-                pool.start(workers[i].get());
-            }
-            pool.waitForDone();
+        // the odd sizes and the radii longer than a line check the clamping at the edges
+        constexpr BenchCase cases[] =
+        {
+            { 1, 1, 2 },
+            { 7, 3, 5 },
+            { 33, 17, 40 },
+            { 300, 200, 254 },
+            { 640, 480, 10 },
+            { 1920, 1080, 5 },
+            { 1920, 1080, 100 },
+        };
+
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> dist(0, 255);
+
+        bool passed = true;
+        for (const auto& c : cases)
+        {
+            std::vector<unsigned char> scalar(size_t(c.w_) * c.h_ * 4);
+            std::generate(scalar.begin(), scalar.end(), [&gen, &dist]() { return static_cast<unsigned char>(dist(gen)); });
+            auto sse2 = scalar;
 
-            for (int i = 0; i < cores; ++i)
+            std::vector<unsigned char> stack((c.radius_ * 2 + 1) * 4);
+
+            const auto run = [&c, &stack](auto _job, std::vector<unsigned char>& _image)
             {
-                workers[i]->step_ = 2;
-                pool.start(workers[i].get());
-            }
-            pool.waitForDone();
+                const auto start = std::chrono::steady_clock::now();
+                _job(_image.data(), c.w_, c.h_, c.radius_, 1, 0, 1, stack.data());
+                _job(_image.data(), c.w_, c.h_, c.radius_, 1, 0, 2, stack.data());
+                return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            };
+
+            const auto scalarTime = run(stackblurJobScalar, scalar);
+            const auto sse2Time = run(stackblurJobSse2, sse2);
+            const auto same = scalar == sse2;
+            passed = passed && same;
+
+            qInfo("stackblur %ux%u r=%u: scalar %lld us, sse2 %lld us%s", c.w_, c.h_, c.radius_,
+                static_cast<long long>(scalarTime), static_cast<long long>(sse2Time), same ? "" : ", results differ");
         }
 
+        return passed;
+#else
+        qInfo("stackblur: the build has no SSE2 kernel");
+        return true;
+#endif
     }
-}
\ No newline at end of file
+#endif
+}
@@ -34,6 +34,7 @@ namespace Utils
     /// http://www.antigrain.com/__code/include/agg_blur.h.html
     /// Adapation for Qt ICQ by Alexander Pershin
     /// This version works only with RGBA color
+    /// Large radii are blurred on a downscaled copy
     void stackblur(unsigned char* src,  ///< input image data
         const unsigned int w,           ///< image width
         const unsigned int h,           ///< image height
@@ -52,6 +53,7 @@ namespace Utils
         int core_;
         int step_;
         unsigned char* stack_;
+        QSemaphore* done_ = nullptr;  ///< released when the job is finished
 
         StackBlurTask(unsigned char* _src, unsigned int _w, unsigned int _h, unsigned int _radius, int _cores, int _core, int _step, unsigned char* _stack)
             : src_(_src)
@@ -68,9 +70,17 @@ namespace Utils
         void run() override
         {
             stackblurJob(src_, w_, h_, radius_, cores_, core_, step_, stack_);
+            if (done_)
+                done_->release();
         }
     };
 
+#ifdef GUI_TESTS
+    /// Compares the SSE2 kernel with the scalar one on random images and prints the timings,
+    /// false if their results differ. Run with --stackblur-bench in a GUI_TESTS build
+    bool stackblurBenchmark();
+#endif
+
     constexpr unsigned int minRadius() noexcept { return 2; }
     constexpr unsigned int maxRadius() noexcept { return 254; }
 }
\ No newline at end of file
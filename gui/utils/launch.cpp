@@ -21,6 +21,7 @@
 #include "styles/WallpaperId.h"
 #include "sys/sys.h"
 #include "controls/ClickWidget.h"
+#include "utils/blur/stackblur.h"
 
 #include "media/ptt/AudioUtils.h"
 #include "media/ptt/AudioRecorder2.h"
@@ -90,6 +91,7 @@ void makeBuild(const int _argc, char* _argv[])
 launch::CommandLineParser::CommandLineParser(int _argc, char* _argv[])
     : isUrlCommand_(false)
     , isVersionCommand_(false)
+    , isBlurBenchmarkCommand_(false)
 {
     if (_argc > 0)
     {
@@ -114,6 +116,13 @@ launch::CommandLineParser::CommandLineParser(int _argc, char* _argv[])
                 isVersionCommand_ = true;
                 break;
             }
+#ifdef GUI_TESTS
+            else if (i == 1 && arg == std::string_view("--stackblur-bench"))
+            {
+                isBlurBenchmarkCommand_ = true;
+                break;
+            }
+#endif
         }
     }
 }
@@ -133,6 +142,11 @@ bool launch::CommandLineParser::isVersionCommand() const
     return isVersionCommand_;
 }
 
+bool launch::CommandLineParser::isBlurBenchmarkCommand() const
+{
+    return isBlurBenchmarkCommand_;
+}
+
 const QString& launch::CommandLineParser::getUrlCommand() const
 {
     return urlCommand_;
@@ -276,6 +290,11 @@ int launch::main(int _argc, char* _argv[])
             return 0;
         }
 
+#ifdef GUI_TESTS
+        if (cmd_parser.isBlurBenchmarkCommand())
+            return Utils::stackblurBenchmark() ? 0 : 1;
+#endif
+
         if (!app.isMainInstance())
             return app.switchInstance(cmd_parser);
 
@@ -8,6 +8,7 @@ namespace launch
         QString urlCommand_;
 
         bool isVersionCommand_;
+        bool isBlurBenchmarkCommand_;
 
     public:
 
@@ -17,6 +18,7 @@ namespace launch
 
         bool isUrlCommand() const;
         bool isVersionCommand() const;
+        bool isBlurBenchmarkCommand() const;
 
         const QString& getUrlCommand() const;
 